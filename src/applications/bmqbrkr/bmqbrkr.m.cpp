@@ -17,6 +17,7 @@
 
 // Application
 #include <bmqbrkrscm_version.h>
+#include <m_bmqbrkr_benchmark.h>
 #include <m_bmqbrkr_task.h>
 
 // MQB
@@ -26,6 +27,9 @@
 #include <mqbu_exit.h>
 #include <mqbu_messageguidutil.h>
 
+// BMQ
+#include <bmqp_protocol.h>
+
 // MWC
 #include <mwcsys_time.h>
 #include <mwctsk_alarmlog.h>
@@ -59,6 +63,7 @@
 #include <bsl_stdexcept.h>
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
+#include <bsl_vector.h>
 #include <bslma_managedptr.h>
 #include <bslmt_semaphore.h>
 #include <bsls_annotation.h>
@@ -592,6 +597,29 @@ run(bsl::ostream& errorDescription, TaskEnvironment* taskEnv, bool wait = true)
     return 0;
 }
 
+/// Benchmark the Application, started in the specified `taskEnv`, with the
+/// specified `parameters`, and print the report to the standard output.
+/// Return 0 on success, or a non-zero error code and populate the specified
+/// `errorDescription` with a description of the error otherwise.
+static int runBenchmark(bsl::ostream&                         errorDescription,
+                        TaskEnvironment*                      taskEnv,
+                        const m_bmqbrkr::BenchmarkParameters& parameters)
+{
+    m_bmqbrkr::Benchmark benchmark(
+        parameters,
+        taskEnv->d_task.object().allocatorStore().get("Benchmark"));
+
+    const int rc = benchmark.run();
+    benchmark.report(bsl::cout);
+    if (rc != 0) {
+        errorDescription << "Failed to benchmark some of the domains [rc: "
+                         << rc << "]";
+        return 1;  // RETURN
+    }
+
+    return 0;
+}
+
 int main(int argc, const char* argv[])
 {
     // Parse command line parameters
@@ -603,6 +631,10 @@ int main(int argc, const char* argv[])
     int         port    = 0;
     bool        version = false;
 
+    bool                           benchmark = false;
+    bsl::vector<bsl::string>       benchmarkDomains;
+    m_bmqbrkr::BenchmarkParameters benchmarkParameters;
+
     balcl::OptionInfo specTable[] = {
         {"",
          "config",
@@ -639,6 +671,47 @@ int main(int argc, const char* argv[])
          "Show broker version number",
          balcl::TypeInfo(&version),
          balcl::OccurrenceInfo::e_OPTIONAL},
+        {"benchmark",
+         "benchmark",
+         "Benchmark the broker in-process, print the report and exit",
+         balcl::TypeInfo(&benchmark),
+         balcl::OccurrenceInfo::e_OPTIONAL},
+        {"benchmarkDomain",
+         "benchmarkDomain",
+         "Domain to benchmark (can be repeated; default: the strong and "
+         "eventual consistency persistent priority test domains)",
+         balcl::TypeInfo(&benchmarkDomains),
+         balcl::OccurrenceInfo::e_OPTIONAL},
+        {"benchmarkQueues",
+         "benchmarkQueues",
+         "Number of queues per benchmarked domain",
+         balcl::TypeInfo(&benchmarkParameters.d_numQueues),
+         balcl::OccurrenceInfo(benchmarkParameters.d_numQueues)},
+        {"benchmarkRate",
+         "benchmarkRate",
+         "Target rate, in messages per second, per benchmarked domain",
+         balcl::TypeInfo(&benchmarkParameters.d_rate),
+         balcl::OccurrenceInfo(benchmarkParameters.d_rate)},
+        {"benchmarkMsgSize",
+         "benchmarkMsgSize",
+         "Size, in bytes, of the benchmark messages",
+         balcl::TypeInfo(&benchmarkParameters.d_msgSize),
+         balcl::OccurrenceInfo(benchmarkParameters.d_msgSize)},
+        {"benchmarkDuration",
+         "benchmarkDuration",
+         "Duration, in seconds, of the benchmark of each domain",
+         balcl::TypeInfo(&benchmarkParameters.d_duration),
+         balcl::OccurrenceInfo(benchmarkParameters.d_duration)},
+        {"benchmarkWarmup",
+         "benchmarkWarmup",
+         "Duration, in seconds, of the warmup of each domain",
+         balcl::TypeInfo(&benchmarkParameters.d_warmup),
+         balcl::OccurrenceInfo(benchmarkParameters.d_warmup)},
+        {"benchmarkReport",
+         "benchmarkReport",
+         "Path of the JSON benchmark report",
+         balcl::TypeInfo(&benchmarkParameters.d_reportPath),
+         balcl::OccurrenceInfo::e_OPTIONAL},
     };
 
     balcl::CommandLine commandLine(specTable);
@@ -662,6 +735,18 @@ int main(int argc, const char* argv[])
         return mqbu::ExitCode::e_COMMAND_LINE;  // RETURN
     }
 
+    if (benchmark &&
+        (benchmarkParameters.d_numQueues <= 0 ||
+         benchmarkParameters.d_rate <= 0 ||
+         benchmarkParameters.d_msgSize < 0 ||
+         benchmarkParameters.d_msgSize >
+             bmqp::PutHeader::k_MAX_PAYLOAD_SIZE_SOFT ||
+         benchmarkParameters.d_duration <= 0 ||
+         benchmarkParameters.d_warmup < 0)) {
+        bsl::cerr << "Error: Invalid benchmark parameters.\n";
+        return mqbu::ExitCode::e_COMMAND_LINE;  // RETURN
+    }
+
     printStartStopTrace("STARTING");
 
     ignoreSigpipe();
@@ -749,7 +834,7 @@ int main(int argc, const char* argv[])
     }
 
     // Run
-    rc = run(errorDescription, &taskEnv);
+    rc = run(errorDescription, &taskEnv, !benchmark);
     if (rc != 0) {
         MWCTSK_ALARMLOG_PANIC("STARTUP")
             << "(" << rc << "): " << errorDescription.str()
@@ -759,6 +844,40 @@ int main(int argc, const char* argv[])
         return mqbu::ExitCode::e_RUN;  // RETURN
     }
 
+    if (benchmark) {
+        // The broker started: a failure of the benchmark is not a failure
+        // of the broker, and is reported as such.
+        const mqbcfg::AppConfig& appConfig = taskEnv.d_config.appConfig();
+        if (appConfig.networkInterfaces().tcpInterface().isNull()) {
+            errorDescription << "Benchmark requires a TCP interface";
+            rc = 1;
+        }
+        else {
+            const int brokerPort =
+                appConfig.networkInterfaces().tcpInterface().value().port();
+            benchmarkParameters.d_brokerUri = "tcp://localhost:" +
+                                              bsl::to_string(brokerPort);
+            if (benchmarkDomains.empty()) {
+                benchmarkDomains.push_back("bmq.test.persistent.priority.sc");
+                benchmarkDomains.push_back("bmq.test.persistent.priority");
+            }
+            benchmarkParameters.d_domains = benchmarkDomains;
+            rc = runBenchmark(errorDescription, &taskEnv, benchmarkParameters);
+        }
+        printStartStopTrace("STOPPING", taskEnv.d_instanceId);
+
+        if (rc != 0) {
+            BALL_LOG_ERROR << "Benchmark failed (" << rc
+                           << "): " << errorDescription.str();
+            bsl::cerr << "BENCHMARK ERROR (" << rc
+                      << "): " << errorDescription.str() << "\n"
+                      << bsl::flush;
+            shutdownApplication(&taskEnv);
+            shutdownTask(&taskEnv);
+            return mqbu::ExitCode::e_BENCH_START;  // RETURN
+        }
+    }
+
     // Clean shutdown
     shutdownApplication(&taskEnv);
     shutdownTask(&taskEnv);
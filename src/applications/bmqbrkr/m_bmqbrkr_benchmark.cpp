@@ -0,0 +1,471 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// m_bmqbrkr_benchmark.cpp                                            -*-C++-*-
+#include <m_bmqbrkr_benchmark.h>
+
+// BMQ
+#include <bmqa_queueid.h>
+#include <bmqa_session.h>
+#include <bmqa_sessionevent.h>
+#include <bmqt_queueflags.h>
+#include <bmqt_queueoptions.h>
+#include <bmqt_resultcode.h>
+#include <bmqt_sessionoptions.h>
+
+// MWC
+#include <mwcu_printutil.h>
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bdlf_bind.h>
+#include <bdlt_timeunitratio.h>
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bslma_default.h>
+#include <bslma_managedptr.h>
+#include <bslmt_threadutil.h>
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+
+// SYSTEM
+#include <sys/resource.h>
+
+namespace BloombergLP {
+namespace m_bmqbrkr {
+
+namespace {
+
+/// Maximum number of overdue messages to post in one event.
+const int k_MAX_EVENT_SIZE = 64;
+
+/// Maximum duration, in seconds, to wait for the messages in flight at the
+/// end of a run.
+const int k_DRAIN_TIMEOUT_S = 5;
+
+/// Return the user and system CPU time, in nanoseconds, consumed so far by
+/// all the threads of this process, i.e. by both the broker and the client of
+/// the benchmark.
+bsls::Types::Int64 processCpuTime()
+{
+    struct rusage usage;
+    if (::getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;  // RETURN
+    }
+
+    return (static_cast<bsls::Types::Int64>(usage.ru_utime.tv_sec) +
+            usage.ru_stime.tv_sec) *
+               bdlt::TimeUnitRatio::k_NS_PER_S +
+           (static_cast<bsls::Types::Int64>(usage.ru_utime.tv_usec) +
+            usage.ru_stime.tv_usec) *
+               bdlt::TimeUnitRatio::k_NS_PER_US;
+}
+
+// ==================
+// class BenchmarkRun
+// ==================
+
+/// Run of the benchmark against one domain: session, queues, producer and
+/// consumer of the messages.
+class BenchmarkRun : public bmqa::SessionEventHandler {
+  private:
+    // CLASS-SCOPE CATEGORY
+    BALL_LOG_SET_CLASS_CATEGORY("BMQBRKR.BENCHMARK");
+
+    // DATA
+    bslma::Allocator* d_allocator_p;
+
+    const BenchmarkParameters& d_parameters;
+
+    bslma::ManagedPtr<bmqa::Session> d_session_mp;
+
+    bsl::vector<bmqa::QueueId> d_queueIds;
+
+    bdlbb::PooledBlobBufferFactory d_bufferFactory;
+
+    bdlbb::Blob d_payload;
+
+    mqbtst::BenchmarkSchedule d_schedule;
+
+    mqbtst::BenchmarkStats d_stats;
+
+    bsls::AtomicBool d_isRunning;
+
+  private:
+    // NOT IMPLEMENTED
+    BenchmarkRun(const BenchmarkRun&) BSLS_KEYWORD_DELETED;
+    BenchmarkRun& operator=(const BenchmarkRun&) BSLS_KEYWORD_DELETED;
+
+    // PRIVATE MANIPULATORS
+    //   (virtual: bmqa::SessionEventHandler)
+    void onSessionEvent(const bmqa::SessionEvent& event) BSLS_KEYWORD_OVERRIDE;
+
+    /// Record the latency of, and confirm, the messages of the specified
+    /// message `event`.
+    void onMessageEvent(const bmqa::MessageEvent& event) BSLS_KEYWORD_OVERRIDE;
+
+    // PRIVATE MANIPULATORS
+
+    /// Post the messages of the schedule at their intended send time.
+    void producerThread();
+
+  public:
+    // CREATORS
+    BenchmarkRun(const BenchmarkParameters& parameters,
+                 bslma::Allocator*          allocator);
+
+    ~BenchmarkRun() BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+
+    /// Start the session and open the queues of the specified `domain`.
+    /// Return 0 on success, or a non-zero value otherwise.
+    int initialize(const bsl::string& domain);
+
+    /// Post messages according to the schedule, wait for them to be
+    /// received, and load the results into the specified `result`.  Return
+    /// 0 on success, or a non-zero value otherwise.
+    int run(Benchmark::Result* result);
+};
+
+// ------------------
+// class BenchmarkRun
+// ------------------
+
+void BenchmarkRun::onSessionEvent(const bmqa::SessionEvent& event)
+{
+    BALL_LOG_INFO << "Session event: " << event;
+}
+
+void BenchmarkRun::onMessageEvent(const bmqa::MessageEvent& event)
+{
+    mqbtst::BenchmarkUtil::confirmMessages(d_session_mp.get(),
+                                           &d_stats,
+                                           d_schedule,
+                                           event,
+                                           d_allocator_p);
+}
+
+void BenchmarkRun::producerThread()
+{
+    mqbtst::BenchmarkUtil::postMessages(d_session_mp.get(),
+                                        &d_stats,
+                                        d_schedule,
+                                        d_queueIds,
+                                        d_payload,
+                                        0,
+                                        1,
+                                        k_MAX_EVENT_SIZE,
+                                        d_isRunning,
+                                        d_allocator_p);
+}
+
+BenchmarkRun::BenchmarkRun(const BenchmarkParameters& parameters,
+                           bslma::Allocator*          allocator)
+: d_allocator_p(allocator)
+, d_parameters(parameters)
+, d_session_mp()
+, d_queueIds(allocator)
+, d_bufferFactory(4096, allocator)
+, d_payload(&d_bufferFactory, allocator)
+, d_schedule()
+, d_stats(allocator)
+, d_isRunning(false)
+{
+    for (int i = 0; i < d_parameters.d_msgSize; ++i) {
+        char c = static_cast<char>('A' + i % 26);
+        bdlbb::BlobUtil::append(&d_payload, &c, 1);
+    }
+}
+
+BenchmarkRun::~BenchmarkRun()
+{
+    if (d_session_mp) {
+        d_session_mp->stop();
+    }
+}
+
+int BenchmarkRun::initialize(const bsl::string& domain)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS             = 0,
+        rc_START_SESSION_ERROR = -1,
+        rc_OPEN_QUEUE_ERROR    = -2
+    };
+
+    bmqt::SessionOptions options;
+    options.setBrokerUri(d_parameters.d_brokerUri);
+
+    bslma::ManagedPtr<bmqa::SessionEventHandler> managedHandler(
+        this,
+        d_allocator_p,
+        bslma::ManagedPtrNilDeleter<bmqa::SessionEventHandler>::deleter);
+    d_session_mp.load(
+        new (*d_allocator_p)
+            bmqa::Session(managedHandler, options, d_allocator_p),
+        d_allocator_p);
+
+    int rc = d_session_mp->start();
+    if (rc != 0) {
+        BALL_LOG_ERROR << "Unable to start session [rc: " << rc << " - "
+                       << bmqt::GenericResult::Enum(rc) << "]";
+        d_session_mp.reset();
+        return rc_START_SESSION_ERROR;  // RETURN
+    }
+
+    bsls::Types::Uint64 flags = 0;
+    bmqt::QueueFlagsUtil::setReader(&flags);
+    bmqt::QueueFlagsUtil::setWriter(&flags);
+
+    d_queueIds.reserve(d_parameters.d_numQueues);
+    for (int i = 0; i < d_parameters.d_numQueues; ++i) {
+        bsl::string uri("bmq://", d_allocator_p);
+        uri.append(domain).append("/benchmark-").append(bsl::to_string(i));
+
+        d_queueIds.push_back(bmqa::QueueId(i + 1, d_allocator_p));
+        bmqa::OpenQueueStatus result = d_session_mp->openQueueSync(
+            &d_queueIds.back(),
+            uri,
+            flags,
+            bmqt::QueueOptions());
+        if (!result) {
+            BALL_LOG_ERROR << "Error while opening queue '" << uri
+                           << "': [result: " << result << "]";
+            return rc_OPEN_QUEUE_ERROR;  // RETURN
+        }
+    }
+
+    return rc_SUCCESS;
+}
+
+int BenchmarkRun::run(Benchmark::Result* result)
+{
+    d_schedule.initialize(static_cast<bsls::Types::Int64>(
+                              d_parameters.d_rate) *
+                              d_parameters.d_duration,
+                          d_parameters.d_rate,
+                          d_parameters.d_warmup *
+                              bdlt::TimeUnitRatio::k_NS_PER_S);
+
+    // Open loop: the producer posts the messages at their intended send
+    // time, while this thread samples the CPU time at the end of the warmup.
+    d_isRunning = true;
+
+    bslmt::ThreadUtil::Handle producer;
+    int                       rc = bslmt::ThreadUtil::createWithAllocator(
+        &producer,
+        bdlf::BindUtil::bind(&BenchmarkRun::producerThread, this),
+        d_allocator_p);
+    if (rc != 0) {
+        BALL_LOG_ERROR << "Failed to create producer thread [rc: " << rc
+                       << "]";
+        return rc;  // RETURN
+    }
+
+    bsls::Types::Int64 currentTime = d_schedule.now();
+    while (currentTime < d_schedule.d_warmupEndTime) {
+        mqbtst::BenchmarkUtil::waitFor(d_schedule.d_warmupEndTime -
+                                       currentTime);
+        currentTime = d_schedule.now();
+    }
+    const bsls::Types::Int64 cpuTimeAtWarmup  = processCpuTime();
+    const bsls::Types::Int64 receivedAtWarmup = d_stats.numReceived();
+
+    bslmt::ThreadUtil::join(producer);
+
+    // Wait for the messages in flight.
+    const bsls::Types::Int64 drainEndTime =
+        d_schedule.now() + k_DRAIN_TIMEOUT_S * bdlt::TimeUnitRatio::k_NS_PER_S;
+    while (d_stats.numReceived() < d_stats.numPosted() &&
+           d_schedule.now() < drainEndTime) {
+        bslmt::ThreadUtil::microSleep(10 * bdlt::TimeUnitRatio::k_US_PER_MS);
+    }
+    const bsls::Types::Int64 cpuTime     = processCpuTime();
+    const bsls::Types::Int64 drainedTime = d_schedule.now();
+
+    d_stats.loadResult(&result->d_result);
+
+    const bsls::Types::Int64 receivedAfterWarmup =
+        result->d_result.d_numReceived - receivedAtWarmup;
+    const double measuredDuration =
+        static_cast<double>(drainedTime - d_schedule.d_warmupEndTime) /
+        bdlt::TimeUnitRatio::k_NS_PER_S;
+
+    result->d_achievedRate         = measuredDuration > 0
+                                         ? receivedAfterWarmup /
+                                               measuredDuration
+                                         : 0.0;
+    result->d_processCpuPerMessage = receivedAfterWarmup == 0
+                                         ? 0
+                                         : (cpuTime - cpuTimeAtWarmup) /
+                                               receivedAfterWarmup;
+
+    return 0;
+}
+
+}  // close unnamed namespace
+
+// --------------------------
+// struct BenchmarkParameters
+// --------------------------
+
+BenchmarkParameters::BenchmarkParameters(bslma::Allocator* allocator)
+: d_brokerUri(allocator)
+, d_domains(allocator)
+, d_numQueues(1)
+, d_rate(10000)
+, d_msgSize(1024)
+, d_duration(30)
+, d_warmup(5)
+, d_reportPath(allocator)
+{
+    // NOTHING
+}
+
+BenchmarkParameters::BenchmarkParameters(const BenchmarkParameters& other,
+                                         bslma::Allocator*          allocator)
+: d_brokerUri(other.d_brokerUri, allocator)
+, d_domains(other.d_domains, allocator)
+, d_numQueues(other.d_numQueues)
+, d_rate(other.d_rate)
+, d_msgSize(other.d_msgSize)
+, d_duration(other.d_duration)
+, d_warmup(other.d_warmup)
+, d_reportPath(other.d_reportPath, allocator)
+{
+    // NOTHING
+}
+
+// ---------------
+// class Benchmark
+// ---------------
+
+// PRIVATE MANIPULATORS
+int Benchmark::runDomain(Result* result, const bsl::string& domain)
+{
+    BALL_LOG_INFO << "Benchmarking domain '" << domain << "': "
+                  << d_parameters.d_numQueues << " queue(s), "
+                  << mwcu::PrintUtil::prettyNumber(d_parameters.d_rate)
+                  << " msgs/s of " << d_parameters.d_msgSize << " bytes, for "
+                  << d_parameters.d_duration << "s";
+
+    result->d_domain = domain;
+
+    BenchmarkRun benchmarkRun(d_parameters, d_allocator_p);
+    int          rc = benchmarkRun.initialize(domain);
+    if (rc != 0) {
+        return rc;  // RETURN
+    }
+
+    return benchmarkRun.run(result);
+}
+
+// CREATORS
+Benchmark::Benchmark(const BenchmarkParameters& parameters,
+                     bslma::Allocator*          allocator)
+: d_allocator_p(bslma::Default::allocator(allocator))
+, d_parameters(parameters, d_allocator_p)
+, d_results(d_allocator_p)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(d_parameters.d_numQueues > 0);
+    BSLS_ASSERT_OPT(d_parameters.d_rate > 0);
+    BSLS_ASSERT_OPT(d_parameters.d_duration > 0);
+}
+
+// MANIPULATORS
+int Benchmark::run()
+{
+    int rc = 0;
+    for (bsl::vector<bsl::string>::const_iterator it =
+             d_parameters.d_domains.begin();
+         it != d_parameters.d_domains.end();
+         ++it) {
+        Result result;
+        if (runDomain(&result, *it) != 0) {
+            BALL_LOG_ERROR << "Failed to benchmark domain '" << *it << "'";
+            rc = -1;
+            continue;  // CONTINUE
+        }
+        d_results.push_back(result);
+    }
+
+    return rc;
+}
+
+// ACCESSORS
+void Benchmark::report(bsl::ostream& stream) const
+{
+    stream << "====================\n"
+           << "Benchmark Report\n"
+           << "====================\n"
+           << "Replication: none (single in-process broker)\n";
+    for (bsl::vector<Result>::const_iterator it = d_results.begin();
+         it != d_results.end();
+         ++it) {
+        stream << it->d_domain << "\n";
+        mqbtst::BenchmarkUtil::printFieldName(stream, "Rate (msgs/s)", 2)
+            << mwcu::PrintUtil::prettyNumber(it->d_achievedRate) << "\n";
+        mqbtst::BenchmarkUtil::printFieldName(stream, "Process CPU/msg", 2)
+            << mwcu::PrintUtil::prettyTimeInterval(
+                   it->d_processCpuPerMessage)
+            << "\n";
+        mqbtst::BenchmarkUtil::printResult(stream, it->d_result, 2);
+    }
+    stream << bsl::flush;
+
+    if (d_parameters.d_reportPath.empty()) {
+        return;  // RETURN
+    }
+
+    bsl::ofstream output(d_parameters.d_reportPath.c_str());
+    if (!output) {
+        BALL_LOG_ERROR << "Unable to write benchmark report, failed to open '"
+                       << d_parameters.d_reportPath << "'";
+        return;  // RETURN
+    }
+
+    output << "{\n"
+           << "  \"config\": {\n"
+           << "    \"queues\": " << d_parameters.d_numQueues << ",\n"
+           << "    \"rate\": " << d_parameters.d_rate << ",\n"
+           << "    \"msgSize\": " << d_parameters.d_msgSize << ",\n"
+           << "    \"duration\": " << d_parameters.d_duration << ",\n"
+           << "    \"warmup\": " << d_parameters.d_warmup << ",\n"
+           << "    \"replication\": \"none\"\n"
+           << "  },\n"
+           << "  \"domains\": [";
+    for (bsl::vector<Result>::const_iterator it = d_results.begin();
+         it != d_results.end();
+         ++it) {
+        output << (it == d_results.begin() ? "\n" : ",\n") << "    {\n"
+               << "      \"domain\": \"" << it->d_domain << "\",\n"
+               << "      \"achievedRate\": " << it->d_achievedRate << ",\n"
+               << "      \"processCpuPerMessage\": "
+               << it->d_processCpuPerMessage << ",\n";
+        mqbtst::BenchmarkUtil::printJsonResult(output, it->d_result, 6);
+        output << "\n"
+               << "    }";
+    }
+    output << "\n"
+           << "  ]\n"
+           << "}\n";
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,209 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// m_bmqbrkr_benchmark.h                                              -*-C++-*-
+#ifndef INCLUDED_M_BMQBRKR_BENCHMARK
+#define INCLUDED_M_BMQBRKR_BENCHMARK
+
+//@PURPOSE: Provide an end-to-end benchmark of an in-process broker.
+//
+//@CLASSES:
+//  m_bmqbrkr::BenchmarkParameters: parameters of the benchmark
+//  m_bmqbrkr::Benchmark:           end-to-end benchmark of the broker
+//
+//@DESCRIPTION: 'm_bmqbrkr::Benchmark' measures the performance of the broker
+// running in the same process, on one box, and without any other process: it
+// connects to the broker over loopback with a 'bmqa::Session', and, for each
+// of the configured domains in turn, opens a number of queues for both
+// reading and writing, posts messages to them at a fixed target rate, and
+// consumes and confirms them back.  Messages therefore go through the whole
+// PUT, storage, PUSH and CONFIRM path of the broker.
+//
+// Since the in-process broker is the only node, messages are not replicated:
+// running the benchmark against the 'strong' and 'eventual' consistency
+// domains of the default configuration (e.g., the
+// 'bmq.test.persistent.priority.sc' and 'bmq.test.persistent.priority'
+// domains) compares the code paths of both consistencies on a single node,
+// but not the cost of replicating to, and waiting for, other nodes, which
+// requires a multi-node cluster.  The report therefore states that there was
+// no replication.
+//
+// For each domain, the following is reported:
+//: o *achieved rate*: number of messages received per second,
+//: o *process CPU per message*: user and system CPU time of the whole
+//:   process, i.e. of both the broker and its client, divided by the number
+//:   of messages received,
+//: o *latency*: percentiles of the time between the intended send time and
+//:   the reception of the messages.
+//
+// The process CPU per message is meaningful to compare two builds of the
+// broker with the same benchmark, the client's share being the same for
+// both, but is not the CPU cost of the broker alone.
+//
+// Latencies are measured from the intended send time of the messages, so
+// that producer stalls are accounted for (see 'mqbtst_benchmarkutil'), and
+// only after the first 'warmup' seconds of each run.
+
+// MQB
+#include <mqbtst_benchmarkutil.h>
+
+// BDE
+#include <ball_log.h>
+#include <bsl_iosfwd.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace m_bmqbrkr {
+
+// ==========================
+// struct BenchmarkParameters
+// ==========================
+
+/// Struct holding the parameters of a `Benchmark`.
+struct BenchmarkParameters {
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(BenchmarkParameters,
+                                   bslma::UsesBslmaAllocator)
+
+    // PUBLIC DATA
+    bsl::string d_brokerUri;
+    // URI of the in-process broker
+
+    bsl::vector<bsl::string> d_domains;
+    // Domains to benchmark, in turn
+
+    int d_numQueues;
+    // Number of queues per domain
+
+    int d_rate;
+    // Target rate, in messages per second,
+    // over all the queues of a domain
+
+    int d_msgSize;
+    // Size of the payload of the messages,
+    // in bytes
+
+    int d_duration;
+    // Duration, in seconds, of the run of each
+    // domain, including the warmup
+
+    int d_warmup;
+    // Duration, in seconds, at the beginning
+    // of each run, during which latencies are
+    // not recorded
+
+    bsl::string d_reportPath;
+    // Path of the JSON report, if not empty
+
+    // CREATORS
+
+    /// Create a `BenchmarkParameters` with default values, using the
+    /// optionally specified `allocator` to supply memory.
+    explicit BenchmarkParameters(bslma::Allocator* allocator = 0);
+
+    /// Create a `BenchmarkParameters` having the same value as the
+    /// specified `other`, using the optionally specified `allocator` to
+    /// supply memory.
+    BenchmarkParameters(const BenchmarkParameters& other,
+                        bslma::Allocator*          allocator = 0);
+};
+
+// ===============
+// class Benchmark
+// ===============
+
+/// End-to-end benchmark of the broker running in the same process.
+class Benchmark {
+  public:
+    // PUBLIC TYPES
+
+    /// Results of the run of one domain.
+    struct Result {
+        // PUBLIC DATA
+        bsl::string d_domain;
+        // Domain of the run
+
+        mqbtst::BenchmarkResult d_result;
+        // Counters and latencies of the run
+
+        double d_achievedRate;
+        // Messages received per second, after
+        // the warmup
+
+        bsls::Types::Int64 d_processCpuPerMessage;
+        // CPU time of the whole process, broker
+        // and client, in nanoseconds, per
+        // message received
+    };
+
+  private:
+    // CLASS-SCOPE CATEGORY
+    BALL_LOG_SET_CLASS_CATEGORY("BMQBRKR.BENCHMARK");
+
+    // DATA
+    bslma::Allocator* d_allocator_p;
+    // Allocator to use
+
+    BenchmarkParameters d_parameters;
+    // Parameters of the benchmark
+
+    bsl::vector<Result> d_results;
+    // Results of the runs completed so far
+
+  private:
+    // NOT IMPLEMENTED
+    Benchmark(const Benchmark&) BSLS_KEYWORD_DELETED;
+    Benchmark& operator=(const Benchmark&) BSLS_KEYWORD_DELETED;
+
+    // PRIVATE MANIPULATORS
+
+    /// Benchmark the specified `domain` and load the results into the
+    /// specified `result`.  Return 0 on success, or a non-zero value
+    /// otherwise.
+    int runDomain(Result* result, const bsl::string& domain);
+
+  public:
+    // CREATORS
+
+    /// Create a `Benchmark` configured with the specified `parameters`,
+    /// using the specified `allocator` to supply memory.
+    Benchmark(const BenchmarkParameters& parameters,
+              bslma::Allocator*          allocator);
+
+    // MANIPULATORS
+
+    /// Benchmark each of the domains of the parameters in turn, against the
+    /// broker running in this process.  Return 0 on success, or a non-zero
+    /// value if any of the domains could not be benchmarked.  The behavior
+    /// is undefined unless the broker was started.
+    int run();
+
+    // ACCESSORS
+
+    /// Print the report of the benchmark to the specified `stream`, and
+    /// write it as JSON to the report path of the parameters, if any.
+    void report(bsl::ostream& stream) const;
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -160,7 +160,7 @@ static bool parseArgs(Parameters* parameters, int argc, const char* argv[])
     balcl::OptionInfo specTable[] = {
         {"mode",
          "mode",
-         "mode ([<cli>, auto, storage, syschk])",
+         "mode ([<cli>, auto, storage, syschk, bench])",
          balcl::TypeInfo(&params.mode(), &ParametersMode::isValid),
          balcl::OccurrenceInfo::e_OPTIONAL},
         {"b|broker",
@@ -255,6 +255,22 @@ static bool parseArgs(Parameters* parameters, int argc, const char* argv[])
          " no message received in auto consumer mode) before shutting down",
          balcl::TypeInfo(&params.shutdownGrace()),
          balcl::OccurrenceInfo::e_OPTIONAL},
+        {"producers",
+         "producers",
+         "number of producer threads (bench mode)",
+         balcl::TypeInfo(&params.producers()),
+         balcl::OccurrenceInfo(params.producers())},
+        {"queues",
+         "queues",
+         "number of queues to post to and consume from (bench mode)",
+         balcl::TypeInfo(&params.queues()),
+         balcl::OccurrenceInfo(params.queues())},
+        {"warmup",
+         "warmup",
+         "seconds at the beginning of the run during which latencies are not"
+         " recorded (bench mode)",
+         balcl::TypeInfo(&params.warmup()),
+         balcl::OccurrenceInfo(params.warmup())},
         {"nosessioneventhandler",
          "noSessionEventHandler",
          "use custom event handler threads",
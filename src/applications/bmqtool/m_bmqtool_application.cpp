@@ -564,6 +564,7 @@ int Application::initialize()
         e_INIT_STORAGE_ERROR          = -2,
         e_OPEN_QUEUE_ERROR            = -3,
         e_VALIDATE_SUBSCRIPTION_ERROR = -4,
+        e_INIT_BENCHMARK_ERROR        = -5,
         e_START_SESSION_ERROR         = -10
     };
 
@@ -617,6 +618,15 @@ int Application::initialize()
             return e_INIT_STORAGE_ERROR;  // RETURN
         }
     }
+    else if (d_parameters_p->mode() == ParametersMode::e_BENCH) {
+        // The benchmark uses its own session, whose processing threads are
+        // the consumers.
+        rc = d_benchmark.initialize();
+        if (rc != 0) {
+            BALL_LOG_ERROR << "Failed to initialize benchmark [" << rc << "]";
+            return e_INIT_BENCHMARK_ERROR;  // RETURN
+        }
+    }
     else if (d_parameters_p->mode() == ParametersMode::e_AUTO) {
         rc = d_session_mp->start();
         if (rc != 0) {
@@ -1127,6 +1137,7 @@ Application::Application(Parameters*       parameters,
 , d_msgUntilNextTimestamp(0)
 , d_interactive(parameters, d_allocator_p)
 , d_storageInspector(d_allocator_p)
+, d_benchmark(parameters, d_allocator_p)
 , d_fileLogger(d_parameters_p->logFilePath(), d_allocator_p)
 , d_latencies(allocator)
 , d_autoReadInProgress(false)
@@ -1193,6 +1204,10 @@ int Application::run()
         rc = d_storageInspector.mainLoop();
         d_shutdownSemaphore_p->post();
     }
+    else if (d_parameters_p->mode() == ParametersMode::e_BENCH) {
+        // Post the shutdown semaphore once the benchmark is over
+        rc = d_benchmark.start(d_shutdownSemaphore_p);
+    }
     else {
         // Start the thread
         if (bmqt::QueueFlagsUtil::isWriter(d_parameters_p->queueFlags())) {
@@ -1221,6 +1236,11 @@ void Application::stop()
         d_runningThread = bslmt::ThreadUtil::invalidHandle();
     }
 
+    if (d_parameters_p->mode() == ParametersMode::e_BENCH) {
+        d_benchmark.stop();
+        d_benchmark.report(bsl::cout);
+    }
+
     // Disconnect from the broker
     if (d_parameters_p->mode() == ParametersMode::e_AUTO) {
         if (d_parameters_p->shutdownGrace() != 0) {
@@ -1243,6 +1263,7 @@ void Application::stop()
     // Display final stats
     if (d_parameters_p->mode() != ParametersMode::e_CLI &&
         d_parameters_p->mode() != ParametersMode::e_STORAGE &&
+        d_parameters_p->mode() != ParametersMode::e_BENCH &&
         d_parameters_p->verbosity() != ParametersVerbosity::e_SILENT) {
         printFinalStats();
     }
@@ -26,6 +26,7 @@
 // application.
 
 // BMQTOOL
+#include <m_bmqtool_benchmark.h>
 #include <m_bmqtool_filelogger.h>
 #include <m_bmqtool_interactive.h>
 #include <m_bmqtool_messages.h>
@@ -148,6 +149,9 @@ class Application : public bmqa::SessionEventHandler {
 
     StorageInspector d_storageInspector;
 
+    Benchmark d_benchmark;
+    // Benchmark (bench mode only)
+
     FileLogger d_fileLogger;
     // Logger to use in case events logging
     // to file has been enabled.
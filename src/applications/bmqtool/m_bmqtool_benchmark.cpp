@@ -0,0 +1,361 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// m_bmqtool_benchmark.cpp                                            -*-C++-*-
+#include <m_bmqtool_benchmark.h>
+
+// BMQTOOL
+#include <m_bmqtool_parameters.h>
+
+// BMQ
+#include <bmqa_sessionevent.h>
+#include <bmqt_queueflags.h>
+#include <bmqt_queueoptions.h>
+#include <bmqt_resultcode.h>
+#include <bmqt_sessionoptions.h>
+
+// MWC
+#include <mwcu_printutil.h>
+#include <mwcu_stringutil.h>
+
+// BDE
+#include <bdlbb_blobutil.h>
+#include <bdlf_bind.h>
+#include <bdlf_memfn.h>
+#include <bdlt_timeunitratio.h>
+#include <bsl_algorithm.h>
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bslma_default.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadutil.h>
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace m_bmqtool {
+
+namespace {
+
+/// Delay, in nanoseconds, between the start of the benchmark and the intended
+/// send time of the first message, to let all producers start.
+const bsls::Types::Int64 k_START_DELAY_NS = 100 *
+                                            bdlt::TimeUnitRatio::k_NS_PER_MS;
+
+/// Interval, in milliseconds, at which the timer thread checks whether the
+/// benchmark is over.
+const int k_TIMER_INTERVAL_MS = 10;
+
+}  // close unnamed namespace
+
+// ---------------
+// class Benchmark
+// ---------------
+
+// PRIVATE MANIPULATORS
+void Benchmark::onSessionEvent(const bmqa::SessionEvent& event)
+{
+    if (d_parameters_p->verbosity() != ParametersVerbosity::e_SILENT) {
+        BALL_LOG_INFO << "==> EVENT received: " << event;
+    }
+}
+
+void Benchmark::onMessageEvent(const bmqa::MessageEvent& event)
+{
+    mqbtst::BenchmarkUtil::confirmMessages(d_session_mp.get(),
+                                           &d_stats,
+                                           d_schedule,
+                                           event,
+                                           d_allocator_p);
+}
+
+void Benchmark::producerThread(int index)
+{
+    mqbtst::BenchmarkUtil::postMessages(d_session_mp.get(),
+                                        &d_stats,
+                                        d_schedule,
+                                        d_queueIds,
+                                        d_payload,
+                                        index,
+                                        d_parameters_p->numProducers(),
+                                        d_parameters_p->eventSize(),
+                                        d_isRunning,
+                                        d_allocator_p);
+}
+
+void Benchmark::timerThread()
+{
+    // Once the schedule is over, wait for all the posted messages to be
+    // received, or for at most 'shutdownGrace' seconds (at least 1).
+    const bsls::Types::Int64 drainTime =
+        d_schedule.d_endTime + bsl::max(d_parameters_p->shutdownGrace(), 1) *
+                                   bdlt::TimeUnitRatio::k_NS_PER_S;
+
+    bool isWarm = d_schedule.d_warmupEndTime == d_schedule.d_startTime;
+    while (d_isRunning) {
+        const bsls::Types::Int64 currentTime = d_schedule.now();
+        if (!isWarm && currentTime >= d_schedule.d_warmupEndTime) {
+            isWarm = true;
+            BALL_LOG_INFO << "Warmup done, recording latencies.";
+        }
+        if (currentTime >= drainTime ||
+            (currentTime >= d_schedule.d_endTime &&
+             d_stats.numReceived() >= d_stats.numPosted())) {
+            break;  // BREAK
+        }
+        bslmt::ThreadUtil::microSleep(k_TIMER_INTERVAL_MS *
+                                      bdlt::TimeUnitRatio::k_US_PER_MS);
+    }
+
+    BALL_LOG_INFO << "Benchmark done.";
+    d_doneSemaphore_p->post();
+}
+
+// PRIVATE ACCESSORS
+void Benchmark::writeReport(bsl::ostream&                  stream,
+                            const mqbtst::BenchmarkResult& result,
+                            bool                           isCsv) const
+{
+    const double duration     = d_schedule.measuredDuration();
+    const double targetRate   = d_schedule.rate();
+    const double achievedRate = duration > 0 ? result.d_numMeasured / duration
+                                             : 0.0;
+
+    if (isCsv) {
+        stream << "queues,producers,threads,msgSize,eventSize,targetRate,"
+               << "warmup,duration,posted,postFailures,received,measured,"
+               << "achievedRate,mean";
+        for (int i = 0; i < mqbtst::BenchmarkUtil::k_NUM_PERCENTILES; ++i) {
+            stream << "," << mqbtst::BenchmarkUtil::k_PERCENTILE_NAMES[i];
+        }
+        stream << "\n"
+               << d_queueIds.size() << "," << d_parameters_p->numProducers()
+               << "," << d_parameters_p->numProcessingThreads() << ","
+               << d_parameters_p->msgSize() << ","
+               << d_parameters_p->eventSize() << "," << targetRate << ","
+               << d_parameters_p->warmup() << "," << duration << ","
+               << result.d_numPosted << "," << result.d_numPostFailures << ","
+               << result.d_numReceived << "," << result.d_numMeasured << ","
+               << achievedRate << "," << result.d_meanLatency;
+        for (int i = 0; i < mqbtst::BenchmarkUtil::k_NUM_PERCENTILES; ++i) {
+            stream << "," << result.d_latencyPercentiles[i];
+        }
+        stream << "\n";
+        return;  // RETURN
+    }
+
+    stream << "{\n"
+           << "  \"config\": {\n"
+           << "    \"queues\": " << d_queueIds.size() << ",\n"
+           << "    \"producers\": " << d_parameters_p->numProducers() << ",\n"
+           << "    \"threads\": " << d_parameters_p->numProcessingThreads()
+           << ",\n"
+           << "    \"msgSize\": " << d_parameters_p->msgSize() << ",\n"
+           << "    \"eventSize\": " << d_parameters_p->eventSize() << ",\n"
+           << "    \"targetRate\": " << targetRate << ",\n"
+           << "    \"warmup\": " << d_parameters_p->warmup() << ",\n"
+           << "    \"duration\": " << duration << "\n"
+           << "  },\n"
+           << "  \"achievedRate\": " << achievedRate << ",\n";
+    mqbtst::BenchmarkUtil::printJsonResult(stream, result, 2);
+    stream << "\n"
+           << "}\n";
+}
+
+// CREATORS
+Benchmark::Benchmark(const Parameters* parameters,
+                     bslma::Allocator* allocator)
+: d_allocator_p(bslma::Default::allocator(allocator))
+, d_parameters_p(parameters)
+, d_doneSemaphore_p(0)
+, d_session_mp()
+, d_queueIds(d_allocator_p)
+, d_bufferFactory(4096, d_allocator_p)
+, d_payload(&d_bufferFactory, d_allocator_p)
+, d_threads(d_allocator_p)
+, d_isRunning(false)
+, d_schedule()
+, d_stats(d_allocator_p)
+{
+    d_schedule.d_useEpochClock = d_parameters_p->latency() ==
+                                 ParametersLatency::e_EPOCH;
+}
+
+Benchmark::~Benchmark()
+{
+    BSLS_ASSERT_SAFE(!d_isRunning);
+}
+
+// MANIPULATORS
+int Benchmark::initialize()
+{
+    enum RC {
+        e_OK                  = 0,
+        e_OPEN_QUEUE_ERROR    = -1,
+        e_START_SESSION_ERROR = -10
+    };
+
+    // The processing threads of the session are the consumers.
+    bmqt::SessionOptions options;
+    options.setBrokerUri(d_parameters_p->broker())
+        .setNumProcessingThreads(d_parameters_p->numProcessingThreads())
+        .configureEventQueue(1000, 10 * 1000);
+
+    bslma::ManagedPtr<bmqa::SessionEventHandler> managedHandler(
+        this,
+        d_allocator_p,
+        bslma::ManagedPtrNilDeleter<bmqa::SessionEventHandler>::deleter);
+    d_session_mp.load(
+        new (*d_allocator_p)
+            bmqa::Session(managedHandler, options, d_allocator_p),
+        d_allocator_p);
+
+    int rc = d_session_mp->start();
+    if (rc != 0) {
+        BALL_LOG_ERROR << "Unable to start session [rc: " << rc << " - "
+                       << bmqt::GenericResult::Enum(rc) << "]";
+        return e_START_SESSION_ERROR + rc;  // RETURN
+    }
+
+    bmqt::QueueOptions queueOptions;
+    queueOptions
+        .setMaxUnconfirmedMessages(d_parameters_p->maxUnconfirmedMsgs())
+        .setMaxUnconfirmedBytes(d_parameters_p->maxUnconfirmedBytes());
+
+    bsls::Types::Uint64 flags = 0;
+    bmqt::QueueFlagsUtil::setReader(&flags);
+    bmqt::QueueFlagsUtil::setWriter(&flags);
+
+    const int numQueues = d_parameters_p->numQueues();
+    d_queueIds.reserve(numQueues);
+    for (int i = 0; i < numQueues; ++i) {
+        bsl::string uri(d_parameters_p->queueUri(), d_allocator_p);
+        if (numQueues > 1) {
+            uri.append("-").append(bsl::to_string(i));
+        }
+
+        d_queueIds.push_back(bmqa::QueueId(i + 1, d_allocator_p));
+        bmqa::OpenQueueStatus result = d_session_mp->openQueueSync(
+            &d_queueIds.back(),
+            uri,
+            flags,
+            queueOptions);
+        if (!result) {
+            BALL_LOG_ERROR << "Error while opening queue: [result: " << result
+                           << "]";
+            return e_OPEN_QUEUE_ERROR;  // RETURN
+        }
+    }
+
+    // Initialize a payload of the right size, with alphabet's letters
+    for (int i = 0; i < d_parameters_p->msgSize(); ++i) {
+        char c = static_cast<char>('A' + i % 26);
+        bdlbb::BlobUtil::append(&d_payload, &c, 1);
+    }
+
+    return e_OK;
+}
+
+int Benchmark::start(bslmt::Semaphore* doneSemaphore)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(doneSemaphore);
+    BSLS_ASSERT_SAFE(d_session_mp);
+
+    d_doneSemaphore_p = doneSemaphore;
+
+    // 'eventSize * postRate' messages every 'postInterval' ms, during
+    // 'eventsCount' events.
+    const double messagesPerMs = static_cast<double>(
+                                     d_parameters_p->eventSize()) *
+                                 d_parameters_p->postRate() /
+                                 d_parameters_p->postInterval();
+    d_schedule.initialize(static_cast<bsls::Types::Int64>(
+                              d_parameters_p->eventsCount()) *
+                              d_parameters_p->eventSize(),
+                          messagesPerMs * bdlt::TimeUnitRatio::k_MS_PER_S,
+                          d_parameters_p->warmup() *
+                              bdlt::TimeUnitRatio::k_NS_PER_S,
+                          k_START_DELAY_NS);
+
+    d_isRunning = true;
+
+    BALL_LOG_INFO << "Starting benchmark: " << d_schedule.d_numMessages
+                  << " messages at "
+                  << mwcu::PrintUtil::prettyNumber(
+                         static_cast<int>(d_schedule.rate()))
+                  << " msgs/s over " << d_queueIds.size() << " queue(s)";
+
+    int rc = d_threads.addThread(
+        bdlf::MemFnUtil::memFn(&Benchmark::timerThread, this));
+    for (int i = 0; rc == 0 && i < d_parameters_p->numProducers(); ++i) {
+        rc = d_threads.addThread(
+            bdlf::BindUtil::bind(&Benchmark::producerThread, this, i));
+    }
+
+    if (rc != 0) {
+        BALL_LOG_ERROR << "Failed to create benchmark thread [rc: " << rc
+                       << "]";
+        stop();
+    }
+
+    return rc;
+}
+
+void Benchmark::stop()
+{
+    d_isRunning = false;
+    d_threads.joinAll();
+
+    if (d_session_mp) {
+        d_session_mp->stop();
+    }
+}
+
+void Benchmark::report(bsl::ostream& stream)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!d_isRunning);
+
+    mqbtst::BenchmarkResult result(d_allocator_p);
+    d_stats.loadResult(&result);
+
+    const bsl::string& path = d_parameters_p->latencyReportPath();
+
+    stream << "====================\n"
+           << "Benchmark Report";
+    if (!path.empty()) {
+        stream << " (generated at: " << path << ")";
+    }
+    stream << "\n"
+           << "====================\n";
+    mqbtst::BenchmarkUtil::printResult(stream, result, 2);
+    stream << bsl::endl;
+
+    if (path.empty()) {
+        return;  // RETURN
+    }
+
+    bsl::ofstream output(path.c_str());
+    if (!output) {
+        stream << "Unable to generate benchmark report, failed to open '"
+               << path << "'" << bsl::endl;
+        return;  // RETURN
+    }
+    writeReport(output, result, mwcu::StringUtil::endsWith(path, ".csv"));
+}
+
+}  // close package namespace
+}  // close enterprise namespace
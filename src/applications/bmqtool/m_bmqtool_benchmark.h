@@ -0,0 +1,196 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// m_bmqtool_benchmark.h                                              -*-C++-*-
+#ifndef INCLUDED_M_BMQTOOL_BENCHMARK
+#define INCLUDED_M_BMQTOOL_BENCHMARK
+
+//@PURPOSE: Provide an open-loop throughput and latency benchmark.
+//
+//@CLASSES:
+//  m_bmqtool::Benchmark: open-loop benchmark of a BlazingMQ broker.
+//
+//@DESCRIPTION: 'm_bmqtool::Benchmark' drives the 'bench' mode of 'bmqtool':
+// it opens one or more queues for both reading and writing, posts messages to
+// them from a configurable number of producer threads at a fixed target rate,
+// consumes them back on the processing threads of its session, and reports
+// the achieved throughput and the distribution of the end-to-end latencies.
+//
+/// Open loop
+///---------
+// Each message is assigned an intended send time from a fixed schedule (the
+// target rate being 'eventSize * postRate' messages every 'postInterval'
+// milliseconds), and producers post the overdue messages in batches of at
+// most 'eventSize' messages when they fall behind it, so that latencies are
+// measured from the intended send time (see 'mqbtst_benchmarkutil').
+//
+// Since the same process produces and consumes, intended times are read from
+// the high resolution timer, unless 'epoch' latency is requested.
+//
+/// Report
+///------
+// Latencies of the messages whose intended send time falls after the first
+// 'warmup' seconds of the schedule are reported.  The report is printed to
+// the standard output, and written to the latency report path, if any, as
+// CSV if the path ends with '.csv', and as JSON otherwise.
+
+// MQB
+#include <mqbtst_benchmarkutil.h>
+
+// BMQ
+#include <bmqa_queueid.h>
+#include <bmqa_session.h>
+
+// BDE
+#include <ball_log.h>
+#include <bdlbb_blob.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bsl_iosfwd.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_managedptr.h>
+#include <bslmt_threadgroup.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+
+namespace BloombergLP {
+
+// FORWARD DECLARATIONS
+namespace bslmt {
+class Semaphore;
+}
+
+namespace m_bmqtool {
+
+// FORWARD DECLARATIONS
+class Parameters;
+
+// ===============
+// class Benchmark
+// ===============
+
+/// Open-loop throughput and latency benchmark of a BlazingMQ broker.
+class Benchmark : public bmqa::SessionEventHandler {
+  private:
+    // CLASS-SCOPE CATEGORY
+    BALL_LOG_SET_CLASS_CATEGORY("BMQTOOL.BENCHMARK");
+
+    // DATA
+    bslma::Allocator* d_allocator_p;
+    // Held, not owned
+
+    const Parameters* d_parameters_p;
+    // Command-line parameters.  Held, not
+    // owned
+
+    bslmt::Semaphore* d_doneSemaphore_p;
+    // Semaphore to post once the schedule is
+    // over.  Held, not owned
+
+    bslma::ManagedPtr<bmqa::Session> d_session_mp;
+    // Session with the BlazingMQ broker
+
+    bsl::vector<bmqa::QueueId> d_queueIds;
+    // Queues to post to and consume from
+
+    bdlbb::PooledBlobBufferFactory d_bufferFactory;
+    // Buffer factory for the payload
+
+    bdlbb::Blob d_payload;
+    // Payload of all the posted messages
+
+    bslmt::ThreadGroup d_threads;
+    // Producer and timer threads
+
+    bsls::AtomicBool d_isRunning;
+    // False to interrupt the producer and
+    // timer threads
+
+    mqbtst::BenchmarkSchedule d_schedule;
+    // Intended send times of the messages
+
+    mqbtst::BenchmarkStats d_stats;
+    // Counters and latencies of the benchmark
+
+  private:
+    // NOT IMPLEMENTED
+    Benchmark(const Benchmark&) BSLS_KEYWORD_DELETED;
+    Benchmark& operator=(const Benchmark&) BSLS_KEYWORD_DELETED;
+
+    // PRIVATE MANIPULATORS
+    //   (virtual: bmqa::SessionEventHandler)
+
+    /// Process the specified session `event`.
+    void onSessionEvent(const bmqa::SessionEvent& event) BSLS_KEYWORD_OVERRIDE;
+
+    /// Record the latency of, and confirm, the messages of the specified
+    /// message `event`.
+    void onMessageEvent(const bmqa::MessageEvent& event) BSLS_KEYWORD_OVERRIDE;
+
+    // PRIVATE MANIPULATORS
+
+    /// Post the messages of the schedule whose index modulo the number of
+    /// producers is the specified `index`, at their intended send time.
+    void producerThread(int index);
+
+    /// Wait for the end of the schedule and for the messages in flight to
+    /// be received, and post the done semaphore.
+    void timerThread();
+
+    // PRIVATE ACCESSORS
+
+    /// Write the specified `result` of the benchmark, as CSV if the
+    /// specified `isCsv` is true, and as JSON otherwise, to the specified
+    /// `stream`.
+    void writeReport(bsl::ostream&                  stream,
+                     const mqbtst::BenchmarkResult& result,
+                     bool                           isCsv) const;
+
+  public:
+    // CREATORS
+
+    /// Create a `Benchmark` configured by the specified `parameters`, using
+    /// the specified `allocator` to supply memory.
+    Benchmark(const Parameters* parameters, bslma::Allocator* allocator);
+
+    /// Destroy this object.
+    ~Benchmark() BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+
+    /// Start a session and open the queues of the benchmark.  Return 0 on
+    /// success, or a non-zero value otherwise.
+    int initialize();
+
+    /// Start posting messages according to the schedule, and post the
+    /// specified `doneSemaphore` once the schedule is over and the messages
+    /// in flight were received.  Return 0 on success, or a non-zero value
+    /// otherwise.
+    int start(bslmt::Semaphore* doneSemaphore);
+
+    /// Stop posting messages, and stop the session.
+    void stop();
+
+    /// Print the report of the benchmark to the specified `stream`, and
+    /// write it to the latency report path, if any.  The behavior is
+    /// undefined unless `stop` was called.
+    void report(bsl::ostream& stream);
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
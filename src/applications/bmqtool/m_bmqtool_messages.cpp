@@ -2596,7 +2596,22 @@ const bdlat_AttributeInfo ConfigureQueueCommand::ATTRIBUTE_INFO_ARRAY[] = {
      "subscriptions",
      sizeof("subscriptions") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_PRODUCERS,
+     "producers",
+     sizeof("producers") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_QUEUES,
+     "queues",
+     sizeof("queues") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_WARMUP,
+     "warmup",
+     sizeof("warmup") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC}};
 
 // CLASS METHODS
 
@@ -2630,6 +2645,12 @@ const bdlat_AttributeInfo* ConfigureQueueCommand::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONSUMER_PRIORITY];
     case ATTRIBUTE_ID_SUBSCRIPTIONS:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SUBSCRIPTIONS];
+    case ATTRIBUTE_ID_PRODUCERS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRODUCERS];
+    case ATTRIBUTE_ID_QUEUES:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_QUEUES];
+    case ATTRIBUTE_ID_WARMUP:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WARMUP];
     default: return 0;
     }
 }
@@ -2730,6 +2751,9 @@ void ConfigureQueueCommand::reset()
     d_maxUnconfirmedBytes    = DEFAULT_INITIALIZER_MAX_UNCONFIRMED_BYTES;
     d_consumerPriority       = DEFAULT_INITIALIZER_CONSUMER_PRIORITY;
     bdlat_ValueTypeFunctions::reset(&d_subscriptions);
+    d_producers = DEFAULT_INITIALIZER_PRODUCERS;
+    d_queues    = DEFAULT_INITIALIZER_QUEUES;
+    d_warmup    = DEFAULT_INITIALIZER_WARMUP;
 }
 
 // ACCESSORS
@@ -2747,6 +2771,9 @@ bsl::ostream& ConfigureQueueCommand::print(bsl::ostream& stream,
     printer.printAttribute("maxUnconfirmedBytes", this->maxUnconfirmedBytes());
     printer.printAttribute("consumerPriority", this->consumerPriority());
     printer.printAttribute("subscriptions", this->subscriptions());
+    printer.printAttribute("producers", this->producers());
+    printer.printAttribute("queues", this->queues());
+    printer.printAttribute("warmup", this->warmup());
     printer.end();
     return stream;
 }
@@ -4211,6 +4238,12 @@ const char
     CommandLineParameters::DEFAULT_INITIALIZER_SEQUENTIAL_MESSAGE_PATTERN[] =
         "";
 
+const int CommandLineParameters::DEFAULT_INITIALIZER_PRODUCERS = 1;
+
+const int CommandLineParameters::DEFAULT_INITIALIZER_QUEUES = 1;
+
+const int CommandLineParameters::DEFAULT_INITIALIZER_WARMUP = 0;
+
 const bdlat_AttributeInfo CommandLineParameters::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_MODE,
      "mode",
@@ -4343,7 +4376,7 @@ const bdlat_AttributeInfo CommandLineParameters::ATTRIBUTE_INFO_ARRAY[] = {
 const bdlat_AttributeInfo*
 CommandLineParameters::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 25; ++i) {
+    for (int i = 0; i < 28; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             CommandLineParameters::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -4437,6 +4470,9 @@ CommandLineParameters::CommandLineParameters(bslma::Allocator* basicAllocator)
 , d_postInterval(DEFAULT_INITIALIZER_POST_INTERVAL)
 , d_threads(DEFAULT_INITIALIZER_THREADS)
 , d_shutdownGrace(DEFAULT_INITIALIZER_SHUTDOWN_GRACE)
+, d_producers(DEFAULT_INITIALIZER_PRODUCERS)
+, d_queues(DEFAULT_INITIALIZER_QUEUES)
+, d_warmup(DEFAULT_INITIALIZER_WARMUP)
 , d_dumpMsg(DEFAULT_INITIALIZER_DUMP_MSG)
 , d_confirmMsg(DEFAULT_INITIALIZER_CONFIRM_MSG)
 , d_memoryDebug(DEFAULT_INITIALIZER_MEMORY_DEBUG)
@@ -4469,6 +4505,9 @@ CommandLineParameters::CommandLineParameters(
 , d_postInterval(original.d_postInterval)
 , d_threads(original.d_threads)
 , d_shutdownGrace(original.d_shutdownGrace)
+, d_producers(original.d_producers)
+, d_queues(original.d_queues)
+, d_warmup(original.d_warmup)
 , d_dumpMsg(original.d_dumpMsg)
 , d_confirmMsg(original.d_confirmMsg)
 , d_memoryDebug(original.d_memoryDebug)
@@ -4501,6 +4540,9 @@ CommandLineParameters::CommandLineParameters(
   d_postInterval(bsl::move(original.d_postInterval)),
   d_threads(bsl::move(original.d_threads)),
   d_shutdownGrace(bsl::move(original.d_shutdownGrace)),
+  d_producers(bsl::move(original.d_producers)),
+  d_queues(bsl::move(original.d_queues)),
+  d_warmup(bsl::move(original.d_warmup)),
   d_dumpMsg(bsl::move(original.d_dumpMsg)),
   d_confirmMsg(bsl::move(original.d_confirmMsg)),
   d_memoryDebug(bsl::move(original.d_memoryDebug)),
@@ -4532,6 +4574,9 @@ CommandLineParameters::CommandLineParameters(CommandLineParameters&& original,
 , d_postInterval(bsl::move(original.d_postInterval))
 , d_threads(bsl::move(original.d_threads))
 , d_shutdownGrace(bsl::move(original.d_shutdownGrace))
+, d_producers(bsl::move(original.d_producers))
+, d_queues(bsl::move(original.d_queues))
+, d_warmup(bsl::move(original.d_warmup))
 , d_dumpMsg(bsl::move(original.d_dumpMsg))
 , d_confirmMsg(bsl::move(original.d_confirmMsg))
 , d_memoryDebug(bsl::move(original.d_memoryDebug))
@@ -4575,6 +4620,9 @@ CommandLineParameters::operator=(const CommandLineParameters& rhs)
         d_sequentialMessagePattern = rhs.d_sequentialMessagePattern;
         d_messageProperties        = rhs.d_messageProperties;
         d_subscriptions            = rhs.d_subscriptions;
+        d_producers                = rhs.d_producers;
+        d_queues                   = rhs.d_queues;
+        d_warmup                   = rhs.d_warmup;
     }
 
     return *this;
@@ -4611,6 +4659,9 @@ CommandLineParameters::operator=(CommandLineParameters&& rhs)
         d_sequentialMessagePattern = bsl::move(rhs.d_sequentialMessagePattern);
         d_messageProperties        = bsl::move(rhs.d_messageProperties);
         d_subscriptions            = bsl::move(rhs.d_subscriptions);
+        d_producers                = bsl::move(rhs.d_producers);
+        d_queues                   = bsl::move(rhs.d_queues);
+        d_warmup                   = bsl::move(rhs.d_warmup);
     }
 
     return *this;
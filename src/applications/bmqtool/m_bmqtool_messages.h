@@ -4721,6 +4721,9 @@ class CommandLineParameters {
     int                          d_postInterval;
     int                          d_threads;
     int                          d_shutdownGrace;
+    int                          d_producers;
+    int                          d_queues;
+    int                          d_warmup;
     bool                         d_dumpMsg;
     bool                         d_confirmMsg;
     bool                         d_memoryDebug;
@@ -4753,10 +4756,13 @@ class CommandLineParameters {
         ATTRIBUTE_ID_LOG                        = 21,
         ATTRIBUTE_ID_SEQUENTIAL_MESSAGE_PATTERN = 22,
         ATTRIBUTE_ID_MESSAGE_PROPERTIES         = 23,
-        ATTRIBUTE_ID_SUBSCRIPTIONS              = 24
+        ATTRIBUTE_ID_SUBSCRIPTIONS              = 24,
+        ATTRIBUTE_ID_PRODUCERS                  = 25,
+        ATTRIBUTE_ID_QUEUES                     = 26,
+        ATTRIBUTE_ID_WARMUP                     = 27
     };
 
-    enum { NUM_ATTRIBUTES = 25 };
+    enum { NUM_ATTRIBUTES = 28 };
 
     enum {
         ATTRIBUTE_INDEX_MODE                       = 0,
@@ -4783,7 +4789,10 @@ class CommandLineParameters {
         ATTRIBUTE_INDEX_LOG                        = 21,
         ATTRIBUTE_INDEX_SEQUENTIAL_MESSAGE_PATTERN = 22,
         ATTRIBUTE_INDEX_MESSAGE_PROPERTIES         = 23,
-        ATTRIBUTE_INDEX_SUBSCRIPTIONS              = 24
+        ATTRIBUTE_INDEX_SUBSCRIPTIONS              = 24,
+        ATTRIBUTE_INDEX_PRODUCERS                  = 25,
+        ATTRIBUTE_INDEX_QUEUES                     = 26,
+        ATTRIBUTE_INDEX_WARMUP                     = 27
     };
 
     // CONSTANTS
@@ -4835,6 +4844,12 @@ class CommandLineParameters {
 
     static const char DEFAULT_INITIALIZER_SEQUENTIAL_MESSAGE_PATTERN[];
 
+    static const int DEFAULT_INITIALIZER_PRODUCERS;
+
+    static const int DEFAULT_INITIALIZER_QUEUES;
+
+    static const int DEFAULT_INITIALIZER_WARMUP;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -5030,6 +5045,18 @@ class CommandLineParameters {
     /// this object.
     bsl::vector<Subscription>& subscriptions();
 
+    /// Return a reference to the modifiable "Producers" attribute of this
+    /// object.
+    int& producers();
+
+    /// Return a reference to the modifiable "Queues" attribute of this
+    /// object.
+    int& queues();
+
+    /// Return a reference to the modifiable "Warmup" attribute of this
+    /// object.
+    int& warmup();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -5173,6 +5200,18 @@ class CommandLineParameters {
     /// Return a reference to the non-modifiable "Subscriptions" attribute
     /// of this object.
     const bsl::vector<Subscription>& subscriptions() const;
+
+    /// Return a reference to the non-modifiable "Producers" attribute of
+    /// this object.
+    int producers() const;
+
+    /// Return a reference to the non-modifiable "Queues" attribute of this
+    /// object.
+    int queues() const;
+
+    /// Return a reference to the non-modifiable "Warmup" attribute of this
+    /// object.
+    int warmup() const;
 };
 
 // FREE OPERATORS
@@ -8292,6 +8331,18 @@ int ConfigureQueueCommand::manipulateAttribute(MANIPULATOR& manipulator,
             &d_subscriptions,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SUBSCRIPTIONS]);
     }
+    case ATTRIBUTE_ID_PRODUCERS: {
+        return manipulator(&d_producers,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRODUCERS]);
+    }
+    case ATTRIBUTE_ID_QUEUES: {
+        return manipulator(&d_queues,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_QUEUES]);
+    }
+    case ATTRIBUTE_ID_WARMUP: {
+        return manipulator(&d_warmup,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WARMUP]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -8418,6 +8469,18 @@ int ConfigureQueueCommand::accessAttribute(ACCESSOR& accessor, int id) const
         return accessor(d_subscriptions,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SUBSCRIPTIONS]);
     }
+    case ATTRIBUTE_ID_PRODUCERS: {
+        return accessor(d_producers,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRODUCERS]);
+    }
+    case ATTRIBUTE_ID_QUEUES: {
+        return accessor(d_queues,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_QUEUES]);
+    }
+    case ATTRIBUTE_ID_WARMUP: {
+        return accessor(d_warmup,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WARMUP]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -8482,6 +8545,9 @@ void hashAppend(HASH_ALGORITHM&                         hashAlg,
     hashAppend(hashAlg, object.maxUnconfirmedBytes());
     hashAppend(hashAlg, object.consumerPriority());
     hashAppend(hashAlg, object.subscriptions());
+    hashAppend(hashAlg, object.producers());
+    hashAppend(hashAlg, object.queues());
+    hashAppend(hashAlg, object.warmup());
 }
 
 // -----------------
@@ -9640,6 +9706,22 @@ int CommandLineParameters::manipulateAttributes(MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_producers,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRODUCERS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_queues, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_QUEUES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_warmup, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WARMUP]);
+    if (ret) {
+        return ret;
+    }
+
     return ret;
 }
 
@@ -9902,6 +9984,21 @@ inline bsl::vector<Subscription>& CommandLineParameters::subscriptions()
     return d_subscriptions;
 }
 
+inline int& CommandLineParameters::producers()
+{
+    return d_producers;
+}
+
+inline int& CommandLineParameters::queues()
+{
+    return d_queues;
+}
+
+inline int& CommandLineParameters::warmup()
+{
+    return d_warmup;
+}
+
 // ACCESSORS
 template <class ACCESSOR>
 int CommandLineParameters::accessAttributes(ACCESSOR& accessor) const
@@ -10052,6 +10149,22 @@ int CommandLineParameters::accessAttributes(ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_producers,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRODUCERS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_queues, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_QUEUES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_warmup, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WARMUP]);
+    if (ret) {
+        return ret;
+    }
+
     return ret;
 }
 
@@ -10310,6 +10423,21 @@ CommandLineParameters::subscriptions() const
     return d_subscriptions;
 }
 
+inline int CommandLineParameters::producers() const
+{
+    return d_producers;
+}
+
+inline int CommandLineParameters::queues() const
+{
+    return d_queues;
+}
+
+inline int CommandLineParameters::warmup() const
+{
+    return d_warmup;
+}
+
 template <typename HASH_ALGORITHM>
 void hashAppend(HASH_ALGORITHM&                         hashAlg,
                 const m_bmqtool::CommandLineParameters& object)
@@ -11657,7 +11785,9 @@ inline bool m_bmqtool::operator==(const m_bmqtool::CommandLineParameters& lhs,
            lhs.storage() == rhs.storage() && lhs.log() == rhs.log() &&
            lhs.sequentialMessagePattern() == rhs.sequentialMessagePattern() &&
            lhs.messageProperties() == rhs.messageProperties() &&
-           lhs.subscriptions() == rhs.subscriptions();
+           lhs.subscriptions() == rhs.subscriptions() &&
+           lhs.producers() == rhs.producers() &&
+           lhs.queues() == rhs.queues() && lhs.warmup() == rhs.warmup();
 }
 
 inline bool m_bmqtool::operator!=(const m_bmqtool::CommandLineParameters& lhs,
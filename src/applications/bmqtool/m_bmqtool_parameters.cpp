@@ -140,7 +140,8 @@ const char* ParametersMode::toAscii(ParametersMode::Value value)
         CASE(CLI)
         CASE(AUTO)
         CASE(STORAGE)
-        CASE(SYSCHK);
+        CASE(SYSCHK)
+        CASE(BENCH);
     default: return "(* UNKNOWN *)";
     }
 
@@ -161,6 +162,7 @@ bool ParametersMode::fromAscii(ParametersMode::Value*   out,
     CHECKVALUE(AUTO);
     CHECKVALUE(STORAGE);
     CHECKVALUE(SYSCHK);
+    CHECKVALUE(BENCH);
 
     // Invalid string
     return false;
@@ -175,7 +177,8 @@ bool ParametersMode::isValid(const bsl::string* str, bsl::ostream& stream)
         return true;  // RETURN
     }
 
-    stream << "Error: mode parameter must be one of [cli, auto, syschk]\n";
+    stream << "Error: mode parameter must be one of "
+           << "[cli, auto, storage, syschk, bench]\n";
     return false;
 }
 
@@ -301,6 +304,9 @@ Parameters::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     printer.printAttribute("memoryDebug", memoryDebug());
     printer.printAttribute("numProcessingThreads", numProcessingThreads());
     printer.printAttribute("shutdownGrace", shutdownGrace());
+    printer.printAttribute("numProducers", numProducers());
+    printer.printAttribute("numQueues", numQueues());
+    printer.printAttribute("warmup", warmup());
     printer.printAttribute("noSessionEventHandler", noSessionEventHandler());
     printer.printAttribute("sequentialMessagePattern",
                            d_sequentialMessagePattern);
@@ -401,6 +407,9 @@ bool Parameters::from(bsl::ostream&                stream,
     setLogFilePath(params.log());
     setSequentialMessagePattern(params.sequentialMessagePattern());
     setShutdownGrace(params.shutdownGrace());
+    setNumProducers(params.producers());
+    setNumQueues(params.queues());
+    setWarmup(params.warmup());
     setMessageProperties(params.messageProperties());
     setSubscriptions(params.subscriptions());
 
@@ -418,9 +427,10 @@ bool Parameters::validate(bsl::string* error)
 
     if (d_queueFlags == 0 && d_mode != ParametersMode::e_CLI &&
         d_mode != ParametersMode::e_STORAGE &&
-        d_mode != ParametersMode::e_SYSCHK) {
-        ss << "QueueFlags must be specified if not in interactive, storage or "
-           << "syschk mode\n";
+        d_mode != ParametersMode::e_SYSCHK &&
+        d_mode != ParametersMode::e_BENCH) {
+        ss << "QueueFlags must be specified if not in interactive, storage, "
+           << "syschk or bench mode\n";
     }
     if (d_queueUri.empty() && d_mode != ParametersMode::e_CLI &&
         d_mode != ParametersMode::e_STORAGE &&
@@ -433,6 +443,21 @@ bool Parameters::validate(bsl::string* error)
         ss << "NoSessionEventHandler is only to use in interactive or storage "
            << "mode\n";
     }
+    if (d_mode == ParametersMode::e_BENCH) {
+        if (d_numProducers <= 0 || d_numQueues <= 0) {
+            ss << "Producers and queues must be positive in bench mode\n";
+        }
+        if (d_eventSize <= 0 || d_postRate <= 0 || d_postInterval <= 0) {
+            ss << "EventSize, postRate and postInterval must be positive in "
+               << "bench mode\n";
+        }
+        if (d_eventsCount <= 0) {
+            ss << "EventsCount must be specified in bench mode\n";
+        }
+        if (d_warmup < 0) {
+            ss << "Warmup must not be negative\n";
+        }
+    }
 
     error->assign(ss.str().data(), ss.str().length());
     return error->empty();
@@ -99,6 +99,8 @@ struct ParametersMode {
         e_STORAGE  // Inspect storage
         ,
         e_SYSCHK  // Run in syschk mode
+        ,
+        e_BENCH  // Run an open-loop benchmark
     };
 
     // CLASS METHODS
@@ -256,6 +258,19 @@ class Parameters {
     // How many seconds to wait before shutting
     // down.
 
+    int d_numProducers;
+    // Number of producer threads (bench mode).
+    // Default: 1
+
+    int d_numQueues;
+    // Number of queues to post to and consume
+    // from (bench mode).  Default: 1
+
+    int d_warmup;
+    // Number of seconds, at the beginning of
+    // the run, during which latencies are not
+    // recorded (bench mode).  Default: 0
+
     bool d_noSessionEventHandler;
     // False to use the EventHandler callback,
     // true to use custom event handler threads.
@@ -299,6 +314,9 @@ class Parameters {
     Parameters& setLogFilePath(const bsl::string& value);
     Parameters& setSequentialMessagePattern(const bsl::string& value);
     Parameters& setShutdownGrace(int value);
+    Parameters& setNumProducers(int value);
+    Parameters& setNumQueues(int value);
+    Parameters& setWarmup(int value);
     Parameters&
     setMessageProperties(const bsl::vector<MessageProperty>& value);
     Parameters& setSubscriptions(const bsl::vector<Subscription>& value);
@@ -356,6 +374,9 @@ class Parameters {
     bool                                memoryDebug() const;
     int                                 numProcessingThreads() const;
     int                                 shutdownGrace() const;
+    int                                 numProducers() const;
+    int                                 numQueues() const;
+    int                                 warmup() const;
     bool                                noSessionEventHandler() const;
     const bsl::vector<MessageProperty>& messageProperties() const;
 
@@ -495,6 +516,24 @@ inline Parameters& Parameters::setShutdownGrace(int value)
     return *this;
 }
 
+inline Parameters& Parameters::setNumProducers(int value)
+{
+    d_numProducers = value;
+    return *this;
+}
+
+inline Parameters& Parameters::setNumQueues(int value)
+{
+    d_numQueues = value;
+    return *this;
+}
+
+inline Parameters& Parameters::setWarmup(int value)
+{
+    d_warmup = value;
+    return *this;
+}
+
 inline Parameters& Parameters::setNoSessionEventHandler(bool value)
 {
     d_noSessionEventHandler = value;
@@ -689,6 +728,21 @@ inline int Parameters::shutdownGrace() const
     return d_shutdownGrace;
 }
 
+inline int Parameters::numProducers() const
+{
+    return d_numProducers;
+}
+
+inline int Parameters::numQueues() const
+{
+    return d_numQueues;
+}
+
+inline int Parameters::warmup() const
+{
+    return d_warmup;
+}
+
 inline bool Parameters::noSessionEventHandler() const
 {
     return d_noSessionEventHandler;
@@ -101,6 +101,20 @@ Message& Message::setDataRef(const char* data, size_t length)
     return *this;
 }
 
+Message& Message::setDataRef(const bdlbb::BlobBuffer& buffer)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 < buffer.size());
+    BSLS_ASSERT_SAFE(isInitialized() &&
+                     "message is invalid: use "
+                     "'MessageEventBuilder::startMessage' to get one");
+    BSLS_ASSERT_SAFE(d_impl.d_event_p->putEventBuilder() &&
+                     "message not editable");
+
+    d_impl.d_event_p->putEventBuilder()->setMessagePayload(buffer);
+    return *this;
+}
+
 Message& Message::setPropertiesRef(const MessageProperties* properties)
 {
     // PRECONDITIONS
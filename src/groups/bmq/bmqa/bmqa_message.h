@@ -243,6 +243,17 @@ class Message {
     /// documentation for correct usage).
     Message& setDataRef(const char* data, size_t length);
 
+    /// Set the payload of this message to the data held by the specified
+    /// `buffer`.  The behavior is undefined unless `buffer` has a size
+    /// greater than zero.  Note that the payload is *not* copied, neither
+    /// right away nor when this message is packed: the message, and then
+    /// the event it is packed into, share ownership of the memory of
+    /// `buffer`, which therefore must not be modified after this call.
+    /// This is the preferred way to post large payloads from memory owned
+    /// by the application (see `bmqa::MessageEventBuilder` component level
+    /// documentation for more details).
+    Message& setDataRef(const bdlbb::BlobBuffer& buffer);
+
     /// Set the properties of this message to the `MessageProperties`
     /// instance pointed by the specified `properties`.  Behavior is
     /// undefined unless `properties` is non-null.  Note that properties are
@@ -358,7 +369,10 @@ class Message {
     /// otherwise.  The behaviour is undefined unless this instance
     /// represents a `PUT` or `PUSH` message.  Note that for efficiency,
     /// application should fetch payload once and cache the value, instead
-    /// of invoking this method multiple times on a message.
+    /// of invoking this method multiple times on a message.  Also note that
+    /// unless the message was compressed, the payload is *not* copied: the
+    /// buffers appended to `blob` alias the ones the message was received
+    /// in, and must be treated as read-only.
     int getData(bdlbb::Blob* blob) const;
 
     /// Return the number of bytes in the payload.  The behaviour is
@@ -20,6 +20,7 @@
 // BMQ
 #include <bmqa_queueid.h>
 #include <bmqimp_event.h>
+#include <bmqimp_postbatch.h>
 #include <bmqimp_queue.h>
 #include <bmqp_messageguidgenerator.h>
 #include <bmqp_protocol.h>
@@ -27,7 +28,10 @@
 #include <bmqt_queueflags.h>
 
 // BDE
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
 #include <bsl_memory.h>
+#include <bslma_default.h>
 #include <bslma_managedptr.h>
 #include <bslmf_assert.h>
 #include <bsls_assert.h>
@@ -41,6 +45,20 @@ namespace {
 BSLMF_ASSERT(sizeof(Message) == sizeof(MessageImpl));
 BSLMF_ASSERT(sizeof(MessageEvent) == sizeof(bsl::shared_ptr<bmqimp::Event>));
 BSLMF_ASSERT(sizeof(QueueId) == sizeof(bsl::shared_ptr<bmqimp::Queue>));
+BSLMF_ASSERT(sizeof(PostBatchStatus) ==
+             sizeof(bsl::shared_ptr<bmqimp::PostBatch>));
+
+/// Invoke the specified `callback` with the status of the specified
+/// `batch`.
+void postBatchCallbackAdapter(
+    const MessageEventBuilder::PostBatchCallback& callback,
+    const bsl::shared_ptr<bmqimp::PostBatch>&     batch)
+{
+    PostBatchStatus status;
+    reinterpret_cast<bsl::shared_ptr<bmqimp::PostBatch>&>(status) = batch;
+
+    callback(status);
+}
 
 }  // close unnamed namespace
 
@@ -80,6 +98,34 @@ Message& MessageEventBuilder::startMessage()
     return d_impl.d_msg;
 }
 
+void MessageEventBuilder::setPostBatchCallback(
+    const PostBatchCallback& callback,
+    bslma::Allocator*        basicAllocator)
+{
+    // Get bmqimp::Event from bmqa::MessageEvent
+    typedef bsl::shared_ptr<bmqimp::Event> EventSP;
+    EventSP& eventSpRef = reinterpret_cast<EventSP&>(d_impl.d_msgEvent);
+
+    BSLS_ASSERT_OPT(eventSpRef &&
+                    "This builder is invalid, it must be obtained by a call "
+                    "to bmqa::Session.loadMessageEventBuilder() !");
+    BSLS_ASSERT_OPT(eventSpRef->putEventBuilder()->messageCount() == 0 &&
+                    "reset() must be called on this builder.");
+
+    bslma::Allocator* allocator = bslma::Default::allocator(basicAllocator);
+
+    bsl::shared_ptr<bmqimp::PostBatch> batch =
+        bsl::allocate_shared<bmqimp::PostBatch>(
+            allocator,
+            bdlf::BindUtil::bindS(allocator,
+                                  &postBatchCallbackAdapter,
+                                  callback,
+                                  bdlf::PlaceHolders::_1),  // batch
+            allocator);
+
+    eventSpRef->setPostBatch(batch);
+}
+
 bmqt::EventBuilderResult::Enum
 MessageEventBuilder::packMessage(const bmqa::QueueId& queueId)
 {
@@ -127,7 +173,12 @@ MessageEventBuilder::packMessage(const bmqa::QueueId& queueId)
         return bmqt::EventBuilderResult::e_PAYLOAD_EMPTY;  // RETURN
     }
 
-    if (corrId.isUnset()) {
+    if (msgImplRef.d_event_p->postBatch()) {
+        // The message is acknowledged through the batch, identified by its
+        // sequence number.
+        builder->setFlags(bmqp::PutHeaderFlags::e_ACK_REQUESTED);
+    }
+    else if (corrId.isUnset()) {
         if (bmqt::QueueFlagsUtil::isAck(queueSpRef->flags())) {
             // A queue opened with ackFlag requires a CorrelationId for every
             // message posted.
@@ -229,5 +280,19 @@ int MessageEventBuilder::messageEventSize() const
     return eventSpRef->putEventBuilder()->eventSize();
 }
 
+bsls::Types::Int64 MessageEventBuilder::lastSequenceNumber() const
+{
+    // Get bmqimp::Event from bmqa::MessageEvent
+    typedef bsl::shared_ptr<bmqimp::Event> EventSP;
+    const EventSP& eventSpRef = reinterpret_cast<const EventSP&>(
+        d_impl.d_msgEvent);
+
+    // PRECONDITIONS
+    BSLS_ASSERT(eventSpRef->postBatch() &&
+                "setPostBatchCallback must be called before");
+
+    return eventSpRef->postBatch()->lastSequenceNumber();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -64,6 +64,35 @@
 //:   be set explicitly for each individual message).  If desired, any
 //:   attribute can be tweaked before being packing the message again.  Refer
 //:   to usage example #2 for an illustration.
+//:
+//: o A payload set with 'bmqa::Message::setDataRef(const char*, size_t)' is
+//:   copied into the event when the message is packed.  A payload set from a
+//:   'bdlbb::Blob' or a 'bdlbb::BlobBuffer' is *not* copied: the event shares
+//:   the buffers holding the payload (unless the payload gets compressed), so
+//:   their content must not be modified after packing the message.  For large
+//:   payloads, posting from application owned 'bdlbb::BlobBuffer's avoids
+//:   copying the data entirely:
+//..
+//   bdlbb::BlobBuffer buffer;
+//   myBufferFactory.allocate(&buffer);  // or any refcounted memory
+//   encodeInto(buffer.data(), buffer.size());
+//
+//   bmqa::Message& msg = builder.startMessage();
+//   msg.setCorrelationId(myCorrelationId);
+//   msg.setDataRef(buffer);
+//   rc = builder.packMessage(myQueueId);
+//..
+//
+//: o For applications posting large volumes of messages, the acknowledgments
+//:   of all the messages of an event can be reported at once, through a
+//:   callback set with 'setPostBatchCallback' before packing the first
+//:   message.  No correlationId is needed (nor used) for the messages of such
+//:   a batch, which are not reported in the ACK events delivered to the
+//:   application: each of them is instead assigned, when packed, the next PUT
+//:   sequence number of its queue (see 'lastSequenceNumber'), and the
+//:   callback is invoked with a 'bmqa::PostBatchStatus' reporting the results
+//:   as spans of sequence numbers once all the messages have been
+//:   acknowledged.  Refer to usage example #3 for an illustration.
 //
 /// Example 1 - Basic Usage
 ///-----------------------
@@ -233,6 +262,39 @@
 //   builder.reset();
 //..
 //
+/// Example 3 - Acknowledging a batch of messages at once
+///-----------------------------------------------------
+//..
+//   // Note that error handling is omitted below for the sake of brevity
+//
+//   void onBatchCompleted(const bmqa::PostBatchStatus& status)
+//   {
+//       // Invoked from the event handler thread once all the messages of
+//       // the batch have been acknowledged.
+//       if (status.numFailed() != 0) {
+//           // Walk the spans of sequence numbers to find the failed ones.
+//       }
+//   }
+//
+//   bmqa::MessageEventBuilder builder;
+//   session.loadMessageEventBuilder(&builder);
+//
+//   builder.setPostBatchCallback(&onBatchCompleted);
+//
+//   bmqa::Message& msg = builder.startMessage();
+//   for (int i = 0; i < numMessages; ++i) {
+//       msg.setDataRef(payloads[i].data(), payloads[i].size());
+//       int rc = builder.packMessage(myQueueId);
+//
+//       // Remember which message was assigned which sequence number, if
+//       // needed to handle the failures.
+//       bsls::Types::Int64 sequenceNumber = builder.lastSequenceNumber();
+//   }
+//
+//   rc = session.post(builder.messageEvent());
+//   builder.reset();
+//..
+//
 /// Thread Safety
 ///-------------
 // This component is *NOT* thread safe.
@@ -241,10 +303,14 @@
 
 #include <bmqa_message.h>
 #include <bmqa_messageevent.h>
+#include <bmqa_postbatchstatus.h>
 #include <bmqt_resultcode.h>
 
 // BDE
+#include <bsl_functional.h>
 #include <bsl_memory.h>
+#include <bslma_allocator.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 
@@ -284,6 +350,14 @@ struct MessageEventBuilderImpl {
 
 /// A builder for `MessageEvent` objects.
 class MessageEventBuilder {
+  public:
+    // TYPES
+
+    /// Signature of the callback invoked once all the messages of a batch
+    /// have been acknowledged.
+    typedef bsl::function<void(const PostBatchStatus& status)>
+        PostBatchCallback;
+
   private:
     // DATA
     MessageEventBuilderImpl d_impl;  // Impl
@@ -305,6 +379,20 @@ class MessageEventBuilder {
     /// since then.
     Message& startMessage();
 
+    /// Report the acknowledgments of all the messages of the event under
+    /// construction through the specified `callback`, invoked from the
+    /// event handler thread once all of them have been acknowledged, instead
+    /// of through ACK events.  Optionally specify a `basicAllocator` used
+    /// to supply memory.  If `basicAllocator` is 0, the currently installed
+    /// default allocator is used.  The messages subsequently packed are
+    /// requested to be acknowledged, and are not required to have a
+    /// `correlationId` even if their queue was opened with the ACK flag.
+    /// The behavior is undefined unless no message has been packed since
+    /// this builder was last reset.  Note that the setting is cleared by
+    /// `reset`.
+    void setPostBatchCallback(const PostBatchCallback& callback,
+                              bslma::Allocator*        basicAllocator = 0);
+
     /// Add the current message into the message event under construction,
     /// setting the destination queue of the current message to match the
     /// specified `queueId`.  Return zero on success, non-zero value
@@ -345,6 +433,13 @@ class MessageEventBuilder {
     /// value represents the length of entire message event, *including*
     /// BlazingMQ wire protocol overhead.
     int messageEventSize() const;
+
+    /// Return the PUT sequence number assigned, by its queue, to the message
+    /// added by the last successful call to `packMessage()`.  The behavior
+    /// is undefined unless `setPostBatchCallback` has been called since
+    /// this builder was last reset, and at least one message has been
+    /// packed since then.
+    bsls::Types::Int64 lastSequenceNumber() const;
 };
 
 }  // close package namespace
@@ -0,0 +1,107 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqa_postbatchstatus.cpp                                           -*-C++-*-
+#include <bmqa_postbatchstatus.h>
+
+#include <bmqscm_version.h>
+// BMQ
+#include <bmqa_queueid.h>
+#include <bmqimp_postbatch.h>
+#include <bmqimp_queue.h>
+
+// BDE
+#include <bslmf_assert.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace bmqa {
+
+namespace {
+// Do some compile time validation
+BSLMF_ASSERT(sizeof(QueueId) == sizeof(bsl::shared_ptr<bmqimp::Queue>));
+}  // close unnamed namespace
+
+// ---------------------
+// class PostBatchStatus
+// ---------------------
+
+PostBatchStatus::PostBatchStatus()
+: d_impl_sp()
+{
+    // NOTHING
+}
+
+int PostBatchStatus::numMessages() const
+{
+    return d_impl_sp ? d_impl_sp->numMessages() : 0;
+}
+
+int PostBatchStatus::numFailed() const
+{
+    return d_impl_sp ? d_impl_sp->numFailed() : 0;
+}
+
+int PostBatchStatus::numSpans() const
+{
+    return d_impl_sp ? static_cast<int>(d_impl_sp->spans().size()) : 0;
+}
+
+const QueueId& PostBatchStatus::spanQueueId(int index) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(0 <= index && index < numSpans());
+
+    return reinterpret_cast<const QueueId&>(
+        d_impl_sp->spans()[index].d_queue);
+}
+
+bsls::Types::Int64 PostBatchStatus::spanFirstSequenceNumber(int index) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(0 <= index && index < numSpans());
+
+    return d_impl_sp->spans()[index].d_firstSequenceNumber;
+}
+
+bsls::Types::Int64 PostBatchStatus::spanLastSequenceNumber(int index) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(0 <= index && index < numSpans());
+
+    return d_impl_sp->spans()[index].d_lastSequenceNumber;
+}
+
+bmqt::AckResult::Enum PostBatchStatus::spanResult(int index) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(0 <= index && index < numSpans());
+
+    return d_impl_sp->spans()[index].d_result;
+}
+
+bsl::ostream& PostBatchStatus::print(bsl::ostream& stream,
+                                     int           level,
+                                     int           spacesPerLevel) const
+{
+    if (!d_impl_sp) {
+        return stream;  // RETURN
+    }
+
+    return d_impl_sp->print(stream, level, spacesPerLevel);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,171 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqa_postbatchstatus.h                                             -*-C++-*-
+#ifndef INCLUDED_BMQA_POSTBATCHSTATUS
+#define INCLUDED_BMQA_POSTBATCHSTATUS
+
+//@PURPOSE: Provide the acknowledgment status of a batch of posted messages.
+//
+//@CLASSES:
+//  bmqa::PostBatchStatus: acknowledgment status of a batch of messages
+//
+//@SEE_ALSO:
+//  bmqa::MessageEventBuilder: builder of the batches of messages
+//
+//@DESCRIPTION: This component provides a 'bmqa::PostBatchStatus' object,
+// passed to the completion callback of a batch of messages posted with
+// 'bmqa::MessageEventBuilder::setPostBatchCallback', once all the messages
+// of the batch have been acknowledged.
+//
+// Every message of a batch is assigned a PUT sequence number by its queue at
+// the time it is packed (see 'bmqa::MessageEventBuilder::lastSequenceNumber'),
+// the sequence numbers of a queue being monotonically increasing.  The status
+// reports the acknowledgment results of the messages as spans of consecutive
+// sequence numbers of the same queue having the same result, so that a batch
+// of messages all successfully acknowledged is typically reported as one span
+// per queue.
+//
+// Note that 'PostBatchStatus' is implemented using the pimpl idiom, so
+// copying a 'PostBatchStatus' is very cheap (a pointer copy).  All copies of
+// this 'PostBatchStatus' will share the same underlying implementation.
+//
+/// Usage
+///-----
+//..
+//  void onBatchCompleted(const bmqa::PostBatchStatus& status)
+//  {
+//      if (status.numFailed() == 0) {
+//          return;                                                   // RETURN
+//      }
+//
+//      for (int i = 0; i < status.numSpans(); ++i) {
+//          if (status.spanResult(i) != bmqt::AckResult::e_SUCCESS) {
+//              // Messages 'spanFirstSequenceNumber(i)' to
+//              // 'spanLastSequenceNumber(i)' of queue 'spanQueueId(i)' were
+//              // not successfully posted.
+//          }
+//      }
+//  }
+//..
+
+// BMQ
+
+#include <bmqt_resultcode.h>
+
+// BDE
+#include <bsl_iosfwd.h>
+#include <bsl_memory.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+
+// FORWARD DECLARATION
+namespace bmqimp {
+class PostBatch;
+}
+
+namespace bmqa {
+
+// FORWARD DECLARATION
+class QueueId;
+
+// =====================
+// class PostBatchStatus
+// =====================
+
+/// Acknowledgment status of a batch of posted messages.
+class PostBatchStatus {
+  private:
+    // DATA
+    bsl::shared_ptr<bmqimp::PostBatch> d_impl_sp;  // pimpl
+
+  public:
+    // CREATORS
+
+    /// Create an unset instance.  Note that `numMessages()` will return 0.
+    PostBatchStatus();
+
+    // ACCESSORS
+
+    /// Return the number of messages of the batch.
+    int numMessages() const;
+
+    /// Return the number of messages of the batch which were acknowledged
+    /// with a result other than `bmqt::AckResult::e_SUCCESS`.
+    int numFailed() const;
+
+    /// Return the number of spans of consecutive sequence numbers of the
+    /// same queue having the same acknowledgment result.
+    int numSpans() const;
+
+    /// Return the queue of the messages of the span at the specified
+    /// `index`.  The behavior is undefined unless
+    /// `0 <= index < numSpans()`.
+    const QueueId& spanQueueId(int index) const;
+
+    /// Return the sequence number of the first message of the span at the
+    /// specified `index`.  The behavior is undefined unless
+    /// `0 <= index < numSpans()`.
+    bsls::Types::Int64 spanFirstSequenceNumber(int index) const;
+
+    /// Return the sequence number of the last message of the span at the
+    /// specified `index`.  The behavior is undefined unless
+    /// `0 <= index < numSpans()`.
+    bsls::Types::Int64 spanLastSequenceNumber(int index) const;
+
+    /// Return the acknowledgment result of the messages of the span at the
+    /// specified `index`.  The behavior is undefined unless
+    /// `0 <= index < numSpans()`.
+    bmqt::AckResult::Enum spanResult(int index) const;
+
+    /// Format this object to the specified output `stream` at the (absolute
+    /// value of) the optionally specified indentation `level` and return a
+    /// reference to `stream`.  If `level` is specified, optionally specify
+    /// `spacesPerLevel`, the number of spaces per indentation level for
+    /// this and all of its nested objects.  If `level` is negative,
+    /// suppress indentation of the first line.  If `spacesPerLevel` is
+    /// negative format the entire output on one line, suppressing all but
+    /// the initial indentation (as governed by `level`).  If `stream` is
+    /// not valid on entry, this operation has no effect.
+    bsl::ostream&
+    print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
+};
+
+// FREE OPERATORS
+
+/// Format the specified `rhs` to the specified output `stream` and return a
+/// reference to the modifiable `stream`.
+bsl::ostream& operator<<(bsl::ostream& stream, const PostBatchStatus& rhs);
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+}  // close package namespace
+
+// ---------------------
+// class PostBatchStatus
+// ---------------------
+
+inline bsl::ostream& bmqa::operator<<(bsl::ostream&                stream,
+                                      const bmqa::PostBatchStatus& rhs)
+{
+    return rhs.print(stream, 0, -1);
+}
+
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,130 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqa_postbatchstatus.t.cpp                                         -*-C++-*-
+#include <bmqa_postbatchstatus.h>
+
+// BMQ
+#include <bmqa_queueid.h>
+#include <bmqimp_postbatch.h>
+#include <bmqimp_queue.h>
+#include <bmqt_correlationid.h>
+
+// BDE
+#include <bsl_memory.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   - A default constructed status reports no messages.
+//   - The status reports the spans of the underlying batch, with the
+//     'bmqa::QueueId' of their queue.
+//
+// Testing:
+//   PostBatchStatus()
+//   numMessages
+//   numFailed
+//   numSpans
+//   spanQueueId
+//   spanFirstSequenceNumber
+//   spanLastSequenceNumber
+//   spanResult
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    PV("Default Constructor");
+    {
+        bmqa::PostBatchStatus obj;
+        ASSERT_EQ(obj.numMessages(), 0);
+        ASSERT_EQ(obj.numFailed(), 0);
+        ASSERT_EQ(obj.numSpans(), 0);
+    }
+
+    PV("Completed batch");
+    {
+        const bmqa::QueueId queueId1(bmqt::CorrelationId(1), s_allocator_p);
+        const bmqa::QueueId queueId2(bmqt::CorrelationId(2), s_allocator_p);
+
+        typedef bsl::shared_ptr<bmqimp::Queue> QueueSp;
+        const QueueSp& queue1 = reinterpret_cast<const QueueSp&>(queueId1);
+        const QueueSp& queue2 = reinterpret_cast<const QueueSp&>(queueId2);
+
+        bsl::shared_ptr<bmqimp::PostBatch> batch =
+            bsl::allocate_shared<bmqimp::PostBatch>(
+                s_allocator_p,
+                bmqimp::PostBatch::CompletionCallback(),
+                s_allocator_p);
+        batch->addMessage(queue1);
+        batch->addMessage(queue1);
+        batch->addMessage(queue2);
+
+        batch->onAck(2, bmqt::AckResult::e_UNKNOWN);
+        batch->onAck(0, bmqt::AckResult::e_SUCCESS);
+        ASSERT(batch->onAck(1, bmqt::AckResult::e_SUCCESS));
+
+        bmqa::PostBatchStatus obj;
+        reinterpret_cast<bsl::shared_ptr<bmqimp::PostBatch>&>(obj) = batch;
+
+        ASSERT_EQ(obj.numMessages(), 3);
+        ASSERT_EQ(obj.numFailed(), 1);
+        ASSERT_EQ(obj.numSpans(), 2);
+
+        ASSERT(obj.spanQueueId(0) == queueId1);
+        ASSERT_EQ(obj.spanFirstSequenceNumber(0), 1);
+        ASSERT_EQ(obj.spanLastSequenceNumber(0), 2);
+        ASSERT_EQ(obj.spanResult(0), bmqt::AckResult::e_SUCCESS);
+
+        ASSERT(obj.spanQueueId(1) == queueId2);
+        ASSERT_EQ(obj.spanFirstSequenceNumber(1), 1);
+        ASSERT_EQ(obj.spanLastSequenceNumber(1), 1);
+        ASSERT_EQ(obj.spanResult(1), bmqt::AckResult::e_UNKNOWN);
+
+        PV(obj);
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
@@ -1507,7 +1507,8 @@ int Session::post(const MessageEvent& event)
 
     return d_impl.d_application_mp->brokerSession().post(
         *(eventSpRef->rawEvent().blob()),
-        bsls::TimeInterval(k_CHANNEL_WRITE_TIMEOUT));
+        bsls::TimeInterval(k_CHANNEL_WRITE_TIMEOUT),
+        eventSpRef->postBatch());
 }
 
 int Session::confirmMessage(const MessageConfirmationCookie& cookie)
@@ -1046,7 +1046,10 @@ class Session : public AbstractSession {
     /// the `bmqt::PostResult::Enum` enum.  Return zero on success and a
     /// non-zero value otherwise.  Note that success implies that SDK has
     /// accepted the `event` and will eventually deliver it to the broker.
-    /// The behavior is undefined unless the session was started.
+    /// If the `event` was built with a post batch callback (see
+    /// `bmqa::MessageEventBuilder::setPostBatchCallback`), the callback is
+    /// invoked once all its messages have been acknowledged.  The behavior
+    /// is undefined unless the session was started.
     int post(const MessageEvent& event) BSLS_KEYWORD_OVERRIDE;
 
     /// Asynchronously confirm the receipt of the specified `message`.  This
@@ -86,6 +86,10 @@ const int k_EVENTQUEUE_INITIAL_CAPACITY = 10 * 1000;
 /// Initial capacity of the FSM event queue
 const int k_FSMQUEUE_INITIAL_CAPACITY = 1000;
 
+/// Number of ACK messages of an ACK event whose GUIDs and correlationIds
+/// are collected without allocating from the session allocator.
+const int k_ACK_BATCH_INLINE_SIZE = 64;
+
 /// RequestManager group id for non buffered requests.
 /// The request is buffered if it is kept after CHANNEL_DOWN event, and is
 /// retransmitted once the channel restores.  The non buffered requests are
@@ -140,6 +144,16 @@ void callbackAdapter(
     f();
 }
 
+/// Invoke the completion callback of the specified `batch`, if any.
+void invokePostBatchCallback(
+    const bsl::shared_ptr<PostBatch>& batch,
+    BSLS_ANNOTATION_UNUSED const bsl::shared_ptr<Event>& eventSp)
+{
+    if (batch->callback()) {
+        batch->callback()(batch);
+    }
+}
+
 void eventCallbackAdapter(bslmt::Semaphore*                   semaphore,
                           const bmqimp::Event::EventCallback& eventCallback,
                           const bsl::shared_ptr<Event>&       eventSp)
@@ -516,6 +530,9 @@ void BrokerSession::SessionFsm::setStopped(FsmEvent::Enum event,
     d_session.d_scheduler_p->cancelEvent(
         &d_session.d_messageExpirationTimeoutHandle);
 
+    // Cancel PUT batch latency budget timer
+    d_session.d_scheduler_p->cancelEvent(&d_session.d_putBatchTimeoutHandle);
+
     // The session is fully stopped, we can now reset its state to release any
     // references to objects (queues, ...) it may still hold.
     d_session.resetState();
@@ -3056,6 +3073,9 @@ void BrokerSession::fsmThreadLoop()
         } break;
         case Event::EventType::e_REQUEST: {
             BSLS_ASSERT_SAFE(event->eventCallback() != 0);
+            // Requests (queue and session operations, channel and timer
+            // notifications) must observe the PUTs posted before them.
+            flushPutBatch();
             event->eventCallback()(event);
         } break;
         case Event::EventType::e_SESSION:
@@ -3325,22 +3345,8 @@ void BrokerSession::enableMessageRetransmission(
     }
 
     // PUT messages without ACK_REQUESTED flag have not been added to the
-    // CorrelationId container by the user.  Add them here.
-    if (!bmqp::PutHeaderFlagUtil::isSet(
-            putIter.header().flags(),
-            bmqp::PutHeaderFlags::e_ACK_REQUESTED)) {
-        bmqp::QueueId       qId(putIter.header().queueId());
-        bmqt::CorrelationId emptyCorrId;
-
-        BSLS_ASSERT_SAFE(0 != d_messageCorrelationIdContainer.find(
-                                  &emptyCorrId,
-                                  putIter.header().messageGUID()));
-
-        d_messageCorrelationIdContainer.add(putIter.header().messageGUID(),
-                                            emptyCorrId,
-                                            qId);
-    }
-
+    // CorrelationId container by the user: 'associateMessageData' adds them
+    // under the same lock acquisition.
     d_messageCorrelationIdContainer.associateMessageData(putIter.header(),
                                                          appData,
                                                          sentTime);
@@ -3352,6 +3358,74 @@ void BrokerSession::processPutEvent(const bmqp::Event& event)
 
     BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
 
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(!d_putBatcher.isEnabled())) {
+        sendPutEvent(event);
+        return;  // RETURN
+    }
+
+    // Count the messages of the event
+    bmqp::PutMessageIterator putIter(d_bufferFactory_p, d_allocator_p);
+    event.loadPutMessageIterator(&putIter);
+    BSLS_ASSERT_SAFE(putIter.isValid());
+
+    int numMessages = 0;
+    while (putIter.next() == 1) {
+        ++numMessages;
+    }
+
+    if (!d_putBatcher.canAppend(event.blob()->length(), numMessages)) {
+        flushPutBatch();
+    }
+
+    const bool               isFirst = d_putBatcher.isEmpty();
+    const bsls::TimeInterval now     = mwcsys::Time::nowMonotonicClock();
+    d_putBatcher.append(*event.blob(), numMessages, now);
+
+    // Send the batch right away if it is full, or if no other event is
+    // waiting in the FSM queue: in the latter case waiting would only add
+    // latency, since nothing is available to be coalesced with the batch.
+    // This makes the batching adapt to the load, while the latency budget
+    // bounds the delay added to the oldest message under sustained load.
+    if (d_putBatcher.isFull() || d_fsmEventQueue.isEmpty() ||
+        now >= d_putBatcher.deadline()) {
+        flushPutBatch();
+        return;  // RETURN
+    }
+
+    if (isFirst) {
+        d_scheduler_p->scheduleEvent(
+            &d_putBatchTimeoutHandle,
+            d_putBatcher.deadline(),
+            bdlf::BindUtil::bind(&BrokerSession::onPutBatchTimeout, this));
+    }
+}
+
+void BrokerSession::flushPutBatch()
+{
+    // executed by the FSM thread
+
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_putBatcher.isEmpty())) {
+        return;  // RETURN
+    }
+
+    d_scheduler_p->cancelEvent(&d_putBatchTimeoutHandle);
+
+    bdlbb::Blob batch(d_allocator_p);
+    d_putBatcher.flush(&batch, mwcsys::Time::nowMonotonicClock());
+
+    bmqp::Event event(&batch, d_allocator_p);
+    BSLS_ASSERT_SAFE(event.isValid() && event.isPutEvent());
+    sendPutEvent(event);
+}
+
+void BrokerSession::sendPutEvent(const bmqp::Event& event)
+{
+    // executed by the FSM thread
+
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+
     bool readyToSend = isStarted() && (d_numPendingReopenQueues == 0);
 
     if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(readyToSend)) {
@@ -3410,6 +3484,9 @@ void BrokerSession::processConfirmEvent(const bmqp::Event& event)
 
     BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
 
+    // Preserve the order of user posted events
+    flushPutBatch();
+
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isStarted())) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
         // Not connected to broker, can't post the event.
@@ -3600,20 +3677,54 @@ void BrokerSession::processAckEvent(const bmqp::Event& event)
         return;  // RETURN
     }
 
-    bsl::shared_ptr<Event> queueEvent = createEvent();
-    queueEvent->configureAsMessageEvent(event);
-
     // Iterate over all messages in this ACK event and retrieve their
     // correlationIds, while removing the entry from the underlying
     // 'internal correlationId' => 'user-provided correlationId' map, if
-    // applicable (i.e., if internal correlationId is non-null)
+    // applicable (i.e., if internal correlationId is non-null).  The GUIDs
+    // are collected first so that the whole batch is removed from the
+    // container with a single lock acquisition.
+
+    typedef MessageCorrelationIdContainer::RemovedItem RemovedItem;
+
+    bdlma::LocalSequentialAllocator<
+        k_ACK_BATCH_INLINE_SIZE *
+        (sizeof(bmqt::MessageGUID) + sizeof(RemovedItem))>
+                                   localAllocator(d_allocator_p);
+    bsl::vector<bmqt::MessageGUID> guids(&localAllocator);
+    bsl::vector<RemovedItem>       items(&localAllocator);
+    guids.reserve(k_ACK_BATCH_INLINE_SIZE);
 
     bmqp::AckMessageIterator it;
+    event.loadAckMessageIterator(&it);
+    while (it.next()) {
+        guids.push_back(it.message().messageGUID());
+    }
+
+    d_messageCorrelationIdContainer.remove(&items, guids);
+    BSLS_ASSERT_SAFE(items.size() == guids.size());
+
+    // Messages posted with a post batch are reported through the completion
+    // callback of their batch, and not in the ACK event delivered to the
+    // application, which then has to be rebuilt without them.
+    bslma::ManagedPtr<bmqp::AckEventBuilder> ackBuilder;
+    for (size_t i = 0; i < items.size(); ++i) {
+        if (items[i].d_batch_sp) {
+            ackBuilder.load(new (*d_allocator_p)
+                                bmqp::AckEventBuilder(d_bufferFactory_p,
+                                                      d_allocator_p),
+                            d_allocator_p);
+            break;  // BREAK
+        }
+    }
+
+    bsl::shared_ptr<Event> queueEvent = createEvent();
+
     event.loadAckMessageIterator(&it);
     int numAckMsgs = 0;
+    int numItems   = 0;
     while (it.next()) {
-        ++numAckMsgs;
         const bmqp::AckMessage& ackMsg = it.message();
+        const RemovedItem&      item   = items[numItems++];
 
         // Lookup queue
         const bsl::shared_ptr<Queue>& queue = d_queueManager.lookupQueue(
@@ -3631,20 +3742,56 @@ void BrokerSession::processAckEvent(const bmqp::Event& event)
                     << ", GUID: " << ackMsg.messageGUID() << "]";);
         }
 
-        bmqt::CorrelationId correlationId;
-        if (d_messageCorrelationIdContainer.remove(ackMsg.messageGUID(),
-                                                   &correlationId) != 0) {
+        if (!item.d_isFound) {
             // There is no correlationId associated with this GUID.
             // Per contract, broker does not send ACKs where status is zero and
             // correlationId is null.
             BSLS_ASSERT_SAFE(0 != ackMsg.status());
         }
+        else if (item.d_batch_sp) {
+            onPostBatchAck(
+                item.d_batch_sp,
+                item.d_batchIndex,
+                bmqp::ProtocolUtil::ackResultFromCode(ackMsg.status()));
+            continue;  // CONTINUE
+        }
+
+        if (ackBuilder) {
+            const bmqt::EventBuilderResult::Enum rc =
+                ackBuilder->appendMessage(ackMsg.status(),
+                                          ackMsg.correlationId(),
+                                          ackMsg.messageGUID(),
+                                          ackMsg.queueId());
+            // The rebuilt event is a subset of a valid ACK event.
+            BSLS_ASSERT_SAFE(rc == bmqt::EventBuilderResult::e_SUCCESS);
+            (void)rc;
+        }
 
         // Keep track of user-provided CorrelationId (it may be unset)
-        queueEvent->addCorrelationId(correlationId);
+        queueEvent->addCorrelationId(item.d_correlationId);
 
         // Insert queue into event
         queueEvent->insertQueue(queue);
+
+        ++numAckMsgs;
+    }
+
+    // Update stats
+    d_eventsStats.onEvent(EventsStatsEventType::e_ACK,
+                          event.blob()->length(),
+                          numItems);
+
+    if (!ackBuilder) {
+        queueEvent->configureAsMessageEvent(event);
+    }
+    else if (numAckMsgs != 0) {
+        bmqp::Event ackEvent(&ackBuilder->blob(), d_allocator_p, true);
+        // clone = true
+        queueEvent->configureAsMessageEvent(ackEvent);
+    }
+    else {
+        // All the messages were reported to their batch.
+        return;  // RETURN
     }
 
     BSLS_ASSERT_SAFE(numAckMsgs == queueEvent->numCorrrelationIds());
@@ -3652,11 +3799,29 @@ void BrokerSession::processAckEvent(const bmqp::Event& event)
     // Add to event queue. Note that we are now forwarding an ACK event which
     // may contain certain unset correlationIds with non-zero ack status.
     d_eventQueue.pushBack(queueEvent);
+}
 
-    // Update stats
-    d_eventsStats.onEvent(EventsStatsEventType::e_ACK,
-                          event.blob()->length(),
-                          numAckMsgs);
+void BrokerSession::onPostBatchAck(const bsl::shared_ptr<PostBatch>& batch,
+                                   int                               index,
+                                   bmqt::AckResult::Enum             result)
+{
+    // executed by the FSM thread
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+    BSLS_ASSERT_SAFE(batch);
+
+    if (!batch->onAck(index, result)) {
+        return;  // RETURN
+    }
+
+    // Invoke the completion callback from the event handler, in order with
+    // the other events delivered to the application.
+    bsl::shared_ptr<Event> queueEvent = createEvent();
+    queueEvent->configureAsRequestEvent(
+        bdlf::BindUtil::bind(&invokePostBatchCallback,
+                             batch,
+                             bdlf::PlaceHolders::_1));  // eventImpl
+    d_eventQueue.pushBack(queueEvent);
 }
 
 bmqt::OpenQueueResult::Enum
@@ -4105,6 +4270,18 @@ void BrokerSession::doHandleStartTimeout(
     d_sessionFsm.handleStartTimeout();
 }
 
+void BrokerSession::doHandlePutBatchTimeout(
+    BSLS_ANNOTATION_UNUSED const bsl::shared_ptr<Event>& eventSp)
+{
+    // executed by the FSM thread
+
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+
+    // The pending batch, if any, has already been flushed by the FSM thread
+    // before dispatching this request.
+    BSLS_ASSERT_SAFE(d_putBatcher.isEmpty());
+}
+
 void BrokerSession::doHandlePendingPutExpirationTimeout(
     BSLS_ANNOTATION_UNUSED const bsl::shared_ptr<Event>& eventSp)
 {
@@ -4550,6 +4727,15 @@ bool BrokerSession::cancelPendingMessageImp(
                                           : k_ACK_STATUS_UNKNOWN;
     }
 
+    if (qac.d_batch_sp) {
+        // The message is reported through the completion callback of its
+        // batch.
+        onPostBatchAck(qac.d_batch_sp,
+                       qac.d_batchIndex,
+                       bmqp::ProtocolUtil::ackResultFromCode(ackStatus));
+        return res;  // RETURN
+    }
+
     bmqt::EventBuilderResult::Enum rc = bmqp::ProtocolUtil::buildEvent(
         bdlf::BindUtil::bind(&bmqp::AckEventBuilder::appendMessage,
                              ackBuilder,
@@ -5107,6 +5293,11 @@ void BrokerSession::resetState()
     // Reset Event statistics
     d_eventsStats.resetStats();
 
+    // Drop any pending PUT batch (it has already been flushed by the
+    // request which led to the reset) and reset its statistics
+    d_putBatcher.reset();
+    d_putBatcher.resetStats();
+
     // Remove queue retransmission timeout data
     d_queueRetransmissionTimeoutMap.clear();
 
@@ -5585,6 +5776,7 @@ BrokerSession::BrokerSession(
 , d_extensionBufferCondition(bsls::SystemClockType::e_MONOTONIC)
 , d_queuesStats(allocator)
 , d_eventsStats(allocator)
+, d_putBatcher(bufferFactory, allocator)
 , d_stateCb(bsl::allocator_arg, allocator, stateCb)
 , d_usingSessionEventHandler(eventHandlerCb)  // UnspecifiedBool operator ...
 , d_messageCorrelationIdContainer(
@@ -5633,6 +5825,7 @@ BrokerSession::BrokerSession(
 , d_inProgressEventHandlerCount(0)
 , d_isStopping(false)
 , d_messageExpirationTimeoutHandle()
+, d_putBatchTimeoutHandle()
 , d_nextRequestGroupId(k_NON_BUFFERED_REQUEST_GROUP_ID)
 , d_queueRetransmissionTimeoutMap(allocator)
 , d_nextInternalSubscriptionId(bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID)
@@ -5651,6 +5844,16 @@ BrokerSession::BrokerSession(
     // remain in sync to prevent misleading values.
     resetState();
 
+    // Configure the latency related options of the event queue
+    d_eventQueue.setSpinDuration(sessionOptions.eventQueueSpinDuration());
+    d_eventQueue.setCpuAffinity(
+        sessionOptions.processingThreadsCpuAffinity());
+
+    // Configure the coalescing of posted PUT events
+    d_putBatcher.configure(sessionOptions.putBatchingLatencyBudget(),
+                           sessionOptions.putBatchingMaxMessages(),
+                           sessionOptions.putBatchingMaxBytes());
+
     // Spawn the FSM thread
     bslmt::ThreadAttributes threadAttributes =
         mwcsys::ThreadUtil::defaultAttributes();
@@ -5701,6 +5904,10 @@ void BrokerSession::initializeStats(
                                     d_allocator_p);
 
     d_eventsStats.initializeStats(rootStatContext, start, end);
+
+    if (d_putBatcher.isEnabled()) {
+        d_putBatcher.initializeStats(rootStatContext, start, end);
+    }
 }
 
 bmqt::GenericResult::Enum
@@ -7047,6 +7254,13 @@ BrokerSession::createDTSpan(bsl::string_view              operation,
 
 int BrokerSession::post(const bdlbb::Blob&        eventBlob,
                         const bsls::TimeInterval& timeout)
+{
+    return post(eventBlob, timeout, bsl::shared_ptr<PostBatch>());
+}
+
+int BrokerSession::post(const bdlbb::Blob&                eventBlob,
+                        const bsls::TimeInterval&         timeout,
+                        const bsl::shared_ptr<PostBatch>& batch)
 {
     // Prevent send of an empty/invalid blob: when using the
     // MessageEventBuilder, if no messages were added (i.e., 'PackMessage()'
@@ -7102,6 +7316,17 @@ int BrokerSession::post(const bdlbb::Blob&        eventBlob,
         BALL_LOG_ERROR << "Unable to post event [reason: 'SESSION_STOPPED']";
         return bmqt::PostResult::e_NOT_CONNECTED;  // RETURN
     }
+
+    if (batch) {
+        // Register all the messages of the batch at once, before the FSM
+        // thread associates their data to their items.  Note that, like for
+        // the messages registered when packed, the items are kept if the
+        // event is not accepted, so that the event can be posted again.
+        BSLS_ASSERT_SAFE(batch->numMessages() == msgCount);
+        event.loadPutMessageIterator(&putIter);
+        d_messageCorrelationIdContainer.add(&putIter, batch);
+    }
+
     bool isAccepted = acceptUserEvent(eventBlob, timeout);
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isAccepted)) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
@@ -7324,6 +7549,20 @@ void BrokerSession::onPendingPutExpirationTimeout()
     enqueueFsmEvent(event);
 }
 
+void BrokerSession::onPutBatchTimeout()
+{
+    // executed by the *SCHEDULER* thread
+
+    // The batch is flushed by the FSM thread before processing any request
+    // event, so an empty request is enough.
+    bsl::shared_ptr<Event> event = createEvent();
+    event->configureAsRequestEvent(
+        bdlf::BindUtil::bind(&BrokerSession::doHandlePutBatchTimeout,
+                             this,
+                             bdlf::PlaceHolders::_1));  // eventImpl
+    enqueueFsmEvent(event);
+}
+
 void BrokerSession::handleChannelWatermark(
     mwcio::ChannelWatermarkType::Enum type)
 {
@@ -7349,6 +7588,11 @@ void BrokerSession::printStats(bsl::ostream& stream, bool includeDelta) const
 
     stream << "::::: Event Queue >>";
     d_eventQueue.printStats(stream, includeDelta);
+
+    if (d_putBatcher.isEnabled()) {
+        stream << "::::: PUT Batches >>";
+        d_putBatcher.printStats(stream, includeDelta);
+    }
 }
 
 void BrokerSession::processDumpCommand(
@@ -36,6 +36,8 @@
 #include <bmqimp_eventsstats.h>
 #include <bmqimp_messagecorrelationidcontainer.h>
 #include <bmqimp_messagedumper.h>
+#include <bmqimp_postbatch.h>
+#include <bmqimp_putbatcher.h>
 #include <bmqimp_queue.h>
 #include <bmqimp_queuemanager.h>
 #include <bmqimp_stat.h>
@@ -741,6 +743,11 @@ class BrokerSession BSLS_CPP11_FINAL {
     mutable EventsStats d_eventsStats;
     // Stats for all events
 
+    mutable PutBatcher d_putBatcher;
+    // Coalescer of the PUT events posted
+    // by the user (only accessed by the
+    // FSM thread, except for stats)
+
     const StateFunctor d_stateCb;
     // Callback to invoke when the
     // session makes state transition.
@@ -843,6 +850,10 @@ class BrokerSession BSLS_CPP11_FINAL {
     // Timer Event handle for pending PUT
     // messages' expiration timeout
 
+    bdlmt::EventScheduler::EventHandle d_putBatchTimeoutHandle;
+    // Timer Event handle for the latency
+    // budget of the pending PUT batch
+
     int d_nextRequestGroupId;
     // Id of the next request group to
     // use
@@ -946,8 +957,21 @@ class BrokerSession BSLS_CPP11_FINAL {
 
     /// Process the put event represented by the specified `event`.  This
     /// method gets called each time a new put event is poseted by the user.
+    /// If PUT batching is enabled, the messages of `event` are appended to
+    /// the pending batch, which is sent when it is full, when its latency
+    /// budget expires, or as soon as no other event is pending in the FSM
+    /// queue.
     void processPutEvent(const bmqp::Event& event);
 
+    /// Send the put event represented by the specified `event` to the
+    /// broker, and enable retransmission of its messages as needed.
+    void sendPutEvent(const bmqp::Event& event);
+
+    /// Send the pending PUT batch, if any, and cancel its latency budget
+    /// timer.  This must be called before processing any FSM event which
+    /// must not be reordered with previously posted PUT messages.
+    void flushPutBatch();
+
     /// Process the confirm event represented by the specified `event`.
     /// This method gets called each time a new confirm event is poseted by
     /// the user.
@@ -963,6 +987,14 @@ class BrokerSession BSLS_CPP11_FINAL {
     /// broker) is available on the channel.
     void processAckEvent(const bmqp::Event& event);
 
+    /// Record that the message at the specified `index` of the specified
+    /// `batch` was acknowledged with the specified `result` and, if all the
+    /// messages of `batch` are now acknowledged, enqueue the invocation of
+    /// its completion callback to the event queue.
+    void onPostBatchAck(const bsl::shared_ptr<PostBatch>& batch,
+                        int                               index,
+                        bmqt::AckResult::Enum             result);
+
     /// Callback invoked in reply to a `disconnect` with the specified
     /// `context`.
     void onDisconnectResponse(const RequestManagerType::RequestSp& context);
@@ -1324,6 +1356,11 @@ class BrokerSession BSLS_CPP11_FINAL {
     void
     doHandlePendingPutExpirationTimeout(const bsl::shared_ptr<Event>& eventSp);
 
+    /// Invoked from the FSM thread as a handler to the PUT batch latency
+    /// budget timeout event specified as `eventSp` and sent by the
+    /// scheduler thread.
+    void doHandlePutBatchTimeout(const bsl::shared_ptr<Event>& eventSp);
+
     /// Invoked from the FSM thread as a handler to the channel watermark
     /// event specified as `eventSp` with the specified watermark `type`
     /// sent by the IO thread.
@@ -1573,6 +1610,19 @@ class BrokerSession BSLS_CPP11_FINAL {
 
     int post(const bdlbb::Blob& eventBlob, const bsls::TimeInterval& timeout);
 
+    /// Post the PUT event in the specified `eventBlob`, waiting at most the
+    /// specified `timeout` if the channel is full, and report the
+    /// acknowledgments of all its messages through the specified `batch`,
+    /// whose completion callback is invoked from the event handler once all
+    /// of them have been acknowledged.  The messages of the event are not
+    /// reported in the ACK events delivered to the application.  Return 0
+    /// on success, or a `bmqt::PostResult::Enum` on error.  The behavior is
+    /// undefined unless the messages of `batch` are, in order, those of
+    /// the event.
+    int post(const bdlbb::Blob&                eventBlob,
+             const bsls::TimeInterval&         timeout,
+             const bsl::shared_ptr<PostBatch>& batch);
+
     int confirmMessage(const bsl::shared_ptr<bmqimp::Queue>& queue,
                        const bmqt::MessageGUID&              messageId,
                        const bsls::TimeInterval&             timeout);
@@ -1599,6 +1649,9 @@ class BrokerSession BSLS_CPP11_FINAL {
     /// Invoked when pending PUT expiration timeout fires.
     void onPendingPutExpirationTimeout();
 
+    /// Invoked when the latency budget of the pending PUT batch expires.
+    void onPutBatchTimeout();
+
     /// Process the specified dump `command`.
     void processDumpCommand(const bmqp_ctrlmsg::DumpMessages& command);
 
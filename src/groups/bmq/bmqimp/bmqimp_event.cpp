@@ -58,7 +58,7 @@ Event::Event(bdlbb::BlobBufferFactory* blobBufferFactory,
 , d_putEventBuilderBuffer()
 , d_isPutEventBuilderConstructed(false)
 , d_correlationIds(allocator)
-
+, d_postBatch_sp()
 {
     // NOTHING
 }
@@ -84,7 +84,7 @@ Event::Event(const Event& other, bslma::Allocator* allocator)
 , d_putEventBuilderBuffer()
 , d_isPutEventBuilderConstructed(false)
 , d_correlationIds(other.d_correlationIds, allocator)
-
+, d_postBatch_sp(other.d_postBatch_sp)
 {
     // PRECONDITIONS
     BSLS_ASSERT_OPT(EventType::e_MESSAGE != other.d_type ||
@@ -157,6 +157,7 @@ Event& Event::operator=(const Event& rhs)
     d_errorDescription                = rhs.d_errorDescription;
     d_msgEventMode                    = rhs.d_msgEventMode;
     d_correlationIds                  = rhs.d_correlationIds;
+    d_postBatch_sp                    = rhs.d_postBatch_sp;
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_type ==
                                               EventType::e_SESSION)) {
@@ -225,6 +226,7 @@ void Event::reset()
     d_ackMsgIter.clear();
     d_putMsgIter.clear();
     d_correlationIds.clear();
+    d_postBatch_sp.reset();
 }
 
 void Event::clear()
@@ -357,6 +359,18 @@ Event& Event::upgradeMessageEventModeToWrite()
     d_queuesBySubscriptionId.clear();
     d_correlationIds.clear();
     d_correlationId.makeUnset();
+    d_postBatch_sp.reset();
+    return *this;
+}
+
+Event& Event::setPostBatch(const bsl::shared_ptr<PostBatch>& batch)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(type() == EventType::e_MESSAGE);
+    BSLS_ASSERT_SAFE(messageEventMode() == MessageEventMode::e_WRITE);
+    BSLS_ASSERT_SAFE(d_correlationIds.empty());
+
+    d_postBatch_sp = batch;
     return *this;
 }
 
@@ -399,6 +413,15 @@ void Event::addMessageInfo(const bsl::shared_ptr<Queue>& queue,
     // index.
     addCorrelationId(corrId);
 
+    if (d_postBatch_sp) {
+        // The message is acknowledged through the batch, which assigns it
+        // the next PUT sequence number of the queue without taking any lock.
+        // The messages of the batch are added to the correlationId container
+        // all at once when the event is posted.
+        d_postBatch_sp->addMessage(queue);
+        return;  // RETURN
+    }
+
     // Insert correlationId and queueId and into correlationIds maps of
     // correlationId container.
     if (!corrId.isUnset()) {
@@ -73,6 +73,7 @@
 
 // BMQ
 
+#include <bmqimp_postbatch.h>
 #include <bmqimp_queue.h>
 #include <bmqp_ackmessageiterator.h>
 #include <bmqp_event.h>
@@ -258,6 +259,11 @@ class Event {
     // For PUSH messages optional corresponding
     // subscription Ids may be provided.
 
+    bsl::shared_ptr<PostBatch> d_postBatch_sp;
+    // Post batch tracking the acknowledgments
+    // of the PUT messages of this event, if
+    // any.
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(Event, bslma::UsesBslmaAllocator)
@@ -473,6 +479,12 @@ class Event {
     /// underlying raw event is of type PUSH.
     unsigned int subscriptionId(int position) const;
 
+    /// Return the post batch tracking the acknowledgments of the PUT
+    /// messages of this event, or an empty pointer if the messages are
+    /// acknowledged individually.  Behavior is undefined unless event's
+    /// `type()` is MESSAGEEVENT.
+    const bsl::shared_ptr<PostBatch>& postBatch() const;
+
     // MANIPULATORS
 
     /// Behavior is undefined unless event's `type()` is MESSAGEVENT,
@@ -503,10 +515,17 @@ class Event {
                           unsigned int               subscriptionHandleId =
                               bmqt::SubscriptionHandle::k_INVALID_HANDLE_ID);
 
+    /// Set the post batch tracking the acknowledgments of the PUT messages
+    /// of this event to the specified `batch`.  Behavior is undefined
+    /// unless event's `type()` is MESSAGEVENT, `messageEventMode()` is
+    /// WRITE, and no message has been added to the event.
+    Event& setPostBatch(const bsl::shared_ptr<PostBatch>& batch);
+
     /// Insert the specified `queue` to the queues and the specified
     /// `corrId` to the list of correlationIds associated with this event.
-    /// If the `corrId` is not empty associate it with the specified `guid`
-    /// in the correlationId container.
+    /// If a post batch is set, add the message to the batch; otherwise, if
+    /// the `corrId` is not empty associate it with the specified `guid` in
+    /// the correlationId container.
     void addMessageInfo(const bsl::shared_ptr<bmqimp::Queue>& queue,
                         const bmqt::MessageGUID&              guid,
                         const bmqt::CorrelationId&            corrId);
@@ -722,6 +741,14 @@ inline const bmqp::Event& Event::rawEvent() const
     return d_rawEvent;
 }
 
+inline const bsl::shared_ptr<PostBatch>& Event::postBatch() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(type() == EventType::e_MESSAGE);
+
+    return d_postBatch_sp;
+}
+
 inline int Event::numCorrrelationIds() const
 {
     // PRECONDITIONS
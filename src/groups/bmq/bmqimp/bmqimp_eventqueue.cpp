@@ -36,6 +36,7 @@
 #include <bdlf_memfn.h>
 #include <bdlf_placeholder.h>
 #include <bdlma_localsequentialallocator.h>
+#include <bsl_algorithm.h>
 #include <bsl_iostream.h>
 #include <bsl_string.h>
 #include <bslma_allocator.h>
@@ -186,6 +187,21 @@ bool EventQueue::hasPriorityEvents(bsl::shared_ptr<Event>* event)
     return false;
 }
 
+bool EventQueue::spinPopFront(QueueItem* item, bsls::Types::Int64 deadline)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(item);
+
+    do {
+        if (d_queue.tryPopFront(item) == 0) {
+            return true;  // RETURN
+        }
+        bslmt::ThreadUtil::yield();
+    } while (mwcsys::Time::highResolutionTimer() < deadline);
+
+    return false;
+}
+
 void EventQueue::afterEventPopped(const QueueItem& item)
 {
     const bsls::Types::Int64 popOutTime = mwcsys::Time::highResolutionTimer();
@@ -251,6 +267,17 @@ void EventQueue::dispatchNextEvent()
     BALL_LOG_INFO << "EventHandler thread started "
                   << "[id: " << bslmt::ThreadUtil::selfIdAsUint64() << "]";
 
+    if (!d_cpuAffinity.empty()) {
+        const int rc = mwcsys::ThreadUtil::setCurrentThreadCpuAffinity(
+            d_cpuAffinity);
+        if (rc != 0) {
+            BALL_LOG_WARN << "Failed to set CPU affinity of EventHandler "
+                          << "thread [id: "
+                          << bslmt::ThreadUtil::selfIdAsUint64()
+                          << ", rc: " << rc << "]";
+        }
+    }
+
     while (true) {
         const bsl::shared_ptr<Event> eventSp = popFront();
 
@@ -289,6 +316,8 @@ EventQueue::EventQueue(EventPool*                  eventPool,
 , d_statTip(&d_statTable, allocator)
 , d_statTipNoDelta(&d_statTable, allocator)
 , d_pushBackSpinlock(bsls::SpinLock::s_unlocked)
+, d_spinDurationNs(0)
+, d_cpuAffinity(allocator)
 {
     // PRECONDITIONS
     BSLS_ASSERT_OPT((eventHandler && numProcessingThreads > 0) ||
@@ -419,6 +448,27 @@ void EventQueue::initializeStats(
         .extremeValueString("");
 }
 
+void EventQueue::setSpinDuration(const bsls::TimeInterval& duration)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(duration >= bsls::TimeInterval(0));
+    BSLS_ASSERT_OPT(!d_threadPool_mp && "Queue already started");
+
+    d_spinDurationNs = duration.totalNanoseconds();
+
+    BALL_LOG_INFO << "EventQueue readers will spin for "
+                  << mwcu::PrintUtil::prettyTimeInterval(d_spinDurationNs)
+                  << " before blocking";
+}
+
+void EventQueue::setCpuAffinity(const bsl::vector<int>& cpus)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(!d_threadPool_mp && "Queue already started");
+
+    d_cpuAffinity = cpus;
+}
+
 int EventQueue::start()
 {
     // Make sure the queue is empty (so that we can do start, stop, start, ...
@@ -544,11 +594,16 @@ bsl::shared_ptr<Event> EventQueue::popFront()
         return event;  // RETURN
     }
 
-    // Look in the queue
+    // Look in the queue, busy-polling it first if configured to do so
     QueueItem item;
-    const int rc = d_queue.popFront(&item);
-    BSLS_ASSERT_SAFE(rc == 0);
-    (void)rc;
+    if (d_spinDurationNs == 0 ||
+        !spinPopFront(&item,
+                      mwcsys::Time::highResolutionTimer() +
+                          d_spinDurationNs)) {
+        const int rc = d_queue.popFront(&item);
+        BSLS_ASSERT_SAFE(rc == 0);
+        (void)rc;
+    }
     event = item.d_event_sp;
     afterEventPopped(item);
     return event;
@@ -569,9 +624,20 @@ EventQueue::timedPopFront(const bsls::TimeInterval& timeout,
     }
 
     const bsls::TimeInterval absTimeOut = timeout + now;
-    // Look in the queue
+    // Look in the queue, busy-polling it first (for no longer than the
+    // specified 'timeout') if configured to do so
     QueueItem item;
-    const int rc = d_queue.timedPopFront(&item, absTimeOut);
+    int       rc = -1;
+    if (d_spinDurationNs != 0 &&
+        spinPopFront(&item,
+                     mwcsys::Time::highResolutionTimer() +
+                         bsl::min(d_spinDurationNs,
+                                  timeout.totalNanoseconds()))) {
+        rc = 0;
+    }
+    else {
+        rc = d_queue.timedPopFront(&item, absTimeOut);
+    }
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 
@@ -33,6 +33,15 @@
 // The queue has a built-in monitoring mechanism that will emit alarms when it
 // reaches certain user-customizable thresholds.
 //
+/// Spin-then-park
+///--------------
+// By default, a thread popping from an empty queue immediately blocks on the
+// underlying queue's condition variable, which implies a thread wake up on
+// the delivery path of the next event.  Latency sensitive applications can
+// use 'setSpinDuration' to have readers busy-poll the queue for up to the
+// specified duration before parking, and 'setCpuAffinity' to pin the internal
+// processing threads to a dedicated set of CPUs.
+//
 /// Statistics
 ///----------
 // If configured for the queue can keep keep track of the following statistics:
@@ -151,6 +160,7 @@
 #include <bdlmt_fixedthreadpool.h>
 #include <bdlt_currenttime.h>
 #include <bsl_functional.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
@@ -284,6 +294,17 @@ class EventQueue {
     // SpinLock to synchronize
     // 'pushBack'
 
+    bsls::Types::Int64 d_spinDurationNs;
+    // Duration (in nanoseconds) for
+    // which a reader busy-polls the
+    // queue before blocking, 0 to
+    // block immediately.
+
+    bsl::vector<int> d_cpuAffinity;
+    // CPUs the processing threads
+    // should be pinned to, empty for
+    // no affinity.
+
   private:
     // NOT IMPLEMENTED
     EventQueue(const EventQueue& other) BSLS_CPP11_DELETED;
@@ -304,6 +325,12 @@ class EventQueue {
     /// prioritized events was scheduled.
     bool hasPriorityEvents(bsl::shared_ptr<Event>* event);
 
+    /// Busy-poll the queue until either an item is available, in which case
+    /// load it into the specified `item` and return true, or the high
+    /// resolution timer reaches the specified `deadline` (in nanoseconds),
+    /// in which case return false.
+    bool spinPopFront(QueueItem* item, bsls::Types::Int64 deadline);
+
     /// Called after the specified `item` was successfully popped out from
     /// the queue, just before it being delivered to the caller.
     void afterEventPopped(const QueueItem& item);
@@ -348,6 +375,19 @@ class EventQueue {
                          const mwcst::StatValue::SnapshotLocation& start,
                          const mwcst::StatValue::SnapshotLocation& end);
 
+    /// Set the duration for which a thread popping from this queue
+    /// busy-polls it before blocking to the specified `duration`.  A
+    /// `duration` of 0 disables spinning.  The behavior is undefined unless
+    /// `duration` is non-negative and this method is called prior to
+    /// `start`.
+    void setSpinDuration(const bsls::TimeInterval& duration);
+
+    /// Pin the internal processing threads to the CPUs in the specified
+    /// `cpus`.  An empty `cpus` means no affinity.  This has no effect if no
+    /// `eventHandler` was provided at construction.  The behavior is
+    /// undefined unless this method is called prior to `start`.
+    void setCpuAffinity(const bsl::vector<int>& cpus);
+
     /// Start the EventQueue and return 0 on success, or a non zero code on
     /// error.  If an `eventHandler` was provided at construction, this will
     /// start the thread pool.
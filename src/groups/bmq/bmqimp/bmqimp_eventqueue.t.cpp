@@ -32,7 +32,9 @@
 #include <bdlmt_threadpool.h>
 #include <bdlt_timeunitratio.h>
 #include <bmqimp_stat.h>
+#include <bsl_vector.h>
 #include <bslma_managedptr.h>
+#include <bslmt_threadutil.h>
 #include <bsls_atomic.h>
 #include <bsls_timeinterval.h>
 #include <bsls_timeutil.h>
@@ -654,6 +656,106 @@ static void test6_workingStatsTest()
     ASSERT_EQ(valTime.max(), k_INITIAL_CAPACITY * k_MILL_SEC + k_QUEUE_WAIT);
 }
 
+static void test7_spinThenParkTest()
+// ------------------------------------------------------------------------
+// SPIN THEN PARK TEST
+//
+// Concerns:
+//   1. Check that bmqimp::EventQueue configured with a spin duration
+//      delivers events pushed while the reader is spinning, as well as
+//      events pushed after the reader parked.
+//   2. Check that 'timedPopFront' still times out when the spin duration
+//      is larger than the provided timeout.
+//
+// Plan:
+//   1. Create bmqimp::EventQueue with event handler processing threads,
+//      a spin duration and a CPU affinity, push events and check that the
+//      handler is called for each of them.
+//   2. Create bmqimp::EventQueue without processing threads and a large
+//      spin duration, call 'timedPopFront' with a small timeout on the
+//      empty queue and check that a TIMEOUT event is returned.
+//
+// Testing manipulators:
+//   - setSpinDuration
+//   - setCpuAffinity
+//   - popFront
+//   - timedPopFront
+//   ----------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("SPIN THEN PARK");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    bmqimp::EventQueue::EventPool  eventPool(
+        bdlf::BindUtil::bind(&poolCreateEvent,
+                             bdlf::PlaceHolders::_1,  // address
+                             &bufferFactory,
+                             bdlf::PlaceHolders::_2),  // allocator
+        -1,
+        s_allocator_p);
+
+    {
+        PV("Spinning processing threads");
+
+        const int       k_NUM_THREADS = 2;
+        const int       k_NUM_EVENTS  = 10;
+        bsls::AtomicInt eventCounter;
+
+        bmqimp::EventQueue obj(&eventPool,
+                               100,  // initialCapacity
+                               3,    // lowWatermark
+                               90,   // highWatermark
+                               bdlf::BindUtil::bind(&eventHandler,
+                                                    bdlf::PlaceHolders::_1,
+                                                    bsl::ref(eventCounter)),
+                               k_NUM_THREADS,  // numProcessingThreads
+                               s_allocator_p);
+
+        bsl::vector<int> cpus(s_allocator_p);
+        cpus.push_back(0);
+
+        obj.setSpinDuration(bsls::TimeInterval(0, 10 * 1000 * 1000));  // 10ms
+        obj.setCpuAffinity(cpus);
+        obj.start();
+
+        for (int i = 0; i < k_NUM_EVENTS; ++i) {
+            bsl::shared_ptr<bmqimp::Event> event = eventPool.getObject();
+            event->configureAsSessionEvent(
+                bmqt::SessionEventType::e_UNDEFINED);
+            obj.pushBack(event);
+
+            if (i == k_NUM_EVENTS / 2) {
+                // Let the readers go past their spin duration and park, so
+                // that the remaining events are delivered to parked readers.
+                bslmt::ThreadUtil::microSleep(50 * 1000);  // 50ms
+            }
+        }
+
+        obj.stop();
+
+        ASSERT_EQ(eventCounter, k_NUM_EVENTS);
+    }
+
+    {
+        PV("Timeout shorter than spin duration");
+
+        bmqimp::EventQueue::EventHandlerCallback emptyEventHandler;
+        bmqimp::EventQueue                       obj(&eventPool,
+                               1,  // initialCapacity
+                               3,  // lowWatermark
+                               6,  // highWatermark
+                               emptyEventHandler,
+                               0,  // numProcessingThreads
+                               s_allocator_p);
+
+        obj.setSpinDuration(bsls::TimeInterval(60.0));
+
+        bsl::shared_ptr<bmqimp::Event> event = obj.timedPopFront(
+            bsls::TimeInterval(0, 10 * 1000 * 1000));  // 10ms
+        ASSERT_EQ(event->sessionEventType(),
+                  bmqt::SessionEventType::e_TIMEOUT);
+    }
+}
+
 static void testN1_performance()
 // ------------------------------------------------------------------------
 // QUEUE - PERFORMANCE TEST
@@ -716,6 +818,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 7: test7_spinThenParkTest(); break;
     case 6: test6_workingStatsTest(); break;
     case 5: test5_emptyStatsTest(); break;
     case 4: test4_basicEventHandlerTest(); break;
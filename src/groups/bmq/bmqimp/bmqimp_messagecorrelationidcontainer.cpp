@@ -21,6 +21,7 @@
 #include <bmqp_messageguidgenerator.h>
 #include <bmqp_protocol.h>
 #include <bmqp_protocolutil.h>
+#include <bmqp_putmessageiterator.h>
 #include <bmqp_queueid.h>
 
 // BDE
@@ -39,6 +40,8 @@ MessageCorrelationIdContainer::QueueAndCorrelationId::QueueAndCorrelationId(
 , d_queueId(bmqp::QueueId::k_UNASSIGNED_QUEUE_ID)
 , d_messageType(bmqp::EventType::e_UNDEFINED)
 , d_messageData(allocator)
+, d_batch_sp()
+, d_batchIndex(-1)
 {
     // NOTHING
 }
@@ -51,6 +54,8 @@ MessageCorrelationIdContainer::QueueAndCorrelationId::QueueAndCorrelationId(
 , d_queueId(queueId)
 , d_messageType(bmqp::EventType::e_UNDEFINED)
 , d_messageData(allocator)
+, d_batch_sp()
+, d_batchIndex(-1)
 {
     // NOTHING
 }
@@ -63,6 +68,21 @@ MessageCorrelationIdContainer::QueueAndCorrelationId::QueueAndCorrelationId(
 , d_messageType(other.d_messageType)
 , d_messageData(other.d_messageData, allocator)
 , d_requestContext(other.d_requestContext)
+, d_batch_sp(other.d_batch_sp)
+, d_batchIndex(other.d_batchIndex)
+{
+    // NOTHING
+}
+
+// ------------------------------------------------
+// class MessageCorrelationIdContainer::RemovedItem
+// ------------------------------------------------
+
+MessageCorrelationIdContainer::RemovedItem::RemovedItem()
+: d_isFound(false)
+, d_correlationId()
+, d_batch_sp()
+, d_batchIndex(-1)
 {
     // NOTHING
 }
@@ -152,6 +172,33 @@ bmqt::MessageGUID MessageCorrelationIdContainer::add(
     return key;
 }
 
+void MessageCorrelationIdContainer::add(
+    bmqp::PutMessageIterator*         putIter,
+    const bsl::shared_ptr<PostBatch>& batch)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(putIter);
+    BSLS_ASSERT_SAFE(batch);
+
+    bsls::SpinLockGuard guard(&d_lock);  // LOCK
+
+    int index = 0;
+    while (putIter->next() == 1) {
+        BSLS_ASSERT_SAFE(index < batch->numMessages());
+
+        QueueAndCorrelationId toInsert(bmqt::CorrelationId(),
+                                       bmqp::QueueId(
+                                           putIter->header().queueId()),
+                                       d_allocator_p);
+        toInsert.d_batch_sp   = batch;
+        toInsert.d_batchIndex = index++;
+        d_correlationIds.insert(
+            bsl::make_pair(putIter->header().messageGUID(), toInsert));
+    }
+
+    BSLS_ASSERT_SAFE(index == batch->numMessages());
+}
+
 MessageCorrelationIdContainer::CorrelationIdsMap::const_iterator
 MessageCorrelationIdContainer::removeLocked(
     const CorrelationIdsMap::const_iterator& cit)
@@ -199,6 +246,40 @@ int MessageCorrelationIdContainer::remove(const bmqt::MessageGUID& key,
     return 0;
 }
 
+int MessageCorrelationIdContainer::remove(
+    bsl::vector<RemovedItem>*             items,
+    const bsl::vector<bmqt::MessageGUID>& keys)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(items);
+
+    const size_t offset = items->size();
+    items->resize(offset + keys.size());
+
+    int numNotFound = 0;
+
+    bsls::SpinLockGuard guard(&d_lock);  // LOCK
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+        CorrelationIdsMap::const_iterator cit = d_correlationIds.find(keys[i]);
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_correlationIds.end() ==
+                                                  cit)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            ++numNotFound;
+            continue;  // CONTINUE
+        }
+
+        RemovedItem& item    = (*items)[offset + i];
+        item.d_isFound       = true;
+        item.d_correlationId = cit->second.d_correlationId;
+        item.d_batch_sp      = cit->second.d_batch_sp;
+        item.d_batchIndex    = cit->second.d_batchIndex;
+        removeLocked(cit);
+    }
+
+    return numNotFound;
+}
+
 void MessageCorrelationIdContainer::associateMessageData(
     const bmqp::PutHeader&    header,
     const bdlbb::Blob&        appData,
@@ -206,24 +287,36 @@ void MessageCorrelationIdContainer::associateMessageData(
 {
     bsls::SpinLockGuard guard(&d_lock);  // LOCK
 
+    const bool isAckRequested = bmqp::PutHeaderFlagUtil::isSet(
+        header.flags(),
+        bmqp::PutHeaderFlags::e_ACK_REQUESTED);
+    bmqp::QueueId qid(header.queueId());
+
     CorrelationIdsMap::iterator it = d_correlationIds.find(
         header.messageGUID());
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(it == d_correlationIds.end())) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        BSLS_ASSERT_SAFE(false && "Key not found");
-        return;  // RETURN
+        if (isAckRequested) {
+            BSLS_ASSERT_SAFE(false && "Key not found");
+            return;  // RETURN
+        }
+
+        // PUT messages without ACK_REQUESTED flag have not been added by the
+        // user.  Add them here, under the same lock.
+        it = d_correlationIds
+                 .insert(bsl::make_pair(
+                     header.messageGUID(),
+                     QueueAndCorrelationId(bmqt::CorrelationId(),
+                                           qid,
+                                           d_allocator_p)))
+                 .first;
     }
-    bmqp::QueueId qid(header.queueId());
     it->second.d_messageType = bmqp::EventType::e_PUT;
     it->second.d_header      = header;
     it->second.d_messageData = appData;
     it->second.d_queueId     = qid;
     ++d_numPuts;
 
-    const bool isAckRequested = bmqp::PutHeaderFlagUtil::isSet(
-        header.flags(),
-        bmqp::PutHeaderFlags::e_ACK_REQUESTED);
-
     if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(isAckRequested)) {
         // Add a per queue item with sending timestamp
         addQueueItem(it->second.d_queueId, header.messageGUID(), sentTime);
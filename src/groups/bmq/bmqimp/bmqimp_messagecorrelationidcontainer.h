@@ -29,12 +29,18 @@
 // is returned which can be used later on to assign the 'queueId' as well as
 // retrieve and remove the 'correlationId'.
 //
+// The messages of a PUT event posted with a 'bmqimp::PostBatch' are
+// registered all at once, under a single lock acquisition, and their items
+// refer to the batch and to the index of the message in the batch instead of
+// holding a user-provided 'correlationId'.
+//
 /// Thread Safety
 ///-------------
 // Thread safe.
 
 // BMQ
 
+#include <bmqimp_postbatch.h>
 #include <bmqp_protocol.h>
 #include <bmqp_requestmanager.h>
 #include <bmqt_correlationid.h>
@@ -45,6 +51,8 @@
 
 // BDE
 #include <bsl_functional.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
@@ -52,6 +60,12 @@
 #include <bsls_spinlock.h>
 
 namespace BloombergLP {
+
+// FORWARD DECLARATION
+namespace bmqp {
+class PutMessageIterator;
+}
+
 namespace bmqimp {
 
 // ===================================
@@ -88,6 +102,14 @@ class MessageCorrelationIdContainer {
         RequestManagerType::RequestSp d_requestContext;
         // Control request context.
 
+        bsl::shared_ptr<PostBatch> d_batch_sp;
+        // Post batch the PUT message belongs
+        // to, if any.
+
+        int d_batchIndex;
+        // Index of the PUT message in
+        // 'd_batch_sp', or -1.
+
         /// Create a `QueueAndCorrelationId` having an invalid queueId and
         /// empty correlationId using the specified `allocator`.
         QueueAndCorrelationId(bslma::Allocator* allocator);
@@ -105,6 +127,28 @@ class MessageCorrelationIdContainer {
                               bslma::Allocator*            allocator);
     };
 
+    /// Struct representing the outcome of the removal of the item having a
+    /// given key.
+    struct RemovedItem {
+        bool d_isFound;
+        // Whether an item was found for the
+        // key.
+
+        bmqt::CorrelationId d_correlationId;
+        // CorrelationId of the removed item.
+
+        bsl::shared_ptr<PostBatch> d_batch_sp;
+        // Post batch of the removed item, if
+        // any.
+
+        int d_batchIndex;
+        // Index of the removed item in
+        // 'd_batch_sp', or -1.
+
+        /// Create a `RemovedItem` for a key which was not found.
+        RemovedItem();
+    };
+
     /// Callback signature for iterating over all elements in the container.
     typedef bsl::function<bool(bool*                        removeItem,
                                const bmqt::MessageGUID&     key,
@@ -216,9 +260,33 @@ class MessageCorrelationIdContainer {
     int remove(const bmqt::MessageGUID& key,
                bmqt::CorrelationId*     correlationId = 0);
 
+    /// Add an item for each message iterated by the specified `putIter`,
+    /// associating the message at index `i` of the iteration to the
+    /// message at index `i` of the specified `batch`.  The behavior is
+    /// undefined unless `putIter` is positioned before the first message
+    /// of the event and the messages of the event are those of `batch`, in
+    /// order.  Note that the internal lock is acquired only once for the
+    /// whole event.
+    void add(bmqp::PutMessageIterator*         putIter,
+             const bsl::shared_ptr<PostBatch>& batch);
+
+    /// Remove the items uniquely identified by each of the specified
+    /// `keys`, and append to the specified `items` the outcome of the
+    /// removal of each key, in the order of `keys`.  The `d_isFound` flag
+    /// of the appended item is false for every key that is not found.
+    /// Return the number of keys that were not found.  Note that the
+    /// internal lock is acquired only once for the whole batch, so this
+    /// method should be preferred over successive calls to `remove` when
+    /// processing an event carrying multiple messages.
+    int remove(bsl::vector<RemovedItem>*             items,
+               const bsl::vector<bmqt::MessageGUID>& keys);
+
     /// Associate the specified message data to the item having the key
-    /// equals to the GUID from the specified PUT `header`.  The behavior is
-    /// undefined if the GUID does not correspond to a previously registered
+    /// equals to the GUID from the specified PUT `header`.  If the
+    /// `ACK_REQUESTED` flag is not set in the `header` and there is no
+    /// item with such key, a new item having an unset correlationId is
+    /// added first.  The behavior is undefined if the `ACK_REQUESTED` flag
+    /// is set and the GUID does not correspond to a previously registered
     /// item.
     void associateMessageData(const bmqp::PutHeader&    header,
                               const bdlbb::Blob&        appData,
@@ -17,17 +17,26 @@
 #include <bmqimp_messagecorrelationidcontainer.h>
 
 // BMQ
+#include <bmqimp_postbatch.h>
 #include <bmqimp_queue.h>
+#include <bmqp_event.h>
 #include <bmqp_messageguidgenerator.h>
+#include <bmqp_protocol.h>
+#include <bmqp_puteventbuilder.h>
+#include <bmqp_putmessageiterator.h>
 #include <bmqt_correlationid.h>
 #include <bmqt_messageguid.h>
 
 // BDE
+#include <bdlbb_blob.h>
+#include <bdlbb_pooledblobbufferfactory.h>
 #include <bdlf_bind.h>
 #include <bsl_functional.h>
+#include <bsl_memory.h>
 #include <bsl_unordered_map.h>
 #include <bsl_vector.h>
 #include <bslma_allocator.h>
+#include <bsls_timeinterval.h>
 
 // TEST DRIVER
 #include <mwctst_testhelper.h>
@@ -213,6 +222,154 @@ static void test3_associate()
     }
 }
 
+static void test4_batchRemove()
+{
+    mwctst::TestHelper::printTestName("BATCH REMOVE");
+
+    bmqimp::MessageCorrelationIdContainer container(s_allocator_p);
+
+    bmqt::MessageGUID guid1 = bmqp::MessageGUIDGenerator::testGUID();
+    bmqt::MessageGUID guid2 = bmqp::MessageGUIDGenerator::testGUID();
+    bmqt::MessageGUID guid3 = bmqp::MessageGUIDGenerator::testGUID();
+
+    container.add(guid1, bmqt::CorrelationId(1), bmqp::QueueId(1));
+    container.add(guid2, bmqt::CorrelationId(2), bmqp::QueueId(2));
+    container.add(guid3, bmqt::CorrelationId(3), bmqp::QueueId(1));
+
+    bsl::vector<bmqt::MessageGUID> keys(s_allocator_p);
+    keys.push_back(guid3);
+    keys.push_back(bmqt::MessageGUID());
+    keys.push_back(guid1);
+
+    typedef bmqimp::MessageCorrelationIdContainer::RemovedItem RemovedItem;
+
+    {
+        PVV("Remove a batch with an unknown key");
+        bsl::vector<RemovedItem> items(s_allocator_p);
+
+        ASSERT_EQ(container.remove(&items, keys), 1);
+        ASSERT_EQ(items.size(), keys.size());
+        ASSERT(items[0].d_isFound);
+        ASSERT_EQ(items[0].d_correlationId, bmqt::CorrelationId(3));
+        ASSERT(!items[0].d_batch_sp);
+        ASSERT_EQ(items[0].d_batchIndex, -1);
+        ASSERT(!items[1].d_isFound);
+        ASSERT(items[1].d_correlationId.isUnset());
+        ASSERT(items[2].d_isFound);
+        ASSERT_EQ(items[2].d_correlationId, bmqt::CorrelationId(1));
+        ASSERT_EQ(container.size(), 1U);
+
+        bmqt::CorrelationId corrId;
+        ASSERT_EQ(container.find(&corrId, guid2), 0);
+        ASSERT_EQ(corrId, bmqt::CorrelationId(2));
+    }
+
+    {
+        PVV("Remove an already removed batch");
+        bsl::vector<RemovedItem> items(s_allocator_p);
+
+        ASSERT_EQ(container.remove(&items, keys), 3);
+        ASSERT_EQ(items.size(), keys.size());
+        for (size_t i = 0; i < items.size(); ++i) {
+            ASSERT(!items[i].d_isFound);
+        }
+        ASSERT_EQ(container.size(), 1U);
+    }
+}
+
+static void test5_associateWithoutAck()
+{
+    mwctst::TestHelper::printTestName("ASSOCIATE WITHOUT ACK");
+
+    bmqimp::MessageCorrelationIdContainer container(s_allocator_p);
+
+    bmqt::MessageGUID guid = bmqp::MessageGUIDGenerator::testGUID();
+    bdlbb::PooledBlobBufferFactory bufferFactory(128, s_allocator_p);
+    bdlbb::Blob                    appData(&bufferFactory, s_allocator_p);
+
+    bmqp::PutHeader header;
+    header.setMessageGUID(guid).setQueueId(1);
+
+    // A PUT without the 'ACK_REQUESTED' flag is added by the association
+    container.associateMessageData(header, appData, bsls::TimeInterval());
+
+    ASSERT_EQ(container.size(), 1U);
+    ASSERT_EQ(container.numberOfPuts(), 1U);
+
+    bmqt::CorrelationId corrId(1);
+    ASSERT_EQ(container.find(&corrId, guid), 0);
+    ASSERT(corrId.isUnset());
+
+    ASSERT_EQ(container.remove(guid), 0);
+    ASSERT_EQ(container.size(), 0U);
+    ASSERT_EQ(container.numberOfPuts(), 0U);
+}
+
+static void test6_addPostBatch()
+{
+    mwctst::TestHelper::printTestName("ADD POST BATCH");
+
+    typedef bmqimp::MessageCorrelationIdContainer::RemovedItem RemovedItem;
+
+    const int                      k_NUM_MESSAGES = 3;
+    bdlbb::PooledBlobBufferFactory bufferFactory(128, s_allocator_p);
+    bmqp::PutEventBuilder          builder(&bufferFactory, s_allocator_p);
+    bmqimp::MessageCorrelationIdContainer container(s_allocator_p);
+
+    bsl::shared_ptr<bmqimp::Queue> queue =
+        bsl::allocate_shared<bmqimp::Queue>(s_allocator_p);
+    queue->setId(1);
+
+    bsl::shared_ptr<bmqimp::PostBatch> batch =
+        bsl::allocate_shared<bmqimp::PostBatch>(
+            s_allocator_p,
+            bmqimp::PostBatch::CompletionCallback());
+
+    bsl::vector<bmqt::MessageGUID> keys(s_allocator_p);
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        keys.push_back(bmqp::MessageGUIDGenerator::testGUID());
+
+        builder.startMessage();
+        builder.setMessagePayload("abc", 3)
+            .setMessageGUID(keys.back())
+            .setFlags(bmqp::PutHeaderFlags::e_ACK_REQUESTED);
+        ASSERT_EQ(builder.packMessage(queue->id()),
+                  bmqt::EventBuilderResult::e_SUCCESS);
+        batch->addMessage(queue);
+    }
+
+    bmqp::Event              event(&builder.blob(), s_allocator_p);
+    bmqp::PutMessageIterator putIter(&bufferFactory, s_allocator_p);
+    event.loadPutMessageIterator(&putIter);
+    ASSERT(putIter.isValid());
+
+    container.add(&putIter, batch);
+    ASSERT_EQ(container.size(), static_cast<size_t>(k_NUM_MESSAGES));
+
+    bmqt::CorrelationId corrId(1);
+    ASSERT_EQ(container.find(&corrId, keys[1]), 0);
+    ASSERT(corrId.isUnset());
+
+    // Remove the messages out of order
+    bsl::vector<bmqt::MessageGUID> toRemove(s_allocator_p);
+    toRemove.push_back(keys[2]);
+    toRemove.push_back(keys[0]);
+
+    bsl::vector<RemovedItem> items(s_allocator_p);
+    ASSERT_EQ(container.remove(&items, toRemove), 0);
+    ASSERT_EQ(items.size(), 2U);
+    ASSERT(items[0].d_isFound);
+    ASSERT_EQ(items[0].d_batch_sp, batch);
+    ASSERT_EQ(items[0].d_batchIndex, 2);
+    ASSERT(items[1].d_isFound);
+    ASSERT_EQ(items[1].d_batch_sp, batch);
+    ASSERT_EQ(items[1].d_batchIndex, 0);
+    ASSERT_EQ(container.size(), 1U);
+
+    container.reset();
+    ASSERT_EQ(container.size(), 0U);
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -223,6 +380,9 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 6: test6_addPostBatch(); break;
+    case 5: test5_associateWithoutAck(); break;
+    case 4: test4_batchRemove(); break;
     case 3: test3_associate(); break;
     case 2: test2_iterateAndInvoke(); break;
     case 1: test1_addFindRemove(); break;
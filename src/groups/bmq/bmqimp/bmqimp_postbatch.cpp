@@ -0,0 +1,191 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqimp_postbatch.cpp                                               -*-C++-*-
+#include <bmqimp_postbatch.h>
+
+#include <bmqscm_version.h>
+// BMQ
+#include <bmqimp_queue.h>
+
+// BDE
+#include <bsl_algorithm.h>
+#include <bslim_printer.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace bmqimp {
+
+// ---------------
+// class PostBatch
+// ---------------
+
+PostBatch::PostBatch(const CompletionCallback& callback,
+                     bslma::Allocator*         allocator)
+: d_callback(bsl::allocator_arg, allocator, callback)
+, d_runs(allocator)
+, d_results(allocator)
+, d_numMessages(0)
+, d_numAcknowledged(0)
+, d_numFailed(0)
+, d_spans(allocator)
+{
+    // NOTHING
+}
+
+bsls::Types::Int64 PostBatch::addMessage(const bsl::shared_ptr<Queue>& queue)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(queue);
+    BSLS_ASSERT_SAFE(d_numAcknowledged == 0);
+
+    const bsls::Types::Int64 sequenceNumber = queue->nextPutSequenceNumber();
+
+    // Extend the last run if the message directly follows it in the sequence
+    // of the same queue, which is the case unless messages of the queue are
+    // concurrently packed into another batch.
+    if (!d_runs.empty()) {
+        Run& last = d_runs.back();
+        if (last.d_queue == queue &&
+            last.d_firstSequenceNumber + last.d_length == sequenceNumber) {
+            ++last.d_length;
+            ++d_numMessages;
+            return sequenceNumber;  // RETURN
+        }
+    }
+
+    Run run;
+    run.d_queue               = queue;
+    run.d_firstSequenceNumber = sequenceNumber;
+    run.d_firstIndex          = d_numMessages;
+    run.d_length              = 1;
+    d_runs.push_back(run);
+    ++d_numMessages;
+
+    return sequenceNumber;
+}
+
+bool PostBatch::onAck(int index, bmqt::AckResult::Enum result)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= index && index < d_numMessages);
+    BSLS_ASSERT_SAFE(!isComplete());
+
+    // Locate the spans directly preceding and following 'index'
+    ResultsMap::iterator next = d_results.upper_bound(index);
+    ResultsMap::iterator prev = d_results.end();
+    if (next != d_results.begin()) {
+        prev = next;
+        --prev;
+    }
+    BSLS_ASSERT_SAFE(prev == d_results.end() || prev->second.first < index);
+
+    const bool mergePrev = prev != d_results.end() &&
+                           prev->second.first + 1 == index &&
+                           prev->second.second == result;
+    const bool mergeNext = next != d_results.end() &&
+                           next->first == index + 1 &&
+                           next->second.second == result;
+
+    if (mergePrev && mergeNext) {
+        prev->second.first = next->second.first;
+        d_results.erase(next);
+    }
+    else if (mergePrev) {
+        prev->second.first = index;
+    }
+    else if (mergeNext) {
+        const int last = next->second.first;
+        d_results.erase(next);
+        d_results.insert(bsl::make_pair(index, bsl::make_pair(last, result)));
+    }
+    else {
+        d_results.insert(
+            bsl::make_pair(index, bsl::make_pair(index, result)));
+    }
+
+    ++d_numAcknowledged;
+    if (result != bmqt::AckResult::e_SUCCESS) {
+        ++d_numFailed;
+    }
+
+    if (!isComplete()) {
+        return false;  // RETURN
+    }
+
+    // Translate the spans of indices into spans of sequence numbers: both the
+    // runs and the spans of results are ordered by index, so they are merged
+    // in a single pass.
+    bsl::vector<Run>::const_iterator runIt = d_runs.begin();
+    for (ResultsMap::const_iterator resIt = d_results.begin();
+         resIt != d_results.end();
+         ++resIt) {
+        int first = resIt->first;
+        while (first <= resIt->second.first) {
+            while (runIt->d_firstIndex + runIt->d_length <= first) {
+                ++runIt;
+                BSLS_ASSERT_SAFE(runIt != d_runs.end());
+            }
+
+            const int last = bsl::min(resIt->second.first,
+                                      runIt->d_firstIndex + runIt->d_length -
+                                          1);
+
+            Span span;
+            span.d_queue               = runIt->d_queue;
+            span.d_firstSequenceNumber = runIt->d_firstSequenceNumber +
+                                         (first - runIt->d_firstIndex);
+            span.d_lastSequenceNumber  = runIt->d_firstSequenceNumber +
+                                        (last - runIt->d_firstIndex);
+            span.d_result              = resIt->second.second;
+            d_spans.push_back(span);
+
+            first = last + 1;
+        }
+    }
+
+    return true;
+}
+
+bsls::Types::Int64 PostBatch::lastSequenceNumber() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!d_runs.empty());
+
+    const Run& last = d_runs.back();
+    return last.d_firstSequenceNumber + last.d_length - 1;
+}
+
+bsl::ostream&
+PostBatch::print(bsl::ostream& stream, int level, int spacesPerLevel) const
+{
+    if (stream.bad()) {
+        return stream;  // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    printer.printAttribute("numMessages", d_numMessages);
+    printer.printAttribute("numAcknowledged", d_numAcknowledged);
+    printer.printAttribute("numFailed", d_numFailed);
+    printer.printAttribute("numRuns", d_runs.size());
+    printer.printAttribute("numResultSpans", d_results.size());
+    printer.end();
+
+    return stream;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,289 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqimp_postbatch.h                                                 -*-C++-*-
+#ifndef INCLUDED_BMQIMP_POSTBATCH
+#define INCLUDED_BMQIMP_POSTBATCH
+
+//@PURPOSE: Provide a mechanism tracking the acknowledgments of a PUT batch.
+//
+//@CLASSES:
+//  bmqimp::PostBatch: acknowledgment tracker of the messages of a PUT event
+//
+//@DESCRIPTION: 'bmqimp::PostBatch' keeps track of the acknowledgments of all
+// the messages of a PUT event posted by the application, so that a single
+// completion callback can be invoked once all of them have been acknowledged,
+// instead of one ACK message being delivered per PUT message.
+//
+// Every message added to the batch is assigned the next PUT sequence number
+// of its queue (see 'bmqimp::Queue::nextPutSequenceNumber'), and is
+// identified inside the batch by its index, i.e. its position in the PUT
+// event.  Neither the messages nor their sequence numbers are stored
+// individually: the batch keeps runs of consecutive messages having
+// consecutive sequence numbers of the same queue, and the acknowledgment
+// results are kept as spans of consecutive messages having the same result.
+// The memory used by a batch is therefore proportional to the number of
+// such runs and spans, and not to the number of messages, in the common case
+// where a batch targets few queues and most of its messages are
+// acknowledged with the same result.
+//
+// Once all the messages have been acknowledged, 'spans' returns the results
+// as spans of consecutive sequence numbers of the same queue having the same
+// acknowledgment result.
+//
+/// Thread Safety
+///-------------
+// NOT Thread safe.  A batch is built by the thread packing the messages,
+// then updated by the thread processing the acknowledgments once the event
+// has been posted, and finally read by the thread invoking the completion
+// callback: each of these steps happens-before the next one.
+
+// BMQ
+
+#include <bmqt_resultcode.h>
+
+// BDE
+#include <bsl_functional.h>
+#include <bsl_map.h>
+#include <bsl_memory.h>
+#include <bsl_ostream.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_assert.h>
+#include <bsls_cpp11.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+
+namespace bmqimp {
+
+// FORWARD DECLARATION
+class Queue;
+
+// ===============
+// class PostBatch
+// ===============
+
+/// Mechanism tracking the acknowledgments of the messages of a PUT event.
+class PostBatch {
+  public:
+    // TYPES
+
+    /// Signature of the callback invoked with the batch once all of its
+    /// messages have been acknowledged.
+    typedef bsl::function<void(const bsl::shared_ptr<PostBatch>& batch)>
+        CompletionCallback;
+
+    /// Span of consecutive PUT sequence numbers of a queue whose messages
+    /// were acknowledged with the same result.
+    struct Span {
+        // DATA
+        bsl::shared_ptr<Queue> d_queue;
+        // Queue of the messages
+
+        bsls::Types::Int64 d_firstSequenceNumber;
+        // Sequence number of the first message
+
+        bsls::Types::Int64 d_lastSequenceNumber;
+        // Sequence number of the last message
+
+        bmqt::AckResult::Enum d_result;
+        // Acknowledgment result of the messages
+    };
+
+  private:
+    // PRIVATE TYPES
+
+    /// Run of consecutive messages of the batch having consecutive sequence
+    /// numbers of the same queue.
+    struct Run {
+        bsl::shared_ptr<Queue> d_queue;
+        // Queue of the messages
+
+        bsls::Types::Int64 d_firstSequenceNumber;
+        // Sequence number of the first message
+
+        int d_firstIndex;
+        // Index of the first message in the batch
+
+        int d_length;
+        // Number of messages
+    };
+
+    /// Map of the index of the first message of a span of acknowledged
+    /// messages having the same result, to the index of the last message of
+    /// the span and the result.
+    typedef bsl::map<int, bsl::pair<int, bmqt::AckResult::Enum> > ResultsMap;
+
+    // DATA
+    CompletionCallback d_callback;
+    // Callback to invoke upon completion
+
+    bsl::vector<Run> d_runs;
+    // Runs of the messages, ordered by index
+
+    ResultsMap d_results;
+    // Spans of acknowledged messages
+
+    int d_numMessages;
+    // Number of messages in the batch
+
+    int d_numAcknowledged;
+    // Number of acknowledged messages
+
+    int d_numFailed;
+    // Number of messages acknowledged with a
+    // result other than 'e_SUCCESS'
+
+    bsl::vector<Span> d_spans;
+    // Results per sequence number, built
+    // upon completion
+
+  private:
+    // NOT IMPLEMENTED
+    PostBatch(const PostBatch&) BSLS_CPP11_DELETED;
+    PostBatch& operator=(const PostBatch&) BSLS_CPP11_DELETED;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(PostBatch, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty `PostBatch` invoking the specified `callback` upon
+    /// completion, and using the specified `allocator` for memory
+    /// allocations.
+    PostBatch(const CompletionCallback& callback,
+              bslma::Allocator*         allocator);
+
+    // MANIPULATORS
+
+    /// Add a message destined to the specified `queue` to this batch, at
+    /// the index equal to the number of messages previously added, and
+    /// return the PUT sequence number assigned to the message.  The
+    /// behavior is undefined if any message has been acknowledged.
+    bsls::Types::Int64 addMessage(const bsl::shared_ptr<Queue>& queue);
+
+    /// Record that the message at the specified `index` was acknowledged
+    /// with the specified `result`, and return true if all the messages of
+    /// this batch are now acknowledged, false otherwise.  The behavior is
+    /// undefined unless `0 <= index < numMessages()`, or if the message at
+    /// `index` has already been acknowledged.
+    bool onAck(int index, bmqt::AckResult::Enum result);
+
+    // ACCESSORS
+
+    /// Return the callback to invoke upon completion of this batch.
+    const CompletionCallback& callback() const;
+
+    /// Return the number of messages in this batch.
+    int numMessages() const;
+
+    /// Return the number of messages of this batch which have been
+    /// acknowledged.
+    int numAcknowledged() const;
+
+    /// Return the number of messages of this batch which have been
+    /// acknowledged with a result other than `bmqt::AckResult::e_SUCCESS`.
+    int numFailed() const;
+
+    /// Return true if all the messages of this batch have been
+    /// acknowledged, false otherwise.
+    bool isComplete() const;
+
+    /// Return the sequence number assigned to the last message added to
+    /// this batch.  The behavior is undefined unless `numMessages() > 0`.
+    bsls::Types::Int64 lastSequenceNumber() const;
+
+    /// Return the acknowledgment results of the messages of this batch, as
+    /// spans of consecutive sequence numbers of the same queue having the
+    /// same result, in the order of the messages in the batch.  The
+    /// behavior is undefined unless `isComplete()` returns true.
+    const bsl::vector<Span>& spans() const;
+
+    /// Format this object to the specified output `stream` at the (absolute
+    /// value of) the optionally specified indentation `level` and return a
+    /// reference to `stream`.  If `level` is specified, optionally specify
+    /// `spacesPerLevel`, the number of spaces per indentation level for
+    /// this and all of its nested objects.  If `level` is negative,
+    /// suppress indentation of the first line.  If `spacesPerLevel` is
+    /// negative format the entire output on one line, suppressing all but
+    /// the initial indentation (as governed by `level`).  If `stream` is
+    /// not valid on entry, this operation has no effect.
+    bsl::ostream&
+    print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
+};
+
+// FREE OPERATORS
+
+/// Format the specified `rhs` to the specified output `stream` and return a
+/// reference to the modifiable `stream`.
+bsl::ostream& operator<<(bsl::ostream& stream, const PostBatch& rhs);
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ---------------
+// class PostBatch
+// ---------------
+
+inline const PostBatch::CompletionCallback& PostBatch::callback() const
+{
+    return d_callback;
+}
+
+inline int PostBatch::numMessages() const
+{
+    return d_numMessages;
+}
+
+inline int PostBatch::numAcknowledged() const
+{
+    return d_numAcknowledged;
+}
+
+inline int PostBatch::numFailed() const
+{
+    return d_numFailed;
+}
+
+inline bool PostBatch::isComplete() const
+{
+    return d_numAcknowledged == d_numMessages;
+}
+
+inline const bsl::vector<PostBatch::Span>& PostBatch::spans() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isComplete());
+
+    return d_spans;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline bsl::ostream& bmqimp::operator<<(bsl::ostream&            stream,
+                                        const bmqimp::PostBatch& rhs)
+{
+    return rhs.print(stream, 0, -1);
+}
+
+}  // close enterprise namespace
+
+#endif
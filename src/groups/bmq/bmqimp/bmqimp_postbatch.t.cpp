@@ -0,0 +1,210 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqimp_postbatch.t.cpp                                             -*-C++-*-
+#include <bmqimp_postbatch.h>
+
+// BMQ
+#include <bmqimp_queue.h>
+
+// BDE
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Completion callback recording the specified `batch` into the specified
+/// `completed`.
+void onCompletion(bsl::vector<bsl::shared_ptr<bmqimp::PostBatch> >* completed,
+                  const bsl::shared_ptr<bmqimp::PostBatch>&          batch)
+{
+    completed->push_back(batch);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    bsl::shared_ptr<bmqimp::Queue> queue =
+        bsl::allocate_shared<bmqimp::Queue>(s_allocator_p, s_allocator_p);
+
+    bmqimp::PostBatch obj(bmqimp::PostBatch::CompletionCallback(),
+                          s_allocator_p);
+    ASSERT_EQ(obj.numMessages(), 0);
+    ASSERT_EQ(obj.numAcknowledged(), 0);
+    ASSERT_EQ(obj.numFailed(), 0);
+    ASSERT(obj.isComplete());
+
+    // Sequence numbers of a queue start at 1
+    ASSERT_EQ(obj.addMessage(queue), 1);
+    ASSERT_EQ(obj.addMessage(queue), 2);
+    ASSERT_EQ(obj.numMessages(), 2);
+    ASSERT_EQ(obj.lastSequenceNumber(), 2);
+    ASSERT(!obj.isComplete());
+
+    ASSERT(!obj.onAck(1, bmqt::AckResult::e_SUCCESS));
+    ASSERT(obj.onAck(0, bmqt::AckResult::e_SUCCESS));
+    ASSERT(obj.isComplete());
+    ASSERT_EQ(obj.numAcknowledged(), 2);
+    ASSERT_EQ(obj.numFailed(), 0);
+
+    ASSERT_EQ(obj.spans().size(), 1U);
+    ASSERT_EQ(obj.spans()[0].d_queue, queue);
+    ASSERT_EQ(obj.spans()[0].d_firstSequenceNumber, 1);
+    ASSERT_EQ(obj.spans()[0].d_lastSequenceNumber, 2);
+    ASSERT_EQ(obj.spans()[0].d_result, bmqt::AckResult::e_SUCCESS);
+
+    PV(obj);
+}
+
+static void test2_spans()
+{
+    mwctst::TestHelper::printTestName("SPANS");
+
+    bsl::shared_ptr<bmqimp::Queue> queue1 =
+        bsl::allocate_shared<bmqimp::Queue>(s_allocator_p, s_allocator_p);
+    bsl::shared_ptr<bmqimp::Queue> queue2 =
+        bsl::allocate_shared<bmqimp::Queue>(s_allocator_p, s_allocator_p);
+
+    // Consume one sequence number of 'queue1' outside of the batch, as if it
+    // was packed into another batch.
+    ASSERT_EQ(queue1->nextPutSequenceNumber(), 1);
+
+    bmqimp::PostBatch obj(bmqimp::PostBatch::CompletionCallback(),
+                          s_allocator_p);
+
+    // Index:     0  1  2  3  4  5
+    // Queue:     1  1  1  1  2  2
+    // Sequence:  2  3  4  6  1  2
+    ASSERT_EQ(obj.addMessage(queue1), 2);
+    ASSERT_EQ(obj.addMessage(queue1), 3);
+    ASSERT_EQ(obj.addMessage(queue1), 4);
+    ASSERT_EQ(queue1->nextPutSequenceNumber(), 5);
+    ASSERT_EQ(obj.addMessage(queue1), 6);
+    ASSERT_EQ(obj.addMessage(queue2), 1);
+    ASSERT_EQ(obj.addMessage(queue2), 2);
+    ASSERT_EQ(obj.numMessages(), 6);
+    ASSERT_EQ(obj.lastSequenceNumber(), 2);
+
+    // Acknowledge out of order, message 1 failing, so that the spans of
+    // results merge with both of their neighbours.
+    ASSERT(!obj.onAck(5, bmqt::AckResult::e_SUCCESS));
+    ASSERT(!obj.onAck(0, bmqt::AckResult::e_SUCCESS));
+    ASSERT(!obj.onAck(4, bmqt::AckResult::e_SUCCESS));
+    ASSERT(!obj.onAck(2, bmqt::AckResult::e_SUCCESS));
+    ASSERT(!obj.onAck(1, bmqt::AckResult::e_LIMIT_MESSAGES));
+    ASSERT(obj.onAck(3, bmqt::AckResult::e_SUCCESS));
+
+    ASSERT_EQ(obj.numAcknowledged(), 6);
+    ASSERT_EQ(obj.numFailed(), 1);
+
+    // Messages 2 to 5 are all successful, but their sequence numbers are not
+    // consecutive across 4 and 6, nor across queues.
+    struct Expected {
+        int                   d_queue;
+        bsls::Types::Int64    d_first;
+        bsls::Types::Int64    d_last;
+        bmqt::AckResult::Enum d_result;
+    } k_EXPECTED[] = {{1, 2, 2, bmqt::AckResult::e_SUCCESS},
+                      {1, 3, 3, bmqt::AckResult::e_LIMIT_MESSAGES},
+                      {1, 4, 4, bmqt::AckResult::e_SUCCESS},
+                      {1, 6, 6, bmqt::AckResult::e_SUCCESS},
+                      {2, 1, 2, bmqt::AckResult::e_SUCCESS}};
+    const size_t k_NUM_EXPECTED = sizeof(k_EXPECTED) / sizeof(*k_EXPECTED);
+
+    const bsl::vector<bmqimp::PostBatch::Span>& spans = obj.spans();
+    ASSERT_EQ(spans.size(), k_NUM_EXPECTED);
+
+    for (size_t i = 0; i < spans.size() && i < k_NUM_EXPECTED; ++i) {
+        PVV(i << ": " << spans[i].d_firstSequenceNumber << "-"
+              << spans[i].d_lastSequenceNumber);
+
+        const Expected& expected = k_EXPECTED[i];
+        ASSERT_EQ(spans[i].d_queue, expected.d_queue == 1 ? queue1 : queue2);
+        ASSERT_EQ(spans[i].d_firstSequenceNumber, expected.d_first);
+        ASSERT_EQ(spans[i].d_lastSequenceNumber, expected.d_last);
+        ASSERT_EQ(spans[i].d_result, expected.d_result);
+    }
+}
+
+static void test3_completionCallback()
+{
+    mwctst::TestHelper::printTestName("COMPLETION CALLBACK");
+
+    bsl::vector<bsl::shared_ptr<bmqimp::PostBatch> > completed(
+        s_allocator_p);
+
+    bsl::shared_ptr<bmqimp::Queue> queue =
+        bsl::allocate_shared<bmqimp::Queue>(s_allocator_p, s_allocator_p);
+
+    bsl::shared_ptr<bmqimp::PostBatch> obj =
+        bsl::allocate_shared<bmqimp::PostBatch>(
+            s_allocator_p,
+            bdlf::BindUtil::bind(&onCompletion,
+                                 &completed,
+                                 bdlf::PlaceHolders::_1),  // batch
+            s_allocator_p);
+
+    ASSERT(obj->callback());
+
+    obj->addMessage(queue);
+    ASSERT(obj->onAck(0, bmqt::AckResult::e_TIMEOUT));
+
+    obj->callback()(obj);
+    ASSERT_EQ(completed.size(), 1U);
+    ASSERT_EQ(completed[0], obj);
+    ASSERT_EQ(completed[0]->numFailed(), 1);
+    ASSERT_EQ(completed[0]->spans()[0].d_result, bmqt::AckResult::e_TIMEOUT);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_completionCallback(); break;
+    case 2: test2_spans(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
@@ -0,0 +1,317 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqimp_putbatcher.cpp                                              -*-C++-*-
+#include <bmqimp_putbatcher.h>
+
+#include <bmqscm_version.h>
+// BMQ
+#include <bmqp_protocol.h>
+
+// MWC
+#include <mwcst_statcontext.h>
+#include <mwcst_statutil.h>
+#include <mwcu_blobobjectproxy.h>
+
+// BDE
+#include <bdlbb_blobutil.h>
+#include <bdlma_localsequentialallocator.h>
+#include <bsl_algorithm.h>
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+
+namespace BloombergLP {
+namespace bmqimp {
+
+namespace {
+/// Name of the stat context to create (holding all batching statistics)
+const char k_STAT_NAME[] = "putBatches";
+
+enum {
+    k_STAT_SIZE = 0  // number of messages per flushed batch
+    ,
+    k_STAT_EVENTS = 1  // number of coalesced events per flushed batch
+    ,
+    k_STAT_LATENCY = 2  // latency (ns) added to the oldest message
+};
+}  // close unnamed namespace
+
+// ----------------
+// class PutBatcher
+// ----------------
+
+PutBatcher::PutBatcher(bdlbb::BlobBufferFactory* bufferFactory,
+                       bslma::Allocator*         allocator)
+: d_bufferFactory_p(bufferFactory)
+, d_batch(allocator)
+, d_numMessages(0)
+, d_numEvents(0)
+, d_firstAppendTime(0)
+, d_latencyBudget(0)
+, d_maxMessages(1)
+, d_maxBytes(bmqp::EventHeader::k_MAX_SIZE_SOFT)
+, d_stat(allocator)
+, d_allocator_p(allocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(bufferFactory);
+}
+
+void PutBatcher::configure(const bsls::TimeInterval& latencyBudget,
+                           int                       maxMessages,
+                           int                       maxBytes)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(isEmpty());
+    BSLS_ASSERT_OPT(latencyBudget >= bsls::TimeInterval(0));
+    BSLS_ASSERT_OPT(maxMessages > 0);
+    BSLS_ASSERT_OPT(maxBytes > 0);
+
+    d_latencyBudget = latencyBudget;
+    d_maxMessages   = maxMessages;
+    d_maxBytes      = bsl::min(maxBytes,
+                          static_cast<int>(bmqp::EventHeader::k_MAX_SIZE_SOFT));
+}
+
+void PutBatcher::initializeStats(
+    mwcst::StatContext*                       rootStatContext,
+    const mwcst::StatValue::SnapshotLocation& start,
+    const mwcst::StatValue::SnapshotLocation& end)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(!d_stat.d_statContext_mp && "Stats already initialized");
+
+    bdlma::LocalSequentialAllocator<2048> localAllocator(d_allocator_p);
+
+    // Create the stat context
+    // -----------------------
+    mwcst::StatContextConfiguration config(k_STAT_NAME, &localAllocator);
+    config.value("size", mwcst::StatValue::DMCST_DISCRETE)
+        .value("events", mwcst::StatValue::DMCST_DISCRETE)
+        .value("latency", mwcst::StatValue::DMCST_DISCRETE);
+    d_stat.d_statContext_mp = rootStatContext->addSubcontext(config);
+
+    // Create table (with Delta stats)
+    // -------------------------------
+    mwcst::TableSchema& schema = d_stat.d_table.schema();
+    schema.addColumn("batches_delta",
+                     k_STAT_SIZE,
+                     mwcst::StatUtil::eventsDifference,
+                     start,
+                     end);
+    schema.addColumn("messages_delta",
+                     k_STAT_SIZE,
+                     mwcst::StatUtil::sumDifference,
+                     start,
+                     end);
+    schema.addColumn("events_delta",
+                     k_STAT_EVENTS,
+                     mwcst::StatUtil::sumDifference,
+                     start,
+                     end);
+    schema.addColumn("size_avg",
+                     k_STAT_SIZE,
+                     mwcst::StatUtil::averagePerEvent,
+                     start,
+                     end);
+    schema.addColumn("size_max",
+                     k_STAT_SIZE,
+                     mwcst::StatUtil::rangeMax,
+                     start,
+                     end);
+    schema.addColumn("latency_avg",
+                     k_STAT_LATENCY,
+                     mwcst::StatUtil::averagePerEvent,
+                     start,
+                     end);
+    schema.addColumn("latency_max",
+                     k_STAT_LATENCY,
+                     mwcst::StatUtil::rangeMax,
+                     start,
+                     end);
+    schema.addColumn("latency_absmax",
+                     k_STAT_LATENCY,
+                     mwcst::StatUtil::absoluteMax);
+
+    // Configure records
+    d_stat.d_table.records().setContext(d_stat.d_statContext_mp.get());
+
+    // Create the tip
+    d_stat.d_tip.setTable(&d_stat.d_table);
+    d_stat.d_tip.setColumnGroup("Batches");
+    d_stat.d_tip.addColumn("batches_delta", "batches (delta)")
+        .zeroString("");
+    d_stat.d_tip.addColumn("events_delta", "events (delta)").zeroString("");
+    d_stat.d_tip.addColumn("messages_delta", "messages (delta)")
+        .zeroString("");
+
+    d_stat.d_tip.setColumnGroup("Batch Size");
+    d_stat.d_tip.addColumn("size_avg", "Avg").extremeValueString("");
+    d_stat.d_tip.addColumn("size_max", "Max").extremeValueString("");
+
+    d_stat.d_tip.setColumnGroup("Added Latency");
+    d_stat.d_tip.addColumn("latency_avg", "Avg")
+        .printAsNsTimeInterval()
+        .extremeValueString("");
+    d_stat.d_tip.addColumn("latency_max", "Max")
+        .printAsNsTimeInterval()
+        .extremeValueString("");
+    d_stat.d_tip.addColumn("latency_absmax", "Abs. Max")
+        .printAsNsTimeInterval()
+        .extremeValueString("");
+
+    // Create the table (without Delta stats)
+    // --------------------------------------
+    // We always use current snapshot for this
+    mwcst::StatValue::SnapshotLocation loc(0, 0);
+
+    mwcst::TableSchema& schemaNoDelta = d_stat.d_tableNoDelta.schema();
+    schemaNoDelta.addColumn("batches",
+                            k_STAT_SIZE,
+                            mwcst::StatUtil::events,
+                            loc);
+    schemaNoDelta.addColumn("messages",
+                            k_STAT_SIZE,
+                            mwcst::StatUtil::sum,
+                            loc);
+    schemaNoDelta.addColumn("events", k_STAT_EVENTS, mwcst::StatUtil::sum, loc);
+    schemaNoDelta.addColumn("latency_absmax",
+                            k_STAT_LATENCY,
+                            mwcst::StatUtil::absoluteMax);
+
+    // Configure records
+    d_stat.d_tableNoDelta.records().setContext(d_stat.d_statContext_mp.get());
+
+    // Create the tip
+    d_stat.d_tipNoDelta.setTable(&d_stat.d_tableNoDelta);
+    d_stat.d_tipNoDelta.setColumnGroup("Batches");
+    d_stat.d_tipNoDelta.addColumn("batches", "batches").zeroString("");
+    d_stat.d_tipNoDelta.addColumn("events", "events").zeroString("");
+    d_stat.d_tipNoDelta.addColumn("messages", "messages").zeroString("");
+
+    d_stat.d_tipNoDelta.setColumnGroup("Added Latency");
+    d_stat.d_tipNoDelta.addColumn("latency_absmax", "Abs. Max")
+        .printAsNsTimeInterval()
+        .extremeValueString("");
+}
+
+void PutBatcher::resetStats()
+{
+    if (d_stat.d_statContext_mp) {
+        d_stat.d_statContext_mp->clearValues();
+    }
+}
+
+void PutBatcher::append(const bdlbb::Blob&        event,
+                        int                       numMessages,
+                        const bsls::TimeInterval& now)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(numMessages > 0);
+    BSLS_ASSERT_SAFE(canAppend(event.length(), numMessages));
+
+    // Skip the EventHeader of the appended event, supporting protocol
+    // evolution by honoring the header size it declares.
+    mwcu::BlobObjectProxy<bmqp::EventHeader> header(
+        &event,
+        -bmqp::EventHeader::k_MIN_HEADER_SIZE,
+        true,    // read
+        false);  // write
+    BSLS_ASSERT_SAFE(header.isSet());
+    BSLS_ASSERT_SAFE(header->type() == bmqp::EventType::e_PUT);
+
+    const int headerSize = header->headerWords() *
+                           bmqp::Protocol::k_WORD_SIZE;
+    BSLS_ASSERT_SAFE(headerSize <= event.length());
+
+    if (isEmpty()) {
+        d_firstAppendTime = now;
+    }
+
+    // Share the buffers of 'event', without copying the messages
+    bdlbb::BlobUtil::append(&d_batch,
+                            event,
+                            headerSize,
+                            event.length() - headerSize);
+
+    d_numMessages += numMessages;
+    ++d_numEvents;
+}
+
+void PutBatcher::flush(bdlbb::Blob* event, const bsls::TimeInterval& now)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(event);
+    BSLS_ASSERT_SAFE(!isEmpty());
+
+    // Write the EventHeader of the batch in a dedicated buffer, followed by
+    // the (shared) buffers of the coalesced messages.
+    event->removeAll();
+
+    bdlbb::BlobBuffer headerBuffer;
+    d_bufferFactory_p->allocate(&headerBuffer);
+    BSLS_ASSERT_SAFE(headerBuffer.size() >=
+                     static_cast<int>(sizeof(bmqp::EventHeader)));
+    headerBuffer.setSize(sizeof(bmqp::EventHeader));
+
+    bmqp::EventHeader* header = new (headerBuffer.data())
+        bmqp::EventHeader(bmqp::EventType::e_PUT);
+    header->setLength(sizeof(bmqp::EventHeader) + d_batch.length());
+
+    event->appendDataBuffer(headerBuffer);
+    bdlbb::BlobUtil::append(event, d_batch);
+
+    if (d_stat.d_statContext_mp) {
+        d_stat.d_statContext_mp->reportValue(k_STAT_SIZE, d_numMessages);
+        d_stat.d_statContext_mp->reportValue(k_STAT_EVENTS, d_numEvents);
+        d_stat.d_statContext_mp->reportValue(
+            k_STAT_LATENCY,
+            (now - d_firstAppendTime).totalNanoseconds());
+    }
+
+    reset();
+}
+
+void PutBatcher::reset()
+{
+    d_batch.removeAll();
+    d_numMessages     = 0;
+    d_numEvents       = 0;
+    d_firstAppendTime = bsls::TimeInterval(0);
+}
+
+bool PutBatcher::isFull() const
+{
+    return d_numMessages >= d_maxMessages ||
+           static_cast<int>(sizeof(bmqp::EventHeader)) + d_batch.length() >=
+               d_maxBytes;
+}
+
+bool PutBatcher::canAppend(int eventLength, int numMessages) const
+{
+    if (isEmpty()) {
+        return true;  // RETURN
+    }
+
+    // 'eventLength' includes the header of the appended event, which will be
+    // dropped: this is a conservative check.
+    return d_numMessages + numMessages <= d_maxMessages &&
+           static_cast<int>(sizeof(bmqp::EventHeader)) + d_batch.length() +
+                   eventLength <=
+               d_maxBytes;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,258 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqimp_putbatcher.h                                                -*-C++-*-
+#ifndef INCLUDED_BMQIMP_PUTBATCHER
+#define INCLUDED_BMQIMP_PUTBATCHER
+
+//@PURPOSE: Provide a mechanism to coalesce PUT events into a single event.
+//
+//@CLASSES:
+//  bmqimp::PutBatcher: mechanism to coalesce PUT events
+//
+//@DESCRIPTION: 'bmqimp::PutBatcher' accumulates the messages of multiple PUT
+// events (each one typically built and posted by the application) into a
+// single PUT event, so that they can be written to the broker with a single
+// channel write.  The messages of an appended event are not copied: the
+// batch shares the blob buffers of the appended events, and only a new
+// 'bmqp::EventHeader' is written when the batch is flushed.
+//
+// The batcher is configured with a latency budget, as well as a maximum
+// number of messages and a maximum number of bytes per batch.  It does not
+// own any timer: the user is responsible for flushing the batch when
+// 'isFull' returns true, or once the time returned by 'deadline' is reached.
+// A latency budget of zero disables batching ('isEnabled' returns false).
+//
+/// Statistics
+///----------
+// Once 'initializeStats' has been called, every flushed batch reports the
+// number of messages and of coalesced events it contains, as well as the
+// latency that was added to its oldest message (i.e., the time elapsed
+// between the first 'append' and the 'flush').
+//
+/// Thread Safety
+///-------------
+// NOT Thread safe.
+
+// BMQ
+
+#include <bmqimp_stat.h>
+
+// MWC
+#include <mwcst_statvalue.h>
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bsl_ostream.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_assert.h>
+#include <bsls_cpp11.h>
+#include <bsls_timeinterval.h>
+
+namespace BloombergLP {
+
+// FORWARD DECLARATION
+namespace mwcst {
+class StatContext;
+}
+
+namespace bmqimp {
+
+// ================
+// class PutBatcher
+// ================
+
+/// Mechanism to coalesce PUT events into a single PUT event.
+class PutBatcher {
+  private:
+    // DATA
+    bdlbb::BlobBufferFactory* d_bufferFactory_p;
+    // Buffer factory to use for the event
+    // header of the batch
+
+    bdlbb::Blob d_batch;
+    // Messages of the pending batch,
+    // without any event header
+
+    int d_numMessages;
+    // Number of messages in the pending
+    // batch
+
+    int d_numEvents;
+    // Number of events coalesced in the
+    // pending batch
+
+    bsls::TimeInterval d_firstAppendTime;
+    // Time at which the first event of the
+    // pending batch was appended
+
+    bsls::TimeInterval d_latencyBudget;
+    // Maximum time the first event of a
+    // batch may be held back
+
+    int d_maxMessages;
+    // Maximum number of messages per batch
+
+    int d_maxBytes;
+    // Maximum size, in bytes, of a batch
+    // (including the event header)
+
+    Stat d_stat;
+    // Stat holder
+
+    bslma::Allocator* d_allocator_p;
+    // Allocator to use
+
+  private:
+    // NOT IMPLEMENTED
+    PutBatcher(const PutBatcher&) BSLS_CPP11_DELETED;
+    PutBatcher& operator=(const PutBatcher&) BSLS_CPP11_DELETED;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(PutBatcher, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a disabled `PutBatcher` using the specified `bufferFactory`
+    /// to allocate the event header of the batches, and the specified
+    /// `allocator` for memory allocations.
+    PutBatcher(bdlbb::BlobBufferFactory* bufferFactory,
+               bslma::Allocator*         allocator);
+
+    // MANIPULATORS
+
+    /// Configure this object with the specified `latencyBudget`,
+    /// `maxMessages` and `maxBytes` thresholds.  A zero `latencyBudget`
+    /// disables batching.  The behavior is undefined unless this object is
+    /// empty, `latencyBudget` is non-negative, and `maxMessages` and
+    /// `maxBytes` are positive.
+    void configure(const bsls::TimeInterval& latencyBudget,
+                   int                       maxMessages,
+                   int                       maxBytes);
+
+    /// Create the stat context, table and tips for the batching statistics
+    /// as a subcontext of the specified `rootStatContext`.  Delta stats
+    /// correspond to stats between the specified `start` and `end`
+    /// snapshot locations.  The behavior is undefined if this method is
+    /// called more than once on the same object.
+    void initializeStats(mwcst::StatContext* rootStatContext,
+                         const mwcst::StatValue::SnapshotLocation& start,
+                         const mwcst::StatValue::SnapshotLocation& end);
+
+    /// Reset all statistics (used when restarting the session).
+    void resetStats();
+
+    /// Append the messages of the specified PUT `event`, containing the
+    /// specified `numMessages` messages, to the pending batch, using the
+    /// specified `now` as the time of the append.  The behavior is
+    /// undefined unless `event` is a valid PUT event and `canAppend`
+    /// returns true for it.
+    void append(const bdlbb::Blob&        event,
+                int                       numMessages,
+                const bsls::TimeInterval& now);
+
+    /// Load into the specified `event` a PUT event containing all the
+    /// messages of the pending batch, and reset the batch to empty.  Use
+    /// the specified `now` to compute the latency added to the batch.  The
+    /// behavior is undefined if this object is empty.
+    void flush(bdlbb::Blob* event, const bsls::TimeInterval& now);
+
+    /// Discard the pending batch, if any.
+    void reset();
+
+    // ACCESSORS
+
+    /// Return true if batching is enabled, i.e. if a non zero latency
+    /// budget has been configured.
+    bool isEnabled() const;
+
+    /// Return true if there is no pending batch.
+    bool isEmpty() const;
+
+    /// Return true if the pending batch reached either the maximum number
+    /// of messages or the maximum number of bytes.
+    bool isFull() const;
+
+    /// Return true if a PUT event of the specified `eventLength` bytes and
+    /// containing the specified `numMessages` messages can be appended to
+    /// the pending batch without exceeding the configured thresholds.  Note
+    /// that an event can always be appended to an empty batch.
+    bool canAppend(int eventLength, int numMessages) const;
+
+    /// Return the time by which the pending batch must be flushed to honor
+    /// the latency budget.  The behavior is undefined if this object is
+    /// empty.
+    bsls::TimeInterval deadline() const;
+
+    /// Return the number of messages in the pending batch.
+    int numMessages() const;
+
+    /// Return the number of events coalesced in the pending batch.
+    int numEvents() const;
+
+    /// Print the stats to the specified `stream`; print the `delta` stats
+    /// column if the specified `includeDelta` is true.
+    void printStats(bsl::ostream& stream, bool includeDelta) const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ----------------
+// class PutBatcher
+// ----------------
+
+inline bool PutBatcher::isEnabled() const
+{
+    return d_latencyBudget != bsls::TimeInterval(0);
+}
+
+inline bool PutBatcher::isEmpty() const
+{
+    return d_numEvents == 0;
+}
+
+inline bsls::TimeInterval PutBatcher::deadline() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!isEmpty());
+
+    return d_firstAppendTime + d_latencyBudget;
+}
+
+inline int PutBatcher::numMessages() const
+{
+    return d_numMessages;
+}
+
+inline int PutBatcher::numEvents() const
+{
+    return d_numEvents;
+}
+
+inline void PutBatcher::printStats(bsl::ostream& stream,
+                                   bool          includeDelta) const
+{
+    d_stat.printStats(stream, includeDelta);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,267 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqimp_putbatcher.t.cpp                                            -*-C++-*-
+#include <bmqimp_putbatcher.h>
+
+// BMQ
+#include <bmqp_event.h>
+#include <bmqp_messageguidgenerator.h>
+#include <bmqp_protocol.h>
+#include <bmqp_protocolutil.h>
+#include <bmqp_putmessageiterator.h>
+#include <bmqp_puteventbuilder.h>
+#include <bmqt_messageguid.h>
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bsl_cstring.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bsls_timeinterval.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Load into the specified `event` a PUT event built with the specified
+/// `builder` and containing one message per element of the specified
+/// `payloads`, all posted to the specified `queueId`.  Append the GUID of
+/// each message to the specified `guids`.
+void buildPutEvent(bdlbb::Blob*                    event,
+                   bsl::vector<bmqt::MessageGUID>* guids,
+                   bmqp::PutEventBuilder*          builder,
+                   const bsl::vector<bsl::string>& payloads,
+                   int                             queueId)
+{
+    builder->reset();
+    for (size_t i = 0; i < payloads.size(); ++i) {
+        const bmqt::MessageGUID guid = bmqp::MessageGUIDGenerator::testGUID();
+        builder->startMessage();
+        builder->setMessageGUID(guid).setMessagePayload(
+            payloads[i].data(),
+            static_cast<int>(payloads[i].length()));
+        BSLS_ASSERT_OPT(builder->packMessage(queueId) ==
+                        bmqt::EventBuilderResult::e_SUCCESS);
+        guids->push_back(guid);
+    }
+    *event = builder->blob();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    bmqimp::PutBatcher             obj(&bufferFactory, s_allocator_p);
+
+    ASSERT(!obj.isEnabled());
+    ASSERT(obj.isEmpty());
+    ASSERT_EQ(obj.numMessages(), 0);
+    ASSERT_EQ(obj.numEvents(), 0);
+
+    obj.configure(bsls::TimeInterval(0, 100 * 1000), 10, 64 * 1024);
+    ASSERT(obj.isEnabled());
+    ASSERT(obj.isEmpty());
+    ASSERT(!obj.isFull());
+
+    obj.configure(bsls::TimeInterval(0), 10, 64 * 1024);
+    ASSERT(!obj.isEnabled());
+}
+
+static void test2_appendAndFlush()
+{
+    mwctst::TestHelper::printTestName("APPEND AND FLUSH");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    bmqp::PutEventBuilder          builder(&bufferFactory, s_allocator_p);
+    bmqimp::PutBatcher             obj(&bufferFactory, s_allocator_p);
+
+    const bsls::TimeInterval latencyBudget(0, 100 * 1000);
+    obj.configure(latencyBudget, 100, 64 * 1024);
+
+    bsl::vector<bmqt::MessageGUID> guids(s_allocator_p);
+    bsl::vector<bsl::string>       payloads(s_allocator_p);
+
+    // First event: 2 messages on queue 1
+    payloads.push_back("abcdef");
+    payloads.push_back("0123456789");
+    bdlbb::Blob event1(s_allocator_p);
+    buildPutEvent(&event1, &guids, &builder, payloads, 1);
+
+    // Second event: 1 message on queue 2
+    payloads.clear();
+    payloads.push_back("xyz");
+    bdlbb::Blob event2(s_allocator_p);
+    buildPutEvent(&event2, &guids, &builder, payloads, 2);
+
+    const bsls::TimeInterval t0(10, 0);
+
+    ASSERT(obj.canAppend(event1.length(), 2));
+    obj.append(event1, 2, t0);
+    ASSERT(!obj.isEmpty());
+    ASSERT_EQ(obj.deadline(), t0 + latencyBudget);
+
+    ASSERT(obj.canAppend(event2.length(), 1));
+    obj.append(event2, 1, t0 + bsls::TimeInterval(0, 1000));
+    ASSERT_EQ(obj.numMessages(), 3);
+    ASSERT_EQ(obj.numEvents(), 2);
+    ASSERT(!obj.isFull());
+
+    // The deadline is driven by the first appended event
+    ASSERT_EQ(obj.deadline(), t0 + latencyBudget);
+
+    bdlbb::Blob batch(s_allocator_p);
+    obj.flush(&batch, t0 + bsls::TimeInterval(0, 5000));
+    ASSERT(obj.isEmpty());
+    ASSERT_EQ(obj.numMessages(), 0);
+    ASSERT_EQ(obj.numEvents(), 0);
+
+    // The batch is a single valid PUT event containing all the messages, in
+    // order.
+    const int headerSize = static_cast<int>(sizeof(bmqp::EventHeader));
+    ASSERT_EQ(batch.length(),
+              event1.length() + event2.length() - headerSize);
+
+    bmqp::Event rawEvent(&batch, s_allocator_p);
+    ASSERT(rawEvent.isValid());
+    ASSERT(rawEvent.isPutEvent());
+
+    bmqp::PutMessageIterator putIter(&bufferFactory, s_allocator_p);
+    rawEvent.loadPutMessageIterator(&putIter);
+    ASSERT(putIter.isValid());
+
+    const char* expected[] = {"abcdef", "0123456789", "xyz"};
+    const int   queueIds[] = {1, 1, 2};
+
+    size_t i = 0;
+    while (putIter.next() == 1) {
+        ASSERT_LT(i, guids.size());
+        ASSERT_EQ(putIter.header().messageGUID(), guids[i]);
+        ASSERT_EQ(putIter.header().queueId(), queueIds[i]);
+
+        bdlbb::Blob payload(s_allocator_p);
+        bdlbb::Blob expectedPayload(&bufferFactory, s_allocator_p);
+        bdlbb::BlobUtil::append(&expectedPayload,
+                                expected[i],
+                                static_cast<int>(bsl::strlen(expected[i])));
+        ASSERT_EQ(putIter.loadApplicationData(&payload), 0);
+        ASSERT_EQ(bdlbb::BlobUtil::compare(payload, expectedPayload), 0);
+        ++i;
+    }
+    ASSERT_EQ(i, guids.size());
+}
+
+static void test3_thresholds()
+{
+    mwctst::TestHelper::printTestName("THRESHOLDS");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    bmqp::PutEventBuilder          builder(&bufferFactory, s_allocator_p);
+    bmqimp::PutBatcher             obj(&bufferFactory, s_allocator_p);
+
+    bsl::vector<bmqt::MessageGUID> guids(s_allocator_p);
+    bsl::vector<bsl::string>       payloads(s_allocator_p);
+    payloads.push_back(bsl::string(100, 'a', s_allocator_p));
+
+    bdlbb::Blob event(s_allocator_p);
+    buildPutEvent(&event, &guids, &builder, payloads, 1);
+
+    const bsls::TimeInterval now(1, 0);
+
+    {
+        PVV("Maximum number of messages");
+        obj.configure(bsls::TimeInterval(1), 2, 64 * 1024);
+
+        obj.append(event, 1, now);
+        ASSERT(!obj.isFull());
+        ASSERT(obj.canAppend(event.length(), 1));
+        ASSERT(!obj.canAppend(event.length(), 2));
+
+        obj.append(event, 1, now);
+        ASSERT(obj.isFull());
+        ASSERT(!obj.canAppend(event.length(), 1));
+
+        obj.reset();
+        ASSERT(obj.isEmpty());
+    }
+
+    {
+        PVV("Maximum number of bytes");
+        obj.configure(bsls::TimeInterval(1), 100, 2 * event.length());
+
+        obj.append(event, 1, now);
+        ASSERT(!obj.isFull());
+        ASSERT(obj.canAppend(event.length(), 1));
+
+        obj.append(event, 1, now);
+        ASSERT(!obj.canAppend(event.length(), 1));
+
+        obj.reset();
+    }
+
+    {
+        PVV("Oversized event is accepted by an empty batch");
+        obj.configure(bsls::TimeInterval(1), 100, event.length() / 2);
+
+        ASSERT(obj.canAppend(event.length(), 1));
+        obj.append(event, 1, now);
+        ASSERT(obj.isFull());
+
+        obj.reset();
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    bmqp::ProtocolUtil::initialize(s_allocator_p);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_thresholds(); break;
+    case 2: test2_appendAndFlush(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    bmqp::ProtocolUtil::shutdown();
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
@@ -321,6 +321,7 @@ Queue::Queue(bslma::Allocator* allocator)
 , d_isSuspended(false)
 , d_isOldStyle(true)
 , d_isSuspendedWithBroker(false)
+, d_putSequenceNumber(0)
 , d_schemaGenerator(allocator)
 , d_schemaLearner(allocator)
 , d_schemaLearnerContext(d_schemaLearner.createContext())
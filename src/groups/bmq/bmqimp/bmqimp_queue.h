@@ -254,6 +254,11 @@ class Queue {
     // Whether the queue is suspended from
     // the perspective of the broker.
 
+    bsls::AtomicInt64 d_putSequenceNumber;
+    // Sequence number of the last PUT
+    // message packed in a post batch for
+    // this queue.
+
     bmqp::SchemaGenerator d_schemaGenerator;
 
     bmqp::SchemaLearner d_schemaLearner;
@@ -324,6 +329,12 @@ class Queue {
     /// undefined it this method is called more than once.
     void registerStatContext(mwcst::StatContext* parentStatContext);
 
+    /// Return the next sequence number of a PUT message packed in a post
+    /// batch for this queue.  The sequence numbers are monotonically
+    /// increasing, starting at 1.  Note that this method is thread-safe
+    /// and lock-free.
+    bsls::Types::Int64 nextPutSequenceNumber();
+
     /// Update the stats of this queue by reporting a new message of the
     /// specified `size` was received (if the specified `isOut` is false) or
     /// sent (if `isOut` is true).
@@ -531,6 +542,11 @@ inline Queue& Queue::setIsSuspended(bool value)
     return *this;
 }
 
+inline bsls::Types::Int64 Queue::nextPutSequenceNumber()
+{
+    return d_putSequenceNumber.addRelaxed(1);
+}
+
 inline Queue& Queue::setOldStyle(bool value)
 {
     if (!value) {
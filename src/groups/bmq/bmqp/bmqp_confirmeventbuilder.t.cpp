@@ -35,6 +35,11 @@
 #include <bsl_fstream.h>
 #include <bsl_vector.h>
 
+// BENCHMARKING LIBRARY
+#ifdef BSLS_PLATFORM_OS_LINUX
+#include <benchmark/benchmark.h>
+#endif
+
 // TEST DRIVER
 #include <mwctst_testhelper.h>
 
@@ -344,6 +349,59 @@ static void testN1_decodeFromFile()
     ASSERT_EQ(iter.isValid(), false);
 }
 
+// Begin Benchmarking Tests
+#ifdef BSLS_PLATFORM_OS_LINUX
+static void testN2_buildAndIterate_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// BENCHMARK: BUILD AND ITERATE
+//
+// Concerns:
+//   Measure the throughput of building CONFIRM events with
+//   'bmqp::ConfirmEventBuilder', and of iterating over them with
+//   'bmqp::ConfirmMessageIterator'.
+//
+// Plan:
+//   Repeatedly build an event of 'state.range(0)' CONFIRM messages, and
+//   iterate over its messages.
+//
+// Testing:
+//   Performance of 'appendMessage' and 'ConfirmMessageIterator::next'.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("GOOGLE BENCHMARK: BUILD AND ITERATE");
+
+    const int               numMessages = static_cast<int>(state.range(0));
+    const bmqt::MessageGUID guid;
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(4096, s_allocator_p);
+    bmqp::ConfirmEventBuilder      builder(&bufferFactory, s_allocator_p);
+    bmqp::ConfirmMessageIterator   iter;
+
+    // <time>
+    for (auto _ : state) {
+        builder.reset();
+        for (int i = 0; i < numMessages; ++i) {
+            builder.appendMessage(i % 16, i % 4, guid);
+        }
+
+        bmqp::Event event(&builder.blob(), s_allocator_p);
+        event.loadConfirmMessageIterator(&iter);
+        while (iter.next() == 1) {
+            benchmark::DoNotOptimize(iter.message().queueId());
+        }
+    }
+    // </time>
+
+    state.SetItemsProcessed(state.iterations() * numMessages);
+}
+#else
+static void testN2_buildAndIterate()
+{
+    mwctst::TestHelper::printTestName("GOOGLE BENCHMARK: BUILD AND ITERATE");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+#endif  // BSLS_PLATFORM_OS_LINUX
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -359,11 +417,22 @@ int main(int argc, char* argv[])
     case 2: test2_multiMessage(); break;
     case 1: test1_breathingTest(); break;
     case -1: testN1_decodeFromFile(); break;
+    case -2:
+        MWC_BENCHMARK_WITH_ARGS(testN2_buildAndIterate,
+                                RangeMultiplier(4)->Range(1, 1024));
+        break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         s_testStatus = -1;
     } break;
     }
 
+#ifdef BSLS_PLATFORM_OS_LINUX
+    if (_testCase < 0) {
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+    }
+#endif
+
     TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
 }
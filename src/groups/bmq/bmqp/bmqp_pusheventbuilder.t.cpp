@@ -46,6 +46,11 @@
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
 
+// BENCHMARKING LIBRARY
+#ifdef BSLS_PLATFORM_OS_LINUX
+#include <benchmark/benchmark.h>
+#endif
+
 // TEST DRIVER
 #include <mwctst_testhelper.h>
 
@@ -1205,6 +1210,160 @@ static void testN1_decodeFromFile()
     ASSERT_EQ(0, pushIter.next());  // we added only 1 msg
     ASSERT_EQ(false, pushIter.isValid());
 }
+// Begin Benchmarking Tests
+#ifdef BSLS_PLATFORM_OS_LINUX
+static void testN2_packMessageWithOptions_GoogleBenchmark(
+    benchmark::State& state)
+// ------------------------------------------------------------------------
+// BENCHMARK: PACK MESSAGE WITH OPTIONS
+//
+// Concerns:
+//   Measure the throughput of building PUSH events depending on the size
+//   of the messages and on the number of SubQueueInfos of their option,
+//   including when that number exceeds the inline capacity of
+//   'bmqp::Protocol::SubQueueInfosArray'.
+//
+// Plan:
+//   Repeatedly build an event of 'k_NUM_MSGS' messages of at least
+//   'state.range(0)' bytes, each with a SubQueueInfos option of
+//   'state.range(1)' SubQueueInfos, if any.
+//
+// Testing:
+//   Performance of 'addSubQueueInfosOption' and 'packMessage'.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK: PACK MESSAGE WITH OPTIONS");
+
+    const int k_NUM_MSGS       = 32;
+    const int k_QID            = 4321;
+    const int numSubQueueInfos = static_cast<int>(state.range(1));
+
+    bdlbb::PooledBlobBufferFactory     bufferFactory(4096, s_allocator_p);
+    bmqp::PushEventBuilder             peb(&bufferFactory, s_allocator_p);
+    bdlbb::Blob                        payload(&bufferFactory, s_allocator_p);
+    bmqp::Protocol::SubQueueInfosArray subQueueInfos(s_allocator_p);
+    bmqt::MessageGUID                  guid;
+    int                                payloadLen = 0;
+
+    guid.fromHex(HEX_REP);
+    populateBlob(&payload, &payloadLen, static_cast<int>(state.range(0)));
+    generateSubQueueInfos(&subQueueInfos, numSubQueueInfos);
+
+    // <time>
+    for (auto _ : state) {
+        peb.reset();
+        for (int i = 0; i < k_NUM_MSGS; ++i) {
+            if (numSubQueueInfos > 0) {
+                peb.addSubQueueInfosOption(subQueueInfos);
+            }
+            peb.packMessage(payload,
+                            k_QID,
+                            guid,
+                            0,
+                            bmqt::CompressionAlgorithmType::e_NONE);
+        }
+        benchmark::DoNotOptimize(peb.blob().length());
+    }
+    // </time>
+
+    state.SetItemsProcessed(state.iterations() * k_NUM_MSGS);
+    state.SetBytesProcessed(state.iterations() * k_NUM_MSGS * payloadLen);
+}
+
+static void testN3_iterateWithOptions_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// BENCHMARK: ITERATE WITH OPTIONS
+//
+// Concerns:
+//   Measure the throughput of iterating over PUSH events with
+//   'bmqp::PushMessageIterator', and decoding the SubQueueInfos option of
+//   their messages, depending on the size of the messages and on the
+//   number of SubQueueInfos.
+//
+// Plan:
+//   Build an event as in 'testN2_packMessageWithOptions', and repeatedly
+//   iterate over it, loading the payload and the SubQueueInfos of each
+//   message.
+//
+// Testing:
+//   Performance of 'PushMessageIterator::next', 'loadMessagePayload',
+//   'loadOptionsView' and 'OptionsView::loadSubQueueInfosOption'.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK: ITERATE WITH OPTIONS");
+
+    const int k_NUM_MSGS       = 32;
+    const int k_QID            = 4321;
+    const int numSubQueueInfos = static_cast<int>(state.range(1));
+
+    bdlbb::PooledBlobBufferFactory     bufferFactory(4096, s_allocator_p);
+    bmqp::PushEventBuilder             peb(&bufferFactory, s_allocator_p);
+    bdlbb::Blob                        payload(&bufferFactory, s_allocator_p);
+    bmqp::Protocol::SubQueueInfosArray subQueueInfos(s_allocator_p);
+    bmqt::MessageGUID                  guid;
+    int                                payloadLen = 0;
+
+    guid.fromHex(HEX_REP);
+    populateBlob(&payload, &payloadLen, static_cast<int>(state.range(0)));
+    generateSubQueueInfos(&subQueueInfos, numSubQueueInfos);
+
+    for (int i = 0; i < k_NUM_MSGS; ++i) {
+        if (numSubQueueInfos > 0) {
+            BSLS_ASSERT_OPT(peb.addSubQueueInfosOption(subQueueInfos) ==
+                            bmqt::EventBuilderResult::e_SUCCESS);
+        }
+        BSLS_ASSERT_OPT(
+            peb.packMessage(payload,
+                            k_QID,
+                            guid,
+                            0,
+                            bmqt::CompressionAlgorithmType::e_NONE) ==
+            bmqt::EventBuilderResult::e_SUCCESS);
+    }
+
+    const bdlbb::Blob&                 eventBlob = peb.blob();
+    bmqp::Event                        rawEvent(&eventBlob, s_allocator_p);
+    bmqp::PushMessageIterator          pushIter(&bufferFactory, s_allocator_p);
+    bmqp::OptionsView                  optionsView(s_allocator_p);
+    bmqp::Protocol::SubQueueInfosArray retrieved(s_allocator_p);
+    bdlbb::Blob payloadBlob(&bufferFactory, s_allocator_p);
+
+    // <time>
+    for (auto _ : state) {
+        rawEvent.loadPushMessageIterator(&pushIter, true);
+        while (pushIter.next() == 1) {
+            payloadBlob.removeAll();
+            pushIter.loadMessagePayload(&payloadBlob);
+            if (pushIter.hasOptions()) {
+                pushIter.loadOptionsView(&optionsView);
+                optionsView.loadSubQueueInfosOption(&retrieved);
+            }
+            benchmark::DoNotOptimize(retrieved.size());
+        }
+    }
+    // </time>
+
+    state.SetItemsProcessed(state.iterations() * k_NUM_MSGS);
+    state.SetBytesProcessed(state.iterations() * k_NUM_MSGS * payloadLen);
+}
+#else
+static void testN2_packMessageWithOptions()
+{
+    mwctst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK: PACK MESSAGE WITH OPTIONS");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+
+static void testN3_iterateWithOptions()
+{
+    mwctst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK: ITERATE WITH OPTIONS");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+#endif  // BSLS_PLATFORM_OS_LINUX
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1241,12 +1400,30 @@ int main(int argc, char* argv[])
     case 2: test2_buildEventBackwardsCompatibility(); break;
     case 1: test1_breathingTest(); break;
     case -1: testN1_decodeFromFile(); break;
+    // Note that 20 SubQueueInfos exceed 'Protocol::k_SUBID_ARRAY_STATIC_LEN'.
+    case -2:
+        MWC_BENCHMARK_WITH_ARGS(
+            testN2_packMessageWithOptions,
+            ArgsProduct({{64, 1024, 16384}, {0, 1, 8, 20}}));
+        break;
+    case -3:
+        MWC_BENCHMARK_WITH_ARGS(
+            testN3_iterateWithOptions,
+            ArgsProduct({{64, 1024, 16384}, {0, 1, 8, 20}}));
+        break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         s_testStatus = -1;
     } break;
     }
 
+#ifdef BSLS_PLATFORM_OS_LINUX
+    if (_testCase < 0) {
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+    }
+#endif
+
     bmqp::ProtocolUtil::shutdown();
 
     TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
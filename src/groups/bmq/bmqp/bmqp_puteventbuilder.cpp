@@ -165,6 +165,7 @@ PutEventBuilder::PutEventBuilder(bdlbb::BlobBufferFactory* bufferFactory,
 , d_blobPayload_p(0)
 , d_rawPayload_p(0)
 , d_rawPayloadLength(0)
+, d_sharedPayload(allocator)
 , d_properties_p(0)
 , d_flags(0)
 , d_messageGUID()
@@ -182,6 +183,7 @@ PutEventBuilder::PutEventBuilder(bdlbb::BlobBufferFactory* bufferFactory,
 int PutEventBuilder::reset()
 {
     d_blob.removeAll();
+    d_sharedPayload.removeAll();
     d_msgStarted       = false;
     d_blobPayload_p    = 0;
     d_rawPayload_p     = 0;
@@ -33,6 +33,14 @@
 // Each message added to the PutEvent is padded, so that multiple messages can
 // be added in the same event, without impacting the alignment of the headers.
 //
+/// Payload ownership
+///-----------------
+// A payload provided as a raw 'const char*' buffer is copied into the event
+// when the message is packed.  A payload provided as a 'bdlbb::Blob' or as a
+// 'bdlbb::BlobBuffer' is *not* copied: the buffers of the event blob alias
+// the ones holding the payload (unless the payload gets compressed), which
+// must therefore not be modified until the event has been sent.
+//
 /// Thread Safety
 ///-------------
 // NOT thread safe
@@ -120,6 +128,11 @@ class PutEventBuilder {
     // this represents the size of that
     // buffer
 
+    bdlbb::Blob d_sharedPayload;
+    // blob aliasing the shared buffer
+    // holding the payload of the
+    // current message (if any)
+
     const MessageProperties* d_properties_p;
     // Pointer to message properties of
     // the current message (if any)
@@ -230,6 +243,13 @@ class PutEventBuilder {
     /// access to this object.
     PutEventBuilder& setMessagePayload(const char* data, int length);
 
+    /// Set the payload of the current message to the data in the specified
+    /// `buffer` and return a reference offering modifiable access to this
+    /// object.  The payload is *not* copied: this builder, and the event
+    /// blob once the message is packed, share ownership of the memory of
+    /// `buffer`, which must not be modified afterwards.
+    PutEventBuilder& setMessagePayload(const bdlbb::BlobBuffer& buffer);
+
     /// Set the properties of the current message to the specified `value`
     /// and return a reference offering modifiable access to this object.
     PutEventBuilder& setMessageProperties(const MessageProperties* value);
@@ -410,6 +430,22 @@ inline PutEventBuilder& PutEventBuilder::setMessagePayload(const char* data,
     return *this;
 }
 
+inline PutEventBuilder&
+PutEventBuilder::setMessagePayload(const bdlbb::BlobBuffer& buffer)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_msgStarted == true);
+
+    d_sharedPayload.removeAll();
+    d_sharedPayload.appendDataBuffer(buffer);
+
+    d_blobPayload_p    = &d_sharedPayload;
+    d_rawPayload_p     = 0;
+    d_rawPayloadLength = 0;
+
+    return *this;
+}
+
 inline PutEventBuilder&
 PutEventBuilder::setMessageProperties(const MessageProperties* value)
 {
@@ -461,6 +497,7 @@ inline void PutEventBuilder::startMessage()
     d_msgStarted = true;
 
     // Reset message state
+    d_sharedPayload.removeAll();
     d_blobPayload_p            = 0;
     d_rawPayload_p             = 0;
     d_rawPayloadLength         = 0;
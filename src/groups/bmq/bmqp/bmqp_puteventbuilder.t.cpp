@@ -51,6 +51,11 @@
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bsls_assert.h>
 
+// BENCHMARKING LIBRARY
+#ifdef BSLS_PLATFORM_OS_LINUX
+#include <benchmark/benchmark.h>
+#endif
+
 // TEST DRIVER
 #include <mwctst_testhelper.h>
 
@@ -2247,6 +2252,94 @@ static void test7_multiplePackMessage()
     ASSERT_EQ(false, putIter.isValid());
 }
 
+static void test8_sharedBufferPayload()
+// ------------------------------------------------------------------------
+// SHARED BUFFER PAYLOAD
+//
+// Concerns:
+//   1. A payload provided as a 'bdlbb::BlobBuffer' is not copied: the
+//      event blob aliases the memory of the provided buffer.
+//   2. The payload can be read back from the event.
+//   3. Starting a new message releases the reference to the buffer.
+//
+// Plan:
+//   Build an event with a message whose payload is a buffer allocated from
+//   a blob buffer factory, and verify that one of the event blob's buffers
+//   points to the memory of that buffer.  Iterate and check the payload.
+//
+// Testing:
+//   setMessagePayload(const bdlbb::BlobBuffer& buffer)
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("SHARED BUFFER PAYLOAD");
+
+    const int k_PAYLOAD_SIZE = 1024;
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    bdlbb::PooledBlobBufferFactory payloadFactory(k_PAYLOAD_SIZE,
+                                                  s_allocator_p);
+    bmqp::PutEventBuilder          obj(&bufferFactory, s_allocator_p);
+
+    bdlbb::BlobBuffer payload;
+    payloadFactory.allocate(&payload);
+    for (int i = 0; i < k_PAYLOAD_SIZE; ++i) {
+        payload.data()[i] = static_cast<char>('a' + (i % 26));
+    }
+
+    obj.startMessage();
+    obj.setMessagePayload(payload)
+        .setMessageGUID(bmqp::MessageGUIDGenerator::testGUID());
+    ASSERT_EQ(k_PAYLOAD_SIZE, obj.unpackedMessageSize());
+
+    bmqt::EventBuilderResult::Enum rc = obj.packMessage(1);
+    ASSERT_EQ(bmqt::EventBuilderResult::e_SUCCESS, rc);
+    ASSERT_EQ(1, obj.messageCount());
+
+    const bdlbb::Blob& eventBlob = obj.blob();
+
+    // The payload must not have been copied
+    bool isAliased = false;
+    for (int i = 0; i < eventBlob.numDataBuffers(); ++i) {
+        if (eventBlob.buffer(i).data() == payload.data()) {
+            isAliased = true;
+            break;  // BREAK
+        }
+    }
+    ASSERT_EQ(true, isAliased);
+
+    {
+        // Iterate and check
+        bmqp::Event rawEvent(&eventBlob, s_allocator_p);
+        BSLS_ASSERT_OPT(true == rawEvent.isValid());
+        BSLS_ASSERT_OPT(true == rawEvent.isPutEvent());
+
+        bmqp::PutMessageIterator putIter(&bufferFactory, s_allocator_p);
+        rawEvent.loadPutMessageIterator(&putIter, true);
+        ASSERT_EQ(true, putIter.isValid());
+        ASSERT_EQ(1, putIter.next());
+        ASSERT_EQ(k_PAYLOAD_SIZE, putIter.messagePayloadSize());
+
+        bdlbb::Blob payloadBlob(s_allocator_p);
+        ASSERT_EQ(0, putIter.loadMessagePayload(&payloadBlob));
+
+        int compareResult = -1;
+        ASSERT_EQ(0,
+                  mwcu::BlobUtil::compareSection(&compareResult,
+                                                 payloadBlob,
+                                                 mwcu::BlobPosition(),
+                                                 payload.data(),
+                                                 k_PAYLOAD_SIZE));
+        ASSERT_EQ(0, compareResult);
+    }
+
+    // Starting a new message and resetting releases the builder's references
+    // to the payload buffer.
+    obj.startMessage();
+    ASSERT_EQ(0, obj.unpackedMessageSize());
+    obj.reset();
+    ASSERT_EQ(1, payload.buffer().use_count());
+}
+
 static void testN1_decodeFromFile()
 // --------------------------------------------------------------------
 // DECODE FROM FILE
@@ -2411,6 +2504,230 @@ static void testN1_decodeFromFile()
     ASSERT_EQ(false, putIter.isValid());
 }
 
+// Begin Benchmarking Tests
+#ifdef BSLS_PLATFORM_OS_LINUX
+/// Append to the specified `payload` the specified `size` pseudo-random
+/// lowercase letters, which compress to about 60% of their size.
+static void generatePayload(bdlbb::Blob* payload, int size)
+{
+    int seed = 12345;
+    for (int i = 0; i < size; ++i) {
+        const char c = static_cast<char>('a' +
+                                         bdlb::Random::generate15(&seed) % 26);
+        bdlbb::BlobUtil::append(payload, &c, 1);
+    }
+}
+
+/// Load into the specified `properties` a few properties of different
+/// types, as typically set by applications.
+static void generateProperties(bmqp::MessageProperties* properties)
+{
+    properties->setPropertyAsInt32("encoding", 3);
+    properties->setPropertyAsString("id", "benchmarkProducer");
+    properties->setPropertyAsInt64("timestamp", 1704067200000000000LL);
+}
+
+static void testN2_packMessage_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// BENCHMARK: PACK MESSAGE
+//
+// Concerns:
+//   Measure the throughput of building PUT events with 'packMessage',
+//   which computes the CRC32-C of each message, depending on the size of
+//   the messages, and on whether they have properties and are compressed.
+//
+// Plan:
+//   Repeatedly build an event of 'k_NUM_MSGS' messages of 'state.range(0)'
+//   bytes, with properties if 'state.range(1)' is 1, and compressed with
+//   ZLIB if 'state.range(2)' is 1.
+//
+// Testing:
+//   Performance of 'packMessage'.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("GOOGLE BENCHMARK: PACK MESSAGE");
+
+    const int  k_NUM_MSGS    = 32;
+    const int  k_QID         = 9876;
+    const int  payloadSize   = static_cast<int>(state.range(0));
+    const bool hasProperties = state.range(1) == 1;
+    const bmqt::CompressionAlgorithmType::Enum cat =
+        state.range(2) == 1 ? bmqt::CompressionAlgorithmType::e_ZLIB
+                            : bmqt::CompressionAlgorithmType::e_NONE;
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(4096, s_allocator_p);
+    bmqp::PutEventBuilder          builder(&bufferFactory, s_allocator_p);
+    bdlbb::Blob                    payload(&bufferFactory, s_allocator_p);
+    bmqp::MessageProperties        properties(s_allocator_p);
+    const bmqt::MessageGUID guid = bmqp::MessageGUIDGenerator::testGUID();
+
+    generatePayload(&payload, payloadSize);
+    generateProperties(&properties);
+
+    // <time>
+    for (auto _ : state) {
+        builder.reset();
+        for (int i = 0; i < k_NUM_MSGS; ++i) {
+            builder.startMessage();
+            builder.setMessageGUID(guid)
+                .setMessagePayload(&payload)
+                .setCompressionAlgorithmType(cat);
+            if (hasProperties) {
+                builder.setMessageProperties(&properties);
+            }
+            builder.packMessage(k_QID);
+        }
+        benchmark::DoNotOptimize(builder.blob().length());
+    }
+    // </time>
+
+    state.SetItemsProcessed(state.iterations() * k_NUM_MSGS);
+    state.SetBytesProcessed(state.iterations() * k_NUM_MSGS * payloadSize);
+}
+
+static void testN3_packMessageRaw_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// BENCHMARK: PACK MESSAGE RAW
+//
+// Concerns:
+//   Measure the throughput of building PUT events with 'packMessageRaw',
+//   which does not compute the CRC32-C of the messages, as done when
+//   relaying messages whose application data is already encoded.
+//
+// Plan:
+//   Repeatedly build an event of 'k_NUM_MSGS' messages of 'state.range(0)'
+//   bytes, setting a precomputed CRC32-C.  Compare with the results of
+//   'testN2_packMessage' for the cost of the CRC32-C.
+//
+// Testing:
+//   Performance of 'packMessageRaw'.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("GOOGLE BENCHMARK: PACK MESSAGE RAW");
+
+    const int k_NUM_MSGS  = 32;
+    const int k_QID       = 9876;
+    const int payloadSize = static_cast<int>(state.range(0));
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(4096, s_allocator_p);
+    bmqp::PutEventBuilder          builder(&bufferFactory, s_allocator_p);
+    bdlbb::Blob                    payload(&bufferFactory, s_allocator_p);
+    const bmqt::MessageGUID guid = bmqp::MessageGUIDGenerator::testGUID();
+
+    generatePayload(&payload, payloadSize);
+    const unsigned int crc32c = bmqp::Crc32c::calculate(payload);
+
+    // <time>
+    for (auto _ : state) {
+        builder.reset();
+        for (int i = 0; i < k_NUM_MSGS; ++i) {
+            builder.startMessage();
+            builder.setMessageGUID(guid)
+                .setMessagePayload(&payload)
+                .setCrc32c(crc32c);
+            builder.packMessageRaw(k_QID);
+        }
+        benchmark::DoNotOptimize(builder.blob().length());
+    }
+    // </time>
+
+    state.SetItemsProcessed(state.iterations() * k_NUM_MSGS);
+    state.SetBytesProcessed(state.iterations() * k_NUM_MSGS * payloadSize);
+}
+
+static void testN4_iterate_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// BENCHMARK: ITERATE
+//
+// Concerns:
+//   Measure the throughput of iterating over PUT events with
+//   'bmqp::PutMessageIterator', and loading the payload and properties of
+//   their messages, depending on the size of the messages, and on whether
+//   they have properties and are compressed.
+//
+// Plan:
+//   Build an event of 'k_NUM_MSGS' messages as in 'testN2_packMessage',
+//   and repeatedly iterate over it, decompressing the messages.
+//
+// Testing:
+//   Performance of 'PutMessageIterator::next', 'loadMessagePayload' and
+//   'loadMessageProperties'.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("GOOGLE BENCHMARK: ITERATE");
+
+    const int  k_NUM_MSGS    = 32;
+    const int  k_QID         = 9876;
+    const int  payloadSize   = static_cast<int>(state.range(0));
+    const bool hasProperties = state.range(1) == 1;
+    const bmqt::CompressionAlgorithmType::Enum cat =
+        state.range(2) == 1 ? bmqt::CompressionAlgorithmType::e_ZLIB
+                            : bmqt::CompressionAlgorithmType::e_NONE;
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(4096, s_allocator_p);
+    bmqp::PutEventBuilder          builder(&bufferFactory, s_allocator_p);
+    bdlbb::Blob                    payload(&bufferFactory, s_allocator_p);
+    bmqp::MessageProperties        properties(s_allocator_p);
+    const bmqt::MessageGUID guid = bmqp::MessageGUIDGenerator::testGUID();
+
+    generatePayload(&payload, payloadSize);
+    generateProperties(&properties);
+
+    for (int i = 0; i < k_NUM_MSGS; ++i) {
+        builder.startMessage();
+        builder.setMessageGUID(guid)
+            .setMessagePayload(&payload)
+            .setCompressionAlgorithmType(cat);
+        if (hasProperties) {
+            builder.setMessageProperties(&properties);
+        }
+        BSLS_ASSERT_OPT(builder.packMessage(k_QID) ==
+                        bmqt::EventBuilderResult::e_SUCCESS);
+    }
+
+    const bdlbb::Blob&       eventBlob = builder.blob();
+    bmqp::Event              rawEvent(&eventBlob, s_allocator_p);
+    bmqp::PutMessageIterator putIter(&bufferFactory, s_allocator_p);
+    bdlbb::Blob              payloadBlob(&bufferFactory, s_allocator_p);
+    bmqp::MessageProperties  iterProperties(s_allocator_p);
+
+    // <time>
+    for (auto _ : state) {
+        rawEvent.loadPutMessageIterator(&putIter, true);
+        while (putIter.next() == 1) {
+            payloadBlob.removeAll();
+            putIter.loadMessagePayload(&payloadBlob);
+            if (putIter.hasMessageProperties()) {
+                putIter.loadMessageProperties(&iterProperties);
+            }
+            benchmark::DoNotOptimize(payloadBlob.length());
+        }
+    }
+    // </time>
+
+    state.SetItemsProcessed(state.iterations() * k_NUM_MSGS);
+    state.SetBytesProcessed(state.iterations() * k_NUM_MSGS * payloadSize);
+}
+#else
+static void testN2_packMessage()
+{
+    mwctst::TestHelper::printTestName("GOOGLE BENCHMARK: PACK MESSAGE");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+
+static void testN3_packMessageRaw()
+{
+    mwctst::TestHelper::printTestName("GOOGLE BENCHMARK: PACK MESSAGE RAW");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+
+static void testN4_iterate()
+{
+    mwctst::TestHelper::printTestName("GOOGLE BENCHMARK: ITERATE");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+#endif  // BSLS_PLATFORM_OS_LINUX
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -2442,6 +2759,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 8: test8_sharedBufferPayload(); break;
     case 7: test7_multiplePackMessage(); break;
     case 6: test6_emptyBuilder(); break;
     case 5: test5_putEventWithZeroLengthMessage(); break;
@@ -2450,12 +2768,33 @@ int main(int argc, char* argv[])
     case 2: test2_manipulators_one(); break;
     case 1: test1_breathingTest(); break;
     case -1: testN1_decodeFromFile(); break;
+    case -2:
+        MWC_BENCHMARK_WITH_ARGS(
+            testN2_packMessage,
+            ArgsProduct({{64, 1024, 16384, 65536}, {0, 1}, {0, 1}}));
+        break;
+    case -3:
+        MWC_BENCHMARK_WITH_ARGS(testN3_packMessageRaw,
+                                Arg(64)->Arg(1024)->Arg(16384)->Arg(65536));
+        break;
+    case -4:
+        MWC_BENCHMARK_WITH_ARGS(
+            testN4_iterate,
+            ArgsProduct({{64, 1024, 16384, 65536}, {0, 1}, {0, 1}}));
+        break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         s_testStatus = -1;
     } break;
     }
 
+#ifdef BSLS_PLATFORM_OS_LINUX
+    if (_testCase < 0) {
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+    }
+#endif
+
     bmqp::ProtocolUtil::shutdown();
 
     TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
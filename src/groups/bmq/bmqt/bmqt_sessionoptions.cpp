@@ -45,6 +45,11 @@ SessionOptions::SessionOptions(bslma::Allocator* allocator)
 , d_eventQueueLowWatermark(50)
 , d_eventQueueHighWatermark(2 * 1000)
 , d_eventQueueSize(-1)  // DEPRECATED: will be removed in future release
+, d_eventQueueSpinDuration(0)
+, d_processingThreadsCpuAffinity(allocator)
+, d_putBatchingLatencyBudget(0)
+, d_putBatchingMaxMessages(k_PUT_BATCHING_MAX_MESSAGES)
+, d_putBatchingMaxBytes(k_PUT_BATCHING_MAX_BYTES)
 , d_hostHealthMonitor_sp(NULL)
 , d_dtContext_sp(NULL)
 , d_dtTracer_sp(NULL)
@@ -68,6 +73,12 @@ SessionOptions::SessionOptions(const SessionOptions& other,
 , d_eventQueueLowWatermark(other.eventQueueLowWatermark())
 , d_eventQueueHighWatermark(other.eventQueueHighWatermark())
 , d_eventQueueSize(-1)  // DEPRECATED: will be removed in future release
+, d_eventQueueSpinDuration(other.eventQueueSpinDuration())
+, d_processingThreadsCpuAffinity(other.processingThreadsCpuAffinity(),
+                                 allocator)
+, d_putBatchingLatencyBudget(other.putBatchingLatencyBudget())
+, d_putBatchingMaxMessages(other.putBatchingMaxMessages())
+, d_putBatchingMaxBytes(other.putBatchingMaxBytes())
 , d_hostHealthMonitor_sp(other.hostHealthMonitor())
 , d_dtContext_sp(other.traceContext())
 , d_dtTracer_sp(other.tracer())
@@ -105,6 +116,14 @@ bsl::ostream& SessionOptions::print(bsl::ostream& stream,
     printer.printAttribute("eventQueueLowWatermark", d_eventQueueLowWatermark);
     printer.printAttribute("eventQueueHighWatermark",
                            d_eventQueueHighWatermark);
+    printer.printAttribute("eventQueueSpinDuration",
+                           d_eventQueueSpinDuration.totalSecondsAsDouble());
+    printer.printAttribute("processingThreadsCpuAffinity",
+                           d_processingThreadsCpuAffinity);
+    printer.printAttribute("putBatchingLatencyBudget",
+                           d_putBatchingLatencyBudget.totalSecondsAsDouble());
+    printer.printAttribute("putBatchingMaxMessages", d_putBatchingMaxMessages);
+    printer.printAttribute("putBatchingMaxBytes", d_putBatchingMaxBytes);
     printer.printAttribute("hasHostHealthMonitor",
                            d_hostHealthMonitor_sp != NULL);
     printer.printAttribute("hasDistributedTracing", d_dtTracer_sp != NULL);
@@ -101,6 +101,36 @@
 //:      'lowWatermark' values to avoid a constant back and forth toggling of
 //:      state resulting from push pop of events.
 //:
+//: o !eventQueueSpinDuration!:
+//:      Duration for which a thread reading from the EventQueue (either one
+//:      of the processing threads, or the application thread calling
+//:      'nextEvent') busy-polls the queue for a new event before parking on
+//:      a condition variable.  Spinning avoids the cost of the thread wake up
+//:      on the event delivery path, at the expense of burning CPU while the
+//:      queue is empty, and is therefore only recommended for latency
+//:      sensitive applications having dedicated cores.  Default is 0, meaning
+//:      that the reading thread parks immediately when the queue is empty.
+//:
+//: o !processingThreadsCpuAffinity!:
+//:      Set of CPUs the processing threads should be pinned to.  This is
+//:      typically used in conjunction with 'eventQueueSpinDuration' to ensure
+//:      that spinning threads are running on isolated cores.  Default is
+//:      empty, meaning that no affinity is set.  Note that this setting has
+//:      an effect only if providing a 'SessionEventHandler' to the session,
+//:      and only on platforms supporting it (Linux).
+//:
+//: o !putBatchingLatencyBudget!, !putBatchingMaxMessages!,
+//:   !putBatchingMaxBytes!:
+//:      Parameters of the SDK-side coalescing of posted PUT events.  When the
+//:      'latencyBudget' is non-zero, PUT events posted by the application
+//:      (from any thread) are coalesced into a single PUT event sent to the
+//:      broker whenever more PUT events are already waiting to be sent,
+//:      until the batch reaches either 'maxMessages' messages or 'maxBytes'
+//:      bytes, or until its oldest message has been pending for
+//:      'latencyBudget'.  A posted event is sent without delay when nothing
+//:      else is pending, so that batching only kicks in under load.  Default
+//:      latency budget is 0, meaning that every posted event is sent as is.
+//:
 //: o !hostHealthMonitor!:
 //:      Optional instance of a class derived from 'bmqpi::HostHealthMonitor',
 //:      responsible for notifying the 'Session' when the health of the host
@@ -124,6 +154,7 @@
 #include <bsl_iosfwd.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
@@ -168,6 +199,13 @@ class SessionOptions {
     // The default, and minimum recommended, value for queue
     // operations (open, configure, close).
 
+    static const int k_PUT_BATCHING_MAX_MESSAGES = 1000;
+    // Default maximum number of messages of a coalesced PUT
+    // event.
+
+    static const int k_PUT_BATCHING_MAX_BYTES = 1024 * 1024;
+    // Default maximum size, in bytes, of a coalesced PUT event.
+
   private:
     // DATA
     bsl::string d_brokerUri;
@@ -219,6 +257,24 @@ class SessionOptions {
     // longer relevant and will be removed
     // in future release of libbmq.
 
+    bsls::TimeInterval d_eventQueueSpinDuration;
+    // Duration for which a thread reading
+    // from the EventQueue busy-polls it
+    // before blocking (0 to disable).
+
+    bsl::vector<int> d_processingThreadsCpuAffinity;
+    // Set of CPUs to pin the processing
+    // threads to (empty for no affinity).
+
+    bsls::TimeInterval d_putBatchingLatencyBudget;
+
+    int d_putBatchingMaxMessages;
+
+    int d_putBatchingMaxBytes;
+    // Parameters to configure the
+    // coalescing of posted PUT events
+    // (latency budget of 0 to disable).
+
     bsl::shared_ptr<bmqpi::HostHealthMonitor> d_hostHealthMonitor_sp;
 
     bsl::shared_ptr<bmqpi::DTContext> d_dtContext_sp;
@@ -307,6 +363,29 @@ class SessionOptions {
     /// The behavior is undefined unless `lowWatermark < highWatermark`.
     SessionOptions& configureEventQueue(int lowWatermark, int highWatermark);
 
+    /// Set the duration for which a thread reading from the EventQueue
+    /// busy-polls it before blocking to the specified `value`.  Refer to the
+    /// component level documentation for more details.  The behavior is
+    /// undefined unless `value` is non-negative.
+    SessionOptions&
+    setEventQueueSpinDuration(const bsls::TimeInterval& value);
+
+    /// Set the CPUs to pin the processing threads to to the specified
+    /// `value`.  Refer to the component level documentation for more
+    /// details.
+    SessionOptions&
+    setProcessingThreadsCpuAffinity(const bsl::vector<int>& value);
+
+    /// Configure the coalescing of posted PUT events with the specified
+    /// `latencyBudget`, `maxMessages` and `maxBytes` thresholds.  Refer to
+    /// the component level documentation for explanation of those
+    /// parameters.  The behavior is undefined unless `latencyBudget` is
+    /// non-negative, and `maxMessages` and `maxBytes` are positive.
+    SessionOptions& configurePutBatching(
+        const bsls::TimeInterval& latencyBudget,
+        int                       maxMessages = k_PUT_BATCHING_MAX_MESSAGES,
+        int                       maxBytes    = k_PUT_BATCHING_MAX_BYTES);
+
     // ACCESSORS
 
     /// Get the broker URI.
@@ -357,6 +436,23 @@ class SessionOptions {
     /// in future release of libbmq.
     int eventQueueSize() const;
 
+    /// Get the duration for which a thread reading from the EventQueue
+    /// busy-polls it before blocking.
+    const bsls::TimeInterval& eventQueueSpinDuration() const;
+
+    /// Get the set of CPUs the processing threads are pinned to.
+    const bsl::vector<int>& processingThreadsCpuAffinity() const;
+
+    /// Get the maximum time a posted PUT message may be held back to be
+    /// coalesced with other PUT messages (0 if coalescing is disabled).
+    const bsls::TimeInterval& putBatchingLatencyBudget() const;
+
+    /// Get the maximum number of messages of a coalesced PUT event.
+    int putBatchingMaxMessages() const;
+
+    /// Get the maximum size, in bytes, of a coalesced PUT event.
+    int putBatchingMaxBytes() const;
+
     /// Format this object to the specified output `stream` at the (absolute
     /// value of) the optionally specified indentation `level` and return a
     /// reference to `stream`.  If `level` is specified, optionally specify
@@ -521,6 +617,39 @@ inline SessionOptions& SessionOptions::configureEventQueue(int lowWatermark,
     return *this;
 }
 
+inline SessionOptions&
+SessionOptions::setEventQueueSpinDuration(const bsls::TimeInterval& value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(value >= bsls::TimeInterval(0));
+
+    d_eventQueueSpinDuration = value;
+    return *this;
+}
+
+inline SessionOptions&
+SessionOptions::setProcessingThreadsCpuAffinity(const bsl::vector<int>& value)
+{
+    d_processingThreadsCpuAffinity = value;
+    return *this;
+}
+
+inline SessionOptions&
+SessionOptions::configurePutBatching(const bsls::TimeInterval& latencyBudget,
+                                     int                       maxMessages,
+                                     int                       maxBytes)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(latencyBudget >= bsls::TimeInterval(0));
+    BSLS_ASSERT_OPT(maxMessages > 0);
+    BSLS_ASSERT_OPT(maxBytes > 0);
+
+    d_putBatchingLatencyBudget = latencyBudget;
+    d_putBatchingMaxMessages   = maxMessages;
+    d_putBatchingMaxBytes      = maxBytes;
+    return *this;
+}
+
 // ACCESSORS
 inline const bsl::string& SessionOptions::brokerUri() const
 {
@@ -609,6 +738,34 @@ inline int SessionOptions::eventQueueSize() const
     return d_eventQueueSize;
 }
 
+inline const bsls::TimeInterval&
+SessionOptions::eventQueueSpinDuration() const
+{
+    return d_eventQueueSpinDuration;
+}
+
+inline const bsl::vector<int>&
+SessionOptions::processingThreadsCpuAffinity() const
+{
+    return d_processingThreadsCpuAffinity;
+}
+
+inline const bsls::TimeInterval&
+SessionOptions::putBatchingLatencyBudget() const
+{
+    return d_putBatchingLatencyBudget;
+}
+
+inline int SessionOptions::putBatchingMaxMessages() const
+{
+    return d_putBatchingMaxMessages;
+}
+
+inline int SessionOptions::putBatchingMaxBytes() const
+{
+    return d_putBatchingMaxBytes;
+}
+
 }  // close package namespace
 
 // --------------------
@@ -629,6 +786,12 @@ inline bool bmqt::operator==(const bmqt::SessionOptions& lhs,
            lhs.closeQueueTimeout() == rhs.closeQueueTimeout() &&
            lhs.eventQueueLowWatermark() == rhs.eventQueueLowWatermark() &&
            lhs.eventQueueHighWatermark() == rhs.eventQueueHighWatermark() &&
+           lhs.eventQueueSpinDuration() == rhs.eventQueueSpinDuration() &&
+           lhs.processingThreadsCpuAffinity() ==
+               rhs.processingThreadsCpuAffinity() &&
+           lhs.putBatchingLatencyBudget() == rhs.putBatchingLatencyBudget() &&
+           lhs.putBatchingMaxMessages() == rhs.putBatchingMaxMessages() &&
+           lhs.putBatchingMaxBytes() == rhs.putBatchingMaxBytes() &&
            lhs.hostHealthMonitor() == rhs.hostHealthMonitor() &&
            lhs.traceContext() == rhs.traceContext() &&
            lhs.tracer() == rhs.tracer();
@@ -648,6 +811,12 @@ inline bool bmqt::operator!=(const bmqt::SessionOptions& lhs,
            lhs.closeQueueTimeout() != rhs.closeQueueTimeout() ||
            lhs.eventQueueLowWatermark() != rhs.eventQueueLowWatermark() ||
            lhs.eventQueueHighWatermark() != rhs.eventQueueHighWatermark() ||
+           lhs.eventQueueSpinDuration() != rhs.eventQueueSpinDuration() ||
+           lhs.processingThreadsCpuAffinity() !=
+               rhs.processingThreadsCpuAffinity() ||
+           lhs.putBatchingLatencyBudget() != rhs.putBatchingLatencyBudget() ||
+           lhs.putBatchingMaxMessages() != rhs.putBatchingMaxMessages() ||
+           lhs.putBatchingMaxBytes() != rhs.putBatchingMaxBytes() ||
            lhs.hostHealthMonitor() != rhs.hostHealthMonitor() ||
            lhs.traceContext() != rhs.traceContext() ||
            lhs.tracer() != rhs.tracer();
@@ -60,7 +60,10 @@ static void test2_printTest()
         "statsDumpInterval = 300 connectTimeout = 60 disconnectTimeout = 30 "
         "openQueueTimeout = 300 configureQueueTimeout = 300 "
         "closeQueueTimeout = 300 eventQueueLowWatermark = 50 "
-        "eventQueueHighWatermark = 2000 hasHostHealthMonitor = false "
+        "eventQueueHighWatermark = 2000 eventQueueSpinDuration = 0 "
+        "processingThreadsCpuAffinity = [ ] putBatchingLatencyBudget = 0 "
+        "putBatchingMaxMessages = 1000 putBatchingMaxBytes = 1048576 "
+        "hasHostHealthMonitor = false "
         "hasDistributedTracing = false ]";
     mwctst::TestHelper::printTestName("PRINT");
     PV("Testing print");
@@ -150,6 +153,36 @@ static void test3_setterGetterAndCopyTest()
     ASSERT_EQ(obj.eventQueueLowWatermark(), eventQueueLowWatermark);
     ASSERT_EQ(obj.eventQueueHighWatermark(), eventQueueHighWatermark);
 
+    PVV("Checking setter and getter for eventQueueSpinDuration");
+    const bsls::TimeInterval eventQueueSpinDuration(0, 50 * 1000);
+    ASSERT_NE(obj.eventQueueSpinDuration(), eventQueueSpinDuration);
+    obj.setEventQueueSpinDuration(eventQueueSpinDuration);
+    ASSERT_EQ(obj.eventQueueSpinDuration(), eventQueueSpinDuration);
+
+    PVV("Checking setter and getter for processingThreadsCpuAffinity");
+    bsl::vector<int> cpus(s_allocator_p);
+    cpus.push_back(2);
+    cpus.push_back(3);
+    ASSERT(obj.processingThreadsCpuAffinity() != cpus);
+    obj.setProcessingThreadsCpuAffinity(cpus);
+    ASSERT(obj.processingThreadsCpuAffinity() == cpus);
+
+    PVV("Checking configurePutBatching");
+    const bsls::TimeInterval putBatchingLatencyBudget(0, 100 * 1000);
+    const int                putBatchingMaxMessages = 64;
+    const int                putBatchingMaxBytes    = 64 * 1024;
+    ASSERT_EQ(obj.putBatchingLatencyBudget(), bsls::TimeInterval(0));
+    ASSERT_EQ(obj.putBatchingMaxMessages(),
+              bmqt::SessionOptions::k_PUT_BATCHING_MAX_MESSAGES);
+    ASSERT_EQ(obj.putBatchingMaxBytes(),
+              bmqt::SessionOptions::k_PUT_BATCHING_MAX_BYTES);
+    obj.configurePutBatching(putBatchingLatencyBudget,
+                             putBatchingMaxMessages,
+                             putBatchingMaxBytes);
+    ASSERT_EQ(obj.putBatchingLatencyBudget(), putBatchingLatencyBudget);
+    ASSERT_EQ(obj.putBatchingMaxMessages(), putBatchingMaxMessages);
+    ASSERT_EQ(obj.putBatchingMaxBytes(), putBatchingMaxBytes);
+
     PVV("Copy constructor test");
     bmqt::SessionOptions objCopy(obj);
     ASSERT_EQ(objCopy.brokerUri(), brokerUri);
@@ -163,6 +196,12 @@ static void test3_setterGetterAndCopyTest()
     ASSERT_EQ(objCopy.closeQueueTimeout(), closeQueueTimeout);
     ASSERT_EQ(objCopy.eventQueueLowWatermark(), eventQueueLowWatermark);
     ASSERT_EQ(objCopy.eventQueueHighWatermark(), eventQueueHighWatermark);
+    ASSERT_EQ(objCopy.eventQueueSpinDuration(), eventQueueSpinDuration);
+    ASSERT(objCopy.processingThreadsCpuAffinity() == cpus);
+    ASSERT_EQ(objCopy.putBatchingLatencyBudget(), putBatchingLatencyBudget);
+    ASSERT_EQ(objCopy.putBatchingMaxMessages(), putBatchingMaxMessages);
+    ASSERT_EQ(objCopy.putBatchingMaxBytes(), putBatchingMaxBytes);
+    ASSERT(objCopy == obj);
 }
 // ============================================================================
 //                                 MAIN PROGRAM
@@ -33,6 +33,7 @@
 #include <mqbnet_cluster.h>
 #include <mqbnet_transportmanager.h>
 #include <mqbplug_pluginmanager.h>
+#include <mqbstat_messagetracer.h>
 #include <mqbstat_statcontroller.h>
 #include <mqbu_exit.h>
 #include <mqbu_messageguidutil.h>
@@ -117,6 +118,10 @@ void Application::oneTimeInit()
         bmqp::Crc32c::initialize();
         bmqt::UriParser::initialize();
         bmqp::ProtocolUtil::initialize();
+
+        // Tracing of messages is disabled until enabled by the
+        // 'MESSAGETRACE.SAMPLINGPERIOD' tunable of the 'STAT' command.
+        mqbstat::MessageTracer::initialize();
     }
 }
 
@@ -124,6 +129,7 @@ void Application::oneTimeShutdown()
 {
     BSLMT_ONCE_DO
     {
+        mqbstat::MessageTracer::shutdown();
         bmqp::ProtocolUtil::shutdown();
         bmqt::UriParser::shutdown();
         mwcsys::Time::shutdown();
@@ -290,6 +296,7 @@ int Application::start(bsl::ostream& errorDescription)
     d_dispatcher_mp.load(new (*d_allocator_p) Dispatcher(
                              mqbcfg::BrokerConfig::get().dispatcherConfig(),
                              d_scheduler_p,
+                             d_statController_mp->dispatcherStats(),
                              d_allocators.get("Dispatcher")),
                          d_allocator_p);
     rc = d_dispatcher_mp->start(errorDescription);
@@ -155,6 +155,7 @@
 #include <mqbi_queue.h>
 #include <mqbnet_tcpsessionfactory.h>
 #include <mqbstat_brokerstats.h>
+#include <mqbstat_messagetracer.h>
 #include <mqbu_messageguidutil.h>
 
 // BMQ
@@ -287,6 +288,28 @@ void finalizeClosedHandle(bsl::string description,
                   << handle->handleParameters();
 }
 
+/// Record in the message tracer the `e_CHANNEL_READ` stage of the messages
+/// of the specified PUT `event`, using the specified `bufferFactory` and
+/// `allocator` to iterate over them.
+void traceChannelRead(const bmqp::Event&        event,
+                      bdlbb::BlobBufferFactory* bufferFactory,
+                      bslma::Allocator*         allocator)
+{
+    // executed by the *IO* thread
+
+    bmqp::PutMessageIterator putIt(bufferFactory, allocator);
+    event.loadPutMessageIterator(&putIt);
+    if (!putIt.isValid()) {
+        return;  // RETURN
+    }
+
+    while (putIt.next() == 1) {
+        mqbstat::MessageTracer::record(
+            mqbstat::MessageTracerStage::e_CHANNEL_READ,
+            putIt.header().messageGUID());
+    }
+}
+
 }  // close unnamed namespace
 
 // -------------------------
@@ -1582,6 +1605,9 @@ void ClientSession::onAckEvent(const mqbi::DispatcherAckEvent& event)
         return;  // RETURN
     }
 
+    mqbstat::MessageTracer::record(mqbstat::MessageTracerStage::e_ACK,
+                                   ackMessage.messageGUID());
+
     sendAck(bmqp::ProtocolUtil::ackResultFromCode(ackMessage.status()),
             correlationId,
             ackMessage.messageGUID(),
@@ -2188,6 +2214,10 @@ void ClientSession::onPutEvent(const mqbi::DispatcherPutEvent& event)
             }
         }
 
+        mqbstat::MessageTracer::record(
+            mqbstat::MessageTracerStage::e_SESSION_DISPATCHER,
+            putHeader.messageGUID());
+
         // If at-most-once queue and ack is requested, send an ack
         // immediately regardless of whether this is first hop or not.
         if (isAtMostOnce) {
@@ -2745,6 +2775,17 @@ void ClientSession::processEvent(
 
         if (event.isPutEvent()) {
             eventType = mqbi::DispatcherEventType::e_PUT;
+
+            // The GUIDs of the messages of legacy clients are only generated
+            // by the session dispatcher.
+            if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                    mqbstat::MessageTracer::isEnabled() &&
+                    d_isClientGeneratingGUIDs)) {
+                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+                traceChannelRead(event,
+                                 d_state.d_bufferFactory_p,
+                                 d_state.d_allocator_p);
+            }
         }
         else if (event.isConfirmEvent()) {
             eventType = mqbi::DispatcherEventType::e_CONFIRM;
@@ -2906,7 +2947,15 @@ void ClientSession::onDispatcherEvent(const mqbi::DispatcherEvent& event)
         onRejectEvent(*(event.asRejectEvent()));
     } break;
     case mqbi::DispatcherEventType::e_PUSH: {
-        onPushEvent(*(event.asPushEvent()));
+        const mqbi::DispatcherPushEvent* realEvent = event.asPushEvent();
+        if (realEvent->callback()) {
+            // Batch of PUSH messages: do not flush first, unlike for a
+            // callback, so that they are appended to the pending ones.
+            realEvent->callback()(dispatcherClientData().processorHandle());
+        }
+        else {
+            onPushEvent(*realEvent);
+        }
     } break;
     case mqbi::DispatcherEventType::e_PUT: {
         onPutEvent(*(event.asPutEvent()));
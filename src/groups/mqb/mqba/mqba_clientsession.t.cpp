@@ -2342,6 +2342,116 @@ static void test11_initiateShutdown()
     }
 }
 
+/// Deliver to the specified `session` one PUSH message with the specified
+/// `blob` on the specified `queueId` for each of the specified `guids`, the
+/// way the callback of a batched PUSH event does.
+static void deliverPushBatch(mqba::ClientSession*                  session,
+                             int                                   queueId,
+                             const bsl::vector<bmqt::MessageGUID>& guids,
+                             const bsl::shared_ptr<bdlbb::Blob>&   blob)
+{
+    for (size_t i = 0; i < guids.size(); ++i) {
+        mqbi::DispatcherEvent event(s_allocator_p);
+        event.setType(mqbi::DispatcherEventType::e_PUSH)
+            .setSource(session)
+            .setQueueId(queueId)
+            .setBlob(blob)
+            .setGuid(guids[i])
+            .setCompressionAlgorithmType(
+                bmqt::CompressionAlgorithmType::e_NONE);
+
+        session->onDispatcherEvent(event);
+    }
+}
+
+static void test12_batchedPush()
+// ------------------------------------------------------------------------
+// BATCHED PUSH
+//
+// Concerns:
+//   - A batch of PUSH messages handed over in one PUSH event is appended to
+//     the PUSH messages already pending, without flushing them first.
+//   - The whole batch goes out in a single wire PUSH event.
+//
+// Plan:
+//   Instantiate a testbench, open a queue, send one PUSH, then a PUSH
+//   event carrying a batch of messages, flush and verify that exactly one
+//   PUSH event holding all the messages was written to the channel.
+//
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BATCHED PUSH");
+
+    const bsl::string uri("bmq://my.domain/queue-foo-bar", s_allocator_p);
+    const int         queueId      = 4;  // A queue number
+    const bool        isAtMostOnce = false;
+    const int         k_BATCH_SIZE = 5;
+
+    TestBench tb(client(e_FirstHop), isAtMostOnce, s_allocator_p);
+
+    // Send an 'OpenQueue` request.
+    tb.openQueue(uri, queueId);
+
+    // Confirm that the OpenQueue response has been sent downstream.
+    tb.d_cs.flush();
+    tb.assertOpenQueueResponse();
+
+    const size_t numWriteCalls = tb.d_channel->writeCalls().size();
+
+    bsl::shared_ptr<bdlbb::Blob> blobSp;
+    blobSp.createInplace(s_allocator_p, &tb.d_bufferFactory, s_allocator_p);
+    bmqp::PutTester::populateBlob(blobSp.get(), 99);
+
+    // Send one PUSH, which stays pending in the PUSH builder.
+    tb.sendPush(queueId,
+                bmqp::MessageGUIDGenerator::testGUID(),
+                blobSp,
+                bmqt::CompressionAlgorithmType::e_NONE,
+                bmqp::MessagePropertiesInfo());
+
+    // Send a batch of PUSH messages in one PUSH event.
+    bsl::vector<bmqt::MessageGUID> guids(s_allocator_p);
+    for (int i = 0; i < k_BATCH_SIZE; ++i) {
+        guids.push_back(bmqp::MessageGUIDGenerator::testGUID());
+    }
+
+    mqbi::DispatcherEvent batchEvent(s_allocator_p);
+    batchEvent.setType(mqbi::DispatcherEventType::e_PUSH)
+        .setSource(&tb.d_cs)
+        .setQueueId(queueId)
+        .setCallback(mqbi::Dispatcher::voidToProcessorFunctor(
+            bdlf::BindUtil::bind(&deliverPushBatch,
+                                 &tb.d_cs,
+                                 queueId,
+                                 bsl::cref(guids),
+                                 blobSp)));
+
+    tb.dispatch(batchEvent);
+
+    // Nothing was written yet: the batch did not flush the pending PUSH.
+    ASSERT_EQ(numWriteCalls, tb.d_channel->writeCalls().size());
+
+    tb.d_cs.flush();
+
+    // All the messages went out in a single PUSH event.
+    ASSERT(tb.d_channel->waitFor(numWriteCalls + 1, false));
+    ASSERT_EQ(numWriteCalls + 1, tb.d_channel->writeCalls().size());
+
+    bmqp::Event pushEvent(&tb.d_channel->writeCalls()[numWriteCalls].d_blob,
+                          s_allocator_p);
+    ASSERT(pushEvent.isPushEvent());
+
+    bmqp::PushMessageIterator pushIt(&tb.d_bufferFactory, s_allocator_p);
+    pushEvent.loadPushMessageIterator(&pushIt, true);
+
+    int numMessages = 0;
+    while (pushIt.next() == 1) {
+        ASSERT_EQ(queueId, pushIt.header().queueId());
+        ++numMessages;
+    }
+    ASSERT_EQ(k_BATCH_SIZE + 1, numMessages);
+}
+
 static void testN1_ackConfiguration()
 // ------------------------------------------------------------------------
 // TESTS ACK CONFIGURATION FOR CLIENT SESSION
@@ -2596,6 +2706,7 @@ int main(int argc, char* argv[])
 
         switch (_testCase) {
         case 0:
+        case 12: test12_batchedPush(); break;
         case 11: test11_initiateShutdown(); break;
         case 10: test10_newStyleCompressedPush(); break;
         case 9: test9_newStylePush(); break;
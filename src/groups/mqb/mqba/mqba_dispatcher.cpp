@@ -22,6 +22,7 @@
 
 // MWC
 #include <mwcsys_threadutil.h>
+#include <mwcsys_time.h>
 
 // BDE
 #include <bdlf_bind.h>
@@ -358,6 +359,9 @@ void Dispatcher::queueEventCb(mqbi::DispatcherClientType::Enum type,
     case ProcessorPool::Event::MWCC_USER: {
         BALL_LOG_TRACE << "Dispatching Event to queue " << processorId
                        << " of " << type << " dispatcher: " << event->object();
+        const bsls::Types::Int64 startTime =
+            d_stats_p ? mwcsys::Time::highResolutionTimer() : 0;
+
         if (event->object().type() ==
             mqbi::DispatcherEventType::e_DISPATCHER) {
             const mqbi::DispatcherDispatcherEvent* realEvent =
@@ -376,6 +380,16 @@ void Dispatcher::queueEventCb(mqbi::DispatcherClientType::Enum type,
                 // execute the 'finalizeCallback' of the event.
                 realEvent->callback()(processorId);
             }
+
+            if (d_stats_p) {
+                // The client is not reported, since the callback may have
+                // destroyed it.
+                d_stats_p->onEvent(type,
+                                   processorId,
+                                   mqbi::DispatcherEventType::e_DISPATCHER,
+                                   mwcsys::Time::highResolutionTimer() -
+                                       startTime);
+            }
         }
         else {
             DispatcherContext& dispatcherContext = *(d_contexts[type]);
@@ -391,6 +405,15 @@ void Dispatcher::queueEventCb(mqbi::DispatcherClientType::Enum type,
                     ->dispatcherClientData()
                     .setAddedToFlushList(true);
             }
+
+            if (d_stats_p) {
+                d_stats_p->onEvent(type,
+                                   processorId,
+                                   event->object().type(),
+                                   mwcsys::Time::highResolutionTimer() -
+                                       startTime,
+                                   event->object().destination());
+            }
         }
     } break;
     case ProcessorPool::Event::MWCC_QUEUE_EMPTY: {
@@ -448,11 +471,13 @@ void Dispatcher::onNewClient(mqbi::DispatcherClientType::Enum type,
 
 Dispatcher::Dispatcher(const mqbcfg::DispatcherConfig& config,
                        bdlmt::EventScheduler*          scheduler,
+                       mqbstat::DispatcherStats*       stats,
                        bslma::Allocator*               allocator)
 : d_allocator_p(allocator)
 , d_isStarted(false)
 , d_config(config)
 , d_scheduler_p(scheduler)
+, d_stats_p(stats)
 , d_contexts(allocator)
 {
     // PRECONDITIONS
@@ -52,6 +52,7 @@
 
 #include <mqbcfg_messages.h>
 #include <mqbi_dispatcher.h>
+#include <mqbstat_dispatcherstats.h>
 #include <mqbu_loadbalancer.h>
 
 // MWC
@@ -289,6 +290,10 @@ class Dispatcher BSLS_CPP11_FINAL : public mqbi::Dispatcher {
     bdlmt::EventScheduler* d_scheduler_p;
     // Event scheduler to use
 
+    mqbstat::DispatcherStats* d_stats_p;
+    // Profile of the processed events, if
+    // any
+
     bsl::vector<DispatcherContextSp> d_contexts;
     // The various context, one for each
     // ClientType
@@ -344,11 +349,13 @@ class Dispatcher BSLS_CPP11_FINAL : public mqbi::Dispatcher {
 
     // CREATORS
 
-    /// Create a dispatcher using the specified `config` and `scheduler`.
-    /// All memory allocation will be performed using the specified
-    /// `allocator`.
+    /// Create a dispatcher using the specified `config` and `scheduler`,
+    /// and recording the processing time of each event into the specified
+    /// `stats`, unless it is 0.  All memory allocation will be performed
+    /// using the specified `allocator`.
     Dispatcher(const mqbcfg::DispatcherConfig& config,
                bdlmt::EventScheduler*          scheduler,
+               mqbstat::DispatcherStats*       stats,
                bslma::Allocator*               allocator);
 
     /// Destructor
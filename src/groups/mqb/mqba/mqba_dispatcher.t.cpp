@@ -19,6 +19,7 @@
 // MQB
 #include <mqbcfg_messages.h>
 #include <mqbmock_dispatcher.h>
+#include <mqbstat_dispatcherstats.h>
 
 // MWC
 #include <mwcex_bindutil.h>
@@ -119,7 +120,10 @@ static void test1_breathingTest()
     eventScheduler.start();
 
     {
-        mqba::Dispatcher obj(dispatcherConfig, &eventScheduler, s_allocator_p);
+        mqba::Dispatcher obj(dispatcherConfig,
+                             &eventScheduler,
+                             0,
+                             s_allocator_p);
     }
 
     eventScheduler.stop();
@@ -211,8 +215,11 @@ static void test3_executorsSupport()
     dispatcherConfig.clusters().processorConfig().queueSizeHighWatermark() =
         100;
 
+    mqbstat::DispatcherStats stats(dispatcherConfig, s_allocator_p);
+
     mqba::Dispatcher dispatcher(dispatcherConfig,
                                 &eventScheduler,
+                                &stats,
                                 s_allocator_p);
 
     // start the dispatcher
@@ -480,6 +487,17 @@ static void test3_executorsSupport()
     // stop the dispatcher
     dispatcher.stop();
 
+    // the processing of the events was recorded in the stats (e.g., the
+    // dispatcher events enqueued by 'registerClient')
+    ASSERT_GT(stats.eventCount(mqbi::DispatcherClientType::e_SESSION,
+                               0,
+                               mqbi::DispatcherEventType::e_DISPATCHER),
+              0);
+    ASSERT_GT(stats.eventCount(mqbi::DispatcherClientType::e_QUEUE,
+                               0,
+                               mqbi::DispatcherEventType::e_DISPATCHER),
+              0);
+
     // stop the scheduler
     eventScheduler.stop();
 }
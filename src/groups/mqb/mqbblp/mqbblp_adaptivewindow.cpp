@@ -0,0 +1,137 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbblp_adaptivewindow.cpp                                          -*-C++-*-
+#include <mqbblp_adaptivewindow.h>
+
+#include <mqbscm_version.h>
+// BDE
+#include <bdlt_timeunitratio.h>
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace mqbblp {
+
+// --------------------
+// class AdaptiveWindow
+// --------------------
+
+// PUBLIC CONSTANTS
+const bsls::Types::Int64 AdaptiveWindow::k_MEASUREMENT_PERIOD_NS =
+    100 * bdlt::TimeUnitRatio::k_NS_PER_MS;
+
+const bsls::Types::Int64 AdaptiveWindow::k_TARGET_HORIZON_NS =
+    100 * bdlt::TimeUnitRatio::k_NS_PER_MS;
+
+const bsls::Types::Int64 AdaptiveWindow::k_MIN_WINDOW = 16;
+
+const double AdaptiveWindow::k_SMOOTHING_FACTOR = 0.5;
+
+const double AdaptiveWindow::k_RESUME_RATIO = 0.8;
+
+// CREATORS
+AdaptiveWindow::AdaptiveWindow()
+: d_periodStart(0)
+, d_periodConfirms(0)
+, d_periodMinLatency(0)
+, d_rate(0)
+, d_latency(0)
+, d_window(0)
+, d_isBlocked(false)
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+bool AdaptiveWindow::onConfirmed(bsls::Types::Int64 now,
+                                 bsls::Types::Int64 latency,
+                                 bsls::Types::Int64 numUnconfirmed)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(latency >= 0);
+    BSLS_ASSERT_SAFE(numUnconfirmed >= 0);
+
+    if (d_periodStart == 0) {
+        // First confirm: it only marks the beginning of the first period.
+        d_periodStart      = now;
+        d_periodConfirms   = 0;
+        d_periodMinLatency = latency;
+        return false;  // RETURN
+    }
+
+    ++d_periodConfirms;
+    d_periodMinLatency = bsl::min(d_periodMinLatency, latency);
+
+    const bsls::Types::Int64 elapsed = now - d_periodStart;
+    if (elapsed >= k_MEASUREMENT_PERIOD_NS) {
+        const double rate = static_cast<double>(d_periodConfirms) /
+                            static_cast<double>(elapsed);
+        const double minLatency = static_cast<double>(d_periodMinLatency);
+
+        if (d_window == 0) {
+            d_rate    = rate;
+            d_latency = minLatency;
+        }
+        else {
+            d_rate += k_SMOOTHING_FACTOR * (rate - d_rate);
+            d_latency += k_SMOOTHING_FACTOR * (minLatency - d_latency);
+        }
+
+        const double window = bsl::ceil(
+            d_rate * (d_latency + static_cast<double>(k_TARGET_HORIZON_NS)));
+        d_window = bsl::max(k_MIN_WINDOW,
+                            static_cast<bsls::Types::Int64>(window));
+
+        d_periodStart      = now;
+        d_periodConfirms   = 0;
+        d_periodMinLatency = latency;
+
+        if (numUnconfirmed >= d_window) {
+            // The window shrank below the number of unconfirmed messages.
+            d_isBlocked = true;
+        }
+    }
+
+    if (d_isBlocked &&
+        static_cast<double>(numUnconfirmed) <=
+            k_RESUME_RATIO * static_cast<double>(d_window)) {
+        d_isBlocked = false;
+        return true;  // RETURN
+    }
+
+    return false;
+}
+
+void AdaptiveWindow::reset()
+{
+    d_periodStart      = 0;
+    d_periodConfirms   = 0;
+    d_periodMinLatency = 0;
+    d_rate             = 0;
+    d_latency          = 0;
+    d_window           = 0;
+    d_isBlocked        = false;
+}
+
+// ACCESSORS
+double AdaptiveWindow::confirmRate() const
+{
+    return d_rate * static_cast<double>(bdlt::TimeUnitRatio::k_NS_PER_S);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
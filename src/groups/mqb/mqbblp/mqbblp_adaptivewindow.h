@@ -0,0 +1,216 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbblp_adaptivewindow.h                                            -*-C++-*-
+#ifndef INCLUDED_MQBBLP_ADAPTIVEWINDOW
+#define INCLUDED_MQBBLP_ADAPTIVEWINDOW
+
+//@PURPOSE: Provide a window of unconfirmed messages sized from consumer speed.
+//
+//@CLASSES:
+//  mqbblp::AdaptiveWindow: confirm rate and latency based delivery window
+//
+//@SEE ALSO: mqbblp::QueueHandle
+//
+//@DESCRIPTION: 'mqbblp::AdaptiveWindow' measures the rate at which a consumer
+// confirms messages, as well as the minimum time it takes for a delivered
+// message to be confirmed, and derives from them the number of unconfirmed
+// messages the consumer should be given.  It is used by 'mqbblp::QueueHandle'
+// when adaptive flow control is enabled in the broker configuration, on top of
+// the static 'maxUnconfirmedMessages' advertised by the consumer: a slow
+// consumer is then only given a small window and does not hoard messages that
+// faster consumers could process, while the round-robin router naturally
+// weights delivery towards the consumers having credit left.
+//
+// Confirms are accounted in measurement periods of 'k_MEASUREMENT_PERIOD_NS'.
+// When a period ends, its confirm rate 'R' and minimum confirm latency 'L' are
+// smoothed into the running estimates, and the window is set to:
+//..
+//  max(k_MIN_WINDOW, R * (L + k_TARGET_HORIZON_NS))
+//..
+// that is, enough messages to cover the round-trip to the consumer plus
+// 'k_TARGET_HORIZON_NS' of buffered work.  A consumer limited by its window
+// confirms with a latency close to 'L', so its window grows until the
+// consumer itself becomes the bottleneck.  Until the first period ends, the
+// window is unrestricted.
+//
+// A window also remembers whether delivery was stopped because of it, so that
+// the owner can resume delivery once enough messages have been confirmed (see
+// 'onDelivered' and 'onConfirmed').
+//
+// Times are opaque 'bsls::Types::Int64' nanoseconds, typically as returned by
+// 'mwcsys::Time::highResolutionTimer()'.
+//
+/// Thread Safety
+///-------------
+// NOT thread safe.  Used from the queue dispatcher thread only.
+//
+/// Usage
+///-----
+//..
+//  mqbblp::AdaptiveWindow window;
+//
+//  // On delivery
+//  if (window.canDeliver(numUnconfirmed)) {
+//      ++numUnconfirmed;
+//      window.onDelivered(numUnconfirmed);
+//  }
+//
+//  // On confirm
+//  --numUnconfirmed;
+//  if (window.onConfirmed(now, latency, numUnconfirmed)) {
+//      // Delivery had been stopped by the window: resume it.
+//  }
+//..
+
+// BDE
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mqbblp {
+
+// ====================
+// class AdaptiveWindow
+// ====================
+
+/// Window of unconfirmed messages sized from the measured confirm rate and
+/// latency of a consumer.
+class AdaptiveWindow {
+  public:
+    // PUBLIC CONSTANTS
+
+    /// Duration of a confirm rate measurement period.
+    static const bsls::Types::Int64 k_MEASUREMENT_PERIOD_NS;
+
+    /// Amount of work, in time, to keep buffered at the consumer on top of
+    /// the round-trip.
+    static const bsls::Types::Int64 k_TARGET_HORIZON_NS;
+
+    /// Lower bound of the window once measured.
+    static const bsls::Types::Int64 k_MIN_WINDOW;
+
+    /// Weight of the last period in the smoothed estimates.
+    static const double k_SMOOTHING_FACTOR;
+
+    /// Ratio of the window below which delivery is resumed after having
+    /// been stopped by the window.
+    static const double k_RESUME_RATIO;
+
+  private:
+    // DATA
+    bsls::Types::Int64 d_periodStart;
+    // Start time of the current
+    // measurement period, or 0 if none
+
+    bsls::Types::Int64 d_periodConfirms;
+    // Number of confirms in the current
+    // measurement period
+
+    bsls::Types::Int64 d_periodMinLatency;
+    // Minimum confirm latency in the
+    // current measurement period
+
+    double d_rate;
+    // Smoothed confirm rate, in messages
+    // per nanosecond
+
+    double d_latency;
+    // Smoothed minimum confirm latency, in
+    // nanoseconds
+
+    bsls::Types::Int64 d_window;
+    // Current window, or 0 if unrestricted
+
+    bool d_isBlocked;
+    // Whether delivery was stopped because
+    // of this window
+
+  public:
+    // CREATORS
+
+    /// Create an unrestricted window having no measurement.
+    AdaptiveWindow();
+
+    // MANIPULATORS
+
+    /// Record that a message was delivered, bringing the number of
+    /// unconfirmed messages to the specified `numUnconfirmed`.
+    void onDelivered(bsls::Types::Int64 numUnconfirmed);
+
+    /// Record that a message delivered the specified `latency` ago was
+    /// confirmed at the specified `now`, bringing the number of unconfirmed
+    /// messages to the specified `numUnconfirmed`.  Return true if delivery
+    /// was stopped because of this window and should now be resumed, and
+    /// false otherwise.
+    bool onConfirmed(bsls::Types::Int64 now,
+                     bsls::Types::Int64 latency,
+                     bsls::Types::Int64 numUnconfirmed);
+
+    /// Discard all measurements and make this window unrestricted.
+    void reset();
+
+    // ACCESSORS
+
+    /// Return true if a message can be delivered to a consumer having the
+    /// specified `numUnconfirmed` messages, and false otherwise.
+    bool canDeliver(bsls::Types::Int64 numUnconfirmed) const;
+
+    /// Return the current window, or 0 if it is unrestricted.
+    bsls::Types::Int64 window() const;
+
+    /// Return the smoothed confirm rate, in messages per second.
+    double confirmRate() const;
+
+    /// Return the smoothed minimum confirm latency, in nanoseconds.
+    bsls::Types::Int64 confirmLatency() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// --------------------
+// class AdaptiveWindow
+// --------------------
+
+// MANIPULATORS
+inline void AdaptiveWindow::onDelivered(bsls::Types::Int64 numUnconfirmed)
+{
+    if (d_window != 0 && numUnconfirmed >= d_window) {
+        d_isBlocked = true;
+    }
+}
+
+// ACCESSORS
+inline bool
+AdaptiveWindow::canDeliver(bsls::Types::Int64 numUnconfirmed) const
+{
+    return d_window == 0 || numUnconfirmed < d_window;
+}
+
+inline bsls::Types::Int64 AdaptiveWindow::window() const
+{
+    return d_window;
+}
+
+inline bsls::Types::Int64 AdaptiveWindow::confirmLatency() const
+{
+    return static_cast<bsls::Types::Int64>(d_latency);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
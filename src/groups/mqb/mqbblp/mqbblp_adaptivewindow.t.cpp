@@ -0,0 +1,212 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbblp_adaptivewindow.t.cpp                                        -*-C++-*-
+#include <mqbblp_adaptivewindow.h>
+
+// BDE
+#include <bdlt_timeunitratio.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+namespace {
+
+typedef bsls::Types::Int64 Int64;
+
+const Int64 k_NS_PER_MS = bdlt::TimeUnitRatio::k_NS_PER_MS;
+
+/// Confirm on the specified `obj`, starting at the specified `now`, one
+/// message every specified `interval` with the specified `latency`, during
+/// the specified `duration`, keeping the specified `numUnconfirmed`.
+/// Return the time after the last confirm.
+Int64 confirmAtRate(mqbblp::AdaptiveWindow* obj,
+                    Int64                   now,
+                    Int64                   interval,
+                    Int64                   latency,
+                    Int64                   duration,
+                    Int64                   numUnconfirmed)
+{
+    const Int64 end = now + duration;
+    for (; now < end; now += interval) {
+        obj->onConfirmed(now, latency, numUnconfirmed);
+    }
+    return now;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Testing:
+//   Basic functionality of 'mqbblp::AdaptiveWindow'.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    mqbblp::AdaptiveWindow obj;
+
+    // Unrestricted until measured
+    ASSERT_EQ(obj.window(), 0);
+    ASSERT(obj.canDeliver(1000000));
+    ASSERT(!obj.onConfirmed(1, k_NS_PER_MS, 0));
+    ASSERT_EQ(obj.window(), 0);
+
+    // 1000 msgs/s, confirmed 1ms after delivery: the window covers the
+    // round-trip plus the target horizon.
+    confirmAtRate(&obj,
+                  1 + k_NS_PER_MS,
+                  k_NS_PER_MS,
+                  k_NS_PER_MS,
+                  200 * k_NS_PER_MS,
+                  0);
+    ASSERT_GT(obj.window(), 0);
+    ASSERT_EQ(obj.confirmLatency(), k_NS_PER_MS);
+    ASSERT(obj.confirmRate() > 900 && obj.confirmRate() < 1100);
+
+    const Int64 expected = (mqbblp::AdaptiveWindow::k_TARGET_HORIZON_NS +
+                            k_NS_PER_MS) /
+                           k_NS_PER_MS;
+    ASSERT(obj.window() >= expected - 2 && obj.window() <= expected + 2);
+    ASSERT(obj.canDeliver(obj.window() - 1));
+    ASSERT(!obj.canDeliver(obj.window()));
+
+    obj.reset();
+    ASSERT_EQ(obj.window(), 0);
+    ASSERT(obj.canDeliver(1000000));
+}
+
+static void test2_slowAndFastConsumers()
+// ------------------------------------------------------------------------
+// SLOW AND FAST CONSUMERS
+//
+// Concerns:
+//   A slow consumer gets a smaller window than a fast one, and the window
+//   never goes below 'k_MIN_WINDOW'.
+//
+// Testing:
+//   onConfirmed
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("SLOW AND FAST CONSUMERS");
+
+    mqbblp::AdaptiveWindow slow;
+    mqbblp::AdaptiveWindow fast;
+
+    // 10 msgs/s
+    confirmAtRate(&slow,
+                  1,
+                  100 * k_NS_PER_MS,
+                  k_NS_PER_MS,
+                  5000 * k_NS_PER_MS,
+                  0);
+    // 100000 msgs/s
+    confirmAtRate(&fast, 1, 10000, k_NS_PER_MS, 500 * k_NS_PER_MS, 0);
+
+    ASSERT_EQ(slow.window(), mqbblp::AdaptiveWindow::k_MIN_WINDOW);
+    ASSERT_GT(fast.window(), 1000);
+}
+
+static void test3_resume()
+// ------------------------------------------------------------------------
+// RESUME
+//
+// Testing:
+//   'onConfirmed' returns true once, when enough messages are confirmed
+//   after delivery was stopped by the window.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("RESUME");
+
+    mqbblp::AdaptiveWindow obj;
+
+    Int64 now = confirmAtRate(&obj,
+                              1,
+                              k_NS_PER_MS,
+                              k_NS_PER_MS,
+                              500 * k_NS_PER_MS,
+                              0);
+    const Int64 window = obj.window();
+    ASSERT_GT(window, 0);
+
+    {
+        PVV("Not blocked: nothing to resume");
+        ASSERT(!obj.onConfirmed(now, k_NS_PER_MS, 0));
+    }
+
+    {
+        PVV("Blocked by delivery");
+        obj.onDelivered(window);
+        ASSERT(!obj.canDeliver(window));
+
+        // Still above the resume ratio
+        ASSERT(!obj.onConfirmed(now, k_NS_PER_MS, window - 1));
+
+        // Below the resume ratio
+        ASSERT(obj.onConfirmed(now, k_NS_PER_MS, 0));
+        ASSERT(!obj.onConfirmed(now, k_NS_PER_MS, 0));
+    }
+
+    {
+        PVV("Blocked by the window shrinking");
+        const Int64 numUnconfirmed = window;
+
+        // The consumer slows down to 10 msgs/s: the window shrinks below
+        // the number of unconfirmed messages.
+        bool resumed = false;
+        for (int i = 0; i < 20; ++i) {
+            now += 100 * k_NS_PER_MS;
+            resumed |= obj.onConfirmed(now, k_NS_PER_MS, numUnconfirmed);
+        }
+        ASSERT(!resumed);
+        ASSERT_LT(obj.window(), numUnconfirmed);
+        ASSERT(!obj.canDeliver(numUnconfirmed));
+
+        ASSERT(obj.onConfirmed(now, k_NS_PER_MS, 0));
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_resume(); break;
+    case 2: test2_slowAndFastConsumers(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
@@ -3385,6 +3385,10 @@ void Cluster::onDispatcherEvent(const mqbi::DispatcherEvent& event)
         if (realEvent->isRelay()) {
             onRelayPushEvent(event);
         }
+        else if (realEvent->callback()) {
+            // Batch of PUSH messages from a queue handle
+            realEvent->callback()(dispatcherClientData().processorHandle());
+        }
         else {
             onPushEvent(event);
         }
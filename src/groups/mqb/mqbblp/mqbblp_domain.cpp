@@ -23,6 +23,7 @@
 #include <mqbcmd_messages.h>
 #include <mqbi_dispatcher.h>
 #include <mqbi_queue.h>
+#include <mqbs_deduplicationindex.h>
 #include <mqbu_storagekey.h>
 
 // BMQ
@@ -192,6 +193,53 @@ int normalizeConfig(mqbconfm::Domain* defn,
         ++updatedValues;
     }
 
+    if (defn->deduplicationCapacity() < 0) {
+        errorDescription << domain.cluster()->name() << ", " << domain.name()
+                         << ": deduplicationCapacity is negative. Updated "
+                         << "deduplicationCapacity to 0. Please update this "
+                         << "domain's config to have a non-negative value.\n";
+
+        defn->deduplicationCapacity() = 0;
+        ++updatedValues;
+    }
+
+    const int fingerprintBits = defn->deduplicationFingerprintBits();
+    const int boundedBits     = bsl::min(
+        bsl::max(fingerprintBits,
+                 static_cast<int>(
+                     mqbs::DeduplicationIndex::k_MIN_FINGERPRINT_BITS)),
+        static_cast<int>(mqbs::DeduplicationIndex::k_MAX_FINGERPRINT_BITS));
+    if (fingerprintBits != boundedBits) {
+        errorDescription << domain.cluster()->name() << ", " << domain.name()
+                         << ": deduplicationFingerprintBits is out of range. "
+                         << "deduplicationFingerprintBits: " << fingerprintBits
+                         << ". Updated deduplicationFingerprintBits to have a "
+                         << "value of " << boundedBits << ". Please update "
+                         << "this domain's config to have a value between "
+                         << mqbs::DeduplicationIndex::k_MIN_FINGERPRINT_BITS
+                         << " and "
+                         << mqbs::DeduplicationIndex::k_MAX_FINGERPRINT_BITS
+                         << ".\n";
+
+        defn->deduplicationFingerprintBits() = boundedBits;
+        ++updatedValues;
+    }
+
+    if (!defn->deliveryTimeProperty().empty() &&
+        defn->storage().config().isInMemoryValue()) {
+        errorDescription << domain.cluster()->name() << ", " << domain.name()
+                         << ": scheduled delivery is not supported by an "
+                         << "in-memory storage. Ignoring "
+                         << "deliveryTimeProperty '"
+                         << defn->deliveryTimeProperty() << "'. Please update "
+                         << "this domain's config to either use a file-backed "
+                         << "storage or to not specify deliveryTimeProperty."
+                         << "\n";
+
+        defn->deliveryTimeProperty().clear();
+        ++updatedValues;
+    }
+
     return updatedValues;
 }
 
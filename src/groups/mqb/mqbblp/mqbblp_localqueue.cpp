@@ -26,6 +26,8 @@
 #include <mqbi_queueengine.h>
 #include <mqbi_storage.h>
 #include <mqbs_filestoreprotocol.h>
+#include <mqbs_priorityindex.h>
+#include <mqbstat_messagetracer.h>
 #include <mqbu_capacitymeter.h>
 #include <mqbu_storagekey.h>
 
@@ -45,6 +47,7 @@
 #include <bdlma_localsequentialallocator.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_epochutil.h>
+#include <bdlt_timeunitratio.h>
 #include <bsl_algorithm.h>
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
@@ -61,6 +64,79 @@ namespace mqbblp {
 // class LocalQueue
 // ----------------
 
+// PRIVATE MANIPULATORS
+bool LocalQueue::loadProperties(
+    const bdlbb::Blob&                 appData,
+    const bmqp::MessagePropertiesInfo& messagePropertiesInfo)
+{
+    if (!messagePropertiesInfo.isPresent()) {
+        return false;  // RETURN
+    }
+
+    d_properties.clear();
+    const int rc = d_state_p->queue()->schemaLearner().read(
+        d_schemaLearnerContext,
+        &d_properties,
+        messagePropertiesInfo,
+        appData);
+    if (rc != 0) {
+        BALL_LOG_TRACE << "Failed to read message schema [rc: " << rc << "]";
+        return false;  // RETURN
+    }
+
+    return true;
+}
+
+// PRIVATE ACCESSORS
+int LocalQueue::messagePriority(const bsl::string& propertyName) const
+{
+    bmqt::PropertyType::Enum type;
+    if (!d_properties.hasProperty(propertyName, &type) ||
+        type != bmqt::PropertyType::e_INT32) {
+        return 0;  // RETURN
+    }
+
+    typedef mqbs::PriorityIndex<int> Priorities;
+
+    return bsl::max(0,
+                    bsl::min(d_properties.getPropertyAsInt32(propertyName),
+                             Priorities::k_NUM_LEVELS - 1));
+}
+
+bsls::Types::Uint64 LocalQueue::messageDeliveryTimestamp(
+    const bsl::string&  propertyName,
+    bsls::Types::Uint64 arrivalTimestamp) const
+{
+    const bsls::Types::Int64 k_MS_PER_S = bdlt::TimeUnitRatio::k_MS_PER_S;
+
+    bmqt::PropertyType::Enum type;
+    if (!d_properties.hasProperty(propertyName, &type)) {
+        return 0;  // RETURN
+    }
+
+    bsls::Types::Int64 deliveryTimestamp = 0;
+    if (type == bmqt::PropertyType::e_INT64) {
+        // Absolute time, in milliseconds from epoch.
+        const bsls::Types::Int64 ms = d_properties.getPropertyAsInt64(
+            propertyName);
+        deliveryTimestamp = (ms + k_MS_PER_S - 1) / k_MS_PER_S;
+    }
+    else if (type == bmqt::PropertyType::e_INT32) {
+        // Relative delay, in milliseconds.
+        const bsls::Types::Int64 ms = d_properties.getPropertyAsInt32(
+            propertyName);
+        deliveryTimestamp = static_cast<bsls::Types::Int64>(arrivalTimestamp) +
+                            (ms + k_MS_PER_S - 1) / k_MS_PER_S;
+    }
+
+    if (deliveryTimestamp <=
+        static_cast<bsls::Types::Int64>(arrivalTimestamp)) {
+        return 0;  // RETURN
+    }
+
+    return deliveryTimestamp;
+}
+
 // CREATORS
 LocalQueue::LocalQueue(QueueState* state, bslma::Allocator* allocator)
 : d_allocator_p(allocator)
@@ -70,6 +146,8 @@ LocalQueue::LocalQueue(QueueState* state, bslma::Allocator* allocator)
 , d_hasNewMessages(false)
 , d_throttledDuplicateMessages()
 , d_haveStrongConsistency(false)
+, d_schemaLearnerContext(state->queue()->schemaLearner().createContext())
+, d_properties(allocator)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(d_state_p->id() == bmqp::QueueId::k_PRIMARY_QUEUE_ID);
@@ -391,6 +469,10 @@ void LocalQueue::postMessage(const bmqp::PutHeader&              putHeader,
         source->subStreamInfos().find(bmqp::ProtocolUtil::k_DEFAULT_APP_ID) !=
         source->subStreamInfos().end());
 
+    mqbstat::MessageTracer::record(
+        mqbstat::MessageTracerStage::e_QUEUE_DISPATCHER,
+        putHeader.messageGUID());
+
     // REVISIT: This assumes no MessageProperties access before this point.
     //          As a result, SchemaLearner can be per queue and therefore
     //          single-threaded.
@@ -445,6 +527,22 @@ void LocalQueue::postMessage(const bmqp::PutHeader&              putHeader,
         putHeader.crc32c(),
         timeStamp);  // Arrival Timepoint
 
+    const bsl::string& priorityProperty =
+        d_state_p->domain()->config().priorityProperty();
+    const bsl::string& deliveryTimeProperty =
+        d_state_p->domain()->config().deliveryTimeProperty();
+    if ((!priorityProperty.empty() || !deliveryTimeProperty.empty()) &&
+        loadProperties(*appData, translation)) {
+        if (!priorityProperty.empty()) {
+            attributes.setPriority(messagePriority(priorityProperty));
+        }
+        if (!deliveryTimeProperty.empty()) {
+            attributes.setDeliveryTimestamp(
+                messageDeliveryTimestamp(deliveryTimeProperty,
+                                         attributes.arrivalTimestamp()));
+        }
+    }
+
     mqbi::StorageResult::Enum res = d_state_p->storage()->put(
         &attributes,
         putHeader.messageGUID(),
@@ -504,6 +602,18 @@ void LocalQueue::postMessage(const bmqp::PutHeader&              putHeader,
             }
         }
         else {
+            if (res == mqbi::StorageResult::e_INVALID_OPERATION) {
+                MWCU_THROTTLEDACTION_THROTTLE(
+                    d_throttledFailedPutMessages,
+                    BALL_LOG_WARN << "#CLIENT_IMPROPER_BEHAVIOR "
+                                  << "Rejected PUT message for queue ["
+                                  << d_state_p->uri() << "] from client ["
+                                  << source->client()->description()
+                                  << "], GUID [" << putHeader.messageGUID()
+                                  << "]: invalid message attributes (e.g., "
+                                  << "delivery time too far ahead).";);
+            }
+
             d_state_p->stats().onEvent(
                 mqbstat::QueueStatsDomain::EventType::e_NACK,
                 1);
@@ -32,7 +32,9 @@
 
 // BMQ
 #include <bmqp_ctrlmsg_messages.h>
+#include <bmqp_messageproperties.h>
 #include <bmqp_protocol.h>
+#include <bmqp_schemalearner.h>
 #include <bmqt_messageguid.h>
 
 // MWC
@@ -91,6 +93,14 @@ class LocalQueue BSLS_CPP11_FINAL {
     // Throttler for duplicates.
     bool d_haveStrongConsistency;
 
+    bmqp::SchemaLearner::Context d_schemaLearnerContext;
+    // Context for reading the properties of
+    // the posted messages.
+
+    bmqp::MessageProperties d_properties;
+    // Properties of the last posted message
+    // whose priority was read.
+
   private:
     // NOT IMPLEMENTED
     LocalQueue(const LocalQueue& other) BSLS_CPP11_DELETED;
@@ -98,6 +108,36 @@ class LocalQueue BSLS_CPP11_FINAL {
     /// Copy constructor and assignment operator are not implemented
     LocalQueue& operator=(const LocalQueue& other) BSLS_CPP11_DELETED;
 
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Load into `d_properties` the properties of the message having the
+    /// specified `appData` and `messagePropertiesInfo`.  Return true on
+    /// success, or false if the message has no properties or if they cannot
+    /// be read.
+    bool
+    loadProperties(const bdlbb::Blob&                 appData,
+                   const bmqp::MessagePropertiesInfo& messagePropertiesInfo);
+
+    // PRIVATE ACCESSORS
+
+    /// Return the delivery priority of the message whose properties are
+    /// loaded in `d_properties`, read from its int32 property named by the
+    /// specified `propertyName` and clamped to the priority levels of the
+    /// storage, or 0 if the message has no such property.
+    int messagePriority(const bsl::string& propertyName) const;
+
+    /// Return the delivery time, in seconds from epoch, of the message
+    /// whose properties are loaded in `d_properties` and which arrived at
+    /// the specified `arrivalTimestamp`, read from its property named by the
+    /// specified `propertyName`, or 0 if the message has no such property
+    /// or if it is due on arrival.  An int64 property is the delivery time
+    /// in milliseconds from epoch, and an int32 property is the delay in
+    /// milliseconds after arrival, both rounded up to the next second.
+    bsls::Types::Uint64
+    messageDeliveryTimestamp(const bsl::string&  propertyName,
+                             bsls::Types::Uint64 arrivalTimestamp) const;
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(LocalQueue, bslma::UsesBslmaAllocator)
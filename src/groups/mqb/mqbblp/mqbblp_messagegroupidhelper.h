@@ -87,8 +87,8 @@ class MessageGroupIdHelper {
     mqbi::QueueHandle* getHandle(const bmqp::Protocol::MsgGroupId& msgGroupId);
 
     /// Add the specified `handle` to the set of available handles.  If the
-    /// rebalance mode is enabled, existing Message Group Ids will be
-    /// allocated to this `handle`.
+    /// rebalance or consistent hashing mode is enabled, existing Message
+    /// Group Ids will be allocated to this `handle`.
     void addHandle(mqbi::QueueHandle* handle);
 
     /// Remove the specified `handle` from the set of available handles.
@@ -117,8 +117,10 @@ inline MessageGroupIdHelper::MessageGroupIdHelper(
     bslma::Allocator*                 allocator)
 : d_manager(config.ttlSeconds(),
             config.maxGroups(),
-            (config.rebalance() ? MessageGroupIdManager::k_REBALANCE_ON
-                                : MessageGroupIdManager::k_REBALANCE_OFF),
+            (config.consistentHashing()
+                 ? MessageGroupIdManager::k_REBALANCE_CONSISTENT_HASHING
+             : config.rebalance() ? MessageGroupIdManager::k_REBALANCE_ON
+                                  : MessageGroupIdManager::k_REBALANCE_OFF),
             allocator)
 {
     // NOTHING
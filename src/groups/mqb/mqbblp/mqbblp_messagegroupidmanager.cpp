@@ -77,6 +77,18 @@
 //              | d) LeastLoadedHandleFirst  |--+
 //              +----------------------------+
 //
+// In consistent hashing mode, 2 additional data structures are maintained:
+//
+// e)  A sorted vector ('Ring') of points of the hash ring, each one
+//     referring to the 'HandleToGroups::iterator' of the Handle owning the
+//     arc of the ring ending at this point.  Each Handle has
+//     'k_NUM_VIRTUAL_NODES' points.  This allows to find the Handle of a new
+//     Message Group Id in 'O(log(numPoints))'.
+// f)  A multimap ('GroupsByHash') from the hash of a Message Group Id to its
+//     'MsgGroupIdInfo::iterator'.  This allows to find the Message Group Ids
+//     of an arc of the ring, so that only those are visited when a new Handle
+//     takes ownership of this arc.
+//
 
 // MQB
 #include <mqbcmd_messages.h>
@@ -86,9 +98,13 @@
 #include <mwcu_printutil.h>
 
 // BDE
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsl_functional.h>
 #include <bsl_iostream.h>
 #include <bsl_map.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 #include <bslim_printer.h>
 
 namespace BloombergLP {
@@ -96,6 +112,15 @@ namespace mqbblp {
 
 namespace {
 
+/// Number of points of the hash ring for each Handle in consistent hashing
+/// mode.
+const int k_NUM_VIRTUAL_NODES = 64;
+
+/// Maximum ratio between the number of Message Group Ids of a Handle and
+/// the average number of Message Group Ids per Handle, when assigning a
+/// Message Group Id in consistent hashing mode.
+const double k_MAX_LOAD_FACTOR = 1.25;
+
 /// A Handle and the time we last used it (for a given Message Group Id).
 typedef bsl::pair<MessageGroupIdManager::Handle, MessageGroupIdManager::Time>
     HandleAndTime;
@@ -206,6 +231,70 @@ typedef bsl::set<MsgGroupIdInfo::iterator, GroupLruComparator>
 typedef bsl::set<HandleToGroups::iterator, HandlesOrderPolicy>
     LeastLoadedHandleFirst;
 
+// ----------------
+// struct RingPoint
+// ----------------
+
+/// A point of the hash ring, owned by a Handle.
+struct RingPoint {
+    bsls::Types::Uint64      d_hash;
+    HandleToGroups::iterator d_handle;
+
+    RingPoint(bsls::Types::Uint64 hash, HandleToGroups::iterator handle)
+    : d_hash(hash)
+    , d_handle(handle)
+    {
+    }
+};
+
+/// Returns `true` if the specified `lhs` is before the specified `rhs` on
+/// the ring or `false` otherwise.
+bool operator<(const RingPoint& lhs, const RingPoint& rhs)
+{
+    if (lhs.d_hash != rhs.d_hash) {
+        return lhs.d_hash < rhs.d_hash;  // RETURN
+    }
+
+    // Same hash - give up and compare Handles themselves.
+    return lhs.d_handle->first < rhs.d_handle->first;
+}
+
+/// The points of the hash ring, sorted.  This is data structure e).
+typedef bsl::vector<RingPoint> Ring;
+
+/// A mapping from the hash of Message Group Ids to Message Group Ids.  This
+/// is data structure f).
+typedef bsl::multimap<bsls::Types::Uint64, MsgGroupIdInfo::iterator>
+    GroupsByHash;
+
+/// Returns the specified `value` with its bits mixed.
+bsls::Types::Uint64 mix(bsls::Types::Uint64 value)
+{
+    // Finalizer of 'splitmix64'
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ULL;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebULL;
+    value ^= value >> 31;
+    return value;
+}
+
+/// Returns the position on the hash ring of the specified `msgGroupId`.
+bsls::Types::Uint64
+hashFor(const MessageGroupIdManager::MsgGroupId& msgGroupId)
+{
+    return mix(bsl::hash<MessageGroupIdManager::MsgGroupId>()(msgGroupId));
+}
+
+/// Returns the position on the hash ring of the specified `virtualNode` of
+/// the specified `handle`.
+bsls::Types::Uint64 hashFor(const MessageGroupIdManager::Handle& handle,
+                            int                                  virtualNode)
+{
+    return mix(reinterpret_cast<bsls::Types::UintPtr>(handle) ^
+               mix(static_cast<bsls::Types::Uint64>(virtualNode) + 1));
+}
+
 /// Returns the last-seen timestamp for the `MsgGroupIdInfo` of the
 /// specified `value`.
 const MessageGroupIdManager::Time&
@@ -239,24 +328,57 @@ class MessageGroupIdManager::Index {
   private:
     // DATA
     bslma::Allocator*        d_allocator_p;
+    const bool               d_isConsistentHashing;
     HandleToGroups           d_handleToGroups;
     LeastLoadedHandleFirst   d_leastLoadedHandleFirst;
     MsgGroupIdInfo           d_msgGroupIdInfo;
     LeastUsedMsgGroupIdFirst d_leastUsedMsgGroupIdFirst;
+    Ring                     d_ring;
+    GroupsByHash             d_groupsByHash;
 
   private:
     // NOT IMPLEMENTED
     Index(const Index&);             // = delete
     Index& operator=(const Index&);  // = delete
 
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Returns the Handle to assign a new Message Group Id having the
+    /// specified `hash` to, in consistent hashing mode.
+    HandleToGroups::iterator selectFromRing(bsls::Types::Uint64 hash);
+
+    /// Assign the specified `target` Message Group Id to the specified
+    /// `handle`.
+    void reassign(const MsgGroupIdInfo::iterator& target,
+                  HandleToGroups::iterator        handle);
+
+    /// Move to the specified `handle` the Message Group Ids hashing to the
+    /// arc of the ring ending at the specified `point`, as long as `handle`
+    /// has less than the specified `maxLoad` Message Group Ids.
+    void takeOverArc(const Ring::const_iterator& point,
+                     HandleToGroups::iterator    handle,
+                     size_t                      maxLoad);
+
+    /// Remove the specified `target` from data structure f).
+    void eraseHash(const MsgGroupIdInfo::iterator& target);
+
+    // PRIVATE ACCESSORS
+
+    /// Returns the maximum number of Message Group Ids a Handle should have
+    /// when there are the specified `numMsgGroupIds`, in consistent hashing
+    /// mode.
+    size_t maxLoad(size_t numMsgGroupIds) const;
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(Index, bslma::UsesBslmaAllocator)
 
     // CREATORS
 
-    /// Creates a new `Index` using the specified `allocator_p`.
-    explicit Index(bslma::Allocator* allocator_p);
+    /// Creates a new `Index` using the specified `isConsistentHashing`
+    /// mode and the specified `allocator_p`.
+    Index(bool isConsistentHashing, bslma::Allocator* allocator_p);
 
     // MANIPULATORS
 
@@ -270,7 +392,8 @@ class MessageGroupIdManager::Index {
     void removeHandle(const Handle& handle);
 
     /// Inserts a new mapping for the specified `msgGroupId` and `lastSeen`
-    /// to the appropriate (least loaded) Handle.
+    /// to the appropriate Handle (the least loaded one, or the one selected
+    /// from the ring in consistent hashing mode).
     MsgGroupIdInfo::iterator insert(const MsgGroupId& msgGroupId,
                                     const Time&       lastSeen);
 
@@ -320,13 +443,134 @@ class MessageGroupIdManager::Index {
     void idsForHandle(IdsForHandle* ids, const Handle& handle) const;
 };
 
+// PRIVATE MANIPULATORS
+HandleToGroups::iterator
+MessageGroupIdManager::Index::selectFromRing(bsls::Types::Uint64 hash)
+{
+    BSLS_ASSERT_SAFE(!d_ring.empty());
+
+    const size_t maxLoadPerHandle = maxLoad(d_msgGroupIdInfo.size() + 1);
+
+    // Walk the ring clockwise from 'hash' until finding a Handle which is
+    // not overloaded.  Since 'k_MAX_LOAD_FACTOR > 1', there is always one.
+    Ring::const_iterator it = bsl::lower_bound(
+        d_ring.begin(),
+        d_ring.end(),
+        RingPoint(hash, d_ring.front().d_handle));
+    for (size_t i = 0; i < d_ring.size(); ++i, ++it) {
+        if (it == d_ring.end()) {
+            it = d_ring.begin();
+        }
+        if (it->d_handle->second.size() < maxLoadPerHandle) {
+            return it->d_handle;  // RETURN
+        }
+    }
+
+    BSLS_ASSERT_SAFE(false && "No handle below the maximum load");
+    return *d_leastLoadedHandleFirst.begin();
+}
+
+void MessageGroupIdManager::Index::reassign(
+    const MsgGroupIdInfo::iterator& target,
+    HandleToGroups::iterator        handle)
+{
+    const HandleToGroups::iterator from = d_handleToGroups.find(
+        handleFor(*target));
+    BSLS_ASSERT_SAFE(from != d_handleToGroups.end());
+    BSLS_ASSERT_SAFE(from != handle);
+
+    // Update data structures c) and d) for both Handles (see 'insert()' for
+    // why d) has to be updated in 2 steps).
+    d_leastLoadedHandleFirst.erase(from);
+    const int count = from->second.erase(target);
+    BSLS_ASSERT_SAFE(count == 1);
+    (void)count;
+    d_leastLoadedHandleFirst.insert(from);
+
+    d_leastLoadedHandleFirst.erase(handle);
+    const bool inserted = handle->second.insert(target).second;
+    BSLS_ASSERT_SAFE(inserted);
+    (void)inserted;
+    d_leastLoadedHandleFirst.insert(handle);
+
+    // Update data structure a).  Data structures b), e) and f) are not
+    // affected.
+    target->second.first = handle->first;
+}
+
+void MessageGroupIdManager::Index::takeOverArc(
+    const Ring::const_iterator& point,
+    HandleToGroups::iterator    handle,
+    size_t                      maxLoad)
+{
+    // The arc ends at 'point' (included) and starts after the previous point
+    // of the ring (excluded), possibly wrapping around.
+    const Ring::const_iterator previous = (point == d_ring.begin())
+                                              ? d_ring.end() - 1
+                                              : point - 1;
+
+    const GroupsByHash::iterator begin = d_groupsByHash.upper_bound(
+        previous->d_hash);
+    const GroupsByHash::iterator end = d_groupsByHash.upper_bound(
+        point->d_hash);
+    const bool isWrapping = previous->d_hash >= point->d_hash;
+
+    GroupsByHash::iterator it         = begin;
+    bool                   hasWrapped = !isWrapping;
+    while (handle->second.size() < maxLoad) {
+        if (!hasWrapped && it == d_groupsByHash.end()) {
+            it         = d_groupsByHash.begin();
+            hasWrapped = true;
+            continue;  // CONTINUE
+        }
+        if (hasWrapped && it == end) {
+            break;  // BREAK
+        }
+        if (handleFor(*it->second) != handle->first) {
+            reassign(it->second, handle);
+        }
+        ++it;
+    }
+}
+
+void MessageGroupIdManager::Index::eraseHash(
+    const MsgGroupIdInfo::iterator& target)
+{
+    typedef bsl::pair<GroupsByHash::iterator, GroupsByHash::iterator> Range;
+
+    const Range range = d_groupsByHash.equal_range(
+        hashFor(msgGroupIdFor(*target)));
+    for (GroupsByHash::iterator it = range.first; it != range.second; ++it) {
+        if (it->second == target) {
+            d_groupsByHash.erase(it);
+            return;  // RETURN
+        }
+    }
+
+    BSLS_ASSERT_SAFE(false && "Message Group Id not found in the ring");
+}
+
+// PRIVATE ACCESSORS
+size_t MessageGroupIdManager::Index::maxLoad(size_t numMsgGroupIds) const
+{
+    BSLS_ASSERT_SAFE(!d_handleToGroups.empty());
+
+    const double average = static_cast<double>(numMsgGroupIds) /
+                           static_cast<double>(d_handleToGroups.size());
+    return static_cast<size_t>(bsl::ceil(k_MAX_LOAD_FACTOR * average));
+}
+
 // CREATORS
-MessageGroupIdManager::Index::Index(bslma::Allocator* allocator_p)
+MessageGroupIdManager::Index::Index(bool              isConsistentHashing,
+                                    bslma::Allocator* allocator_p)
 : d_allocator_p(allocator_p)
+, d_isConsistentHashing(isConsistentHashing)
 , d_handleToGroups(allocator_p)
 , d_leastLoadedHandleFirst(allocator_p)
 , d_msgGroupIdInfo(allocator_p)
 , d_leastUsedMsgGroupIdFirst(allocator_p)
+, d_ring(allocator_p)
+, d_groupsByHash(allocator_p)
 {
 }
 
@@ -345,6 +589,31 @@ void MessageGroupIdManager::Index::addHandle(const Handle& handle)
 
     // Add to data structure d).
     d_leastLoadedHandleFirst.insert(result.first);
+
+    if (!d_isConsistentHashing) {
+        return;  // RETURN
+    }
+
+    // Add to data structure e).
+    for (int i = 0; i < k_NUM_VIRTUAL_NODES; ++i) {
+        d_ring.push_back(RingPoint(hashFor(handle, i), result.first));
+    }
+    bsl::sort(d_ring.begin(), d_ring.end());
+
+    if (d_handleToGroups.size() == 1) {
+        // No other Handle, hence no Message Group Id to take over.
+        BSLS_ASSERT_SAFE(d_msgGroupIdInfo.empty());
+        return;  // RETURN
+    }
+
+    // Take over the Message Group Ids of the arcs now owned by 'handle'.
+    // Note that only the arcs are visited, and not all the Message Group Ids.
+    const size_t maxLoadPerHandle = maxLoad(d_msgGroupIdInfo.size());
+    for (Ring::const_iterator it = d_ring.begin(); it != d_ring.end(); ++it) {
+        if (it->d_handle == result.first) {
+            takeOverArc(it, result.first, maxLoadPerHandle);
+        }
+    }
 }
 
 void MessageGroupIdManager::Index::removeHandle(const Handle& handle)
@@ -374,10 +643,25 @@ void MessageGroupIdManager::Index::removeHandle(const Handle& handle)
         BSLS_ASSERT_SAFE(erased == 1);
         (void)erased;
 
+        // Remove from data structure f).
+        if (d_isConsistentHashing) {
+            eraseHash(iterator);
+        }
+
         // Remove from data structure a).
         d_msgGroupIdInfo.erase(iterator);
     }
 
+    // Remove from data structure e).
+    for (Ring::iterator rit = d_ring.begin(); rit != d_ring.end();) {
+        if (rit->d_handle == it) {
+            rit = d_ring.erase(rit);
+        }
+        else {
+            ++rit;
+        }
+    }
+
     // Bulk erase from data structures c) and d).
     d_leastLoadedHandleFirst.erase(it);
     d_handleToGroups.erase(it);
@@ -389,9 +673,14 @@ MessageGroupIdManager::Index::insert(const MsgGroupId& msgGroupId,
 {
     BSLS_ASSERT_SAFE(!d_leastLoadedHandleFirst.empty());
 
-    // Get a handle from data structure d).  We can directly update c) by using
-    // it.
-    HandleToGroups::iterator it = *d_leastLoadedHandleFirst.begin();
+    // Get a handle from data structure e) in consistent hashing mode, or d)
+    // otherwise.  We can directly update c) by using it.
+    const bsls::Types::Uint64 hash = d_isConsistentHashing
+                                         ? hashFor(msgGroupId)
+                                         : 0;
+    HandleToGroups::iterator  it   = d_isConsistentHashing
+                                         ? selectFromRing(hash)
+                                         : *d_leastLoadedHandleFirst.begin();
 
     const Handle& handle = it->first;
 
@@ -408,6 +697,11 @@ MessageGroupIdManager::Index::insert(const MsgGroupId& msgGroupId,
     // Insert to data structure b).
     d_leastUsedMsgGroupIdFirst.insert(mit);
 
+    // Insert to data structure f).
+    if (d_isConsistentHashing) {
+        d_groupsByHash.insert(bsl::make_pair(hash, mit));
+    }
+
     // Update data structure d) (1/2).  This is a 2-step process because 'it'
     // won't be found if we try to 'erase()' after modifying the number of
     // Message Group Ids, since that number is incorporated in the comparison
@@ -457,7 +751,7 @@ void MessageGroupIdManager::Index::fixSize(
         MsgGroupIdSet::iterator mit           = msgGroupIdSet.begin();
         for (int i = 0; i < toTax; ++i) {
             tax->push_back(**mit);
-            // 'erase()' modifies all four data structures.
+            // 'erase()' modifies all the data structures.
             erase(*mit++);
         }
     }
@@ -496,6 +790,11 @@ void MessageGroupIdManager::Index::erase(
     BSLS_ASSERT_SAFE(erased == 1);
     (void)erased;
 
+    // Remove from data structure f).
+    if (d_isConsistentHashing) {
+        eraseHash(iterator);
+    }
+
     // Remove from data structure a).
     d_msgGroupIdInfo.erase(iterator);
 }
@@ -624,7 +923,9 @@ MessageGroupIdManager::MessageGroupIdManager(const Time&       timeout,
 , d_timeout(timeout)
 , d_maxMsgGroupIds(maxMsgGroupIds)
 , d_rebalance(rebalance)
-, d_index(new (*allocator) Index(allocator), allocator)
+, d_index(new (*allocator)
+              Index(rebalance == k_REBALANCE_CONSISTENT_HASHING, allocator),
+          allocator)
 {
 }
 
@@ -637,7 +938,7 @@ MessageGroupIdManager::getHandle(const MsgGroupId& msgGroupId, const Time& now)
     MsgGroupIdInfo::iterator current = d_index->find(msgGroupId);
     if (current == d_index->end()) {
         const bool cantFitOneMore = exceedsMappingsLimit(1);
-        if (cantFitOneMore && isRebalance()) {
+        if (cantFitOneMore && (isRebalance() || isConsistentHashing())) {
             // With rebalanced queues, re-allocate the LRU if we run-out of
             // Message Group Ids.
             MsgGroupIdInfo::iterator target = d_index->lru();
@@ -720,6 +1021,11 @@ bool MessageGroupIdManager::isRebalance() const
     return (d_rebalance == k_REBALANCE_ON);
 }
 
+bool MessageGroupIdManager::isConsistentHashing() const
+{
+    return (d_rebalance == k_REBALANCE_CONSISTENT_HASHING);
+}
+
 bool MessageGroupIdManager::exceedsMaxMsgGroupIdsLimit() const
 {
     return exceedsMappingsLimit(0);
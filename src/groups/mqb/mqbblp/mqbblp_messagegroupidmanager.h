@@ -39,6 +39,16 @@
 // Message Group Ids from one Handle to another and occurs when a new Handle is
 // added.  This will get excessive Message Group Ids from Handles with more
 // than average Message Group Ids and re-distribute them to the other Handles.
+//
+// In consistent hashing mode, each Handle is placed at several points of a
+// hash ring, and a new Message Group Id is assigned to the first Handle found
+// clockwise from the hash of the Message Group Id whose number of Message
+// Group Ids is below '(1 + epsilon)' times the average ("bounded loads").
+// When a Handle is added, only the Message Group Ids hashing to the arcs of
+// the ring now owned by this Handle are moved to it, and when a Handle is
+// removed, only its own Message Group Ids are discarded.  A topology change
+// therefore affects about '1 / numHandles' of the Message Group Ids, instead
+// of most of them.
 
 // MQB
 
@@ -90,7 +100,8 @@ class MessageGroupIdManager {
     enum Rebalance {
         // Currently supported modes for rebalance functionality.
         k_REBALANCE_ON,
-        k_REBALANCE_OFF
+        k_REBALANCE_OFF,
+        k_REBALANCE_CONSISTENT_HASHING
     };
 
   private:
@@ -160,8 +171,11 @@ class MessageGroupIdManager {
 
     /// Add the specified `handle` to the set of available handles.  If the
     /// rebalance mode is enabled, existing Message Group Ids will be
-    /// allocated to this `handle`.  In the process mappings might be
-    /// discarded if they expire before or at the specified `now` time.
+    /// allocated to this `handle`.  If the consistent hashing mode is
+    /// enabled, the existing Message Group Ids hashing to the arcs of the
+    /// ring owned by `handle` will be allocated to it.  In the process
+    /// mappings might be discarded if they expire before or at the
+    /// specified `now` time.
     void addHandle(const Handle& handle, const Time& now);
 
     /// Remove the specified `handle` from the set of available handles.
@@ -192,6 +206,10 @@ class MessageGroupIdManager {
     /// Returns `true` if rebalance mode is enabled and `false` otherwise.
     bool isRebalance() const;
 
+    /// Returns `true` if consistent hashing mode is enabled and `false`
+    /// otherwise.
+    bool isConsistentHashing() const;
+
     /// Returns `true` if the current number of mappings exceeds the
     /// configured one.  This might be the case when rebalance is not
     /// enabled.
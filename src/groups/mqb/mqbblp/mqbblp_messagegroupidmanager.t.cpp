@@ -31,6 +31,7 @@
 // BDE
 #include <bdlma_localsequentialallocator.h>
 #include <bsl_algorithm.h>
+#include <bsl_cmath.h>
 #include <bsl_cstdlib.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
@@ -887,6 +888,154 @@ static void test13_largeMessageGroupIdsUseAllocator()
     }
 }
 
+static void test14_consistentHashingAddHandleTest()
+// ------------------------------------------------------------------------
+// CONSISTENT HASHING ADD HANDLE TEST
+//
+// Concerns:
+//   In consistent hashing mode, no handle gets more than its bounded share
+//   of Message Group Ids, and adding a handle only moves Message Group Ids
+//   to the new handle, about '1 / N' of them.
+//
+// Plan:
+//   Add 10 handles and 10000 Message Group Ids, and check the number of
+//   Message Group Ids per handle.  Then add a handle, and check that all
+//   Message Group Ids which moved were moved to the new handle.
+//
+// Testing:
+//   getHandle, addHandle
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("CONSISTENT HASHING ADD HANDLE TEST");
+
+    typedef MessageGroupIdManager::IdsForHandle IdsForHandle;
+
+    const int k_HANDLES_COUNT       = 10;
+    const int k_MSG_GROUP_IDS_COUNT = 10000;
+
+    MessageGroupIdManager obj(
+        k_TIMEOUT,
+        k_MAX_NUMBER_OF_MAPPINGS,
+        MessageGroupIdManager::k_REBALANCE_CONSISTENT_HASHING,
+        s_allocator_p);
+    ASSERT(obj.isConsistentHashing());
+    ASSERT(!obj.isRebalance());
+
+    addHandles(&obj, k_HANDLES_COUNT);
+
+    bsl::vector<Handle> before(k_MSG_GROUP_IDS_COUNT, s_allocator_p);
+    for (int i = 0; i < k_MSG_GROUP_IDS_COUNT; ++i) {
+        before[i] = obj.getHandle(msgGroupIdFromInt(i), k_T0);
+    }
+
+    // Same Message Group Id, same handle
+    for (int i = 0; i < k_MSG_GROUP_IDS_COUNT; i += 100) {
+        ASSERT_EQ(obj.getHandle(msgGroupIdFromInt(i), k_T0), before[i]);
+    }
+
+    // Bounded loads
+    const int k_MAX_LOAD = static_cast<int>(
+        bsl::ceil(1.25 * k_MSG_GROUP_IDS_COUNT / k_HANDLES_COUNT));
+    for (int i = 0; i < k_HANDLES_COUNT; ++i) {
+        IdsForHandle gids(s_allocator_p);
+        obj.idsForHandle(&gids, _(i));
+        ASSERT_D(i, static_cast<int>(gids.size()) <= k_MAX_LOAD);
+        ASSERT_D(i, !gids.empty());
+    }
+
+    // A new handle arrives
+    const Handle newHandle = _(k_HANDLES_COUNT);
+    obj.addHandle(newHandle, k_T0);
+    ASSERT_EQ(obj.msgGroupIdsCount(), k_MSG_GROUP_IDS_COUNT);
+
+    int moved = 0;
+    for (int i = 0; i < k_MSG_GROUP_IDS_COUNT; ++i) {
+        const Handle h = obj.getHandle(msgGroupIdFromInt(i), k_T0);
+        if (h != before[i]) {
+            ASSERT_EQ_D(i, h, newHandle);
+            ++moved;
+        }
+    }
+
+    IdsForHandle gids(s_allocator_p);
+    obj.idsForHandle(&gids, newHandle);
+    ASSERT_EQ(static_cast<int>(gids.size()), moved);
+
+    // About '1 / (k_HANDLES_COUNT + 1)' of the Message Group Ids moved
+    const int k_FAIR_SHARE = k_MSG_GROUP_IDS_COUNT / (k_HANDLES_COUNT + 1);
+    ASSERT_GT(moved, k_FAIR_SHARE / 2);
+    ASSERT_LT(moved, 2 * k_FAIR_SHARE);
+}
+
+static void test15_consistentHashingRemoveHandleTest()
+// ------------------------------------------------------------------------
+// CONSISTENT HASHING REMOVE HANDLE TEST
+//
+// Concerns:
+//   In consistent hashing mode, removing a handle does not move any
+//   Message Group Id of the other handles, and the Message Group Ids of the
+//   removed handle are re-allocated to the remaining handles.
+//
+// Plan:
+//   Add 5 handles and 1000 Message Group Ids, remove a handle and check
+//   the Message Group Ids of every handle.
+//
+// Testing:
+//   getHandle, removeHandle
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName(
+        "CONSISTENT HASHING REMOVE HANDLE TEST");
+
+    typedef MessageGroupIdManager::IdsForHandle IdsForHandle;
+
+    const int k_HANDLES_COUNT       = 5;
+    const int k_MSG_GROUP_IDS_COUNT = 1000;
+
+    MessageGroupIdManager obj(
+        k_TIMEOUT,
+        k_MAX_NUMBER_OF_MAPPINGS,
+        MessageGroupIdManager::k_REBALANCE_CONSISTENT_HASHING,
+        s_allocator_p);
+    addHandles(&obj, k_HANDLES_COUNT);
+
+    for (int i = 0; i < k_MSG_GROUP_IDS_COUNT; ++i) {
+        (void)obj.getHandle(msgGroupIdFromInt(i), k_T0);
+    }
+
+    bsl::vector<IdsForHandle> before(k_HANDLES_COUNT, s_allocator_p);
+    for (int i = 0; i < k_HANDLES_COUNT; ++i) {
+        obj.idsForHandle(&before[i], _(i));
+    }
+
+    // Remove a handle
+    const int toRemove = 2;
+    obj.removeHandle(_(toRemove));
+    ASSERT_EQ(obj.handlesCount(), k_HANDLES_COUNT - 1);
+    ASSERT_EQ(obj.msgGroupIdsCount(),
+              k_MSG_GROUP_IDS_COUNT -
+                  static_cast<int>(before[toRemove].size()));
+
+    bsl::vector<IdsForHandle> after(k_HANDLES_COUNT, s_allocator_p);
+    for (int i = 0; i < k_HANDLES_COUNT; ++i) {
+        obj.idsForHandle(&after[i], _(i));
+        if (i == toRemove) {
+            ASSERT_EQ(0u, after[i].size());
+        }
+        else {
+            ASSERT_EQ_D(i, before[i], after[i]);
+        }
+    }
+
+    // The Message Group Ids of the removed handle are re-allocated
+    for (IdsForHandle::const_iterator it = before[toRemove].begin();
+         it != before[toRemove].end();
+         ++it) {
+        ASSERT(obj.getHandle(*it, k_T0) != _(toRemove));
+    }
+    ASSERT_EQ(obj.msgGroupIdsCount(), k_MSG_GROUP_IDS_COUNT);
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -909,6 +1058,8 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 15: test15_consistentHashingRemoveHandleTest(); break;
+    case 14: test14_consistentHashingAddHandleTest(); break;
     case 13: test13_largeMessageGroupIdsUseAllocator(); break;
     case 12: test12_printerTest(); break;
     case 11: test11_stronglyUnbalancedChainOnRebalanceTest(); break;
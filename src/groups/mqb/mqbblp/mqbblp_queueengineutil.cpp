@@ -70,6 +70,12 @@ const bsls::Types::Int64 k_MAX_SECONDS =
 
 const int k_MAX_NANOSECONDS = 999999999;
 
+const int k_MAX_DELIVERY_BATCH_SIZE = 64;
+// Maximum number of messages delivered in one batch by
+// 'QueueEngineUtil_AppState::deliverMessages'.  This bounds the number of
+// messages handed over to a client in one event, and how stale the time
+// used to throttle the deliveries of a batch can be.
+
 /// Dummy method enqueued to the associated client's dispatcher thread when
 /// the specified `handle` was dropped and deleted without providing a
 /// `releasedCb`, in order to delay its destruction until after the client's
@@ -817,6 +823,8 @@ QueueEngineUtil_AppState::QueueEngineUtil_AppState(
 , d_appId(appId)
 , d_upstreamSubQueueId(upstreamSubQueueId)
 , d_isScheduled(false)
+, d_deliveryBatch(allocator)
+, d_isDeliveryBatchActive(false)
 {
     // Above, we retrieve domain config from 'queue' only if self node is a
     // cluster member, and pass a dummy config if self is proxy, because proxy
@@ -861,45 +869,105 @@ QueueEngineUtil_AppState::deliverMessages(bsls::TimeInterval*     delay,
     //   2. subStream's capacity is saturated
     mqbi::StorageIterator* storageIter_p = d_storageIter_mp.get();
 
-    while (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(storageIter_p->hasReceipt())) {
-        Routers::Result result = Routers::e_SUCCESS;
-
-        if (QueueEngineUtil::isBroadcastMode(d_queue_p)) {
-            broadcastOneMessage(storageIter_p);
-        }
-        else {
-            result = tryDeliverOneMessage(delay, storageIter_p);
-
-            if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
-                    result == Routers::e_NO_CAPACITY ||
-                    result == Routers::e_NO_SUBSCRIPTION)) {
-                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-                d_putAsideList.add(storageIter_p->guid());
-                // Do not block other Subscriptions. Continue.
+    // The queue mode and queue id do not change while delivering messages:
+    // evaluate them only once instead of once per message.
+    const bool isBroadcast = QueueEngineUtil::isBroadcastMode(d_queue_p);
+    const bool isPrimary   = bmqp::QueueId::k_PRIMARY_QUEUE_ID ==
+                           d_queue_p->id();
+    bool       isDone      = false;
+
+    while (!isDone &&
+           BSLS_PERFORMANCEHINT_PREDICT_LIKELY(storageIter_p->hasReceipt())) {
+        // Deliver a batch of at most 'k_MAX_DELIVERY_BATCH_SIZE' messages.
+        // Routing is still evaluated per message, since it depends on the
+        // properties of each message, but the messages delivered to the same
+        // handle are dispatched to its client in one event at the end of the
+        // batch.  The current time is read once per batch.
+        const bsls::TimeInterval now = mwcsys::Time::nowMonotonicClock();
+        d_isDeliveryBatchActive      = true;
+
+        for (int batchSize = 0; batchSize < k_MAX_DELIVERY_BATCH_SIZE &&
+                                storageIter_p->hasReceipt();
+             ++batchSize) {
+            Routers::Result result = Routers::e_SUCCESS;
+
+            if (isBroadcast) {
+                broadcastOneMessage(storageIter_p);
             }
-            else if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
-                         result != Routers::e_SUCCESS)) {
-                break;
+            else {
+                result = tryDeliverOneMessage(delay, storageIter_p, now);
+
+                if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                        result == Routers::e_NO_CAPACITY ||
+                        result == Routers::e_NO_SUBSCRIPTION)) {
+                    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+                    d_putAsideList.add(storageIter_p->guid());
+                    // Do not block other Subscriptions. Continue.
+                }
+                else if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                             result != Routers::e_SUCCESS)) {
+                    isDone = true;
+                    break;  // BREAK
+                }
             }
-        }
 
-        if (result == Routers::e_SUCCESS) {
-            if (bmqp::QueueId::k_PRIMARY_QUEUE_ID == d_queue_p->id()) {
-                QueueEngineUtil::reportQueueTimeMetric(
-                    d_queue_p->stats(),
-                    storageIter_p->attributes());
+            if (result == Routers::e_SUCCESS) {
+                if (isPrimary) {
+                    QueueEngineUtil::reportQueueTimeMetric(
+                        d_queue_p->stats(),
+                        storageIter_p->attributes());
+                }
+                ++numMessages;
             }
-            ++numMessages;
+
+            storageIter_p->advance();
         }
 
-        storageIter_p->advance();
+        endDeliveryBatch();
     }
     return numMessages;
 }
 
+void QueueEngineUtil_AppState::addToDeliveryBatch(mqbi::QueueHandle* handle)
+{
+    // executed by the *QUEUE DISPATCHER* thread
+
+    if (!d_isDeliveryBatchActive) {
+        return;  // RETURN
+    }
+
+    if (d_deliveryBatch.insert(handle).second) {
+        handle->beginDeliveryBatch();
+    }
+}
+
+void QueueEngineUtil_AppState::endDeliveryBatch()
+{
+    // executed by the *QUEUE DISPATCHER* thread
+
+    for (bsl::unordered_set<mqbi::QueueHandle*>::const_iterator it =
+             d_deliveryBatch.begin();
+         it != d_deliveryBatch.end();
+         ++it) {
+        (*it)->endDeliveryBatch();
+    }
+    d_deliveryBatch.clear();
+    d_isDeliveryBatchActive = false;
+}
+
 Routers::Result QueueEngineUtil_AppState::tryDeliverOneMessage(
     bsls::TimeInterval*          delay,
     const mqbi::StorageIterator* message)
+{
+    return tryDeliverOneMessage(delay,
+                                message,
+                                mwcsys::Time::nowMonotonicClock());
+}
+
+Routers::Result QueueEngineUtil_AppState::tryDeliverOneMessage(
+    bsls::TimeInterval*          delay,
+    const mqbi::StorageIterator* message,
+    const bsls::TimeInterval&    now)
 {
     // In order to try and deliver a message, we need to:
     //      1. Determine if a message has a delay based on its rdaInfo.
@@ -924,7 +992,6 @@ Routers::Result QueueEngineUtil_AppState::tryDeliverOneMessage(
     //         'delay' and return false.
 
     bsls::TimeInterval messageDelay;
-    bsls::TimeInterval now = mwcsys::Time::nowMonotonicClock();
     Visitor            visitor;
     Routers::Result    result = Routers::e_SUCCESS;
 
@@ -966,6 +1033,7 @@ Routers::Result QueueEngineUtil_AppState::tryDeliverOneMessage(
         1,
         bmqp::SubQueueInfo(visitor.d_downstreamSubscriptionId,
                            message->rdaInfo()));
+    addToDeliveryBatch(visitor.d_handle);
     visitor.d_handle->deliverMessage(message->appData(),
                                      message->guid(),
                                      message->attributes(),
@@ -1013,6 +1081,7 @@ bool QueueEngineUtil_AppState::visitBroadcast(
 {
     mqbi::QueueHandle* handle = subscription->handle();
     BSLS_ASSERT_SAFE(handle);
+    addToDeliveryBatch(handle);
     // TBD: groupId: send 'options' as well...
     handle->deliverMessageNoTrack(
         message->appData(),
@@ -1054,8 +1123,18 @@ QueueEngineUtil_AppState::processDeliveryList(bsls::TimeInterval*     delay,
     RedeliveryList::iterator it          = list.begin();
     bmqt::MessageGUID        firstGuid   = *it;
     size_t                   numMessages = 0;
+    const bool               isPrimary   = bmqp::QueueId::k_PRIMARY_QUEUE_ID ==
+                           d_queue_p->id();
+    bsls::TimeInterval       now;
+    int                      numAttempts = 0;
 
     while (!list.isEnd(it)) {
+        // Read the current time once per 'k_MAX_DELIVERY_BATCH_SIZE'
+        // messages, as in 'deliverMessages'.
+        if (numAttempts++ % k_MAX_DELIVERY_BATCH_SIZE == 0) {
+            now = mwcsys::Time::nowMonotonicClock();
+        }
+
         // Retrieve message from storage
         bslma::ManagedPtr<mqbi::StorageIterator> message;
 
@@ -1082,7 +1161,9 @@ QueueEngineUtil_AppState::processDeliveryList(bsls::TimeInterval*     delay,
         // Instead, should communicate them upstream either in CloseQueue or in
         // Rejects.
 
-        Routers::Result result = tryDeliverOneMessage(delay, message.get());
+        Routers::Result result = tryDeliverOneMessage(delay,
+                                                      message.get(),
+                                                      now);
 
         if (result == Routers::e_NO_CAPACITY_ALL) {
             break;  // BREAK
@@ -1095,7 +1176,7 @@ QueueEngineUtil_AppState::processDeliveryList(bsls::TimeInterval*     delay,
             it = list.erase(it);
 
             ++numMessages;
-            if (bmqp::QueueId::k_PRIMARY_QUEUE_ID == d_queue_p->id()) {
+            if (isPrimary) {
                 QueueEngineUtil::reportQueueTimeMetric(d_queue_p->stats(),
                                                        message->attributes());
             }
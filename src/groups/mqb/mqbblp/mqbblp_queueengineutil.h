@@ -381,6 +381,14 @@ struct QueueEngineUtil_AppState {
 
     bsls::AtomicBool d_isScheduled;
 
+    bsl::unordered_set<mqbi::QueueHandle*> d_deliveryBatch;
+    // Handles which were delivered messages
+    // in the current delivery batch.
+
+    bool d_isDeliveryBatchActive;
+    // Whether a delivery batch is in
+    // progress (see 'deliverMessages').
+
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(QueueEngineUtil_AppState,
                                    bslma::UsesBslmaAllocator)
@@ -415,7 +423,10 @@ struct QueueEngineUtil_AppState {
     /// this instance.  Load the message delay into the specified `delay`.
     /// Note that depending upon queue's mode, messages are delivered either
     /// to all consumers (broadcast mode), or in a round-robin manner (every
-    /// other mode).
+    /// other mode).  Note also that messages are delivered in batches of
+    /// bounded length: the messages of a batch delivered to the same handle
+    /// are dispatched to its client in a single event at the end of the
+    /// batch (see `mqbi::QueueHandle::beginDeliveryBatch`).
     size_t deliverMessages(bsls::TimeInterval*     delay,
                            const mqbu::StorageKey& appKey,
                            mqbi::Storage&          storage,
@@ -431,6 +442,13 @@ struct QueueEngineUtil_AppState {
     Routers::Result tryDeliverOneMessage(bsls::TimeInterval*          delay,
                                          const mqbi::StorageIterator* message);
 
+    /// Same as above, but use the specified `now` as the current time
+    /// (from the monotonic clock) instead of reading the clock.  This
+    /// allows to deliver a batch of messages reading the clock only once.
+    Routers::Result tryDeliverOneMessage(bsls::TimeInterval*          delay,
+                                         const mqbi::StorageIterator* message,
+                                         const bsls::TimeInterval&    now);
+
     /// Broadcast to all available consumers, the message having specified
     /// `appData`, `options`, `guid` and `attributes`.  Behavior is
     /// undefined unless `appData` is non-null.
@@ -438,6 +456,14 @@ struct QueueEngineUtil_AppState {
     bool visitBroadcast(const mqbi::StorageIterator* message,
                         const Routers::Subscription* subscription);
 
+    /// Add the specified `handle` to the current delivery batch, if any and
+    /// unless it is already part of it.
+    void addToDeliveryBatch(mqbi::QueueHandle* handle);
+
+    /// End the current delivery batch, dispatching to their clients the
+    /// messages delivered to the handles of the batch.
+    void endDeliveryBatch();
+
     size_t processDeliveryLists(bsls::TimeInterval*     delay,
                                 const mqbu::StorageKey& appKey,
                                 mqbi::Storage&          storage,
@@ -18,6 +18,8 @@
 
 #include <mqbscm_version.h>
 // MQB
+#include <mqbcfg_brokerconfig.h>
+#include <mqbcfg_messages.h>
 #include <mqbcmd_messages.h>
 #include <mqbi_dispatcher.h>
 #include <mqbi_domain.h>
@@ -91,6 +93,7 @@ QueueHandle::Subscription::Subscription(
     unsigned int                       upstreamId)
 
 : d_unconfirmedMonitor(0, 0, 0, 0, 0, 0)  // Set later
+, d_adaptiveWindow()
 , d_downstream(downstream)
 , d_downstreamSubQueueId(subId)
 , d_upstreamId(upstreamId)
@@ -103,6 +106,34 @@ const bsl::string& QueueHandle::Subscription::appId() const
     return d_downstream->d_appId;
 }
 
+// -------------------------------
+// struct QueueHandle::PendingPush
+// -------------------------------
+
+// CREATORS
+QueueHandle::PendingPush::PendingPush(bslma::Allocator* allocator)
+: d_message()
+, d_guid()
+, d_messagePropertiesInfo()
+, d_subQueueInfos(allocator)
+, d_msgGroupId(allocator)
+, d_compressionAlgorithmType(bmqt::CompressionAlgorithmType::e_NONE)
+{
+    // NOTHING
+}
+
+QueueHandle::PendingPush::PendingPush(const PendingPush& other,
+                                      bslma::Allocator*  allocator)
+: d_message(other.d_message)
+, d_guid(other.d_guid)
+, d_messagePropertiesInfo(other.d_messagePropertiesInfo)
+, d_subQueueInfos(other.d_subQueueInfos, allocator)
+, d_msgGroupId(other.d_msgGroupId, allocator)
+, d_compressionAlgorithmType(other.d_compressionAlgorithmType)
+{
+    // NOTHING
+}
+
 // -----------------
 // class QueueHandle
 // -----------------
@@ -320,11 +351,35 @@ QueueHandle::updateMonitor(const bsl::shared_ptr<Downstream>& subStream,
     }
 
     SubscriptionSp subscription = d_subscriptions[it->second.d_subscriptionId];
-    resourceUsageStateChange    = updateMonitor(it,
+    const bsls::Types::Int64 timeStamp = it->second.d_timeStamp;
+    resourceUsageStateChange = updateMonitor(it,
                                              subscription.get(),
                                              eventType);
     messages->erase(it);
 
+    // With adaptive flow control, delivery may also have been stopped by the
+    // adaptive window of the subscription, in which case it is resumed once
+    // enough messages have been confirmed (see 'mqbblp::AdaptiveWindow').  A
+    // rejected message is no longer unconfirmed either, and was processed by
+    // the consumer, so it is accounted for the same way as a confirmed one:
+    // otherwise a consumer rejecting the messages it is delivered would stop
+    // being delivered to once its window is full.
+    bool isWindowReopened = false;
+    if (d_isAdaptiveFlowControl && subscription &&
+        (eventType == bmqp::EventType::e_CONFIRM ||
+         eventType == bmqp::EventType::e_REJECT)) {
+        const mqbu::ResourceUsageMonitor& monitor =
+            subscription->d_unconfirmedMonitor;
+        const bsls::Types::Int64 now = mwcsys::Time::highResolutionTimer();
+
+        isWindowReopened = subscription->d_adaptiveWindow.onConfirmed(
+                               now,
+                               now - timeStamp,
+                               monitor.messages()) &&
+                           monitor.state() !=
+                               mqbu::ResourceUsageMonitorState::e_STATE_FULL;
+    }
+
     // As mentioned above, if we hit the maxUnconfirmed and are now back to
     // below the lowWatermark for BOTH messages and bytes, schedule a delivery
     // by indicating to the associated queue engine that this handle is now
@@ -351,7 +406,8 @@ QueueHandle::updateMonitor(const bsl::shared_ptr<Downstream>& subStream,
     // should mostly open the queue with a decently big value, even a high
     // ratio should still provide a decent batching experience.
 
-    if (resourceUsageStateChange == RUMStateTransition::e_LOW_WATERMARK) {
+    if (resourceUsageStateChange == RUMStateTransition::e_LOW_WATERMARK ||
+        isWindowReopened) {
         BSLS_ASSERT_SAFE(d_queue_sp->queueEngine() &&
                          "Queue has no engine associated !");
         d_queue_sp->queueEngine()->onHandleUsable(this,
@@ -489,6 +545,50 @@ void QueueHandle::deliverMessageImpl(
     d_domainStats_p->onEvent(mqbstat::QueueStatsDomain::EventType::e_PUSH,
                              msgSize);
 
+    const bmqp::MessagePropertiesInfo messagePropertiesInfo =
+        d_queue_sp->schemaLearner().demultiplex(
+            d_schemaLearnerPushContext,
+            attributes.messagePropertiesInfo());
+
+    if (!d_isBatchingDeliveries) {
+        dispatchPush(message,
+                     msgGUID,
+                     messagePropertiesInfo,
+                     subQueueInfos,
+                     msgGroupId,
+                     attributes.compressionAlgorithmType());
+        return;  // RETURN
+    }
+
+    // Keep the message until the end of the batch
+    if (!d_pendingPushes_sp) {
+        d_pendingPushes_sp.createInplace(d_allocator_p, d_allocator_p);
+    }
+
+    d_pendingPushes_sp->emplace_back();
+    PendingPush& push               = d_pendingPushes_sp->back();
+    push.d_message                  = message;
+    push.d_guid                     = msgGUID;
+    push.d_messagePropertiesInfo    = messagePropertiesInfo;
+    push.d_subQueueInfos            = subQueueInfos;
+    push.d_msgGroupId               = msgGroupId;
+    push.d_compressionAlgorithmType = attributes.compressionAlgorithmType();
+}
+
+void QueueHandle::dispatchPush(
+    const bsl::shared_ptr<bdlbb::Blob>&       message,
+    const bmqt::MessageGUID&                  msgGUID,
+    const bmqp::MessagePropertiesInfo&        messagePropertiesInfo,
+    const bmqp::Protocol::SubQueueInfosArray& subQueueInfos,
+    const bmqp::Protocol::MsgGroupId&         msgGroupId,
+    bmqt::CompressionAlgorithmType::Enum      compressionAlgorithmType)
+{
+    // executed by the *QUEUE_DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(
+        d_queue_sp->dispatcher()->inDispatcherThread(d_queue_sp.get()));
+
     // Create an event to dispatch delivery of the message to the client
     mqbi::DispatcherClient* client = d_clientContext_sp->client();
     mqbi::DispatcherEvent*  event  = client->dispatcher()->getEvent(client);
@@ -497,12 +597,10 @@ void QueueHandle::deliverMessageImpl(
         .setSource(d_queue_sp.get())
         .setGuid(msgGUID)
         .setQueueId(id())
-        .setMessagePropertiesInfo(d_queue_sp->schemaLearner().demultiplex(
-            d_schemaLearnerPushContext,
-            attributes.messagePropertiesInfo()))
+        .setMessagePropertiesInfo(messagePropertiesInfo)
         .setSubQueueInfos(subQueueInfos)
         .setMsgGroupId(msgGroupId)
-        .setCompressionAlgorithmType(attributes.compressionAlgorithmType());
+        .setCompressionAlgorithmType(compressionAlgorithmType);
 
     if (message) {
         event->setBlob(message);
@@ -511,6 +609,39 @@ void QueueHandle::deliverMessageImpl(
     client->dispatcher()->dispatchEvent(event, client);
 }
 
+void QueueHandle::processPendingPushes(
+    mqbi::DispatcherClient*               client,
+    mqbi::Queue*                          queue,
+    unsigned int                          queueId,
+    const bsl::shared_ptr<PendingPushes>& pushes,
+    bslma::Allocator*                     allocator)
+{
+    // executed by the *CLIENT* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(client->dispatcher()->inDispatcherThread(client));
+
+    // Hand over each message to the client as if it had been dispatched in
+    // its own PUSH event, reusing the same event for all of them.
+    mqbi::DispatcherEvent event(allocator);
+    for (PendingPushes::const_iterator it = pushes->begin();
+         it != pushes->end();
+         ++it) {
+        event.setType(mqbi::DispatcherEventType::e_PUSH)
+            .setSource(queue)
+            .setDestination(client)
+            .setGuid(it->d_guid)
+            .setQueueId(queueId)
+            .setMessagePropertiesInfo(it->d_messagePropertiesInfo)
+            .setSubQueueInfos(it->d_subQueueInfos)
+            .setMsgGroupId(it->d_msgGroupId)
+            .setCompressionAlgorithmType(it->d_compressionAlgorithmType)
+            .setBlob(it->d_message);
+
+        client->onDispatcherEvent(event);
+    }
+}
+
 QueueHandle::QueueHandle(
     const bsl::shared_ptr<mqbi::Queue>&                       queueSp,
     const bsl::shared_ptr<mqbi::QueueHandleRequesterContext>& clientContext,
@@ -526,11 +657,14 @@ QueueHandle::QueueHandle(
 , d_subStreamInfos(allocator)
 , d_downstreams(allocator)
 , d_isClientClusterMember(false)
+, d_isAdaptiveFlowControl(mqbcfg::BrokerConfig::get().adaptiveFlowControl())
 , d_deconfigureChain(allocator)
 , d_schemaLearnerPutContext(
       d_queue_sp ? d_queue_sp->schemaLearner().createContext() : 0)
 , d_schemaLearnerPushContext(
       d_queue_sp ? d_queue_sp->schemaLearner().createContext() : 0)
+, d_isBatchingDeliveries(false)
+, d_pendingPushes_sp()
 , d_allocator_p(allocator)
 {
     // PRECONDITIONS
@@ -793,6 +927,70 @@ void QueueHandle::deliverMessageNoTrack(
                        subQueueInfos);
 }
 
+void QueueHandle::beginDeliveryBatch()
+{
+    // executed by the *QUEUE_DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(
+        d_queue_sp->dispatcher()->inDispatcherThread(d_queue_sp.get()));
+    BSLS_ASSERT_SAFE(!d_isBatchingDeliveries);
+
+    d_isBatchingDeliveries = true;
+}
+
+void QueueHandle::endDeliveryBatch()
+{
+    // executed by the *QUEUE_DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(
+        d_queue_sp->dispatcher()->inDispatcherThread(d_queue_sp.get()));
+    BSLS_ASSERT_SAFE(d_isBatchingDeliveries);
+
+    d_isBatchingDeliveries = false;
+
+    if (!d_pendingPushes_sp || d_pendingPushes_sp->empty()) {
+        return;  // RETURN
+    }
+
+    if (d_pendingPushes_sp->size() == 1) {
+        // No need for a callback to deliver a single message
+        const PendingPush& push = d_pendingPushes_sp->front();
+        dispatchPush(push.d_message,
+                     push.d_guid,
+                     push.d_messagePropertiesInfo,
+                     push.d_subQueueInfos,
+                     push.d_msgGroupId,
+                     push.d_compressionAlgorithmType);
+        d_pendingPushes_sp->clear();
+        return;  // RETURN
+    }
+
+    // Hand over all the messages of the batch to the client in one PUSH
+    // event, whose callback processes each of them.  Unlike a callback event,
+    // it does not make the client flush the PUSH messages it is building.
+    // The messages are now owned by the callback, so that a new list is
+    // created for the next batch.
+    mqbi::DispatcherClient* client = d_clientContext_sp->client();
+    mqbi::DispatcherEvent*  event  = client->dispatcher()->getEvent(client);
+    (*event)
+        .setType(mqbi::DispatcherEventType::e_PUSH)
+        .setSource(d_queue_sp.get())
+        .setQueueId(id())
+        .setCallback(mqbi::Dispatcher::voidToProcessorFunctor(
+            bdlf::BindUtil::bindS(d_allocator_p,
+                                  &QueueHandle::processPendingPushes,
+                                  client,
+                                  d_queue_sp.get(),
+                                  id(),
+                                  d_pendingPushes_sp,
+                                  d_allocator_p)));
+
+    client->dispatcher()->dispatchEvent(event, client);
+    d_pendingPushes_sp.reset();
+}
+
 void QueueHandle::deliverMessage(
     const bsl::shared_ptr<bdlbb::Blob>&       message,
     const bmqt::MessageGUID&                  msgGUID,
@@ -857,6 +1055,10 @@ void QueueHandle::deliverMessage(
         //       monitor to change to 'STATE_FULL' and thus may impact the
         //       value returned by 'canDeliver'.
         subscription->d_unconfirmedMonitor.update(msgSize, 1);
+        if (d_isAdaptiveFlowControl) {
+            subscription->d_adaptiveWindow.onDelivered(
+                subscription->d_unconfirmedMonitor.messages());
+        }
 
         // NOTE: To simplify the logic, we always send at least one message
         //       (from the loop in the callers of this method), even if that
@@ -1094,6 +1296,7 @@ int QueueHandle::transferUnconfirmedMessageGUID(
         const SubscriptionSp& subscription = itSubscription->second;
         if (subscription->d_downstreamSubQueueId == subQueueId) {
             subscription->d_unconfirmedMonitor.reset();
+            subscription->d_adaptiveWindow.reset();
         }
     }
 
@@ -1202,9 +1405,14 @@ bool QueueHandle::canDeliver(unsigned int downstreamSubscriptionId) const
 
     BSLS_ASSERT_SAFE(cit != d_subscriptions.end());
 
+    const Subscription& subscription = *cit->second;
+
     return d_clientContext_sp &&
-           (cit->second->d_unconfirmedMonitor.state() !=
-            mqbu::ResourceUsageMonitorState::e_STATE_FULL);
+           (subscription.d_unconfirmedMonitor.state() !=
+            mqbu::ResourceUsageMonitorState::e_STATE_FULL) &&
+           (!d_isAdaptiveFlowControl ||
+            subscription.d_adaptiveWindow.canDeliver(
+                subscription.d_unconfirmedMonitor.messages()));
 }
 
 const bsl::vector<const mqbu::ResourceUsageMonitor*>
@@ -26,6 +26,7 @@
 
 // MQB
 
+#include <mqbblp_adaptivewindow.h>
 #include <mqbconfm_messages.h>
 #include <mqbi_queue.h>
 #include <mqbstat_queuestats.h>
@@ -33,6 +34,8 @@
 
 // BMQ
 #include <bmqp_ctrlmsg_messages.h>
+#include <bmqp_protocol.h>
+#include <bmqt_compressionalgorithmtype.h>
 #include <bmqt_messageguid.h>
 
 // MWC
@@ -45,6 +48,7 @@
 #include <bsl_list.h>
 #include <bsl_memory.h>
 #include <bsl_unordered_map.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
@@ -99,6 +103,12 @@ class QueueHandle : public mqbi::QueueHandle {
         // be manipulated from the
         // *QUEUE-DISPATCHER* thread.
 
+        AdaptiveWindow d_adaptiveWindow;
+        // Window of unconfirmed messages
+        // sized from the confirm rate of the
+        // consumer.  Only maintained when
+        // adaptive flow control is enabled.
+
         bsl::shared_ptr<Downstream> d_downstream;
 
         unsigned int d_downstreamSubQueueId;
@@ -148,6 +158,31 @@ class QueueHandle : public mqbi::QueueHandle {
         void operator()();
     };
 
+    /// VST holding a PUSH message delivered to this handle while a delivery
+    /// batch is in progress, until it is dispatched to the client.
+    struct PendingPush {
+        // PUBLIC DATA
+        bsl::shared_ptr<bdlbb::Blob>         d_message;
+        bmqt::MessageGUID                    d_guid;
+        bmqp::MessagePropertiesInfo          d_messagePropertiesInfo;
+        bmqp::Protocol::SubQueueInfosArray   d_subQueueInfos;
+        bmqp::Protocol::MsgGroupId           d_msgGroupId;
+        bmqt::CompressionAlgorithmType::Enum d_compressionAlgorithmType;
+
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(PendingPush, bslma::UsesBslmaAllocator)
+
+        // CREATORS
+
+        /// Create an empty `PendingPush` using the specified `allocator`.
+        explicit PendingPush(bslma::Allocator* allocator);
+
+        /// Create a `PendingPush` having the value of the specified
+        /// `other`, using the specified `allocator`.
+        PendingPush(const PendingPush& other, bslma::Allocator* allocator);
+    };
+    typedef bsl::vector<PendingPush> PendingPushes;
+
   public:
     // PUBLIC TYPES
 
@@ -191,6 +226,11 @@ class QueueHandle : public mqbi::QueueHandle {
     // delivering a message to the client
     // for efficiency.
 
+    const bool d_isAdaptiveFlowControl;
+    // Flag indicating if delivery to each
+    // subscription is additionally bounded
+    // by its 'd_adaptiveWindow'.
+
     bdlmt::Throttle d_throttledFailedAckMessages;
     // Throttler for failed ACK messages.
 
@@ -206,6 +246,17 @@ class QueueHandle : public mqbi::QueueHandle {
 
     bmqp::SchemaLearner::Context d_schemaLearnerPushContext;
 
+    bool d_isBatchingDeliveries;
+    // Flag indicating if a delivery batch is
+    // in progress, in which case the PUSH
+    // messages are kept in
+    // 'd_pendingPushes' instead of being
+    // dispatched to the client one by one.
+
+    bsl::shared_ptr<PendingPushes> d_pendingPushes_sp;
+    // PUSH messages delivered since the
+    // start of the current delivery batch.
+
     bslma::Allocator* d_allocator_p;
     // Allocator to use.
 
@@ -255,6 +306,32 @@ class QueueHandle : public mqbi::QueueHandle {
         const bmqp::Protocol::MsgGroupId&         msgGroupId,
         const bmqp::Protocol::SubQueueInfosArray& subQueueInfos);
 
+    /// Dispatch the PUSH message with the specified `message`, `msgGUID`,
+    /// `messagePropertiesInfo`, `subQueueInfos`, `msgGroupId` and
+    /// `compressionAlgorithmType` to the client of this handle in a
+    /// dedicated dispatcher event.
+    ///
+    /// THREAD: This method is called from the Queue's dispatcher thread.
+    void dispatchPush(
+        const bsl::shared_ptr<bdlbb::Blob>&       message,
+        const bmqt::MessageGUID&                  msgGUID,
+        const bmqp::MessagePropertiesInfo&        messagePropertiesInfo,
+        const bmqp::Protocol::SubQueueInfosArray& subQueueInfos,
+        const bmqp::Protocol::MsgGroupId&         msgGroupId,
+        bmqt::CompressionAlgorithmType::Enum      compressionAlgorithmType);
+
+    /// Process, in the specified `client`, the specified `pushes` as PUSH
+    /// events of the queue handle having the specified `queueId` in the
+    /// specified `queue`, using the specified `allocator` for the event.
+    ///
+    /// THREAD: This method is called from the client's dispatcher thread.
+    static void
+    processPendingPushes(mqbi::DispatcherClient*               client,
+                         mqbi::Queue*                          queue,
+                         unsigned int                          queueId,
+                         const bsl::shared_ptr<PendingPushes>& pushes,
+                         bslma::Allocator*                     allocator);
+
     void makeSubStream(const bsl::string& appId,
                        unsigned int       downstreamSubQueueId,
                        unsigned int       upstreamSubQueueId);
@@ -398,6 +475,20 @@ class QueueHandle : public mqbi::QueueHandle {
         const bmqp::Protocol::SubQueueInfosArray& subQueueInfos)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Start a batch of deliveries to this handle: the messages delivered
+    /// until the next call to `endDeliveryBatch` are kept, and dispatched
+    /// to the client in a single dispatcher event at the end of the batch.
+    ///
+    /// THREAD: This method is called from the Queue's dispatcher thread.
+    void beginDeliveryBatch() BSLS_KEYWORD_OVERRIDE;
+
+    /// End the batch of deliveries started by `beginDeliveryBatch`, and
+    /// dispatch to the client the messages delivered during the batch, in
+    /// the order they were delivered.
+    ///
+    /// THREAD: This method is called from the Queue's dispatcher thread.
+    void endDeliveryBatch() BSLS_KEYWORD_OVERRIDE;
+
     /// Post the message with the specified PUT `header`, `appData` and
     /// `options` to the queue.
     ///
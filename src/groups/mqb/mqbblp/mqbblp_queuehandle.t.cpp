@@ -0,0 +1,329 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbblp_queuehandle.t.cpp                                           -*-C++-*-
+#include <mqbblp_queuehandle.h>
+
+// MQB
+#include <mqbblp_adaptivewindow.h>
+#include <mqbcfg_brokerconfig.h>
+#include <mqbcfg_messages.h>
+#include <mqbi_dispatcher.h>
+#include <mqbi_queue.h>
+#include <mqbi_storage.h>
+#include <mqbmock_cluster.h>
+#include <mqbmock_dispatcher.h>
+#include <mqbmock_domain.h>
+#include <mqbmock_queue.h>
+#include <mqbmock_queueengine.h>
+#include <mqbstat_queuestats.h>
+#include <mqbu_messageguidutil.h>
+
+// BMQ
+#include <bmqp_ctrlmsg_messages.h>
+#include <bmqp_protocol.h>
+#include <bmqt_messageguid.h>
+#include <bmqt_queueflags.h>
+#include <bmqt_uri.h>
+
+// MWC
+#include <mwcsys_time.h>
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bdlf_bind.h>
+#include <bdlt_timeunitratio.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+#include <bsls_annotation.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+typedef bsls::Types::Int64 Int64;
+
+const Int64 k_NS_PER_MS = bdlt::TimeUnitRatio::k_NS_PER_MS;
+
+// ================
+// struct TestClock
+// ================
+
+/// Clock of the test, driving `mwcsys::Time`.
+struct TestClock {
+    // DATA
+    Int64 d_now;  // Current time, in nanoseconds
+
+    // CREATORS
+    TestClock()
+    : d_now(k_NS_PER_MS)
+    {
+        // NOTHING
+    }
+
+    // MANIPULATORS
+    bsls::TimeInterval realtimeClock()
+    {
+        return bsls::TimeInterval().addNanoseconds(d_now);
+    }
+
+    bsls::TimeInterval monotonicClock()
+    {
+        return bsls::TimeInterval().addNanoseconds(d_now);
+    }
+
+    Int64 highResTimer() { return d_now; }
+};
+
+// =====================
+// class TestQueueEngine
+// =====================
+
+/// Queue engine counting the calls to `onHandleUsable`.
+class TestQueueEngine : public mqbmock::QueueEngine {
+  public:
+    // PUBLIC DATA
+    int d_numHandleUsable;
+
+    // CREATORS
+    explicit TestQueueEngine(bslma::Allocator* allocator)
+    : mqbmock::QueueEngine(allocator)
+    , d_numHandleUsable(0)
+    {
+        // NOTHING
+    }
+
+    // MANIPULATORS
+    void onHandleUsable(BSLS_ANNOTATION_UNUSED mqbi::QueueHandle* handle,
+                        BSLS_ANNOTATION_UNUSED unsigned int upstreamSubQueueId)
+        BSLS_KEYWORD_OVERRIDE
+    {
+        ++d_numHandleUsable;
+    }
+};
+
+// ===============
+// class TestQueue
+// ===============
+
+/// Queue removing the rejected messages, without requiring a storage.
+class TestQueue : public mqbmock::Queue {
+  public:
+    // CREATORS
+    TestQueue(mqbi::Domain* domain, bslma::Allocator* allocator)
+    : mqbmock::Queue(domain, allocator)
+    {
+        // NOTHING
+    }
+
+    // MANIPULATORS
+    int rejectMessage(BSLS_ANNOTATION_UNUSED const bmqt::MessageGUID& msgGUID,
+                      BSLS_ANNOTATION_UNUSED unsigned int upstreamSubQueueId,
+                      BSLS_ANNOTATION_UNUSED mqbi::QueueHandle* source)
+        BSLS_KEYWORD_OVERRIDE
+    {
+        // Pretend the message reached its maximum number of deliveries, so
+        // that it is removed from the unconfirmed messages of the handle.
+        return 0;
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_adaptiveWindowReject()
+// ------------------------------------------------------------------------
+// ADAPTIVE WINDOW REJECT
+//
+// Concerns:
+//   - With adaptive flow control, a rejected message is accounted for in
+//     the adaptive window of its subscription like a confirmed one.
+//   - Once delivery was stopped by the window, rejecting enough messages
+//     makes the handle usable again and 'onHandleUsable' is invoked.
+//
+// Testing:
+//   deliverMessage
+//   rejectMessage
+//   canDeliver
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("ADAPTIVE WINDOW REJECT");
+
+    const unsigned int k_SUBSCRIPTION_ID = 1;
+    const int          k_NUM_MESSAGES    = 50;
+
+    TestClock clock;
+    mwcsys::Time::initialize(
+        bdlf::BindUtil::bind(&TestClock::realtimeClock, &clock),
+        bdlf::BindUtil::bind(&TestClock::monotonicClock, &clock),
+        bdlf::BindUtil::bind(&TestClock::highResTimer, &clock),
+        s_allocator_p);
+
+    {
+        bdlbb::PooledBlobBufferFactory bufferFactory(256, s_allocator_p);
+        mqbmock::Dispatcher            dispatcher(s_allocator_p);
+        mqbmock::Cluster               cluster(&bufferFactory, s_allocator_p);
+        mqbmock::Domain                domain(&cluster, s_allocator_p);
+        TestQueueEngine                engine(s_allocator_p);
+        mqbmock::DispatcherClient      client(s_allocator_p);
+        mqbi::DispatcherEvent          event(s_allocator_p);
+
+        dispatcher._setInDispatcherThread(true);
+        dispatcher.registerClient(&client,
+                                  mqbi::DispatcherClientType::e_SESSION);
+        mqbmock::Dispatcher::EventGuard eventGuard =
+            dispatcher._withEvent(&client, &event);
+
+        bsl::shared_ptr<TestQueue> queue;
+        queue.createInplace(s_allocator_p, &domain, s_allocator_p);
+        queue->_setDispatcher(&dispatcher);
+        queue->_setQueueEngine(&engine);
+
+        const bmqt::Uri uri("bmq://bmq.test.mem.priority/q1", s_allocator_p);
+
+        mqbstat::QueueStatsDomain domainStats;
+        domainStats.initialize(uri, &domain, s_allocator_p);
+
+        bsl::shared_ptr<mqbi::QueueHandleRequesterContext> clientContext;
+        clientContext.createInplace(s_allocator_p, s_allocator_p);
+        clientContext->setClient(&client);
+
+        bmqp_ctrlmsg::QueueHandleParameters handleParameters(s_allocator_p);
+        handleParameters.uri()       = uri.canonical();
+        handleParameters.flags()     = bmqt::QueueFlags::e_READ;
+        handleParameters.readCount() = 1;
+
+        mqbblp::QueueHandle obj(queue,
+                                clientContext,
+                                &domainStats,
+                                handleParameters,
+                                s_allocator_p);
+
+        bmqp_ctrlmsg::SubQueueIdInfo subStream(s_allocator_p);
+        obj.registerSubStream(subStream, 0, mqbi::QueueCounts(1, 0));
+
+        // Static limits high enough not to interfere with the window
+        bmqp_ctrlmsg::ConsumerInfo consumerInfo;
+        consumerInfo.maxUnconfirmedMessages() = 1000;
+        consumerInfo.maxUnconfirmedBytes()    = 1024 * 1024;
+        obj.registerSubscription(subStream.subId(),
+                                 k_SUBSCRIPTION_ID,
+                                 consumerInfo,
+                                 0);
+
+        // Deliver the messages
+        bsl::shared_ptr<bdlbb::Blob> blob;
+        blob.createInplace(s_allocator_p, &bufferFactory, s_allocator_p);
+        bdlbb::BlobUtil::append(blob.get(), "payload", 7);
+
+        const bmqp::Protocol::SubQueueInfosArray subQueueInfos(
+            1,
+            bmqp::SubQueueInfo(k_SUBSCRIPTION_ID));
+        bsl::vector<bmqt::MessageGUID> guids(s_allocator_p);
+        for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+            ASSERT(obj.canDeliver(k_SUBSCRIPTION_ID));
+
+            bmqt::MessageGUID guid;
+            mqbu::MessageGUIDUtil::generateGUID(&guid);
+            guids.push_back(guid);
+
+            obj.deliverMessage(blob,
+                               guid,
+                               mqbi::StorageMessageAttributes(),
+                               "",
+                               subQueueInfos);
+        }
+        ASSERT_EQ(obj.countUnconfirmed(), k_NUM_MESSAGES);
+
+        // The first reject starts the first measurement period, the second
+        // one, a period later, sizes the window from a rate of one message
+        // per period: the window is then its minimum, below the number of
+        // unconfirmed messages, and delivery stops.
+        int numRejected = 0;
+        clock.d_now += k_NS_PER_MS;
+        obj.rejectMessage(guids[numRejected++], subStream.subId());
+
+        clock.d_now += mqbblp::AdaptiveWindow::k_MEASUREMENT_PERIOD_NS;
+        obj.rejectMessage(guids[numRejected++], subStream.subId());
+
+        ASSERT_EQ(obj.countUnconfirmed(), k_NUM_MESSAGES - numRejected);
+        ASSERT(!obj.canDeliver(k_SUBSCRIPTION_ID));
+        ASSERT_EQ(engine.d_numHandleUsable, 0);
+
+        // Rejecting messages until the number of unconfirmed messages is
+        // back below the resume ratio of the window resumes delivery.
+        const Int64 k_RESUME_THRESHOLD = static_cast<Int64>(
+            mqbblp::AdaptiveWindow::k_RESUME_RATIO *
+            static_cast<double>(mqbblp::AdaptiveWindow::k_MIN_WINDOW));
+
+        while (obj.countUnconfirmed() > k_RESUME_THRESHOLD + 1) {
+            obj.rejectMessage(guids[numRejected++], subStream.subId());
+            ASSERT_EQ(engine.d_numHandleUsable, 0);
+        }
+
+        obj.rejectMessage(guids[numRejected++], subStream.subId());
+        ASSERT_EQ(obj.countUnconfirmed(), k_RESUME_THRESHOLD);
+        ASSERT_EQ(engine.d_numHandleUsable, 1);
+        ASSERT(obj.canDeliver(k_SUBSCRIPTION_ID));
+    }
+
+    mwcsys::Time::shutdown();
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    bmqt::UriParser::initialize(s_allocator_p);
+    mqbu::MessageGUIDUtil::initialize();
+
+    {
+        mqbcfg::AppConfig brokerConfig(s_allocator_p);
+        brokerConfig.adaptiveFlowControl() = true;
+        mqbcfg::BrokerConfig::set(brokerConfig);
+
+        switch (_testCase) {
+        case 0:
+        case 1: test1_adaptiveWindowReject(); break;
+        default: {
+            cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+            s_testStatus = -1;
+        } break;
+        }
+    }
+
+    bmqt::UriParser::shutdown();
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_GBL_ALLOC);
+}
@@ -237,6 +237,11 @@ void QueueState::loadInternals(mqbcmd::QueueState* out) const
                     p.second);
             }
         }
+
+        mqbcmd::DeduplicationStats deduplicationStats;
+        if (d_storage_mp->loadDeduplicationStats(&deduplicationStats)) {
+            queueStorage.deduplication().makeValue(deduplicationStats);
+        }
     }
 
     if (d_storage_mp) {
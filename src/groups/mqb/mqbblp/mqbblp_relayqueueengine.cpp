@@ -1284,7 +1284,11 @@ void RelayQueueEngine::onHandleUsable(mqbi::QueueHandle* handle,
         // simplified, it may be suboptimal if the case of large number of
         // applications and small capacity limits.
 
-        (void)upstreamSubQueueId;
+        AppsMap::const_iterator itApp = d_apps.find(upstreamSubQueueId);
+        if (itApp != d_apps.end() && itApp->second->d_routing_sp) {
+            itApp->second->d_routing_sp->onUsable(handle);
+        }
+
         deliverMessages();
     }
 }
@@ -29,6 +29,7 @@
 #include <mqbi_storage.h>
 #include <mqbs_filestoreprotocol.h>
 #include <mqbs_inmemorystorage.h>
+#include <mqbstat_messagetracer.h>
 #include <mqbu_storagekey.h>
 
 // BMQ
@@ -893,6 +894,10 @@ void RemoteQueue::postMessage(const bmqp::PutHeader&              putHeaderIn,
         source->subStreamInfos().find(bmqp::ProtocolUtil::k_DEFAULT_APP_ID) !=
         source->subStreamInfos().end());
 
+    mqbstat::MessageTracer::record(
+        mqbstat::MessageTracerStage::e_QUEUE_DISPATCHER,
+        putHeaderIn.messageGUID());
+
     // REVISIT: This assumes no MessageProperties access before this point.
     //          As a result, SchemaLearner can be per queue and therefore
     //          single-threaded.
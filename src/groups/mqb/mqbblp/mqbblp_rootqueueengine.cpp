@@ -101,6 +101,21 @@ size_t RootQueueEngine::deliverMessages(AppState*               app,
     return numMessages;
 }
 
+void RootQueueEngine::setLazy(const mqbu::StorageKey& key, bool isLazy)
+{
+    // executed by the *QUEUE DISPATCHER* thread
+
+    if (key.isNull() || !d_isFanout) {
+        return;  // RETURN
+    }
+
+    if (isLazy && d_queueState_p->domain()->config().maxIdleTime() != 0) {
+        return;  // RETURN
+    }
+
+    d_queueState_p->storage()->setLazy(key, isLazy);
+}
+
 RootQueueEngine::Apps::iterator
 RootQueueEngine::makeSubStream(const bsl::string& appId,
                                const AppKeyCount& appKey,
@@ -134,6 +149,9 @@ RootQueueEngine::makeSubStream(const bsl::string& appId,
         d_consumptionMonitor.registerSubStream(
             appKey.first,
             bdlf::BindUtil::bind(&AppState::head, app.get()));
+
+        // No consumer yet
+        setLazy(appKey.first, true);
     }
 
     bsl::pair<Apps::iterator, Apps::InsertResult> rc = d_apps.insert(appId,
@@ -792,6 +810,12 @@ void RootQueueEngine::configureHandle(
     BSLS_ASSERT_SAFE(iter != d_apps.end());
 
     const AppStateSp& affectedApp = iter->value();
+    if (!affectedApp->hasConsumers()) {
+        // Potentially the first consumer: materialize the messages which
+        // arrived while the App had no consumer, before 'reset' points the
+        // storage iterator to the first of them.
+        setLazy(iter->key2().first, false);
+    }
     // prepare the App for rebuilding consumers
     affectedApp->reset();
 
@@ -1058,6 +1082,10 @@ void RootQueueEngine::releaseHandle(
                                     currSubStreamInfo.appId(),
                                     itApp->key2().first);
                 }
+                else if (!app->hasConsumers()) {
+                    // That was the last consumer of the App
+                    setLazy(itApp->key2().first, true);
+                }
 
                 if (result.isQueueStreamEmpty()) {
                     // There are no clients for this app in this queue (across
@@ -1133,6 +1161,9 @@ void RootQueueEngine::onHandleUsable(mqbi::QueueHandle* handle,
                                                   upstreamSubscriptionId)) {
         const AppStateSp app = subQueue(upstreamSubQueueId);
         BSLS_ASSERT_SAFE(app);
+        BSLS_ASSERT_SAFE(app->d_routing_sp);
+
+        app->d_routing_sp->onUsable(handle);
 
         deliverMessages(app.get(), app->d_appId, app->d_appKey);
     }
@@ -1525,6 +1556,10 @@ void RootQueueEngine::afterAppIdRegistered(
         bdlf::BindUtil::bind(&AppState::head, iter->value()));
 
     iter->value()->d_storageIter_mp = storageIterMp;
+
+    if (!iter->value()->hasConsumers()) {
+        setLazy(key, true);
+    }
 }
 
 void RootQueueEngine::afterAppIdUnregistered(
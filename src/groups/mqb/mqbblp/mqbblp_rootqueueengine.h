@@ -163,6 +163,16 @@ class RootQueueEngine BSLS_KEYWORD_FINAL : public mqbi::QueueEngine {
                            const bsl::string&      appId,
                            const mqbu::StorageKey& key);
 
+    /// Make the virtual storage of the app having the specified `key` lazy
+    /// if the specified `isLazy` is true, and materialize it otherwise (see
+    /// `mqbi::Storage::setLazy`).  Apps are only made lazy in Fanout queues
+    /// which are not monitored for idleness, because the consumption
+    /// monitor inspects the head of each app.  This method has no effect if
+    /// `key` is null.
+    ///
+    /// THREAD: This method is called from the Queue's dispatcher thread.
+    void setLazy(const mqbu::StorageKey& key, bool isLazy);
+
     // PRIVATE ACCESSORS
 
     /// Set up data structures for the specified `appId`.  Return 0 on
@@ -45,10 +45,13 @@
 #include <bslmf_assert.h>
 #include <bslmt_semaphore.h>
 #include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
 
 // MWC
 #include <mwctst_scopedlogobserver.h>
 #include <mwcu_memoutstream.h>
+#include <mwcu_printutil.h>
 
 // TEST DRIVER
 #include <mwctst_testhelper.h>
@@ -1328,6 +1331,79 @@ static void testN3_broadcastExhaustiveConsumerPriority()
     regress(&operations, invariants);
 }
 
+static void testN4_priorityDeliveryPerformance()
+// ------------------------------------------------------------------------
+// PRIORITY DELIVERY PERFORMANCE
+//
+// Concerns:
+//   Measure the throughput of delivering a large backlog of messages of a
+//   priority queue to a few consumers having enough capacity.
+//
+// Plan:
+//   1) Bring up 4 consumers with the same priority and enough capacity to
+//      receive all messages.
+//   2) Post a large number of messages, and time how long it takes for the
+//      engine to deliver them.
+//
+// Testing:
+//   Performance of 'QueueEngineUtil_AppState::deliverMessages'
+// ------------------------------------------------------------------------
+{
+    s_ignoreCheckDefAlloc = true;
+    // Can't check the default allocator: 'mqbblp::QueueEngine' and mocks from
+    // 'mqbi' methods print with ball, which allocates.
+
+    mwctst::TestHelper::printTestName("PRIORITY DELIVERY PERFORMANCE");
+
+    const int k_NUM_CONSUMERS = 4;
+    const int k_NUM_MESSAGES  = 50000;
+
+    mqbblp::QueueEngineTester tester(priorityDomainConfig(),
+                                     false,  // start scheduler
+                                     s_allocator_p);
+
+    mqbblp::QueueEngineTesterGuard<mqbblp::RootQueueEngine> guard(&tester);
+
+    // 1) Consumers with the same priority and enough capacity
+    bsl::vector<mqbmock::QueueHandle*> consumers(s_allocator_p);
+    for (int i = 0; i < k_NUM_CONSUMERS; ++i) {
+        mwcu::MemOutStream handle(s_allocator_p);
+        handle << "C" << (i + 1);
+
+        mwcu::MemOutStream getHandle(s_allocator_p);
+        getHandle << handle.str() << " readCount=1";
+        consumers.push_back(tester.getHandle(getHandle.str()));
+
+        mwcu::MemOutStream configureHandle(s_allocator_p);
+        configureHandle << handle.str()
+                        << " consumerPriority=1 consumerPriorityCount=1"
+                        << " maxUnconfirmedMessages=" << k_NUM_MESSAGES;
+        tester.configureHandle(configureHandle.str());
+    }
+
+    // 2) Post the messages and time their delivery
+    mwcu::MemOutStream messages(s_allocator_p);
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        messages << (i == 0 ? "" : ",") << i;
+    }
+    tester.post(messages.str());
+
+    const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+    tester.afterNewMessage(k_NUM_MESSAGES);
+    const bsls::Types::Int64 end = bsls::TimeUtil::getTimer();
+
+    int numDelivered = 0;
+    for (int i = 0; i < k_NUM_CONSUMERS; ++i) {
+        numDelivered += consumers[i]->_numMessages();
+    }
+    ASSERT_EQ(numDelivered, k_NUM_MESSAGES);
+
+    cout << "Delivered " << k_NUM_MESSAGES << " messages to "
+         << k_NUM_CONSUMERS << " consumers in "
+         << mwcu::PrintUtil::prettyTimeInterval(end - start) << " ("
+         << (end - start) / k_NUM_MESSAGES << " ns/msg)" << endl;
+}
+
 // ----------------------------------------------------------------------------
 //                            PRIORITY TESTS
 // ----------------------------------------------------------------------------
@@ -5277,6 +5353,7 @@ int main(int argc, char* argv[])
         case -1: testN1_broadcastExhaustiveSubscriptions(); break;
         case -2: testN2_broadcastExhaustiveCanDeliver(); break;
         case -3: testN3_broadcastExhaustiveConsumerPriority(); break;
+        case -4: testN4_priorityDeliveryPerformance(); break;
         default: {
             cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
             s_testStatus = -1;
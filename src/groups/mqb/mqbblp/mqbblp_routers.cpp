@@ -414,7 +414,7 @@ size_t Routers::AppContext::finalize()
                         &subscription);
 
                     // Put the subscription into the round-robin list
-                    group.d_highestSubscriptions.emplace_back(&subscription);
+                    group.addHighest(&subscription);
 
                     level.d_count += n;
                     count += n;
@@ -457,6 +457,7 @@ void Routers::AppContext::clean()
         PriorityGroup& group = d_groups.value(itGroup);
         group.d_ci.clear();
         group.d_highestSubscriptions.clear();
+        group.d_saturatedSubscriptions.clear();
         group.d_canDeliver = true;
     }
     for (Consumers::const_iterator itConsumer = d_consumers.begin();
@@ -493,8 +494,13 @@ void Routers::QueueRoutingContext::loadInternals(mqbcmd::Routing* out) const
 
             pg.id() = priorityGroup->sId();
 
-            SubscriptionList& subscriptions =
-                priorityGroup->d_highestSubscriptions;
+            SubscriptionList subscriptions(
+                priorityGroup->d_highestSubscriptions,
+                d_allocator_p);
+            subscriptions.insert(
+                subscriptions.end(),
+                priorityGroup->d_saturatedSubscriptions.begin(),
+                priorityGroup->d_saturatedSubscriptions.end());
 
             for (SubscriptionList::iterator itSubscription =
                      subscriptions.begin();
@@ -537,7 +543,7 @@ void Routers::AppContext::generate(bmqp_ctrlmsg::StreamParameters* out) const
          ++itGroup) {
         const PriorityGroup& group = d_groups.value(itGroup);
 
-        BSLS_ASSERT_SAFE(group.d_highestSubscriptions.size() > 0);
+        BSLS_ASSERT_SAFE(!group.empty());
 
         out->subscriptions().resize(n + 1);
         bmqp_ctrlmsg::Subscription& subscription = out->subscriptions()[n];
@@ -629,7 +635,7 @@ Routers::RoundRobin::iterateGroups(const Visitor&               visitor,
              ++itGroup) {
             PriorityGroup& group = (*itGroup)->value();
 
-            BSLS_ASSERT_SAFE(!group.d_highestSubscriptions.empty());
+            BSLS_ASSERT_SAFE(!group.empty());
 
             if (group.d_canDeliver) {
                 if (group.evaluate(message->appData())) {
@@ -666,8 +672,7 @@ bool Routers::RoundRobin::iterateSubscriptions(const Visitor& visitor,
     SubscriptionList& subscriptions = group.d_highestSubscriptions;
 
     for (SubscriptionList::iterator itSubscription = subscriptions.begin();
-         itSubscription != subscriptions.end();
-         ++itSubscription) {
+         itSubscription != subscriptions.end();) {
         const Subscription* subscription = *itSubscription;
         mqbi::QueueHandle*  handle       = subscription->handle();
         BSLS_ASSERT_SAFE(handle);
@@ -684,6 +689,44 @@ bool Routers::RoundRobin::iterateSubscriptions(const Visitor& visitor,
                 }
                 return true;  // RETURN
             }
+            ++itSubscription;
+        }
+        else {
+            // Do not visit this subscription again until its handle becomes
+            // usable, so that saturated consumers do not slow down the
+            // selection.
+            itSubscription = group.saturate(itSubscription);
+        }
+    }
+
+    // Capacity can come back without the handle becoming usable.  Visit the
+    // saturated subscriptions before giving up on this group.  Note that
+    // 'iterateGroups' does not visit this group again until a handle becomes
+    // usable, while messages of a group already selected by their
+    // subscription id keep visiting it, as they visited all subscriptions of
+    // the group before saturated ones were moved aside.
+    SubscriptionList& saturated = group.d_saturatedSubscriptions;
+
+    for (SubscriptionList::iterator itSubscription = saturated.begin();
+         itSubscription != saturated.end();) {
+        const Subscription* subscription = *itSubscription;
+        mqbi::QueueHandle*  handle       = subscription->handle();
+        BSLS_ASSERT_SAFE(handle);
+
+        ++itSubscription;
+
+        if (handle->canDeliver(subscription->d_downstreamSubscriptionId)) {
+            group.unsaturate(subscription);
+
+            if (visitor(subscription)) {
+                // The subscription is already at the end.
+                if (!subscription->advance()) {
+                    subscriptions.splice(subscriptions.begin(),
+                                         subscriptions,
+                                         subscription->d_itGroupList);
+                }
+                return true;  // RETURN
+            }
         }
     }
 
@@ -748,6 +791,33 @@ const Routers::Subscription* Routers::AppContext::selectSubscription(
     return 0;
 }
 
+void Routers::AppContext::onUsable(mqbi::QueueHandle* handle)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(handle);
+
+    Consumers::SharedItem itConsumer = d_consumers.find(handle);
+    if (!itConsumer) {
+        return;  // RETURN
+    }
+
+    const SubscriptionList& subscriptions =
+        itConsumer->value().d_highestSubscriptions;
+
+    for (SubscriptionList::const_iterator it = subscriptions.begin();
+         it != subscriptions.end();
+         ++it) {
+        const Subscription* subscription = *it;
+
+        if (subscription->d_isSaturated) {
+            PriorityGroup& group = subscription->d_itGroup->value();
+
+            group.unsaturate(subscription);
+            group.d_canDeliver = true;
+        }
+    }
+}
+
 void Routers::AppContext::apply()
 {
     for (PriorityGroups::const_iterator itGroup = d_groups.begin();
@@ -127,6 +127,19 @@
 //  The order of ['group1', 'group2'] evaluation is implementation-specific
 //  (influenced by optimizations).
 //
+//  Within a 'PriorityGroup', the round-robin list only keeps subscriptions
+//  which consumers had capacity last time they were visited.  A subscription
+//  which consumer cannot deliver is moved aside, to the list of saturated
+//  subscriptions of the group, and is moved back to the end of the round-robin
+//  list when its handle becomes usable again (see 'AppContext::onUsable').
+//  Therefore, selecting the next consumer does not depend on the number of
+//  saturated consumers.  Saturated subscriptions are only visited again when
+//  none of the round-robin list can deliver, because capacity can also come
+//  back without the handle becoming usable (e.g., when going back below the
+//  high watermark).  'iterateGroups' then skips the group until a handle
+//  becomes usable, while messages already bound to the group by their
+//  subscription id keep visiting its saturated subscriptions.
+//
 //  Another order is by highest-priority subscribers:
 //  [consumer1: 'subscription2'], consumer2: ['subscription3', 'subscription4',
 //  'subscription5']].  This order is for broadcast queues.  Another usage is
@@ -413,7 +426,13 @@ class Routers {
 
         SubscriptionList d_highestSubscriptions;
         // App Subscriptions having the same Expression
-        // and which priority is the highest one.
+        // and which priority is the highest one, in
+        // round-robin order.
+
+        SubscriptionList d_saturatedSubscriptions;
+        // Highest priority Subscriptions moved out of
+        // the round-robin list because their consumers
+        // could not deliver.
 
         const SubscriptionIds::SharedItem d_itId;
 
@@ -431,6 +450,22 @@ class Routers {
 
         bool add(const Subscription* subscription);
 
+        /// Append the specified `subscription` to the round-robin list.
+        void addHighest(const Subscription* subscription);
+
+        /// Move the subscription at the specified `it` position in the
+        /// round-robin list to the list of saturated subscriptions.  Return
+        /// the position following `it` in the round-robin list.
+        SubscriptionList::iterator saturate(SubscriptionList::iterator it);
+
+        /// Move the specified saturated `subscription` back to the end of
+        /// the round-robin list.
+        void unsaturate(const Subscription* subscription);
+
+        /// Return `true` if this group has no highest priority
+        /// `Subscription`, saturated or not.
+        bool empty() const;
+
         bool evaluate(const bsl::shared_ptr<bdlbb::Blob>& data);
 
         unsigned int sId() const;
@@ -478,6 +513,14 @@ class Routers {
         mutable int                      d_currentConsumerCount;
         // Transient state assisting round-robin.
 
+        mutable SubscriptionList::iterator d_itGroupList;
+        // Transient position in either the round-robin or
+        // the saturated list of the group.
+
+        mutable bool d_isSaturated;
+        // Transient state: 'true' if in the saturated list
+        // of the group.
+
         const Subscribers::SharedItem    d_itSubscriber;
         const PriorityGroups::SharedItem d_itGroup;
 
@@ -713,6 +756,12 @@ class Routers {
         /// Remove all results of parsing.
         void reset();
 
+        /// Move all saturated highest priority `Subscription`s of the
+        /// specified `handle` back to the round-robin lists of their
+        /// `PriorityGroup`s.  The behavior is undefined unless the `handle`
+        /// has become usable again.
+        void onUsable(mqbi::QueueHandle* handle);
+
         /// If the specified `currentMessage` refers to a known `Group`,
         /// iterate all highest priority `Subscription`s within the `group`
         /// and call the specified `visitor` for each highest priority
@@ -898,6 +947,8 @@ inline Routers::Subscription::Subscription(
 : d_ci(ci)
 , d_downstreamSubscriptionId(subscriptionId)
 , d_currentConsumerCount(ci.consumerPriorityCount())
+, d_itGroupList()
+, d_isSaturated(false)
 , d_itSubscriber(itSubscriber)
 , d_itGroup(group)
 {
@@ -974,6 +1025,7 @@ inline Routers::PriorityGroup::PriorityGroup(
     const SubscriptionIds::SharedItem itId,
     bslma::Allocator*                 allocator)
 : d_highestSubscriptions(allocator)
+, d_saturatedSubscriptions(allocator)
 , d_itId(itId)
 , d_ci(allocator)
 , d_canDeliver(true)
@@ -984,6 +1036,7 @@ inline Routers::PriorityGroup::PriorityGroup(
 inline Routers::PriorityGroup::PriorityGroup(const PriorityGroup& other,
                                              bslma::Allocator*    allocator)
 : d_highestSubscriptions(other.d_highestSubscriptions, allocator)
+, d_saturatedSubscriptions(other.d_saturatedSubscriptions, allocator)
 , d_itId(other.d_itId)
 , d_ci(other.d_ci, allocator)
 , d_canDeliver(other.d_canDeliver)
@@ -1043,6 +1096,49 @@ inline bool Routers::PriorityGroup::add(const Subscription* subscription)
     return isNew;
 }
 
+inline void
+Routers::PriorityGroup::addHighest(const Subscription* subscription)
+{
+    subscription->d_itGroupList = d_highestSubscriptions.insert(
+        d_highestSubscriptions.end(),
+        subscription);
+    subscription->d_isSaturated = false;
+}
+
+inline Routers::SubscriptionList::iterator
+Routers::PriorityGroup::saturate(SubscriptionList::iterator it)
+{
+    const Subscription* subscription = *it;
+    BSLS_ASSERT_SAFE(!subscription->d_isSaturated);
+
+    SubscriptionList::iterator next = it;
+    ++next;
+
+    // 'splice' does not invalidate 'd_itGroupList'.
+    d_saturatedSubscriptions.splice(d_saturatedSubscriptions.end(),
+                                    d_highestSubscriptions,
+                                    it);
+    subscription->d_isSaturated = true;
+
+    return next;
+}
+
+inline void
+Routers::PriorityGroup::unsaturate(const Subscription* subscription)
+{
+    BSLS_ASSERT_SAFE(subscription->d_isSaturated);
+
+    d_highestSubscriptions.splice(d_highestSubscriptions.end(),
+                                  d_saturatedSubscriptions,
+                                  subscription->d_itGroupList);
+    subscription->d_isSaturated = false;
+}
+
+inline bool Routers::PriorityGroup::empty() const
+{
+    return d_highestSubscriptions.empty() && d_saturatedSubscriptions.empty();
+}
+
 // -----------------------------
 // struct Routers::Subscriber
 // -----------------------------
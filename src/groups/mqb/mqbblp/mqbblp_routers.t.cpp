@@ -27,6 +27,7 @@
 // MQB
 #include <mqbcfg_brokerconfig.h>
 #include <mqbmock_queue.h>
+#include <mqbmock_queueengine.h>
 #include <mqbmock_queuehandle.h>
 #include <mqbs_inmemorystorage.h>
 
@@ -510,6 +511,186 @@ static void test4_generate()
     }
 }
 
+static void test5_saturatedSubscriptions()
+// ------------------------------------------------------------------------
+// Testing mqbblp::Routers::RoundRobin::iterateSubscriptions and
+// mqbblp::Routers::AppContext::onUsable methods.
+//
+//  Two handles each with one subscription at the same priority.
+//  1. The subscription of a handle which cannot deliver is moved out of
+//     the round-robin list and is not visited again.
+//  2. Once no handle can deliver, the group is not visited again.
+//  3. Once the handle is usable, its subscription is moved back to the
+//     round-robin list.
+//  4. Messages bound to the group by their subscription id are delivered
+//     as soon as a saturated handle has capacity again, even when the group
+//     was marked as unable to deliver and no handle became usable.
+// ------------------------------------------------------------------------
+{
+    bmqp_ctrlmsg::StreamParameters       streamParams(s_allocator_p);
+    bmqp::SchemaLearner                  schemaLearner(s_allocator_p);
+    mqbblp::Routers::QueueRoutingContext queueContext(schemaLearner,
+                                                      s_allocator_p);
+    TestStorage                          storage(13, s_allocator_p);
+    mqbmock::QueueEngine                 queueEngine(s_allocator_p);
+
+    storage.d_queue_sp->_setQueueEngine(&queueEngine);
+
+    bsl::string  appId("foo", s_allocator_p);
+    unsigned int upstreamSubQueueId = 1;
+
+    mqbmock::QueueHandle         handle1 = storage.getHandle();
+    mqbmock::QueueHandle         handle2 = storage.getHandle();
+    bmqp_ctrlmsg::SubQueueIdInfo subStreamInfo1(s_allocator_p);
+    bmqp_ctrlmsg::SubQueueIdInfo subStreamInfo2(s_allocator_p);
+
+    subStreamInfo1.appId() = appId;
+    subStreamInfo1.subId() = 13;
+    subStreamInfo2.appId() = appId;
+    subStreamInfo2.subId() = 14;
+
+    handle1.registerSubStream(subStreamInfo1,
+                              upstreamSubQueueId,
+                              mqbi::QueueCounts(1, 0));
+    handle2.registerSubStream(subStreamInfo2,
+                              upstreamSubQueueId,
+                              mqbi::QueueCounts(1, 0));
+
+    streamParams.appId() = appId;
+    streamParams.subscriptions().resize(1);
+    streamParams.subscriptions()[0].consumers().resize(1);
+    {
+        bmqp_ctrlmsg::ConsumerInfo& ci =
+            streamParams.subscriptions()[0].consumers()[0];
+
+        ci.consumerPriority()       = 1;
+        ci.consumerPriorityCount()  = 1;
+        ci.maxUnconfirmedMessages() = 1024;
+        ci.maxUnconfirmedBytes()    = 1024;
+    }
+
+    handle1.setStreamParameters(streamParams);
+    handle2.setStreamParameters(streamParams);
+
+    {
+        mqbblp::Routers::AppContext appContext(queueContext, s_allocator_p);
+        mwcu::MemOutStream          errorStream(s_allocator_p);
+
+        appContext.load(&handle1,
+                        &errorStream,
+                        subStreamInfo1.subId(),
+                        upstreamSubQueueId,
+                        streamParams,
+                        0);
+        appContext.load(&handle2,
+                        &errorStream,
+                        subStreamInfo2.subId(),
+                        upstreamSubQueueId,
+                        streamParams,
+                        0);
+        ASSERT_EQ(errorStream.str(), "");
+        ASSERT_EQ(appContext.finalize(), size_t(2));
+        appContext.registerSubscriptions();
+
+        mqbblp::Routers::PriorityGroups::const_iterator itGroup =
+            appContext.d_groups.begin();
+        ASSERT(itGroup != appContext.d_groups.end());
+
+        mqbblp::Routers::PriorityGroup& group = appContext.d_groups.value(
+            itGroup);
+        ASSERT_EQ(group.d_highestSubscriptions.size(), size_t(2));
+        ASSERT(group.d_saturatedSubscriptions.empty());
+
+        // 1. 'handle1' cannot deliver
+        handle1._setCanDeliver(appId, false);
+
+        for (int i = 0; i < 4; ++i) {
+            Visitor visitor;
+            ASSERT_EQ(appContext.d_router.iterateGroups(
+                          bdlf::BindUtil::bind(&Visitor::visit,
+                                               &visitor,
+                                               bdlf::PlaceHolders::_1),
+                          storage.d_iterator.get()),
+                      mqbblp::Routers::e_SUCCESS);
+            ASSERT_EQ(&handle2, visitor.d_handle);
+        }
+        ASSERT_EQ(group.d_highestSubscriptions.size(), size_t(1));
+        ASSERT_EQ(group.d_saturatedSubscriptions.size(), size_t(1));
+
+        // 2. No handle can deliver
+        handle2._setCanDeliver(appId, false);
+        {
+            Visitor visitor;
+            ASSERT_EQ(appContext.d_router.iterateGroups(
+                          bdlf::BindUtil::bind(&Visitor::visit,
+                                               &visitor,
+                                               bdlf::PlaceHolders::_1),
+                          storage.d_iterator.get()),
+                      mqbblp::Routers::e_NO_CAPACITY);
+            ASSERT_EQ(visitor.d_handle, static_cast<mqbi::QueueHandle*>(0));
+        }
+        ASSERT(group.d_highestSubscriptions.empty());
+        ASSERT_EQ(group.d_saturatedSubscriptions.size(), size_t(2));
+        ASSERT(!group.d_canDeliver);
+
+        // 3. 'handle1' is usable again
+        handle1._setCanDeliver(appId, true);
+        appContext.onUsable(&handle1);
+
+        ASSERT_EQ(group.d_highestSubscriptions.size(), size_t(1));
+        ASSERT_EQ(group.d_saturatedSubscriptions.size(), size_t(1));
+        ASSERT(group.d_canDeliver);
+        {
+            Visitor visitor;
+            ASSERT_EQ(appContext.d_router.iterateGroups(
+                          bdlf::BindUtil::bind(&Visitor::visit,
+                                               &visitor,
+                                               bdlf::PlaceHolders::_1),
+                          storage.d_iterator.get()),
+                      mqbblp::Routers::e_SUCCESS);
+            ASSERT_EQ(&handle1, visitor.d_handle);
+        }
+
+        // 4. Both handles are saturated again, and capacity comes back to
+        //    'handle2' without it becoming usable
+        handle1._setCanDeliver(appId, false);
+        {
+            Visitor visitor;
+            ASSERT_EQ(appContext.d_router.iterateGroups(
+                          bdlf::BindUtil::bind(&Visitor::visit,
+                                               &visitor,
+                                               bdlf::PlaceHolders::_1),
+                          storage.d_iterator.get()),
+                      mqbblp::Routers::e_NO_CAPACITY);
+        }
+        ASSERT(!group.d_canDeliver);
+        ASSERT_EQ(group.d_saturatedSubscriptions.size(), size_t(2));
+
+        handle2._setCanDeliver(appId, true);
+        {
+            // Path of the messages already bound to the group
+            Visitor visitor;
+            ASSERT(appContext.d_router.iterateSubscriptions(
+                bdlf::BindUtil::bind(&Visitor::visit,
+                                     &visitor,
+                                     bdlf::PlaceHolders::_1),
+                group));
+            ASSERT_EQ(&handle2, visitor.d_handle);
+        }
+        ASSERT_EQ(group.d_highestSubscriptions.size(), size_t(1));
+        ASSERT_EQ(group.d_saturatedSubscriptions.size(), size_t(1));
+    }
+
+    ASSERT_EQ(handle1.unregisterSubStream(subStreamInfo1,
+                                          mqbi::QueueCounts(1, 0),
+                                          false),
+              true);
+    ASSERT_EQ(handle2.unregisterSubStream(subStreamInfo2,
+                                          mqbi::QueueCounts(1, 0),
+                                          false),
+              true);
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -533,6 +714,7 @@ int main(int argc, char* argv[])
     case 2: test2_priority(); break;
     case 3: test3_parse(); break;
     case 4: test4_generate(); break;
+    case 5: test5_saturatedSubscriptions(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         s_testStatus = -1;
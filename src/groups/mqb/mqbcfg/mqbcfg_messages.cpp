@@ -5669,6 +5669,8 @@ const char AppConfig::DEFAULT_INITIALIZER_LATENCY_MONITOR_DOMAIN[] =
 
 const bool AppConfig::DEFAULT_INITIALIZER_CONFIGURE_STREAM = false;
 
+const bool AppConfig::DEFAULT_INITIALIZER_ADAPTIVE_FLOW_CONTROL = false;
+
 const bdlat_AttributeInfo AppConfig::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_BROKER_INSTANCE_NAME,
      "brokerInstanceName",
@@ -5754,6 +5756,11 @@ const bdlat_AttributeInfo AppConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "configureStream",
      sizeof("configureStream") - 1,
      "",
+     bdlat_FormattingMode::e_TEXT},
+    {ATTRIBUTE_ID_ADAPTIVE_FLOW_CONTROL,
+     "adaptiveFlowControl",
+     sizeof("adaptiveFlowControl") - 1,
+     "",
      bdlat_FormattingMode::e_TEXT}};
 
 // CLASS METHODS
@@ -5761,7 +5768,7 @@ const bdlat_AttributeInfo AppConfig::ATTRIBUTE_INFO_ARRAY[] = {
 const bdlat_AttributeInfo* AppConfig::lookupAttributeInfo(const char* name,
                                                           int nameLength)
 {
-    for (int i = 0; i < 17; ++i) {
+    for (int i = 0; i < 18; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             AppConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -5811,6 +5818,8 @@ const bdlat_AttributeInfo* AppConfig::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MESSAGE_PROPERTIES_V2];
     case ATTRIBUTE_ID_CONFIGURE_STREAM:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONFIGURE_STREAM];
+    case ATTRIBUTE_ID_ADAPTIVE_FLOW_CONTROL:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ADAPTIVE_FLOW_CONTROL];
     default: return 0;
     }
 }
@@ -5836,6 +5845,7 @@ AppConfig::AppConfig(bslma::Allocator* basicAllocator)
 , d_logsObserverMaxSize()
 , d_isRunningOnDev()
 , d_configureStream(DEFAULT_INITIALIZER_CONFIGURE_STREAM)
+, d_adaptiveFlowControl(DEFAULT_INITIALIZER_ADAPTIVE_FLOW_CONTROL)
 {
 }
 
@@ -5858,6 +5868,7 @@ AppConfig::AppConfig(const AppConfig&  original,
 , d_logsObserverMaxSize(original.d_logsObserverMaxSize)
 , d_isRunningOnDev(original.d_isRunningOnDev)
 , d_configureStream(original.d_configureStream)
+, d_adaptiveFlowControl(original.d_adaptiveFlowControl)
 {
 }
 
@@ -5880,7 +5891,8 @@ AppConfig::AppConfig(AppConfig&& original) noexcept
   d_configVersion(bsl::move(original.d_configVersion)),
   d_logsObserverMaxSize(bsl::move(original.d_logsObserverMaxSize)),
   d_isRunningOnDev(bsl::move(original.d_isRunningOnDev)),
-  d_configureStream(bsl::move(original.d_configureStream))
+  d_configureStream(bsl::move(original.d_configureStream)),
+  d_adaptiveFlowControl(bsl::move(original.d_adaptiveFlowControl))
 {
 }
 
@@ -5904,6 +5916,7 @@ AppConfig::AppConfig(AppConfig&& original, bslma::Allocator* basicAllocator)
 , d_logsObserverMaxSize(bsl::move(original.d_logsObserverMaxSize))
 , d_isRunningOnDev(bsl::move(original.d_isRunningOnDev))
 , d_configureStream(bsl::move(original.d_configureStream))
+, d_adaptiveFlowControl(bsl::move(original.d_adaptiveFlowControl))
 {
 }
 #endif
@@ -5934,6 +5947,7 @@ AppConfig& AppConfig::operator=(const AppConfig& rhs)
         d_plugins              = rhs.d_plugins;
         d_messagePropertiesV2  = rhs.d_messagePropertiesV2;
         d_configureStream      = rhs.d_configureStream;
+        d_adaptiveFlowControl  = rhs.d_adaptiveFlowControl;
     }
 
     return *this;
@@ -5961,6 +5975,7 @@ AppConfig& AppConfig::operator=(AppConfig&& rhs)
         d_plugins              = bsl::move(rhs.d_plugins);
         d_messagePropertiesV2  = bsl::move(rhs.d_messagePropertiesV2);
         d_configureStream      = bsl::move(rhs.d_configureStream);
+        d_adaptiveFlowControl  = bsl::move(rhs.d_adaptiveFlowControl);
     }
 
     return *this;
@@ -5985,7 +6000,8 @@ void AppConfig::reset()
     bdlat_ValueTypeFunctions::reset(&d_bmqconfConfig);
     bdlat_ValueTypeFunctions::reset(&d_plugins);
     bdlat_ValueTypeFunctions::reset(&d_messagePropertiesV2);
-    d_configureStream = DEFAULT_INITIALIZER_CONFIGURE_STREAM;
+    d_configureStream     = DEFAULT_INITIALIZER_CONFIGURE_STREAM;
+    d_adaptiveFlowControl = DEFAULT_INITIALIZER_ADAPTIVE_FLOW_CONTROL;
 }
 
 // ACCESSORS
@@ -6013,6 +6029,7 @@ AppConfig::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     printer.printAttribute("plugins", this->plugins());
     printer.printAttribute("messagePropertiesV2", this->messagePropertiesV2());
     printer.printAttribute("configureStream", this->configureStream());
+    printer.printAttribute("adaptiveFlowControl", this->adaptiveFlowControl());
     printer.end();
     return stream;
 }
@@ -8010,7 +8010,8 @@ class AppConfig {
     // configuration for the plugins msgPropertiesSupport.: information about
     // if/how to advertise support for v2 message properties
     // configureStream......: send new ConfigureStream instead of old
-    // ConfigureQueue/>
+    // ConfigureQueue adaptiveFlowControl..: size the window of unconfirmed
+    // messages of each consumer from its measured confirm rate/>
 
     // INSTANCE DATA
     bsl::string         d_brokerInstanceName;
@@ -8030,6 +8031,7 @@ class AppConfig {
     int                 d_logsObserverMaxSize;
     bool                d_isRunningOnDev;
     bool                d_configureStream;
+    bool                d_adaptiveFlowControl;
 
   public:
     // TYPES
@@ -8050,10 +8052,11 @@ class AppConfig {
         ATTRIBUTE_ID_BMQCONF_CONFIG         = 13,
         ATTRIBUTE_ID_PLUGINS                = 14,
         ATTRIBUTE_ID_MESSAGE_PROPERTIES_V2  = 15,
-        ATTRIBUTE_ID_CONFIGURE_STREAM       = 16
+        ATTRIBUTE_ID_CONFIGURE_STREAM       = 16,
+        ATTRIBUTE_ID_ADAPTIVE_FLOW_CONTROL  = 17
     };
 
-    enum { NUM_ATTRIBUTES = 17 };
+    enum { NUM_ATTRIBUTES = 18 };
 
     enum {
         ATTRIBUTE_INDEX_BROKER_INSTANCE_NAME   = 0,
@@ -8072,7 +8075,8 @@ class AppConfig {
         ATTRIBUTE_INDEX_BMQCONF_CONFIG         = 13,
         ATTRIBUTE_INDEX_PLUGINS                = 14,
         ATTRIBUTE_INDEX_MESSAGE_PROPERTIES_V2  = 15,
-        ATTRIBUTE_INDEX_CONFIGURE_STREAM       = 16
+        ATTRIBUTE_INDEX_CONFIGURE_STREAM       = 16,
+        ATTRIBUTE_INDEX_ADAPTIVE_FLOW_CONTROL  = 17
     };
 
     // CONSTANTS
@@ -8082,6 +8086,8 @@ class AppConfig {
 
     static const bool DEFAULT_INITIALIZER_CONFIGURE_STREAM;
 
+    static const bool DEFAULT_INITIALIZER_ADAPTIVE_FLOW_CONTROL;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -8241,6 +8247,10 @@ class AppConfig {
     // Return a reference to the modifiable "ConfigureStream" attribute of
     // this object.
 
+    bool& adaptiveFlowControl();
+    // Return a reference to the modifiable "AdaptiveFlowControl" attribute
+    // of this object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -8347,6 +8357,10 @@ class AppConfig {
 
     bool configureStream() const;
     // Return the value of the "ConfigureStream" attribute of this object.
+
+    bool adaptiveFlowControl() const;
+    // Return the value of the "AdaptiveFlowControl" attribute of this
+    // object.
 };
 
 // FREE OPERATORS
@@ -15968,6 +15982,13 @@ int AppConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_adaptiveFlowControl,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ADAPTIVE_FLOW_CONTROL]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -16057,6 +16078,11 @@ int AppConfig::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
             &d_configureStream,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONFIGURE_STREAM]);
     }
+    case ATTRIBUTE_ID_ADAPTIVE_FLOW_CONTROL: {
+        return manipulator(
+            &d_adaptiveFlowControl,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ADAPTIVE_FLOW_CONTROL]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -16162,6 +16188,11 @@ inline bool& AppConfig::configureStream()
     return d_configureStream;
 }
 
+inline bool& AppConfig::adaptiveFlowControl()
+{
+    return d_adaptiveFlowControl;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int AppConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -16270,6 +16301,13 @@ int AppConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(
+        d_adaptiveFlowControl,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ADAPTIVE_FLOW_CONTROL]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -16355,6 +16393,11 @@ int AppConfig::accessAttribute(t_ACCESSOR& accessor, int id) const
             d_configureStream,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONFIGURE_STREAM]);
     }
+    case ATTRIBUTE_ID_ADAPTIVE_FLOW_CONTROL: {
+        return accessor(
+            d_adaptiveFlowControl,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ADAPTIVE_FLOW_CONTROL]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -16460,6 +16503,11 @@ inline bool AppConfig::configureStream() const
     return d_configureStream;
 }
 
+inline bool AppConfig::adaptiveFlowControl() const
+{
+    return d_adaptiveFlowControl;
+}
+
 // ------------------------
 // class ClustersDefinition
 // ------------------------
@@ -17942,7 +17990,8 @@ inline bool mqbcfg::operator==(const mqbcfg::AppConfig& lhs,
            lhs.bmqconfConfig() == rhs.bmqconfConfig() &&
            lhs.plugins() == rhs.plugins() &&
            lhs.messagePropertiesV2() == rhs.messagePropertiesV2() &&
-           lhs.configureStream() == rhs.configureStream();
+           lhs.configureStream() == rhs.configureStream() &&
+           lhs.adaptiveFlowControl() == rhs.adaptiveFlowControl();
 }
 
 inline bool mqbcfg::operator!=(const mqbcfg::AppConfig& lhs,
@@ -17979,6 +18028,7 @@ void mqbcfg::hashAppend(t_HASH_ALGORITHM&        hashAlg,
     hashAppend(hashAlg, object.plugins());
     hashAppend(hashAlg, object.messagePropertiesV2());
     hashAppend(hashAlg, object.configureStream());
+    hashAppend(hashAlg, object.adaptiveFlowControl());
 }
 
 inline bool mqbcfg::operator==(const mqbcfg::ClustersDefinition& lhs,
@@ -90,6 +90,23 @@ struct CommandDefinition {
     {"STAT LIST_TUNABLES",
      "Get the supported settable parameters for the stat controller",
      "Get the supported settable parameters for the stat controller"},
+    {"STAT TRACE SHOW",
+     "Show the per-stage latencies of the sampled messages",
+     "Show, for the messages sampled by the message tracer (see the "
+     "'MESSAGETRACE.SAMPLINGPERIOD' tunable), the count and distribution of "
+     "the latencies between consecutive stages of their path in the broker"},
+    {"STAT TRACE EXPORT",
+     "Export the sampled messages as a Chrome trace",
+     "Export the stages of the messages sampled by the message tracer in the "
+     "Chrome trace event JSON format, to be loaded in 'chrome://tracing' or "
+     "Perfetto"},
+    {"STAT DISPATCHER [RESET]",
+     "Show (or reset) the profile of the dispatcher threads",
+     "Show, for each processor of the dispatcher, the share of time it spent "
+     "processing events and, per event type, the count, mean and maximum "
+     "processing time (along with the client of the slowest event) and the "
+     "distribution of the processing times since the last reset; or reset "
+     "these statistics if 'RESET' is specified"},
     // ClusterCatalog
     {"CLUSTERS LIST", "List all active clusters", "List all active clusters"},
     {"CLUSTERS ADDREVERSE <clusterName> <remotePeer>",
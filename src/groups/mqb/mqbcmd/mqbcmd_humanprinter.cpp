@@ -785,6 +785,21 @@ void printQueueState(bsl::ostream&     os,
                    << "]";
             }
         }
+
+        if (!storage.deduplication().isNull()) {
+            const DeduplicationStats& dedup = storage.deduplication().value();
+            os << mwcu::PrintUtil::newlineAndIndent(level + 2, spacesPerLevel)
+               << "Deduplication: [capacity: "
+               << mwcu::PrintUtil::prettyNumber(dedup.capacity())
+               << ", lookups: "
+               << mwcu::PrintUtil::prettyNumber(dedup.numLookups())
+               << ", exact hits: "
+               << mwcu::PrintUtil::prettyNumber(dedup.numExactHits())
+               << ", probable hits: "
+               << mwcu::PrintUtil::prettyNumber(dedup.numProbableHits())
+               << ", estimated false positive rate: "
+               << dedup.falsePositiveRate() << "]";
+        }
     }
     else {
         os << "none";
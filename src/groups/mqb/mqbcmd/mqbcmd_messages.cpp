@@ -1382,6 +1382,158 @@ Context::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     return stream;
 }
 
+// ------------------------
+// class DeduplicationStats
+// ------------------------
+
+// CONSTANTS
+
+const char DeduplicationStats::CLASS_NAME[] = "DeduplicationStats";
+
+const bdlat_AttributeInfo DeduplicationStats::ATTRIBUTE_INFO_ARRAY[] = {
+    {ATTRIBUTE_ID_CAPACITY,
+     "capacity",
+     sizeof("capacity") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_NUM_LOOKUPS,
+     "numLookups",
+     sizeof("numLookups") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_NUM_EXACT_HITS,
+     "numExactHits",
+     sizeof("numExactHits") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_NUM_PROBABLE_HITS,
+     "numProbableHits",
+     sizeof("numProbableHits") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_FALSE_POSITIVE_RATE,
+     "falsePositiveRate",
+     sizeof("falsePositiveRate") - 1,
+     "",
+     bdlat_FormattingMode::e_DEFAULT}};
+
+// CLASS METHODS
+
+const bdlat_AttributeInfo*
+DeduplicationStats::lookupAttributeInfo(const char* name, int nameLength)
+{
+    for (int i = 0; i < 5; ++i) {
+        const bdlat_AttributeInfo& attributeInfo =
+            DeduplicationStats::ATTRIBUTE_INFO_ARRAY[i];
+
+        if (nameLength == attributeInfo.d_nameLength &&
+            0 == bsl::memcmp(attributeInfo.d_name_p, name, nameLength)) {
+            return &attributeInfo;
+        }
+    }
+
+    return 0;
+}
+
+const bdlat_AttributeInfo* DeduplicationStats::lookupAttributeInfo(int id)
+{
+    switch (id) {
+    case ATTRIBUTE_ID_CAPACITY:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CAPACITY];
+    case ATTRIBUTE_ID_NUM_LOOKUPS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_LOOKUPS];
+    case ATTRIBUTE_ID_NUM_EXACT_HITS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_EXACT_HITS];
+    case ATTRIBUTE_ID_NUM_PROBABLE_HITS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_PROBABLE_HITS];
+    case ATTRIBUTE_ID_FALSE_POSITIVE_RATE:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FALSE_POSITIVE_RATE];
+    default: return 0;
+    }
+}
+
+// CREATORS
+
+DeduplicationStats::DeduplicationStats()
+: d_capacity()
+, d_numLookups()
+, d_numExactHits()
+, d_numProbableHits()
+, d_falsePositiveRate()
+{
+}
+
+DeduplicationStats::DeduplicationStats(const DeduplicationStats& original)
+: d_capacity(original.d_capacity)
+, d_numLookups(original.d_numLookups)
+, d_numExactHits(original.d_numExactHits)
+, d_numProbableHits(original.d_numProbableHits)
+, d_falsePositiveRate(original.d_falsePositiveRate)
+{
+}
+
+DeduplicationStats::~DeduplicationStats()
+{
+}
+
+// MANIPULATORS
+
+DeduplicationStats&
+DeduplicationStats::operator=(const DeduplicationStats& rhs)
+{
+    if (this != &rhs) {
+        d_capacity          = rhs.d_capacity;
+        d_numLookups        = rhs.d_numLookups;
+        d_numExactHits      = rhs.d_numExactHits;
+        d_numProbableHits   = rhs.d_numProbableHits;
+        d_falsePositiveRate = rhs.d_falsePositiveRate;
+    }
+
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+DeduplicationStats& DeduplicationStats::operator=(DeduplicationStats&& rhs)
+{
+    if (this != &rhs) {
+        d_capacity          = bsl::move(rhs.d_capacity);
+        d_numLookups        = bsl::move(rhs.d_numLookups);
+        d_numExactHits      = bsl::move(rhs.d_numExactHits);
+        d_numProbableHits   = bsl::move(rhs.d_numProbableHits);
+        d_falsePositiveRate = bsl::move(rhs.d_falsePositiveRate);
+    }
+
+    return *this;
+}
+#endif
+
+void DeduplicationStats::reset()
+{
+    bdlat_ValueTypeFunctions::reset(&d_capacity);
+    bdlat_ValueTypeFunctions::reset(&d_numLookups);
+    bdlat_ValueTypeFunctions::reset(&d_numExactHits);
+    bdlat_ValueTypeFunctions::reset(&d_numProbableHits);
+    bdlat_ValueTypeFunctions::reset(&d_falsePositiveRate);
+}
+
+// ACCESSORS
+
+bsl::ostream& DeduplicationStats::print(bsl::ostream& stream,
+                                        int           level,
+                                        int           spacesPerLevel) const
+{
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    printer.printAttribute("capacity", this->capacity());
+    printer.printAttribute("numLookups", this->numLookups());
+    printer.printAttribute("numExactHits", this->numExactHits());
+    printer.printAttribute("numProbableHits", this->numProbableHits());
+    printer.printAttribute("falsePositiveRate", this->falsePositiveRate());
+    printer.end();
+    return stream;
+}
+
 // -----------------------
 // class DomainReconfigure
 // -----------------------
@@ -7293,6 +7445,11 @@ const bdlat_AttributeInfo QueueStorage::ATTRIBUTE_INFO_ARRAY[] = {
      "virtualStorages",
      sizeof("virtualStorages") - 1,
      "",
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_DEDUPLICATION,
+     "deduplication",
+     sizeof("deduplication") - 1,
+     "",
      bdlat_FormattingMode::e_DEFAULT}};
 
 // CLASS METHODS
@@ -7300,7 +7457,7 @@ const bdlat_AttributeInfo QueueStorage::ATTRIBUTE_INFO_ARRAY[] = {
 const bdlat_AttributeInfo* QueueStorage::lookupAttributeInfo(const char* name,
                                                              int nameLength)
 {
-    for (int i = 0; i < 3; ++i) {
+    for (int i = 0; i < 4; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             QueueStorage::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -7322,6 +7479,8 @@ const bdlat_AttributeInfo* QueueStorage::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_BYTES];
     case ATTRIBUTE_ID_VIRTUAL_STORAGES:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_VIRTUAL_STORAGES];
+    case ATTRIBUTE_ID_DEDUPLICATION:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DEDUPLICATION];
     default: return 0;
     }
 }
@@ -7330,6 +7489,7 @@ const bdlat_AttributeInfo* QueueStorage::lookupAttributeInfo(int id)
 
 QueueStorage::QueueStorage(bslma::Allocator* basicAllocator)
 : d_virtualStorages(basicAllocator)
+, d_deduplication()
 , d_numMessages()
 , d_numBytes()
 {
@@ -7338,6 +7498,7 @@ QueueStorage::QueueStorage(bslma::Allocator* basicAllocator)
 QueueStorage::QueueStorage(const QueueStorage& original,
                            bslma::Allocator*   basicAllocator)
 : d_virtualStorages(original.d_virtualStorages, basicAllocator)
+, d_deduplication(original.d_deduplication)
 , d_numMessages(original.d_numMessages)
 , d_numBytes(original.d_numBytes)
 {
@@ -7347,6 +7508,7 @@ QueueStorage::QueueStorage(const QueueStorage& original,
     defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
 QueueStorage::QueueStorage(QueueStorage&& original) noexcept
 : d_virtualStorages(bsl::move(original.d_virtualStorages)),
+  d_deduplication(bsl::move(original.d_deduplication)),
   d_numMessages(bsl::move(original.d_numMessages)),
   d_numBytes(bsl::move(original.d_numBytes))
 {
@@ -7355,6 +7517,7 @@ QueueStorage::QueueStorage(QueueStorage&& original) noexcept
 QueueStorage::QueueStorage(QueueStorage&&    original,
                            bslma::Allocator* basicAllocator)
 : d_virtualStorages(bsl::move(original.d_virtualStorages), basicAllocator)
+, d_deduplication(bsl::move(original.d_deduplication))
 , d_numMessages(bsl::move(original.d_numMessages))
 , d_numBytes(bsl::move(original.d_numBytes))
 {
@@ -7373,6 +7536,7 @@ QueueStorage& QueueStorage::operator=(const QueueStorage& rhs)
         d_numMessages     = rhs.d_numMessages;
         d_numBytes        = rhs.d_numBytes;
         d_virtualStorages = rhs.d_virtualStorages;
+        d_deduplication   = rhs.d_deduplication;
     }
 
     return *this;
@@ -7386,6 +7550,7 @@ QueueStorage& QueueStorage::operator=(QueueStorage&& rhs)
         d_numMessages     = bsl::move(rhs.d_numMessages);
         d_numBytes        = bsl::move(rhs.d_numBytes);
         d_virtualStorages = bsl::move(rhs.d_virtualStorages);
+        d_deduplication   = bsl::move(rhs.d_deduplication);
     }
 
     return *this;
@@ -7397,6 +7562,7 @@ void QueueStorage::reset()
     bdlat_ValueTypeFunctions::reset(&d_numMessages);
     bdlat_ValueTypeFunctions::reset(&d_numBytes);
     bdlat_ValueTypeFunctions::reset(&d_virtualStorages);
+    bdlat_ValueTypeFunctions::reset(&d_deduplication);
 }
 
 // ACCESSORS
@@ -7409,6 +7575,7 @@ QueueStorage::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     printer.printAttribute("numMessages", this->numMessages());
     printer.printAttribute("numBytes", this->numBytes());
     printer.printAttribute("virtualStorages", this->virtualStorages());
+    printer.printAttribute("deduplication", this->deduplication());
     printer.end();
     return stream;
 }
@@ -14048,6 +14215,26 @@ const bdlat_SelectionInfo StatCommand::SELECTION_INFO_ARRAY[] = {
      "listTunables",
      sizeof("listTunables") - 1,
      "",
+     bdlat_FormattingMode::e_DEFAULT},
+    {SELECTION_ID_SHOW_TRACE,
+     "showTrace",
+     sizeof("showTrace") - 1,
+     "",
+     bdlat_FormattingMode::e_DEFAULT},
+    {SELECTION_ID_EXPORT_TRACE,
+     "exportTrace",
+     sizeof("exportTrace") - 1,
+     "",
+     bdlat_FormattingMode::e_DEFAULT},
+    {SELECTION_ID_SHOW_DISPATCHER,
+     "showDispatcher",
+     sizeof("showDispatcher") - 1,
+     "",
+     bdlat_FormattingMode::e_DEFAULT},
+    {SELECTION_ID_RESET_DISPATCHER,
+     "resetDispatcher",
+     sizeof("resetDispatcher") - 1,
+     "",
      bdlat_FormattingMode::e_DEFAULT}};
 
 // CLASS METHODS
@@ -14055,7 +14242,7 @@ const bdlat_SelectionInfo StatCommand::SELECTION_INFO_ARRAY[] = {
 const bdlat_SelectionInfo* StatCommand::lookupSelectionInfo(const char* name,
                                                             int nameLength)
 {
-    for (int i = 0; i < 4; ++i) {
+    for (int i = 0; i < 8; ++i) {
         const bdlat_SelectionInfo& selectionInfo =
             StatCommand::SELECTION_INFO_ARRAY[i];
 
@@ -14078,6 +14265,14 @@ const bdlat_SelectionInfo* StatCommand::lookupSelectionInfo(int id)
         return &SELECTION_INFO_ARRAY[SELECTION_INDEX_GET_TUNABLE];
     case SELECTION_ID_LIST_TUNABLES:
         return &SELECTION_INFO_ARRAY[SELECTION_INDEX_LIST_TUNABLES];
+    case SELECTION_ID_SHOW_TRACE:
+        return &SELECTION_INFO_ARRAY[SELECTION_INDEX_SHOW_TRACE];
+    case SELECTION_ID_EXPORT_TRACE:
+        return &SELECTION_INFO_ARRAY[SELECTION_INDEX_EXPORT_TRACE];
+    case SELECTION_ID_SHOW_DISPATCHER:
+        return &SELECTION_INFO_ARRAY[SELECTION_INDEX_SHOW_DISPATCHER];
+    case SELECTION_ID_RESET_DISPATCHER:
+        return &SELECTION_INFO_ARRAY[SELECTION_INDEX_RESET_DISPATCHER];
     default: return 0;
     }
 }
@@ -14104,6 +14299,20 @@ StatCommand::StatCommand(const StatCommand& original,
     case SELECTION_ID_LIST_TUNABLES: {
         new (d_listTunables.buffer()) Void(original.d_listTunables.object());
     } break;
+    case SELECTION_ID_SHOW_TRACE: {
+        new (d_showTrace.buffer()) Void(original.d_showTrace.object());
+    } break;
+    case SELECTION_ID_EXPORT_TRACE: {
+        new (d_exportTrace.buffer()) Void(original.d_exportTrace.object());
+    } break;
+    case SELECTION_ID_SHOW_DISPATCHER: {
+        new (d_showDispatcher.buffer())
+            Void(original.d_showDispatcher.object());
+    } break;
+    case SELECTION_ID_RESET_DISPATCHER: {
+        new (d_resetDispatcher.buffer())
+            Void(original.d_resetDispatcher.object());
+    } break;
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
     }
 }
@@ -14132,6 +14341,22 @@ StatCommand::StatCommand(StatCommand&& original) noexcept
         new (d_listTunables.buffer())
             Void(bsl::move(original.d_listTunables.object()));
     } break;
+    case SELECTION_ID_SHOW_TRACE: {
+        new (d_showTrace.buffer())
+            Void(bsl::move(original.d_showTrace.object()));
+    } break;
+    case SELECTION_ID_EXPORT_TRACE: {
+        new (d_exportTrace.buffer())
+            Void(bsl::move(original.d_exportTrace.object()));
+    } break;
+    case SELECTION_ID_SHOW_DISPATCHER: {
+        new (d_showDispatcher.buffer())
+            Void(bsl::move(original.d_showDispatcher.object()));
+    } break;
+    case SELECTION_ID_RESET_DISPATCHER: {
+        new (d_resetDispatcher.buffer())
+            Void(bsl::move(original.d_resetDispatcher.object()));
+    } break;
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
     }
 }
@@ -14159,6 +14384,22 @@ StatCommand::StatCommand(StatCommand&&     original,
         new (d_listTunables.buffer())
             Void(bsl::move(original.d_listTunables.object()));
     } break;
+    case SELECTION_ID_SHOW_TRACE: {
+        new (d_showTrace.buffer())
+            Void(bsl::move(original.d_showTrace.object()));
+    } break;
+    case SELECTION_ID_EXPORT_TRACE: {
+        new (d_exportTrace.buffer())
+            Void(bsl::move(original.d_exportTrace.object()));
+    } break;
+    case SELECTION_ID_SHOW_DISPATCHER: {
+        new (d_showDispatcher.buffer())
+            Void(bsl::move(original.d_showDispatcher.object()));
+    } break;
+    case SELECTION_ID_RESET_DISPATCHER: {
+        new (d_resetDispatcher.buffer())
+            Void(bsl::move(original.d_resetDispatcher.object()));
+    } break;
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
     }
 }
@@ -14182,6 +14423,18 @@ StatCommand& StatCommand::operator=(const StatCommand& rhs)
         case SELECTION_ID_LIST_TUNABLES: {
             makeListTunables(rhs.d_listTunables.object());
         } break;
+        case SELECTION_ID_SHOW_TRACE: {
+            makeShowTrace(rhs.d_showTrace.object());
+        } break;
+        case SELECTION_ID_EXPORT_TRACE: {
+            makeExportTrace(rhs.d_exportTrace.object());
+        } break;
+        case SELECTION_ID_SHOW_DISPATCHER: {
+            makeShowDispatcher(rhs.d_showDispatcher.object());
+        } break;
+        case SELECTION_ID_RESET_DISPATCHER: {
+            makeResetDispatcher(rhs.d_resetDispatcher.object());
+        } break;
         default:
             BSLS_ASSERT(SELECTION_ID_UNDEFINED == rhs.d_selectionId);
             reset();
@@ -14209,6 +14462,18 @@ StatCommand& StatCommand::operator=(StatCommand&& rhs)
         case SELECTION_ID_LIST_TUNABLES: {
             makeListTunables(bsl::move(rhs.d_listTunables.object()));
         } break;
+        case SELECTION_ID_SHOW_TRACE: {
+            makeShowTrace(bsl::move(rhs.d_showTrace.object()));
+        } break;
+        case SELECTION_ID_EXPORT_TRACE: {
+            makeExportTrace(bsl::move(rhs.d_exportTrace.object()));
+        } break;
+        case SELECTION_ID_SHOW_DISPATCHER: {
+            makeShowDispatcher(bsl::move(rhs.d_showDispatcher.object()));
+        } break;
+        case SELECTION_ID_RESET_DISPATCHER: {
+            makeResetDispatcher(bsl::move(rhs.d_resetDispatcher.object()));
+        } break;
         default:
             BSLS_ASSERT(SELECTION_ID_UNDEFINED == rhs.d_selectionId);
             reset();
@@ -14235,6 +14500,18 @@ void StatCommand::reset()
     case SELECTION_ID_LIST_TUNABLES: {
         d_listTunables.object().~Void();
     } break;
+    case SELECTION_ID_SHOW_TRACE: {
+        d_showTrace.object().~Void();
+    } break;
+    case SELECTION_ID_EXPORT_TRACE: {
+        d_exportTrace.object().~Void();
+    } break;
+    case SELECTION_ID_SHOW_DISPATCHER: {
+        d_showDispatcher.object().~Void();
+    } break;
+    case SELECTION_ID_RESET_DISPATCHER: {
+        d_resetDispatcher.object().~Void();
+    } break;
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
     }
 
@@ -14256,6 +14533,18 @@ int StatCommand::makeSelection(int selectionId)
     case SELECTION_ID_LIST_TUNABLES: {
         makeListTunables();
     } break;
+    case SELECTION_ID_SHOW_TRACE: {
+        makeShowTrace();
+    } break;
+    case SELECTION_ID_EXPORT_TRACE: {
+        makeExportTrace();
+    } break;
+    case SELECTION_ID_SHOW_DISPATCHER: {
+        makeShowDispatcher();
+    } break;
+    case SELECTION_ID_RESET_DISPATCHER: {
+        makeResetDispatcher();
+    } break;
     case SELECTION_ID_UNDEFINED: {
         reset();
     } break;
@@ -14457,6 +14746,186 @@ Void& StatCommand::makeListTunables(Void&& value)
 }
 #endif
 
+Void& StatCommand::makeShowTrace()
+{
+    if (SELECTION_ID_SHOW_TRACE == d_selectionId) {
+        bdlat_ValueTypeFunctions::reset(&d_showTrace.object());
+    }
+    else {
+        reset();
+        new (d_showTrace.buffer()) Void();
+        d_selectionId = SELECTION_ID_SHOW_TRACE;
+    }
+
+    return d_showTrace.object();
+}
+
+Void& StatCommand::makeShowTrace(const Void& value)
+{
+    if (SELECTION_ID_SHOW_TRACE == d_selectionId) {
+        d_showTrace.object() = value;
+    }
+    else {
+        reset();
+        new (d_showTrace.buffer()) Void(value);
+        d_selectionId = SELECTION_ID_SHOW_TRACE;
+    }
+
+    return d_showTrace.object();
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+Void& StatCommand::makeShowTrace(Void&& value)
+{
+    if (SELECTION_ID_SHOW_TRACE == d_selectionId) {
+        d_showTrace.object() = bsl::move(value);
+    }
+    else {
+        reset();
+        new (d_showTrace.buffer()) Void(bsl::move(value));
+        d_selectionId = SELECTION_ID_SHOW_TRACE;
+    }
+
+    return d_showTrace.object();
+}
+#endif
+
+Void& StatCommand::makeExportTrace()
+{
+    if (SELECTION_ID_EXPORT_TRACE == d_selectionId) {
+        bdlat_ValueTypeFunctions::reset(&d_exportTrace.object());
+    }
+    else {
+        reset();
+        new (d_exportTrace.buffer()) Void();
+        d_selectionId = SELECTION_ID_EXPORT_TRACE;
+    }
+
+    return d_exportTrace.object();
+}
+
+Void& StatCommand::makeExportTrace(const Void& value)
+{
+    if (SELECTION_ID_EXPORT_TRACE == d_selectionId) {
+        d_exportTrace.object() = value;
+    }
+    else {
+        reset();
+        new (d_exportTrace.buffer()) Void(value);
+        d_selectionId = SELECTION_ID_EXPORT_TRACE;
+    }
+
+    return d_exportTrace.object();
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+Void& StatCommand::makeExportTrace(Void&& value)
+{
+    if (SELECTION_ID_EXPORT_TRACE == d_selectionId) {
+        d_exportTrace.object() = bsl::move(value);
+    }
+    else {
+        reset();
+        new (d_exportTrace.buffer()) Void(bsl::move(value));
+        d_selectionId = SELECTION_ID_EXPORT_TRACE;
+    }
+
+    return d_exportTrace.object();
+}
+#endif
+
+Void& StatCommand::makeShowDispatcher()
+{
+    if (SELECTION_ID_SHOW_DISPATCHER == d_selectionId) {
+        bdlat_ValueTypeFunctions::reset(&d_showDispatcher.object());
+    }
+    else {
+        reset();
+        new (d_showDispatcher.buffer()) Void();
+        d_selectionId = SELECTION_ID_SHOW_DISPATCHER;
+    }
+
+    return d_showDispatcher.object();
+}
+
+Void& StatCommand::makeShowDispatcher(const Void& value)
+{
+    if (SELECTION_ID_SHOW_DISPATCHER == d_selectionId) {
+        d_showDispatcher.object() = value;
+    }
+    else {
+        reset();
+        new (d_showDispatcher.buffer()) Void(value);
+        d_selectionId = SELECTION_ID_SHOW_DISPATCHER;
+    }
+
+    return d_showDispatcher.object();
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+Void& StatCommand::makeShowDispatcher(Void&& value)
+{
+    if (SELECTION_ID_SHOW_DISPATCHER == d_selectionId) {
+        d_showDispatcher.object() = bsl::move(value);
+    }
+    else {
+        reset();
+        new (d_showDispatcher.buffer()) Void(bsl::move(value));
+        d_selectionId = SELECTION_ID_SHOW_DISPATCHER;
+    }
+
+    return d_showDispatcher.object();
+}
+#endif
+
+Void& StatCommand::makeResetDispatcher()
+{
+    if (SELECTION_ID_RESET_DISPATCHER == d_selectionId) {
+        bdlat_ValueTypeFunctions::reset(&d_resetDispatcher.object());
+    }
+    else {
+        reset();
+        new (d_resetDispatcher.buffer()) Void();
+        d_selectionId = SELECTION_ID_RESET_DISPATCHER;
+    }
+
+    return d_resetDispatcher.object();
+}
+
+Void& StatCommand::makeResetDispatcher(const Void& value)
+{
+    if (SELECTION_ID_RESET_DISPATCHER == d_selectionId) {
+        d_resetDispatcher.object() = value;
+    }
+    else {
+        reset();
+        new (d_resetDispatcher.buffer()) Void(value);
+        d_selectionId = SELECTION_ID_RESET_DISPATCHER;
+    }
+
+    return d_resetDispatcher.object();
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+Void& StatCommand::makeResetDispatcher(Void&& value)
+{
+    if (SELECTION_ID_RESET_DISPATCHER == d_selectionId) {
+        d_resetDispatcher.object() = bsl::move(value);
+    }
+    else {
+        reset();
+        new (d_resetDispatcher.buffer()) Void(bsl::move(value));
+        d_selectionId = SELECTION_ID_RESET_DISPATCHER;
+    }
+
+    return d_resetDispatcher.object();
+}
+#endif
+
 // ACCESSORS
 
 bsl::ostream&
@@ -14477,6 +14946,18 @@ StatCommand::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     case SELECTION_ID_LIST_TUNABLES: {
         printer.printAttribute("listTunables", d_listTunables.object());
     } break;
+    case SELECTION_ID_SHOW_TRACE: {
+        printer.printAttribute("showTrace", d_showTrace.object());
+    } break;
+    case SELECTION_ID_EXPORT_TRACE: {
+        printer.printAttribute("exportTrace", d_exportTrace.object());
+    } break;
+    case SELECTION_ID_SHOW_DISPATCHER: {
+        printer.printAttribute("showDispatcher", d_showDispatcher.object());
+    } break;
+    case SELECTION_ID_RESET_DISPATCHER: {
+        printer.printAttribute("resetDispatcher", d_resetDispatcher.object());
+    } break;
     default: stream << "SELECTION UNDEFINED\n";
     }
     printer.end();
@@ -14494,6 +14975,14 @@ const char* StatCommand::selectionName() const
         return SELECTION_INFO_ARRAY[SELECTION_INDEX_GET_TUNABLE].name();
     case SELECTION_ID_LIST_TUNABLES:
         return SELECTION_INFO_ARRAY[SELECTION_INDEX_LIST_TUNABLES].name();
+    case SELECTION_ID_SHOW_TRACE:
+        return SELECTION_INFO_ARRAY[SELECTION_INDEX_SHOW_TRACE].name();
+    case SELECTION_ID_EXPORT_TRACE:
+        return SELECTION_INFO_ARRAY[SELECTION_INDEX_EXPORT_TRACE].name();
+    case SELECTION_ID_SHOW_DISPATCHER:
+        return SELECTION_INFO_ARRAY[SELECTION_INDEX_SHOW_DISPATCHER].name();
+    case SELECTION_ID_RESET_DISPATCHER:
+        return SELECTION_INFO_ARRAY[SELECTION_INDEX_RESET_DISPATCHER].name();
     default:
         BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
         return "(* UNDEFINED *)";
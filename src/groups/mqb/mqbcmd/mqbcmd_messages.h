@@ -92,6 +92,9 @@ namespace mqbcmd {
 class Context;
 }
 namespace mqbcmd {
+class DeduplicationStats;
+}
+namespace mqbcmd {
 class DomainReconfigure;
 }
 namespace mqbcmd {
@@ -2455,6 +2458,242 @@ BDLAT_DECL_SEQUENCE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(mqbcmd::Context)
 
 namespace mqbcmd {
 
+// ========================
+// class DeduplicationStats
+// ========================
+
+class DeduplicationStats {
+    // INSTANCE DATA
+    bsls::Types::Int64 d_capacity;
+    bsls::Types::Int64 d_numLookups;
+    bsls::Types::Int64 d_numExactHits;
+    bsls::Types::Int64 d_numProbableHits;
+    double             d_falsePositiveRate;
+
+  public:
+    // TYPES
+    enum {
+        ATTRIBUTE_ID_CAPACITY            = 0,
+        ATTRIBUTE_ID_NUM_LOOKUPS         = 1,
+        ATTRIBUTE_ID_NUM_EXACT_HITS      = 2,
+        ATTRIBUTE_ID_NUM_PROBABLE_HITS   = 3,
+        ATTRIBUTE_ID_FALSE_POSITIVE_RATE = 4
+    };
+
+    enum { NUM_ATTRIBUTES = 5 };
+
+    enum {
+        ATTRIBUTE_INDEX_CAPACITY            = 0,
+        ATTRIBUTE_INDEX_NUM_LOOKUPS         = 1,
+        ATTRIBUTE_INDEX_NUM_EXACT_HITS      = 2,
+        ATTRIBUTE_INDEX_NUM_PROBABLE_HITS   = 3,
+        ATTRIBUTE_INDEX_FALSE_POSITIVE_RATE = 4
+    };
+
+    // CONSTANTS
+    static const char CLASS_NAME[];
+
+    static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+
+  public:
+    // CLASS METHODS
+
+    /// Return attribute information for the attribute indicated by the
+    /// specified `id` if the attribute exists, and 0 otherwise.
+    static const bdlat_AttributeInfo* lookupAttributeInfo(int id);
+
+    /// Return attribute information for the attribute indicated by the
+    /// specified `name` of the specified `nameLength` if the attribute
+    /// exists, and 0 otherwise.
+    static const bdlat_AttributeInfo* lookupAttributeInfo(const char* name,
+                                                          int nameLength);
+
+    // CREATORS
+
+    /// Create an object of type `DeduplicationStats` having the default value.
+    DeduplicationStats();
+
+    /// Create an object of type `DeduplicationStats` having the value of the
+    /// specified `original` object.
+    DeduplicationStats(const DeduplicationStats& original);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+    /// Create an object of type `DeduplicationStats` having the value of the
+    /// specified `original` object.  After performing this action, the
+    /// `original` object will be left in a valid, but unspecified state.
+    DeduplicationStats(DeduplicationStats&& original) = default;
+#endif
+
+    /// Destroy this object.
+    ~DeduplicationStats();
+
+    // MANIPULATORS
+
+    /// Assign to this object the value of the specified `rhs` object.
+    DeduplicationStats& operator=(const DeduplicationStats& rhs);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+    /// Assign to this object the value of the specified `rhs` object.
+    /// After performing this action, the `rhs` object will be left in a
+    /// valid, but unspecified state.
+    DeduplicationStats& operator=(DeduplicationStats&& rhs);
+#endif
+
+    /// Reset this object to the default value (i.e., its value upon
+    /// default construction).
+    void reset();
+
+    /// Invoke the specified `manipulator` sequentially on the address of
+    /// each (modifiable) attribute of this object, supplying `manipulator`
+    /// with the corresponding attribute information structure until such
+    /// invocation returns a non-zero value.  Return the value from the
+    /// last invocation of `manipulator` (i.e., the invocation that
+    /// terminated the sequence).
+    template <class MANIPULATOR>
+    int manipulateAttributes(MANIPULATOR& manipulator);
+
+    /// Invoke the specified `manipulator` on the address of
+    /// the (modifiable) attribute indicated by the specified `id`,
+    /// supplying `manipulator` with the corresponding attribute
+    /// information structure.  Return the value returned from the
+    /// invocation of `manipulator` if `id` identifies an attribute of this
+    /// class, and -1 otherwise.
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR& manipulator, int id);
+
+    /// Invoke the specified `manipulator` on the address of
+    /// the (modifiable) attribute indicated by the specified `name` of the
+    /// specified `nameLength`, supplying `manipulator` with the
+    /// corresponding attribute information structure.  Return the value
+    /// returned from the invocation of `manipulator` if `name` identifies
+    /// an attribute of this class, and -1 otherwise.
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR& manipulator,
+                            const char*  name,
+                            int          nameLength);
+
+    /// Return a reference to the modifiable "Capacity" attribute of this
+    /// object.
+    bsls::Types::Int64& capacity();
+
+    /// Return a reference to the modifiable "NumLookups" attribute of this
+    /// object.
+    bsls::Types::Int64& numLookups();
+
+    /// Return a reference to the modifiable "NumExactHits" attribute of this
+    /// object.
+    bsls::Types::Int64& numExactHits();
+
+    /// Return a reference to the modifiable "NumProbableHits" attribute of
+    /// this object.
+    bsls::Types::Int64& numProbableHits();
+
+    /// Return a reference to the modifiable "FalsePositiveRate" attribute of
+    /// this object.
+    double& falsePositiveRate();
+
+    // ACCESSORS
+
+    /// Format this object to the specified output `stream` at the
+    /// optionally specified indentation `level` and return a reference to
+    /// the modifiable `stream`.  If `level` is specified, optionally
+    /// specify `spacesPerLevel`, the number of spaces per indentation level
+    /// for this and all of its nested objects.  Each line is indented by
+    /// the absolute value of `level * spacesPerLevel`.  If `level` is
+    /// negative, suppress indentation of the first line.  If
+    /// `spacesPerLevel` is negative, suppress line breaks and format the
+    /// entire output on one line.  If `stream` is initially invalid, this
+    /// operation has no effect.  Note that a trailing newline is provided
+    /// in multiline mode only.
+    bsl::ostream&
+    print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
+
+    /// Invoke the specified `accessor` sequentially on each
+    /// (non-modifiable) attribute of this object, supplying `accessor`
+    /// with the corresponding attribute information structure until such
+    /// invocation returns a non-zero value.  Return the value from the
+    /// last invocation of `accessor` (i.e., the invocation that terminated
+    /// the sequence).
+    template <class ACCESSOR>
+    int accessAttributes(ACCESSOR& accessor) const;
+
+    /// Invoke the specified `accessor` on the (non-modifiable) attribute
+    /// of this object indicated by the specified `id`, supplying `accessor`
+    /// with the corresponding attribute information structure.  Return the
+    /// value returned from the invocation of `accessor` if `id` identifies
+    /// an attribute of this class, and -1 otherwise.
+    template <class ACCESSOR>
+    int accessAttribute(ACCESSOR& accessor, int id) const;
+
+    /// Invoke the specified `accessor` on the (non-modifiable) attribute
+    /// of this object indicated by the specified `name` of the specified
+    /// `nameLength`, supplying `accessor` with the corresponding attribute
+    /// information structure.  Return the value returned from the
+    /// invocation of `accessor` if `name` identifies an attribute of this
+    /// class, and -1 otherwise.
+    template <class ACCESSOR>
+    int accessAttribute(ACCESSOR&   accessor,
+                        const char* name,
+                        int         nameLength) const;
+
+    /// Return a reference to the non-modifiable "Capacity" attribute of this
+    /// object.
+    bsls::Types::Int64 capacity() const;
+
+    /// Return a reference to the non-modifiable "NumLookups" attribute of this
+    /// object.
+    bsls::Types::Int64 numLookups() const;
+
+    /// Return a reference to the non-modifiable "NumExactHits" attribute of
+    /// this object.
+    bsls::Types::Int64 numExactHits() const;
+
+    /// Return a reference to the non-modifiable "NumProbableHits" attribute of
+    /// this object.
+    bsls::Types::Int64 numProbableHits() const;
+
+    /// Return a reference to the non-modifiable "FalsePositiveRate" attribute
+    /// of this object.
+    double falsePositiveRate() const;
+};
+
+// FREE OPERATORS
+
+/// Return `true` if the specified `lhs` and `rhs` attribute objects have
+/// the same value, and `false` otherwise.  Two attribute objects have the
+/// same value if each respective attribute has the same value.
+inline bool operator==(const DeduplicationStats& lhs,
+                       const DeduplicationStats& rhs);
+
+/// Return `true` if the specified `lhs` and `rhs` attribute objects do not
+/// have the same value, and `false` otherwise.  Two attribute objects do
+/// not have the same value if one or more respective attributes differ in
+/// values.
+inline bool operator!=(const DeduplicationStats& lhs,
+                       const DeduplicationStats& rhs);
+
+/// Format the specified `rhs` to the specified output `stream` and
+/// return a reference to the modifiable `stream`.
+inline bsl::ostream& operator<<(bsl::ostream&             stream,
+                                const DeduplicationStats& rhs);
+
+/// Pass the specified `object` to the specified `hashAlg`.  This function
+/// integrates with the `bslh` modular hashing system and effectively
+/// provides a `bsl::hash` specialization for `DeduplicationStats`.
+template <typename HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM&                   hashAlg,
+                const mqbcmd::DeduplicationStats& object);
+
+}  // close package namespace
+
+// TRAITS
+
+BDLAT_DECL_SEQUENCE_WITH_BITWISEMOVEABLE_TRAITS(mqbcmd::DeduplicationStats)
+
+namespace mqbcmd {
+
 // =======================
 // class DomainReconfigure
 // =======================
@@ -9967,24 +10206,27 @@ namespace mqbcmd {
 
 class QueueStorage {
     // INSTANCE DATA
-    bsl::vector<VirtualStorage> d_virtualStorages;
-    unsigned int                d_numMessages;
-    unsigned int                d_numBytes;
+    bsl::vector<VirtualStorage>             d_virtualStorages;
+    bdlb::NullableValue<DeduplicationStats> d_deduplication;
+    unsigned int                            d_numMessages;
+    unsigned int                            d_numBytes;
 
   public:
     // TYPES
     enum {
         ATTRIBUTE_ID_NUM_MESSAGES     = 0,
         ATTRIBUTE_ID_NUM_BYTES        = 1,
-        ATTRIBUTE_ID_VIRTUAL_STORAGES = 2
+        ATTRIBUTE_ID_VIRTUAL_STORAGES = 2,
+        ATTRIBUTE_ID_DEDUPLICATION    = 3
     };
 
-    enum { NUM_ATTRIBUTES = 3 };
+    enum { NUM_ATTRIBUTES = 4 };
 
     enum {
         ATTRIBUTE_INDEX_NUM_MESSAGES     = 0,
         ATTRIBUTE_INDEX_NUM_BYTES        = 1,
-        ATTRIBUTE_INDEX_VIRTUAL_STORAGES = 2
+        ATTRIBUTE_INDEX_VIRTUAL_STORAGES = 2,
+        ATTRIBUTE_INDEX_DEDUPLICATION    = 3
     };
 
     // CONSTANTS
@@ -10097,6 +10339,10 @@ class QueueStorage {
     /// this object.
     bsl::vector<VirtualStorage>& virtualStorages();
 
+    /// Return a reference to the modifiable "Deduplication" attribute of
+    /// this object.
+    bdlb::NullableValue<DeduplicationStats>& deduplication();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -10152,6 +10398,10 @@ class QueueStorage {
     /// Return a reference to the non-modifiable "VirtualStorages" attribute
     /// of this object.
     const bsl::vector<VirtualStorage>& virtualStorages() const;
+
+    /// Return a reference to the non-modifiable "Deduplication" attribute
+    /// of this object.
+    const bdlb::NullableValue<DeduplicationStats>& deduplication() const;
 };
 
 // FREE OPERATORS
@@ -17654,6 +17904,10 @@ class StatCommand {
         bsls::ObjectBuffer<SetTunable>  d_setTunable;
         bsls::ObjectBuffer<bsl::string> d_getTunable;
         bsls::ObjectBuffer<Void>        d_listTunables;
+        bsls::ObjectBuffer<Void>        d_showTrace;
+        bsls::ObjectBuffer<Void>        d_exportTrace;
+        bsls::ObjectBuffer<Void>        d_showDispatcher;
+        bsls::ObjectBuffer<Void>        d_resetDispatcher;
     };
 
     int               d_selectionId;
@@ -17663,20 +17917,28 @@ class StatCommand {
     // TYPES
 
     enum {
-        SELECTION_ID_UNDEFINED     = -1,
-        SELECTION_ID_SHOW          = 0,
-        SELECTION_ID_SET_TUNABLE   = 1,
-        SELECTION_ID_GET_TUNABLE   = 2,
-        SELECTION_ID_LIST_TUNABLES = 3
+        SELECTION_ID_UNDEFINED        = -1,
+        SELECTION_ID_SHOW             = 0,
+        SELECTION_ID_SET_TUNABLE      = 1,
+        SELECTION_ID_GET_TUNABLE      = 2,
+        SELECTION_ID_LIST_TUNABLES    = 3,
+        SELECTION_ID_SHOW_TRACE       = 4,
+        SELECTION_ID_EXPORT_TRACE     = 5,
+        SELECTION_ID_SHOW_DISPATCHER  = 6,
+        SELECTION_ID_RESET_DISPATCHER = 7
     };
 
-    enum { NUM_SELECTIONS = 4 };
+    enum { NUM_SELECTIONS = 8 };
 
     enum {
-        SELECTION_INDEX_SHOW          = 0,
-        SELECTION_INDEX_SET_TUNABLE   = 1,
-        SELECTION_INDEX_GET_TUNABLE   = 2,
-        SELECTION_INDEX_LIST_TUNABLES = 3
+        SELECTION_INDEX_SHOW             = 0,
+        SELECTION_INDEX_SET_TUNABLE      = 1,
+        SELECTION_INDEX_GET_TUNABLE      = 2,
+        SELECTION_INDEX_LIST_TUNABLES    = 3,
+        SELECTION_INDEX_SHOW_TRACE       = 4,
+        SELECTION_INDEX_EXPORT_TRACE     = 5,
+        SELECTION_INDEX_SHOW_DISPATCHER  = 6,
+        SELECTION_INDEX_RESET_DISPATCHER = 7
     };
 
     // CONSTANTS
@@ -17798,6 +18060,46 @@ class StatCommand {
     // Optionally specify the 'value' of the "ListTunables".  If 'value' is
     // not specified, the default "ListTunables" value is used.
 
+    Void& makeShowTrace();
+    Void& makeShowTrace(const Void& value);
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+    Void& makeShowTrace(Void&& value);
+#endif
+    // Set the value of this object to be a "ShowTrace" value.
+    // Optionally specify the 'value' of the "ShowTrace".  If 'value' is
+    // not specified, the default "ShowTrace" value is used.
+
+    Void& makeExportTrace();
+    Void& makeExportTrace(const Void& value);
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+    Void& makeExportTrace(Void&& value);
+#endif
+    // Set the value of this object to be a "ExportTrace" value.
+    // Optionally specify the 'value' of the "ExportTrace".  If 'value' is
+    // not specified, the default "ExportTrace" value is used.
+
+    Void& makeShowDispatcher();
+    Void& makeShowDispatcher(const Void& value);
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+    Void& makeShowDispatcher(Void&& value);
+#endif
+    // Set the value of this object to be a "ShowDispatcher" value.
+    // Optionally specify the 'value' of the "ShowDispatcher".  If 'value' is
+    // not specified, the default "ShowDispatcher" value is used.
+
+    Void& makeResetDispatcher();
+    Void& makeResetDispatcher(const Void& value);
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+    Void& makeResetDispatcher(Void&& value);
+#endif
+    // Set the value of this object to be a "ResetDispatcher" value.
+    // Optionally specify the 'value' of the "ResetDispatcher".  If 'value' is
+    // not specified, the default "ResetDispatcher" value is used.
+
     /// Invoke the specified `manipulator` on the address of the modifiable
     /// selection, supplying `manipulator` with the corresponding selection
     /// information structure.  Return the value returned from the
@@ -17827,6 +18129,30 @@ class StatCommand {
     /// object.
     Void& listTunables();
 
+    /// Return a reference to the modifiable "ShowTrace" selection of
+    /// this object if "ShowTrace" is the current selection.  The
+    /// behavior is undefined unless "ShowTrace" is the selection of this
+    /// object.
+    Void& showTrace();
+
+    /// Return a reference to the modifiable "ExportTrace" selection of
+    /// this object if "ExportTrace" is the current selection.  The
+    /// behavior is undefined unless "ExportTrace" is the selection of this
+    /// object.
+    Void& exportTrace();
+
+    /// Return a reference to the modifiable "ShowDispatcher" selection of
+    /// this object if "ShowDispatcher" is the current selection.  The
+    /// behavior is undefined unless "ShowDispatcher" is the selection of this
+    /// object.
+    Void& showDispatcher();
+
+    /// Return a reference to the modifiable "ResetDispatcher" selection of
+    /// this object if "ResetDispatcher" is the current selection.  The
+    /// behavior is undefined unless "ResetDispatcher" is the selection of this
+    /// object.
+    Void& resetDispatcher();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -17875,6 +18201,30 @@ class StatCommand {
     /// object.
     const Void& listTunables() const;
 
+    /// Return a reference to the non-modifiable "ShowTrace" selection of
+    /// this object if "ShowTrace" is the current selection.  The
+    /// behavior is undefined unless "ShowTrace" is the selection of this
+    /// object.
+    const Void& showTrace() const;
+
+    /// Return a reference to the non-modifiable "ExportTrace" selection of
+    /// this object if "ExportTrace" is the current selection.  The
+    /// behavior is undefined unless "ExportTrace" is the selection of this
+    /// object.
+    const Void& exportTrace() const;
+
+    /// Return a reference to the non-modifiable "ShowDispatcher" selection of
+    /// this object if "ShowDispatcher" is the current selection.  The
+    /// behavior is undefined unless "ShowDispatcher" is the selection of this
+    /// object.
+    const Void& showDispatcher() const;
+
+    /// Return a reference to the non-modifiable "ResetDispatcher" selection of
+    /// this object if "ResetDispatcher" is the current selection.  The
+    /// behavior is undefined unless "ResetDispatcher" is the selection of this
+    /// object.
+    const Void& resetDispatcher() const;
+
     /// Return `true` if the value of this object is a "Show" value, and
     /// return `false` otherwise.
     bool isShowValue() const;
@@ -17891,6 +18241,22 @@ class StatCommand {
     /// and return `false` otherwise.
     bool isListTunablesValue() const;
 
+    /// Return `true` if the value of this object is a "ShowTrace" value,
+    /// and return `false` otherwise.
+    bool isShowTraceValue() const;
+
+    /// Return `true` if the value of this object is a "ExportTrace" value,
+    /// and return `false` otherwise.
+    bool isExportTraceValue() const;
+
+    /// Return `true` if the value of this object is a "ShowDispatcher" value,
+    /// and return `false` otherwise.
+    bool isShowDispatcherValue() const;
+
+    /// Return `true` if the value of this object is a "ResetDispatcher" value,
+    /// and return `false` otherwise.
+    bool isResetDispatcherValue() const;
+
     /// Return `true` if the value of this object is undefined, and `false`
     /// otherwise.
     bool isUndefinedValue() const;
@@ -29819,6 +30185,250 @@ void hashAppend(HASH_ALGORITHM& hashAlg, const mqbcmd::Context& object)
     hashAppend(hashAlg, object.queueHandleParametersJson());
 }
 
+// ------------------------
+// class DeduplicationStats
+// ------------------------
+
+// CLASS METHODS
+// MANIPULATORS
+template <class MANIPULATOR>
+int DeduplicationStats::manipulateAttributes(MANIPULATOR& manipulator)
+{
+    int ret;
+
+    ret = manipulator(&d_capacity,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CAPACITY]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_numLookups,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_LOOKUPS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_numExactHits,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_EXACT_HITS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_numProbableHits,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_PROBABLE_HITS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_falsePositiveRate,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FALSE_POSITIVE_RATE]);
+    if (ret) {
+        return ret;
+    }
+
+    return ret;
+}
+
+template <class MANIPULATOR>
+int DeduplicationStats::manipulateAttribute(MANIPULATOR& manipulator, int id)
+{
+    enum { NOT_FOUND = -1 };
+
+    switch (id) {
+    case ATTRIBUTE_ID_CAPACITY: {
+        return manipulator(&d_capacity,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CAPACITY]);
+    }
+    case ATTRIBUTE_ID_NUM_LOOKUPS: {
+        return manipulator(&d_numLookups,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_LOOKUPS]);
+    }
+    case ATTRIBUTE_ID_NUM_EXACT_HITS: {
+        return manipulator(
+            &d_numExactHits,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_EXACT_HITS]);
+    }
+    case ATTRIBUTE_ID_NUM_PROBABLE_HITS: {
+        return manipulator(
+            &d_numProbableHits,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_PROBABLE_HITS]);
+    }
+    case ATTRIBUTE_ID_FALSE_POSITIVE_RATE: {
+        return manipulator(
+            &d_falsePositiveRate,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FALSE_POSITIVE_RATE]);
+    }
+    default: return NOT_FOUND;
+    }
+}
+
+template <class MANIPULATOR>
+int DeduplicationStats::manipulateAttribute(MANIPULATOR& manipulator,
+                                            const char*  name,
+                                            int          nameLength)
+{
+    enum { NOT_FOUND = -1 };
+
+    const bdlat_AttributeInfo* attributeInfo = lookupAttributeInfo(name,
+                                                                   nameLength);
+    if (0 == attributeInfo) {
+        return NOT_FOUND;
+    }
+
+    return manipulateAttribute(manipulator, attributeInfo->d_id);
+}
+
+inline bsls::Types::Int64& DeduplicationStats::capacity()
+{
+    return d_capacity;
+}
+
+inline bsls::Types::Int64& DeduplicationStats::numLookups()
+{
+    return d_numLookups;
+}
+
+inline bsls::Types::Int64& DeduplicationStats::numExactHits()
+{
+    return d_numExactHits;
+}
+
+inline bsls::Types::Int64& DeduplicationStats::numProbableHits()
+{
+    return d_numProbableHits;
+}
+
+inline double& DeduplicationStats::falsePositiveRate()
+{
+    return d_falsePositiveRate;
+}
+
+// ACCESSORS
+template <class ACCESSOR>
+int DeduplicationStats::accessAttributes(ACCESSOR& accessor) const
+{
+    int ret;
+
+    ret = accessor(d_capacity, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CAPACITY]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_numLookups,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_LOOKUPS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_numExactHits,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_EXACT_HITS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_numProbableHits,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_PROBABLE_HITS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_falsePositiveRate,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FALSE_POSITIVE_RATE]);
+    if (ret) {
+        return ret;
+    }
+
+    return ret;
+}
+
+template <class ACCESSOR>
+int DeduplicationStats::accessAttribute(ACCESSOR& accessor, int id) const
+{
+    enum { NOT_FOUND = -1 };
+
+    switch (id) {
+    case ATTRIBUTE_ID_CAPACITY: {
+        return accessor(d_capacity,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CAPACITY]);
+    }
+    case ATTRIBUTE_ID_NUM_LOOKUPS: {
+        return accessor(d_numLookups,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_LOOKUPS]);
+    }
+    case ATTRIBUTE_ID_NUM_EXACT_HITS: {
+        return accessor(d_numExactHits,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_EXACT_HITS]);
+    }
+    case ATTRIBUTE_ID_NUM_PROBABLE_HITS: {
+        return accessor(
+            d_numProbableHits,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_PROBABLE_HITS]);
+    }
+    case ATTRIBUTE_ID_FALSE_POSITIVE_RATE: {
+        return accessor(
+            d_falsePositiveRate,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FALSE_POSITIVE_RATE]);
+    }
+    default: return NOT_FOUND;
+    }
+}
+
+template <class ACCESSOR>
+int DeduplicationStats::accessAttribute(ACCESSOR&   accessor,
+                                        const char* name,
+                                        int         nameLength) const
+{
+    enum { NOT_FOUND = -1 };
+
+    const bdlat_AttributeInfo* attributeInfo = lookupAttributeInfo(name,
+                                                                   nameLength);
+    if (0 == attributeInfo) {
+        return NOT_FOUND;
+    }
+
+    return accessAttribute(accessor, attributeInfo->d_id);
+}
+
+inline bsls::Types::Int64 DeduplicationStats::capacity() const
+{
+    return d_capacity;
+}
+
+inline bsls::Types::Int64 DeduplicationStats::numLookups() const
+{
+    return d_numLookups;
+}
+
+inline bsls::Types::Int64 DeduplicationStats::numExactHits() const
+{
+    return d_numExactHits;
+}
+
+inline bsls::Types::Int64 DeduplicationStats::numProbableHits() const
+{
+    return d_numProbableHits;
+}
+
+inline double DeduplicationStats::falsePositiveRate() const
+{
+    return d_falsePositiveRate;
+}
+
+template <typename HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM&                   hashAlg,
+                const mqbcmd::DeduplicationStats& object)
+{
+    (void)hashAlg;
+    (void)object;
+    using bslh::hashAppend;
+    hashAppend(hashAlg, object.capacity());
+    hashAppend(hashAlg, object.numLookups());
+    hashAppend(hashAlg, object.numExactHits());
+    hashAppend(hashAlg, object.numProbableHits());
+    hashAppend(hashAlg, object.falsePositiveRate());
+}
+
 // -----------------------
 // class DomainReconfigure
 // -----------------------
@@ -35252,6 +35862,12 @@ int QueueStorage::manipulateAttributes(MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_deduplication,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DEDUPLICATION]);
+    if (ret) {
+        return ret;
+    }
+
     return ret;
 }
 
@@ -35274,6 +35890,11 @@ int QueueStorage::manipulateAttribute(MANIPULATOR& manipulator, int id)
             &d_virtualStorages,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_VIRTUAL_STORAGES]);
     }
+    case ATTRIBUTE_ID_DEDUPLICATION: {
+        return manipulator(
+            &d_deduplication,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DEDUPLICATION]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -35309,6 +35930,11 @@ inline bsl::vector<VirtualStorage>& QueueStorage::virtualStorages()
     return d_virtualStorages;
 }
 
+inline bdlb::NullableValue<DeduplicationStats>& QueueStorage::deduplication()
+{
+    return d_deduplication;
+}
+
 // ACCESSORS
 template <class ACCESSOR>
 int QueueStorage::accessAttributes(ACCESSOR& accessor) const
@@ -35333,6 +35959,12 @@ int QueueStorage::accessAttributes(ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_deduplication,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DEDUPLICATION]);
+    if (ret) {
+        return ret;
+    }
+
     return ret;
 }
 
@@ -35355,6 +35987,11 @@ int QueueStorage::accessAttribute(ACCESSOR& accessor, int id) const
             d_virtualStorages,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_VIRTUAL_STORAGES]);
     }
+    case ATTRIBUTE_ID_DEDUPLICATION: {
+        return accessor(
+            d_deduplication,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DEDUPLICATION]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -35390,6 +36027,12 @@ inline const bsl::vector<VirtualStorage>& QueueStorage::virtualStorages() const
     return d_virtualStorages;
 }
 
+inline const bdlb::NullableValue<DeduplicationStats>&
+QueueStorage::deduplication() const
+{
+    return d_deduplication;
+}
+
 template <typename HASH_ALGORITHM>
 void hashAppend(HASH_ALGORITHM& hashAlg, const mqbcmd::QueueStorage& object)
 {
@@ -35399,6 +36042,7 @@ void hashAppend(HASH_ALGORITHM& hashAlg, const mqbcmd::QueueStorage& object)
     hashAppend(hashAlg, object.numMessages());
     hashAppend(hashAlg, object.numBytes());
     hashAppend(hashAlg, object.virtualStorages());
+    hashAppend(hashAlg, object.deduplication());
 }
 
 // --------------------------
@@ -41106,6 +41750,22 @@ int StatCommand::manipulateSelection(MANIPULATOR& manipulator)
         return manipulator(
             &d_listTunables.object(),
             SELECTION_INFO_ARRAY[SELECTION_INDEX_LIST_TUNABLES]);
+    case StatCommand::SELECTION_ID_SHOW_TRACE:
+        return manipulator(
+            &d_showTrace.object(),
+            SELECTION_INFO_ARRAY[SELECTION_INDEX_SHOW_TRACE]);
+    case StatCommand::SELECTION_ID_EXPORT_TRACE:
+        return manipulator(
+            &d_exportTrace.object(),
+            SELECTION_INFO_ARRAY[SELECTION_INDEX_EXPORT_TRACE]);
+    case StatCommand::SELECTION_ID_SHOW_DISPATCHER:
+        return manipulator(
+            &d_showDispatcher.object(),
+            SELECTION_INFO_ARRAY[SELECTION_INDEX_SHOW_DISPATCHER]);
+    case StatCommand::SELECTION_ID_RESET_DISPATCHER:
+        return manipulator(
+            &d_resetDispatcher.object(),
+            SELECTION_INFO_ARRAY[SELECTION_INDEX_RESET_DISPATCHER]);
     default:
         BSLS_ASSERT(StatCommand::SELECTION_ID_UNDEFINED == d_selectionId);
         return -1;
@@ -41136,6 +41796,30 @@ inline Void& StatCommand::listTunables()
     return d_listTunables.object();
 }
 
+inline Void& StatCommand::showTrace()
+{
+    BSLS_ASSERT(SELECTION_ID_SHOW_TRACE == d_selectionId);
+    return d_showTrace.object();
+}
+
+inline Void& StatCommand::exportTrace()
+{
+    BSLS_ASSERT(SELECTION_ID_EXPORT_TRACE == d_selectionId);
+    return d_exportTrace.object();
+}
+
+inline Void& StatCommand::showDispatcher()
+{
+    BSLS_ASSERT(SELECTION_ID_SHOW_DISPATCHER == d_selectionId);
+    return d_showDispatcher.object();
+}
+
+inline Void& StatCommand::resetDispatcher()
+{
+    BSLS_ASSERT(SELECTION_ID_RESET_DISPATCHER == d_selectionId);
+    return d_resetDispatcher.object();
+}
+
 // ACCESSORS
 inline int StatCommand::selectionId() const
 {
@@ -41158,6 +41842,19 @@ int StatCommand::accessSelection(ACCESSOR& accessor) const
     case SELECTION_ID_LIST_TUNABLES:
         return accessor(d_listTunables.object(),
                         SELECTION_INFO_ARRAY[SELECTION_INDEX_LIST_TUNABLES]);
+    case SELECTION_ID_SHOW_TRACE:
+        return accessor(d_showTrace.object(),
+                        SELECTION_INFO_ARRAY[SELECTION_INDEX_SHOW_TRACE]);
+    case SELECTION_ID_EXPORT_TRACE:
+        return accessor(d_exportTrace.object(),
+                        SELECTION_INFO_ARRAY[SELECTION_INDEX_EXPORT_TRACE]);
+    case SELECTION_ID_SHOW_DISPATCHER:
+        return accessor(d_showDispatcher.object(),
+                        SELECTION_INFO_ARRAY[SELECTION_INDEX_SHOW_DISPATCHER]);
+    case SELECTION_ID_RESET_DISPATCHER:
+        return accessor(
+            d_resetDispatcher.object(),
+            SELECTION_INFO_ARRAY[SELECTION_INDEX_RESET_DISPATCHER]);
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId); return -1;
     }
 }
@@ -41186,6 +41883,30 @@ inline const Void& StatCommand::listTunables() const
     return d_listTunables.object();
 }
 
+inline const Void& StatCommand::showTrace() const
+{
+    BSLS_ASSERT(SELECTION_ID_SHOW_TRACE == d_selectionId);
+    return d_showTrace.object();
+}
+
+inline const Void& StatCommand::exportTrace() const
+{
+    BSLS_ASSERT(SELECTION_ID_EXPORT_TRACE == d_selectionId);
+    return d_exportTrace.object();
+}
+
+inline const Void& StatCommand::showDispatcher() const
+{
+    BSLS_ASSERT(SELECTION_ID_SHOW_DISPATCHER == d_selectionId);
+    return d_showDispatcher.object();
+}
+
+inline const Void& StatCommand::resetDispatcher() const
+{
+    BSLS_ASSERT(SELECTION_ID_RESET_DISPATCHER == d_selectionId);
+    return d_resetDispatcher.object();
+}
+
 inline bool StatCommand::isShowValue() const
 {
     return SELECTION_ID_SHOW == d_selectionId;
@@ -41206,6 +41927,26 @@ inline bool StatCommand::isListTunablesValue() const
     return SELECTION_ID_LIST_TUNABLES == d_selectionId;
 }
 
+inline bool StatCommand::isShowTraceValue() const
+{
+    return SELECTION_ID_SHOW_TRACE == d_selectionId;
+}
+
+inline bool StatCommand::isExportTraceValue() const
+{
+    return SELECTION_ID_EXPORT_TRACE == d_selectionId;
+}
+
+inline bool StatCommand::isShowDispatcherValue() const
+{
+    return SELECTION_ID_SHOW_DISPATCHER == d_selectionId;
+}
+
+inline bool StatCommand::isResetDispatcherValue() const
+{
+    return SELECTION_ID_RESET_DISPATCHER == d_selectionId;
+}
+
 inline bool StatCommand::isUndefinedValue() const
 {
     return SELECTION_ID_UNDEFINED == d_selectionId;
@@ -41228,6 +41969,18 @@ void hashAppend(HASH_ALGORITHM& hashAlg, const mqbcmd::StatCommand& object)
     case Class::SELECTION_ID_LIST_TUNABLES:
         hashAppend(hashAlg, object.listTunables());
         break;
+    case Class::SELECTION_ID_SHOW_TRACE:
+        hashAppend(hashAlg, object.showTrace());
+        break;
+    case Class::SELECTION_ID_EXPORT_TRACE:
+        hashAppend(hashAlg, object.exportTrace());
+        break;
+    case Class::SELECTION_ID_SHOW_DISPATCHER:
+        hashAppend(hashAlg, object.showDispatcher());
+        break;
+    case Class::SELECTION_ID_RESET_DISPATCHER:
+        hashAppend(hashAlg, object.resetDispatcher());
+        break;
     default:
         BSLS_ASSERT(Class::SELECTION_ID_UNDEFINED == object.selectionId());
     }
@@ -48620,6 +49373,28 @@ inline bsl::ostream& mqbcmd::operator<<(bsl::ostream&          stream,
     return rhs.print(stream, 0, -1);
 }
 
+inline bool mqbcmd::operator==(const mqbcmd::DeduplicationStats& lhs,
+                               const mqbcmd::DeduplicationStats& rhs)
+{
+    return lhs.capacity() == rhs.capacity() &&
+           lhs.numLookups() == rhs.numLookups() &&
+           lhs.numExactHits() == rhs.numExactHits() &&
+           lhs.numProbableHits() == rhs.numProbableHits() &&
+           lhs.falsePositiveRate() == rhs.falsePositiveRate();
+}
+
+inline bool mqbcmd::operator!=(const mqbcmd::DeduplicationStats& lhs,
+                               const mqbcmd::DeduplicationStats& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline bsl::ostream&
+mqbcmd::operator<<(bsl::ostream& stream, const mqbcmd::DeduplicationStats& rhs)
+{
+    return rhs.print(stream, 0, -1);
+}
+
 inline bool mqbcmd::operator==(const mqbcmd::DomainReconfigure& lhs,
                                const mqbcmd::DomainReconfigure& rhs)
 {
@@ -49367,7 +50142,8 @@ inline bool mqbcmd::operator==(const mqbcmd::QueueStorage& lhs,
 {
     return lhs.numMessages() == rhs.numMessages() &&
            lhs.numBytes() == rhs.numBytes() &&
-           lhs.virtualStorages() == rhs.virtualStorages();
+           lhs.virtualStorages() == rhs.virtualStorages() &&
+           lhs.deduplication() == rhs.deduplication();
 }
 
 inline bool mqbcmd::operator!=(const mqbcmd::QueueStorage& lhs,
@@ -50153,6 +50929,14 @@ inline bool mqbcmd::operator==(const mqbcmd::StatCommand& lhs,
             return lhs.getTunable() == rhs.getTunable();
         case Class::SELECTION_ID_LIST_TUNABLES:
             return lhs.listTunables() == rhs.listTunables();
+        case Class::SELECTION_ID_SHOW_TRACE:
+            return lhs.showTrace() == rhs.showTrace();
+        case Class::SELECTION_ID_EXPORT_TRACE:
+            return lhs.exportTrace() == rhs.exportTrace();
+        case Class::SELECTION_ID_SHOW_DISPATCHER:
+            return lhs.showDispatcher() == rhs.showDispatcher();
+        case Class::SELECTION_ID_RESET_DISPATCHER:
+            return lhs.resetDispatcher() == rhs.resetDispatcher();
         default:
             BSLS_ASSERT(Class::SELECTION_ID_UNDEFINED == rhs.selectionId());
             return true;
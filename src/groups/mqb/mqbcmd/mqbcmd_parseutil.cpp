@@ -607,6 +607,37 @@ int parseStat(StatCommand* stats, bsl::string* error, WordGenerator next)
         stats->makeListTunables();
         return expectEnd(error, next);  // RETURN
     }
+    else if (equalCaseless(subcommand, "TRACE")) {
+        const bslstl::StringRef action = next();
+
+        if (equalCaseless(action, "SHOW")) {
+            stats->makeShowTrace();
+            return expectEnd(error, next);  // RETURN
+        }
+        else if (equalCaseless(action, "EXPORT")) {
+            stats->makeExportTrace();
+            return expectEnd(error, next);  // RETURN
+        }
+
+        *error = "The command STAT TRACE must be followed by either SHOW or "
+                 "EXPORT.";
+        return -1;  // RETURN
+    }
+    else if (equalCaseless(subcommand, "DISPATCHER")) {
+        const bslstl::StringRef action = next();
+
+        if (action.empty()) {
+            stats->makeShowDispatcher();
+            return 0;  // RETURN
+        }
+        else if (equalCaseless(action, "RESET")) {
+            stats->makeResetDispatcher();
+            return expectEnd(error, next);  // RETURN
+        }
+
+        *error = "Unexpected STAT DISPATCHER action: " + action;
+        return -1;  // RETURN
+    }
 
     *error = "Unexpected STAT subcommand: " + subcommand;
     return -1;
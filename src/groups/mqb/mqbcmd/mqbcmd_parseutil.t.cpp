@@ -207,6 +207,24 @@ const Test k_TESTS[] = {
      "CONFIGPROVIDER CACHE_CLEAR",
      0},
     {__LINE__, "show statistics", "STAT SHOW", "{\"stat\": {\"show\": {}}}"},
+    {__LINE__,
+     "show the breakdown of traced messages",
+     "STAT TRACE SHOW",
+     "{\"stat\": {\"showTrace\": {}}}"},
+    {__LINE__,
+     "export traced messages",
+     "STAT TRACE EXPORT",
+     "{\"stat\": {\"exportTrace\": {}}}"},
+    {__LINE__, "trace command requires an action", "STAT TRACE", 0},
+    {__LINE__,
+     "show the dispatcher profile",
+     "STAT DISPATCHER",
+     "{\"stat\": {\"showDispatcher\": {}}}"},
+    {__LINE__,
+     "reset the dispatcher profile",
+     "STAT DISPATCHER RESET",
+     "{\"stat\": {\"resetDispatcher\": {}}}"},
+    {__LINE__, "unknown dispatcher action", "STAT DISPATCHER SHOW", 0},
     {__LINE__,
      "list all active clusters",
      "CLUSTERS LIST",
@@ -859,6 +859,8 @@ const int MsgGroupIdConfig::DEFAULT_INITIALIZER_MAX_GROUPS = 2147483647;
 
 const bsls::Types::Int64 MsgGroupIdConfig::DEFAULT_INITIALIZER_TTL_SECONDS = 0;
 
+const bool MsgGroupIdConfig::DEFAULT_INITIALIZER_CONSISTENT_HASHING = false;
+
 const bdlat_AttributeInfo MsgGroupIdConfig::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_REBALANCE,
      "rebalance",
@@ -874,14 +876,19 @@ const bdlat_AttributeInfo MsgGroupIdConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "ttlSeconds",
      sizeof("ttlSeconds") - 1,
      "",
-     bdlat_FormattingMode::e_DEC}};
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_CONSISTENT_HASHING,
+     "consistentHashing",
+     sizeof("consistentHashing") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo*
 MsgGroupIdConfig::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 3; ++i) {
+    for (int i = 0; i < 4; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             MsgGroupIdConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -903,6 +910,8 @@ const bdlat_AttributeInfo* MsgGroupIdConfig::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_GROUPS];
     case ATTRIBUTE_ID_TTL_SECONDS:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_TTL_SECONDS];
+    case ATTRIBUTE_ID_CONSISTENT_HASHING:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONSISTENT_HASHING];
     default: return 0;
     }
 }
@@ -913,6 +922,7 @@ MsgGroupIdConfig::MsgGroupIdConfig()
 : d_ttlSeconds(DEFAULT_INITIALIZER_TTL_SECONDS)
 , d_maxGroups(DEFAULT_INITIALIZER_MAX_GROUPS)
 , d_rebalance(DEFAULT_INITIALIZER_REBALANCE)
+, d_consistentHashing(DEFAULT_INITIALIZER_CONSISTENT_HASHING)
 {
 }
 
@@ -920,6 +930,7 @@ MsgGroupIdConfig::MsgGroupIdConfig(const MsgGroupIdConfig& original)
 : d_ttlSeconds(original.d_ttlSeconds)
 , d_maxGroups(original.d_maxGroups)
 , d_rebalance(original.d_rebalance)
+, d_consistentHashing(original.d_consistentHashing)
 {
 }
 
@@ -932,9 +943,10 @@ MsgGroupIdConfig::~MsgGroupIdConfig()
 MsgGroupIdConfig& MsgGroupIdConfig::operator=(const MsgGroupIdConfig& rhs)
 {
     if (this != &rhs) {
-        d_rebalance  = rhs.d_rebalance;
-        d_maxGroups  = rhs.d_maxGroups;
-        d_ttlSeconds = rhs.d_ttlSeconds;
+        d_rebalance         = rhs.d_rebalance;
+        d_maxGroups         = rhs.d_maxGroups;
+        d_ttlSeconds        = rhs.d_ttlSeconds;
+        d_consistentHashing = rhs.d_consistentHashing;
     }
 
     return *this;
@@ -945,9 +957,10 @@ MsgGroupIdConfig& MsgGroupIdConfig::operator=(const MsgGroupIdConfig& rhs)
 MsgGroupIdConfig& MsgGroupIdConfig::operator=(MsgGroupIdConfig&& rhs)
 {
     if (this != &rhs) {
-        d_rebalance  = bsl::move(rhs.d_rebalance);
-        d_maxGroups  = bsl::move(rhs.d_maxGroups);
-        d_ttlSeconds = bsl::move(rhs.d_ttlSeconds);
+        d_rebalance         = bsl::move(rhs.d_rebalance);
+        d_maxGroups         = bsl::move(rhs.d_maxGroups);
+        d_ttlSeconds        = bsl::move(rhs.d_ttlSeconds);
+        d_consistentHashing = bsl::move(rhs.d_consistentHashing);
     }
 
     return *this;
@@ -956,9 +969,10 @@ MsgGroupIdConfig& MsgGroupIdConfig::operator=(MsgGroupIdConfig&& rhs)
 
 void MsgGroupIdConfig::reset()
 {
-    d_rebalance  = DEFAULT_INITIALIZER_REBALANCE;
-    d_maxGroups  = DEFAULT_INITIALIZER_MAX_GROUPS;
-    d_ttlSeconds = DEFAULT_INITIALIZER_TTL_SECONDS;
+    d_rebalance         = DEFAULT_INITIALIZER_REBALANCE;
+    d_maxGroups         = DEFAULT_INITIALIZER_MAX_GROUPS;
+    d_ttlSeconds        = DEFAULT_INITIALIZER_TTL_SECONDS;
+    d_consistentHashing = DEFAULT_INITIALIZER_CONSISTENT_HASHING;
 }
 
 // ACCESSORS
@@ -972,6 +986,7 @@ bsl::ostream& MsgGroupIdConfig::print(bsl::ostream& stream,
     printer.printAttribute("rebalance", this->rebalance());
     printer.printAttribute("maxGroups", this->maxGroups());
     printer.printAttribute("ttlSeconds", this->ttlSeconds());
+    printer.printAttribute("consistentHashing", this->consistentHashing());
     printer.end();
     return stream;
 }
@@ -3195,6 +3210,16 @@ const int Domain::DEFAULT_INITIALIZER_MAX_DELIVERY_ATTEMPTS = 0;
 
 const int Domain::DEFAULT_INITIALIZER_DEDUPLICATION_TIME_MS = 300000;
 
+const int Domain::DEFAULT_INITIALIZER_DEDUPLICATION_CAPACITY = 0;
+
+const int Domain::DEFAULT_INITIALIZER_DEDUPLICATION_FINGERPRINT_BITS = 32;
+
+const char Domain::DEFAULT_INITIALIZER_PRIORITY_PROPERTY[] = "";
+
+const char Domain::DEFAULT_INITIALIZER_DELIVERY_TIME_PROPERTY[] = "";
+
+const bool Domain::DEFAULT_INITIALIZER_DEDUPLICATION_REJECT_PROBABLE = false;
+
 const bdlat_AttributeInfo Domain::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_NAME,
      "name",
@@ -3255,14 +3280,39 @@ const bdlat_AttributeInfo Domain::ATTRIBUTE_INFO_ARRAY[] = {
      "consistency",
      sizeof("consistency") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_DEDUPLICATION_CAPACITY,
+     "deduplicationCapacity",
+     sizeof("deduplicationCapacity") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_DEDUPLICATION_FINGERPRINT_BITS,
+     "deduplicationFingerprintBits",
+     sizeof("deduplicationFingerprintBits") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_PRIORITY_PROPERTY,
+     "priorityProperty",
+     sizeof("priorityProperty") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT},
+    {ATTRIBUTE_ID_DELIVERY_TIME_PROPERTY,
+     "deliveryTimeProperty",
+     sizeof("deliveryTimeProperty") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT},
+    {ATTRIBUTE_ID_DEDUPLICATION_REJECT_PROBABLE,
+     "deduplicationRejectProbable",
+     sizeof("deduplicationRejectProbable") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo* Domain::lookupAttributeInfo(const char* name,
                                                        int         nameLength)
 {
-    for (int i = 0; i < 12; ++i) {
+    for (int i = 0; i < 17; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             Domain::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -3300,6 +3350,18 @@ const bdlat_AttributeInfo* Domain::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS];
     case ATTRIBUTE_ID_CONSISTENCY:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONSISTENCY];
+    case ATTRIBUTE_ID_DEDUPLICATION_CAPACITY:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DEDUPLICATION_CAPACITY];
+    case ATTRIBUTE_ID_DEDUPLICATION_FINGERPRINT_BITS:
+        return &ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_DEDUPLICATION_FINGERPRINT_BITS];
+    case ATTRIBUTE_ID_PRIORITY_PROPERTY:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRIORITY_PROPERTY];
+    case ATTRIBUTE_ID_DELIVERY_TIME_PROPERTY:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DELIVERY_TIME_PROPERTY];
+    case ATTRIBUTE_ID_DEDUPLICATION_REJECT_PROBABLE:
+        return &ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_DEDUPLICATION_REJECT_PROBABLE];
     default: return 0;
     }
 }
@@ -3309,6 +3371,9 @@ const bdlat_AttributeInfo* Domain::lookupAttributeInfo(int id)
 Domain::Domain(bslma::Allocator* basicAllocator)
 : d_messageTtl()
 , d_name(basicAllocator)
+, d_priorityProperty(DEFAULT_INITIALIZER_PRIORITY_PROPERTY, basicAllocator)
+, d_deliveryTimeProperty(DEFAULT_INITIALIZER_DELIVERY_TIME_PROPERTY,
+                         basicAllocator)
 , d_msgGroupIdConfig()
 , d_storage()
 , d_mode(basicAllocator)
@@ -3319,12 +3384,19 @@ Domain::Domain(bslma::Allocator* basicAllocator)
 , d_maxIdleTime(DEFAULT_INITIALIZER_MAX_IDLE_TIME)
 , d_maxDeliveryAttempts(DEFAULT_INITIALIZER_MAX_DELIVERY_ATTEMPTS)
 , d_deduplicationTimeMs(DEFAULT_INITIALIZER_DEDUPLICATION_TIME_MS)
+, d_deduplicationCapacity(DEFAULT_INITIALIZER_DEDUPLICATION_CAPACITY)
+, d_deduplicationFingerprintBits(
+      DEFAULT_INITIALIZER_DEDUPLICATION_FINGERPRINT_BITS)
+, d_deduplicationRejectProbable(
+      DEFAULT_INITIALIZER_DEDUPLICATION_REJECT_PROBABLE)
 {
 }
 
 Domain::Domain(const Domain& original, bslma::Allocator* basicAllocator)
 : d_messageTtl(original.d_messageTtl)
 , d_name(original.d_name, basicAllocator)
+, d_priorityProperty(original.d_priorityProperty, basicAllocator)
+, d_deliveryTimeProperty(original.d_deliveryTimeProperty, basicAllocator)
 , d_msgGroupIdConfig(original.d_msgGroupIdConfig)
 , d_storage(original.d_storage)
 , d_mode(original.d_mode, basicAllocator)
@@ -3335,6 +3407,9 @@ Domain::Domain(const Domain& original, bslma::Allocator* basicAllocator)
 , d_maxIdleTime(original.d_maxIdleTime)
 , d_maxDeliveryAttempts(original.d_maxDeliveryAttempts)
 , d_deduplicationTimeMs(original.d_deduplicationTimeMs)
+, d_deduplicationCapacity(original.d_deduplicationCapacity)
+, d_deduplicationFingerprintBits(original.d_deduplicationFingerprintBits)
+, d_deduplicationRejectProbable(original.d_deduplicationRejectProbable)
 {
 }
 
@@ -3343,6 +3418,8 @@ Domain::Domain(const Domain& original, bslma::Allocator* basicAllocator)
 Domain::Domain(Domain&& original) noexcept
 : d_messageTtl(bsl::move(original.d_messageTtl)),
   d_name(bsl::move(original.d_name)),
+  d_priorityProperty(bsl::move(original.d_priorityProperty)),
+  d_deliveryTimeProperty(bsl::move(original.d_deliveryTimeProperty)),
   d_msgGroupIdConfig(bsl::move(original.d_msgGroupIdConfig)),
   d_storage(bsl::move(original.d_storage)),
   d_mode(bsl::move(original.d_mode)),
@@ -3352,13 +3429,21 @@ Domain::Domain(Domain&& original) noexcept
   d_maxQueues(bsl::move(original.d_maxQueues)),
   d_maxIdleTime(bsl::move(original.d_maxIdleTime)),
   d_maxDeliveryAttempts(bsl::move(original.d_maxDeliveryAttempts)),
-  d_deduplicationTimeMs(bsl::move(original.d_deduplicationTimeMs))
+  d_deduplicationTimeMs(bsl::move(original.d_deduplicationTimeMs)),
+  d_deduplicationCapacity(bsl::move(original.d_deduplicationCapacity)),
+  d_deduplicationFingerprintBits(
+      bsl::move(original.d_deduplicationFingerprintBits)),
+  d_deduplicationRejectProbable(
+      bsl::move(original.d_deduplicationRejectProbable))
 {
 }
 
 Domain::Domain(Domain&& original, bslma::Allocator* basicAllocator)
 : d_messageTtl(bsl::move(original.d_messageTtl))
 , d_name(bsl::move(original.d_name), basicAllocator)
+, d_priorityProperty(bsl::move(original.d_priorityProperty), basicAllocator)
+, d_deliveryTimeProperty(bsl::move(original.d_deliveryTimeProperty),
+                         basicAllocator)
 , d_msgGroupIdConfig(bsl::move(original.d_msgGroupIdConfig))
 , d_storage(bsl::move(original.d_storage))
 , d_mode(bsl::move(original.d_mode), basicAllocator)
@@ -3369,6 +3454,11 @@ Domain::Domain(Domain&& original, bslma::Allocator* basicAllocator)
 , d_maxIdleTime(bsl::move(original.d_maxIdleTime))
 , d_maxDeliveryAttempts(bsl::move(original.d_maxDeliveryAttempts))
 , d_deduplicationTimeMs(bsl::move(original.d_deduplicationTimeMs))
+, d_deduplicationCapacity(bsl::move(original.d_deduplicationCapacity))
+, d_deduplicationFingerprintBits(
+      bsl::move(original.d_deduplicationFingerprintBits))
+, d_deduplicationRejectProbable(
+      bsl::move(original.d_deduplicationRejectProbable))
 {
 }
 #endif
@@ -3382,18 +3472,23 @@ Domain::~Domain()
 Domain& Domain::operator=(const Domain& rhs)
 {
     if (this != &rhs) {
-        d_name                = rhs.d_name;
-        d_mode                = rhs.d_mode;
-        d_storage             = rhs.d_storage;
-        d_maxConsumers        = rhs.d_maxConsumers;
-        d_maxProducers        = rhs.d_maxProducers;
-        d_maxQueues           = rhs.d_maxQueues;
-        d_msgGroupIdConfig    = rhs.d_msgGroupIdConfig;
-        d_maxIdleTime         = rhs.d_maxIdleTime;
-        d_messageTtl          = rhs.d_messageTtl;
-        d_maxDeliveryAttempts = rhs.d_maxDeliveryAttempts;
-        d_deduplicationTimeMs = rhs.d_deduplicationTimeMs;
-        d_consistency         = rhs.d_consistency;
+        d_name                         = rhs.d_name;
+        d_mode                         = rhs.d_mode;
+        d_storage                      = rhs.d_storage;
+        d_maxConsumers                 = rhs.d_maxConsumers;
+        d_maxProducers                 = rhs.d_maxProducers;
+        d_maxQueues                    = rhs.d_maxQueues;
+        d_msgGroupIdConfig             = rhs.d_msgGroupIdConfig;
+        d_maxIdleTime                  = rhs.d_maxIdleTime;
+        d_messageTtl                   = rhs.d_messageTtl;
+        d_maxDeliveryAttempts          = rhs.d_maxDeliveryAttempts;
+        d_deduplicationTimeMs          = rhs.d_deduplicationTimeMs;
+        d_consistency                  = rhs.d_consistency;
+        d_deduplicationCapacity        = rhs.d_deduplicationCapacity;
+        d_deduplicationFingerprintBits = rhs.d_deduplicationFingerprintBits;
+        d_priorityProperty             = rhs.d_priorityProperty;
+        d_deliveryTimeProperty         = rhs.d_deliveryTimeProperty;
+        d_deduplicationRejectProbable  = rhs.d_deduplicationRejectProbable;
     }
 
     return *this;
@@ -3416,6 +3511,13 @@ Domain& Domain::operator=(Domain&& rhs)
         d_maxDeliveryAttempts = bsl::move(rhs.d_maxDeliveryAttempts);
         d_deduplicationTimeMs = bsl::move(rhs.d_deduplicationTimeMs);
         d_consistency         = bsl::move(rhs.d_consistency);
+        d_deduplicationCapacity = bsl::move(rhs.d_deduplicationCapacity);
+        d_deduplicationFingerprintBits = bsl::move(
+            rhs.d_deduplicationFingerprintBits);
+        d_priorityProperty     = bsl::move(rhs.d_priorityProperty);
+        d_deliveryTimeProperty = bsl::move(rhs.d_deliveryTimeProperty);
+        d_deduplicationRejectProbable = bsl::move(
+            rhs.d_deduplicationRejectProbable);
     }
 
     return *this;
@@ -3436,6 +3538,13 @@ void Domain::reset()
     d_maxDeliveryAttempts = DEFAULT_INITIALIZER_MAX_DELIVERY_ATTEMPTS;
     d_deduplicationTimeMs = DEFAULT_INITIALIZER_DEDUPLICATION_TIME_MS;
     bdlat_ValueTypeFunctions::reset(&d_consistency);
+    d_deduplicationCapacity = DEFAULT_INITIALIZER_DEDUPLICATION_CAPACITY;
+    d_deduplicationFingerprintBits =
+        DEFAULT_INITIALIZER_DEDUPLICATION_FINGERPRINT_BITS;
+    d_priorityProperty     = DEFAULT_INITIALIZER_PRIORITY_PROPERTY;
+    d_deliveryTimeProperty = DEFAULT_INITIALIZER_DELIVERY_TIME_PROPERTY;
+    d_deduplicationRejectProbable =
+        DEFAULT_INITIALIZER_DEDUPLICATION_REJECT_PROBABLE;
 }
 
 // ACCESSORS
@@ -3457,6 +3566,15 @@ Domain::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     printer.printAttribute("maxDeliveryAttempts", this->maxDeliveryAttempts());
     printer.printAttribute("deduplicationTimeMs", this->deduplicationTimeMs());
     printer.printAttribute("consistency", this->consistency());
+    printer.printAttribute("deduplicationCapacity",
+                           this->deduplicationCapacity());
+    printer.printAttribute("deduplicationFingerprintBits",
+                           this->deduplicationFingerprintBits());
+    printer.printAttribute("priorityProperty", this->priorityProperty());
+    printer.printAttribute("deliveryTimeProperty",
+                           this->deliveryTimeProperty());
+    printer.printAttribute("deduplicationRejectProbable",
+                           this->deduplicationRejectProbable());
     printer.end();
     return stream;
 }
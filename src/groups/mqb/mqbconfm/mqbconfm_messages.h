@@ -1553,26 +1553,33 @@ class MsgGroupIdConfig {
     // collection" parameter ttlSeconds.: minimum time of inactivity (no
     // messages for a Group Id), in seconds, before a group becomes available
     // for "garbage collection".  0 (the default) means unlimited
+    // consistentHashing: groups are assigned to consumers using a consistent
+    // hash ring with bounded loads, so that adding or removing a consumer
+    // only moves a fraction of the groups.  Takes precedence over
+    // 'rebalance'
 
     // INSTANCE DATA
     bsls::Types::Int64 d_ttlSeconds;
     int                d_maxGroups;
     bool               d_rebalance;
+    bool               d_consistentHashing;
 
   public:
     // TYPES
     enum {
-        ATTRIBUTE_ID_REBALANCE   = 0,
-        ATTRIBUTE_ID_MAX_GROUPS  = 1,
-        ATTRIBUTE_ID_TTL_SECONDS = 2
+        ATTRIBUTE_ID_REBALANCE          = 0,
+        ATTRIBUTE_ID_MAX_GROUPS         = 1,
+        ATTRIBUTE_ID_TTL_SECONDS        = 2,
+        ATTRIBUTE_ID_CONSISTENT_HASHING = 3
     };
 
-    enum { NUM_ATTRIBUTES = 3 };
+    enum { NUM_ATTRIBUTES = 4 };
 
     enum {
-        ATTRIBUTE_INDEX_REBALANCE   = 0,
-        ATTRIBUTE_INDEX_MAX_GROUPS  = 1,
-        ATTRIBUTE_INDEX_TTL_SECONDS = 2
+        ATTRIBUTE_INDEX_REBALANCE          = 0,
+        ATTRIBUTE_INDEX_MAX_GROUPS         = 1,
+        ATTRIBUTE_INDEX_TTL_SECONDS        = 2,
+        ATTRIBUTE_INDEX_CONSISTENT_HASHING = 3
     };
 
     // CONSTANTS
@@ -1584,6 +1591,8 @@ class MsgGroupIdConfig {
 
     static const bsls::Types::Int64 DEFAULT_INITIALIZER_TTL_SECONDS;
 
+    static const bool DEFAULT_INITIALIZER_CONSISTENT_HASHING;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -1675,6 +1684,10 @@ class MsgGroupIdConfig {
     // Return a reference to the modifiable "TtlSeconds" attribute of this
     // object.
 
+    bool& consistentHashing();
+    // Return a reference to the modifiable "ConsistentHashing" attribute of
+    // this object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -1726,6 +1739,9 @@ class MsgGroupIdConfig {
 
     bsls::Types::Int64 ttlSeconds() const;
     // Return the value of the "TtlSeconds" attribute of this object.
+
+    bool consistentHashing() const;
+    // Return the value of the "ConsistentHashing" attribute of this object.
 };
 
 // FREE OPERATORS
@@ -4199,11 +4215,35 @@ class Domain {
     // queue.  Zero (the default) means unlimited deduplicationTimeMs.:
     // timeout, in milliseconds, to keep GUID of PUT message for the purpose of
     // detecting duplicate PUTs.  consistency.........: optional consistency
-    // mode.
+    // mode.  deduplicationCapacity.: number of PUT GUIDs remembered by the
+    // bounded memory deduplication index of each queue, replacing the
+    // time-based history when non-zero.  Zero (the default) means the
+    // time-based history is used deduplicationFingerprintBits.: size, in
+    // bits (8 to 32), of the fingerprints stored in the deduplication
+    // index.  Larger fingerprints lower the false positive rate at the cost
+    // of memory priorityProperty....: name of the integer message property
+    // holding the priority of each message.  When set, messages are
+    // delivered by decreasing priority (0 to 9), and in arrival order within
+    // a priority.  Empty (the default) means messages are delivered in
+    // arrival order deliveryTimeProperty: name of the integer message
+    // property holding the delivery time of each message: an INT64 property
+    // is the time, in milliseconds since epoch, at which the message can be
+    // delivered, and an INT32 property is the delay, in milliseconds, after
+    // which it can be delivered.  Only applies to persistent storage, and is
+    // ignored (and an alarm raised) for in-memory storage.  A message to be
+    // delivered more than 1966020 seconds (about 22 days) after its arrival
+    // is rejected.  Empty (the default) means messages are delivered as soon
+    // as they arrive
+    // deduplicationRejectProbable: whether a PUT whose GUID is only probably
+    // in the deduplication index (possibly a false positive) is rejected as
+    // a duplicate.  False (the default) means such a PUT is accepted, and
+    // counted in the probable hits of the index
 
     // INSTANCE DATA
     bsls::Types::Int64                    d_messageTtl;
     bsl::string                           d_name;
+    bsl::string                           d_priorityProperty;
+    bsl::string                           d_deliveryTimeProperty;
     bdlb::NullableValue<MsgGroupIdConfig> d_msgGroupIdConfig;
     StorageDefinition                     d_storage;
     QueueMode                             d_mode;
@@ -4214,39 +4254,52 @@ class Domain {
     int                                   d_maxIdleTime;
     int                                   d_maxDeliveryAttempts;
     int                                   d_deduplicationTimeMs;
+    int                                   d_deduplicationCapacity;
+    int                                   d_deduplicationFingerprintBits;
+    bool                                  d_deduplicationRejectProbable;
 
   public:
     // TYPES
     enum {
-        ATTRIBUTE_ID_NAME                  = 0,
-        ATTRIBUTE_ID_MODE                  = 1,
-        ATTRIBUTE_ID_STORAGE               = 2,
-        ATTRIBUTE_ID_MAX_CONSUMERS         = 3,
-        ATTRIBUTE_ID_MAX_PRODUCERS         = 4,
-        ATTRIBUTE_ID_MAX_QUEUES            = 5,
-        ATTRIBUTE_ID_MSG_GROUP_ID_CONFIG   = 6,
-        ATTRIBUTE_ID_MAX_IDLE_TIME         = 7,
-        ATTRIBUTE_ID_MESSAGE_TTL           = 8,
-        ATTRIBUTE_ID_MAX_DELIVERY_ATTEMPTS = 9,
-        ATTRIBUTE_ID_DEDUPLICATION_TIME_MS = 10,
-        ATTRIBUTE_ID_CONSISTENCY           = 11
+        ATTRIBUTE_ID_NAME                           = 0,
+        ATTRIBUTE_ID_MODE                           = 1,
+        ATTRIBUTE_ID_STORAGE                        = 2,
+        ATTRIBUTE_ID_MAX_CONSUMERS                  = 3,
+        ATTRIBUTE_ID_MAX_PRODUCERS                  = 4,
+        ATTRIBUTE_ID_MAX_QUEUES                     = 5,
+        ATTRIBUTE_ID_MSG_GROUP_ID_CONFIG            = 6,
+        ATTRIBUTE_ID_MAX_IDLE_TIME                  = 7,
+        ATTRIBUTE_ID_MESSAGE_TTL                    = 8,
+        ATTRIBUTE_ID_MAX_DELIVERY_ATTEMPTS          = 9,
+        ATTRIBUTE_ID_DEDUPLICATION_TIME_MS          = 10,
+        ATTRIBUTE_ID_CONSISTENCY                    = 11,
+        ATTRIBUTE_ID_DEDUPLICATION_CAPACITY         = 12,
+        ATTRIBUTE_ID_DEDUPLICATION_FINGERPRINT_BITS = 13,
+        ATTRIBUTE_ID_PRIORITY_PROPERTY              = 14,
+        ATTRIBUTE_ID_DELIVERY_TIME_PROPERTY         = 15,
+        ATTRIBUTE_ID_DEDUPLICATION_REJECT_PROBABLE  = 16
     };
 
-    enum { NUM_ATTRIBUTES = 12 };
+    enum { NUM_ATTRIBUTES = 17 };
 
     enum {
-        ATTRIBUTE_INDEX_NAME                  = 0,
-        ATTRIBUTE_INDEX_MODE                  = 1,
-        ATTRIBUTE_INDEX_STORAGE               = 2,
-        ATTRIBUTE_INDEX_MAX_CONSUMERS         = 3,
-        ATTRIBUTE_INDEX_MAX_PRODUCERS         = 4,
-        ATTRIBUTE_INDEX_MAX_QUEUES            = 5,
-        ATTRIBUTE_INDEX_MSG_GROUP_ID_CONFIG   = 6,
-        ATTRIBUTE_INDEX_MAX_IDLE_TIME         = 7,
-        ATTRIBUTE_INDEX_MESSAGE_TTL           = 8,
-        ATTRIBUTE_INDEX_MAX_DELIVERY_ATTEMPTS = 9,
-        ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS = 10,
-        ATTRIBUTE_INDEX_CONSISTENCY           = 11
+        ATTRIBUTE_INDEX_NAME                           = 0,
+        ATTRIBUTE_INDEX_MODE                           = 1,
+        ATTRIBUTE_INDEX_STORAGE                        = 2,
+        ATTRIBUTE_INDEX_MAX_CONSUMERS                  = 3,
+        ATTRIBUTE_INDEX_MAX_PRODUCERS                  = 4,
+        ATTRIBUTE_INDEX_MAX_QUEUES                     = 5,
+        ATTRIBUTE_INDEX_MSG_GROUP_ID_CONFIG            = 6,
+        ATTRIBUTE_INDEX_MAX_IDLE_TIME                  = 7,
+        ATTRIBUTE_INDEX_MESSAGE_TTL                    = 8,
+        ATTRIBUTE_INDEX_MAX_DELIVERY_ATTEMPTS          = 9,
+        ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS          = 10,
+        ATTRIBUTE_INDEX_CONSISTENCY                    = 11,
+        ATTRIBUTE_INDEX_DEDUPLICATION_CAPACITY         = 12,
+        ATTRIBUTE_INDEX_DEDUPLICATION_FINGERPRINT_BITS = 13,
+        ATTRIBUTE_INDEX_PRIORITY_PROPERTY              = 14,
+        ATTRIBUTE_INDEX_DELIVERY_TIME_PROPERTY         = 15,
+        ATTRIBUTE_INDEX_DEDUPLICATION_REJECT_PROBABLE  = 16
     };
 
     // CONSTANTS
@@ -4264,6 +4317,16 @@ class Domain {
 
     static const int DEFAULT_INITIALIZER_DEDUPLICATION_TIME_MS;
 
+    static const int DEFAULT_INITIALIZER_DEDUPLICATION_CAPACITY;
+
+    static const int DEFAULT_INITIALIZER_DEDUPLICATION_FINGERPRINT_BITS;
+
+    static const char DEFAULT_INITIALIZER_PRIORITY_PROPERTY[];
+
+    static const char DEFAULT_INITIALIZER_DELIVERY_TIME_PROPERTY[];
+
+    static const bool DEFAULT_INITIALIZER_DEDUPLICATION_REJECT_PROBABLE;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -4403,6 +4466,26 @@ class Domain {
     // Return a reference to the modifiable "Consistency" attribute of this
     // object.
 
+    int& deduplicationCapacity();
+    // Return a reference to the modifiable "DeduplicationCapacity"
+    // attribute of this object.
+
+    int& deduplicationFingerprintBits();
+    // Return a reference to the modifiable "DeduplicationFingerprintBits"
+    // attribute of this object.
+
+    bsl::string& priorityProperty();
+    // Return a reference to the modifiable "PriorityProperty" attribute of
+    // this object.
+
+    bsl::string& deliveryTimeProperty();
+    // Return a reference to the modifiable "DeliveryTimeProperty" attribute
+    // of this object.
+
+    bool& deduplicationRejectProbable();
+    // Return a reference to the modifiable "DeduplicationRejectProbable"
+    // attribute of this object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -4488,6 +4571,26 @@ class Domain {
     const Consistency& consistency() const;
     // Return a reference offering non-modifiable access to the
     // "Consistency" attribute of this object.
+
+    int deduplicationCapacity() const;
+    // Return the value of the "DeduplicationCapacity" attribute of this
+    // object.
+
+    int deduplicationFingerprintBits() const;
+    // Return the value of the "DeduplicationFingerprintBits" attribute of
+    // this object.
+
+    const bsl::string& priorityProperty() const;
+    // Return a reference offering non-modifiable access to the
+    // "PriorityProperty" attribute of this object.
+
+    const bsl::string& deliveryTimeProperty() const;
+    // Return a reference offering non-modifiable access to the
+    // "DeliveryTimeProperty" attribute of this object.
+
+    bool deduplicationRejectProbable() const;
+    // Return the value of the "DeduplicationRejectProbable" attribute of
+    // this object.
 };
 
 // FREE OPERATORS
@@ -5904,6 +6007,13 @@ int MsgGroupIdConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_consistentHashing,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONSISTENT_HASHING]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -5925,6 +6035,11 @@ int MsgGroupIdConfig::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
         return manipulator(&d_ttlSeconds,
                            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_TTL_SECONDS]);
     }
+    case ATTRIBUTE_ID_CONSISTENT_HASHING: {
+        return manipulator(
+            &d_consistentHashing,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONSISTENT_HASHING]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -5960,6 +6075,11 @@ inline bsls::Types::Int64& MsgGroupIdConfig::ttlSeconds()
     return d_ttlSeconds;
 }
 
+inline bool& MsgGroupIdConfig::consistentHashing()
+{
+    return d_consistentHashing;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int MsgGroupIdConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -5984,6 +6104,12 @@ int MsgGroupIdConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_consistentHashing,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONSISTENT_HASHING]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -6005,6 +6131,11 @@ int MsgGroupIdConfig::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_ttlSeconds,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_TTL_SECONDS]);
     }
+    case ATTRIBUTE_ID_CONSISTENT_HASHING: {
+        return accessor(
+            d_consistentHashing,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONSISTENT_HASHING]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -6040,6 +6171,11 @@ inline bsls::Types::Int64 MsgGroupIdConfig::ttlSeconds() const
     return d_ttlSeconds;
 }
 
+inline bool MsgGroupIdConfig::consistentHashing() const
+{
+    return d_consistentHashing;
+}
+
 // ------------------------------
 // class QueueConsistencyEventual
 // ------------------------------
@@ -7297,6 +7433,40 @@ int Domain::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_deduplicationCapacity,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DEDUPLICATION_CAPACITY]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_deduplicationFingerprintBits,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DEDUPLICATION_FINGERPRINT_BITS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_priorityProperty,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRIORITY_PROPERTY]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_deliveryTimeProperty,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DELIVERY_TIME_PROPERTY]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_deduplicationRejectProbable,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DEDUPLICATION_REJECT_PROBABLE]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -7360,6 +7530,33 @@ int Domain::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
         return manipulator(&d_consistency,
                            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONSISTENCY]);
     }
+    case ATTRIBUTE_ID_DEDUPLICATION_CAPACITY: {
+        return manipulator(
+            &d_deduplicationCapacity,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DEDUPLICATION_CAPACITY]);
+    }
+    case ATTRIBUTE_ID_DEDUPLICATION_FINGERPRINT_BITS: {
+        return manipulator(
+            &d_deduplicationFingerprintBits,
+            ATTRIBUTE_INFO_ARRAY
+                [ATTRIBUTE_INDEX_DEDUPLICATION_FINGERPRINT_BITS]);
+    }
+    case ATTRIBUTE_ID_PRIORITY_PROPERTY: {
+        return manipulator(
+            &d_priorityProperty,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRIORITY_PROPERTY]);
+    }
+    case ATTRIBUTE_ID_DELIVERY_TIME_PROPERTY: {
+        return manipulator(
+            &d_deliveryTimeProperty,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DELIVERY_TIME_PROPERTY]);
+    }
+    case ATTRIBUTE_ID_DEDUPLICATION_REJECT_PROBABLE: {
+        return manipulator(
+            &d_deduplicationRejectProbable,
+            ATTRIBUTE_INFO_ARRAY
+                [ATTRIBUTE_INDEX_DEDUPLICATION_REJECT_PROBABLE]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -7440,6 +7637,31 @@ inline Consistency& Domain::consistency()
     return d_consistency;
 }
 
+inline int& Domain::deduplicationCapacity()
+{
+    return d_deduplicationCapacity;
+}
+
+inline int& Domain::deduplicationFingerprintBits()
+{
+    return d_deduplicationFingerprintBits;
+}
+
+inline bsl::string& Domain::priorityProperty()
+{
+    return d_priorityProperty;
+}
+
+inline bsl::string& Domain::deliveryTimeProperty()
+{
+    return d_deliveryTimeProperty;
+}
+
+inline bool& Domain::deduplicationRejectProbable()
+{
+    return d_deduplicationRejectProbable;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int Domain::accessAttributes(t_ACCESSOR& accessor) const
@@ -7517,6 +7739,40 @@ int Domain::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(
+        d_deduplicationCapacity,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DEDUPLICATION_CAPACITY]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_deduplicationFingerprintBits,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DEDUPLICATION_FINGERPRINT_BITS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_priorityProperty,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRIORITY_PROPERTY]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_deliveryTimeProperty,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DELIVERY_TIME_PROPERTY]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_deduplicationRejectProbable,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DEDUPLICATION_REJECT_PROBABLE]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -7575,6 +7831,33 @@ int Domain::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_consistency,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONSISTENCY]);
     }
+    case ATTRIBUTE_ID_DEDUPLICATION_CAPACITY: {
+        return accessor(
+            d_deduplicationCapacity,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DEDUPLICATION_CAPACITY]);
+    }
+    case ATTRIBUTE_ID_DEDUPLICATION_FINGERPRINT_BITS: {
+        return accessor(
+            d_deduplicationFingerprintBits,
+            ATTRIBUTE_INFO_ARRAY
+                [ATTRIBUTE_INDEX_DEDUPLICATION_FINGERPRINT_BITS]);
+    }
+    case ATTRIBUTE_ID_PRIORITY_PROPERTY: {
+        return accessor(
+            d_priorityProperty,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRIORITY_PROPERTY]);
+    }
+    case ATTRIBUTE_ID_DELIVERY_TIME_PROPERTY: {
+        return accessor(
+            d_deliveryTimeProperty,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DELIVERY_TIME_PROPERTY]);
+    }
+    case ATTRIBUTE_ID_DEDUPLICATION_REJECT_PROBABLE: {
+        return accessor(
+            d_deduplicationRejectProbable,
+            ATTRIBUTE_INFO_ARRAY
+                [ATTRIBUTE_INDEX_DEDUPLICATION_REJECT_PROBABLE]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -7656,6 +7939,31 @@ inline const Consistency& Domain::consistency() const
     return d_consistency;
 }
 
+inline int Domain::deduplicationCapacity() const
+{
+    return d_deduplicationCapacity;
+}
+
+inline int Domain::deduplicationFingerprintBits() const
+{
+    return d_deduplicationFingerprintBits;
+}
+
+inline const bsl::string& Domain::priorityProperty() const
+{
+    return d_priorityProperty;
+}
+
+inline const bsl::string& Domain::deliveryTimeProperty() const
+{
+    return d_deliveryTimeProperty;
+}
+
+inline bool Domain::deduplicationRejectProbable() const
+{
+    return d_deduplicationRejectProbable;
+}
+
 // ----------------------
 // class DomainDefinition
 // ----------------------
@@ -8088,7 +8396,8 @@ inline bool mqbconfm::operator==(const mqbconfm::MsgGroupIdConfig& lhs,
 {
     return lhs.rebalance() == rhs.rebalance() &&
            lhs.maxGroups() == rhs.maxGroups() &&
-           lhs.ttlSeconds() == rhs.ttlSeconds();
+           lhs.ttlSeconds() == rhs.ttlSeconds() &&
+           lhs.consistentHashing() == rhs.consistentHashing();
 }
 
 inline bool mqbconfm::operator!=(const mqbconfm::MsgGroupIdConfig& lhs,
@@ -8112,6 +8421,7 @@ void mqbconfm::hashAppend(t_HASH_ALGORITHM&                 hashAlg,
     hashAppend(hashAlg, object.rebalance());
     hashAppend(hashAlg, object.maxGroups());
     hashAppend(hashAlg, object.ttlSeconds());
+    hashAppend(hashAlg, object.consistentHashing());
 }
 
 inline bool mqbconfm::operator==(const mqbconfm::QueueConsistencyEventual&,
@@ -8574,7 +8884,14 @@ inline bool mqbconfm::operator==(const mqbconfm::Domain& lhs,
            lhs.messageTtl() == rhs.messageTtl() &&
            lhs.maxDeliveryAttempts() == rhs.maxDeliveryAttempts() &&
            lhs.deduplicationTimeMs() == rhs.deduplicationTimeMs() &&
-           lhs.consistency() == rhs.consistency();
+           lhs.consistency() == rhs.consistency() &&
+           lhs.deduplicationCapacity() == rhs.deduplicationCapacity() &&
+           lhs.deduplicationFingerprintBits() ==
+               rhs.deduplicationFingerprintBits() &&
+           lhs.priorityProperty() == rhs.priorityProperty() &&
+           lhs.deliveryTimeProperty() == rhs.deliveryTimeProperty() &&
+           lhs.deduplicationRejectProbable() ==
+               rhs.deduplicationRejectProbable();
 }
 
 inline bool mqbconfm::operator!=(const mqbconfm::Domain& lhs,
@@ -8606,6 +8923,11 @@ void mqbconfm::hashAppend(t_HASH_ALGORITHM&       hashAlg,
     hashAppend(hashAlg, object.maxDeliveryAttempts());
     hashAppend(hashAlg, object.deduplicationTimeMs());
     hashAppend(hashAlg, object.consistency());
+    hashAppend(hashAlg, object.deduplicationCapacity());
+    hashAppend(hashAlg, object.deduplicationFingerprintBits());
+    hashAppend(hashAlg, object.priorityProperty());
+    hashAppend(hashAlg, object.deliveryTimeProperty());
+    hashAppend(hashAlg, object.deduplicationRejectProbable());
 }
 
 inline bool mqbconfm::operator==(const mqbconfm::DomainDefinition& lhs,
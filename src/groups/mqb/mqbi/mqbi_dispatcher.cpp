@@ -375,6 +375,7 @@ bsl::ostream& DispatcherEvent::print(bsl::ostream& stream,
         }
         printer.printAttribute("msGroupId", d_msgGroupId);
         printer.printAttribute("isRelay", (d_isRelay ? "true" : "false"));
+        printer.printAttribute("isBatch", (d_callback ? "true" : "false"));
     } break;
     case DispatcherEventType::e_PUT: {
         printer.printAttribute("blobLength",
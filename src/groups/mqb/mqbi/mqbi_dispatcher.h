@@ -684,6 +684,15 @@ class DispatcherPushEvent {
     /// event is compressed.
     virtual bmqt::CompressionAlgorithmType::Enum
     compressionAlgorithmType() const = 0;
+
+    /// Return a reference not offering modifiable access to the callback
+    /// handing over a batch of PUSH messages to the destination, each as
+    /// if it had been dispatched in its own PUSH event, or an empty
+    /// callback if this event holds a single message.  Unlike for
+    /// `e_CALLBACK` events, the destination must not flush its pending
+    /// messages before invoking it, so that the batch is appended to the
+    /// PUSH messages being built.
+    virtual const Dispatcher::ProcessorFunctor& callback() const = 0;
 };
 
 // ========================
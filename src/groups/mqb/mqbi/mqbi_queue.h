@@ -63,6 +63,7 @@
 
 // MWC
 #include <mwcc_orderedhashset.h>
+#include <mwcc_ringhashmap.h>
 
 // BDE
 #include <bdlbb_blob.h>
@@ -431,10 +432,13 @@ class QueueHandle {
     /// Signature of a `void` functor method.
     typedef bsl::function<void(void)> VoidFunctor;
 
-    /// An ordered hash map of GUID and associated message info.
-    typedef mwcc::OrderedHashMap<bmqt::MessageGUID,
-                                 UnconfirmedMessageInfo,
-                                 bslh::Hash<bmqt::MessageGUIDHashAlgo> >
+    /// An insertion-ordered hash map of GUID and associated message info.
+    /// Messages are mostly confirmed in the order they were delivered, so a
+    /// ring-based map is used to avoid allocating one node per unconfirmed
+    /// message.
+    typedef mwcc::RingHashMap<bmqt::MessageGUID,
+                              UnconfirmedMessageInfo,
+                              bslh::Hash<bmqt::MessageGUIDHashAlgo> >
         UnconfirmedMessageInfoMap;
     typedef bsl::shared_ptr<UnconfirmedMessageInfoMap> RedeliverySp;
 
@@ -588,6 +592,21 @@ class QueueHandle {
         const bmqp::Protocol::MsgGroupId&         msgGroupId,
         const bmqp::Protocol::SubQueueInfosArray& subscriptions) = 0;
 
+    /// Start a batch of deliveries to this handle: the messages delivered
+    /// by `deliverMessage` and `deliverMessageNoTrack` until the next call
+    /// to `endDeliveryBatch` may be handed over to the client in a single
+    /// dispatcher event.  Flow control is not affected by batching.
+    ///
+    /// THREAD: This method is called from the Queue's dispatcher thread.
+    virtual void beginDeliveryBatch() = 0;
+
+    /// End the batch of deliveries started by `beginDeliveryBatch`, and
+    /// dispatch to the client the messages delivered during the batch, in
+    /// the order they were delivered.
+    ///
+    /// THREAD: This method is called from the Queue's dispatcher thread.
+    virtual void endDeliveryBatch() = 0;
+
     /// Used by the client to configure a given queue handle with the
     /// specified `streamParameters`.  Invoke the specified `configuredCb`
     /// when done.
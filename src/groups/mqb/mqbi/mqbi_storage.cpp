@@ -104,7 +104,7 @@ bmqt::AckResult::Enum StorageResult::toAckResult(StorageResult::Enum value)
 
     switch (value) {
         CASE(SUCCESS, SUCCESS)
-        CASE(INVALID_OPERATION, UNKNOWN)
+        CASE(INVALID_OPERATION, INVALID_ARGUMENT)
         CASE(GUID_NOT_UNIQUE, UNKNOWN)
         CASE(GUID_NOT_FOUND, UNKNOWN)
         CASE(ZERO_REFERENCES, UNKNOWN)
@@ -143,6 +143,8 @@ StorageMessageAttributes::print(bsl::ostream&                   stream,
     printer.printAttribute("hasMessageProperties",
                            value.messagePropertiesInfo().isPresent());
     printer.printAttribute("crc32c", value.crc32c());
+    printer.printAttribute("priority", value.priority());
+    printer.printAttribute("deliveryTimestamp", value.deliveryTimestamp());
 
     printer.end();
 
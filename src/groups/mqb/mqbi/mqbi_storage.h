@@ -63,6 +63,9 @@
 namespace BloombergLP {
 
 // FORWARD DECLARATION
+namespace mqbcmd {
+class DeduplicationStats;
+}
 namespace mqbu {
 class CapacityMeter;
 }
@@ -183,6 +186,19 @@ class StorageMessageAttributes {
     // compress this message i.e. the
     // application data.
 
+    int d_priority;
+    // Delivery priority of this message,
+    // higher values being delivered
+    // first.  Only meaningful in a queue
+    // whose domain configures a priority
+    // property, and zero otherwise.
+
+    bsls::Types::Uint64 d_deliveryTimestamp;
+    // Time, in seconds from epoch, before
+    // which this message must not be
+    // delivered, or zero if it can be
+    // delivered as soon as it arrives.
+
   public:
     // CLASS METHODS
 
@@ -223,6 +239,8 @@ class StorageMessageAttributes {
     StorageMessageAttributes&
     setCompressionAlgorithmType(bmqt::CompressionAlgorithmType::Enum value);
     StorageMessageAttributes& setReceipt(bool value);
+    StorageMessageAttributes& setPriority(int value);
+    StorageMessageAttributes& setDeliveryTimestamp(bsls::Types::Uint64 value);
 
     /// Set the corresponding attribute to the specified `value` and return
     /// a reference offering modifiable access to this object.
@@ -242,6 +260,14 @@ class StorageMessageAttributes {
     /// Return the CRC32-C associated with this object.
     unsigned int                         crc32c() const;
     bmqt::CompressionAlgorithmType::Enum compressionAlgorithmType() const;
+
+    /// Return the delivery priority of the message.
+    int priority() const;
+
+    /// Return the time, in seconds from epoch, before which the message
+    /// must not be delivered, or zero if it can be delivered as soon as it
+    /// arrives.
+    bsls::Types::Uint64 deliveryTimestamp() const;
 };
 
 // FREE OPERATORS
@@ -407,7 +433,9 @@ class Storage {
     /// the associated `attributes` and `msgGUID` into this storage and the
     /// associated virtual storages, if any.  The `attributes` is an in/out
     /// parameter and storage layer can populate certain fields of that
-    /// struct.  Return 0 on success or an non-zero error code on failure.
+    /// struct.  Return 0 on success or an non-zero error code on failure,
+    /// `e_INVALID_OPERATION` denoting `attributes` this storage cannot
+    /// honor (e.g., a delivery time too far ahead).
     virtual StorageResult::Enum
     put(StorageMessageAttributes*           attributes,
         const bmqt::MessageGUID&            msgGUID,
@@ -490,6 +518,17 @@ class Storage {
     /// become invalid after this method returns.
     virtual bool removeVirtualStorage(const mqbu::StorageKey& appKey) = 0;
 
+    /// Make the virtual storage identified by the specified `appKey` lazy if
+    /// the specified `isLazy` is true, and materialize it otherwise.  A
+    /// lazy virtual storage does not keep any per-message state for the
+    /// messages subsequently added to all virtual storages: they are only
+    /// accounted for, and are materialized, in order, when the virtual
+    /// storage is made non-lazy or when one of them is accessed through the
+    /// virtual storage (e.g., confirmed).  This method has no effect if
+    /// there is no virtual storage with `appKey`.  Behavior is undefined
+    /// unless `appKey` is non-null.
+    virtual void setLazy(const mqbu::StorageKey& appKey, bool isLazy) = 0;
+
     // ACCESSORS
 
     /// Return the URI of the queue this storage is associated with.
@@ -589,6 +628,12 @@ class Storage {
     /// Load into the specified `buffer` the list of pairs of appId and
     /// appKey for all the virtual storages registered with this instance.
     virtual void loadVirtualStorageDetails(AppIdKeyPairs* buffer) const = 0;
+
+    /// Load into the specified `out` the statistics of the index used by
+    /// this storage to detect duplicate PUTs and return true, or return
+    /// false if this storage relies on its time-based history instead.
+    virtual bool
+    loadDeduplicationStats(mqbcmd::DeduplicationStats* out) const = 0;
 };
 
 // ============================================================================
@@ -609,6 +654,8 @@ inline StorageMessageAttributes::StorageMessageAttributes()
 , d_queueHandle(0)
 , d_crc32c(0)
 , d_compressionAlgorithmType(bmqt::CompressionAlgorithmType::e_NONE)
+, d_priority(0)
+, d_deliveryTimestamp(0)
 {
 }
 
@@ -629,6 +676,8 @@ inline StorageMessageAttributes::StorageMessageAttributes(
 , d_queueHandle(queueHandle)
 , d_crc32c(crc32c)
 , d_compressionAlgorithmType(compressionAlgorithmType)
+, d_priority(0)
+, d_deliveryTimestamp(0)
 {
     // NOTHING
 }
@@ -677,6 +726,20 @@ StorageMessageAttributes::setReceipt(bool value)
     return *this;
 }
 
+inline StorageMessageAttributes&
+StorageMessageAttributes::setPriority(int value)
+{
+    d_priority = value;
+    return *this;
+}
+
+inline StorageMessageAttributes&
+StorageMessageAttributes::setDeliveryTimestamp(bsls::Types::Uint64 value)
+{
+    d_deliveryTimestamp = value;
+    return *this;
+}
+
 inline StorageMessageAttributes&
 StorageMessageAttributes::setMessagePropertiesInfo(
     const bmqp::MessagePropertiesInfo& value)
@@ -695,6 +758,8 @@ inline void StorageMessageAttributes::reset()
     d_hasReceipt               = true;
     d_crc32c                   = 0;
     d_compressionAlgorithmType = bmqt::CompressionAlgorithmType::e_NONE;
+    d_priority                 = 0;
+    d_deliveryTimestamp        = 0;
 }
 
 // ACCESSORS
@@ -740,6 +805,16 @@ StorageMessageAttributes::compressionAlgorithmType() const
     return d_compressionAlgorithmType;
 }
 
+inline int StorageMessageAttributes::priority() const
+{
+    return d_priority;
+}
+
+inline bsls::Types::Uint64 StorageMessageAttributes::deliveryTimestamp() const
+{
+    return d_deliveryTimestamp;
+}
+
 // FREE OPERATORS
 inline bsl::ostream& operator<<(bsl::ostream&                   stream,
                                 const StorageMessageAttributes& value)
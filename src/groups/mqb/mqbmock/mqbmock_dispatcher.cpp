@@ -245,6 +245,10 @@ void DispatcherClient::onDispatcherEvent(const mqbi::DispatcherEvent& event)
     if (event.type() == mqbi::DispatcherEventType::e_CALLBACK) {
         event.asCallbackEvent()->callback()(0);
     }
+    else if (event.type() == mqbi::DispatcherEventType::e_PUSH &&
+             event.asPushEvent()->callback()) {
+        event.asPushEvent()->callback()(0);
+    }
 }
 
 void DispatcherClient::flush()
@@ -320,6 +320,16 @@ void QueueHandle::deliverMessageNoTrack(
     deliverMessage(message, msgGUID, attributes, msgGroupId, subscriptions);
 }
 
+void QueueHandle::beginDeliveryBatch()
+{
+    // NOTHING
+}
+
+void QueueHandle::endDeliveryBatch()
+{
+    // NOTHING
+}
+
 void QueueHandle::configure(
     const bmqp_ctrlmsg::StreamParameters&              streamParameters,
     const mqbi::QueueHandle::HandleConfiguredCallback& configuredCb)
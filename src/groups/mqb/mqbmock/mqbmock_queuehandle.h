@@ -347,6 +347,14 @@ class QueueHandle : public mqbi::QueueHandle {
         const bmqp::Protocol::SubQueueInfosArray& subscriptions)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Start a batch of deliveries to this handle.  Note that this mock
+    /// records the messages as they are delivered, so batching has no
+    /// effect.
+    void beginDeliveryBatch() BSLS_KEYWORD_OVERRIDE;
+
+    /// End the batch of deliveries started by `beginDeliveryBatch`.
+    void endDeliveryBatch() BSLS_KEYWORD_OVERRIDE;
+
     /// Used by the client to configure a given queue handle with the
     /// specified `streamParameters`.  Invoke the specified `configuredCb`
     /// when done.
@@ -17,6 +17,10 @@
 #include <mqbnet_channel.h>
 
 #include <mqbscm_version.h>
+
+// MQB
+#include <mqbstat_messagetracer.h>
+
 // BDE
 #include <bdlf_bind.h>
 #include <bslmt_lockguard.h>
@@ -402,6 +406,11 @@ Channel::writeBufferedItem(bool*                                  isConsumed,
                             d_putBuilder,
                             PutArgs(item),
                             item.d_state);
+        if (rc == bmqt::GenericResult::e_SUCCESS) {
+            mqbstat::MessageTracer::record(
+                mqbstat::MessageTracerStage::e_CHANNEL_WRITE,
+                item.d_putHeader.messageGUID());
+        }
         break;
     case bmqp::EventType::e_PUSH:
         if (item.d_data_sp) {
@@ -420,6 +429,11 @@ Channel::writeBufferedItem(bool*                                  isConsumed,
                                 ImplicitPushArgs(item),
                                 item.d_state);
         }
+        if (rc == bmqt::GenericResult::e_SUCCESS) {
+            mqbstat::MessageTracer::record(
+                mqbstat::MessageTracerStage::e_CHANNEL_WRITE,
+                item.d_msgId);
+        }
         break;
     case bmqp::EventType::e_CONFIRM:
         rc = writeImmediate(isConsumed,
@@ -100,6 +100,10 @@ const int k_SESSION_DESTROY_WAIT = 10;
 const int k_CLIENT_CLOSE_WAIT = 10;
 // Time to wait incrementally (in seconds) for all clients and
 // proxies to be destroyed during stop sequence.
+const int k_MAX_INCOMING_STREAM_TRANSFER_SIZE = 1024 * 1024;
+// Maximum number of bytes to copy out of the socket receive buffer
+// with a single system call: favor large reads so that a burst of
+// events is drained with as few syscalls as possible.
 
 char calculateInitialMissedHbCounter(const mqbcfg::TcpInterfaceConfig& config)
 {
@@ -184,6 +188,8 @@ ntcCreateInterfaceConfig(const mqbcfg::TcpInterfaceConfig& tcpConfig)
     config.setMinThreads(tcpConfig.ioThreads());
     config.setMaxThreads(tcpConfig.ioThreads());
     config.setMaxConnections(tcpConfig.maxConnections());
+    config.setMaxIncomingStreamTransferSize(
+        k_MAX_INCOMING_STREAM_TRANSFER_SIZE);
 
     config.setWriteQueueLowWatermark(tcpConfig.lowWatermark());
     config.setWriteQueueHighWatermark(tcpConfig.highWatermark());
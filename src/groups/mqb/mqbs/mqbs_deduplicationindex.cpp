@@ -0,0 +1,343 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_deduplicationindex.cpp                                        -*-C++-*-
+#include <mqbs_deduplicationindex.h>
+
+#include <mqbscm_version.h>
+// MQB
+#include <mqbcmd_messages.h>
+
+// BDE
+#include <bsl_algorithm.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace mqbs {
+
+namespace {
+
+/// Highest load of a generation of the filter.  Cuckoo filters having
+/// buckets of 4 slots reliably reach a load of 95%.
+const double k_MAX_LOAD_FACTOR = 0.9;
+
+/// Return the specified `value` with its bits mixed, so that each bit of the
+/// result depends on all bits of `value` (this is the finalizer of
+/// SplitMix64).
+bsls::Types::Uint64 mix(bsls::Types::Uint64 value)
+{
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ULL;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebULL;
+    value ^= value >> 31;
+    return value;
+}
+
+}  // close unnamed namespace
+
+// ------------------------
+// class DeduplicationIndex
+// ------------------------
+
+// PRIVATE MANIPULATORS
+void DeduplicationIndex::writeSlot(Generation*         generation,
+                                   bsls::Types::Uint64 slot,
+                                   bsls::Types::Uint32 fingerprint)
+{
+    unsigned char* p = generation->d_slots.data() + slot * d_slotSize;
+    for (int i = 0; i < d_slotSize; ++i) {
+        p[i] = static_cast<unsigned char>(fingerprint >> (8 * i));
+    }
+}
+
+bool DeduplicationIndex::insertFingerprint(bsls::Types::Uint64* bucket,
+                                           bsls::Types::Uint32* fingerprint)
+{
+    Generation& generation = *d_current_p;
+
+    bsls::Types::Uint64 buckets[2] = {*bucket,
+                                      altBucket(*bucket, *fingerprint)};
+    for (int b = 0; b < 2; ++b) {
+        const bsls::Types::Uint64 first = buckets[b] * k_SLOTS_PER_BUCKET;
+        for (int i = 0; i < k_SLOTS_PER_BUCKET; ++i) {
+            if (readSlot(generation, first + i) == 0) {
+                writeSlot(&generation, first + i, *fingerprint);
+                ++generation.d_numEntries;
+                return true;  // RETURN
+            }
+        }
+    }
+
+    // Both buckets are full: relocate fingerprints to their alternate bucket
+    // until one finds an empty slot.
+    bsls::Types::Uint64 current = buckets[d_kickSeed & 1];
+    bsls::Types::Uint32 inHand  = *fingerprint;
+    for (int kick = 0; kick < k_MAX_KICKS; ++kick) {
+        d_kickSeed ^= d_kickSeed << 13;
+        d_kickSeed ^= d_kickSeed >> 7;
+        d_kickSeed ^= d_kickSeed << 17;
+
+        const bsls::Types::Uint64 victimSlot =
+            current * k_SLOTS_PER_BUCKET + (d_kickSeed % k_SLOTS_PER_BUCKET);
+        const bsls::Types::Uint32 victim = readSlot(generation, victimSlot);
+        writeSlot(&generation, victimSlot, inHand);
+        inHand  = victim;
+        current = altBucket(current, inHand);
+
+        const bsls::Types::Uint64 first = current * k_SLOTS_PER_BUCKET;
+        for (int i = 0; i < k_SLOTS_PER_BUCKET; ++i) {
+            if (readSlot(generation, first + i) == 0) {
+                writeSlot(&generation, first + i, inHand);
+                ++generation.d_numEntries;
+                return true;  // RETURN
+            }
+        }
+    }
+
+    *bucket      = current;
+    *fingerprint = inHand;
+    return false;
+}
+
+void DeduplicationIndex::rotate()
+{
+    bsl::fill(d_previous_p->d_slots.begin(), d_previous_p->d_slots.end(), 0);
+    d_previous_p->d_numEntries = 0;
+
+    bsl::swap(d_current_p, d_previous_p);
+    ++d_numRotations;
+}
+
+// PRIVATE ACCESSORS
+bsls::Types::Uint32
+DeduplicationIndex::readSlot(const Generation&   generation,
+                             bsls::Types::Uint64 slot) const
+{
+    const unsigned char* p = generation.d_slots.data() + slot * d_slotSize;
+    bsls::Types::Uint32  fingerprint = 0;
+    for (int i = 0; i < d_slotSize; ++i) {
+        fingerprint |= static_cast<bsls::Types::Uint32>(p[i]) << (8 * i);
+    }
+    return fingerprint;
+}
+
+void DeduplicationIndex::computeHash(bsls::Types::Uint64*     bucket,
+                                     bsls::Types::Uint32*     fingerprint,
+                                     const bmqt::MessageGUID& guid) const
+{
+    const bsls::Types::Uint64 hash = mix(GUIDHasher()(guid));
+
+    *bucket = hash & d_bucketMask;
+
+    // Use the high bits, independent of the bucket, for the fingerprint.  0
+    // denotes an empty slot.
+    *fingerprint = static_cast<bsls::Types::Uint32>(hash >>
+                                                    (64 - d_fingerprintBits));
+    if (*fingerprint == 0) {
+        *fingerprint = 1;
+    }
+}
+
+bsls::Types::Uint64
+DeduplicationIndex::altBucket(bsls::Types::Uint64 bucket,
+                              bsls::Types::Uint32 fingerprint) const
+{
+    // Partial-key cuckoo hashing: the alternate bucket only depends on the
+    // fingerprint, and applying this function twice returns 'bucket'.
+    return (bucket ^ mix(fingerprint)) & d_bucketMask;
+}
+
+bool DeduplicationIndex::bucketContains(const Generation&   generation,
+                                        bsls::Types::Uint64 bucket,
+                                        bsls::Types::Uint32 fingerprint) const
+{
+    const bsls::Types::Uint64 first = bucket * k_SLOTS_PER_BUCKET;
+    for (int i = 0; i < k_SLOTS_PER_BUCKET; ++i) {
+        if (readSlot(generation, first + i) == fingerprint) {
+            return true;  // RETURN
+        }
+    }
+    return false;
+}
+
+// CREATORS
+DeduplicationIndex::DeduplicationIndex(bsls::Types::Int64 capacity,
+                                       int                fingerprintBits,
+                                       bslma::Allocator*  allocator)
+: d_capacity(capacity)
+, d_fingerprintBits(fingerprintBits)
+, d_slotSize((fingerprintBits + 7) / 8)
+, d_bucketMask(0)
+, d_generation0(allocator)
+, d_generation1(allocator)
+, d_current_p(&d_generation0)
+, d_previous_p(&d_generation1)
+, d_tail(allocator)
+, d_tailCapacity(0)
+, d_tailNext(0)
+, d_tailSet(allocator)
+, d_kickSeed(0x2545f4914f6cdd1dULL)
+, d_numLookups(0)
+, d_numExactHits(0)
+, d_numProbableHits(0)
+, d_numRotations(0)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(0 < capacity);
+    BSLS_ASSERT_OPT(k_MIN_FINGERPRINT_BITS <= fingerprintBits &&
+                    fingerprintBits <= k_MAX_FINGERPRINT_BITS);
+
+    const double minBuckets = static_cast<double>(capacity) /
+                              (k_SLOTS_PER_BUCKET * k_MAX_LOAD_FACTOR);
+    bsls::Types::Uint64 numBuckets = 1;
+    while (static_cast<double>(numBuckets) < minBuckets) {
+        numBuckets <<= 1;
+    }
+    d_bucketMask = numBuckets - 1;
+
+    const size_t numBytes = static_cast<size_t>(numBuckets *
+                                                k_SLOTS_PER_BUCKET *
+                                                d_slotSize);
+    d_generation0.d_slots.resize(numBytes, 0);
+    d_generation1.d_slots.resize(numBytes, 0);
+
+    d_tailCapacity = static_cast<size_t>(
+        bsl::max(capacity / 16, static_cast<bsls::Types::Int64>(1)));
+    d_tail.reserve(d_tailCapacity);
+    d_tailSet.reserve(d_tailCapacity);
+}
+
+// MANIPULATORS
+DeduplicationIndex::LookupResult
+DeduplicationIndex::lookup(const bmqt::MessageGUID& guid)
+{
+    ++d_numLookups;
+
+    if (d_tailSet.find(guid) != d_tailSet.end()) {
+        ++d_numExactHits;
+        return e_FOUND;  // RETURN
+    }
+
+    bsls::Types::Uint64 bucket;
+    bsls::Types::Uint32 fingerprint;
+    computeHash(&bucket, &fingerprint, guid);
+    const bsls::Types::Uint64 alt = altBucket(bucket, fingerprint);
+
+    const Generation* generations[2] = {d_current_p, d_previous_p};
+    for (int g = 0; g < 2; ++g) {
+        if (generations[g]->d_numEntries == 0) {
+            continue;  // CONTINUE
+        }
+        if (bucketContains(*generations[g], bucket, fingerprint) ||
+            bucketContains(*generations[g], alt, fingerprint)) {
+            ++d_numProbableHits;
+            return e_PROBABLE;  // RETURN
+        }
+    }
+
+    return e_NOT_FOUND;
+}
+
+void DeduplicationIndex::insert(const bmqt::MessageGUID& guid)
+{
+    // Exact tail window
+    if (d_tail.size() < d_tailCapacity) {
+        d_tail.push_back(guid);
+    }
+    else {
+        d_tailSet.erase(d_tail[d_tailNext]);
+        d_tail[d_tailNext] = guid;
+    }
+    d_tailSet.insert(guid);
+    d_tailNext = (d_tailNext + 1) % d_tailCapacity;
+
+    // Filter
+    if (d_current_p->d_numEntries >= d_capacity) {
+        rotate();
+    }
+
+    bsls::Types::Uint64 bucket;
+    bsls::Types::Uint32 fingerprint;
+    computeHash(&bucket, &fingerprint, guid);
+
+    if (!insertFingerprint(&bucket, &fingerprint)) {
+        // The current generation is full earlier than expected.  Start a new
+        // one with the fingerprint left without a slot, which always
+        // succeeds since the new generation is empty.
+        rotate();
+        const bool rc = insertFingerprint(&bucket, &fingerprint);
+        BSLS_ASSERT_SAFE(rc);
+        (void)rc;
+    }
+}
+
+void DeduplicationIndex::clear()
+{
+    bsl::fill(d_generation0.d_slots.begin(), d_generation0.d_slots.end(), 0);
+    bsl::fill(d_generation1.d_slots.begin(), d_generation1.d_slots.end(), 0);
+    d_generation0.d_numEntries = 0;
+    d_generation1.d_numEntries = 0;
+
+    d_tail.clear();
+    d_tailSet.clear();
+    d_tailNext = 0;
+
+    d_numLookups      = 0;
+    d_numExactHits    = 0;
+    d_numProbableHits = 0;
+    d_numRotations    = 0;
+}
+
+// ACCESSORS
+double DeduplicationIndex::estimatedFalsePositiveRate() const
+{
+    // A lookup compares the fingerprint to the 2 * k_SLOTS_PER_BUCKET slots
+    // of its two buckets in each generation, each slot being occupied with a
+    // probability equal to the load of the generation, and matching a random
+    // fingerprint with a probability of 1 / (2^fingerprintBits - 1).
+    const double numSlots = static_cast<double>(
+        (d_bucketMask + 1) * k_SLOTS_PER_BUCKET);
+    const double numFingerprints = static_cast<double>(
+        (static_cast<bsls::Types::Uint64>(1) << d_fingerprintBits) - 1);
+    const double numEntries = static_cast<double>(d_generation0.d_numEntries +
+                                                  d_generation1.d_numEntries);
+
+    return 2 * k_SLOTS_PER_BUCKET * (numEntries / numSlots) / numFingerprints;
+}
+
+bsls::Types::Int64 DeduplicationIndex::memoryFootprint() const
+{
+    const size_t filter = d_generation0.d_slots.capacity() +
+                          d_generation1.d_slots.capacity();
+    const size_t tail   = d_tail.capacity() * sizeof(bmqt::MessageGUID) +
+                        d_tailSet.bucket_count() * sizeof(void*) +
+                        d_tailSet.size() *
+                            (sizeof(bmqt::MessageGUID) + 2 * sizeof(void*));
+
+    return static_cast<bsls::Types::Int64>(filter + tail);
+}
+
+void DeduplicationIndex::loadStats(mqbcmd::DeduplicationStats* out) const
+{
+    out->capacity()          = d_capacity;
+    out->numLookups()        = d_numLookups;
+    out->numExactHits()      = d_numExactHits;
+    out->numProbableHits()   = d_numProbableHits;
+    out->falsePositiveRate() = estimatedFalsePositiveRate();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,377 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_deduplicationindex.h                                          -*-C++-*-
+#ifndef INCLUDED_MQBS_DEDUPLICATIONINDEX
+#define INCLUDED_MQBS_DEDUPLICATIONINDEX
+
+//@PURPOSE: Provide a memory-bounded index of PUT GUIDs to detect duplicates.
+//
+//@CLASSES:
+//  mqbs::DeduplicationIndex: rotating cuckoo filter with an exact tail window
+//
+//@SEE ALSO: mqbs::InMemoryStorage, mqbs::FileBackedStorage
+//
+//@DESCRIPTION: 'mqbs::DeduplicationIndex' remembers the GUIDs of the messages
+// PUT in a queue, so that a message retransmitted by a producer (for instance
+// after a reconnection) can be recognized as a duplicate.  Unlike the
+// time-based history of the storages, whose memory grows with the PUT rate
+// times the deduplication time, the memory of the index is fixed at
+// construction and only depends on its 'capacity'.  A single index is used
+// per queue, and is therefore shared by all the appIds of the queue.
+//
+// The index is made of two parts:
+//: o an exact tail window, remembering the GUIDs of the last 'capacity / 16'
+//:   messages (at least one) in a ring and a hash set.  Retransmissions
+//:   typically concern the last few messages, which are then detected with
+//:   certainty;
+//: o a rotating cuckoo filter made of two generations, each storing the
+//:   fingerprints of up to 'capacity' GUIDs in buckets of
+//:   'k_SLOTS_PER_BUCKET' slots.  When the current generation is full, the
+//:   oldest one is cleared and becomes the current one, so that the filter
+//:   always remembers at least the last 'capacity' GUIDs, and at most the
+//:   last '2 * capacity'.
+//
+// A GUID found in the filter but not in the tail window is only *probably* a
+// duplicate: two different GUIDs may have the same fingerprint in the same
+// bucket.  The probability of such a false positive is bounded by:
+//..
+//  2 generations * 2 buckets * k_SLOTS_PER_BUCKET / 2^fingerprintBits
+//..
+// and is estimated more precisely from the occupancy of the filter by
+// 'estimatedFalsePositiveRate'.  The number of fingerprint bits, between
+// 'k_MIN_FINGERPRINT_BITS' and 'k_MAX_FINGERPRINT_BITS', therefore trades
+// memory for accuracy: each slot takes the number of bytes needed to hold a
+// fingerprint.
+//
+// Since rejecting a false positive loses a message, the storages only treat
+// an 'e_PROBABLE' result as a duplicate if the domain sets
+// 'deduplicationRejectProbable', and accept the message otherwise.
+//
+/// Thread Safety
+///-------------
+// NOT thread safe.
+//
+/// Usage
+///-----
+//..
+//  mqbs::DeduplicationIndex index(100000, 32, allocator);
+//
+//  if (index.lookup(guid) == mqbs::DeduplicationIndex::e_FOUND) {
+//      // Duplicate PUT
+//  }
+//  else {
+//      index.insert(guid);
+//  }
+//..
+
+// BMQ
+#include <bmqt_messageguid.h>
+
+// BDE
+#include <bsl_unordered_set.h>
+#include <bsl_vector.h>
+#include <bslh_hash.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_cpp11.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+
+// FORWARD DECLARATION
+namespace mqbcmd {
+class DeduplicationStats;
+}
+
+namespace mqbs {
+
+// ========================
+// class DeduplicationIndex
+// ========================
+
+/// Memory-bounded index of PUT GUIDs made of a rotating cuckoo filter and an
+/// exact tail window.
+class DeduplicationIndex {
+  public:
+    // TYPES
+
+    /// Result of a lookup.
+    enum LookupResult {
+        e_NOT_FOUND = 0,  // Never inserted
+        e_FOUND     = 1,  // In the exact tail window
+        e_PROBABLE  = 2   // In the filter only, possibly a false positive
+    };
+
+    // PUBLIC CONSTANTS
+
+    /// Number of fingerprints per bucket of the filter.
+    static const int k_SLOTS_PER_BUCKET = 4;
+
+    /// Smallest supported fingerprint size, in bits.
+    static const int k_MIN_FINGERPRINT_BITS = 8;
+
+    /// Largest supported fingerprint size, in bits.
+    static const int k_MAX_FINGERPRINT_BITS = 32;
+
+    /// Maximum number of fingerprints relocated by a single insertion
+    /// before the current generation is considered full.
+    static const int k_MAX_KICKS = 500;
+
+  private:
+    // PRIVATE TYPES
+    typedef bslh::Hash<bmqt::MessageGUIDHashAlgo> GUIDHasher;
+
+    typedef bsl::unordered_set<bmqt::MessageGUID, GUIDHasher> GUIDSet;
+
+    /// One generation of the cuckoo filter.
+    struct Generation {
+        bsl::vector<unsigned char> d_slots;
+        // Fingerprints, 'd_slotSize' bytes
+        // each, 0 meaning an empty slot
+
+        bsls::Types::Int64 d_numEntries;
+        // Number of fingerprints stored
+
+        explicit Generation(bslma::Allocator* allocator)
+        : d_slots(allocator)
+        , d_numEntries(0)
+        {
+        }
+    };
+
+    // DATA
+    bsls::Types::Int64 d_capacity;
+    // Number of GUIDs per generation
+
+    int d_fingerprintBits;
+    // Size of a fingerprint, in bits
+
+    int d_slotSize;
+    // Size of a slot, in bytes
+
+    bsls::Types::Uint64 d_bucketMask;
+    // Number of buckets per generation,
+    // minus one (a power of two minus one)
+
+    Generation d_generation0;
+    // First generation of the filter
+
+    Generation d_generation1;
+    // Second generation of the filter
+
+    Generation* d_current_p;
+    // Generation receiving insertions
+
+    Generation* d_previous_p;
+    // Oldest generation, cleared at the
+    // next rotation
+
+    bsl::vector<bmqt::MessageGUID> d_tail;
+    // Ring of the last inserted GUIDs
+
+    size_t d_tailCapacity;
+    // Number of GUIDs in the ring once
+    // full
+
+    size_t d_tailNext;
+    // Position of the next insertion in
+    // 'd_tail'
+
+    GUIDSet d_tailSet;
+    // GUIDs present in 'd_tail'
+
+    bsls::Types::Uint64 d_kickSeed;
+    // State of the generator choosing the
+    // fingerprint to relocate
+
+    bsls::Types::Int64 d_numLookups;
+    // Number of lookups
+
+    bsls::Types::Int64 d_numExactHits;
+    // Number of lookups found in the tail
+    // window
+
+    bsls::Types::Int64 d_numProbableHits;
+    // Number of lookups found in the
+    // filter only
+
+    bsls::Types::Int64 d_numRotations;
+    // Number of generation rotations
+
+  private:
+    // NOT IMPLEMENTED
+    DeduplicationIndex(const DeduplicationIndex&) BSLS_CPP11_DELETED;
+    DeduplicationIndex&
+    operator=(const DeduplicationIndex&) BSLS_CPP11_DELETED;
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Store the specified `fingerprint` at the specified `slot` of the
+    /// specified `generation`.
+    void writeSlot(Generation*         generation,
+                   bsls::Types::Uint64 slot,
+                   bsls::Types::Uint32 fingerprint);
+
+    /// Insert the specified `fingerprint` having the specified `bucket` as
+    /// one of its buckets in the current generation.  Return true on
+    /// success.  Otherwise, the current generation is full, and load into
+    /// the specified `bucket` and `fingerprint` the fingerprint which could
+    /// not be placed, which may differ from the one to insert.
+    bool insertFingerprint(bsls::Types::Uint64* bucket,
+                           bsls::Types::Uint32* fingerprint);
+
+    /// Clear the oldest generation and make it the current one.
+    void rotate();
+
+    // PRIVATE ACCESSORS
+
+    /// Return the fingerprint at the specified `slot` of the specified
+    /// `generation`.
+    bsls::Types::Uint32 readSlot(const Generation&   generation,
+                                 bsls::Types::Uint64 slot) const;
+
+    /// Load into the specified `bucket` and `fingerprint` the primary
+    /// bucket and the fingerprint of the specified `guid`.
+    void computeHash(bsls::Types::Uint64*     bucket,
+                     bsls::Types::Uint32*     fingerprint,
+                     const bmqt::MessageGUID& guid) const;
+
+    /// Return the alternate bucket of the specified `fingerprint` stored in
+    /// the specified `bucket`.
+    bsls::Types::Uint64 altBucket(bsls::Types::Uint64 bucket,
+                                  bsls::Types::Uint32 fingerprint) const;
+
+    /// Return true if the specified `fingerprint` is in the specified
+    /// `bucket` of the specified `generation`.
+    bool bucketContains(const Generation&   generation,
+                        bsls::Types::Uint64 bucket,
+                        bsls::Types::Uint32 fingerprint) const;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(DeduplicationIndex,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty index remembering at least the last specified
+    /// `capacity` GUIDs, using fingerprints of the specified
+    /// `fingerprintBits` bits, and the specified `allocator` to supply
+    /// memory.  The behavior is undefined unless `0 < capacity` and
+    /// `k_MIN_FINGERPRINT_BITS <= fingerprintBits <= k_MAX_FINGERPRINT_BITS`.
+    DeduplicationIndex(bsls::Types::Int64 capacity,
+                       int                fingerprintBits,
+                       bslma::Allocator*  allocator = 0);
+
+    // MANIPULATORS
+
+    /// Return whether the specified `guid` was inserted in this index, and
+    /// update the statistics accordingly.
+    LookupResult lookup(const bmqt::MessageGUID& guid);
+
+    /// Insert the specified `guid` into this index, forgetting the oldest
+    /// GUIDs if needed.
+    void insert(const bmqt::MessageGUID& guid);
+
+    /// Forget all GUIDs and reset the statistics.
+    void clear();
+
+    // ACCESSORS
+
+    /// Return the number of GUIDs per generation of the filter.
+    bsls::Types::Int64 capacity() const;
+
+    /// Return the size of the fingerprints, in bits.
+    int fingerprintBits() const;
+
+    /// Return the number of GUIDs in the exact tail window.
+    size_t tailSize() const;
+
+    /// Return the number of lookups.
+    bsls::Types::Int64 numLookups() const;
+
+    /// Return the number of lookups which found the GUID in the exact tail
+    /// window.
+    bsls::Types::Int64 numExactHits() const;
+
+    /// Return the number of lookups which found the GUID in the filter only.
+    bsls::Types::Int64 numProbableHits() const;
+
+    /// Return the number of times the oldest generation was cleared.
+    bsls::Types::Int64 numRotations() const;
+
+    /// Return the estimated probability that a lookup of a GUID which was
+    /// never inserted returns `e_PROBABLE`, given the current occupancy of
+    /// the filter.
+    double estimatedFalsePositiveRate() const;
+
+    /// Return the number of bytes used by the filter and the tail window.
+    bsls::Types::Int64 memoryFootprint() const;
+
+    /// Load the statistics of this index into the specified `out`.
+    void loadStats(mqbcmd::DeduplicationStats* out) const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ------------------------
+// class DeduplicationIndex
+// ------------------------
+
+// ACCESSORS
+inline bsls::Types::Int64 DeduplicationIndex::capacity() const
+{
+    return d_capacity;
+}
+
+inline int DeduplicationIndex::fingerprintBits() const
+{
+    return d_fingerprintBits;
+}
+
+inline size_t DeduplicationIndex::tailSize() const
+{
+    return d_tail.size();
+}
+
+inline bsls::Types::Int64 DeduplicationIndex::numLookups() const
+{
+    return d_numLookups;
+}
+
+inline bsls::Types::Int64 DeduplicationIndex::numExactHits() const
+{
+    return d_numExactHits;
+}
+
+inline bsls::Types::Int64 DeduplicationIndex::numProbableHits() const
+{
+    return d_numProbableHits;
+}
+
+inline bsls::Types::Int64 DeduplicationIndex::numRotations() const
+{
+    return d_numRotations;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,251 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_deduplicationindex.t.cpp                                      -*-C++-*-
+#include <mqbs_deduplicationindex.h>
+
+// MQB
+#include <mqbu_messageguidutil.h>
+
+// BMQ
+#include <bmqt_messageguid.h>
+
+// BDE
+#include <bsl_vector.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+namespace {
+
+typedef mqbs::DeduplicationIndex Obj;
+
+/// Load into the specified `guids` the specified `count` new GUIDs.
+void generateGUIDs(bsl::vector<bmqt::MessageGUID>* guids, int count)
+{
+    guids->resize(count);
+    for (int i = 0; i < count; ++i) {
+        mqbu::MessageGUIDUtil::generateGUID(&(*guids)[i]);
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Testing:
+//   Basic functionality of 'mqbs::DeduplicationIndex'.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    Obj obj(1000, 32, s_allocator_p);
+    ASSERT_EQ(obj.capacity(), 1000);
+    ASSERT_EQ(obj.fingerprintBits(), 32);
+    ASSERT_EQ(obj.tailSize(), 0U);
+    ASSERT_EQ(obj.estimatedFalsePositiveRate(), 0.0);
+
+    bsl::vector<bmqt::MessageGUID> guids(s_allocator_p);
+    generateGUIDs(&guids, 2);
+
+    ASSERT_EQ(obj.lookup(guids[0]), Obj::e_NOT_FOUND);
+    obj.insert(guids[0]);
+    ASSERT_EQ(obj.lookup(guids[0]), Obj::e_FOUND);
+    ASSERT_EQ(obj.lookup(guids[1]), Obj::e_NOT_FOUND);
+    ASSERT_EQ(obj.tailSize(), 1U);
+
+    ASSERT_EQ(obj.numLookups(), 3);
+    ASSERT_EQ(obj.numExactHits(), 1);
+    ASSERT_EQ(obj.numProbableHits(), 0);
+    ASSERT_GT(obj.estimatedFalsePositiveRate(), 0.0);
+    ASSERT_GT(obj.memoryFootprint(), 0);
+
+    obj.clear();
+    ASSERT_EQ(obj.lookup(guids[0]), Obj::e_NOT_FOUND);
+    ASSERT_EQ(obj.numLookups(), 1);
+    ASSERT_EQ(obj.tailSize(), 0U);
+}
+
+static void test2_tailAndFilter()
+// ------------------------------------------------------------------------
+// TAIL AND FILTER
+//
+// Concerns:
+//   - The last 'capacity / 16' GUIDs are found exactly, older ones are
+//     found by the filter.
+//   - A cuckoo filter has no false negatives: all of the last 'capacity'
+//     GUIDs are found.
+//
+// Testing:
+//   lookup
+//   insert
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("TAIL AND FILTER");
+
+    const int k_CAPACITY = 10000;
+
+    Obj obj(k_CAPACITY, 16, s_allocator_p);
+
+    bsl::vector<bmqt::MessageGUID> guids(s_allocator_p);
+    generateGUIDs(&guids, 3 * k_CAPACITY);
+
+    for (int i = 0; i < 3 * k_CAPACITY; ++i) {
+        obj.insert(guids[i]);
+    }
+    ASSERT_EQ(obj.tailSize(), static_cast<size_t>(k_CAPACITY / 16));
+    ASSERT_GE(obj.numRotations(), 2);
+
+    for (int i = 3 * k_CAPACITY - k_CAPACITY / 16; i < 3 * k_CAPACITY; ++i) {
+        ASSERT_EQ_D(i, obj.lookup(guids[i]), Obj::e_FOUND);
+    }
+    for (int i = 2 * k_CAPACITY; i < 3 * k_CAPACITY - k_CAPACITY / 16; ++i) {
+        ASSERT_EQ_D(i, obj.lookup(guids[i]), Obj::e_PROBABLE);
+    }
+}
+
+static void test3_boundedMemory()
+// ------------------------------------------------------------------------
+// BOUNDED MEMORY
+//
+// Concerns:
+//   The memory used by the index does not grow with the number of GUIDs
+//   inserted, and the oldest GUIDs are forgotten.
+//
+// Testing:
+//   memoryFootprint
+//   numRotations
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BOUNDED MEMORY");
+
+    const int k_CAPACITY = 1000;
+
+    Obj obj(k_CAPACITY, 16, s_allocator_p);
+
+    bsl::vector<bmqt::MessageGUID> guids(s_allocator_p);
+    generateGUIDs(&guids, 100 * k_CAPACITY);
+
+    for (int i = 0; i < 2 * k_CAPACITY; ++i) {
+        obj.insert(guids[i]);
+    }
+    const bsls::Types::Int64 footprint = obj.memoryFootprint();
+
+    for (int i = 2 * k_CAPACITY; i < 100 * k_CAPACITY; ++i) {
+        obj.insert(guids[i]);
+    }
+    ASSERT_EQ(obj.memoryFootprint(), footprint);
+    ASSERT_GE(obj.numRotations(), 50);
+
+    // The first GUIDs were forgotten, except for false positives.
+    int numFound = 0;
+    for (int i = 0; i < k_CAPACITY; ++i) {
+        if (obj.lookup(guids[i]) != Obj::e_NOT_FOUND) {
+            ++numFound;
+        }
+    }
+    ASSERT_LT(numFound, 10);
+}
+
+static void test4_falsePositiveRate()
+// ------------------------------------------------------------------------
+// FALSE POSITIVE RATE
+//
+// Concerns:
+//   The measured false positive rate is close to the estimated one, and
+//   decreases with the number of fingerprint bits.
+//
+// Testing:
+//   estimatedFalsePositiveRate
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("FALSE POSITIVE RATE");
+
+    const int k_CAPACITY    = 20000;
+    const int k_NUM_LOOKUPS = 200000;
+
+    bsl::vector<bmqt::MessageGUID> inserted(s_allocator_p);
+    bsl::vector<bmqt::MessageGUID> fresh(s_allocator_p);
+    generateGUIDs(&inserted, 2 * k_CAPACITY);
+    generateGUIDs(&fresh, k_NUM_LOOKUPS);
+
+    double previousRate = 1.0;
+    for (int bits = Obj::k_MIN_FINGERPRINT_BITS;
+         bits <= Obj::k_MAX_FINGERPRINT_BITS;
+         bits += 8) {
+        PVV("Fingerprint bits: " << bits);
+
+        Obj obj(k_CAPACITY, bits, s_allocator_p);
+        for (size_t i = 0; i < inserted.size(); ++i) {
+            obj.insert(inserted[i]);
+        }
+
+        for (int i = 0; i < k_NUM_LOOKUPS; ++i) {
+            ASSERT_NE(obj.lookup(fresh[i]), Obj::e_FOUND);
+        }
+
+        const double measured = static_cast<double>(obj.numProbableHits()) /
+                                k_NUM_LOOKUPS;
+        const double estimated = obj.estimatedFalsePositiveRate();
+        PVV("Measured: " << measured << ", estimated: " << estimated);
+
+        ASSERT_LT(estimated, previousRate);
+        if (bits == Obj::k_MIN_FINGERPRINT_BITS) {
+            // Enough false positives to be measured
+            ASSERT_GT(measured, estimated / 2);
+            ASSERT_LT(measured, estimated * 2);
+        }
+        else {
+            ASSERT_LT(measured, estimated * 10 + 1.0 / k_NUM_LOOKUPS * 5);
+        }
+        previousRate = estimated;
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    mqbu::MessageGUIDUtil::initialize();
+
+    switch (_testCase) {
+    case 0:
+    case 4: test4_falsePositiveRate(); break;
+    case 3: test3_boundedMemory(); break;
+    case 2: test2_tailAndFilter(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
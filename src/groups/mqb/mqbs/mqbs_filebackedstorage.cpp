@@ -26,6 +26,7 @@
 // Each GUID represents multiple records in the file store.
 
 // MQB
+#include <mqbcmd_messages.h>
 #include <mqbi_domain.h>
 #include <mqbi_queue.h>
 #include <mqbi_queueengine.h>
@@ -86,6 +87,9 @@ void FileBackedStorage::purgeCommon(const mqbu::StorageKey& appKey)
         }
 
         d_handles.clear();
+        if (d_deduplicationIndex_mp) {
+            d_deduplicationIndex_mp->clear();
+        }
 
         // Update stats
         d_capacityMeter.clear();
@@ -121,16 +125,21 @@ FileBackedStorage::FileBackedStorage(
 , d_capacityMeter("queue [" + queueUri.asString() + "]",
                   parentCapacityMeter,
                   allocator)
-, d_handles(bsls::TimeInterval()
-                .addMilliseconds(config.deduplicationTimeMs())
-                .totalNanoseconds(),
+, d_handles(config.deduplicationCapacity()
+                ? 0
+                : bsls::TimeInterval()
+                      .addMilliseconds(config.deduplicationTimeMs())
+                      .totalNanoseconds(),
             allocatorStore ? allocatorStore->get("Handles") : d_allocator_p)
+, d_deduplicationIndex_mp()
+, d_rejectProbableDuplicates(config.deduplicationRejectProbable())
 , d_queueOpRecordHandles(allocator)
 , d_emptyAppId(allocator)
 , d_nullAppKey()
 , d_isEmpty(1)
 , d_defaultRdaInfo(defaultRdaInfo)
 , d_hasReceipts(!config.consistency().isStrongValue())
+, d_hasDeliveryTime(!config.deliveryTimeProperty().empty())
 {
     BSLS_ASSERT(d_store_p);
 
@@ -149,6 +158,23 @@ FileBackedStorage::FileBackedStorage(
     // instance associated with it (instead of a 'mqbblp::Cluster' instance),
     // and domain instance will return a zero capacity meter when queries to be
     // passed to the 'FileBackedStorage' instance.
+
+    if (config.deduplicationCapacity()) {
+        // The index replaces the history of 'd_handles', whose memory grows
+        // with the PUT rate.
+
+        d_deduplicationIndex_mp.load(new (*d_allocator_p) DeduplicationIndex(
+                                         config.deduplicationCapacity(),
+                                         config.deduplicationFingerprintBits(),
+                                         d_allocator_p),
+                                     d_allocator_p);
+    }
+
+    if (!config.priorityProperty().empty()) {
+        // Deliver messages by priority.
+
+        d_virtualStorageCatalog.enablePriorityOrder();
+    }
 }
 
 FileBackedStorage::~FileBackedStorage()
@@ -298,6 +324,31 @@ FileBackedStorage::put(mqbi::StorageMessageAttributes*     attributes,
             return mqbi::StorageResult::e_DUPLICATE;
         }
 
+        if (d_deduplicationIndex_mp) {
+            // A GUID found in the filter only may be a false positive: unless
+            // configured otherwise, accept the message rather than losing it.
+            // The probable hit is counted by the index either way.
+
+            const DeduplicationIndex::LookupResult result =
+                d_deduplicationIndex_mp->lookup(msgGUID);
+            if (result == DeduplicationIndex::e_FOUND ||
+                (result == DeduplicationIndex::e_PROBABLE &&
+                 d_rejectProbableDuplicates)) {
+                return mqbi::StorageResult::e_DUPLICATE;  // RETURN
+            }
+        }
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                attributes->deliveryTimestamp() >
+                attributes->arrivalTimestamp() +
+                    DataHeader::k_MAX_DELIVERY_DELAY)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            // The delivery delay cannot be recorded in the partition: reject
+            // the message rather than delivering it earlier than requested.
+            return mqbi::StorageResult::e_INVALID_OPERATION;  // RETURN
+        }
+
         // Verify if we have enough capacity.
         mqbu::CapacityMeter::CommitResult capacity =
             d_capacityMeter.commitUnreserved(1, msgSize);
@@ -333,14 +384,34 @@ FileBackedStorage::put(mqbi::StorageMessageAttributes*     attributes,
         irc.first->second.d_array.push_back(handle);
         irc.first->second.d_refCount = attributes->refCount();
 
-        // Looks like extra lookup in
-        // VirtualStorageIterator::loadMessageAndAttributes() can be avoided
-        // if we keep `irc` (like we keep 'DataStoreRecordHandle').
-        d_virtualStorageCatalog.put(msgGUID,
-                                    msgSize,
-                                    d_defaultRdaInfo,
-                                    bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID,
-                                    mqbu::StorageKey::k_NULL_KEY);
+        if (d_deduplicationIndex_mp) {
+            d_deduplicationIndex_mp->insert(msgGUID);
+        }
+
+        if (attributes->deliveryTimestamp()) {
+            // Keep the message out of the virtual storages until its delivery
+            // time.
+
+            d_virtualStorageCatalog.schedule(
+                msgGUID,
+                msgSize,
+                d_defaultRdaInfo,
+                bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID,
+                attributes->priority(),
+                attributes->deliveryTimestamp());
+        }
+        else {
+            // Looks like extra lookup in
+            // VirtualStorageIterator::loadMessageAndAttributes() can be
+            // avoided if we keep `irc` (like we keep 'DataStoreRecordHandle').
+            d_virtualStorageCatalog.put(
+                msgGUID,
+                msgSize,
+                d_defaultRdaInfo,
+                bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID,
+                mqbu::StorageKey::k_NULL_KEY,
+                attributes->priority());
+        }
 
         BSLS_ASSERT_SAFE(d_queue_p);
         d_queue_p->stats()->onEvent(
@@ -363,7 +434,8 @@ FileBackedStorage::put(mqbi::StorageMessageAttributes*     attributes,
                                     msgSize,
                                     d_defaultRdaInfo,
                                     bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID,
-                                    storageKeys[i]);
+                                    storageKeys[i],
+                                    attributes->priority());
     }
 
     // Note that unlike 'InMemoryStorage', we don't add the message to the
@@ -788,12 +860,37 @@ void FileBackedStorage::processMessageRecord(
         irc.first->second.d_array.push_back(handle);
         irc.first->second.d_refCount = refCount;
 
-        // Add 'guid' to all virtual storages, if any.
-        d_virtualStorageCatalog.put(guid,
-                                    msgLen,
-                                    d_defaultRdaInfo,
-                                    bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID,
-                                    mqbu::StorageKey::k_NULL_KEY);
+        if (d_deduplicationIndex_mp) {
+            d_deduplicationIndex_mp->insert(guid);
+        }
+
+        // Add 'guid' to all virtual storages, if any, reading its priority
+        // and its delivery time from the partition if they are needed.  A
+        // message having a delivery time is scheduled instead, so that it
+        // is released when due.
+        mqbi::StorageMessageAttributes attributes;
+        if (d_virtualStorageCatalog.isPriorityOrdered() || d_hasDeliveryTime) {
+            d_store_p->loadMessageAttributesRaw(&attributes, handle);
+        }
+
+        if (attributes.deliveryTimestamp()) {
+            d_virtualStorageCatalog.schedule(
+                guid,
+                msgLen,
+                d_defaultRdaInfo,
+                bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID,
+                attributes.priority(),
+                attributes.deliveryTimestamp());
+        }
+        else {
+            d_virtualStorageCatalog.put(
+                guid,
+                msgLen,
+                d_defaultRdaInfo,
+                bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID,
+                mqbu::StorageKey::k_NULL_KEY,
+                attributes.priority());
+        }
 
         // Update the messages & bytes monitors, and the stats.
         d_capacityMeter.forceCommit(1, msgLen);  // Return value ignored.
@@ -856,6 +953,12 @@ void FileBackedStorage::processConfirmRecord(
     --it->second.d_refCount;  // Update outstanding refCount
 
     if (!appKey.isNull()) {
+        // A message confirmed by a consumer was released by the primary, even
+        // if it is still scheduled at this node (e.g., because the clock of
+        // this node is behind, or because the partition is being recovered),
+        // so release it before confirming it.
+        d_virtualStorageCatalog.release(guid);  // ignore rc
+
         mqbi::StorageResult::Enum rc = d_virtualStorageCatalog.remove(guid,
                                                                       appKey);
         if (mqbi::StorageResult::e_SUCCESS != rc) {
@@ -968,6 +1071,20 @@ void FileBackedStorage::purge(const mqbu::StorageKey& appKey)
     }
 }
 
+int FileBackedStorage::releaseScheduledMessages(
+    bsls::Types::Uint64* nextDeliveryTimestamp,
+    bsls::Types::Uint64  secondsFromEpoch)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(nextDeliveryTimestamp);
+
+    const int numReleased = d_virtualStorageCatalog.releaseDueMessages(
+        secondsFromEpoch);
+    *nextDeliveryTimestamp = d_virtualStorageCatalog.nextDeliveryTimestamp();
+
+    return numReleased;
+}
+
 // -------------------------------
 // class FileBackedStorageIterator
 // -------------------------------
@@ -32,6 +32,7 @@
 #include <mqbconfm_messages.h>
 #include <mqbi_storage.h>
 #include <mqbs_datastore.h>
+#include <mqbs_deduplicationindex.h>
 #include <mqbs_filestoreprotocol.h>
 #include <mqbs_replicatedstorage.h>
 #include <mqbs_virtualstoragecatalog.h>
@@ -170,6 +171,19 @@ class FileBackedStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
     // First handle in this vector *always*
     // points to the message record.
 
+    bslma::ManagedPtr<DeduplicationIndex> d_deduplicationIndex_mp;
+    // Index of the GUIDs of the messages
+    // PUT, used instead of the history of
+    // 'd_handles' to detect duplicate PUTs
+    // if the domain sets a deduplication
+    // capacity, and null otherwise
+
+    bool d_rejectProbableDuplicates;
+    // Whether a PUT whose GUID is found by
+    // 'd_deduplicationIndex_mp' in its
+    // filter only, i.e. probably but not
+    // certainly a duplicate, is rejected
+
     RecordHandles d_queueOpRecordHandles;
     // List of handles to all QueueOpRecord
     // events associated with queue of this
@@ -206,6 +220,12 @@ class FileBackedStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
 
     const bool d_hasReceipts;
 
+    const bool d_hasDeliveryTime;
+    // Whether messages of this storage
+    // may have a delivery time, as
+    // configured by the domain's
+    // 'deliveryTimeProperty'
+
   private:
     // NOT IMPLEMENTED
     FileBackedStorage(const FileBackedStorage&) BSLS_KEYWORD_DELETED;
@@ -333,6 +353,12 @@ class FileBackedStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
     // Load into the specified 'buffer' the list of pairs of appId and
     // appKey for all the virtual storages registered with this instance.
 
+    virtual bool loadDeduplicationStats(mqbcmd::DeduplicationStats* out) const
+        BSLS_KEYWORD_OVERRIDE;
+    // Load into the specified 'out' the statistics of the index used by
+    // this storage to detect duplicate PUTs and return true, or return
+    // false if this storage relies on its time-based history instead.
+
     virtual mqbi::StorageResult::Enum getMessageSize(
         int*                     msgSize,
         const bmqt::MessageGUID& msgGUID) const BSLS_KEYWORD_OVERRIDE;
@@ -476,6 +502,13 @@ class FileBackedStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
     virtual bool
     removeVirtualStorage(const mqbu::StorageKey& appKey) BSLS_KEYWORD_OVERRIDE;
 
+    /// Make the virtual storage identified by the specified `appKey` lazy if
+    /// the specified `isLazy` is true, and materialize it otherwise.  This
+    /// method has no effect if there is no virtual storage with `appKey`.
+    /// Behavior is undefined unless `appKey` is non-null.
+    virtual void setLazy(const mqbu::StorageKey& appKey,
+                         bool isLazy) BSLS_KEYWORD_OVERRIDE;
+
     // MANIPULATORS (for mqbs::ReplicatedStorage)
     virtual void processMessageRecord(const bmqt::MessageGUID&     guid,
                                       unsigned int                 msgLen,
@@ -496,6 +529,11 @@ class FileBackedStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
 
     virtual void purge(const mqbu::StorageKey& appKey) BSLS_KEYWORD_OVERRIDE;
 
+    virtual int
+    releaseScheduledMessages(bsls::Types::Uint64* nextDeliveryTimestamp,
+                             bsls::Types::Uint64  secondsFromEpoch)
+        BSLS_KEYWORD_OVERRIDE;
+
     // ACCESSORS (for mqbs::ReplicatedStorage)
     virtual int partitionId() const BSLS_KEYWORD_OVERRIDE;
 
@@ -655,6 +693,14 @@ FileBackedStorage::removeVirtualStorage(const mqbu::StorageKey& appKey)
     return d_virtualStorageCatalog.removeVirtualStorage(appKey);
 }
 
+inline void FileBackedStorage::setLazy(const mqbu::StorageKey& appKey,
+                                       bool                    isLazy)
+{
+    BSLS_ASSERT_SAFE(!appKey.isNull());
+
+    d_virtualStorageCatalog.setLazy(appKey, isLazy);
+}
+
 // ACCESSORS
 inline const mqbconfm::Storage& FileBackedStorage::config() const
 {
@@ -782,6 +828,17 @@ FileBackedStorage::loadVirtualStorageDetails(AppIdKeyPairs* buffer) const
     return d_virtualStorageCatalog.loadVirtualStorageDetails(buffer);
 }
 
+inline bool FileBackedStorage::loadDeduplicationStats(
+    mqbcmd::DeduplicationStats* out) const
+{
+    if (!d_deduplicationIndex_mp) {
+        return false;  // RETURN
+    }
+
+    d_deduplicationIndex_mp->loadStats(out);
+    return true;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -38,6 +38,7 @@
 #include <mqbs_replicatedstorage.h>
 #include <mqbs_storageutil.h>
 #include <mqbstat_clusterstats.h>
+#include <mqbstat_messagetracer.h>
 #include <mqbu_exit.h>
 
 // BMQ
@@ -76,6 +77,7 @@
 #include <bsl_cstring.h>
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
+#include <bsl_limits.h>
 #include <bsl_map.h>
 #include <bsl_unordered_set.h>
 #include <bsl_utility.h>
@@ -104,6 +106,12 @@ const double k_PARTITION_AVAILABLESPACE_SECS = 20;
 
 const int k_NAGLE_PACKET_COUNT = 100;
 
+/// Maximum interval, in seconds, between two garbage-collections of the
+/// messages and history of a storage.  This bounds the delay for a storage
+/// whose configuration changed (e.g., its TTL was reduced) since it was last
+/// visited, and matches the interval of the periodic GC of the partitions.
+const int k_GC_MAX_INTERVAL_SECONDS = 60;
+
 const int k_KEY_LEN = FileStoreProtocol::k_KEY_LENGTH;
 
 const unsigned int k_REQUESTED_JOURNAL_SPACE =
@@ -3701,6 +3709,61 @@ void FileStore::alarmHighwatermarkIfNeededDispatched()
     }
 }
 
+void FileStore::scheduleGcEvent()
+{
+    // executed by the *DISPATCHER* thread
+
+    if (!d_isOpen) {
+        return;  // RETURN
+    }
+
+    bsls::Types::Int64 dueTime;
+    if (!d_gcSchedule.loadEarliestDueTime(&dueTime) ||
+        d_gcEventTime <= dueTime) {
+        // Nothing to garbage-collect, or the event fires early enough
+        return;  // RETURN
+    }
+
+    // Move the event earlier.  Ok to ignore rc (the event may have fired).
+    d_config.scheduler()->cancelEvent(&d_gcEventHandle);
+
+    bsls::TimeInterval delay;
+    delay.addNanoseconds(
+        bsl::max(dueTime - mwcsys::Time::highResolutionTimer(),
+                 static_cast<bsls::Types::Int64>(0)));
+
+    d_config.scheduler()->scheduleEvent(
+        &d_gcEventHandle,
+        d_config.scheduler()->now() + delay,
+        bdlf::BindUtil::bind(&FileStore::gcEventCb, this));
+    d_gcEventTime = dueTime;
+}
+
+void FileStore::gcEventCb()
+{
+    // executed by the *SCHEDULER* thread
+
+    // This routine is invoked *only* by the scheduled GC event.
+
+    if (!d_isOpen) {
+        return;  // RETURN
+    }
+
+    execute(bdlf::BindUtil::bind(&FileStore::gcEventDispatched, this));
+}
+
+void FileStore::gcEventDispatched()
+{
+    // executed by the *DISPATCHER* thread
+
+    // The event fired: 'flush' schedules it again at the earliest due time of
+    // the remaining storages.  If the event was scheduled again meanwhile,
+    // this only reschedules it.
+    d_gcEventTime = bsl::numeric_limits<bsls::Types::Int64>::max();
+
+    flush();
+}
+
 void FileStore::issueSyncPointDispatched(
     BSLS_ANNOTATION_UNUSED int partitionId)
 {
@@ -3884,6 +3947,11 @@ void FileStore::processReceiptEvent(unsigned int         primaryLeaseId,
         }
         if (++(from->second.d_count) >= d_replicationFactor) {
             from->second.d_handle->second.d_hasReceipt = true;
+
+            mqbstat::MessageTracer::record(
+                mqbstat::MessageTracerStage::e_RECEIPT,
+                from->second.d_guid);
+
             // notify the queue
 
             const mqbu::StorageKey& queueKey  = from->second.d_queueKey;
@@ -4109,6 +4177,15 @@ int FileStore::writeMessageRecord(const bmqp::StorageHeader& header,
                                    msgRec->refCount(),
                                    handle);
 
+    if (dataHeader->deliveryDelay() != 0) {
+        // The message is scheduled: visit the storage when it is due.
+        d_gcSchedule.schedule(msgRec->queueKey(),
+                              mwcsys::Time::highResolutionTimer() +
+                                  dataHeader->deliveryDelay() *
+                                      bdlt::TimeUnitRatio::k_NS_PER_S);
+        scheduleGcEvent();
+    }
+
     activeFileSet->d_outstandingBytesJournal +=
         FileStoreProtocol::k_JOURNAL_RECORD_SIZE;
     activeFileSet->d_outstandingBytesData += messageSize;
@@ -5141,6 +5218,9 @@ FileStore::FileStore(const DataStoreConfig&  config,
 , d_sequenceNum(0)
 , d_syncPoints(allocator)
 , d_storages(allocator)
+, d_gcSchedule(allocator)
+, d_gcEventHandle()
+, d_gcEventTime(bsl::numeric_limits<bsls::Types::Int64>::max())
 , d_isCSLModeEnabled(isCSLModeEnabled)
 , d_isFSMWorkflow(isFSMWorkflow)
 , d_ignoreCrc32c(false)
@@ -5246,6 +5326,8 @@ void FileStore::close(bool flush)
     d_config.scheduler()->cancelEventAndWait(&d_syncPointEventHandle);
     d_config.scheduler()->cancelEventAndWait(
         &d_partitionHighwatermarkEventHandle);
+    d_config.scheduler()->cancelEventAndWait(&d_gcEventHandle);
+    d_gcEventTime = bsl::numeric_limits<bsls::Types::Int64>::max();
     // Ok to ignore rc above
 
     BALL_LOG_INFO << partitionDesc() << "Closing partition. ";
@@ -5332,6 +5414,10 @@ int FileStore::writeMessageRecord(mqbi::StorageMessageAttributes* attributes,
     BSLS_ASSERT_SAFE(!queueKey.isNull());
     BSLS_ASSERT_SAFE(0 < d_fileSets.size());
 
+    mqbstat::MessageTracer::record(
+        mqbstat::MessageTracerStage::e_STORAGE_WRITE,
+        guid);
+
     enum {
         rc_SUCCESS          = 0,
         rc_STOPPING         = -1,
@@ -5339,7 +5425,8 @@ int FileStore::writeMessageRecord(mqbi::StorageMessageAttributes* attributes,
         rc_DATA_FILE_FULL   = -3,
         rc_NOT_PRIMARY      = -4,
         rc_ROLLOVER_FAILURE = -5,
-        rc_PARTITION_FULL   = -6
+        rc_PARTITION_FULL   = -6,
+        rc_INVALID_DELAY    = -7
     };
 
     FileSet* activeFileSet = d_fileSets[0].get();
@@ -5366,6 +5453,17 @@ int FileStore::writeMessageRecord(mqbi::StorageMessageAttributes* attributes,
         return rc_NOT_PRIMARY;  // RETURN
     }
 
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            attributes->deliveryTimestamp() >
+            attributes->arrivalTimestamp() +
+                DataHeader::k_MAX_DELIVERY_DELAY)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // The delivery delay cannot be recorded in the data header, and
+        // delivering the message earlier than requested is not an option.
+        return rc_INVALID_DELAY;  // RETURN
+    }
+
     int optionsSize = 0;
     if (options) {
         optionsSize = options->length();
@@ -5440,6 +5538,29 @@ int FileStore::writeMessageRecord(mqbi::StorageMessageAttributes* attributes,
         .setOptionsWords(optionsSize / bmqp::Protocol::k_WORD_SIZE)
         .setFlags(dhFlags);
     attributes->messagePropertiesInfo().applyTo(dataHeader.get());
+
+    if (attributes->deliveryTimestamp() > attributes->arrivalTimestamp()) {
+        // The delivery time is recorded relative to the arrival timestamp,
+        // which is also the timestamp of the message record.  Load back the
+        // (possibly rounded) recorded value, so that this node releases the
+        // message at the same time as a replica recovering it would.  Note
+        // that delays above 'k_MAX_DELIVERY_DELAY' were rejected above.
+        const bsls::Types::Uint64 delay = attributes->deliveryTimestamp() -
+                                          attributes->arrivalTimestamp();
+        dataHeader->setDeliveryDelay(static_cast<unsigned int>(delay));
+        attributes->setDeliveryTimestamp(attributes->arrivalTimestamp() +
+                                         dataHeader->deliveryDelay());
+
+        // Visit the storage when the message is due.
+        d_gcSchedule.schedule(queueKey,
+                              mwcsys::Time::highResolutionTimer() +
+                                  dataHeader->deliveryDelay() *
+                                      bdlt::TimeUnitRatio::k_NS_PER_S);
+        scheduleGcEvent();
+    }
+    else {
+        attributes->setDeliveryTimestamp(0);
+    }
     dataFilePos += sizeof(DataHeader);
 
     // Append options, if any, to data file.
@@ -5483,6 +5604,7 @@ int FileStore::writeMessageRecord(mqbi::StorageMessageAttributes* attributes,
         .setMessageGUID(guid)
         .setCrc32c(attributes->crc32c())
         .setCompressionAlgorithmType(attributes->compressionAlgorithmType())
+        .setPriority(static_cast<unsigned char>(attributes->priority()))
         .setMagic(RecordHeader::k_MAGIC);
     journalPos += FileStoreProtocol::k_JOURNAL_RECORD_SIZE;
 
@@ -5520,6 +5642,9 @@ int FileStore::writeMessageRecord(mqbi::StorageMessageAttributes* attributes,
                     dataOffset,
                     totalLength);
 
+    mqbstat::MessageTracer::record(mqbstat::MessageTracerStage::e_REPLICATION,
+                                   guid);
+
     // Update outstanding JOURNAL and DATA bytes.
     activeFileSet->d_outstandingBytesJournal +=
         FileStoreProtocol::k_JOURNAL_RECORD_SIZE;
@@ -6542,6 +6667,14 @@ void FileStore::setPrimary(mqbnet::ClusterNode* primaryNode,
         d_config.partitionId(),
         mqbstat::ClusterStats::PrimaryStatus::e_PRIMARY);
 
+    // TTL expiration was not applied while replica: visit all storages at
+    // the next GC tick.
+    const bsls::Types::Int64 now = mwcsys::Time::highResolutionTimer();
+    for (StorageMapIter it = d_storages.begin(); it != d_storages.end();
+         ++it) {
+        d_gcSchedule.schedule(it->first, now);
+    }
+
     // Schedule a sync point issue recurring event every 1 second, starting
     // after 1 second.
     d_config.scheduler()->scheduleRecurringEvent(
@@ -6824,73 +6957,163 @@ void FileStore::dispatcherFlush(bool storage, bool queues)
     }
 }
 
-bool FileStore::gcExpiredMessages(const bdlt::Datetime& currentTimeUtc)
+bool FileStore::gcDueStorages(const bdlt::Datetime& currentTimeUtc)
 {
     if (!d_isOpen) {
         return false;  // RETURN
     }
 
-    if (!d_isPrimary) {
-        return false;  // RETURN
-    }
-
-    BSLS_ASSERT_SAFE(0 < d_fileSets.size());
-    FileSet* activeFileSet = d_fileSets[0].get();
-    BSLS_ASSERT_SAFE(activeFileSet);
+    // TTL expiration only applies at the primary node, while history is
+    // garbage-collected at primary as well as replica nodes.
+    bool gcMessages = false;
+    if (d_isPrimary) {
+        BSLS_ASSERT_SAFE(0 < d_fileSets.size());
+        FileSet* activeFileSet = d_fileSets[0].get();
+        BSLS_ASSERT_SAFE(activeFileSet);
 
-    if (!activeFileSet->d_journalFileAvailable) {
-        return false;  // RETURN
+        gcMessages = activeFileSet->d_journalFileAvailable;
     }
 
-    // Go over each file-backed storage registered with this partition and
-    // indicate it to GC any applicable messages.
-
+    const bsls::Types::Int64  now = mwcsys::Time::highResolutionTimer();
     const bsls::Types::Uint64 currentSecondsFromEpoch =
         static_cast<bsls::Types::Uint64>(
             bdlt::EpochUtil::convertToTimeT64(currentTimeUtc));
-    bool haveMore    = false;
-    bool needToFlush = false;
+    bool             haveMore    = false;
+    bool             needToFlush = false;
+    mqbu::StorageKey queueKey;
+
+    // Only visit the storages which are due, i.e. which may have expired
+    // messages or history: with thousands of queues in a partition, most of
+    // them have nothing to GC at any given time.  Each visited storage is
+    // rescheduled at the earliest time it may have something to GC again,
+    // which is never sooner than the next GC tick (hence the loop
+    // terminates).
+
+    while (d_gcSchedule.popDue(&queueKey, now)) {
+        StorageMapIter it = d_storages.find(queueKey);
+        if (it == d_storages.end()) {
+            continue;  // CONTINUE
+        }
 
-    for (StorageMapIter it = d_storages.begin(); it != d_storages.end();
-         ++it) {
-        ReplicatedStorage*  rs                        = it->second;
-        bsls::Types::Uint64 latestMsgTimestamp        = 0;
-        bsls::Types::Int64  configuredTtlValueSeconds = 0;
-        int numMsgsGc = rs->gcExpiredMessages(&latestMsgTimestamp,
-                                              &configuredTtlValueSeconds,
-                                              currentSecondsFromEpoch);
-        if (numMsgsGc <= 0) {
-            // No messages GC'd or error.
+        ReplicatedStorage* rs = it->second;
 
-            continue;  // CONTINUE
+        bsls::Types::Int64 nextGcDelaySeconds = k_GC_MAX_INTERVAL_SECONDS;
+        bool               storageHaveMore    = false;
+
+        if (gcMessages) {
+            bsls::Types::Uint64 latestMsgTimestamp        = 0;
+            bsls::Types::Int64  configuredTtlValueSeconds = 0;
+            int numMsgsGc = rs->gcExpiredMessages(&latestMsgTimestamp,
+                                                  &configuredTtlValueSeconds,
+                                                  currentSecondsFromEpoch);
+            if (numMsgsGc > 0) {
+                needToFlush = true;
+
+                BALL_LOG_INFO
+                    << partitionDesc() << "For storage for queue ["
+                    << rs->queueUri() << "] and queueKey [" << it->first
+                    << "] configured with TTL value of ["
+                    << configuredTtlValueSeconds
+                    << "] seconds, garbage-collected [" << numMsgsGc
+                    << "] messages due to TTL expiration. "
+                    << "Timestamp (UTC) of the latest encountered message: "
+                    << bdlt::EpochUtil::convertFromTimeT64(latestMsgTimestamp)
+                    << "). Current time (UTC): " << currentTimeUtc
+                    << " (Epoch: " << currentSecondsFromEpoch << ")."
+                    << " Num messages remaining in the storage: "
+                    << rs->numMessages(mqbu::StorageKey::k_NULL_KEY)
+                    << ". Storage type: "
+                    << (rs->isPersistent() ? "persistent." : "in-memory.");
+            }
+
+            if (rs->isEmpty() || latestMsgTimestamp == 0) {
+                // Any future message expires no sooner than TTL from now.
+                nextGcDelaySeconds = bsl::min(nextGcDelaySeconds,
+                                              configuredTtlValueSeconds);
+            }
+            else {
+                // The oldest remaining message expires 'delay' seconds from
+                // now.
+                const bsls::Types::Int64 delay =
+                    configuredTtlValueSeconds + 1 -
+                    static_cast<bsls::Types::Int64>(currentSecondsFromEpoch -
+                                                    latestMsgTimestamp);
+
+                if (numMsgsGc > 0 && delay <= 1) {
+                    // Stopped because of the batch size limitation
+                    storageHaveMore = true;
+                }
+                nextGcDelaySeconds = bsl::min(nextGcDelaySeconds, delay);
+            }
         }
-        else {
-            needToFlush = true;
+
+        if (rs->gcHistory()) {
+            storageHaveMore = true;
         }
 
-        BALL_LOG_INFO << partitionDesc() << "For storage for queue ["
-                      << rs->queueUri() << "] and queueKey [" << it->first
-                      << "] configured with TTL value of ["
-                      << configuredTtlValueSeconds
-                      << "] seconds, garbage-collected [" << numMsgsGc
-                      << "] messages due to TTL expiration. "
-                      << "Timestamp (UTC) of the latest encountered message: "
-                      << bdlt::EpochUtil::convertFromTimeT64(
-                             latestMsgTimestamp)
-                      << "). Current time (UTC): " << currentTimeUtc
-                      << " (Epoch: " << currentSecondsFromEpoch << ")."
-                      << " Num messages remaining in the storage: "
-                      << rs->numMessages(mqbu::StorageKey::k_NULL_KEY)
-                      << ". Storage type: "
-                      << (rs->isPersistent() ? "persistent." : "in-memory.");
-
-        if (!rs->isEmpty() &&
-            (latestMsgTimestamp + configuredTtlValueSeconds) <=
-                currentSecondsFromEpoch) {
-            haveMore = true;
+        {
+            // Release the scheduled messages which are due, and visit this
+            // storage again when the next one is.  Replicas release them as
+            // well, so that their virtual storages stay in sync with the
+            // primary's and can take over delivery after a failover, but only
+            // the primary delivers them.
+            bsls::Types::Uint64 nextDeliveryTimestamp = 0;
+            const int numReleased = rs->releaseScheduledMessages(
+                &nextDeliveryTimestamp,
+                currentSecondsFromEpoch);
+            if (numReleased > 0) {
+                BALL_LOG_INFO << partitionDesc() << "For storage for queue ["
+                              << rs->queueUri() << "] and queueKey ["
+                              << it->first << "], released [" << numReleased
+                              << "] scheduled messages. Current time (UTC): "
+                              << currentTimeUtc << " (Epoch: "
+                              << currentSecondsFromEpoch << ").";
+
+                if (d_isPrimary && rs->queue()) {
+                    rs->queue()->queueEngine()->afterNewMessage(
+                        bmqt::MessageGUID(),
+                        0);
+                }
+            }
+
+            if (nextDeliveryTimestamp != 0) {
+                nextGcDelaySeconds = bsl::min(
+                    nextGcDelaySeconds,
+                    bsl::max(static_cast<bsls::Types::Int64>(
+                                 nextDeliveryTimestamp -
+                                 currentSecondsFromEpoch),
+                             static_cast<bsls::Types::Int64>(1)));
+            }
+        }
+
+        // Messages without quorum Receipts, as well as history, expire after
+        // the deduplication time of the domain.
+        bsls::Types::Int64 nextGcDelay = nextGcDelaySeconds *
+                                         bdlt::TimeUnitRatio::k_NS_PER_S;
+        if (rs->queue()) {
+            const bsls::Types::Int64 deduplicationTimeNs =
+                rs->queue()->domain()->config().deduplicationTimeMs() *
+                bdlt::TimeUnitRatio::k_NANOSECONDS_PER_MILLISECOND;
+            if (deduplicationTimeNs > 0) {
+                nextGcDelay = bsl::min(nextGcDelay, deduplicationTimeNs);
+            }
+        }
+
+        if (storageHaveMore) {
+            haveMore    = true;
+            nextGcDelay = 0;
         }
+
+        d_gcSchedule.schedule(queueKey,
+                              now + bsl::max(nextGcDelay,
+                                             static_cast<bsls::Types::Int64>(
+                                                 1)));
     }
 
+    // Have the next due storage visited on time even if the partition gets
+    // no traffic, so that its scheduled messages are released when due.
+    scheduleGcEvent();
+
     if (needToFlush) {
         // Have to explicitly flush 'd_storageEventBuilder', to make sure
         // deletion records get replicated before queue unassignement.
@@ -6900,21 +7123,11 @@ bool FileStore::gcExpiredMessages(const bdlt::Datetime& currentTimeUtc)
         dispatcherFlush(true, false);
     }
 
-    return haveMore;
-}
+    d_clusterStats_p->onPartitionEvent(
+        mqbstat::ClusterStats::PartitionEventType::e_PARTITION_GC,
+        d_config.partitionId(),
+        mwcsys::Time::highResolutionTimer() - now);
 
-bool FileStore::gcHistory()
-{
-    if (!d_isOpen) {
-        return false;  // RETURN
-    }
-    bool haveMore = false;
-    for (StorageMapIter it = d_storages.begin(); it != d_storages.end();
-         ++it) {
-        if (it->second->gcHistory()) {
-            haveMore = true;
-        }
-    }
     return haveMore;
 }
 
@@ -6976,6 +7189,10 @@ void FileStore::registerStorage(ReplicatedStorage* storage)
     BALL_LOG_INFO << "Registering storage for queue '" << storage->queueUri()
                   << "', queueKey: " << storage->queueKey();
     d_storages[storage->queueKey()] = storage;
+
+    // Visit the storage at the next GC tick
+    d_gcSchedule.schedule(storage->queueKey(),
+                          mwcsys::Time::highResolutionTimer());
 }
 
 void FileStore::unregisterStorage(const ReplicatedStorage* storage)
@@ -6987,6 +7204,8 @@ void FileStore::unregisterStorage(const ReplicatedStorage* storage)
     size_t count = d_storages.erase(storage->queueKey());
     BSLS_ASSERT_SAFE(1 == count);
     static_cast<void>(count);
+
+    d_gcSchedule.remove(storage->queueKey());
 }
 
 void FileStore::cancelTimersAndWait()
@@ -6994,6 +7213,7 @@ void FileStore::cancelTimersAndWait()
     d_config.scheduler()->cancelEventAndWait(&d_syncPointEventHandle);
     d_config.scheduler()->cancelEventAndWait(
         &d_partitionHighwatermarkEventHandle);
+    d_config.scheduler()->cancelEventAndWait(&d_gcEventHandle);
 }
 
 void FileStore::processShutdownEvent()
@@ -7076,17 +7296,16 @@ void FileStore::flush()
         return;  // RETURN
     }
 
-    const bool haveMore        = gcExpiredMessages(bdlt::CurrentTime::utc());
-    const bool haveMoreHistory = gcHistory();
+    const bool haveMore = gcDueStorages(bdlt::CurrentTime::utc());
 
     // This is either Idle or k_GC_MESSAGES_INTERVAL_SECONDS timeout.
-    // 'gcHistory' attempts to iterate all old items. If there are more of them
-    // than the batchSize (1000), it returns 'true'.  In this case, re-enable
-    // flush client to call it again next Idle time.
+    // 'gcDueStorages' attempts to iterate all old items of the due storages.
+    // If there are more of them than the batchSize (1000), it returns 'true'.
+    // In this case, re-enable flush client to call it again next Idle time.
     // If it returns 'false', there is no immediate work.  Wait for the the
-    // next k_GC_MESSAGES_INTERVAL_SECONDS.
+    // next Idle time or k_GC_MESSAGES_INTERVAL_SECONDS.
 
-    if (haveMore || haveMoreHistory) {
+    if (haveMore) {
         // Re-enable 'flush' by empty callback
         dispatcher()->execute(&noOp,
                               this,
@@ -7296,6 +7515,14 @@ void FileStore::loadMessageAttributesRaw(
                                              0,
                                              rec->crc32c(),
                                              record.d_arrivalTimepoint);
+    buffer->setPriority(rec->priority());
+
+    OffsetPtr<const DataHeader> dataHeader(d_fileSets[0]->d_dataFile.block(),
+                                           record.d_messageOffset);
+    if (dataHeader->deliveryDelay() != 0) {
+        buffer->setDeliveryTimestamp(rec->header().timestamp() +
+                                     dataHeader->deliveryDelay());
+    }
 }
 
 void FileStore::loadMessageRaw(bsl::shared_ptr<bdlbb::Blob>*   appData,
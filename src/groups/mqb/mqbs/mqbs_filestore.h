@@ -43,6 +43,7 @@
 #include <mqbs_filestoreprotocol.h>
 #include <mqbs_mappedfiledescriptor.h>
 #include <mqbs_storagecollectionutil.h>
+#include <mqbs_storagegcschedule.h>
 #include <mqbu_storagekey.h>
 
 // BMQ
@@ -209,6 +210,8 @@ class FileStore : public DataStore {
 
     typedef bdlmt::EventScheduler::RecurringEventHandle RecurringEventHandle;
 
+    typedef bdlmt::EventScheduler::EventHandle EventHandle;
+
     typedef DataStoreConfig::QueueKeyInfoMapConstIter QueueKeyInfoMapConstIter;
     typedef DataStoreConfig::QueueKeyInfoMapInsertRc  QueueKeyInfoMapInsertRc;
 
@@ -373,6 +376,23 @@ class FileStore : public DataStore {
     StoragesMap d_storages;
     // Map [QueueKey->ReplicatedStorage*]
 
+    StorageGcSchedule d_gcSchedule;
+    // Next time each storage in
+    // 'd_storages' may have messages or
+    // history to garbage-collect
+
+    EventHandle d_gcEventHandle;
+    // Event garbage-collecting the due
+    // storages (and releasing their due
+    // scheduled messages) at the earliest
+    // due time of 'd_gcSchedule'
+
+    bsls::Types::Int64 d_gcEventTime;
+    // High resolution timer value at
+    // which 'd_gcEventHandle' is
+    // scheduled, or the maximum value if
+    // it is not
+
     bdlmt::Throttle d_alarmSoftLimiter;
     // Throttler for alarming on soft
     // limits of partition files
@@ -540,6 +560,24 @@ class FileStore : public DataStore {
     /// THREAD: This method is called from the partition thread.
     void alarmHighwatermarkIfNeededDispatched();
 
+    /// Schedule the GC event at the earliest due time of `d_gcSchedule`,
+    /// unless it is already scheduled no later than that.
+    ///
+    /// THREAD: This method is called from the partition thread.
+    void scheduleGcEvent();
+
+    /// Callback invoked when the GC event fires, to dispatch the
+    /// garbage-collection of the due storages.
+    ///
+    /// THREAD: This method is called from the scheduler thread.
+    void gcEventCb();
+
+    /// Garbage-collect the due storages, releasing their due scheduled
+    /// messages, as the GC event fired.
+    ///
+    /// THREAD: This method is called from the partition thread.
+    void gcEventDispatched();
+
     /// Issue a sync point.
     ///
     /// THREAD: This method executes in the partition dispatcher thread.
@@ -653,18 +691,16 @@ class FileStore : public DataStore {
                       bsl::shared_ptr<bdlbb::Blob>* options,
                       const DataStoreRecord&        record) const;
 
-    /// Attempt to garbage-collect messages for which TTL has expired where
-    /// the specified `currentTimeUtc` is the current timestamp (UTC).
-    /// Return `true`, if there are expired items unprocessed because of the
-    /// batch size limitation.   Note that this routine is no-op unless at
-    /// the primary node".
-    bool gcExpiredMessages(const bdlt::Datetime& currentTimeUtc);
-
-    /// Delete an history of guids or messages maintained by this data
-    /// store.  Return `true`, if there are expired items unprocessed
-    /// because of the batch size limitation.  Note that this routine is
-    /// invoked at primary as well as replica nodes.
-    bool gcHistory();
+    /// Garbage-collect the messages for which TTL has expired (at the
+    /// primary node only) and the history of the storages which are due
+    /// according to `d_gcSchedule`, where the specified `currentTimeUtc`
+    /// is the current timestamp (UTC), and reschedule each visited storage
+    /// at the earliest time it may have something to garbage-collect
+    /// again.  Return `true`, if there are expired items unprocessed
+    /// because of the batch size limitation.  Schedule the GC event at the
+    /// earliest due time of the remaining storages.  Report the time spent
+    /// to the partition stats.
+    bool gcDueStorages(const bdlt::Datetime& currentTimeUtc);
 
   public:
     // TRAITS
@@ -18,10 +18,12 @@
 
 // MQB
 #include <mqbcfg_messages.h>
+#include <mqbconfm_messages.h>
 #include <mqbi_storage.h>
 #include <mqbmock_dispatcher.h>
 #include <mqbnet_mockcluster.h>
 #include <mqbs_datastore.h>
+#include <mqbs_filebackedstorage.h>
 #include <mqbs_filestoreprotocol.h>
 #include <mqbs_filestoreset.h>
 #include <mqbs_filestoretestutil.h>
@@ -60,8 +62,10 @@
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_threadutil.h>
 #include <bsls_platform.h>
 #include <bsls_systemclocktype.h>
+#include <bsls_timeinterval.h>
 #include <bsls_types.h>
 
 // CONVENIENCE
@@ -744,6 +748,10 @@ struct Tester {
         return true;
     }
 
+    bdlmt::EventScheduler& scheduler() { return d_scheduler; }
+
+    mqbmock::Dispatcher& dispatcher() { return d_dispatcher; }
+
     // ACCESSORS
     mqbs::FileStore& fileStore() const { return *(d_fs_mp); }
 
@@ -935,7 +943,7 @@ static void test2_printTest()
         "= "
         "1 queueKey = 3078787878 fileKey = 0000000000 messageOffsetDwords = 5 "
         "messageGUID = [0-9|A-Z]* crc32c = [0-9]* compressionAlgorithmType = "
-        "NONE ] ]\\n"
+        "NONE priority = 0 ] ]\\n"
 
         "\\[ confirmRecord = \\[ header = \\[ type = CONFIRM flags = 0 "
         "primaryLeaseId = 1 sequenceNumber = 4 timestamp = [0-9]* ] "
@@ -952,7 +960,7 @@ static void test2_printTest()
         "= "
         "8 queueKey = 3778787878 fileKey = 0000000000 messageOffsetDwords = 8 "
         "messageGUID = [0-9|A-Z]* crc32c = [0-9]* compressionAlgorithmType = "
-        "NONE ] ]\\n",
+        "NONE priority = 0 ] ]\\n",
         bdlpcre::RegEx::k_FLAG_MULTILINE);
     BSLS_ASSERT_OPT(expectedOut.isPrepared());
 
@@ -974,6 +982,328 @@ static void test2_printTest()
     fs.close();
 }
 
+static void test3_deliveryDelayLimit()
+// ------------------------------------------------------------------------
+// DELIVERY DELAY LIMIT
+//
+// Concerns:
+//   - A message whose delivery delay cannot be recorded in its data header
+//     is rejected by the partition, and by the storage before its capacity
+//     is updated, instead of being delivered earlier than requested.
+//   - A message whose delivery delay can be recorded is written, and its
+//     delivery time is read back from the partition.
+//
+// Testing:
+//   FileStore::writeMessageRecord
+//   FileBackedStorage::put
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("DELIVERY DELAY LIMIT");
+
+    s_ignoreCheckDefAlloc = true;
+
+    const char k_FILE_STORE_LOCATION[] = "./test-cluster123-3";
+
+    Tester           tester(k_FILE_STORE_LOCATION);
+    mqbs::FileStore& fs = tester.fileStore();
+    BSLS_ASSERT_OPT(fs.open() == 0);
+    fs.setPrimary(tester.node(), 1);
+
+    const bmqt::Uri        uri("bmq://bmq.test.persistent.priority/q3",
+                        s_allocator_p);
+    const mqbu::StorageKey queueKey(mqbu::StorageKey::BinaryRepresentation(),
+                                    "abcde");
+
+    mqbs::DataStoreRecordHandle handle;
+    BSLS_ASSERT_OPT(fs.writeQueueCreationRecord(
+                        &handle,
+                        uri,
+                        queueKey,
+                        AppIdKeyPairs(),
+                        bdlt::EpochUtil::convertToTimeT64(
+                            bdlt::CurrentTime::utc()),
+                        true) == 0);  // isNewQueue
+
+    mqbconfm::Domain config(s_allocator_p);
+    config.deliveryTimeProperty() = "deliveryTime";
+    mqbs::FileBackedStorage storage(&fs,
+                                    uri,
+                                    queueKey,
+                                    config,
+                                    0,  // parentCapacityMeter
+                                    bmqp::RdaInfo(),
+                                    s_allocator_p);
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    bsl::shared_ptr<bdlbb::Blob>   appData;
+    appData.createInplace(s_allocator_p, &bufferFactory, s_allocator_p);
+    bdlbb::BlobUtil::append(appData.get(), "payload", 7);
+
+    const bsls::Types::Uint64 now = bdlt::EpochUtil::convertToTimeT64(
+        bdlt::CurrentTime::utc());
+    const bsls::Types::Uint64 numRecords = fs.numRecords();
+
+    mqbi::StorageMessageAttributes attributes(
+        now,
+        1,
+        bmqp::MessagePropertiesInfo(),
+        bmqt::CompressionAlgorithmType::e_NONE);
+    attributes.setDeliveryTimestamp(now +
+                                    mqbs::DataHeader::k_MAX_DELIVERY_DELAY +
+                                    1);
+
+    PV("Delivery delay above the limit");
+    bmqt::MessageGUID guid;
+    mqbu::MessageGUIDUtil::generateGUID(&guid);
+    ASSERT_NE(fs.writeMessageRecord(&attributes,
+                                    &handle,
+                                    guid,
+                                    appData,
+                                    bsl::shared_ptr<bdlbb::Blob>(),
+                                    queueKey),
+              0);
+    ASSERT_EQ(storage.put(&attributes,
+                          guid,
+                          appData,
+                          bsl::shared_ptr<bdlbb::Blob>()),
+              mqbi::StorageResult::e_INVALID_OPERATION);
+    ASSERT_EQ(fs.numRecords(), numRecords);
+    ASSERT_EQ(storage.numMessages(mqbu::StorageKey::k_NULL_KEY), 0);
+
+    PV("Delivery delay at the limit");
+    attributes.setDeliveryTimestamp(now +
+                                    mqbs::DataHeader::k_MAX_DELIVERY_DELAY);
+    ASSERT_EQ(fs.writeMessageRecord(&attributes,
+                                    &handle,
+                                    guid,
+                                    appData,
+                                    bsl::shared_ptr<bdlbb::Blob>(),
+                                    queueKey),
+              0);
+    ASSERT_EQ(fs.numRecords(), numRecords + 1);
+
+    mqbi::StorageMessageAttributes recorded;
+    fs.loadMessageAttributesRaw(&recorded, handle);
+    ASSERT_EQ(recorded.deliveryTimestamp(),
+              now + mqbs::DataHeader::k_MAX_DELIVERY_DELAY);
+
+    fs.close();
+}
+
+static void test4_replicaConfirmScheduled()
+// ------------------------------------------------------------------------
+// REPLICA CONFIRM SCHEDULED
+//
+// Concerns:
+//   - A replicated message having a delivery time is scheduled at the
+//     replica, out of all virtual storages.
+//   - A replicated CONFIRM of a message still scheduled at the replica
+//     (e.g., because its clock is behind the primary's) releases the
+//     message, and confirms it for its app only.
+//
+// Testing:
+//   FileBackedStorage::processMessageRecord
+//   FileBackedStorage::processConfirmRecord
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("REPLICA CONFIRM SCHEDULED");
+
+    s_ignoreCheckDefAlloc = true;
+
+    const char k_FILE_STORE_LOCATION[] = "./test-cluster123-4";
+
+    Tester           tester(k_FILE_STORE_LOCATION);
+    mqbs::FileStore& fs = tester.fileStore();
+    BSLS_ASSERT_OPT(fs.open() == 0);
+
+    // Records are written through the partition as the primary would, and
+    // applied to the storage as a replica would.
+    fs.setPrimary(tester.node(), 1);
+
+    const bmqt::Uri        uri("bmq://bmq.test.persistent.fanout/q4",
+                        s_allocator_p);
+    const mqbu::StorageKey queueKey(mqbu::StorageKey::BinaryRepresentation(),
+                                    "abcde");
+    const mqbu::StorageKey appKey1(mqbu::StorageKey::BinaryRepresentation(),
+                                   "app01");
+    const mqbu::StorageKey appKey2(mqbu::StorageKey::BinaryRepresentation(),
+                                   "app02");
+
+    const bsls::Types::Uint64 now = bdlt::EpochUtil::convertToTimeT64(
+        bdlt::CurrentTime::utc());
+
+    mqbs::DataStoreRecordHandle handle;
+    BSLS_ASSERT_OPT(fs.writeQueueCreationRecord(&handle,
+                                                uri,
+                                                queueKey,
+                                                AppIdKeyPairs(),
+                                                now,
+                                                true) == 0);  // isNewQueue
+
+    mqbconfm::Domain config(s_allocator_p);
+    config.deliveryTimeProperty() = "deliveryTime";
+    mqbs::FileBackedStorage storage(&fs,
+                                    uri,
+                                    queueKey,
+                                    config,
+                                    0,  // parentCapacityMeter
+                                    bmqp::RdaInfo(),
+                                    s_allocator_p);
+
+    mwcu::MemOutStream errorDescription(s_allocator_p);
+    ASSERT_EQ(storage.addVirtualStorage(errorDescription, "app1", appKey1),
+              0);
+    ASSERT_EQ(storage.addVirtualStorage(errorDescription, "app2", appKey2),
+              0);
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    bsl::shared_ptr<bdlbb::Blob>   appData;
+    appData.createInplace(s_allocator_p, &bufferFactory, s_allocator_p);
+    bdlbb::BlobUtil::append(appData.get(), "payload", 7);
+
+    // A message to be delivered in one hour
+    mqbi::StorageMessageAttributes attributes(
+        now,
+        2,
+        bmqp::MessagePropertiesInfo(),
+        bmqt::CompressionAlgorithmType::e_NONE);
+    attributes.setDeliveryTimestamp(now + 3600);
+
+    bmqt::MessageGUID guid;
+    mqbu::MessageGUIDUtil::generateGUID(&guid);
+    ASSERT_EQ(fs.writeMessageRecord(&attributes,
+                                    &handle,
+                                    guid,
+                                    appData,
+                                    bsl::shared_ptr<bdlbb::Blob>(),
+                                    queueKey),
+              0);
+
+    storage.processMessageRecord(guid, appData->length(), 2, handle);
+
+    ASSERT_EQ(storage.numMessages(mqbu::StorageKey::k_NULL_KEY), 1);
+    ASSERT_EQ(storage.numMessages(appKey1), 0);
+    ASSERT_EQ(storage.numMessages(appKey2), 0);
+    ASSERT(storage.hasMessage(guid));
+
+    // The message was released and confirmed by 'app1' at the primary.
+    mqbs::DataStoreRecordHandle confirmHandle;
+    ASSERT_EQ(fs.writeConfirmRecord(&confirmHandle,
+                                    guid,
+                                    queueKey,
+                                    appKey1,
+                                    now,
+                                    false),  // onReject
+              0);
+
+    storage.processConfirmRecord(guid, appKey1, confirmHandle);
+
+    ASSERT_EQ(storage.numMessages(mqbu::StorageKey::k_NULL_KEY), 1);
+    ASSERT_EQ(storage.numMessages(appKey1), 0);
+    ASSERT_EQ(storage.numMessages(appKey2), 1);
+
+    fs.close();
+}
+
+static void test5_releaseScheduledWithoutTraffic()
+// ------------------------------------------------------------------------
+// RELEASE SCHEDULED WITHOUT TRAFFIC
+//
+// Concerns:
+//   - A scheduled message is released within about one second of its
+//     delivery time by the GC event of the partition, even though the
+//     partition gets no other traffic (hence is not flushed otherwise).
+//
+// Testing:
+//   FileStore::writeMessageRecord
+//   FileStore::flush
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("RELEASE SCHEDULED WITHOUT TRAFFIC");
+
+    s_ignoreCheckDefAlloc = true;
+
+    const char                k_FILE_STORE_LOCATION[] = "./test-cluster123-5";
+    const bsls::Types::Uint64 k_DELAY = 2;  // seconds
+
+    Tester           tester(k_FILE_STORE_LOCATION);
+    mqbs::FileStore& fs = tester.fileStore();
+    BSLS_ASSERT_OPT(fs.open() == 0);
+    fs.setPrimary(tester.node(), 1);
+
+    // The GC event is dispatched, hence executed, in the scheduler thread.
+    tester.dispatcher()._setInDispatcherThread(true);
+
+    const bmqt::Uri        uri("bmq://bmq.test.persistent.priority/q5",
+                        s_allocator_p);
+    const mqbu::StorageKey queueKey(mqbu::StorageKey::BinaryRepresentation(),
+                                    "abcde");
+    const mqbu::StorageKey appKey(mqbu::StorageKey::BinaryRepresentation(),
+                                  "app01");
+
+    const bsls::Types::Uint64 now = bdlt::EpochUtil::convertToTimeT64(
+        bdlt::CurrentTime::utc());
+
+    mqbs::DataStoreRecordHandle handle;
+    BSLS_ASSERT_OPT(fs.writeQueueCreationRecord(&handle,
+                                                uri,
+                                                queueKey,
+                                                AppIdKeyPairs(),
+                                                now,
+                                                true) == 0);  // isNewQueue
+
+    mqbconfm::Domain config(s_allocator_p);
+    config.deliveryTimeProperty() = "deliveryTime";
+    config.messageTtl()           = 3600;
+    mqbs::FileBackedStorage storage(&fs,
+                                    uri,
+                                    queueKey,
+                                    config,
+                                    0,  // parentCapacityMeter
+                                    bmqp::RdaInfo(),
+                                    s_allocator_p);
+
+    mwcu::MemOutStream errorDescription(s_allocator_p);
+    ASSERT_EQ(storage.addVirtualStorage(errorDescription, "app1", appKey),
+              0);
+    fs.registerStorage(&storage);
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    bsl::shared_ptr<bdlbb::Blob>   appData;
+    appData.createInplace(s_allocator_p, &bufferFactory, s_allocator_p);
+    bdlbb::BlobUtil::append(appData.get(), "payload", 7);
+
+    mqbi::StorageMessageAttributes attributes(
+        now,
+        1,
+        bmqp::MessagePropertiesInfo(),
+        bmqt::CompressionAlgorithmType::e_NONE);
+    attributes.setDeliveryTimestamp(now + k_DELAY);
+
+    bmqt::MessageGUID guid;
+    mqbu::MessageGUIDUtil::generateGUID(&guid);
+    ASSERT_EQ(storage.put(&attributes,
+                          guid,
+                          appData,
+                          bsl::shared_ptr<bdlbb::Blob>()),
+              mqbi::StorageResult::e_SUCCESS);
+    ASSERT_EQ(storage.numMessages(appKey), 0);
+
+    // Let the GC event fire, and check the message was released at most one
+    // second (and a margin) after its delivery time.  Nothing else touches
+    // the partition meanwhile.
+    BSLS_ASSERT_OPT(tester.scheduler().start() == 0);
+    bslmt::ThreadUtil::sleepUntil(
+        bsls::TimeInterval(static_cast<bsls::Types::Int64>(now + k_DELAY + 1),
+                           500 * 1000 * 1000));
+    tester.scheduler().stop();
+
+    ASSERT_EQ(storage.numMessages(appKey), 1);
+
+    fs.unregisterStorage(&storage);
+    fs.close();
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -990,6 +1320,9 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 5: test5_releaseScheduledWithoutTraffic(); break;
+    case 4: test4_replicaConfirmScheduled(); break;
+    case 3: test3_deliveryDelayLimit(); break;
     case 2: test2_printTest(); break;
     case 1: test1_breathingTest(); break;
     default: {
@@ -324,6 +324,8 @@ const int DataHeader::k_FLAGS_MASK = bdlb::BitMaskUtil::one(
     DataHeader::k_FLAGS_START_IDX,
     DataHeader::k_FLAGS_NUM_BITS);
 
+const unsigned int DataHeader::k_MAX_DELIVERY_DELAY;
+
 // ------------------------
 // struct QueueRecordHeader
 // ------------------------
@@ -428,6 +430,7 @@ MessageRecord::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     printer.printAttribute("crc32c", crc32c());
     printer.printAttribute("compressionAlgorithmType",
                            compressionAlgorithmType());
+    printer.printAttribute("priority", static_cast<int>(priority()));
     printer.end();
 
     return stream;
@@ -691,7 +691,7 @@ struct DataHeader {
     //   +---------------+---------------+---------------+---------------+
     //   |                 OptionsWords                  |    Flags      |
     //   +---------------+---------------+---------------+---------------+
-    //   |           SchemaId            |           Reserved            |
+    //   |           SchemaId            |         DeliveryDelay         |
     //   +---------------+---------------+---------------+---------------+
     //      HW..: HeaderWords
     //
@@ -701,7 +701,15 @@ struct DataHeader {
     //                      data payload, and padding
     //  OptionsWords......: Total size (in words) of the options area
     //  Flags.............: Flags; see DataHeaderFlags struct.
+    //  DeliveryDelay.....: Delay, relative to the timestamp of the message
+    //                      record, before which the message must not be
+    //                      delivered: in seconds if the most significant bit
+    //                      is clear, and in minutes (the 15 other bits)
+    //                      otherwise.  Zero means no delay.
     //..
+    //
+    // Note that the 'DeliveryDelay' field was previously reserved and always
+    // zero, so that messages written by older brokers have no delay.
 
   public:
     // CONSTANTS
@@ -710,6 +718,12 @@ struct DataHeader {
     /// Minimum size (bytes) of a `DataHeader` that contains SchemaId.
     static const int k_MIN_HEADER_SIZE_FOR_SCHEMA_ID = 12;
 
+    /// Minimum size (bytes) of a `DataHeader` that contains DeliveryDelay.
+    static const int k_MIN_HEADER_SIZE_FOR_DELIVERY_DELAY = 12;
+
+    /// Maximum delivery delay (seconds) which can be represented.
+    static const unsigned int k_MAX_DELIVERY_DELAY = 0x7FFF * 60;
+
     // PUBLIC TYPES
     typedef struct DataHeaderFlags    Flags;
     typedef struct DataHeaderFlagUtil FlagUtil;
@@ -734,6 +748,11 @@ struct DataHeader {
     static const int k_OPTIONS_WORDS_MASK;
     static const int k_FLAGS_MASK;
 
+    /// Largest delivery delay represented in seconds, and bit indicating
+    /// a delivery delay represented in minutes.
+    static const unsigned short k_DELIVERY_DELAY_SECONDS_MAX = 0x7FFF;
+    static const unsigned short k_DELIVERY_DELAY_MINUTES_BIT = 0x8000;
+
   private:
     // DATA
     bdlb::BigEndianUint32 d_headerWordsAndMessageWords;
@@ -742,8 +761,8 @@ struct DataHeader {
 
     bmqp::SchemaWireId d_schemaId;
 
-    unsigned char d_reserved[2];
-    // Reserved.
+    bdlb::BigEndianUint16 d_deliveryDelay;
+
   public:
     // CREATORS
 
@@ -762,6 +781,11 @@ struct DataHeader {
 
     DataHeader& setFlags(int value);
 
+    /// Set the delivery delay to the specified `value`, in seconds, rounded
+    /// up to the minute if greater than 32767 seconds.  The behavior is
+    /// undefined unless `value <= k_MAX_DELIVERY_DELAY`.
+    DataHeader& setDeliveryDelay(unsigned int value);
+
     bmqp::SchemaWireId& schemaId();
 
     // ACCESSORS
@@ -773,6 +797,10 @@ struct DataHeader {
 
     int flags() const;
 
+    /// Return the delivery delay, in seconds, or zero if this header is too
+    /// small to contain it.
+    unsigned int deliveryDelay() const;
+
     const bmqp::SchemaWireId& schemaId() const;
 };
 
@@ -1120,7 +1148,7 @@ struct MessageRecord {
     //   +---------------+---------------+---------------+---------------+
     //   |                             Header                            |
     //   +---------------+---------------+---------------+---------------+
-    //   |           Reserved      | CAT |          QueueKey             |
+    //   |    Priority   |Reserved | CAT |          QueueKey             |
     //   +---------------+---------------+---------------+---------------+
     //   |                  QueueKey                     |    FileKey    |
     //   +---------------+---------------+---------------+---------------+
@@ -1142,6 +1170,8 @@ struct MessageRecord {
     //   +---------------+---------------+---------------+---------------+
     //
     //  Header................: Record header
+    //  Priority..............: Delivery priority of the message (0 if the
+    //                          queue is not prioritized)
     //  CAT...................: Compression Algorithm Type
     //  QueueKey..............: Queue key to which this message record belongs
     //  FileKey...............: File key of the corresponding data file
@@ -1154,6 +1184,9 @@ struct MessageRecord {
     //
     // Note that reference count of the message is stored in the 'flags' field
     // of 'RecordHeader'.
+    //
+    // Note that the 'Priority' byte was previously reserved and always zero,
+    // so that records written by older brokers read as having priority 0.
 
   private:
     // PRIVATE CONSTANTS
@@ -1163,7 +1196,7 @@ struct MessageRecord {
     // DATA
     RecordHeader d_header;
 
-    char d_reserved;
+    unsigned char d_priority;
 
     char d_reservedAndCAT;
 
@@ -1205,6 +1238,8 @@ struct MessageRecord {
 
     MessageRecord& setMagic(unsigned int value);
 
+    MessageRecord& setPriority(unsigned char value);
+
     // ACCESSORS
     const RecordHeader& header() const;
 
@@ -1212,6 +1247,8 @@ struct MessageRecord {
 
     bmqt::CompressionAlgorithmType::Enum compressionAlgorithmType() const;
 
+    unsigned char priority() const;
+
     const mqbu::StorageKey& queueKey() const;
 
     const mqbu::StorageKey& fileKey() const;
@@ -2345,8 +2382,6 @@ inline DataHeader::DataHeader()
     const size_t size = sizeof(DataHeader) / bmqp::Protocol::k_WORD_SIZE;
     setHeaderWords(size);
     setMessageWords(size);
-
-    (void)d_reserved;
 }
 
 // MANIPULATORS
@@ -2393,6 +2428,22 @@ inline DataHeader& DataHeader::setFlags(int value)
     return *this;
 }
 
+inline DataHeader& DataHeader::setDeliveryDelay(unsigned int value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(value <= k_MAX_DELIVERY_DELAY);
+
+    if (value <= k_DELIVERY_DELAY_SECONDS_MAX) {
+        d_deliveryDelay = static_cast<unsigned short>(value);
+    }
+    else {
+        d_deliveryDelay = static_cast<unsigned short>(
+            k_DELIVERY_DELAY_MINUTES_BIT | ((value + 59) / 60));
+    }
+
+    return *this;
+}
+
 inline bmqp::SchemaWireId& DataHeader::schemaId()
 {
     return d_schemaId;
@@ -2421,6 +2472,21 @@ inline int DataHeader::flags() const
     return d_optionsWordsAndFlags & k_FLAGS_MASK;
 }
 
+inline unsigned int DataHeader::deliveryDelay() const
+{
+    if (headerWords() * bmqp::Protocol::k_WORD_SIZE <
+        k_MIN_HEADER_SIZE_FOR_DELIVERY_DELAY) {
+        return 0;  // RETURN
+    }
+
+    const unsigned short value = d_deliveryDelay;
+    if (value & k_DELIVERY_DELAY_MINUTES_BIT) {
+        return (value & k_DELIVERY_DELAY_SECONDS_MAX) * 60;  // RETURN
+    }
+
+    return value;
+}
+
 inline const bmqp::SchemaWireId& DataHeader::schemaId() const
 {
     return d_schemaId;
@@ -2614,7 +2680,6 @@ inline MessageRecord::MessageRecord()
     d_header.setType(RecordType::e_MESSAGE);
     setQueueKey(mqbu::StorageKey::k_NULL_KEY);
     setFileKey(mqbu::StorageKey::k_NULL_KEY);
-    static_cast<void>(d_reserved);
 }
 
 // MANIPULATORS
@@ -2682,6 +2747,12 @@ inline MessageRecord& MessageRecord::setMagic(unsigned int value)
     return *this;
 }
 
+inline MessageRecord& MessageRecord::setPriority(unsigned char value)
+{
+    d_priority = value;
+    return *this;
+}
+
 // ACCESSORS
 inline const RecordHeader& MessageRecord::header() const
 {
@@ -2730,6 +2801,11 @@ inline unsigned int MessageRecord::magic() const
     return d_magic;
 }
 
+inline unsigned char MessageRecord::priority() const
+{
+    return d_priority;
+}
+
 // --------------------
 // struct ConfirmRecord
 // --------------------
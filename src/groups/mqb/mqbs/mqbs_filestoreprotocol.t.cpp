@@ -190,6 +190,7 @@ static void test1_breathingTest()
         ASSERT_EQ(dh.messageWords(), numWords);
         ASSERT_EQ(dh.optionsWords(), 0);
         ASSERT_EQ(dh.flags(), 0);
+        ASSERT_EQ(dh.deliveryDelay(), 0U);
 
         // Create DataHeader, set fields, assert fields
         DataHeader dh2;
@@ -202,6 +203,18 @@ static void test1_breathingTest()
         ASSERT_EQ(dh2.messageWords(), 123);
         ASSERT_EQ(dh2.optionsWords(), 42);
         ASSERT_EQ(dh2.flags(), 29);
+
+        // Delivery delay, in seconds then rounded up to the minute
+        dh2.setDeliveryDelay(32767);
+        ASSERT_EQ(dh2.deliveryDelay(), 32767U);
+        dh2.setDeliveryDelay(32768);
+        ASSERT_EQ(dh2.deliveryDelay(), 32820U);
+        dh2.setDeliveryDelay(DataHeader::k_MAX_DELIVERY_DELAY);
+        ASSERT_EQ(dh2.deliveryDelay(), DataHeader::k_MAX_DELIVERY_DELAY);
+
+        // Headers without the field have no delay
+        dh2.setHeaderWords(1);
+        ASSERT_EQ(dh2.deliveryDelay(), 0U);
     }
 
     {
@@ -283,6 +296,7 @@ static void test1_breathingTest()
         ASSERT_EQ(fh.compressionAlgorithmType(),
                   bmqt::CompressionAlgorithmType::e_NONE);
         ASSERT_EQ(fh.magic(), 0U);
+        ASSERT_EQ(fh.priority(), 0);
 
         // Create MessageRecord, set fields, assert fields
         MessageRecord fh2;
@@ -298,7 +312,8 @@ static void test1_breathingTest()
             .setCrc32c(987654321)
             .setCompressionAlgorithmType(
                 bmqt::CompressionAlgorithmType::e_ZLIB)
-            .setMagic(0xdeadbeef);
+            .setMagic(0xdeadbeef)
+            .setPriority(9);
         ASSERT_EQ(fh2.refCount(), 1000U);
         ASSERT(fh2.queueKey() ==
                mqbu::StorageKey(mqbu::StorageKey::BinaryRepresentation(),
@@ -312,6 +327,7 @@ static void test1_breathingTest()
         ASSERT_EQ(fh2.compressionAlgorithmType(),
                   bmqt::CompressionAlgorithmType::e_ZLIB);
         ASSERT_EQ(fh2.magic(), 0xdeadbeef);
+        ASSERT_EQ(fh2.priority(), 9);
     }
 
     {
@@ -613,14 +629,15 @@ static void test3_printTest()
             .setMessageGUID(bmqt::MessageGUID())
             .setCrc32c(2333)
             .setCompressionAlgorithmType(
-                bmqt::CompressionAlgorithmType::e_ZLIB);
+                bmqt::CompressionAlgorithmType::e_ZLIB)
+            .setPriority(7);
 
         const char* const k_EXPECTED_OUTPUT =
             "[ header = [ type = MESSAGE flags = 2 primaryLeaseId = 8 "
             "sequenceNumber = 33 timestamp = 123456 ] refCount = 2 queueKey = "
             "DEADFACE13 fileKey = DEADBEEF01 messageOffsetDwords = 123 "
             "messageGUID = ** UNSET ** crc32c = 2333 compressionAlgorithmType "
-            "= ZLIB ]";
+            "= ZLIB priority = 7 ]";
 
         mwcu::MemOutStream stream(s_allocator_p);
         stream << msgRec;
@@ -18,6 +18,7 @@
 
 #include <mqbscm_version.h>
 // MQB
+#include <mqbcmd_messages.h>
 #include <mqbi_queue.h>
 #include <mqbi_queueengine.h>
 #include <mqbstat_queuestats.h>
@@ -66,10 +67,14 @@ InMemoryStorage::InMemoryStorage(const bmqt::Uri&        uri,
 , d_capacityMeter("queue [" + uri.asString() + "]",
                   parentCapacityMeter,
                   allocator)
-, d_items(bsls::TimeInterval()
-              .addMilliseconds(config.deduplicationTimeMs())
-              .totalNanoseconds(),
+, d_items(config.deduplicationCapacity()
+              ? 0
+              : bsls::TimeInterval()
+                    .addMilliseconds(config.deduplicationTimeMs())
+                    .totalNanoseconds(),
           allocatorStore ? allocatorStore->get("Handles") : d_allocator_p)
+, d_deduplicationIndex_mp()
+, d_rejectProbableDuplicates(config.deduplicationRejectProbable())
 , d_virtualStorageCatalog(
       this,
       allocatorStore ? allocatorStore->get("VirtualHandles") : d_allocator_p)
@@ -80,6 +85,21 @@ InMemoryStorage::InMemoryStorage(const bmqt::Uri&        uri,
 , d_defaultRdaInfo(defaultRdaInfo)
 {
     BSLS_ASSERT_SAFE(0 <= d_ttlSeconds);  // Broadcast queues can use 0 for TTL
+
+    if (config.deduplicationCapacity()) {
+        // The index replaces the history of 'd_items', whose memory grows
+        // with the PUT rate.
+
+        d_deduplicationIndex_mp.load(new (*d_allocator_p) DeduplicationIndex(
+                                         config.deduplicationCapacity(),
+                                         config.deduplicationFingerprintBits(),
+                                         d_allocator_p),
+                                     d_allocator_p);
+    }
+
+    if (!config.priorityProperty().empty()) {
+        d_virtualStorageCatalog.enablePriorityOrder();
+    }
 }
 
 InMemoryStorage::~InMemoryStorage()
@@ -186,6 +206,20 @@ InMemoryStorage::put(mqbi::StorageMessageAttributes*     attributes,
             return mqbi::StorageResult::e_DUPLICATE;
         }
 
+        if (d_deduplicationIndex_mp) {
+            // A GUID found in the filter only may be a false positive: unless
+            // configured otherwise, accept the message rather than losing it.
+            // The probable hit is counted by the index either way.
+
+            const DeduplicationIndex::LookupResult result =
+                d_deduplicationIndex_mp->lookup(msgGUID);
+            if (result == DeduplicationIndex::e_FOUND ||
+                (result == DeduplicationIndex::e_PROBABLE &&
+                 d_rejectProbableDuplicates)) {
+                return mqbi::StorageResult::e_DUPLICATE;  // RETURN
+            }
+        }
+
         // Verify if we have enough capacity.
         mqbu::CapacityMeter::CommitResult capacity =
             d_capacityMeter.commitUnreserved(1, msgSize);
@@ -199,15 +233,23 @@ InMemoryStorage::put(mqbi::StorageMessageAttributes*     attributes,
                         : mqbi::StorageResult::e_LIMIT_BYTES);  // RETURN
         }
 
+        // Scheduled delivery is not supported: deliver the message now.
+        attributes->setDeliveryTimestamp(0);
+
         d_items.insert(bsl::make_pair(msgGUID,
                                       Item(appData, options, *attributes)),
                        attributes->arrivalTimepoint());
 
+        if (d_deduplicationIndex_mp) {
+            d_deduplicationIndex_mp->insert(msgGUID);
+        }
+
         d_virtualStorageCatalog.put(msgGUID,
                                     msgSize,
                                     d_defaultRdaInfo,
                                     bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID,
-                                    mqbu::StorageKey::k_NULL_KEY);
+                                    mqbu::StorageKey::k_NULL_KEY,
+                                    attributes->priority());
 
         if (d_queue_p) {
             d_queue_p->stats()->onEvent(
@@ -231,7 +273,8 @@ InMemoryStorage::put(mqbi::StorageMessageAttributes*     attributes,
                                     msgSize,
                                     d_defaultRdaInfo,
                                     bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID,
-                                    storageKeys[i]);
+                                    storageKeys[i],
+                                    attributes->priority());
     }
 
     // If the guid also exists in the 'physical' storage, bump up its reference
@@ -331,6 +374,9 @@ InMemoryStorage::removeAll(const mqbu::StorageKey& appKey)
 
         d_virtualStorageCatalog.removeAll(mqbu::StorageKey::k_NULL_KEY);
         d_items.clear();
+        if (d_deduplicationIndex_mp) {
+            d_deduplicationIndex_mp->clear();
+        }
         d_capacityMeter.clear();
 
         if (d_queue_p) {
@@ -572,6 +618,19 @@ void InMemoryStorage::purge(
     BSLS_ASSERT_OPT(false && "Invalid operation on in-memory storage");
 }
 
+int InMemoryStorage::releaseScheduledMessages(
+    bsls::Types::Uint64*                       nextDeliveryTimestamp,
+    BSLS_ANNOTATION_UNUSED bsls::Types::Uint64 secondsFromEpoch)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(nextDeliveryTimestamp);
+
+    // Scheduled delivery is only supported by persistent storages.
+
+    *nextDeliveryTimestamp = 0;
+    return 0;
+}
+
 // ACCESSORS (for mqbs::ReplicatedStorage)
 const ReplicatedStorage::RecordHandles&
 InMemoryStorage::queueOpRecordHandles() const
@@ -28,11 +28,17 @@
 // memory.  'mqbs::InMemoryStorageIterator' provides an iterator implementation
 // of 'mqbi::StorageIterator' protocol and can be used to iterate over messages
 // stored in the in-memory storage.
+//
+// Note that scheduled delivery is not supported by the in-memory storage: the
+// delivery time of a message, if any, is ignored and the message is delivered
+// as soon as it arrives.  'mqbblp::Domain' ignores the 'deliveryTimeProperty'
+// of a domain configured with an in-memory storage, raising an alarm.
 
 // MQB
 
 #include <mqbconfm_messages.h>
 #include <mqbi_storage.h>
+#include <mqbs_deduplicationindex.h>
 #include <mqbs_replicatedstorage.h>
 #include <mqbs_virtualstoragecatalog.h>
 #include <mqbu_capacitymeter.h>
@@ -184,6 +190,19 @@ class InMemoryStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
 
     ItemsMap d_items;
 
+    bslma::ManagedPtr<DeduplicationIndex> d_deduplicationIndex_mp;
+    // Index of the GUIDs of the messages
+    // PUT, used instead of the history of
+    // 'd_items' to detect duplicate PUTs
+    // if the domain sets a deduplication
+    // capacity, and null otherwise
+
+    bool d_rejectProbableDuplicates;
+    // Whether a PUT whose GUID is found by
+    // 'd_deduplicationIndex_mp' in its
+    // filter only, i.e. probably but not
+    // certainly a duplicate, is rejected
+
     VirtualStorageCatalog d_virtualStorageCatalog;
 
     RecordHandles d_queueOpRecordHandles;
@@ -386,6 +405,13 @@ class InMemoryStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
     virtual bool
     removeVirtualStorage(const mqbu::StorageKey& appKey) BSLS_KEYWORD_OVERRIDE;
 
+    /// Make the virtual storage identified by the specified `appKey` lazy if
+    /// the specified `isLazy` is true, and materialize it otherwise.  This
+    /// method has no effect if there is no virtual storage with `appKey`.
+    /// Behavior is undefined unless `appKey` is non-null.
+    virtual void setLazy(const mqbu::StorageKey& appKey,
+                         bool isLazy) BSLS_KEYWORD_OVERRIDE;
+
     // ACCESSORS
     //   (virtual mqbi::Storage)
 
@@ -490,6 +516,12 @@ class InMemoryStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
     // Load into the specified 'buffer' the list of pairs of appId and
     // appKey for all the virtual storages registered with this instance.
 
+    virtual bool loadDeduplicationStats(mqbcmd::DeduplicationStats* out) const
+        BSLS_KEYWORD_OVERRIDE;
+    // Load into the specified 'out' the statistics of the index used by
+    // this storage to detect duplicate PUTs and return true, or return
+    // false if this storage relies on its time-based history instead.
+
     // MANIPULATORS
     //   (virtual mqbs::ReplicatedStorage)
     virtual void processMessageRecord(const bmqt::MessageGUID&     guid,
@@ -511,6 +543,11 @@ class InMemoryStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
 
     virtual void purge(const mqbu::StorageKey& appKey) BSLS_KEYWORD_OVERRIDE;
 
+    virtual int
+    releaseScheduledMessages(bsls::Types::Uint64* nextDeliveryTimestamp,
+                             bsls::Types::Uint64  secondsFromEpoch)
+        BSLS_KEYWORD_OVERRIDE;
+
     // ACCESSORS
     //   (virtual mqbs::ReplicatedStorage)
     virtual int partitionId() const BSLS_KEYWORD_OVERRIDE;
@@ -712,6 +749,14 @@ InMemoryStorage::removeVirtualStorage(const mqbu::StorageKey& appKey)
     return d_virtualStorageCatalog.removeVirtualStorage(appKey);
 }
 
+inline void InMemoryStorage::setLazy(const mqbu::StorageKey& appKey,
+                                     bool                    isLazy)
+{
+    BSLS_ASSERT_SAFE(!appKey.isNull());
+
+    d_virtualStorageCatalog.setLazy(appKey, isLazy);
+}
+
 // ACCESSORS
 //   (virtual mqbi::Storage)
 inline const bmqt::Uri& InMemoryStorage::queueUri() const
@@ -821,6 +866,17 @@ InMemoryStorage::loadVirtualStorageDetails(AppIdKeyPairs* buffer) const
     return d_virtualStorageCatalog.loadVirtualStorageDetails(buffer);
 }
 
+inline bool
+InMemoryStorage::loadDeduplicationStats(mqbcmd::DeduplicationStats* out) const
+{
+    if (!d_deduplicationIndex_mp) {
+        return false;  // RETURN
+    }
+
+    d_deduplicationIndex_mp->loadStats(out);
+    return true;
+}
+
 inline mqbu::CapacityMeter* InMemoryStorage::capacityMeter()
 {
     return &d_capacityMeter;
@@ -19,6 +19,7 @@
 // MQB
 #include <mqbcfg_brokerconfig.h>
 #include <mqbcfg_messages.h>
+#include <mqbcmd_messages.h>
 #include <mqbconfm_messages.h>
 #include <mqbi_queue.h>
 #include <mqbmock_cluster.h>
@@ -82,12 +83,14 @@ using namespace bsl;
 //   removeAllMessages_appKeyNotFound
 // - get_withVirtualStorages
 // - releaseRef
+// - lazyVirtualStorage
 // - getIterator_noVirtualStorages
 //   getIterator_withVirtualStorages
 // - capacityMeter_limitMessages
 //   capacityMeter_limitBytes
 // - garbageCollect
 // - addQueueOpRecordHandle
+// - put_probableDuplicate
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -179,7 +182,9 @@ struct Tester {
            int                      partitionId,
            bsls::Types::Int64       ttlSeconds,
            bslma::Allocator*        allocator,
-           bool                     toConfigure = false)
+           bool                     toConfigure                 = false,
+           int                      deduplicationCapacity       = 0,
+           bool                     deduplicationRejectProbable = false)
     : d_bufferFactory(1024, allocator)
     , d_mockCluster(&d_bufferFactory, allocator)
     , d_mockDomain(&d_mockCluster, allocator)
@@ -193,8 +198,10 @@ struct Tester {
         d_mockQueue._setQueueEngine(&d_mockQueueEngine);
 
         mqbconfm::Domain domainCfg;
-        domainCfg.deduplicationTimeMs() = 0;  // No history
-        domainCfg.messageTtl()          = ttlSeconds;
+        domainCfg.deduplicationTimeMs()         = 0;  // No history
+        domainCfg.messageTtl()                  = ttlSeconds;
+        domainCfg.deduplicationCapacity()       = deduplicationCapacity;
+        domainCfg.deduplicationRejectProbable() = deduplicationRejectProbable;
 
         d_inMemoryStorage_mp.load(new (*d_allocator_p) mqbs::InMemoryStorage(
                                       bmqt::Uri(uri, s_allocator_p),
@@ -1220,6 +1227,99 @@ TEST_F(BasicTest, releaseRef)
                     mqbi::StorageResult::e_SUCCESS);
 }
 
+TEST_F(BasicTest, lazyVirtualStorage)
+// ------------------------------------------------------------------------
+// LAZY VIRTUAL STORAGE
+//
+// Concerns:
+//   Messages added while a virtual storage is lazy are accounted for, and
+//   are observed in order once materialized.
+//
+// Testing:
+//   setLazy
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("LAZY VIRTUAL STORAGE");
+
+    const bsls::Types::Int64 k_MSG_LIMIT   = 80;
+    const bsls::Types::Int64 k_BYTES_LIMIT = 2048;
+
+    const bsls::Types::Int64 k_BYTE_PER_MSG = static_cast<bsls::Types::Int64>(
+        sizeof(int));
+
+    mwcu::MemOutStream errDescription(s_allocator_p);
+
+    BSLS_ASSERT_OPT(d_tester.configure(k_MSG_LIMIT, k_BYTES_LIMIT) == 0);
+
+    d_tester.storage().addVirtualStorage(errDescription,
+                                         k_APP_ID1,
+                                         k_APP_KEY1);
+    d_tester.storage().addVirtualStorage(errDescription,
+                                         k_APP_ID2,
+                                         k_APP_KEY2);
+
+    mqbi::Storage::StorageKeys     storageKeys;
+    bsl::vector<bmqt::MessageGUID> guids(s_allocator_p);
+
+    // Scenario:
+    // Two Virtual Storages, 'k_APP_KEY1' being lazy
+    // - 20 Messages 'put' using 'mqbu::StorageKey::k_NULL_KEY' are accounted
+    //   for in both virtual storages.
+    // - Making 'k_APP_KEY1' eager materializes them, in order.
+    // - 10 more Messages 'put' while 'k_APP_KEY1' is lazy again are
+    //   materialized when iterating 'k_APP_KEY1'.
+    d_tester.storage().setLazy(k_APP_KEY1, true);
+
+    ASSERT_EQ(d_tester.addMessages(&guids, storageKeys, 20),
+              mqbi::StorageResult::e_SUCCESS);
+
+    ASSERT_EQ(d_tester.storage().numMessages(k_APP_KEY1), 20);
+    ASSERT_EQ(d_tester.storage().numBytes(k_APP_KEY1), 20 * k_BYTE_PER_MSG);
+    ASSERT_EQ(d_tester.storage().numMessages(k_APP_KEY2), 20);
+    ASSERT_EQ(d_tester.storage().numBytes(k_APP_KEY2), 20 * k_BYTE_PER_MSG);
+
+    d_tester.storage().setLazy(k_APP_KEY1, false);
+
+    bslma::ManagedPtr<mqbi::StorageIterator> iterator;
+    int                                      msgData = 0;
+
+    iterator = d_tester.storage().getIterator(k_APP_KEY1);
+    while (!iterator->atEnd()) {
+        ASSERT_EQ(iterator->guid(), guids[msgData]);
+        msgData++;
+        iterator->advance();
+    }
+    ASSERT_EQ(msgData, 20);
+    ASSERT_EQ(d_tester.storage().numMessages(k_APP_KEY1), 20);
+
+    d_tester.storage().setLazy(k_APP_KEY1, true);
+
+    ASSERT_EQ(d_tester.addMessages(&guids, storageKeys, 10, 20),
+              mqbi::StorageResult::e_SUCCESS);
+
+    ASSERT_EQ(d_tester.storage().numMessages(k_APP_KEY1), 30);
+    ASSERT_EQ(d_tester.storage().numBytes(k_APP_KEY1), 30 * k_BYTE_PER_MSG);
+
+    msgData  = 0;
+    iterator = d_tester.storage().getIterator(k_APP_KEY1);
+    while (!iterator->atEnd()) {
+        ASSERT_EQ(iterator->guid(), guids[msgData]);
+        ASSERT_EQ(
+            *(reinterpret_cast<int*>(iterator->appData()->buffer(0).data())),
+            msgData);
+        msgData++;
+        iterator->advance();
+    }
+    ASSERT_EQ(msgData, 30);
+    ASSERT_EQ(d_tester.storage().numMessages(k_APP_KEY1), 30);
+    ASSERT_EQ(d_tester.storage().numMessages(k_APP_KEY2), 30);
+
+    ASSERT_EQ(d_tester.storage().removeAll(mqbu::StorageKey::k_NULL_KEY),
+              mqbi::StorageResult::e_SUCCESS);
+    ASSERT_EQ(d_tester.storage().numMessages(k_APP_KEY1), 0);
+    ASSERT_EQ(d_tester.storage().numMessages(k_APP_KEY2), 0);
+}
+
 TEST_F(Test, getIterator_noVirtualStorages)
 // ------------------------------------------------------------------------
 // Iterator Test
@@ -1574,6 +1674,80 @@ TEST_F(Test, addQueueOpRecordHandle)
     ASSERT(d_tester.storage().queueOpRecordHandles()[0] == handle);
 }
 
+TEST(put_probableDuplicate)
+// ------------------------------------------------------------------------
+// PUT - PROBABLE DUPLICATE
+//
+// Concerns:
+//   - With a deduplication index, a PUT whose GUID is in the exact tail
+//     window of the index is rejected as a duplicate.
+//   - A PUT whose GUID is only in the filter of the index, i.e. possibly a
+//     false positive, is stored and counted as a probable hit, unless the
+//     domain sets 'deduplicationRejectProbable'.
+//
+// Testing:
+//   put
+//   loadDeduplicationStats
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("PUT - PROBABLE DUPLICATE");
+
+    // The exact tail window of an index of this capacity only remembers the
+    // last GUID PUT.
+    const int k_CAPACITY = 16;
+
+    for (int i = 0; i < 2; ++i) {
+        const bool rejectProbable = (i == 1);
+        PVV("rejectProbable: " << rejectProbable);
+
+        Tester tester(k_URI_STR,
+                      k_QUEUE_KEY,
+                      k_PARTITION_ID,
+                      k_INT64_MAX,  // ttlSeconds
+                      s_allocator_p,
+                      true,  // toConfigure
+                      k_CAPACITY,
+                      rejectProbable);
+
+        const mqbi::Storage::StorageKeys storageKeys;
+        bsl::vector<bmqt::MessageGUID>   guids(s_allocator_p);
+
+        ASSERT_EQ(tester.addMessages(&guids, storageKeys, 2),
+                  mqbi::StorageResult::e_SUCCESS);
+
+        // The last GUID is in the exact tail window
+        bsl::vector<bmqt::MessageGUID> lastGuid(1, guids[1], s_allocator_p);
+        ASSERT_EQ(tester.addMessages(&lastGuid, storageKeys, 1, 0, true),
+                  mqbi::StorageResult::e_DUPLICATE);
+
+        // The first GUID is only in the filter: PUT it again once removed
+        // from the storage.
+        int removedMsgSize = -1;
+        ASSERT_EQ(tester.storage().remove(guids[0], &removedMsgSize),
+                  mqbi::StorageResult::e_SUCCESS);
+        ASSERT(!tester.storage().hasMessage(guids[0]));
+
+        const mqbi::StorageResult::Enum rc =
+            tester.addMessages(&guids, storageKeys, 1, 0, true);
+
+        mqbcmd::DeduplicationStats stats;
+        ASSERT(tester.storage().loadDeduplicationStats(&stats));
+        ASSERT_EQ(stats.numExactHits(), 1);
+        ASSERT_EQ(stats.numProbableHits(), 1);
+
+        if (rejectProbable) {
+            ASSERT_EQ(rc, mqbi::StorageResult::e_DUPLICATE);
+            ASSERT(!tester.storage().hasMessage(guids[0]));
+            ASSERT_EQ(tester.storage().numMessages(k_NULL_KEY), 1);
+        }
+        else {
+            ASSERT_EQ(rc, mqbi::StorageResult::e_SUCCESS);
+            ASSERT(tester.storage().hasMessage(guids[0]));
+            ASSERT_EQ(tester.storage().numMessages(k_NULL_KEY), 2);
+        }
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
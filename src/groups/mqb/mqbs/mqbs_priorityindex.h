@@ -0,0 +1,367 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_priorityindex.h                                               -*-C++-*-
+#ifndef INCLUDED_MQBS_PRIORITYINDEX
+#define INCLUDED_MQBS_PRIORITYINDEX
+
+//@PURPOSE: Provide an index ordering messages by priority, then by arrival.
+//
+//@CLASSES:
+//  mqbs::PriorityIndex:         index of values by priority and arrival order
+//  mqbs::PriorityIndex::Cursor: position of a reader in a 'PriorityIndex'
+//
+//@SEE ALSO: mqbs::VirtualStorage
+//
+//@DESCRIPTION: 'mqbs::PriorityIndex' orders values (typically iterators to
+// the messages of a storage) by decreasing priority, between 0 and
+// 'k_NUM_LEVELS - 1', and then by increasing arrival order.  Each inserted
+// value is identified by a 'Key' returned by 'insert', which must be kept by
+// the caller to later 'erase' the value.
+//
+// A reader of the index (for instance a storage iterator) keeps a 'Cursor',
+// which remembers, for each priority level, the arrival sequence number of the
+// next value to read at that level.  The next value of a reader ('first') is
+// the oldest unread value of the highest non-empty priority level, so that a
+// value of a higher priority inserted while the reader is positioned on lower
+// priority values is read next, and values of the lower levels are read
+// neither twice nor never.  As cursors only hold sequence numbers, erasing
+// values, including the one a reader is positioned on, never invalidates a
+// cursor.  Note that sequence numbers keep increasing across 'clear', so that
+// the values inserted after a 'clear' are visible to existing cursors.
+//
+// Finding the next value of a reader is 'O(k_NUM_LEVELS * log(size()))' in
+// the worst case, empty levels being skipped in constant time.  'version'
+// changes with every modification of the index, so that a reader can cache
+// the result of 'first' until the index is modified or its cursor moves.
+//
+/// Thread Safety
+///-------------
+// NOT thread safe.
+//
+/// Usage
+///-----
+//..
+//  mqbs::PriorityIndex<int>         index(allocator);
+//  mqbs::PriorityIndex<int>::Cursor cursor;
+//
+//  index.insert(0, 100);  // low priority, arrives first
+//  index.insert(5, 200);  // higher priority, arrives second
+//
+//  mqbs::PriorityIndex<int>::Key key;
+//  const int* value = index.first(&key, cursor);  // *value == 200
+//  mqbs::PriorityIndex<int>::advance(&cursor, key);
+//  value = index.first(&key, cursor);             // *value == 100
+//..
+
+// BDE
+#include <bsl_map.h>
+#include <bsl_utility.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_assert.h>
+#include <bsls_cpp11.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mqbs {
+
+// ===================
+// class PriorityIndex
+// ===================
+
+/// Index of values of the specified `VALUE` type ordered by decreasing
+/// priority, then by increasing arrival order.
+template <class VALUE>
+class PriorityIndex {
+  public:
+    // PUBLIC CONSTANTS
+
+    /// Number of priority levels, priorities ranging from 0 (lowest) to
+    /// `k_NUM_LEVELS - 1` (highest).
+    static const int k_NUM_LEVELS = 10;
+
+    // TYPES
+
+    /// Identifier of a value in the index.
+    typedef bsls::Types::Uint64 Key;
+
+    /// Position of a reader in the index.
+    struct Cursor {
+        bsls::Types::Uint64 d_next[k_NUM_LEVELS];
+        // Sequence number of the next value
+        // to read, per priority level
+
+        /// Create a cursor positioned before all values.
+        Cursor();
+    };
+
+  private:
+    // PRIVATE CONSTANTS
+
+    /// Number of bits of a `Key` holding the sequence number.
+    static const int k_SEQUENCE_NUMBER_BITS = 56;
+
+    // PRIVATE TYPES
+    typedef bsl::map<Key, VALUE> Entries;
+
+    typedef typename Entries::const_iterator EntriesConstIter;
+
+    // DATA
+    Entries d_entries;
+    // Values, in decreasing priority and
+    // then arrival order
+
+    bsls::Types::Int64 d_numEntries[k_NUM_LEVELS];
+    // Number of values per priority level
+
+    bsls::Types::Uint64 d_nextSequenceNumber;
+    // Sequence number of the next value
+
+    bsls::Types::Uint64 d_version;
+    // Incremented with every modification
+
+  private:
+    // NOT IMPLEMENTED
+    PriorityIndex(const PriorityIndex&) BSLS_CPP11_DELETED;
+    PriorityIndex& operator=(const PriorityIndex&) BSLS_CPP11_DELETED;
+
+  private:
+    // PRIVATE CLASS METHODS
+
+    /// Return the key of the value having the specified `priority` and
+    /// `sequenceNumber`.
+    static Key makeKey(int priority, bsls::Types::Uint64 sequenceNumber);
+
+    /// Return the priority of the value having the specified `key`.
+    static int priorityOf(Key key);
+
+    /// Return the sequence number of the value having the specified `key`.
+    static bsls::Types::Uint64 sequenceNumberOf(Key key);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(PriorityIndex, bslma::UsesBslmaAllocator)
+
+    // CLASS METHODS
+
+    /// Move the specified `cursor` past the value having the specified
+    /// `key`, and all older values of the same priority.
+    static void advance(Cursor* cursor, Key key);
+
+    /// Move the specified `cursor` before all values.
+    static void reset(Cursor* cursor);
+
+    // CREATORS
+
+    /// Create an empty index using the optionally specified `allocator` to
+    /// supply memory.
+    explicit PriorityIndex(bslma::Allocator* allocator = 0);
+
+    // MANIPULATORS
+
+    /// Insert the specified `value` with the specified `priority`, after all
+    /// values of the same priority, and return its key.  The behavior is
+    /// undefined unless `0 <= priority < k_NUM_LEVELS`.
+    Key insert(int priority, const VALUE& value);
+
+    /// Erase the value having the specified `key`, if any.
+    void erase(Key key);
+
+    /// Erase all values.
+    void clear();
+
+    // ACCESSORS
+
+    /// Return the address of the next value to read from the specified
+    /// `cursor`, and load its key into the specified `key`, or return 0 if
+    /// there is no such value.  The returned address is valid until the
+    /// index is modified.
+    const VALUE* first(Key* key, const Cursor& cursor) const;
+
+    /// Return the number of values in the index.
+    bsls::Types::Int64 size() const;
+
+    /// Return the number of values having the specified `priority`.  The
+    /// behavior is undefined unless `0 <= priority < k_NUM_LEVELS`.
+    bsls::Types::Int64 numEntries(int priority) const;
+
+    /// Return a number which changes whenever the index is modified.
+    bsls::Types::Uint64 version() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ----------------------------
+// struct PriorityIndex::Cursor
+// ----------------------------
+
+template <class VALUE>
+inline PriorityIndex<VALUE>::Cursor::Cursor()
+{
+    PriorityIndex<VALUE>::reset(this);
+}
+
+// -------------------
+// class PriorityIndex
+// -------------------
+
+// PRIVATE CLASS METHODS
+template <class VALUE>
+inline typename PriorityIndex<VALUE>::Key
+PriorityIndex<VALUE>::makeKey(int priority, bsls::Types::Uint64 sequenceNumber)
+{
+    // Higher priorities have smaller keys, so that they come first.
+    return (static_cast<Key>(k_NUM_LEVELS - 1 - priority)
+            << k_SEQUENCE_NUMBER_BITS) |
+           sequenceNumber;
+}
+
+template <class VALUE>
+inline int PriorityIndex<VALUE>::priorityOf(Key key)
+{
+    return k_NUM_LEVELS - 1 - static_cast<int>(key >> k_SEQUENCE_NUMBER_BITS);
+}
+
+template <class VALUE>
+inline bsls::Types::Uint64 PriorityIndex<VALUE>::sequenceNumberOf(Key key)
+{
+    return key & ((static_cast<Key>(1) << k_SEQUENCE_NUMBER_BITS) - 1);
+}
+
+// CLASS METHODS
+template <class VALUE>
+inline void PriorityIndex<VALUE>::advance(Cursor* cursor, Key key)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(cursor);
+
+    cursor->d_next[priorityOf(key)] = sequenceNumberOf(key) + 1;
+}
+
+template <class VALUE>
+inline void PriorityIndex<VALUE>::reset(Cursor* cursor)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(cursor);
+
+    for (int i = 0; i < k_NUM_LEVELS; ++i) {
+        cursor->d_next[i] = 0;
+    }
+}
+
+// CREATORS
+template <class VALUE>
+inline PriorityIndex<VALUE>::PriorityIndex(bslma::Allocator* allocator)
+: d_entries(allocator)
+, d_nextSequenceNumber(0)
+, d_version(0)
+{
+    for (int i = 0; i < k_NUM_LEVELS; ++i) {
+        d_numEntries[i] = 0;
+    }
+}
+
+// MANIPULATORS
+template <class VALUE>
+inline typename PriorityIndex<VALUE>::Key
+PriorityIndex<VALUE>::insert(int priority, const VALUE& value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= priority && priority < k_NUM_LEVELS);
+
+    const Key key = makeKey(priority, d_nextSequenceNumber++);
+
+    // Keys of a level are increasing, hence the hint.
+    d_entries.insert(d_entries.upper_bound(key), bsl::make_pair(key, value));
+    ++d_numEntries[priority];
+    ++d_version;
+
+    return key;
+}
+
+template <class VALUE>
+inline void PriorityIndex<VALUE>::erase(Key key)
+{
+    if (d_entries.erase(key) == 0) {
+        return;  // RETURN
+    }
+
+    --d_numEntries[priorityOf(key)];
+    ++d_version;
+}
+
+template <class VALUE>
+inline void PriorityIndex<VALUE>::clear()
+{
+    d_entries.clear();
+    for (int i = 0; i < k_NUM_LEVELS; ++i) {
+        d_numEntries[i] = 0;
+    }
+    ++d_version;
+}
+
+// ACCESSORS
+template <class VALUE>
+inline const VALUE* PriorityIndex<VALUE>::first(Key*          key,
+                                                const Cursor& cursor) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(key);
+
+    for (int priority = k_NUM_LEVELS - 1; priority >= 0; --priority) {
+        if (d_numEntries[priority] == 0) {
+            continue;  // CONTINUE
+        }
+
+        EntriesConstIter it = d_entries.lower_bound(
+            makeKey(priority, cursor.d_next[priority]));
+        if (it != d_entries.end() && priorityOf(it->first) == priority) {
+            *key = it->first;
+            return &it->second;  // RETURN
+        }
+    }
+
+    return 0;
+}
+
+template <class VALUE>
+inline bsls::Types::Int64 PriorityIndex<VALUE>::size() const
+{
+    return d_entries.size();
+}
+
+template <class VALUE>
+inline bsls::Types::Int64 PriorityIndex<VALUE>::numEntries(int priority) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= priority && priority < k_NUM_LEVELS);
+
+    return d_numEntries[priority];
+}
+
+template <class VALUE>
+inline bsls::Types::Uint64 PriorityIndex<VALUE>::version() const
+{
+    return d_version;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,219 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_priorityindex.t.cpp                                           -*-C++-*-
+#include <mqbs_priorityindex.h>
+
+// BDE
+#include <bsl_vector.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+namespace {
+
+typedef mqbs::PriorityIndex<int> Obj;
+
+/// Read all values of the specified `obj` from the specified `cursor`,
+/// appending them to the specified `values`.
+void readAll(bsl::vector<int>* values, Obj::Cursor* cursor, const Obj& obj)
+{
+    Obj::Key   key;
+    const int* value;
+    while ((value = obj.first(&key, *cursor))) {
+        values->push_back(*value);
+        Obj::advance(cursor, key);
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Testing:
+//   Basic functionality of 'mqbs::PriorityIndex'.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    Obj         obj(s_allocator_p);
+    Obj::Cursor cursor;
+    Obj::Key    key;
+
+    ASSERT_EQ(obj.size(), 0);
+    ASSERT(obj.first(&key, cursor) == 0);
+
+    const bsls::Types::Uint64 version = obj.version();
+    const Obj::Key            k1      = obj.insert(0, 1);
+    const Obj::Key            k2      = obj.insert(5, 2);
+    ASSERT_NE(obj.version(), version);
+    ASSERT_EQ(obj.size(), 2);
+    ASSERT_EQ(obj.numEntries(0), 1);
+    ASSERT_EQ(obj.numEntries(5), 1);
+
+    const int* value = obj.first(&key, cursor);
+    ASSERT(value != 0);
+    ASSERT_EQ(*value, 2);
+    ASSERT_EQ(key, k2);
+
+    Obj::advance(&cursor, key);
+    value = obj.first(&key, cursor);
+    ASSERT(value != 0);
+    ASSERT_EQ(*value, 1);
+    ASSERT_EQ(key, k1);
+
+    Obj::advance(&cursor, key);
+    ASSERT(obj.first(&key, cursor) == 0);
+
+    Obj::reset(&cursor);
+    value = obj.first(&key, cursor);
+    ASSERT(value != 0);
+    ASSERT_EQ(*value, 2);
+
+    obj.erase(k2);
+    obj.erase(k2);  // No effect
+    ASSERT_EQ(obj.size(), 1);
+    ASSERT_EQ(obj.numEntries(5), 0);
+
+    obj.clear();
+    ASSERT_EQ(obj.size(), 0);
+    ASSERT_EQ(obj.numEntries(0), 0);
+    ASSERT(obj.first(&key, cursor) == 0);
+}
+
+static void test2_order()
+// ------------------------------------------------------------------------
+// ORDER
+//
+// Concerns:
+//   Values are read by decreasing priority, and by arrival order within a
+//   priority.
+//
+// Testing:
+//   insert
+//   first
+//   advance
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("ORDER");
+
+    Obj obj(s_allocator_p);
+
+    // value = 10 * priority + arrival rank within the priority
+    const int k_PRIORITIES[] = {3, 0, 9, 3, 0, 9, 5};
+    const int k_NUM_VALUES   = sizeof(k_PRIORITIES) / sizeof(*k_PRIORITIES);
+    int       rank[Obj::k_NUM_LEVELS] = {0};
+
+    for (int i = 0; i < k_NUM_VALUES; ++i) {
+        const int priority = k_PRIORITIES[i];
+        obj.insert(priority, 10 * priority + rank[priority]++);
+    }
+
+    const int        k_EXPECTED[] = {90, 91, 50, 30, 31, 0, 1};
+    bsl::vector<int> values(s_allocator_p);
+    Obj::Cursor      cursor;
+    readAll(&values, &cursor, obj);
+
+    ASSERT_EQ(values.size(), static_cast<size_t>(k_NUM_VALUES));
+    for (size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ_D(i, values[i], k_EXPECTED[i]);
+    }
+}
+
+static void test3_concurrentModifications()
+// ------------------------------------------------------------------------
+// CONCURRENT MODIFICATIONS
+//
+// Concerns:
+//   - A value of a higher priority inserted while a reader is positioned on
+//     lower priority values is read next, without skipping nor repeating
+//     the values of the lower priority.
+//   - Erasing values, including the next value of a reader, does not
+//     invalidate its cursor.
+//   - Values inserted after 'clear' are visible to existing cursors.
+//
+// Testing:
+//   insert
+//   erase
+//   clear
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("CONCURRENT MODIFICATIONS");
+
+    Obj         obj(s_allocator_p);
+    Obj::Cursor cursor;
+    Obj::Key    key;
+
+    obj.insert(1, 10);
+    const Obj::Key k11 = obj.insert(1, 11);
+    obj.insert(1, 12);
+
+    // Read '10'
+    const int* value = obj.first(&key, cursor);
+    ASSERT_EQ(*value, 10);
+    Obj::advance(&cursor, key);
+
+    // A higher priority value arrives: it is read next.
+    obj.insert(7, 70);
+    value = obj.first(&key, cursor);
+    ASSERT_EQ(*value, 70);
+    Obj::advance(&cursor, key);
+
+    // The next value of the reader is erased.
+    obj.erase(k11);
+    value = obj.first(&key, cursor);
+    ASSERT_EQ(*value, 12);
+    obj.erase(key);
+    ASSERT(obj.first(&key, cursor) == 0);
+
+    // Values inserted after 'clear' are visible.
+    obj.clear();
+    obj.insert(1, 13);
+    value = obj.first(&key, cursor);
+    ASSERT(value != 0);
+    ASSERT_EQ(*value, 13);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_concurrentModifications(); break;
+    case 2: test2_order(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
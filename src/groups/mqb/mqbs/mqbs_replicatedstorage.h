@@ -40,6 +40,9 @@
 // BMQ
 #include <bmqt_messageguid.h>
 
+// BDE
+#include <bsls_types.h>
+
 namespace BloombergLP {
 namespace mqbs {
 
@@ -97,6 +100,17 @@ class ReplicatedStorage : public mqbi::Storage {
     /// replica nodes, and the record will not be replicated to peer nodes.
     virtual void purge(const mqbu::StorageKey& appKey) = 0;
 
+    /// Add to the virtual storages the scheduled messages whose delivery
+    /// time is not later than the specified `secondsFromEpoch`, and return
+    /// their number.  Load into the specified `nextDeliveryTimestamp` the
+    /// delivery time of the earliest message still scheduled, or zero if
+    /// there is none.  Note that this routine is invoked at the primary as
+    /// well as at replica nodes, but that only the primary delivers the
+    /// released messages.
+    virtual int
+    releaseScheduledMessages(bsls::Types::Uint64* nextDeliveryTimestamp,
+                             bsls::Types::Uint64  secondsFromEpoch) = 0;
+
     /// Return a non-modifiable list of handles of all QUEUEOP records
     /// associated with this storage.
     virtual const RecordHandles& queueOpRecordHandles() const = 0;
@@ -0,0 +1,142 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_storagegcschedule.cpp                                         -*-C++-*-
+#include <mqbs_storagegcschedule.h>
+
+#include <mqbscm_version.h>
+// BDE
+#include <bsl_algorithm.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace mqbs {
+
+namespace {
+/// Minimum number of stale entries in the heap before considering a
+/// compaction.
+const size_t k_MIN_STALE_ENTRIES_TO_COMPACT = 64;
+}  // close unnamed namespace
+
+// -----------------------
+// class StorageGcSchedule
+// -----------------------
+
+// PRIVATE MANIPULATORS
+void StorageGcSchedule::compact()
+{
+    Heap::iterator out = d_heap.begin();
+    for (Heap::const_iterator it = d_heap.begin(); it != d_heap.end(); ++it) {
+        DueTimes::const_iterator dueIt = d_dueTimes.find(it->second);
+        if (dueIt != d_dueTimes.end() && dueIt->second == it->first) {
+            *out++ = *it;
+        }
+    }
+    d_heap.erase(out, d_heap.end());
+    bsl::make_heap(d_heap.begin(), d_heap.end(), EntryGreater());
+}
+
+// CREATORS
+StorageGcSchedule::StorageGcSchedule(bslma::Allocator* allocator)
+: d_heap(allocator)
+, d_dueTimes(allocator)
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+void StorageGcSchedule::schedule(const mqbu::StorageKey& key,
+                                 bsls::Types::Int64      dueTime)
+{
+    bsl::pair<DueTimesIter, bool> rc = d_dueTimes.insert(
+        bsl::make_pair(key, dueTime));
+    if (!rc.second) {
+        if (rc.first->second <= dueTime) {
+            // Already due earlier
+            return;  // RETURN
+        }
+
+        // The previous entry of 'key' in the heap becomes stale
+        rc.first->second = dueTime;
+    }
+
+    d_heap.push_back(Entry(dueTime, key));
+    bsl::push_heap(d_heap.begin(), d_heap.end(), EntryGreater());
+
+    if (d_heap.size() >= k_MIN_STALE_ENTRIES_TO_COMPACT &&
+        d_heap.size() > 2 * d_dueTimes.size()) {
+        compact();
+    }
+}
+
+void StorageGcSchedule::remove(const mqbu::StorageKey& key)
+{
+    // The entry of 'key' in the heap, if any, becomes stale
+    d_dueTimes.erase(key);
+
+    if (d_dueTimes.empty()) {
+        d_heap.clear();
+    }
+}
+
+bool StorageGcSchedule::popDue(mqbu::StorageKey* key, bsls::Types::Int64 now)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(key);
+
+    while (!d_heap.empty() && d_heap.front().first <= now) {
+        const Entry entry = d_heap.front();
+        bsl::pop_heap(d_heap.begin(), d_heap.end(), EntryGreater());
+        d_heap.pop_back();
+
+        DueTimesIter it = d_dueTimes.find(entry.second);
+        if (it == d_dueTimes.end() || it->second != entry.first) {
+            // Stale entry
+            continue;  // CONTINUE
+        }
+
+        d_dueTimes.erase(it);
+        *key = entry.second;
+        return true;  // RETURN
+    }
+
+    return false;
+}
+
+void StorageGcSchedule::clear()
+{
+    d_heap.clear();
+    d_dueTimes.clear();
+}
+
+// ACCESSORS
+bool StorageGcSchedule::loadEarliestDueTime(bsls::Types::Int64* dueTime) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dueTime);
+
+    if (d_dueTimes.empty()) {
+        return false;  // RETURN
+    }
+
+    // The top of the heap is either the entry of the earliest scheduled key,
+    // or a stale entry which is even earlier.
+    BSLS_ASSERT_SAFE(!d_heap.empty());
+    *dueTime = d_heap.front().first;
+    return true;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
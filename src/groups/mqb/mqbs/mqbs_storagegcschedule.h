@@ -0,0 +1,194 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_storagegcschedule.h                                           -*-C++-*-
+#ifndef INCLUDED_MQBS_STORAGEGCSCHEDULE
+#define INCLUDED_MQBS_STORAGEGCSCHEDULE
+
+//@PURPOSE: Provide a schedule of the next garbage-collection time of storages.
+//
+//@CLASSES:
+//  mqbs::StorageGcSchedule: min-heap of storage keys ordered by GC due time
+//
+//@SEE ALSO: mqbs::FileStore
+//
+//@DESCRIPTION: 'mqbs::StorageGcSchedule' keeps track, for each storage of a
+// partition (identified by its 'mqbu::StorageKey'), of the earliest time at
+// which the storage may have messages or history to garbage-collect.  This
+// allows the partition to only visit the storages which are due, instead of
+// iterating over all of them at every GC tick.
+//
+// The schedule is implemented as a binary min-heap of '(dueTime, key)'
+// entries, along with a hash map of the current due time of each scheduled
+// key.  Rescheduling a key to an earlier time pushes a new entry and leaves
+// the previous one in the heap; such stale entries are discarded when they
+// reach the top of the heap, or when the heap is compacted (which happens
+// when stale entries outnumber the scheduled keys).  All operations are
+// therefore 'O(log(n))', amortized.
+//
+// Times are opaque 'bsls::Types::Int64' values, typically nanoseconds as
+// returned by 'mwcsys::Time::highResolutionTimer()'.
+//
+/// Thread Safety
+///-------------
+// NOT thread safe.
+//
+/// Usage
+///-----
+//..
+//  mqbs::StorageGcSchedule schedule(allocator);
+//  schedule.schedule(key1, now);
+//  schedule.schedule(key2, now + 1000);
+//
+//  mqbu::StorageKey key;
+//  while (schedule.popDue(&key, now)) {
+//      // Only 'key1' is due: garbage-collect it, and reschedule it to the
+//      // time its oldest message expires.
+//  }
+//..
+
+// MQB
+
+#include <mqbu_storagekey.h>
+
+// BDE
+#include <bsl_unordered_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_cpp11.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mqbs {
+
+// =======================
+// class StorageGcSchedule
+// =======================
+
+/// Min-heap of storage keys ordered by garbage-collection due time.
+class StorageGcSchedule {
+  private:
+    // PRIVATE TYPES
+    typedef bsl::pair<bsls::Types::Int64, mqbu::StorageKey> Entry;
+
+    typedef bsl::vector<Entry> Heap;
+
+    typedef bsl::unordered_map<mqbu::StorageKey, bsls::Types::Int64>
+        DueTimes;
+
+    typedef DueTimes::iterator DueTimesIter;
+
+    /// Heap ordering putting the entry with the smallest due time on top.
+    struct EntryGreater {
+        bool operator()(const Entry& lhs, const Entry& rhs) const
+        {
+            return lhs.first > rhs.first;
+        }
+    };
+
+    // DATA
+    Heap d_heap;
+    // Heap of (dueTime, key), possibly
+    // containing stale entries
+
+    DueTimes d_dueTimes;
+    // Current due time of each scheduled key
+
+  private:
+    // NOT IMPLEMENTED
+    StorageGcSchedule(const StorageGcSchedule&) BSLS_CPP11_DELETED;
+    StorageGcSchedule&
+    operator=(const StorageGcSchedule&) BSLS_CPP11_DELETED;
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Remove all stale entries from the heap.
+    void compact();
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(StorageGcSchedule,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty schedule using the specified `allocator`.
+    explicit StorageGcSchedule(bslma::Allocator* allocator = 0);
+
+    // MANIPULATORS
+
+    /// Schedule the storage identified by the specified `key` to be due no
+    /// later than the specified `dueTime`.  If `key` is already scheduled
+    /// at a time earlier than or equal to `dueTime`, this method has no
+    /// effect.
+    void schedule(const mqbu::StorageKey& key, bsls::Types::Int64 dueTime);
+
+    /// Remove the specified `key` from this schedule, if present.
+    void remove(const mqbu::StorageKey& key);
+
+    /// Load into the specified `key` the storage key having the earliest
+    /// due time, and remove it from this schedule, if that due time is
+    /// less than or equal to the specified `now`.  Return true if a key
+    /// was loaded, and false otherwise (in which case `key` is left
+    /// unchanged).
+    bool popDue(mqbu::StorageKey* key, bsls::Types::Int64 now);
+
+    /// Remove all keys from this schedule.
+    void clear();
+
+    // ACCESSORS
+
+    /// Return true if the specified `key` is scheduled, and false
+    /// otherwise.
+    bool isScheduled(const mqbu::StorageKey& key) const;
+
+    /// Return the number of scheduled keys.
+    int numScheduled() const;
+
+    /// Load into the specified `dueTime` a time no later than the earliest
+    /// due time of the scheduled keys, and return true if any key is
+    /// scheduled.  Return false otherwise (in which case `dueTime` is left
+    /// unchanged).  Note that the loaded time may be earlier than the
+    /// earliest due time if keys were removed since they were scheduled.
+    bool loadEarliestDueTime(bsls::Types::Int64* dueTime) const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// -----------------------
+// class StorageGcSchedule
+// -----------------------
+
+inline bool
+StorageGcSchedule::isScheduled(const mqbu::StorageKey& key) const
+{
+    return d_dueTimes.find(key) != d_dueTimes.end();
+}
+
+inline int StorageGcSchedule::numScheduled() const
+{
+    return static_cast<int>(d_dueTimes.size());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,202 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_storagegcschedule.t.cpp                                       -*-C++-*-
+#include <mqbs_storagegcschedule.h>
+
+// MQB
+#include <mqbu_storagekey.h>
+
+// BDE
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Testing:
+//   Basic functionality of 'mqbs::StorageGcSchedule'.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    mqbs::StorageGcSchedule obj(s_allocator_p);
+    mqbu::StorageKey        key;
+    bsls::Types::Int64      dueTime = 0;
+
+    ASSERT_EQ(obj.numScheduled(), 0);
+    ASSERT(!obj.popDue(&key, 100));
+    ASSERT(!obj.loadEarliestDueTime(&dueTime));
+
+    const mqbu::StorageKey k1(1U);
+    const mqbu::StorageKey k2(2U);
+    const mqbu::StorageKey k3(3U);
+
+    obj.schedule(k2, 20);
+    obj.schedule(k1, 10);
+    obj.schedule(k3, 30);
+    ASSERT_EQ(obj.numScheduled(), 3);
+    ASSERT(obj.isScheduled(k1));
+    ASSERT(obj.loadEarliestDueTime(&dueTime));
+    ASSERT_EQ(dueTime, 10);
+
+    // Nothing due yet
+    ASSERT(!obj.popDue(&key, 5));
+
+    // Keys are popped in due time order
+    ASSERT(obj.popDue(&key, 25));
+    ASSERT_EQ(key, k1);
+    ASSERT(!obj.isScheduled(k1));
+    ASSERT(obj.popDue(&key, 25));
+    ASSERT_EQ(key, k2);
+    ASSERT(!obj.popDue(&key, 25));
+    ASSERT_EQ(obj.numScheduled(), 1);
+
+    ASSERT(obj.loadEarliestDueTime(&dueTime));
+    ASSERT_EQ(dueTime, 30);
+
+    obj.clear();
+    ASSERT_EQ(obj.numScheduled(), 0);
+    ASSERT(!obj.popDue(&key, 100));
+    ASSERT(!obj.loadEarliestDueTime(&dueTime));
+}
+
+static void test2_reschedule()
+// ------------------------------------------------------------------------
+// RESCHEDULE
+//
+// Testing:
+//   - 'schedule' keeps the earliest due time of a key
+//   - 'remove' discards a key
+//   - stale heap entries are skipped
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("RESCHEDULE");
+
+    mqbs::StorageGcSchedule obj(s_allocator_p);
+    mqbu::StorageKey        key;
+
+    const mqbu::StorageKey k1(1U);
+    const mqbu::StorageKey k2(2U);
+
+    {
+        PVV("Later due time is ignored");
+        obj.schedule(k1, 10);
+        obj.schedule(k1, 50);
+        ASSERT_EQ(obj.numScheduled(), 1);
+        ASSERT(obj.popDue(&key, 10));
+        ASSERT_EQ(key, k1);
+        ASSERT(!obj.popDue(&key, 100));
+    }
+
+    {
+        PVV("Earlier due time takes precedence");
+        obj.schedule(k1, 50);
+        obj.schedule(k2, 30);
+        obj.schedule(k1, 20);
+        ASSERT_EQ(obj.numScheduled(), 2);
+
+        bsls::Types::Int64 dueTime = 0;
+        ASSERT(obj.loadEarliestDueTime(&dueTime));
+        ASSERT_EQ(dueTime, 20);
+
+        ASSERT(obj.popDue(&key, 25));
+        ASSERT_EQ(key, k1);
+
+        // The stale (50, k1) entry must not pop 'k1' again
+        ASSERT(obj.popDue(&key, 100));
+        ASSERT_EQ(key, k2);
+        ASSERT(!obj.popDue(&key, 100));
+        ASSERT_EQ(obj.numScheduled(), 0);
+    }
+
+    {
+        PVV("Removed key is never popped");
+        obj.schedule(k1, 10);
+        obj.schedule(k2, 20);
+        obj.remove(k1);
+        ASSERT(!obj.isScheduled(k1));
+
+        ASSERT(obj.popDue(&key, 100));
+        ASSERT_EQ(key, k2);
+        ASSERT(!obj.popDue(&key, 100));
+    }
+}
+
+static void test3_compaction()
+// ------------------------------------------------------------------------
+// COMPACTION
+//
+// Testing:
+//   Repeatedly rescheduling keys to earlier times does not lose any key
+//   nor pop any key more than once.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("COMPACTION");
+
+    mqbs::StorageGcSchedule obj(s_allocator_p);
+    mqbu::StorageKey        key;
+
+    const int k_NUM_KEYS    = 10;
+    const int k_NUM_UPDATES = 100;
+
+    for (int update = 0; update < k_NUM_UPDATES; ++update) {
+        for (int i = 0; i < k_NUM_KEYS; ++i) {
+            obj.schedule(mqbu::StorageKey(static_cast<unsigned int>(i)),
+                         1000 - update);
+        }
+    }
+    ASSERT_EQ(obj.numScheduled(), k_NUM_KEYS);
+
+    int numPopped = 0;
+    while (obj.popDue(&key, 1000)) {
+        ++numPopped;
+    }
+    ASSERT_EQ(numPopped, k_NUM_KEYS);
+    ASSERT_EQ(obj.numScheduled(), 0);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_compaction(); break;
+    case 2: test2_reschedule(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
@@ -18,6 +18,7 @@
 
 #include <mqbscm_version.h>
 // BDE
+#include <bsl_algorithm.h>
 #include <bsl_cstring.h>
 #include <bsl_utility.h>
 #include <bslma_allocator.h>
@@ -41,6 +42,11 @@ VirtualStorage::VirtualStorage(mqbi::Storage*          storage,
 , d_appKey(appKey)
 , d_guids(allocator)
 , d_totalBytes(0)
+, d_isLazy(false)
+, d_lazySequenceNumber(0)
+, d_numLazyMessages(0)
+, d_lazyBytes(0)
+, d_priorities_mp()
 {
     BSLS_ASSERT_SAFE(d_storage_p);
     BSLS_ASSERT_SAFE(allocator);
@@ -108,22 +114,79 @@ void VirtualStorage::close()
 mqbi::StorageResult::Enum VirtualStorage::put(const bmqt::MessageGUID& msgGUID,
                                               int                      msgSize,
                                               const bmqp::RdaInfo&     rdaInfo,
-                                              unsigned int subScriptionId)
+                                              unsigned int subScriptionId,
+                                              int          priority)
 {
-    if (d_guids
-            .insert(bsl::make_pair(
-                msgGUID,
-                MessageContext(msgSize, rdaInfo, subScriptionId)))
-            .second == false) {
+    bsl::pair<GuidListIter, bool> insertRc = d_guids.insert(
+        bsl::make_pair(msgGUID,
+                       MessageContext(msgSize, rdaInfo, subScriptionId)));
+    if (insertRc.second == false) {
         // Duplicate GUID
         return mqbi::StorageResult::e_GUID_NOT_UNIQUE;  // RETURN
     }
 
     // Success: new GUID
     d_totalBytes += msgSize;
+
+    if (d_priorities_mp) {
+        insertRc.first->second.d_priorityKey = d_priorities_mp->insert(
+            bsl::max(0, bsl::min(priority, Priorities::k_NUM_LEVELS - 1)),
+            insertRc.first);
+    }
+
     return mqbi::StorageResult::e_SUCCESS;
 }
 
+void VirtualStorage::enablePriorityOrder()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_guids.empty());
+
+    if (d_priorities_mp) {
+        return;  // RETURN
+    }
+
+    d_priorities_mp.load(new (*d_allocator_p) Priorities(d_allocator_p),
+                         d_allocator_p);
+}
+
+void VirtualStorage::makeLazy(bsls::Types::Uint64 sequenceNumber)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!d_isLazy);
+    BSLS_ASSERT_SAFE(d_numLazyMessages == 0);
+
+    d_isLazy             = true;
+    d_lazySequenceNumber = sequenceNumber;
+}
+
+void VirtualStorage::makeEager()
+{
+    d_isLazy             = false;
+    d_lazySequenceNumber = 0;
+    d_numLazyMessages    = 0;
+    d_lazyBytes          = 0;
+}
+
+void VirtualStorage::putLazy(int msgSize)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_isLazy);
+
+    ++d_numLazyMessages;
+    d_lazyBytes += msgSize;
+}
+
+void VirtualStorage::removeLazy(int msgSize)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_isLazy);
+    BSLS_ASSERT_SAFE(d_numLazyMessages > 0);
+
+    --d_numLazyMessages;
+    d_lazyBytes -= msgSize;
+}
+
 mqbi::StorageResult::Enum VirtualStorage::put(
     BSLS_ANNOTATION_UNUSED mqbi::StorageMessageAttributes* attributes,
     BSLS_ANNOTATION_UNUSED const bmqt::MessageGUID& msgGUID,
@@ -142,7 +205,9 @@ VirtualStorage::getIterator(const mqbu::StorageKey& appKey)
     static_cast<void>(appKey);
 
     bslma::ManagedPtr<mqbi::StorageIterator> mp(
-        new (*d_allocator_p) VirtualStorageIterator(this, d_guids.begin()),
+        new (*d_allocator_p) VirtualStorageIterator(this,
+                                                    d_guids.begin(),
+                                                    isPriorityOrdered()),
         d_allocator_p);
 
     return mp;
@@ -193,6 +258,9 @@ VirtualStorage::remove(const bmqt::MessageGUID&    msgGUID,
         *msgSize = it->second.d_size;
     }
     d_totalBytes -= it->second.d_size;
+    if (d_priorities_mp) {
+        d_priorities_mp->erase(it->second.d_priorityKey);
+    }
     d_guids.erase(it);
     return mqbi::StorageResult::e_SUCCESS;
 }
@@ -201,7 +269,12 @@ mqbi::StorageResult::Enum VirtualStorage::removeAll(
     BSLS_ANNOTATION_UNUSED const mqbu::StorageKey& appKey)
 {
     d_guids.clear();
-    d_totalBytes = 0;
+    if (d_priorities_mp) {
+        d_priorities_mp->clear();
+    }
+    d_totalBytes      = 0;
+    d_numLazyMessages = 0;
+    d_lazyBytes       = 0;
     return mqbi::StorageResult::e_SUCCESS;
 }
 
@@ -257,6 +330,12 @@ void VirtualStorage::loadVirtualStorageDetails(
     BSLS_ASSERT_OPT(false && "Should not be invoked.");
 }
 
+bool VirtualStorage::loadDeduplicationStats(
+    BSLS_ANNOTATION_UNUSED mqbcmd::DeduplicationStats* out) const
+{
+    return false;
+}
+
 int VirtualStorage::gcExpiredMessages(
     BSLS_ANNOTATION_UNUSED bsls::Types::Uint64* latestGcMsgTimestampEpoch,
     BSLS_ANNOTATION_UNUSED bsls::Types::Int64* configuredTtlValue,
@@ -288,12 +367,19 @@ bool VirtualStorage::removeVirtualStorage(
     return false;
 }
 
+void VirtualStorage::setLazy(
+    BSLS_ANNOTATION_UNUSED const mqbu::StorageKey& appKey,
+    BSLS_ANNOTATION_UNUSED bool                    isLazy)
+{
+    BSLS_ASSERT_OPT(false && "Should not be invoked.");
+}
+
 // ----------------------------
 // class VirtualStorageIterator
 // ----------------------------
 
-// PRIVATE MANIPULATORS
-void VirtualStorageIterator::clear()
+// PRIVATE ACCESSORS
+void VirtualStorageIterator::clear() const
 {
     // Clear previous state, if any.  This is required so that new state can be
     // loaded in 'appData', 'options' or 'attributes' routines.
@@ -303,11 +389,36 @@ void VirtualStorageIterator::clear()
     d_haveReceipt = false;
 }
 
-// PRIVATE ACCESSORS
+void VirtualStorageIterator::sync() const
+{
+    if (!d_isPriorityOrdered) {
+        return;  // RETURN
+    }
+
+    const VirtualStorage::Priorities& priorities =
+        *d_virtualStorage_p->d_priorities_mp;
+    if (priorities.version() == d_syncedVersion) {
+        return;  // RETURN
+    }
+
+    const VirtualStorage::GuidList::const_iterator* next = priorities.first(
+        &d_priorityKey,
+        d_cursor);
+    const VirtualStorage::GuidList::const_iterator position =
+        next ? *next : d_virtualStorage_p->d_guids.end();
+    if (position != d_iterator) {
+        clear();
+        d_iterator = position;
+    }
+    d_syncedVersion = priorities.version();
+}
+
 bool VirtualStorageIterator::loadMessageAndAttributes() const
 {
     BSLS_ASSERT_SAFE(!atEnd());
 
+    sync();
+
     if (!d_appData_sp) {
         mqbi::StorageResult::Enum rc = d_virtualStorage_p->d_storage_p->get(
             &d_appData_sp,
@@ -324,15 +435,27 @@ bool VirtualStorageIterator::loadMessageAndAttributes() const
 // CREATORS
 VirtualStorageIterator::VirtualStorageIterator(
     VirtualStorage*                                 storage,
-    const VirtualStorage::GuidList::const_iterator& initialPosition)
+    const VirtualStorage::GuidList::const_iterator& initialPosition,
+    bool                                            isPriorityOrdered)
 : d_virtualStorage_p(storage)
 , d_iterator(initialPosition)
+, d_isPriorityOrdered(isPriorityOrdered)
+, d_cursor()
+, d_priorityKey(0)
+, d_syncedVersion(0)
 , d_attributes()
 , d_appData_sp()
 , d_options_sp()
 , d_haveReceipt(false)
 {
     BSLS_ASSERT_SAFE(d_virtualStorage_p);
+    BSLS_ASSERT_SAFE(!d_isPriorityOrdered ||
+                     d_virtualStorage_p->isPriorityOrdered());
+
+    if (d_isPriorityOrdered) {
+        // Force the first synchronization.
+        d_syncedVersion = d_virtualStorage_p->d_priorities_mp->version() - 1;
+    }
 }
 
 VirtualStorageIterator::~VirtualStorageIterator()
@@ -346,8 +469,15 @@ bool VirtualStorageIterator::advance()
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(!atEnd());
 
+    sync();
     clear();
-    ++d_iterator;
+    if (d_isPriorityOrdered) {
+        VirtualStorage::Priorities::advance(&d_cursor, d_priorityKey);
+        d_syncedVersion = d_virtualStorage_p->d_priorities_mp->version() - 1;
+    }
+    else {
+        ++d_iterator;
+    }
     return !atEnd();
 }
 
@@ -355,6 +485,12 @@ void VirtualStorageIterator::reset()
 {
     clear();
 
+    if (d_isPriorityOrdered) {
+        VirtualStorage::Priorities::reset(&d_cursor);
+        d_syncedVersion = d_virtualStorage_p->d_priorities_mp->version() - 1;
+        return;  // RETURN
+    }
+
     // Reset iterator to beginning
     d_iterator = d_virtualStorage_p->d_guids.begin();
 }
@@ -365,6 +501,7 @@ const bmqt::MessageGUID& VirtualStorageIterator::guid() const
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(!atEnd());
 
+    sync();
     return d_iterator->first;
 }
 
@@ -373,6 +510,7 @@ bmqp::RdaInfo& VirtualStorageIterator::rdaInfo() const
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(!atEnd());
 
+    sync();
     return d_iterator->second.d_rdaInfo;
 }
 
@@ -381,6 +519,7 @@ unsigned int VirtualStorageIterator::subscriptionId() const
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(!atEnd());
 
+    sync();
     return d_iterator->second.d_subscriptionId;
 }
 
@@ -405,6 +544,7 @@ VirtualStorageIterator::attributes() const
 
 bool VirtualStorageIterator::atEnd() const
 {
+    sync();
     return (d_iterator == d_virtualStorage_p->d_guids.end());
 }
 
@@ -26,6 +26,22 @@
 //@DESCRIPTION: 'mqbs::VirtualStorage' provides a mechanism to add per-client
 // state to an underlying BlazingMQ storage.
 //
+// A virtual storage can be made *lazy* by its owning
+// 'mqbs::VirtualStorageCatalog', in which case it does not keep any
+// per-message state for the messages subsequently added to it, but only
+// accounts for their number and size.  The catalog keeps the ordered list of
+// these messages on behalf of all lazy virtual storages, and materializes them
+// into the virtual storage (see 'put') when it is made eager again.
+//
+// A virtual storage can also be made *priority ordered* (see
+// 'enablePriorityOrder'), in which case the iterator returned by
+// 'getIterator(appKey)' visits its messages by decreasing priority (as
+// specified to 'put'), and then by arrival order, using an
+// 'mqbs::PriorityIndex'.  Such an iterator positioned at a message of
+// low priority moves to a message of higher priority as soon as one is added.
+// Iterators obtained at a given message (see 'getIterator(out, appKey, guid)')
+// always visit the messages in arrival order.
+//
 /// Warning
 ///-------
 // An instance of this component is backed by a "real" underlying storage.
@@ -39,6 +55,7 @@
 #include <mqbi_storage.h>
 #include <mqbs_datastore.h>
 #include <mqbs_filestoreprotocol.h>
+#include <mqbs_priorityindex.h>
 #include <mqbu_storagekey.h>
 
 // BMQ
@@ -80,6 +97,7 @@ class VirtualStorage : public mqbi::Storage {
         int                   d_size;
         mutable bmqp::RdaInfo d_rdaInfo;
         unsigned int          d_subscriptionId;
+        bsls::Types::Uint64   d_priorityKey;  // Key in 'd_priorities_mp'
 
         MessageContext(int                  size,
                        const bmqp::RdaInfo& rdaInfo,
@@ -96,6 +114,8 @@ class VirtualStorage : public mqbi::Storage {
 
     typedef GuidList::iterator GuidListIter;
 
+    typedef PriorityIndex<GuidList::const_iterator> Priorities;
+
     typedef mqbi::Storage::StorageKeys StorageKeys;
 
   private:
@@ -117,7 +137,28 @@ class VirtualStorage : public mqbi::Storage {
 
     bsls::Types::Int64 d_totalBytes;
     // Total size (in bytes) of all the messages that
-    // it holds.
+    // it holds, excluding lazy ones.
+
+    bool d_isLazy;
+    // Whether messages added to this storage are only
+    // accounted for, and not materialized.
+
+    bsls::Types::Uint64 d_lazySequenceNumber;
+    // Sequence number, in the owning catalog, of the
+    // first lazy message of this storage.  Only
+    // meaningful if 'd_isLazy' is true.
+
+    bsls::Types::Int64 d_numLazyMessages;
+    // Number of lazy messages of this storage.
+
+    bsls::Types::Int64 d_lazyBytes;
+    // Total size (in bytes) of the lazy messages of
+    // this storage.
+
+    bslma::ManagedPtr<Priorities> d_priorities_mp;
+    // Messages of this storage ordered by priority,
+    // or null if this storage is not priority
+    // ordered.
 
   private:
     // NOT IMPLEMENTED
@@ -186,7 +227,20 @@ class VirtualStorage : public mqbi::Storage {
     bool
     hasMessage(const bmqt::MessageGUID& msgGUID) const BSLS_KEYWORD_OVERRIDE;
     // Return true if this storage has message with the specified
-    // 'msgGUID', false otherwise.
+    // 'msgGUID', false otherwise.  Note that lazy messages are not
+    // accounted for.
+
+    /// Return true if this storage is lazy, and false otherwise.
+    bool isLazy() const;
+
+    /// Return true if this storage is priority ordered, and false
+    /// otherwise.
+    bool isPriorityOrdered() const;
+
+    /// Return the sequence number, in the owning catalog, of the first lazy
+    /// message of this storage.  Behavior is undefined unless this storage
+    /// is lazy.
+    bsls::Types::Uint64 lazySequenceNumber() const;
 
     /// Behavior is undefined if this method is ever invoked.  This method
     /// needs to be implemented as its part of base protocol.
@@ -213,6 +267,12 @@ class VirtualStorage : public mqbi::Storage {
     void loadVirtualStorageDetails(AppIdKeyPairs* buffer) const
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Return false: duplicate PUTs are detected by the physical storage
+    /// this virtual storage belongs to, and the specified `out` is left
+    /// unchanged.
+    bool loadDeduplicationStats(mqbcmd::DeduplicationStats* out) const
+        BSLS_KEYWORD_OVERRIDE;
+
     /// Store in the specified `msgSize` the size, in bytes, of the message
     /// having the specified `msgGUID` if found and return success, or
     /// return a non-zero return code and leave `msgSize` untouched if no
@@ -273,11 +333,39 @@ class VirtualStorage : public mqbi::Storage {
 
     /// Save the message having the specified `msgGUID`, `msgSize`, and
     /// `rdaInfo` into this virtual storage. Return 0 on success or an
-    /// non-zero error code on failure.
+    /// non-zero error code on failure.  The optionally specified
+    /// `priority`, clamped to the levels of a `PriorityIndex`, is only
+    /// used if this storage is priority ordered.
     mqbi::StorageResult::Enum put(const bmqt::MessageGUID& msgGUID,
                                   int                      msgSize,
                                   const bmqp::RdaInfo&     rdaInfo,
-                                  unsigned int             subScriptionId);
+                                  unsigned int             subScriptionId,
+                                  int                      priority = 0);
+
+    /// Make the iterator returned by `getIterator(appKey)` visit the
+    /// messages of this storage by decreasing priority, and then by arrival
+    /// order.  This method has no effect if this storage is already
+    /// priority ordered.  The behavior is undefined unless this storage is
+    /// empty.
+    void enablePriorityOrder();
+
+    /// Make this storage lazy, its first lazy message being the one having
+    /// the specified `sequenceNumber` in the owning catalog.  Behavior is
+    /// undefined if this storage is already lazy.
+    void makeLazy(bsls::Types::Uint64 sequenceNumber);
+
+    /// Make this storage eager, discarding the accounting of its lazy
+    /// messages.  Note that it is the responsibility of the caller to
+    /// materialize the lazy messages, in order, with `put`.
+    void makeEager();
+
+    /// Account for a lazy message having the specified `msgSize`.  Behavior
+    /// is undefined unless this storage is lazy.
+    void putLazy(int msgSize);
+
+    /// Account for the removal of a lazy message having the specified
+    /// `msgSize`.  Behavior is undefined unless this storage is lazy.
+    void removeLazy(int msgSize);
 
     /// Behavior is undefined if this method is ever invoked.  This method
     /// needs to be implemented as its part of base protocol. Please call
@@ -367,6 +455,11 @@ class VirtualStorage : public mqbi::Storage {
     /// needs to be implemented as its part of base protocol.
     bool
     removeVirtualStorage(const mqbu::StorageKey& appKey) BSLS_KEYWORD_OVERRIDE;
+
+    /// Behavior is undefined if this method is ever invoked.  This method
+    /// needs to be implemented as its part of base protocol.
+    void setLazy(const mqbu::StorageKey& appKey,
+                 bool                    isLazy) BSLS_KEYWORD_OVERRIDE;
 };
 
 // ============================
@@ -380,7 +473,25 @@ class VirtualStorageIterator : public mqbi::StorageIterator {
     // DATA
     VirtualStorage* d_virtualStorage_p;
 
-    VirtualStorage::GuidList::const_iterator d_iterator;
+    mutable VirtualStorage::GuidList::const_iterator d_iterator;
+
+    bool d_isPriorityOrdered;
+    // Whether this iterator follows
+    // 'd_virtualStorage_p->d_priorities_mp'
+    // rather than the arrival order.
+
+    VirtualStorage::Priorities::Cursor d_cursor;
+    // Position of this iterator in the
+    // priority index.  Only meaningful if
+    // 'd_isPriorityOrdered' is true.
+
+    mutable VirtualStorage::Priorities::Key d_priorityKey;
+    // Key, in the priority index, of the
+    // message at 'd_iterator'.
+
+    mutable bsls::Types::Uint64 d_syncedVersion;
+    // Version of the priority index when
+    // 'd_iterator' was last computed.
 
     mutable mqbi::StorageMessageAttributes d_attributes;
 
@@ -403,13 +514,16 @@ class VirtualStorageIterator : public mqbi::StorageIterator {
     operator=(const VirtualStorageIterator&);  // = delete
 
   private:
-    // PRIVATE MANIPULATORS
+    // PRIVATE ACCESSORS
 
     /// Clear previous state, if any.  This is required so that new state
     /// can be loaded in `appData`, `options` or `attributes` routines.
-    void clear();
+    void clear() const;
 
-    // PRIVATE ACCESSORS
+    /// Point `d_iterator` at the next message in priority order, if this
+    /// iterator is priority ordered and the priority index changed since
+    /// the last call.
+    void sync() const;
 
     /// Load the internal state of this iterator instance with the
     /// attributes and blob pointed to by the MessageGUID to which this
@@ -423,10 +537,15 @@ class VirtualStorageIterator : public mqbi::StorageIterator {
     // CREATORS
 
     /// Create a new VirtualStorageIterator from the specified `storage` and
-    /// pointing at the specified `initialPosition`.
+    /// pointing at the specified `initialPosition`.  If the optionally
+    /// specified `isPriorityOrdered` is true, `initialPosition` is ignored
+    /// and the iterator visits the messages of `storage` in priority order.
+    /// The behavior is undefined if `isPriorityOrdered` is true and
+    /// `storage` is not priority ordered.
     VirtualStorageIterator(
         VirtualStorage*                                 storage,
-        const VirtualStorage::GuidList::const_iterator& initialPosition);
+        const VirtualStorage::GuidList::const_iterator& initialPosition,
+        bool isPriorityOrdered = false);
 
     /// Destructor
     ~VirtualStorageIterator() BSLS_KEYWORD_OVERRIDE;
@@ -493,6 +612,7 @@ inline VirtualStorage::MessageContext::MessageContext(
 : d_size(size)
 , d_rdaInfo(rdaInfo)
 , d_subscriptionId(subScriptionId)
+, d_priorityKey(0)
 {
     // NOTHING
 }
@@ -546,13 +666,13 @@ inline mqbu::CapacityMeter* VirtualStorage::capacityMeter()
 inline bsls::Types::Int64 VirtualStorage::numMessages(
     BSLS_ANNOTATION_UNUSED const mqbu::StorageKey& appKey) const
 {
-    return d_guids.size();
+    return d_guids.size() + d_numLazyMessages;
 }
 
 inline bsls::Types::Int64 VirtualStorage::numBytes(
     BSLS_ANNOTATION_UNUSED const mqbu::StorageKey& appKey) const
 {
-    return d_totalBytes;
+    return d_totalBytes + d_lazyBytes;
 }
 
 inline bool VirtualStorage::isEmpty() const
@@ -571,6 +691,24 @@ inline bool VirtualStorage::hasMessage(const bmqt::MessageGUID& msgGUID) const
     return 1 == d_guids.count(msgGUID);
 }
 
+inline bool VirtualStorage::isLazy() const
+{
+    return d_isLazy;
+}
+
+inline bool VirtualStorage::isPriorityOrdered() const
+{
+    return d_priorities_mp.get() != 0;
+}
+
+inline bsls::Types::Uint64 VirtualStorage::lazySequenceNumber() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_isLazy);
+
+    return d_lazySequenceNumber;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -68,6 +68,7 @@ using namespace bsl;
 // - remove
 // - removeAll
 // - getIterator
+// - priorityOrder
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -206,7 +207,8 @@ struct Tester {
     }
 
     mqbi::StorageResult::Enum addPhysicalMessages(const MessageGuids guids,
-                                                  const int dataOffset = 0)
+                                                  const int dataOffset = 0,
+                                                  const int priority   = 0)
     {
         for (size_t i = 0; i != guids.size(); i++) {
             const bmqt::MessageGUID& guid = guids[i];
@@ -216,6 +218,7 @@ struct Tester {
                 1,
                 bmqp::MessagePropertiesInfo::makeNoSchema(),
                 bmqt::CompressionAlgorithmType::e_NONE);
+            attributes.setPriority(priority);
 
             const bsl::shared_ptr<bdlbb::Blob> appDataPtr(
                 new (*d_allocator_p)
@@ -761,6 +764,103 @@ static void test9_getIterator()
               mqbi::StorageResult::e_SUCCESS);
 }
 
+static void test10_priorityOrder()
+// ------------------------------------------------------------------------
+// PRIORITY ORDER
+//
+// Concerns:
+//   - The iterator of a priority ordered virtual storage visits messages
+//     by decreasing priority, then by arrival order.
+//   - A message of higher priority added while the iterator is positioned
+//     on lower priority messages is visited next, and no message is
+//     skipped or visited twice.
+//   - Iterators obtained at a given message visit messages in arrival
+//     order.
+//
+// Testing:
+//   enablePriorityOrder()
+//   getIterator(...)
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("PRIORITY ORDER");
+    Tester tester;
+
+    tester.vStorage().enablePriorityOrder();
+    ASSERT(tester.vStorage().isPriorityOrdered());
+    BSLS_ASSERT_OPT(tester.configure(k_INT64_MAX, k_INT64_MAX) == 0);
+
+    // Put 3 messages of priority 1.
+    MessageGuids lowGuids;
+    for (int i = 0; i < 3; ++i) {
+        generateUniqueGUID(&lowGuids);
+    }
+    BSLS_ASSERT_OPT(tester.addPhysicalMessages(lowGuids, 0, 1) ==
+                    mqbi::StorageResult::e_SUCCESS);
+    for (size_t i = 0; i < lowGuids.size(); ++i) {
+        BSLS_ASSERT_OPT(
+            tester.vStorage().put(lowGuids[i],
+                                  k_DEFAULT_MSG_SIZE,
+                                  bmqp::RdaInfo(),
+                                  bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID,
+                                  1) ==
+            mqbi::StorageResult::e_SUCCESS);
+    }
+
+    bslma::ManagedPtr<mqbi::StorageIterator> iterator =
+        tester.vStorage().getIterator(k_APP_KEY);
+    ASSERT_EQ(iterator->guid(), lowGuids[0]);
+    ASSERT(iterator->advance());
+    ASSERT_EQ(iterator->guid(), lowGuids[1]);
+
+    // Put 2 messages of priority 8: they are visited next.
+    MessageGuids highGuids;
+    for (int i = 0; i < 2; ++i) {
+        generateUniqueGUID(&highGuids);
+    }
+    BSLS_ASSERT_OPT(tester.addPhysicalMessages(highGuids, 3, 8) ==
+                    mqbi::StorageResult::e_SUCCESS);
+    for (size_t i = 0; i < highGuids.size(); ++i) {
+        BSLS_ASSERT_OPT(
+            tester.vStorage().put(highGuids[i],
+                                  k_DEFAULT_MSG_SIZE,
+                                  bmqp::RdaInfo(),
+                                  bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID,
+                                  8) ==
+            mqbi::StorageResult::e_SUCCESS);
+    }
+
+    ASSERT(!iterator->atEnd());
+    ASSERT_EQ(iterator->guid(), highGuids[0]);
+    ASSERT_EQ(iterator->attributes().priority(), 8);
+    ASSERT_EQ(
+        *(reinterpret_cast<int*>(iterator->appData()->buffer(0).data())),
+        3);
+    ASSERT(iterator->advance());
+    ASSERT_EQ(iterator->guid(), highGuids[1]);
+    ASSERT(iterator->advance());
+    ASSERT_EQ(iterator->guid(), lowGuids[1]);
+    ASSERT(iterator->advance());
+    ASSERT_EQ(iterator->guid(), lowGuids[2]);
+
+    // Removing the current message moves the iterator to the next one.
+    ASSERT_EQ(tester.vStorage().remove(lowGuids[2]),
+              mqbi::StorageResult::e_SUCCESS);
+    ASSERT(iterator->atEnd());
+
+    iterator->reset();
+    ASSERT_EQ(iterator->guid(), highGuids[0]);
+
+    // Iterators at a given message follow the arrival order.
+    ASSERT_EQ(tester.vStorage().getIterator(&iterator, k_APP_KEY, lowGuids[1]),
+              mqbi::StorageResult::e_SUCCESS);
+    ASSERT_EQ(iterator->guid(), lowGuids[1]);
+    ASSERT(iterator->advance());
+    ASSERT_EQ(iterator->guid(), highGuids[0]);
+
+    ASSERT_EQ(tester.vStorage().removeAll(k_APP_KEY),
+              mqbi::StorageResult::e_SUCCESS);
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -780,6 +880,7 @@ int main(int argc, char* argv[])
 
         switch (_testCase) {
         case 0:
+        case 10: test10_priorityOrder(); break;
         case 9: test9_getIterator(); break;
         case 8: test8_removeAll(); break;
         case 7: test7_remove(); break;
@@ -22,6 +22,8 @@
 
 // BDE
 #include <bdlbb_blob.h>
+#include <bsl_algorithm.h>
+#include <bsl_limits.h>
 #include <bsl_utility.h>
 #include <bslma_allocator.h>
 #include <bsls_annotation.h>
@@ -30,15 +32,131 @@
 namespace BloombergLP {
 namespace mqbs {
 
+// ----------------------------------------
+// struct VirtualStorageCatalog::LazyMessage
+// ----------------------------------------
+
+VirtualStorageCatalog::LazyMessage::LazyMessage(
+    bsls::Types::Uint64  sequenceNumber,
+    int                  size,
+    const bmqp::RdaInfo& rdaInfo,
+    unsigned int         subscriptionId,
+    int                  priority)
+: d_sequenceNumber(sequenceNumber)
+, d_size(size)
+, d_rdaInfo(rdaInfo)
+, d_subscriptionId(subscriptionId)
+, d_priority(priority)
+{
+    // NOTHING
+}
+
+// ---------------------------------------------
+// struct VirtualStorageCatalog::ScheduledMessage
+// ---------------------------------------------
+
+VirtualStorageCatalog::ScheduledMessage::ScheduledMessage(
+    const ScheduleIter&  scheduleIt,
+    int                  size,
+    const bmqp::RdaInfo& rdaInfo,
+    unsigned int         subscriptionId,
+    int                  priority)
+: d_scheduleIt(scheduleIt)
+, d_size(size)
+, d_rdaInfo(rdaInfo)
+, d_subscriptionId(subscriptionId)
+, d_priority(priority)
+{
+    // NOTHING
+}
+
 // ---------------------------
 // class VirtualStorageCatalog
 // ---------------------------
 
+// PRIVATE MANIPULATORS
+void VirtualStorageCatalog::materialize(VirtualStorage* vs)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(vs);
+    BSLS_ASSERT_SAFE(vs->isLazy());
+
+    const bsls::Types::Uint64 firstSequenceNumber = vs->lazySequenceNumber();
+
+    vs->makeEager();
+    --d_numLazyStorages;
+
+    for (LazyMessagesIter it = d_lazyMessages.begin();
+         it != d_lazyMessages.end();
+         ++it) {
+        const LazyMessage& message = it->second;
+        if (message.d_sequenceNumber >= firstSequenceNumber) {
+            vs->put(it->first,
+                    message.d_size,
+                    message.d_rdaInfo,
+                    message.d_subscriptionId,
+                    message.d_priority);  // ignore rc
+        }
+    }
+
+    trimLazyMessages();
+}
+
+void VirtualStorageCatalog::restartLazy(VirtualStorage* vs)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(vs);
+    BSLS_ASSERT_SAFE(vs->isLazy());
+
+    vs->makeEager();
+    vs->makeLazy(d_nextSequenceNumber);
+}
+
+void VirtualStorageCatalog::trimLazyMessages()
+{
+    if (d_numLazyStorages == 0) {
+        d_lazyMessages.clear();
+        return;  // RETURN
+    }
+
+    bsls::Types::Uint64 firstSequenceNumber =
+        bsl::numeric_limits<bsls::Types::Uint64>::max();
+    for (VirtualStoragesConstIter it = d_virtualStorages.begin();
+         it != d_virtualStorages.end();
+         ++it) {
+        if (it->second->isLazy()) {
+            firstSequenceNumber = bsl::min(firstSequenceNumber,
+                                           it->second->lazySequenceNumber());
+        }
+    }
+
+    while (!d_lazyMessages.empty() &&
+           d_lazyMessages.begin()->second.d_sequenceNumber <
+               firstSequenceNumber) {
+        d_lazyMessages.erase(d_lazyMessages.begin());
+    }
+}
+
+// PRIVATE ACCESSORS
+bool VirtualStorageCatalog::isLazyMessage(
+    const VirtualStorage&        vs,
+    const LazyMessagesConstIter& it) const
+{
+    return vs.isLazy() && it != d_lazyMessages.end() &&
+           it->second.d_sequenceNumber >= vs.lazySequenceNumber();
+}
+
 // CREATORS
 VirtualStorageCatalog::VirtualStorageCatalog(mqbi::Storage*    storage,
                                              bslma::Allocator* allocator)
 : d_storage_p(storage)
 , d_virtualStorages(allocator)
+, d_lazyMessages(allocator)
+, d_nextSequenceNumber(0)
+, d_numLazyStorages(0)
+, d_isPriorityOrdered(false)
+, d_schedule(allocator)
+, d_scheduledMessages(allocator)
 , d_allocator_p(allocator)
 {
     // PRECONDITIONS
@@ -58,29 +176,133 @@ VirtualStorageCatalog::put(const bmqt::MessageGUID& msgGUID,
                            int                      msgSize,
                            const bmqp::RdaInfo&     rdaInfo,
                            unsigned int             subScriptionId,
-                           const mqbu::StorageKey&  appKey)
+                           const mqbu::StorageKey&  appKey,
+                           int                      priority)
 {
     if (!appKey.isNull()) {
         VirtualStoragesIter it = d_virtualStorages.find(appKey);
         BSLS_ASSERT_SAFE(it != d_virtualStorages.end());
 
+        if (it->second->isLazy()) {
+            // Preserve the order of the messages in the virtual storage.
+            materialize(it->second.get());
+        }
+
         return it->second->put(msgGUID,
                                msgSize,
                                rdaInfo,
-                               subScriptionId);  // RETURN
+                               subScriptionId,
+                               priority);  // RETURN
     }
 
-    // Add guid to all virtual storages.
+    // Add guid to all virtual storages, only recording it once for all the
+    // lazy ones.
+
+    bool isLazy = false;
+    if (d_numLazyStorages > 0) {
+        isLazy = d_lazyMessages
+                     .insert(bsl::make_pair(msgGUID,
+                                            LazyMessage(d_nextSequenceNumber,
+                                                        msgSize,
+                                                        rdaInfo,
+                                                        subScriptionId,
+                                                        priority)))
+                     .second;
+        if (isLazy) {
+            ++d_nextSequenceNumber;
+        }
+    }
 
     for (VirtualStoragesIter it = d_virtualStorages.begin();
          it != d_virtualStorages.end();
          ++it) {
-        it->second->put(msgGUID, msgSize, rdaInfo, subScriptionId);
+        if (!it->second->isLazy()) {
+            it->second->put(msgGUID,
+                            msgSize,
+                            rdaInfo,
+                            subScriptionId,
+                            priority);
+        }
+        else if (isLazy) {
+            it->second->putLazy(msgSize);
+        }
     }
 
     return mqbi::StorageResult::e_SUCCESS;  // RETURN
 }
 
+mqbi::StorageResult::Enum
+VirtualStorageCatalog::schedule(const bmqt::MessageGUID& msgGUID,
+                                int                      msgSize,
+                                const bmqp::RdaInfo&     rdaInfo,
+                                unsigned int             subScriptionId,
+                                int                      priority,
+                                bsls::Types::Uint64      deliveryTimestamp)
+{
+    if (d_scheduledMessages.find(msgGUID) != d_scheduledMessages.end()) {
+        return mqbi::StorageResult::e_GUID_NOT_UNIQUE;  // RETURN
+    }
+
+    const ScheduleIter scheduleIt = d_schedule.insert(
+        bsl::make_pair(deliveryTimestamp, msgGUID));
+    d_scheduledMessages.insert(bsl::make_pair(
+        msgGUID,
+        ScheduledMessage(scheduleIt,
+                         msgSize,
+                         rdaInfo,
+                         subScriptionId,
+                         priority)));
+
+    return mqbi::StorageResult::e_SUCCESS;
+}
+
+int VirtualStorageCatalog::releaseDueMessages(
+    bsls::Types::Uint64 secondsFromEpoch)
+{
+    int numReleased = 0;
+    while (!d_schedule.empty() &&
+           d_schedule.begin()->first <= secondsFromEpoch) {
+        const bmqt::MessageGUID     msgGUID = d_schedule.begin()->second;
+        const ScheduledMessagesIter it = d_scheduledMessages.find(msgGUID);
+        BSLS_ASSERT_SAFE(it != d_scheduledMessages.end());
+
+        const ScheduledMessage message = it->second;
+        d_scheduledMessages.erase(it);
+        d_schedule.erase(d_schedule.begin());
+
+        put(msgGUID,
+            message.d_size,
+            message.d_rdaInfo,
+            message.d_subscriptionId,
+            mqbu::StorageKey::k_NULL_KEY,
+            message.d_priority);  // ignore rc
+        ++numReleased;
+    }
+
+    return numReleased;
+}
+
+bool VirtualStorageCatalog::release(const bmqt::MessageGUID& msgGUID)
+{
+    const ScheduledMessagesIter it = d_scheduledMessages.find(msgGUID);
+    if (it == d_scheduledMessages.end()) {
+        return false;  // RETURN
+    }
+
+    const ScheduledMessage message = it->second;
+    d_schedule.erase(message.d_scheduleIt);
+    d_scheduledMessages.erase(it);
+
+    put(msgGUID,
+        message.d_size,
+        message.d_rdaInfo,
+        message.d_subscriptionId,
+        mqbu::StorageKey::k_NULL_KEY,
+        message.d_priority);  // ignore rc
+
+    return true;
+}
+
 bslma::ManagedPtr<mqbi::StorageIterator>
 VirtualStorageCatalog::getIterator(const mqbu::StorageKey& appKey)
 {
@@ -89,6 +311,13 @@ VirtualStorageCatalog::getIterator(const mqbu::StorageKey& appKey)
 
     VirtualStoragesIter it = d_virtualStorages.find(appKey);
     BSLS_ASSERT_SAFE(it != d_virtualStorages.end());
+
+    if (it->second->isLazy()) {
+        // Iterating the virtual storage (e.g., to purge or list it) must
+        // observe all of its messages.
+        materialize(it->second.get());
+    }
+
     return it->second->getIterator(appKey);
 }
 
@@ -102,6 +331,11 @@ mqbi::StorageResult::Enum VirtualStorageCatalog::getIterator(
 
     VirtualStoragesIter it = d_virtualStorages.find(appKey);
     BSLS_ASSERT_SAFE(it != d_virtualStorages.end());
+
+    if (isLazyMessage(*it->second, d_lazyMessages.find(msgGUID))) {
+        materialize(it->second.get());
+    }
+
     return it->second->getIterator(out, appKey, msgGUID);
 }
 
@@ -112,14 +346,41 @@ VirtualStorageCatalog::remove(const bmqt::MessageGUID& msgGUID,
     if (!appKey.isNull()) {
         VirtualStoragesIter it = d_virtualStorages.find(appKey);
         BSLS_ASSERT_SAFE(it != d_virtualStorages.end());
+
+        if (isLazyMessage(*it->second, d_lazyMessages.find(msgGUID))) {
+            materialize(it->second.get());
+        }
+
         return it->second->remove(msgGUID);  // RETURN
     }
 
     // Remove guid from all virtual storages.
+    const LazyMessagesIter lazyIt = d_lazyMessages.empty()
+                                        ? d_lazyMessages.end()
+                                        : d_lazyMessages.find(msgGUID);
+
     for (VirtualStoragesIter it = d_virtualStorages.begin();
          it != d_virtualStorages.end();
          ++it) {
-        it->second->remove(msgGUID);  // ignore rc
+        if (isLazyMessage(*it->second, lazyIt)) {
+            it->second->removeLazy(lazyIt->second.d_size);
+        }
+        else {
+            it->second->remove(msgGUID);  // ignore rc
+        }
+    }
+
+    if (lazyIt != d_lazyMessages.end()) {
+        d_lazyMessages.erase(lazyIt);
+    }
+
+    if (!d_scheduledMessages.empty()) {
+        const ScheduledMessagesIter scheduledIt = d_scheduledMessages.find(
+            msgGUID);
+        if (scheduledIt != d_scheduledMessages.end()) {
+            d_schedule.erase(scheduledIt->second.d_scheduleIt);
+            d_scheduledMessages.erase(scheduledIt);
+        }
     }
 
     return mqbi::StorageResult::e_SUCCESS;
@@ -131,7 +392,14 @@ VirtualStorageCatalog::removeAll(const mqbu::StorageKey& appKey)
     if (!appKey.isNull()) {
         VirtualStoragesIter it = d_virtualStorages.find(appKey);
         BSLS_ASSERT_SAFE(it != d_virtualStorages.end());
-        return it->second->removeAll(appKey);  // RETURN
+
+        const mqbi::StorageResult::Enum rc = it->second->removeAll(appKey);
+        if (it->second->isLazy()) {
+            restartLazy(it->second.get());
+            trimLazyMessages();
+        }
+
+        return rc;  // RETURN
     }
 
     // Clear all virtual storages.
@@ -139,7 +407,13 @@ VirtualStorageCatalog::removeAll(const mqbu::StorageKey& appKey)
          it != d_virtualStorages.end();
          ++it) {
         it->second->removeAll(it->first);  // ignore rc
+        if (it->second->isLazy()) {
+            restartLazy(it->second.get());
+        }
     }
+    d_lazyMessages.clear();
+    d_schedule.clear();
+    d_scheduledMessages.clear();
 
     return mqbi::StorageResult::e_SUCCESS;
 }
@@ -170,6 +444,9 @@ int VirtualStorageCatalog::addVirtualStorage(bsl::ostream& errorDescription,
                       appId,
                       appKey,
                       d_allocator_p);
+    if (d_isPriorityOrdered) {
+        vsp->enablePriorityOrder();
+    }
     d_virtualStorages.insert(bsl::make_pair(appKey, vsp));
 
     return 0;
@@ -181,12 +458,21 @@ bool VirtualStorageCatalog::removeVirtualStorage(
     if (appKey.isNull()) {
         // Remove all virtual storages
         d_virtualStorages.clear();
+        d_lazyMessages.clear();
+        d_numLazyStorages = 0;
+        d_schedule.clear();
+        d_scheduledMessages.clear();
         return true;  // RETURN
     }
 
     VirtualStoragesConstIter it = d_virtualStorages.find(appKey);
     if (it != d_virtualStorages.end()) {
+        const bool isLazy = it->second->isLazy();
         d_virtualStorages.erase(it);
+        if (isLazy) {
+            --d_numLazyStorages;
+            trimLazyMessages();
+        }
         return true;  // RETURN
     }
 
@@ -204,6 +490,37 @@ VirtualStorageCatalog::virtualStorage(const mqbu::StorageKey& appKey)
     return it->second.get();
 }
 
+void VirtualStorageCatalog::setLazy(const mqbu::StorageKey& appKey,
+                                    bool                    isLazy)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!appKey.isNull());
+
+    VirtualStoragesIter it = d_virtualStorages.find(appKey);
+    if (it == d_virtualStorages.end() || it->second->isLazy() == isLazy) {
+        return;  // RETURN
+    }
+
+    if (isLazy) {
+        it->second->makeLazy(d_nextSequenceNumber);
+        ++d_numLazyStorages;
+    }
+    else {
+        materialize(it->second.get());
+    }
+}
+
+void VirtualStorageCatalog::enablePriorityOrder()
+{
+    d_isPriorityOrdered = true;
+
+    for (VirtualStoragesIter it = d_virtualStorages.begin();
+         it != d_virtualStorages.end();
+         ++it) {
+        it->second->enablePriorityOrder();
+    }
+}
+
 // ACCESSORS
 bool VirtualStorageCatalog::hasVirtualStorage(const mqbu::StorageKey& appKey,
                                               bsl::string* appId) const
@@ -260,7 +577,10 @@ bool VirtualStorageCatalog::hasMessage(const bmqt::MessageGUID& msgGUID) const
         }
     }
 
-    return false;
+    // Every message kept on behalf of the lazy virtual storages is lazy in at
+    // least one of them.
+    return d_lazyMessages.find(msgGUID) != d_lazyMessages.end() ||
+           d_scheduledMessages.find(msgGUID) != d_scheduledMessages.end();
 }
 
 void VirtualStorageCatalog::loadVirtualStorageDetails(
@@ -24,6 +24,39 @@
 //
 //@DESCRIPTION: 'mqbs::VirtualStorageCatalog' provides a collection of virtual
 // storages associated with a queue.
+//
+/// Lazy Virtual Storages
+///---------------------
+// A virtual storage can be made lazy (see 'setLazy'), typically while its
+// appId has no consumer.  Messages added to all virtual storages are then not
+// materialized in the lazy virtual storages; instead, the catalog records each
+// of them once, with a sequence number, in a list shared by all the lazy
+// virtual storages, and a lazy virtual storage only remembers the sequence
+// number of its first lazy message.  Therefore, adding a message to a queue
+// having many idle appIds costs one insertion instead of one per appId.
+//
+// The lazy messages of a virtual storage are materialized, in order, when it
+// is made eager again, when it is iterated from the start, or when one of them
+// is accessed through the virtual storage (i.e., 'getIterator' at, or 'remove'
+// of, a lazy message), so that a virtual storage never observes its messages
+// out of order.  Note that an iterator obtained before the virtual storage was
+// made lazy observes its lazy messages once they are materialized.  Lazy
+// messages are trimmed from the shared list once no lazy virtual storage
+// refers to them.
+//
+/// Scheduled Messages
+///------------------
+// A message added to all virtual storages can be scheduled for a later
+// delivery time (see 'schedule').  It is then kept out of all virtual storages
+// until 'releaseDueMessages' is called with a time not earlier than its
+// delivery time, at which point it is added to all of them, as if it had just
+// arrived.  Scheduled messages are indexed by delivery time, so that releasing
+// the due ones never visits the others.  A scheduled message can also be
+// released ahead of its delivery time (see 'release'), e.g. when a replica
+// receives a CONFIRM for a message the primary already released.  Note that
+// scheduled messages are only removed by removing them from all virtual
+// storages (e.g., when they expire), or by removing all messages of all
+// virtual storages.
 
 // MQB
 
@@ -32,16 +65,23 @@
 #include <mqbu_storagekey.h>
 
 // BMQ
+#include <bmqp_protocol.h>
 #include <bmqt_messageguid.h>
 
+// MWC
+#include <mwcc_orderedhashmap.h>
+
 // BDE
+#include <bsl_map.h>
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
+#include <bslh_hash.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 
@@ -65,6 +105,60 @@ class VirtualStorageCatalog {
 
     typedef VirtualStorages::const_iterator VirtualStoragesConstIter;
 
+    /// Message added to all virtual storages while some of them are lazy.
+    struct LazyMessage {
+        bsls::Types::Uint64 d_sequenceNumber;
+        int                 d_size;
+        bmqp::RdaInfo       d_rdaInfo;
+        unsigned int        d_subscriptionId;
+        int                 d_priority;
+
+        LazyMessage(bsls::Types::Uint64  sequenceNumber,
+                    int                  size,
+                    const bmqp::RdaInfo& rdaInfo,
+                    unsigned int         subscriptionId,
+                    int                  priority);
+    };
+
+    /// msgGUID -> LazyMessage, in increasing sequence number order.
+    typedef mwcc::OrderedHashMap<bmqt::MessageGUID,
+                                 LazyMessage,
+                                 bslh::Hash<bmqt::MessageGUIDHashAlgo> >
+        LazyMessages;
+
+    typedef LazyMessages::iterator LazyMessagesIter;
+
+    typedef LazyMessages::const_iterator LazyMessagesConstIter;
+
+    /// deliveryTimestamp -> msgGUID, in delivery order, and then in
+    /// scheduling order.
+    typedef bsl::multimap<bsls::Types::Uint64, bmqt::MessageGUID> Schedule;
+
+    typedef Schedule::iterator ScheduleIter;
+
+    /// Message kept out of all virtual storages until its delivery time.
+    struct ScheduledMessage {
+        ScheduleIter  d_scheduleIt;
+        int           d_size;
+        bmqp::RdaInfo d_rdaInfo;
+        unsigned int  d_subscriptionId;
+        int           d_priority;
+
+        ScheduledMessage(const ScheduleIter&  scheduleIt,
+                         int                  size,
+                         const bmqp::RdaInfo& rdaInfo,
+                         unsigned int         subscriptionId,
+                         int                  priority);
+    };
+
+    /// msgGUID -> ScheduledMessage
+    typedef bsl::unordered_map<bmqt::MessageGUID,
+                               ScheduledMessage,
+                               bslh::Hash<bmqt::MessageGUIDHashAlgo> >
+        ScheduledMessages;
+
+    typedef ScheduledMessages::iterator ScheduledMessagesIter;
+
   private:
     // DATA
     mqbi::Storage* d_storage_p;  // Physical storage underlying all
@@ -75,6 +169,28 @@ class VirtualStorageCatalog {
     // Map of appKey to corresponding
     // virtual storage
 
+    LazyMessages d_lazyMessages;
+    // Messages which are lazy in at least
+    // one lazy virtual storage.  Empty if
+    // there is no lazy virtual storage
+
+    bsls::Types::Uint64 d_nextSequenceNumber;
+    // Sequence number of the next lazy
+    // message
+
+    int d_numLazyStorages;
+    // Number of lazy virtual storages
+
+    bool d_isPriorityOrdered;
+    // Whether virtual storages are priority
+    // ordered
+
+    Schedule d_schedule;
+    // Scheduled messages, by delivery time
+
+    ScheduledMessages d_scheduledMessages;
+    // Scheduled messages, by GUID
+
     bslma::Allocator* d_allocator_p;  // Allocator to use
 
   private:
@@ -83,6 +199,27 @@ class VirtualStorageCatalog {
     VirtualStorageCatalog&
     operator=(const VirtualStorageCatalog&);  // = delete
 
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Materialize, in order, all lazy messages of the specified lazy
+    /// `vs`, and make it eager.
+    void materialize(VirtualStorage* vs);
+
+    /// Make the specified lazy `vs` have no lazy message.
+    void restartLazy(VirtualStorage* vs);
+
+    /// Erase from the list of lazy messages those which are not lazy in
+    /// any lazy virtual storage anymore.
+    void trimLazyMessages();
+
+    // PRIVATE ACCESSORS
+
+    /// Return true if the specified `it` refers to a lazy message of the
+    /// specified `vs`, and false otherwise.
+    bool isLazyMessage(const VirtualStorage&        vs,
+                       const LazyMessagesConstIter& it) const;
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(VirtualStorageCatalog,
@@ -108,12 +245,40 @@ class VirtualStorageCatalog {
     /// Save the message having the specified `msgGUID`, `msgSize` and
     /// `rdaInfo` to the virtual storage associated with the specified
     /// `appKey`.  Note that if `appKey` is null, the message will be added
-    /// to all virtual storages maintained by this instance.
+    /// to all virtual storages maintained by this instance.  The optionally
+    /// specified `priority` is only used if this catalog is priority
+    /// ordered.
     mqbi::StorageResult::Enum put(const bmqt::MessageGUID& msgGUID,
                                   int                      msgSize,
                                   const bmqp::RdaInfo&     rdaInfo,
                                   unsigned int             subScriptionId,
-                                  const mqbu::StorageKey&  appKey);
+                                  const mqbu::StorageKey&  appKey,
+                                  int                      priority = 0);
+
+    /// Keep the message having the specified `msgGUID`, `msgSize`,
+    /// `rdaInfo`, `subScriptionId` and `priority` out of all virtual
+    /// storages until the specified `deliveryTimestamp`, in seconds from
+    /// epoch, after which `releaseDueMessages` adds it to all of them.
+    /// Return `e_GUID_NOT_UNIQUE` if a message with `msgGUID` is already
+    /// scheduled, and `e_SUCCESS` otherwise.
+    mqbi::StorageResult::Enum
+    schedule(const bmqt::MessageGUID& msgGUID,
+             int                      msgSize,
+             const bmqp::RdaInfo&     rdaInfo,
+             unsigned int             subScriptionId,
+             int                      priority,
+             bsls::Types::Uint64      deliveryTimestamp);
+
+    /// Add to all virtual storages the scheduled messages whose delivery
+    /// time is not later than the specified `secondsFromEpoch`, in order of
+    /// delivery time and then of scheduling, and return their number.
+    int releaseDueMessages(bsls::Types::Uint64 secondsFromEpoch);
+
+    /// Add to all virtual storages the message having the specified
+    /// `msgGUID` if it is scheduled, regardless of its delivery time, and
+    /// return true.  Return false, with no effect, if `msgGUID` is not
+    /// scheduled.
+    bool release(const bmqt::MessageGUID& msgGUID);
 
     /// Get an iterator for items stored in the virtual storage identified
     /// by the specified `appKey`.  Iterator will point to point to the
@@ -121,7 +286,8 @@ class VirtualStorageCatalog {
     /// that if `appKey` is null, an iterator over the underlying physical
     /// storage will be returned.  Also note that because `Storage` and
     /// `StorageIterator` are interfaces, the implementation of this method
-    /// will allocate, so it's recommended to keep the iterator.
+    /// will allocate, so it's recommended to keep the iterator.  Note that
+    /// the lazy messages of the virtual storage, if any, are materialized.
     /// TBD: Is the behavior undefined if `appKey` is null?
     bslma::ManagedPtr<mqbi::StorageIterator>
     getIterator(const mqbu::StorageKey& appKey);
@@ -174,6 +340,18 @@ class VirtualStorageCatalog {
 
     mqbi::Storage* virtualStorage(const mqbu::StorageKey& appKey);
 
+    /// Make the virtual storage identified by the specified `appKey` lazy if
+    /// the specified `isLazy` is true, and materialize its lazy messages
+    /// and make it eager otherwise.  This method has no effect if there is
+    /// no virtual storage with `appKey`, or if it already is in the
+    /// requested state.  Behavior is undefined unless `appKey` is non-null.
+    void setLazy(const mqbu::StorageKey& appKey, bool isLazy);
+
+    /// Make all virtual storages, including the ones added later, priority
+    /// ordered (see `VirtualStorage::enablePriorityOrder`).  The behavior
+    /// is undefined unless all virtual storages are empty.
+    void enablePriorityOrder();
+
     // ACCESSORS
 
     /// Return the number of virtual storages registered with this instance.
@@ -208,8 +386,27 @@ class VirtualStorageCatalog {
     bsls::Types::Int64 numBytes(const mqbu::StorageKey& appKey) const;
 
     /// Return true if there is a virtual storage associated with any appKey
-    /// which contains the specified `msgGUID`.  Return false otherwise.
+    /// which contains the specified `msgGUID`, including as a lazy message,
+    /// or if `msgGUID` is scheduled.  Return false otherwise.
     bool hasMessage(const bmqt::MessageGUID& msgGUID) const;
+
+    /// Return the number of lazy virtual storages.
+    int numLazyStorages() const;
+
+    /// Return true if the virtual storages are priority ordered, and false
+    /// otherwise.
+    bool isPriorityOrdered() const;
+
+    /// Return the number of messages kept on behalf of the lazy virtual
+    /// storages.
+    int numLazyMessages() const;
+
+    /// Return the number of scheduled messages.
+    int numScheduledMessages() const;
+
+    /// Return the delivery time, in seconds from epoch, of the earliest
+    /// scheduled message, or zero if there is no scheduled message.
+    bsls::Types::Uint64 nextDeliveryTimestamp() const;
 };
 
 // ============================================================================
@@ -226,6 +423,32 @@ inline int VirtualStorageCatalog::numVirtualStorages() const
     return d_virtualStorages.size();
 }
 
+inline int VirtualStorageCatalog::numLazyStorages() const
+{
+    return d_numLazyStorages;
+}
+
+inline bool VirtualStorageCatalog::isPriorityOrdered() const
+{
+    return d_isPriorityOrdered;
+}
+
+inline int VirtualStorageCatalog::numLazyMessages() const
+{
+    return d_lazyMessages.size();
+}
+
+inline int VirtualStorageCatalog::numScheduledMessages() const
+{
+    return static_cast<int>(d_scheduledMessages.size());
+}
+
+inline bsls::Types::Uint64
+VirtualStorageCatalog::nextDeliveryTimestamp() const
+{
+    return d_schedule.empty() ? 0 : d_schedule.begin()->first;
+}
+
 inline bsls::Types::Int64
 VirtualStorageCatalog::numMessages(const mqbu::StorageKey& appKey) const
 {
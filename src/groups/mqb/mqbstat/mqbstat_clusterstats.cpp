@@ -47,6 +47,10 @@ static const char k_CLUSTER_STAT_NAME[] = "clusters";
 /// statistics)
 static const char k_CLUSTER_NODES_STAT_NAME[] = "clusterNodes";
 
+/// Number of shards of the cluster node's statistics, which are updated by
+/// the dispatcher threads of all the queues exchanging messages with a node.
+static const int k_CLUSTER_NODES_STAT_NUM_SHARDS = 8;
+
 //-------------------------
 // struct ClusterStatsIndex
 //-------------------------
@@ -83,6 +87,9 @@ struct ClusterStatsIndex {
         ,
         e_PARTITION_JOURNAL_BYTES
         // Value: Outstanding bytes in the journal file of the partition.
+        ,
+        e_PARTITION_GC_TIME
+        // Value: Nanoseconds time spent in a GC tick of the partition.
     };
 };
 
@@ -205,6 +212,12 @@ bsls::Types::Int64 ClusterStats::getValue(const mwcst::StatContext& context,
         return value == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0
                                                                        : value;
     }
+    case Stat::e_PARTITION_GC_TIME: {
+        const bsls::Types::Int64 value = STAT_RANGE(rangeMax,
+                                                    e_PARTITION_GC_TIME);
+        return value == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0
+                                                                       : value;
+    }
 
     default: {
         BSLS_ASSERT_SAFE(false && "Attempting to access an unknown stat");
@@ -277,6 +290,9 @@ void ClusterStats::onPartitionEvent(PartitionEventType::Enum type,
     case PartitionEventType::e_PARTITION_ROLLOVER: {
         sc->reportValue(ClusterStatsIndex::e_PARTITION_ROLLOVER_TIME, value);
     } break;
+    case PartitionEventType::e_PARTITION_GC: {
+        sc->reportValue(ClusterStatsIndex::e_PARTITION_GC_TIME, value);
+    } break;
     default: {
         BSLS_ASSERT_SAFE(false && "Unknown event type");
     } break;
@@ -569,7 +585,8 @@ ClusterStatsUtil::initializeStatContextCluster(int               historySize,
         .value("partition_status")
         .value("partition.rollover_time", mwcst::StatValue::DMCST_DISCRETE)
         .value("partition.data_bytes", mwcst::StatValue::DMCST_DISCRETE)
-        .value("partition.journal_bytes", mwcst::StatValue::DMCST_DISCRETE);
+        .value("partition.journal_bytes", mwcst::StatValue::DMCST_DISCRETE)
+        .value("partition.gc_time", mwcst::StatValue::DMCST_DISCRETE);
 
     // NOTE: For the clusters, the stat context will have two levels of
     //       children, first level is per cluster, and second level is per
@@ -598,9 +615,13 @@ ClusterStatsUtil::initializeStatContextClusterNodes(
         .statValueAllocator(allocator)
         .storeExpiredSubcontextValues(true)
         .value("ack")
+        .valueShards(k_CLUSTER_NODES_STAT_NUM_SHARDS)
         .value("confirm")
+        .valueShards(k_CLUSTER_NODES_STAT_NUM_SHARDS)
         .value("push")
-        .value("put");
+        .valueShards(k_CLUSTER_NODES_STAT_NUM_SHARDS)
+        .value("put")
+        .valueShards(k_CLUSTER_NODES_STAT_NUM_SHARDS);
     // NOTE: If the stats are using too much memory, we could reconsider
     //       in_event and out_event to be using atomic int and not stat value.
 
@@ -70,6 +70,10 @@ class ClusterStats {
         enum Enum {
             e_PARTITION_ROLLOVER
             // Time in nanoseconds it took for the rollover operation.
+            ,
+            e_PARTITION_GC
+            // Time in nanoseconds spent garbage-collecting expired messages
+            // and history during one GC tick of the partition.
         };
     };
 
@@ -109,6 +113,11 @@ class ClusterStats {
             e_PARTITION_JOURNAL_CONTENT
             // Maximum observed outstanding bytes in the journal file of the
             // partition.
+            ,
+            e_PARTITION_GC_TIME
+            // Time in nanoseconds spent in a GC tick of the partition.  Note
+            // that in case when more than one GC tick happened during the
+            // report interval, then the maximum time is returned.
         };
     };
 
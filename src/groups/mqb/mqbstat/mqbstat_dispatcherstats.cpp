@@ -0,0 +1,309 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbstat_dispatcherstats.cpp                                        -*-C++-*-
+#include <mqbstat_dispatcherstats.h>
+
+#include <mqbscm_version.h>
+// MWC
+#include <mwcsys_time.h>
+#include <mwcu_memoutstream.h>
+#include <mwcu_printutil.h>
+
+// BDE
+#include <bsl_cstring.h>
+#include <bsl_iomanip.h>
+#include <bsl_ostream.h>
+#include <bslmt_lockguard.h>
+
+namespace BloombergLP {
+namespace mqbstat {
+
+namespace {
+
+const int k_EVENT_TYPE_WIDTH = 22;
+const int k_COLUMN_WIDTH     = 12;
+
+/// Header of each of the buckets of the histograms.
+const char* const k_BUCKET_HEADERS[DispatcherStats::k_NUM_BUCKETS] = {
+    "<1us",
+    "<4us",
+    "<16us",
+    "<64us",
+    "<256us",
+    "<1ms",
+    "<4ms",
+    "<16ms",
+    "<64ms",
+    ">=64ms"};
+
+/// Print the specified `timeNs` time interval, in nanoseconds, right aligned
+/// in a column of the specified `width`, to the specified `stream`.
+void printTime(bsl::ostream& stream, int width, bsls::Types::Int64 timeNs)
+{
+    mwcu::MemOutStream os;
+    os << mwcu::PrintUtil::prettyTimeInterval(timeNs);
+    stream << bsl::setw(width) << os.str();
+}
+
+/// Print the specified `value` with groups of digits, right aligned in a
+/// column of the specified `width`, to the specified `stream`.
+void printCount(bsl::ostream& stream, int width, bsls::Types::Int64 value)
+{
+    mwcu::MemOutStream os;
+    os << mwcu::PrintUtil::prettyNumber(value);
+    stream << bsl::setw(width) << os.str();
+}
+
+}  // close unnamed namespace
+
+// ----------------------------------
+// struct DispatcherStats::EventStats
+// ----------------------------------
+
+DispatcherStats::EventStats::EventStats()
+: d_count(0)
+, d_totalTime(0)
+, d_maxTime(0)
+{
+    d_maxClient[0] = '\0';
+}
+
+// ---------------------
+// class DispatcherStats
+// ---------------------
+
+// PRIVATE MANIPULATORS
+void DispatcherStats::updateMax(ProcessorStats*               processor,
+                                EventStats*                   stats,
+                                bsls::Types::Int64            duration,
+                                const mqbi::DispatcherClient* client)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&processor->d_mutex);  // LOCK
+
+    stats->d_maxTime.storeRelaxed(duration);
+    if (client) {
+        bsl::strncpy(stats->d_maxClient,
+                     client->description().c_str(),
+                     k_MAX_CLIENT_LENGTH - 1);
+        stats->d_maxClient[k_MAX_CLIENT_LENGTH - 1] = '\0';
+    }
+    else {
+        stats->d_maxClient[0] = '\0';
+    }
+}
+
+// PRIVATE ACCESSORS
+const DispatcherStats::EventStats&
+DispatcherStats::eventStats(mqbi::DispatcherClientType::Enum clientType,
+                            int                              processorId,
+                            mqbi::DispatcherEventType::Enum  eventType) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= processorId &&
+                     processorId < numProcessors(clientType));
+    BSLS_ASSERT_SAFE(0 <= eventType && eventType < k_NUM_EVENT_TYPES);
+
+    return d_processors[clientType][processorId]->d_events[eventType];
+}
+
+// CREATORS
+DispatcherStats::DispatcherStats(const mqbcfg::DispatcherConfig& config,
+                                 bslma::Allocator*               allocator)
+: d_processors(mqbi::DispatcherClientType::k_COUNT, allocator)
+, d_resetTime(mwcsys::Time::highResolutionTimer())
+{
+    const int numProcessors[mqbi::DispatcherClientType::k_COUNT] = {
+        config.sessions().numProcessors(),
+        config.queues().numProcessors(),
+        config.clusters().numProcessors()};
+
+    for (int type = 0; type < mqbi::DispatcherClientType::k_COUNT; ++type) {
+        d_processors[type].reserve(numProcessors[type]);
+        for (int i = 0; i < numProcessors[type]; ++i) {
+            d_processors[type].push_back(
+                bsl::allocate_shared<ProcessorStats>(allocator));
+        }
+    }
+}
+
+// MANIPULATORS
+void DispatcherStats::reset()
+{
+    for (size_t type = 0; type < d_processors.size(); ++type) {
+        for (size_t i = 0; i < d_processors[type].size(); ++i) {
+            ProcessorStats& processor = *d_processors[type][i];
+
+            bslmt::LockGuard<bslmt::Mutex> guard(&processor.d_mutex);  // LOCK
+            for (int e = 0; e < k_NUM_EVENT_TYPES; ++e) {
+                EventStats& stats = processor.d_events[e];
+                stats.d_count.storeRelaxed(0);
+                stats.d_totalTime.storeRelaxed(0);
+                stats.d_maxTime.storeRelaxed(0);
+                for (int b = 0; b < k_NUM_BUCKETS; ++b) {
+                    stats.d_buckets[b].storeRelaxed(0);
+                }
+                stats.d_maxClient[0] = '\0';
+            }
+        }
+    }
+
+    d_resetTime = mwcsys::Time::highResolutionTimer();
+}
+
+// ACCESSORS
+bsls::Types::Int64
+DispatcherStats::eventCount(mqbi::DispatcherClientType::Enum clientType,
+                            int                              processorId,
+                            mqbi::DispatcherEventType::Enum  eventType) const
+{
+    return eventStats(clientType, processorId, eventType)
+        .d_count.loadRelaxed();
+}
+
+bsls::Types::Int64
+DispatcherStats::totalTime(mqbi::DispatcherClientType::Enum clientType,
+                           int                              processorId,
+                           mqbi::DispatcherEventType::Enum  eventType) const
+{
+    return eventStats(clientType, processorId, eventType)
+        .d_totalTime.loadRelaxed();
+}
+
+bsls::Types::Int64
+DispatcherStats::maxTime(mqbi::DispatcherClientType::Enum clientType,
+                         int                              processorId,
+                         mqbi::DispatcherEventType::Enum  eventType,
+                         bsl::string*                     client) const
+{
+    const EventStats& stats = eventStats(clientType, processorId, eventType);
+    ProcessorStats&   processor = *d_processors[clientType][processorId];
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&processor.d_mutex);  // LOCK
+    if (client) {
+        client->assign(stats.d_maxClient);
+    }
+    return stats.d_maxTime.loadRelaxed();
+}
+
+bsls::Types::Int64
+DispatcherStats::bucketCount(mqbi::DispatcherClientType::Enum clientType,
+                             int                              processorId,
+                             mqbi::DispatcherEventType::Enum  eventType,
+                             int                              bucket) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= bucket && bucket < k_NUM_BUCKETS);
+
+    return eventStats(clientType, processorId, eventType)
+        .d_buckets[bucket]
+        .loadRelaxed();
+}
+
+void DispatcherStats::print(bsl::ostream& stream) const
+{
+    const bsls::Types::Int64 elapsed = mwcsys::Time::highResolutionTimer() -
+                                       d_resetTime.loadRelaxed();
+
+    stream << "Dispatcher events processed over the last "
+           << mwcu::PrintUtil::prettyTimeInterval(elapsed) << "\n";
+
+    bsl::string client;
+    for (int type = 0; type < mqbi::DispatcherClientType::k_COUNT; ++type) {
+        const mqbi::DispatcherClientType::Enum clientType =
+            static_cast<mqbi::DispatcherClientType::Enum>(type);
+
+        for (int i = 0; i < numProcessors(clientType); ++i) {
+            bsls::Types::Int64 busyTime = 0;
+            for (int e = 0; e < k_NUM_EVENT_TYPES; ++e) {
+                busyTime += totalTime(
+                    clientType,
+                    i,
+                    static_cast<mqbi::DispatcherEventType::Enum>(e));
+            }
+
+            stream << "\n"
+                   << clientType << " processor #" << i << ": busy "
+                   << mwcu::PrintUtil::prettyNumber(
+                          elapsed > 0 ? 100.0 * busyTime / elapsed : 0.0)
+                   << "% ("
+                   << mwcu::PrintUtil::prettyTimeInterval(busyTime) << ")\n";
+            if (busyTime == 0) {
+                continue;  // CONTINUE
+            }
+
+            // Counters
+            stream << "    " << bsl::left << bsl::setw(k_EVENT_TYPE_WIDTH)
+                   << "Event type" << bsl::right
+                   << bsl::setw(k_COLUMN_WIDTH) << "Count"
+                   << bsl::setw(k_COLUMN_WIDTH) << "Mean"
+                   << bsl::setw(k_COLUMN_WIDTH) << "Max"
+                   << "  Max client\n";
+            for (int e = 0; e < k_NUM_EVENT_TYPES; ++e) {
+                const mqbi::DispatcherEventType::Enum eventType =
+                    static_cast<mqbi::DispatcherEventType::Enum>(e);
+                const bsls::Types::Int64 count = eventCount(clientType,
+                                                            i,
+                                                            eventType);
+                if (count == 0) {
+                    continue;  // CONTINUE
+                }
+
+                const bsls::Types::Int64 max =
+                    maxTime(clientType, i, eventType, &client);
+
+                stream << "    " << bsl::left
+                       << bsl::setw(k_EVENT_TYPE_WIDTH)
+                       << mqbi::DispatcherEventType::toAscii(eventType)
+                       << bsl::right;
+                printCount(stream, k_COLUMN_WIDTH, count);
+                printTime(stream,
+                          k_COLUMN_WIDTH,
+                          totalTime(clientType, i, eventType) / count);
+                printTime(stream, k_COLUMN_WIDTH, max);
+                stream << "  " << client << "\n";
+            }
+
+            // Histograms
+            stream << "    " << bsl::left << bsl::setw(k_EVENT_TYPE_WIDTH)
+                   << "Processing time" << bsl::right;
+            for (int b = 0; b < k_NUM_BUCKETS; ++b) {
+                stream << bsl::setw(k_COLUMN_WIDTH) << k_BUCKET_HEADERS[b];
+            }
+            stream << "\n";
+            for (int e = 0; e < k_NUM_EVENT_TYPES; ++e) {
+                const mqbi::DispatcherEventType::Enum eventType =
+                    static_cast<mqbi::DispatcherEventType::Enum>(e);
+                if (eventCount(clientType, i, eventType) == 0) {
+                    continue;  // CONTINUE
+                }
+
+                stream << "    " << bsl::left
+                       << bsl::setw(k_EVENT_TYPE_WIDTH)
+                       << mqbi::DispatcherEventType::toAscii(eventType)
+                       << bsl::right;
+                for (int b = 0; b < k_NUM_BUCKETS; ++b) {
+                    printCount(stream,
+                               k_COLUMN_WIDTH,
+                               bucketCount(clientType, i, eventType, b));
+                }
+                stream << "\n";
+            }
+        }
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
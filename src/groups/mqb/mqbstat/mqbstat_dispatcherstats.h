@@ -0,0 +1,317 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbstat_dispatcherstats.h                                          -*-C++-*-
+#ifndef INCLUDED_MQBSTAT_DISPATCHERSTATS
+#define INCLUDED_MQBSTAT_DISPATCHERSTATS
+
+//@PURPOSE: Provide a profile of the events processed by the dispatcher.
+//
+//@CLASSES:
+//  mqbstat::DispatcherStats: per processor and event type dispatcher stats
+//
+//@DESCRIPTION: 'mqbstat::DispatcherStats' keeps, for each processor of each
+// of the dispatcher client types (sessions, queues and clusters), and for
+// each 'mqbi::DispatcherEventType', the number of events processed, the total
+// and maximum time spent processing them along with the description of the
+// client which processed the slowest one, and a histogram of the processing
+// times.  This allows identifying which processor is busy, with which kind of
+// events, and which client is responsible for head-of-line blocking.
+//
+// The histogram has 'k_NUM_BUCKETS' buckets on a logarithmic scale of base 4:
+// the first bucket counts the events processed in less than 1 us, the second
+// one those processed in less than 4 us, and so on up to the last bucket,
+// which counts the events having taken at least 64 ms.
+//
+// Each processor only updates its own counters, with relaxed atomic
+// operations, so that recording an event does not contend with the other
+// processors nor with readers; a mutex of the processor is only acquired when
+// the maximum processing time of an event type increases, to record the
+// description of the client.
+//
+/// Thread Safety
+///-------------
+// 'onEvent' must only be called from the thread of the specified processor.
+// All other methods are thread-safe, but the counters read while events are
+// being recorded may not be consistent with each other.
+
+// MQB
+#include <mqbcfg_messages.h>
+#include <mqbi_dispatcher.h>
+
+// BDE
+#include <bsl_iosfwd.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_mutex.h>
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mqbstat {
+
+// =====================
+// class DispatcherStats
+// =====================
+
+/// Profile of the events processed by each processor of the dispatcher.
+class DispatcherStats {
+  public:
+    // CONSTANTS
+    static const int k_NUM_EVENT_TYPES =
+        mqbi::DispatcherEventType::e_REPLICATION_RECEIPT + 1;
+    // Number of event types
+
+    static const int k_NUM_BUCKETS = 10;
+    // Number of buckets of the histograms
+
+  private:
+    // PRIVATE CONSTANTS
+    static const int k_MAX_CLIENT_LENGTH = 128;
+    // Maximum length, including the null
+    // terminator, of the description of a
+    // client
+
+    // PRIVATE TYPES
+
+    /// Counters of the events of one type processed by one processor.
+    struct EventStats {
+        // DATA
+        bsls::AtomicInt64 d_count;
+        // Number of events
+
+        bsls::AtomicInt64 d_totalTime;
+        // Total processing time, in nanoseconds
+
+        bsls::AtomicInt64 d_maxTime;
+        // Maximum processing time, in
+        // nanoseconds
+
+        bsls::AtomicInt64 d_buckets[k_NUM_BUCKETS];
+        // Histogram of the processing times
+
+        char d_maxClient[k_MAX_CLIENT_LENGTH];
+        // Description of the client of the
+        // event having taken 'd_maxTime', or an
+        // empty string if unknown
+
+        // CREATORS
+        EventStats();
+    };
+
+    /// Counters of all the events processed by one processor.
+    struct ProcessorStats {
+        // DATA
+        bslmt::Mutex d_mutex;
+        // Mutex protecting the increases of the
+        // maximum processing times, and the
+        // descriptions of the clients
+
+        EventStats d_events[k_NUM_EVENT_TYPES];
+        // Counters, indexed by event type
+    };
+
+    typedef bsl::shared_ptr<ProcessorStats> ProcessorStatsSp;
+
+    typedef bsl::vector<ProcessorStatsSp> ProcessorStatsVector;
+
+    // DATA
+    bsl::vector<ProcessorStatsVector> d_processors;
+    // Counters of each processor, indexed by
+    // client type and processor id
+
+    bsls::AtomicInt64 d_resetTime;
+    // High resolution timer value at the
+    // construction of this object, or at the
+    // last call to 'reset'
+
+  private:
+    // NOT IMPLEMENTED
+    DispatcherStats(const DispatcherStats&) BSLS_KEYWORD_DELETED;
+    DispatcherStats& operator=(const DispatcherStats&) BSLS_KEYWORD_DELETED;
+
+    // PRIVATE CLASS METHODS
+
+    /// Return the index of the histogram bucket of the specified
+    /// `duration`, in nanoseconds.
+    static int bucketIndex(bsls::Types::Int64 duration);
+
+    // PRIVATE MANIPULATORS
+
+    /// Set the maximum processing time of the specified `stats` of the
+    /// specified `processor` to the specified `duration`, and its client
+    /// to the specified `client`.  The behavior is undefined unless this
+    /// method is called from the thread of `processor`.
+    void updateMax(ProcessorStats*               processor,
+                   EventStats*                   stats,
+                   bsls::Types::Int64            duration,
+                   const mqbi::DispatcherClient* client);
+
+    // PRIVATE ACCESSORS
+
+    /// Return the counters of the specified `eventType` of the processor
+    /// having the specified `processorId` and `clientType`.
+    const EventStats&
+    eventStats(mqbi::DispatcherClientType::Enum clientType,
+               int                              processorId,
+               mqbi::DispatcherEventType::Enum  eventType) const;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(DispatcherStats, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a `DispatcherStats` for the processors of a dispatcher having
+    /// the specified `config`, using the specified `allocator` to supply
+    /// memory.
+    DispatcherStats(const mqbcfg::DispatcherConfig& config,
+                    bslma::Allocator*               allocator);
+
+    // MANIPULATORS
+
+    /// Record that the processor having the specified `processorId`, of the
+    /// dispatcher of clients of the specified `clientType`, spent the
+    /// specified `duration`, in nanoseconds, processing an event of the
+    /// specified `eventType` destined to the optionally specified `client`.
+    /// The behavior is undefined unless this method is called from the
+    /// thread of that processor, and `client`, if specified, is alive.
+    void onEvent(mqbi::DispatcherClientType::Enum clientType,
+                 int                              processorId,
+                 mqbi::DispatcherEventType::Enum  eventType,
+                 bsls::Types::Int64               duration,
+                 const mqbi::DispatcherClient*    client = 0);
+
+    /// Reset all the counters.
+    void reset();
+
+    // ACCESSORS
+
+    /// Return the number of processors of the dispatcher of clients of the
+    /// specified `clientType`.
+    int numProcessors(mqbi::DispatcherClientType::Enum clientType) const;
+
+    /// Return the number of events of the specified `eventType` processed by
+    /// the processor having the specified `processorId` and `clientType`.
+    bsls::Types::Int64
+    eventCount(mqbi::DispatcherClientType::Enum clientType,
+               int                              processorId,
+               mqbi::DispatcherEventType::Enum  eventType) const;
+
+    /// Return the total time, in nanoseconds, spent processing the events
+    /// of the specified `eventType` by the processor having the specified
+    /// `processorId` and `clientType`.
+    bsls::Types::Int64
+    totalTime(mqbi::DispatcherClientType::Enum clientType,
+              int                              processorId,
+              mqbi::DispatcherEventType::Enum  eventType) const;
+
+    /// Return the maximum time, in nanoseconds, spent processing an event
+    /// of the specified `eventType` by the processor having the specified
+    /// `processorId` and `clientType`, and load into the optionally
+    /// specified `client` the description of the client of that event.
+    bsls::Types::Int64
+    maxTime(mqbi::DispatcherClientType::Enum clientType,
+            int                              processorId,
+            mqbi::DispatcherEventType::Enum  eventType,
+            bsl::string*                     client = 0) const;
+
+    /// Return the number of events of the specified `eventType` processed by
+    /// the processor having the specified `processorId` and `clientType`
+    /// which fall in the histogram bucket having the specified `bucket`
+    /// index.
+    bsls::Types::Int64
+    bucketCount(mqbi::DispatcherClientType::Enum clientType,
+                int                              processorId,
+                mqbi::DispatcherEventType::Enum  eventType,
+                int                              bucket) const;
+
+    /// Print to the specified `stream`, for each processor, the share of
+    /// time it spent processing events since the last reset, and the
+    /// counters and histograms of the event types it processed.
+    void print(bsl::ostream& stream) const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ---------------------
+// class DispatcherStats
+// ---------------------
+
+// PRIVATE CLASS METHODS
+inline int DispatcherStats::bucketIndex(bsls::Types::Int64 duration)
+{
+    int                bucket = 0;
+    bsls::Types::Int64 bound  = 1000;  // 1 us
+    while (bucket < k_NUM_BUCKETS - 1 && duration >= bound) {
+        bound *= 4;
+        ++bucket;
+    }
+    return bucket;
+}
+
+// MANIPULATORS
+inline void
+DispatcherStats::onEvent(mqbi::DispatcherClientType::Enum clientType,
+                         int                              processorId,
+                         mqbi::DispatcherEventType::Enum  eventType,
+                         bsls::Types::Int64               duration,
+                         const mqbi::DispatcherClient*    client)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= clientType &&
+                     clientType < static_cast<int>(d_processors.size()));
+    BSLS_ASSERT_SAFE(0 <= processorId &&
+                     processorId < numProcessors(clientType));
+    BSLS_ASSERT_SAFE(0 <= eventType && eventType < k_NUM_EVENT_TYPES);
+
+    ProcessorStats* processor = d_processors[clientType][processorId].get();
+    EventStats&     stats     = processor->d_events[eventType];
+
+    stats.d_count.addRelaxed(1);
+    stats.d_totalTime.addRelaxed(duration);
+    stats.d_buckets[bucketIndex(duration)].addRelaxed(1);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            duration > stats.d_maxTime.loadRelaxed())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        updateMax(processor, &stats, duration, client);
+    }
+}
+
+// ACCESSORS
+inline int DispatcherStats::numProcessors(
+    mqbi::DispatcherClientType::Enum clientType) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= clientType &&
+                     clientType < static_cast<int>(d_processors.size()));
+
+    return static_cast<int>(d_processors[clientType].size());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,209 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbstat_dispatcherstats.t.cpp                                      -*-C++-*-
+#include <mqbstat_dispatcherstats.h>
+
+// MQB
+#include <mqbcfg_messages.h>
+#include <mqbi_dispatcher.h>
+
+// MWC
+#include <mwcsys_time.h>
+#include <mwcu_memoutstream.h>
+
+// BDE
+#include <bsl_string.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+typedef mqbi::DispatcherClientType ClientType;
+typedef mqbi::DispatcherEventType  EventType;
+
+/// Return a dispatcher config having 2 session processors, 1 queue
+/// processor, and no cluster processor.
+mqbcfg::DispatcherConfig makeConfig()
+{
+    mqbcfg::DispatcherConfig config(s_allocator_p);
+    config.sessions().numProcessors() = 2;
+    config.queues().numProcessors()   = 1;
+    config.clusters().numProcessors() = 0;
+    return config;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   - The object has one set of counters per processor of each client
+//     type of the dispatcher config, all initially zero.
+//
+// Testing:
+//   DispatcherStats(const mqbcfg::DispatcherConfig&, bslma::Allocator*)
+//   numProcessors
+//   eventCount
+//   totalTime
+//   maxTime
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    mqbstat::DispatcherStats obj(makeConfig(), s_allocator_p);
+
+    ASSERT_EQ(obj.numProcessors(ClientType::e_SESSION), 2);
+    ASSERT_EQ(obj.numProcessors(ClientType::e_QUEUE), 1);
+    ASSERT_EQ(obj.numProcessors(ClientType::e_CLUSTER), 0);
+
+    for (int e = 0; e < mqbstat::DispatcherStats::k_NUM_EVENT_TYPES; ++e) {
+        const EventType::Enum eventType = static_cast<EventType::Enum>(e);
+        ASSERT_EQ(obj.eventCount(ClientType::e_SESSION, 1, eventType), 0);
+        ASSERT_EQ(obj.totalTime(ClientType::e_SESSION, 1, eventType), 0);
+        ASSERT_EQ(obj.maxTime(ClientType::e_QUEUE, 0, eventType), 0);
+    }
+}
+
+static void test2_onEvent()
+// ------------------------------------------------------------------------
+// ON EVENT
+//
+// Concerns:
+//   - Events are accounted for in the counters of their processor and
+//     type only.
+//   - Processing times fall in the expected histogram bucket.
+//   - 'reset' zeroes all the counters.
+//
+// Testing:
+//   onEvent
+//   bucketCount
+//   reset
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("ON EVENT");
+
+    mqbstat::DispatcherStats obj(makeConfig(), s_allocator_p);
+
+    const ClientType::Enum k_SESSION = ClientType::e_SESSION;
+
+    obj.onEvent(k_SESSION, 1, EventType::e_PUT, 500);          // < 1 us
+    obj.onEvent(k_SESSION, 1, EventType::e_PUT, 1000);         // < 4 us
+    obj.onEvent(k_SESSION, 1, EventType::e_PUT, 5000);         // < 16 us
+    obj.onEvent(k_SESSION, 1, EventType::e_PUT, 100000000);    // >= 64 ms
+    obj.onEvent(k_SESSION, 0, EventType::e_CALLBACK, 2000000);  // < 4 ms
+
+    ASSERT_EQ(obj.eventCount(k_SESSION, 1, EventType::e_PUT), 4);
+    ASSERT_EQ(obj.totalTime(k_SESSION, 1, EventType::e_PUT), 100006500);
+    ASSERT_EQ(obj.maxTime(k_SESSION, 1, EventType::e_PUT), 100000000);
+    ASSERT_EQ(obj.bucketCount(k_SESSION, 1, EventType::e_PUT, 0), 1);
+    ASSERT_EQ(obj.bucketCount(k_SESSION, 1, EventType::e_PUT, 1), 1);
+    ASSERT_EQ(obj.bucketCount(k_SESSION, 1, EventType::e_PUT, 2), 1);
+    ASSERT_EQ(obj.bucketCount(k_SESSION, 1, EventType::e_PUT, 3), 0);
+    ASSERT_EQ(obj.bucketCount(k_SESSION, 1, EventType::e_PUT, 9), 1);
+
+    ASSERT_EQ(obj.eventCount(k_SESSION, 0, EventType::e_PUT), 0);
+    ASSERT_EQ(obj.eventCount(k_SESSION, 1, EventType::e_CALLBACK), 0);
+    ASSERT_EQ(obj.eventCount(k_SESSION, 0, EventType::e_CALLBACK), 1);
+    ASSERT_EQ(obj.bucketCount(k_SESSION, 0, EventType::e_CALLBACK, 6), 1);
+
+    bsl::string client(s_allocator_p);
+    ASSERT_EQ(obj.maxTime(k_SESSION, 0, EventType::e_CALLBACK, &client),
+              2000000);
+    ASSERT(client.empty());
+
+    obj.reset();
+
+    ASSERT_EQ(obj.eventCount(k_SESSION, 1, EventType::e_PUT), 0);
+    ASSERT_EQ(obj.totalTime(k_SESSION, 1, EventType::e_PUT), 0);
+    ASSERT_EQ(obj.maxTime(k_SESSION, 1, EventType::e_PUT), 0);
+    ASSERT_EQ(obj.bucketCount(k_SESSION, 1, EventType::e_PUT, 9), 0);
+    ASSERT_EQ(obj.eventCount(k_SESSION, 0, EventType::e_CALLBACK), 0);
+}
+
+static void test3_print()
+// ------------------------------------------------------------------------
+// PRINT
+//
+// Concerns:
+//   - All processors are printed, with the counters and histograms of the
+//     event types they processed only.
+//
+// Testing:
+//   print
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("PRINT");
+
+    mqbstat::DispatcherStats obj(makeConfig(), s_allocator_p);
+
+    obj.onEvent(ClientType::e_QUEUE, 0, EventType::e_PUT, 3000);
+    obj.onEvent(ClientType::e_QUEUE, 0, EventType::e_CONFIRM, 200000);
+
+    mwcu::MemOutStream os(s_allocator_p);
+    obj.print(os);
+    PV(os.str());
+
+    const bsl::string& out = os.str();
+    ASSERT_NE(out.find("SESSION processor #0"), bsl::string::npos);
+    ASSERT_NE(out.find("SESSION processor #1"), bsl::string::npos);
+    ASSERT_NE(out.find("QUEUE processor #0"), bsl::string::npos);
+    ASSERT_EQ(out.find("CLUSTER processor"), bsl::string::npos);
+    ASSERT_NE(out.find("PUT"), bsl::string::npos);
+    ASSERT_NE(out.find("CONFIRM"), bsl::string::npos);
+    ASSERT_NE(out.find(">=64ms"), bsl::string::npos);
+    ASSERT_EQ(out.find("PUSH"), bsl::string::npos);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    mwcsys::Time::initialize(s_allocator_p);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_print(); break;
+    case 2: test2_onEvent(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    mwcsys::Time::shutdown();
+
+    TEST_EPILOG(mwctst::TestHelper::e_DEFAULT);
+    // Do not check for default/global allocator usage.
+}
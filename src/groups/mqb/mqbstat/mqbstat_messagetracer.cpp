@@ -0,0 +1,637 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbstat_messagetracer.cpp                                          -*-C++-*-
+#include <mqbstat_messagetracer.h>
+
+#include <mqbscm_version.h>
+
+// MWC
+#include <mwcsys_time.h>
+#include <mwcu_memoutstream.h>
+#include <mwcu_printutil.h>
+
+// BDE
+#include <bdlb_print.h>
+#include <bdls_processutil.h>
+#include <bsl_algorithm.h>
+#include <bsl_iomanip.h>
+#include <bsl_ostream.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+#include <bslh_hash.h>
+#include <bslma_default.h>
+#include <bslmt_qlock.h>
+#include <bslmt_threadutil.h>
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mqbstat {
+
+namespace {
+
+// ===========
+// struct Slot
+// ===========
+
+/// Slot of the ring buffer of a thread, holding one event.  The fields are
+/// atomics so that a slot can be read while it is being overwritten by its
+/// thread, in which case `d_sequence` tells the reader to discard it.
+struct Slot {
+    // DATA
+    bsls::AtomicUint64 d_sequence;
+    // 2 * (index + 1) of the event held
+    // by this slot, or an odd value
+    // while the slot is being written
+
+    bsls::AtomicUint64 d_guidHigh;
+    // First 8 bytes of the GUID
+
+    bsls::AtomicUint64 d_guidLow;
+    // Last 8 bytes of the GUID
+
+    bsls::AtomicInt64 d_timestamp;
+    // High resolution time of the event
+
+    bsls::AtomicInt d_stage;
+    // Stage of the event
+};
+
+// ===================
+// struct ThreadBuffer
+// ===================
+
+/// Ring buffer of the events recorded by a thread.
+struct ThreadBuffer {
+    // DATA
+    bsl::string d_threadName;
+    // Name of the thread, at the time
+    // of its first event
+
+    bsls::Types::Uint64 d_threadId;
+    // Id of the thread
+
+    bsls::AtomicUint64 d_numEvents;
+    // Number of events ever recorded
+    // by the thread
+
+    bsls::AtomicUint64 d_firstEvent;
+    // Index of the first event not
+    // discarded by 'clear'
+
+    Slot d_slots[MessageTracer::k_BUFFER_CAPACITY];
+    // Events
+
+    // CREATORS
+    explicit ThreadBuffer(bslma::Allocator* allocator)
+    : d_threadName(allocator)
+    , d_threadId(bslmt::ThreadUtil::selfIdAsUint64())
+    , d_numEvents(0)
+    , d_firstEvent(0)
+    {
+        bslmt::ThreadUtil::getThreadName(&d_threadName);
+        if (d_threadName.empty()) {
+            mwcu::MemOutStream os(allocator);
+            os << "thread-" << d_threadId;
+            d_threadName.assign(os.str().data(), os.str().length());
+        }
+    }
+};
+
+// ============
+// struct Event
+// ============
+
+/// Event read from the buffer of a thread.
+struct Event {
+    // DATA
+    bmqt::MessageGUID d_guid;
+
+    bsls::Types::Int64 d_timestamp;
+
+    int d_stage;
+
+    int d_threadIndex;
+    // Index of the buffer of the thread
+    // which recorded the event
+};
+
+/// Return true if the specified `lhs` event happened before the specified
+/// `rhs` event.
+bool eventLess(const Event& lhs, const Event& rhs)
+{
+    if (lhs.d_timestamp != rhs.d_timestamp) {
+        return lhs.d_timestamp < rhs.d_timestamp;  // RETURN
+    }
+    return lhs.d_stage < rhs.d_stage;
+}
+
+typedef bsl::vector<Event> Events;
+
+typedef bsl::unordered_map<bmqt::MessageGUID,
+                           Events,
+                           bslh::Hash<bmqt::MessageGUIDHashAlgo> >
+    EventsByGUID;
+
+// DATA
+bslmt::QLock g_lock = BSLMT_QLOCK_INITIALIZER;
+// Lock protecting the registry of the
+// buffers
+
+int g_initialized = 0;
+// Number of calls to 'initialize' not
+// balanced by a call to 'shutdown'
+
+bslma::Allocator* g_allocator_p = 0;
+// Allocator of the buffers
+
+bsl::vector<ThreadBuffer*>* g_buffers_p = 0;
+// Buffers of all the threads which
+// recorded an event
+
+bslmt::ThreadUtil::Key g_bufferKey;
+// Key of the buffer of the calling thread
+
+// FUNCTIONS
+
+/// Return true if the message having the specified `guid` is sampled with
+/// the specified sampling `period`.
+bool isSampled(const bmqt::MessageGUID& guid, int period)
+{
+    bmqt::MessageGUIDHashAlgo hashAlgo;
+    hashAppend(hashAlgo, guid);
+    bsls::Types::Uint64 hash = hashAlgo.computeHash();
+
+    // Mix the bits of the hash ('djb2' mostly depends on the last bytes of
+    // the GUID in its low bits), using the finalizer of MurmurHash3.
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+
+    return hash % static_cast<bsls::Types::Uint64>(period) == 0;
+}
+
+/// Return the buffer of the calling thread, creating and registering it if
+/// needed, or 0 if the tracer is not initialized.
+ThreadBuffer* threadBuffer()
+{
+    ThreadBuffer* buffer = static_cast<ThreadBuffer*>(
+        bslmt::ThreadUtil::getSpecific(g_bufferKey));
+    if (buffer) {
+        return buffer;  // RETURN
+    }
+
+    bslmt::QLockGuard guard(&g_lock);
+    if (g_initialized == 0) {
+        return 0;  // RETURN
+    }
+
+    buffer = new (*g_allocator_p) ThreadBuffer(g_allocator_p);
+    g_buffers_p->push_back(buffer);
+    bslmt::ThreadUtil::setSpecific(g_bufferKey, buffer);
+
+    return buffer;
+}
+
+/// Load into the specified `events` the events currently retained in the
+/// buffers of all threads, and into the specified `threadNames` the names
+/// of these threads, indexed by the `d_threadIndex` of the events.
+void loadEvents(Events* events, bsl::vector<bsl::string>* threadNames)
+{
+    bslmt::QLockGuard guard(&g_lock);
+    if (g_initialized == 0) {
+        return;  // RETURN
+    }
+
+    const bsls::Types::Uint64 k_CAPACITY = MessageTracer::k_BUFFER_CAPACITY;
+
+    for (size_t i = 0; i < g_buffers_p->size(); ++i) {
+        const ThreadBuffer& buffer = *(*g_buffers_p)[i];
+        threadNames->push_back(buffer.d_threadName);
+
+        const bsls::Types::Uint64 numEvents =
+            buffer.d_numEvents.loadAcquire();
+        bsls::Types::Uint64 first = buffer.d_firstEvent.loadRelaxed();
+        if (numEvents > k_CAPACITY && first < numEvents - k_CAPACITY) {
+            first = numEvents - k_CAPACITY;
+        }
+
+        for (bsls::Types::Uint64 index = first; index < numEvents; ++index) {
+            const Slot& slot = buffer.d_slots[index % k_CAPACITY];
+
+            const bsls::Types::Uint64 sequence = 2 * (index + 1);
+
+            if (slot.d_sequence.loadAcquire() != sequence) {
+                // Being overwritten, or already overwritten
+                continue;  // CONTINUE
+            }
+
+            bsls::Types::Uint64 guidBytes[2];
+            guidBytes[0]                   = slot.d_guidHigh.loadAcquire();
+            guidBytes[1]                   = slot.d_guidLow.loadAcquire();
+            const bsls::Types::Int64 time  = slot.d_timestamp.loadAcquire();
+            const int                stage = slot.d_stage.loadAcquire();
+
+            if (slot.d_sequence.loadAcquire() != sequence) {
+                // Overwritten while being read
+                continue;  // CONTINUE
+            }
+
+            Event event;
+            event.d_guid.fromBinary(
+                reinterpret_cast<const unsigned char*>(guidBytes));
+            event.d_timestamp   = time;
+            event.d_stage       = stage;
+            event.d_threadIndex = static_cast<int>(i);
+            events->push_back(event);
+        }
+    }
+}
+
+/// Group the specified `events` by message into the specified `messages`,
+/// sorting the events of each message by time.
+void groupEvents(EventsByGUID* messages, const Events& events)
+{
+    for (Events::const_iterator it = events.begin(); it != events.end();
+         ++it) {
+        (*messages)[it->d_guid].push_back(*it);
+    }
+
+    for (EventsByGUID::iterator it = messages->begin(); it != messages->end();
+         ++it) {
+        bsl::sort(it->second.begin(), it->second.end(), &eventLess);
+    }
+}
+
+/// Print to the specified `stream` a row of the breakdown having the
+/// specified `name` and summarizing the specified `latencies`, which are
+/// sorted in place.
+void printBreakdownRow(bsl::ostream&                    stream,
+                       const bsl::string&               name,
+                       bsl::vector<bsls::Types::Int64>* latencies)
+{
+    bsl::sort(latencies->begin(), latencies->end());
+
+    const size_t       count = latencies->size();
+    bsls::Types::Int64 sum   = 0;
+    for (size_t i = 0; i < count; ++i) {
+        sum += (*latencies)[i];
+    }
+
+    const bsls::Types::Int64 values[] = {
+        sum / static_cast<bsls::Types::Int64>(count),
+        (*latencies)[(count - 1) * 50 / 100],
+        (*latencies)[(count - 1) * 99 / 100],
+        (*latencies)[count - 1]};
+
+    stream << "  " << bsl::left << bsl::setw(44) << name << bsl::right
+           << bsl::setw(10) << count;
+    for (size_t i = 0; i < sizeof(values) / sizeof(*values); ++i) {
+        mwcu::MemOutStream value;
+        value << mwcu::PrintUtil::prettyTimeInterval(values[i]);
+        stream << bsl::setw(12) << value.str();
+    }
+    stream << "\n";
+}
+
+/// Print the specified `timestamp`, relative to the specified `origin`, in
+/// microseconds with a nanosecond precision to the specified `stream`.
+void printMicroseconds(bsl::ostream&      stream,
+                       bsls::Types::Int64 timestamp,
+                       bsls::Types::Int64 origin)
+{
+    const bsls::Types::Int64 ns = timestamp - origin;
+    stream << ns / 1000 << '.' << bsl::setw(3) << bsl::setfill('0')
+           << ns % 1000 << bsl::setfill(' ');
+}
+
+/// Print the specified `value` as a JSON string to the specified `stream`.
+void printJsonString(bsl::ostream& stream, const bsl::string& value)
+{
+    stream << '"';
+    for (size_t i = 0; i < value.length(); ++i) {
+        const char c = value[i];
+        if (c == '"' || c == '\\') {
+            stream << '\\' << c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20) {
+            stream << ' ';
+        }
+        else {
+            stream << c;
+        }
+    }
+    stream << '"';
+}
+
+}  // close unnamed namespace
+
+// -------------------------
+// struct MessageTracerStage
+// -------------------------
+
+bsl::ostream& MessageTracerStage::print(bsl::ostream&            stream,
+                                        MessageTracerStage::Enum value,
+                                        int                      level,
+                                        int spacesPerLevel)
+{
+    bdlb::Print::indent(stream, level, spacesPerLevel);
+    stream << MessageTracerStage::toAscii(value);
+
+    if (spacesPerLevel >= 0) {
+        stream << '\n';
+    }
+
+    return stream;
+}
+
+const char* MessageTracerStage::toAscii(MessageTracerStage::Enum value)
+{
+#define CASE(X)                                                               \
+    case e_##X: return #X;
+
+    switch (value) {
+        CASE(CHANNEL_READ)
+        CASE(SESSION_DISPATCHER)
+        CASE(QUEUE_DISPATCHER)
+        CASE(STORAGE_WRITE)
+        CASE(REPLICATION)
+        CASE(RECEIPT)
+        CASE(ACK)
+        CASE(CHANNEL_WRITE)
+    default: return "(* UNKNOWN *)";
+    }
+
+#undef CASE
+}
+
+// -------------------
+// class MessageTracer
+// -------------------
+
+// CLASS DATA
+bsls::AtomicInt MessageTracer::s_samplingPeriod(0);
+
+// PRIVATE CLASS METHODS
+void MessageTracer::recordImpl(MessageTracerStage::Enum stage,
+                               const bmqt::MessageGUID& guid,
+                               int                      period)
+{
+    if (!isSampled(guid, period)) {
+        return;  // RETURN
+    }
+
+    ThreadBuffer* buffer = threadBuffer();
+    if (!buffer) {
+        return;  // RETURN
+    }
+
+    bsls::Types::Uint64 guidBytes[2];
+    guid.toBinary(reinterpret_cast<unsigned char*>(guidBytes));
+
+    // Only the calling thread writes to its buffer, so that the number of
+    // events can be read and incremented non-atomically.
+    const bsls::Types::Uint64 index = buffer->d_numEvents.loadRelaxed();
+    Slot& slot = buffer->d_slots[index % k_BUFFER_CAPACITY];
+
+    slot.d_sequence.storeRelaxed(2 * index + 1);
+    slot.d_guidHigh.storeRelease(guidBytes[0]);
+    slot.d_guidLow.storeRelease(guidBytes[1]);
+    slot.d_timestamp.storeRelease(mwcsys::Time::highResolutionTimer());
+    slot.d_stage.storeRelease(stage);
+    slot.d_sequence.storeRelease(2 * (index + 1));
+
+    buffer->d_numEvents.storeRelease(index + 1);
+}
+
+// CLASS METHODS
+void MessageTracer::initialize(bslma::Allocator* allocator)
+{
+    bslmt::QLockGuard guard(&g_lock);
+
+    ++g_initialized;
+    if (g_initialized > 1) {
+        return;  // RETURN
+    }
+
+    g_allocator_p = bslma::Default::globalAllocator(allocator);
+    g_buffers_p   = new (*g_allocator_p)
+        bsl::vector<ThreadBuffer*>(g_allocator_p);
+
+    int rc = bslmt::ThreadUtil::createKey(&g_bufferKey, 0);
+    BSLS_ASSERT_OPT(rc == 0);
+    (void)rc;
+}
+
+void MessageTracer::shutdown()
+{
+    bslmt::QLockGuard guard(&g_lock);
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(g_initialized > 0 && "'initialize' was not called");
+
+    if (--g_initialized != 0) {
+        return;  // RETURN
+    }
+
+    s_samplingPeriod = 0;
+
+    // Deleting the key, rather than resetting the value of each thread,
+    // guarantees a subsequent 'initialize' will not find stale buffers.
+    bslmt::ThreadUtil::deleteKey(g_bufferKey);
+
+    for (size_t i = 0; i < g_buffers_p->size(); ++i) {
+        g_allocator_p->deleteObject((*g_buffers_p)[i]);
+    }
+    g_allocator_p->deleteObject(g_buffers_p);
+    g_buffers_p   = 0;
+    g_allocator_p = 0;
+}
+
+void MessageTracer::setSamplingPeriod(int period)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(period >= 0);
+
+    bslmt::QLockGuard guard(&g_lock);
+    if (g_initialized == 0) {
+        return;  // RETURN
+    }
+
+    s_samplingPeriod = period;
+}
+
+void MessageTracer::clear()
+{
+    bslmt::QLockGuard guard(&g_lock);
+    if (g_initialized == 0) {
+        return;  // RETURN
+    }
+
+    for (size_t i = 0; i < g_buffers_p->size(); ++i) {
+        ThreadBuffer* buffer = (*g_buffers_p)[i];
+        buffer->d_firstEvent = buffer->d_numEvents.loadAcquire();
+    }
+}
+
+void MessageTracer::printBreakdown(bsl::ostream& stream)
+{
+    bslma::Allocator* allocator = bslma::Default::allocator();
+
+    Events                   events(allocator);
+    bsl::vector<bsl::string> threadNames(allocator);
+    loadEvents(&events, &threadNames);
+
+    EventsByGUID messages(allocator);
+    groupEvents(&messages, events);
+
+    // Latencies of the transitions between two stages, indexed by
+    // 'from * k_COUNT + to'.
+    const int k_COUNT = MessageTracerStage::k_COUNT;
+    bsl::vector<bsl::vector<bsls::Types::Int64> > transitions(
+        k_COUNT * k_COUNT,
+        allocator);
+    bsl::vector<bsls::Types::Int64> endToEnd(allocator);
+
+    for (EventsByGUID::const_iterator it = messages.begin();
+         it != messages.end();
+         ++it) {
+        const Events& stages = it->second;
+        for (size_t i = 1; i < stages.size(); ++i) {
+            const int from = stages[i - 1].d_stage;
+            const int to   = stages[i].d_stage;
+            transitions[from * k_COUNT + to].push_back(
+                stages[i].d_timestamp - stages[i - 1].d_timestamp);
+        }
+        if (stages.size() > 1) {
+            endToEnd.push_back(stages.back().d_timestamp -
+                               stages.front().d_timestamp);
+        }
+    }
+
+    stream << "Sampling period: " << samplingPeriod()
+           << ", threads: " << threadNames.size()
+           << ", events: " << events.size()
+           << ", messages: " << messages.size() << "\n";
+
+    if (endToEnd.empty()) {
+        stream << "No message was traced through more than one stage.\n";
+        return;  // RETURN
+    }
+
+    stream << "\n  " << bsl::left << bsl::setw(44) << "Transition"
+           << bsl::right << bsl::setw(10) << "Count" << bsl::setw(12)
+           << "Mean" << bsl::setw(12) << "p50" << bsl::setw(12) << "p99"
+           << bsl::setw(12) << "Max"
+           << "\n";
+
+    for (int from = 0; from < k_COUNT; ++from) {
+        for (int to = 0; to < k_COUNT; ++to) {
+            bsl::vector<bsls::Types::Int64>& latencies =
+                transitions[from * k_COUNT + to];
+            if (latencies.empty()) {
+                continue;  // CONTINUE
+            }
+
+            mwcu::MemOutStream name(allocator);
+            name << static_cast<MessageTracerStage::Enum>(from) << " -> "
+                 << static_cast<MessageTracerStage::Enum>(to);
+            printBreakdownRow(stream, name.str(), &latencies);
+        }
+    }
+
+    printBreakdownRow(stream, "END TO END", &endToEnd);
+}
+
+void MessageTracer::printChromeTrace(bsl::ostream& stream)
+{
+    bslma::Allocator* allocator = bslma::Default::allocator();
+
+    Events                   events(allocator);
+    bsl::vector<bsl::string> threadNames(allocator);
+    loadEvents(&events, &threadNames);
+
+    EventsByGUID messages(allocator);
+    groupEvents(&messages, events);
+
+    bsls::Types::Int64 origin = 0;
+    for (size_t i = 0; i < events.size(); ++i) {
+        if (i == 0 || events[i].d_timestamp < origin) {
+            origin = events[i].d_timestamp;
+        }
+    }
+
+    const int pid = bdls::ProcessUtil::getProcessId();
+
+    stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+    const char* separator = "\n";
+    for (size_t i = 0; i < threadNames.size(); ++i) {
+        stream << separator << "{\"name\":\"thread_name\",\"ph\":\"M\","
+               << "\"pid\":" << pid << ",\"tid\":" << i
+               << ",\"args\":{\"name\":";
+        printJsonString(stream, threadNames[i]);
+        stream << "}}";
+        separator = ",\n";
+    }
+
+    for (EventsByGUID::const_iterator it = messages.begin();
+         it != messages.end();
+         ++it) {
+        const Events& stages = it->second;
+
+        mwcu::MemOutStream guid(allocator);
+        guid << it->first;
+
+        for (size_t i = 0; i < stages.size(); ++i) {
+            const Event& event = stages[i];
+
+            // Zero-duration slice of the stage, in the thread which recorded
+            // it, so that the flow events below can bind to it.
+            stream << separator << "{\"name\":\""
+                   << static_cast<MessageTracerStage::Enum>(event.d_stage)
+                   << "\",\"cat\":\"message\",\"ph\":\"X\",\"dur\":0,"
+                   << "\"pid\":" << pid << ",\"tid\":" << event.d_threadIndex
+                   << ",\"ts\":";
+            printMicroseconds(stream, event.d_timestamp, origin);
+            stream << ",\"args\":{\"guid\":\"" << guid.str() << "\"}}";
+            separator = ",\n";
+
+            if (stages.size() == 1) {
+                continue;  // CONTINUE
+            }
+
+            // Flow linking the stages of the message
+            const char* phase = i == 0                   ? "s"
+                                : i + 1 == stages.size() ? "f"
+                                                         : "t";
+            stream << separator << "{\"name\":\"message\",\"cat\":\"message\","
+                   << "\"ph\":\"" << phase << "\",\"id\":\"" << guid.str()
+                   << "\",\"pid\":" << pid
+                   << ",\"tid\":" << event.d_threadIndex << ",\"ts\":";
+            printMicroseconds(stream, event.d_timestamp, origin);
+            stream << ",\"bp\":\"e\"}";
+        }
+    }
+
+    stream << "\n]}\n";
+}
+
+}  // close package namespace
+}  // close enterprise namespace
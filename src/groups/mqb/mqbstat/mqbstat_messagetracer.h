@@ -0,0 +1,255 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbstat_messagetracer.h                                            -*-C++-*-
+#ifndef INCLUDED_MQBSTAT_MESSAGETRACER
+#define INCLUDED_MQBSTAT_MESSAGETRACER
+
+//@PURPOSE: Provide a sampled tracer of the path of messages in the broker.
+//
+//@CLASSES:
+//  mqbstat::MessageTracerStage: enumeration of the traced stages of a message
+//  mqbstat::MessageTracer:      utility to record and dump traced messages
+//
+//@DESCRIPTION: 'mqbstat::MessageTracer' records, for a sample of the messages
+// going through the broker, a timestamp at each of the stage boundaries
+// enumerated by 'mqbstat::MessageTracerStage' (e.g., when the PUT is read
+// from the channel, processed by the session and the queue dispatchers,
+// written to and replicated by the storage, receipted, and acknowledged), so
+// that the time spent by a message in each stage can be analyzed.
+//
+// A message is sampled if the hash of its GUID is a multiple of the sampling
+// period (see 'setSamplingPeriod'), so that all the stages of a message agree
+// on whether it is sampled without any coordination between the threads
+// recording them.  Tracing is disabled by default (a sampling period of 0),
+// in which case 'record' only costs the relaxed load of an atomic integer.
+//
+// Events are written to a ring buffer owned by the recording thread, which is
+// allocated and registered on the first event recorded by that thread, and
+// never contended for writing: each slot of the buffer is protected by a
+// sequence number, so that the dump functions can read the buffers of all
+// threads while they are being written to, skipping the slots being
+// overwritten.  Each buffer retains the last 'k_BUFFER_CAPACITY' events of
+// its thread.
+//
+// The recorded events can be dumped either as a breakdown of the latencies
+// between consecutive stages of the sampled messages ('printBreakdown'), or
+// in the Chrome trace event JSON format ('printChromeTrace'), which can be
+// loaded in 'chrome://tracing' or Perfetto to visualize each message as a
+// flow across the threads of the broker.
+//
+/// Thread Safety
+///-------------
+// 'record', 'setSamplingPeriod', 'samplingPeriod', 'clear' and the dump
+// functions are thread-safe.  'initialize' and 'shutdown' are not, and the
+// behavior is undefined if 'shutdown' is called while any thread is recording
+// an event.
+
+// BMQ
+#include <bmqt_messageguid.h>
+
+// BDE
+#include <bsl_iosfwd.h>
+#include <bslma_allocator.h>
+#include <bsls_atomic.h>
+#include <bsls_performancehint.h>
+
+namespace BloombergLP {
+namespace mqbstat {
+
+// =========================
+// struct MessageTracerStage
+// =========================
+
+/// Enumeration of the traced stages of the path of a message in the broker.
+struct MessageTracerStage {
+    // TYPES
+    enum Enum {
+        e_CHANNEL_READ = 0  // read from the channel, in the IO thread
+        ,
+        e_SESSION_DISPATCHER = 1  // processed by the session dispatcher
+        ,
+        e_QUEUE_DISPATCHER = 2  // processed by the queue dispatcher
+        ,
+        e_STORAGE_WRITE = 3  // handed to the storage
+        ,
+        e_REPLICATION = 4  // sent to the replicas
+        ,
+        e_RECEIPT = 5  // receipted by a quorum of replicas
+        ,
+        e_ACK = 6  // acknowledged to the producer
+        ,
+        e_CHANNEL_WRITE = 7  // written to a channel
+    };
+
+    // CONSTANTS
+    static const int k_COUNT = 8;  // Total number of stages
+
+    // CLASS METHODS
+
+    /// Write the string representation of the specified enumeration `value`
+    /// to the specified output `stream`, and return a reference to
+    /// `stream`.  Optionally specify an initial indentation `level`, whose
+    /// absolute value is incremented recursively for nested objects.  If
+    /// `level` is specified, optionally specify `spacesPerLevel`, whose
+    /// absolute value indicates the number of spaces per indentation level
+    /// for this and all of its nested objects.  If `level` is negative,
+    /// suppress indentation of the first line.  If `spacesPerLevel` is
+    /// negative, format the entire output on one line, suppressing all but
+    /// the initial indentation (as governed by `level`).  See `toAscii` for
+    /// what constitutes the string representation of a
+    /// `MessageTracerStage::Enum` value.
+    static bsl::ostream& print(bsl::ostream&            stream,
+                               MessageTracerStage::Enum value,
+                               int                      level          = 0,
+                               int                      spacesPerLevel = 4);
+
+    /// Return the non-modifiable string representation corresponding to the
+    /// specified enumeration `value`, if it exists, and a unique (error)
+    /// string otherwise.  The string representation of `value` matches its
+    /// corresponding enumerator name with the `e_` prefix elided.
+    static const char* toAscii(MessageTracerStage::Enum value);
+};
+
+// FREE OPERATORS
+
+/// Format the specified `value` to the specified output `stream` and return
+/// a reference to the modifiable `stream`.
+bsl::ostream& operator<<(bsl::ostream&            stream,
+                         MessageTracerStage::Enum value);
+
+// ===================
+// class MessageTracer
+// ===================
+
+/// Utility to record the stages of a sample of the messages going through
+/// the broker, and to dump them.
+class MessageTracer {
+  private:
+    // CLASS DATA
+    static bsls::AtomicInt s_samplingPeriod;
+    // One out of how many messages are
+    // traced, or 0 if tracing is disabled
+
+    // PRIVATE CLASS METHODS
+
+    /// Record the specified `stage` of the message having the specified
+    /// `guid` if it is sampled with the specified sampling `period`.
+    static void recordImpl(MessageTracerStage::Enum stage,
+                           const bmqt::MessageGUID& guid,
+                           int                      period);
+
+  public:
+    // CONSTANTS
+    static const int k_BUFFER_CAPACITY = 4096;
+    // Number of events retained per thread
+
+    // CLASS METHODS
+
+    /// Initialize the tracer, using the optionally specified `allocator`
+    /// to supply memory for the buffers of the recording threads.  If
+    /// `allocator` is 0, the global allocator is used.  Tracing is disabled
+    /// until a non-zero sampling period is set.  Each call to `initialize`
+    /// must be balanced by a call to `shutdown`; only the first call has
+    /// any effect.
+    static void initialize(bslma::Allocator* allocator = 0);
+
+    /// Disable tracing and, if this is the call balancing the first call to
+    /// `initialize`, release the buffers of all the threads.  The behavior
+    /// is undefined unless `initialize` was called.
+    static void shutdown();
+
+    /// Trace one out of the specified `period` messages, or disable tracing
+    /// if `period` is 0.  The behavior is undefined unless `period` is
+    /// non-negative.  Note that the period is ignored unless the tracer is
+    /// initialized.
+    static void setSamplingPeriod(int period);
+
+    /// Return the current sampling period, or 0 if tracing is disabled.
+    static int samplingPeriod();
+
+    /// Return `true` if tracing is enabled, and `false` otherwise.  This
+    /// can be used to skip work only needed to record events.
+    static bool isEnabled();
+
+    /// Record, at the current time and in the buffer of the calling thread,
+    /// the specified `stage` of the message having the specified `guid`, if
+    /// tracing is enabled and this message is sampled.
+    static void record(MessageTracerStage::Enum stage,
+                       const bmqt::MessageGUID& guid);
+
+    /// Discard the events recorded so far by all threads.
+    static void clear();
+
+    /// Print to the specified `stream`, for each pair of consecutive stages
+    /// observed in the sampled messages, the number of such transitions and
+    /// the distribution of their latencies, as well as the distribution of
+    /// the latencies between the first and the last recorded stages of each
+    /// message.
+    static void printBreakdown(bsl::ostream& stream);
+
+    /// Print to the specified `stream` the recorded events in the Chrome
+    /// trace event JSON format, each stage being a zero-duration slice of
+    /// the thread which recorded it, and the stages of a same message being
+    /// linked by a flow.
+    static void printChromeTrace(bsl::ostream& stream);
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// -------------------
+// class MessageTracer
+// -------------------
+
+inline int MessageTracer::samplingPeriod()
+{
+    return s_samplingPeriod.loadRelaxed();
+}
+
+inline bool MessageTracer::isEnabled()
+{
+    return s_samplingPeriod.loadRelaxed() != 0;
+}
+
+inline void MessageTracer::record(MessageTracerStage::Enum stage,
+                                  const bmqt::MessageGUID& guid)
+{
+    const int period = s_samplingPeriod.loadRelaxed();
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(period == 0)) {
+        return;  // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+    recordImpl(stage, guid, period);
+}
+
+}  // close package namespace
+
+// -------------------------
+// struct MessageTracerStage
+// -------------------------
+
+inline bsl::ostream&
+mqbstat::operator<<(bsl::ostream&                     stream,
+                    mqbstat::MessageTracerStage::Enum value)
+{
+    return mqbstat::MessageTracerStage::print(stream, value, 0, -1);
+}
+
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,306 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbstat_messagetracer.t.cpp                                        -*-C++-*-
+#include <mqbstat_messagetracer.h>
+
+// BMQ
+#include <bmqt_messageguid.h>
+
+// MWC
+#include <mwcsys_time.h>
+#include <mwcu_memoutstream.h>
+
+// BDE
+#include <bdlf_bind.h>
+#include <bsl_iomanip.h>
+#include <bsl_string.h>
+#include <bslmt_threadgroup.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+typedef mqbstat::MessageTracerStage Stage;
+
+/// Return a GUID which is unique for the specified `id`.
+bmqt::MessageGUID makeGUID(int id)
+{
+    mwcu::MemOutStream hex(s_allocator_p);
+    hex << bsl::hex << bsl::uppercase << bsl::setfill('0') << bsl::setw(32)
+        << id;
+
+    bmqt::MessageGUID guid;
+    guid.fromHex(hex.str().data());
+    return guid;
+}
+
+/// Return the number of occurrences of the specified `pattern` in the
+/// specified `str`.
+int countOccurrences(const bsl::string& str, const char* pattern)
+{
+    int    count = 0;
+    size_t pos   = str.find(pattern);
+    while (pos != bsl::string::npos) {
+        ++count;
+        pos = str.find(pattern, pos + 1);
+    }
+    return count;
+}
+
+/// Record the specified `numEvents` events, of messages having successive
+/// ids starting at the specified `firstId`.
+void recordEvents(int firstId, int numEvents)
+{
+    for (int i = 0; i < numEvents; ++i) {
+        mqbstat::MessageTracer::record(Stage::e_STORAGE_WRITE,
+                                       makeGUID(firstId + i));
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   - Stages can be printed.
+//   - Tracing is disabled by default, and nothing is recorded until a
+//     sampling period is set.
+//
+// Testing:
+//   MessageTracerStage::toAscii
+//   MessageTracer::samplingPeriod
+//   MessageTracer::isEnabled
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    ASSERT_EQ(bsl::string("CHANNEL_READ"),
+              Stage::toAscii(Stage::e_CHANNEL_READ));
+    ASSERT_EQ(bsl::string("RECEIPT"), Stage::toAscii(Stage::e_RECEIPT));
+    ASSERT_EQ(bsl::string("CHANNEL_WRITE"),
+              Stage::toAscii(Stage::e_CHANNEL_WRITE));
+    {
+        mwcu::MemOutStream os(s_allocator_p);
+        os << Stage::e_QUEUE_DISPATCHER;
+        ASSERT_EQ(os.str(), "QUEUE_DISPATCHER");
+    }
+
+    mqbstat::MessageTracer::initialize(s_allocator_p);
+
+    ASSERT_EQ(mqbstat::MessageTracer::samplingPeriod(), 0);
+    ASSERT(!mqbstat::MessageTracer::isEnabled());
+
+    recordEvents(0, 10);
+
+    mwcu::MemOutStream os(s_allocator_p);
+    mqbstat::MessageTracer::printBreakdown(os);
+    PV(os.str());
+    ASSERT_NE(os.str().find("threads: 0, events: 0"), bsl::string::npos);
+
+    mqbstat::MessageTracer::shutdown();
+}
+
+static void test2_breakdown()
+// ------------------------------------------------------------------------
+// BREAKDOWN
+//
+// Concerns:
+//   - With a sampling period of 1, all the stages of all messages are
+//     recorded, and reported as transitions between consecutive stages.
+//   - 'clear' discards the recorded events.
+//
+// Testing:
+//   MessageTracer::record
+//   MessageTracer::printBreakdown
+//   MessageTracer::printChromeTrace
+//   MessageTracer::clear
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREAKDOWN");
+
+    mqbstat::MessageTracer::initialize(s_allocator_p);
+    mqbstat::MessageTracer::setSamplingPeriod(1);
+    ASSERT(mqbstat::MessageTracer::isEnabled());
+
+    const int k_NUM_MESSAGES = 10;
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        const bmqt::MessageGUID guid = makeGUID(i);
+        mqbstat::MessageTracer::record(Stage::e_CHANNEL_READ, guid);
+        mqbstat::MessageTracer::record(Stage::e_SESSION_DISPATCHER, guid);
+        mqbstat::MessageTracer::record(Stage::e_QUEUE_DISPATCHER, guid);
+        mqbstat::MessageTracer::record(Stage::e_ACK, guid);
+    }
+
+    {
+        mwcu::MemOutStream os(s_allocator_p);
+        mqbstat::MessageTracer::printBreakdown(os);
+        PV(os.str());
+
+        const bsl::string& out = os.str();
+        ASSERT_NE(out.find("events: 40, messages: 10"), bsl::string::npos);
+        ASSERT_NE(out.find("CHANNEL_READ -> SESSION_DISPATCHER"),
+                  bsl::string::npos);
+        ASSERT_NE(out.find("SESSION_DISPATCHER -> QUEUE_DISPATCHER"),
+                  bsl::string::npos);
+        ASSERT_NE(out.find("QUEUE_DISPATCHER -> ACK"), bsl::string::npos);
+        ASSERT_NE(out.find("END TO END"), bsl::string::npos);
+        ASSERT_EQ(out.find("CHANNEL_READ -> ACK"), bsl::string::npos);
+    }
+
+    {
+        mwcu::MemOutStream os(s_allocator_p);
+        mqbstat::MessageTracer::printChromeTrace(os);
+
+        const bsl::string out(os.str(), s_allocator_p);
+        ASSERT_EQ(countOccurrences(out, "\"ph\":\"M\""), 1);
+        ASSERT_EQ(countOccurrences(out, "\"ph\":\"X\""), 4 * k_NUM_MESSAGES);
+        ASSERT_EQ(countOccurrences(out, "\"ph\":\"s\""), k_NUM_MESSAGES);
+        ASSERT_EQ(countOccurrences(out, "\"ph\":\"t\""), 2 * k_NUM_MESSAGES);
+        ASSERT_EQ(countOccurrences(out, "\"ph\":\"f\""), k_NUM_MESSAGES);
+    }
+
+    mqbstat::MessageTracer::clear();
+
+    {
+        mwcu::MemOutStream os(s_allocator_p);
+        mqbstat::MessageTracer::printBreakdown(os);
+        ASSERT_NE(os.str().find("events: 0, messages: 0"), bsl::string::npos);
+    }
+
+    mqbstat::MessageTracer::shutdown();
+    ASSERT_EQ(mqbstat::MessageTracer::samplingPeriod(), 0);
+}
+
+static void test3_sampling()
+// ------------------------------------------------------------------------
+// SAMPLING
+//
+// Concerns:
+//   - About one out of 'period' messages is sampled.
+//   - Whether a message is sampled does not depend on its stage.
+//
+// Testing:
+//   MessageTracer::setSamplingPeriod
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("SAMPLING");
+
+    mqbstat::MessageTracer::initialize(s_allocator_p);
+    mqbstat::MessageTracer::setSamplingPeriod(8);
+
+    const int k_NUM_MESSAGES = 4000;
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        const bmqt::MessageGUID guid = makeGUID(i);
+        mqbstat::MessageTracer::record(Stage::e_QUEUE_DISPATCHER, guid);
+        mqbstat::MessageTracer::record(Stage::e_STORAGE_WRITE, guid);
+    }
+
+    mwcu::MemOutStream os(s_allocator_p);
+    mqbstat::MessageTracer::printChromeTrace(os);
+
+    const bsl::string out(os.str(), s_allocator_p);
+    const int         numSampled = countOccurrences(out, "\"ph\":\"s\"");
+    PV(numSampled);
+
+    // Each sampled message was recorded at both stages.
+    ASSERT_EQ(countOccurrences(out, "\"ph\":\"X\""), 2 * numSampled);
+    ASSERT_EQ(countOccurrences(out, "\"ph\":\"f\""), numSampled);
+    ASSERT_GT(numSampled, k_NUM_MESSAGES / 8 / 2);
+    ASSERT_LT(numSampled, k_NUM_MESSAGES / 8 * 2);
+
+    mqbstat::MessageTracer::shutdown();
+}
+
+static void test4_ringBuffers()
+// ------------------------------------------------------------------------
+// RING BUFFERS
+//
+// Concerns:
+//   - Each thread records its events in its own buffer.
+//   - A buffer retains the last 'k_BUFFER_CAPACITY' events of its thread.
+//
+// Testing:
+//   MessageTracer::record
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("RING BUFFERS");
+
+    const int k_CAPACITY = mqbstat::MessageTracer::k_BUFFER_CAPACITY;
+
+    mqbstat::MessageTracer::initialize(s_allocator_p);
+    mqbstat::MessageTracer::setSamplingPeriod(1);
+
+    // Wrap around the buffer of this thread
+    recordEvents(0, 2 * k_CAPACITY + 10);
+
+    // Record a few events in two other threads
+    bslmt::ThreadGroup threadGroup(s_allocator_p);
+    threadGroup.addThread(bdlf::BindUtil::bind(&recordEvents, 100000, 10));
+    threadGroup.addThread(bdlf::BindUtil::bind(&recordEvents, 200000, 20));
+    threadGroup.joinAll();
+
+    mwcu::MemOutStream os(s_allocator_p);
+    mqbstat::MessageTracer::printBreakdown(os);
+    PV(os.str());
+
+    mwcu::MemOutStream expected(s_allocator_p);
+    expected << "threads: 3, events: " << (k_CAPACITY + 30);
+    ASSERT_NE(os.str().find(expected.str()), bsl::string::npos);
+
+    mqbstat::MessageTracer::shutdown();
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    mwcsys::Time::initialize(s_allocator_p);
+
+    switch (_testCase) {
+    case 0:
+    case 4: test4_ringBuffers(); break;
+    case 3: test3_sampling(); break;
+    case 2: test2_breakdown(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    mwcsys::Time::shutdown();
+
+    TEST_EPILOG(mwctst::TestHelper::e_DEFAULT);
+    // Do not check for default/global allocator usage.
+}
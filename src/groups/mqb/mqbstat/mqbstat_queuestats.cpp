@@ -26,6 +26,7 @@
 #include <mqbi_queue.h>
 
 // MWC
+#include <mwcst_exportbuffer.h>
 #include <mwcst_statcontext.h>
 #include <mwcst_statutil.h>
 #include <mwcst_statvalue.h>
@@ -181,163 +182,322 @@ bool filterDirect(const mwcst::TableRecords::Record& record)
     return record.type() == mwcst::StatContext::DMCST_TOTAL_VALUE;
 }
 
-}  // close unnamed namespace
+/// Value returned by the functions of `mwcst::StatUtil` computing an
+/// average or a percentile when nothing was reported.
+const bsls::Types::Int64 k_INT64_MAX =
+    bsl::numeric_limits<bsls::Types::Int64>::max();
+
+/// Value returned by the functions of `mwcst::StatUtil` computing a maximum
+/// when nothing was reported.
+const bsls::Types::Int64 k_INT64_MIN =
+    bsl::numeric_limits<bsls::Types::Int64>::min();
+
+// ==============
+// struct StatDef
+// ==============
+
+/// Definition of the computation of a stat of a queue from the values of
+/// its stat context.
+struct StatDef {
+    // PUBLIC DATA
+    int d_valueIndex;
+    // Index of the value of the context
+
+    mwcst::ExportBuffer::SnapshotFn d_snapshotFn;
+    // Function of the latest snapshot of the
+    // value, or 0
+
+    mwcst::ExportBuffer::RangeFn d_rangeFn;
+    // Function of the snapshots of the value
+    // from the latest to the oldest one, or 0
+
+    bool d_hasEmptyValue;
+    // Whether 'd_emptyValue' is set
+
+    bsls::Types::Int64 d_emptyValue;
+    // Value of the function when nothing was
+    // reported, which is reported as 0
+
+    // CREATORS
+
+    /// Create a definition of an unknown stat, having no function.
+    StatDef()
+    : d_valueIndex(0)
+    , d_snapshotFn(0)
+    , d_rangeFn(0)
+    , d_hasEmptyValue(false)
+    , d_emptyValue(0)
+    {
+    }
 
-// ----------------------
-// class QueueStatsDomain
-// ----------------------
+    /// Create a definition of a stat computed by the specified `fn` of the
+    /// latest snapshot of the value having the specified `valueIndex`.
+    StatDef(int valueIndex, mwcst::ExportBuffer::SnapshotFn fn)
+    : d_valueIndex(valueIndex)
+    , d_snapshotFn(fn)
+    , d_rangeFn(0)
+    , d_hasEmptyValue(false)
+    , d_emptyValue(0)
+    {
+    }
 
-bsls::Types::Int64
-QueueStatsDomain::getValue(const mwcst::StatContext& context,
-                           int                       snapshotId,
-                           const Stat::Enum&         stat)
-{
-    // invoked from the SNAPSHOT thread
+    /// Create a definition of a stat computed by the specified `fn` of the
+    /// snapshots of the value having the specified `valueIndex`.
+    StatDef(int valueIndex, mwcst::ExportBuffer::RangeFn fn)
+    : d_valueIndex(valueIndex)
+    , d_snapshotFn(0)
+    , d_rangeFn(fn)
+    , d_hasEmptyValue(false)
+    , d_emptyValue(0)
+    {
+    }
 
-    const mwcst::StatValue::SnapshotLocation latestSnapshot(0, 0);
-    const mwcst::StatValue::SnapshotLocation oldestSnapshot(0, snapshotId);
+    /// Create a definition of a stat computed by the specified `fn` of the
+    /// snapshots of the value having the specified `valueIndex`, and
+    /// reported as 0 when `fn` returns the specified `emptyValue`.
+    StatDef(int                          valueIndex,
+            mwcst::ExportBuffer::RangeFn fn,
+            bsls::Types::Int64           emptyValue)
+    : d_valueIndex(valueIndex)
+    , d_snapshotFn(0)
+    , d_rangeFn(fn)
+    , d_hasEmptyValue(true)
+    , d_emptyValue(emptyValue)
+    {
+    }
+};
 
+/// Return the definition of the specified `stat` of a domain queue, having
+/// no function if `stat` is unknown.
+StatDef domainStatDef(QueueStatsDomain::Stat::Enum stat)
+{
 #define STAT_SINGLE(OPERATION, STAT)                                          \
-    mwcst::StatUtil::OPERATION(                                               \
-        context.value(mwcst::StatContext::DMCST_DIRECT_VALUE, STAT),          \
-        latestSnapshot)
+    return StatDef(DomainQueueStats::STAT, &mwcst::StatUtil::OPERATION)
 
 #define STAT_RANGE(OPERATION, STAT)                                           \
-    mwcst::StatUtil::OPERATION(                                               \
-        context.value(mwcst::StatContext::DMCST_DIRECT_VALUE, STAT),          \
-        latestSnapshot,                                                       \
-        oldestSnapshot)
+    return StatDef(DomainQueueStats::STAT, &mwcst::StatUtil::OPERATION)
+
+#define STAT_RANGE_OR_EMPTY(OPERATION, STAT, EMPTY)                           \
+    return StatDef(DomainQueueStats::STAT,                                    \
+                   &mwcst::StatUtil::OPERATION,                               \
+                   EMPTY)
 
     switch (stat) {
     case QueueStatsDomain::Stat::e_NB_PRODUCER: {
-        return STAT_SINGLE(value, DomainQueueStats::e_STAT_NB_PRODUCER);
+        STAT_SINGLE(value, e_STAT_NB_PRODUCER);
     }
     case QueueStatsDomain::Stat::e_NB_CONSUMER: {
-        return STAT_SINGLE(value, DomainQueueStats::e_STAT_NB_CONSUMER);
+        STAT_SINGLE(value, e_STAT_NB_CONSUMER);
     }
     case QueueStatsDomain::Stat::e_MESSAGES_CURRENT: {
-        return STAT_SINGLE(value, DomainQueueStats::e_STAT_MESSAGES);
+        STAT_SINGLE(value, e_STAT_MESSAGES);
     }
     case QueueStatsDomain::Stat::e_MESSAGES_MAX: {
-        return STAT_RANGE(rangeMax, DomainQueueStats::e_STAT_MESSAGES);
+        STAT_RANGE(rangeMax, e_STAT_MESSAGES);
     }
     case QueueStatsDomain::Stat::e_BYTES_CURRENT: {
-        return STAT_SINGLE(value, DomainQueueStats::e_STAT_BYTES);
+        STAT_SINGLE(value, e_STAT_BYTES);
     }
     case QueueStatsDomain::Stat::e_BYTES_MAX: {
-        return STAT_RANGE(rangeMax, DomainQueueStats::e_STAT_BYTES);
+        STAT_RANGE(rangeMax, e_STAT_BYTES);
     }
     case QueueStatsDomain::Stat::e_PUT_BYTES_ABS: {
-        return STAT_SINGLE(value, DomainQueueStats::e_STAT_PUT);
+        STAT_SINGLE(value, e_STAT_PUT);
     }
     case QueueStatsDomain::Stat::e_PUSH_BYTES_ABS: {
-        return STAT_SINGLE(value, DomainQueueStats::e_STAT_PUSH);
+        STAT_SINGLE(value, e_STAT_PUSH);
     }
     case QueueStatsDomain::Stat::e_ACK_ABS: {
-        return STAT_SINGLE(value, DomainQueueStats::e_STAT_ACK);
+        STAT_SINGLE(value, e_STAT_ACK);
     }
     case QueueStatsDomain::Stat::e_ACK_TIME_AVG: {
-        const bsls::Types::Int64 avg =
-            STAT_RANGE(averagePerEvent, DomainQueueStats::e_STAT_ACK_TIME);
-        return avg == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : avg;
+        STAT_RANGE_OR_EMPTY(averagePerEvent, e_STAT_ACK_TIME, k_INT64_MAX);
     }
     case QueueStatsDomain::Stat::e_ACK_TIME_MAX: {
-        const bsls::Types::Int64 max =
-            STAT_RANGE(rangeMax, DomainQueueStats::e_STAT_ACK_TIME);
-        return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
+        STAT_RANGE_OR_EMPTY(rangeMax, e_STAT_ACK_TIME, k_INT64_MIN);
+    }
+    case QueueStatsDomain::Stat::e_ACK_TIME_P50: {
+        STAT_RANGE_OR_EMPTY(rangePercentile50, e_STAT_ACK_TIME, k_INT64_MAX);
+    }
+    case QueueStatsDomain::Stat::e_ACK_TIME_P99: {
+        STAT_RANGE_OR_EMPTY(rangePercentile99, e_STAT_ACK_TIME, k_INT64_MAX);
+    }
+    case QueueStatsDomain::Stat::e_ACK_TIME_P999: {
+        STAT_RANGE_OR_EMPTY(rangePercentile999, e_STAT_ACK_TIME, k_INT64_MAX);
     }
     case QueueStatsDomain::Stat::e_NACK_ABS: {
-        return STAT_SINGLE(value, DomainQueueStats::e_STAT_NACK);
+        STAT_SINGLE(value, e_STAT_NACK);
     }
     case QueueStatsDomain::Stat::e_CONFIRM_ABS: {
-        return STAT_SINGLE(value, DomainQueueStats::e_STAT_CONFIRM);
+        STAT_SINGLE(value, e_STAT_CONFIRM);
     }
     case QueueStatsDomain::Stat::e_REJECT_ABS: {
-        return STAT_SINGLE(value, DomainQueueStats::e_STAT_REJECT);
+        STAT_SINGLE(value, e_STAT_REJECT);
     }
     case QueueStatsDomain::Stat::e_CONFIRM_TIME_AVG: {
-        const bsls::Types::Int64 avg =
-            STAT_RANGE(averagePerEvent, DomainQueueStats::e_STAT_CONFIRM_TIME);
-        return avg == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : avg;
+        STAT_RANGE_OR_EMPTY(averagePerEvent, e_STAT_CONFIRM_TIME, k_INT64_MAX);
     }
     case QueueStatsDomain::Stat::e_CONFIRM_TIME_MAX: {
-        const bsls::Types::Int64 max =
-            STAT_RANGE(rangeMax, DomainQueueStats::e_STAT_CONFIRM_TIME);
-        return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
+        STAT_RANGE_OR_EMPTY(rangeMax, e_STAT_CONFIRM_TIME, k_INT64_MIN);
+    }
+    case QueueStatsDomain::Stat::e_CONFIRM_TIME_P50: {
+        STAT_RANGE_OR_EMPTY(rangePercentile50,
+                            e_STAT_CONFIRM_TIME,
+                            k_INT64_MAX);
+    }
+    case QueueStatsDomain::Stat::e_CONFIRM_TIME_P99: {
+        STAT_RANGE_OR_EMPTY(rangePercentile99,
+                            e_STAT_CONFIRM_TIME,
+                            k_INT64_MAX);
+    }
+    case QueueStatsDomain::Stat::e_CONFIRM_TIME_P999: {
+        STAT_RANGE_OR_EMPTY(rangePercentile999,
+                            e_STAT_CONFIRM_TIME,
+                            k_INT64_MAX);
     }
     case QueueStatsDomain::Stat::e_QUEUE_TIME_AVG: {
-        const bsls::Types::Int64 avg =
-            STAT_RANGE(averagePerEvent, DomainQueueStats::e_STAT_QUEUE_TIME);
-        return avg == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : avg;
+        STAT_RANGE_OR_EMPTY(averagePerEvent, e_STAT_QUEUE_TIME, k_INT64_MAX);
     }
     case QueueStatsDomain::Stat::e_QUEUE_TIME_MAX: {
-        const bsls::Types::Int64 max =
-            STAT_RANGE(rangeMax, DomainQueueStats::e_STAT_QUEUE_TIME);
-        return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
+        STAT_RANGE_OR_EMPTY(rangeMax, e_STAT_QUEUE_TIME, k_INT64_MIN);
+    }
+    case QueueStatsDomain::Stat::e_QUEUE_TIME_P50: {
+        STAT_RANGE_OR_EMPTY(rangePercentile50, e_STAT_QUEUE_TIME, k_INT64_MAX);
+    }
+    case QueueStatsDomain::Stat::e_QUEUE_TIME_P99: {
+        STAT_RANGE_OR_EMPTY(rangePercentile99, e_STAT_QUEUE_TIME, k_INT64_MAX);
+    }
+    case QueueStatsDomain::Stat::e_QUEUE_TIME_P999: {
+        STAT_RANGE_OR_EMPTY(rangePercentile999,
+                            e_STAT_QUEUE_TIME,
+                            k_INT64_MAX);
     }
     case QueueStatsDomain::Stat::e_GC_MSGS_ABS: {
-        return STAT_SINGLE(value, DomainQueueStats::e_STAT_GC_MSGS);
+        STAT_SINGLE(value, e_STAT_GC_MSGS);
     }
     case QueueStatsDomain::Stat::e_PUT_MESSAGES_ABS: {
-        return STAT_SINGLE(increments, DomainQueueStats::e_STAT_PUT);
+        STAT_SINGLE(increments, e_STAT_PUT);
     }
     case QueueStatsDomain::Stat::e_PUSH_MESSAGES_ABS: {
-        return STAT_SINGLE(increments, DomainQueueStats::e_STAT_PUSH);
+        STAT_SINGLE(increments, e_STAT_PUSH);
     }
     case QueueStatsDomain::Stat::e_PUT_MESSAGES_DELTA: {
-        return STAT_RANGE(incrementsDifference, DomainQueueStats::e_STAT_PUT);
+        STAT_RANGE(incrementsDifference, e_STAT_PUT);
     }
     case QueueStatsDomain::Stat::e_PUSH_MESSAGES_DELTA: {
-        return STAT_RANGE(incrementsDifference, DomainQueueStats::e_STAT_PUSH);
+        STAT_RANGE(incrementsDifference, e_STAT_PUSH);
     }
     case QueueStatsDomain::Stat::e_PUT_BYTES_DELTA: {
-        return STAT_RANGE(valueDifference, DomainQueueStats::e_STAT_PUT);
+        STAT_RANGE(valueDifference, e_STAT_PUT);
     }
     case QueueStatsDomain::Stat::e_PUSH_BYTES_DELTA: {
-        return STAT_RANGE(valueDifference, DomainQueueStats::e_STAT_PUSH);
+        STAT_RANGE(valueDifference, e_STAT_PUSH);
     }
     case QueueStatsDomain::Stat::e_ACK_DELTA: {
-        return STAT_RANGE(valueDifference, DomainQueueStats::e_STAT_ACK);
+        STAT_RANGE(valueDifference, e_STAT_ACK);
     }
     case QueueStatsDomain::Stat::e_NACK_DELTA: {
-        return STAT_RANGE(valueDifference, DomainQueueStats::e_STAT_NACK);
+        STAT_RANGE(valueDifference, e_STAT_NACK);
     }
     case QueueStatsDomain::Stat::e_CONFIRM_DELTA: {
-        return STAT_RANGE(valueDifference, DomainQueueStats::e_STAT_CONFIRM);
+        STAT_RANGE(valueDifference, e_STAT_CONFIRM);
     }
     case QueueStatsDomain::Stat::e_REJECT_DELTA: {
-        return STAT_RANGE(valueDifference, DomainQueueStats::e_STAT_REJECT);
+        STAT_RANGE(valueDifference, e_STAT_REJECT);
     }
     case QueueStatsDomain::Stat::e_GC_MSGS_DELTA: {
-        return STAT_RANGE(valueDifference, DomainQueueStats::e_STAT_GC_MSGS);
+        STAT_RANGE(valueDifference, e_STAT_GC_MSGS);
     }
     case QueueStatsDomain::Stat::e_ROLE: {
-        return STAT_SINGLE(value, DomainQueueStats::e_STAT_ROLE);
+        STAT_SINGLE(value, e_STAT_ROLE);
     }
     case QueueStatsDomain::Stat::e_CFG_MSGS: {
-        return STAT_SINGLE(value, DomainQueueStats::e_CFG_MSGS);
+        STAT_SINGLE(value, e_CFG_MSGS);
     }
     case QueueStatsDomain::Stat::e_CFG_BYTES: {
-        return STAT_SINGLE(value, DomainQueueStats::e_CFG_BYTES);
+        STAT_SINGLE(value, e_CFG_BYTES);
     }
     case QueueStatsDomain::Stat::e_NO_SC_MSGS_ABS: {
-        return STAT_SINGLE(value, DomainQueueStats::e_STAT_NO_SC_MSGS);
+        STAT_SINGLE(value, e_STAT_NO_SC_MSGS);
     }
     case QueueStatsDomain::Stat::e_NO_SC_MSGS_DELTA: {
-        return STAT_RANGE(valueDifference,
-                          DomainQueueStats::e_STAT_NO_SC_MSGS);
+        STAT_RANGE(valueDifference, e_STAT_NO_SC_MSGS);
     }
     default: {
         BSLS_ASSERT_SAFE(false && "Attempting to access an unknown stat");
     }
     }
 
-    return 0;
+    return StatDef();
 
+#undef STAT_RANGE_OR_EMPTY
 #undef STAT_RANGE
 #undef STAT_SINGLE
 }
 
+}  // close unnamed namespace
+
+// ----------------------
+// class QueueStatsDomain
+// ----------------------
+
+bsls::Types::Int64
+QueueStatsDomain::getValue(const mwcst::StatContext& context,
+                           int                       snapshotId,
+                           const Stat::Enum&         stat)
+{
+    // invoked from the SNAPSHOT thread
+
+    const StatDef def = domainStatDef(stat);
+    if (!def.d_snapshotFn && !def.d_rangeFn) {
+        return 0;  // RETURN
+    }
+
+    const mwcst::StatValue::SnapshotLocation latestSnapshot(0, 0);
+    const mwcst::StatValue::SnapshotLocation oldestSnapshot(0, snapshotId);
+
+    const mwcst::StatValue& value =
+        context.value(mwcst::StatContext::DMCST_DIRECT_VALUE,
+                      def.d_valueIndex);
+    const bsls::Types::Int64 result =
+        def.d_snapshotFn
+            ? def.d_snapshotFn(value, latestSnapshot)
+            : def.d_rangeFn(value, latestSnapshot, oldestSnapshot);
+
+    return def.d_hasEmptyValue && result == def.d_emptyValue ? 0 : result;
+}
+
+int QueueStatsDomain::addColumn(mwcst::ExportBuffer* buffer,
+                                int                  snapshotId,
+                                const Stat::Enum&    stat)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(buffer);
+
+    const mwcst::StatValue::SnapshotLocation latestSnapshot(0, 0);
+    const mwcst::StatValue::SnapshotLocation oldestSnapshot(0, snapshotId);
+
+    const StatDef def    = domainStatDef(stat);
+    int           column = -1;
+    if (def.d_snapshotFn) {
+        column = buffer->addColumn(def.d_valueIndex,
+                                   def.d_snapshotFn,
+                                   latestSnapshot);
+    }
+    else {
+        column = buffer->addColumn(def.d_valueIndex,
+                                   def.d_rangeFn,
+                                   latestSnapshot,
+                                   oldestSnapshot);
+    }
+
+    if (def.d_hasEmptyValue) {
+        buffer->setEmptyValue(column, def.d_emptyValue);
+    }
+
+    return column;
+}
+
 QueueStatsDomain::QueueStatsDomain()
 : d_statContext_mp(0)
 {
@@ -663,11 +823,14 @@ QueueStatsUtil::initializeStatContextDomains(int               historySize,
         .value("bytes")
         .value("ack")
         .value("ack_time", mwcst::StatValue::DMCST_DISCRETE)
+        .valueHistogram()
         .value("nack")
         .value("confirm")
         .value("confirm_time", mwcst::StatValue::DMCST_DISCRETE)
+        .valueHistogram()
         .value("reject")
         .value("queue_time", mwcst::StatValue::DMCST_DISCRETE)
+        .valueHistogram()
         .value("gc")
         .value("push")
         .value("put")
@@ -797,6 +960,21 @@ void QueueStatsUtil::initializeTableAndTipDomains(
                      mwcst::StatUtil::rangeMax,
                      start,
                      end);
+    schema.addColumn("ack_time_p50",
+                     DomainQueueStats::e_STAT_ACK_TIME,
+                     mwcst::StatUtil::rangePercentile50,
+                     start,
+                     end);
+    schema.addColumn("ack_time_p99",
+                     DomainQueueStats::e_STAT_ACK_TIME,
+                     mwcst::StatUtil::rangePercentile99,
+                     start,
+                     end);
+    schema.addColumn("ack_time_p999",
+                     DomainQueueStats::e_STAT_ACK_TIME,
+                     mwcst::StatUtil::rangePercentile999,
+                     start,
+                     end);
     schema.addColumn("nack_delta",
                      DomainQueueStats::e_STAT_NACK,
                      mwcst::StatUtil::valueDifference,
@@ -825,6 +1003,21 @@ void QueueStatsUtil::initializeTableAndTipDomains(
                      mwcst::StatUtil::rangeMax,
                      start,
                      end);
+    schema.addColumn("confirm_time_p50",
+                     DomainQueueStats::e_STAT_CONFIRM_TIME,
+                     mwcst::StatUtil::rangePercentile50,
+                     start,
+                     end);
+    schema.addColumn("confirm_time_p99",
+                     DomainQueueStats::e_STAT_CONFIRM_TIME,
+                     mwcst::StatUtil::rangePercentile99,
+                     start,
+                     end);
+    schema.addColumn("confirm_time_p999",
+                     DomainQueueStats::e_STAT_CONFIRM_TIME,
+                     mwcst::StatUtil::rangePercentile999,
+                     start,
+                     end);
     schema.addColumn("reject_delta",
                      DomainQueueStats::e_STAT_REJECT,
                      mwcst::StatUtil::valueDifference,
@@ -844,6 +1037,21 @@ void QueueStatsUtil::initializeTableAndTipDomains(
                      mwcst::StatUtil::rangeMax,
                      start,
                      end);
+    schema.addColumn("queue_time_p50",
+                     DomainQueueStats::e_STAT_QUEUE_TIME,
+                     mwcst::StatUtil::rangePercentile50,
+                     start,
+                     end);
+    schema.addColumn("queue_time_p99",
+                     DomainQueueStats::e_STAT_QUEUE_TIME,
+                     mwcst::StatUtil::rangePercentile99,
+                     start,
+                     end);
+    schema.addColumn("queue_time_p999",
+                     DomainQueueStats::e_STAT_QUEUE_TIME,
+                     mwcst::StatUtil::rangePercentile999,
+                     start,
+                     end);
     schema.addColumn("gc_msgs_delta",
                      DomainQueueStats::e_STAT_GC_MSGS,
                      mwcst::StatUtil::valueDifference,
@@ -906,6 +1114,18 @@ void QueueStatsUtil::initializeTableAndTipDomains(
         .zeroString("")
         .extremeValueString("")
         .printAsNsTimeInterval();
+    tip->addColumn("queue_time_p50", "p50")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("queue_time_p99", "p99")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("queue_time_p999", "p99.9")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
 
     tip->setColumnGroup("Ack");
     tip->addColumn("ack_delta", "delta").zeroString("");
@@ -918,6 +1138,10 @@ void QueueStatsUtil::initializeTableAndTipDomains(
         .zeroString("")
         .extremeValueString("")
         .printAsNsTimeInterval();
+    tip->addColumn("ack_time_p99", "time p99")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
     tip->setColumnGroup("Nack");
     tip->addColumn("nack_delta", "delta").zeroString("");
     tip->addColumn("nack_abs", "abs").zeroString("");
@@ -933,6 +1157,10 @@ void QueueStatsUtil::initializeTableAndTipDomains(
         .zeroString("")
         .extremeValueString("")
         .printAsNsTimeInterval();
+    tip->addColumn("confirm_time_p99", "time p99")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
     tip->setColumnGroup("Reject");
     tip->addColumn("reject_delta", "delta").zeroString("");
     tip->addColumn("reject_abs", "abs").zeroString("");
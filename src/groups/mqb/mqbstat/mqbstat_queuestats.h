@@ -53,6 +53,7 @@ namespace BloombergLP {
 
 // FORWARD DECLARATION
 namespace mwcst {
+class ExportBuffer;
 class StatContext;
 }
 namespace mqbi {
@@ -119,16 +120,25 @@ class QueueStatsDomain {
             e_ACK_ABS,
             e_ACK_TIME_AVG,
             e_ACK_TIME_MAX,
+            e_ACK_TIME_P50,
+            e_ACK_TIME_P99,
+            e_ACK_TIME_P999,
             e_NACK_DELTA,
             e_NACK_ABS,
             e_CONFIRM_DELTA,
             e_CONFIRM_ABS,
             e_CONFIRM_TIME_AVG,
             e_CONFIRM_TIME_MAX,
+            e_CONFIRM_TIME_P50,
+            e_CONFIRM_TIME_P99,
+            e_CONFIRM_TIME_P999,
             e_REJECT_ABS,
             e_REJECT_DELTA,
             e_QUEUE_TIME_AVG,
             e_QUEUE_TIME_MAX,
+            e_QUEUE_TIME_P50,
+            e_QUEUE_TIME_P99,
+            e_QUEUE_TIME_P999,
             e_GC_MSGS_DELTA,
             e_GC_MSGS_ABS,
             e_ROLE,
@@ -198,6 +208,14 @@ class QueueStatsDomain {
                                        int                       snapshotId,
                                        const Stat::Enum&         stat);
 
+    /// Add to the specified `buffer`, whose rows are expected to be queue
+    /// contexts, a column computing the specified `stat` as `getValue`
+    /// does with the specified `snapshotId`, and return the index of the
+    /// column.  The behavior is undefined unless `stat` is a known stat.
+    static int addColumn(mwcst::ExportBuffer* buffer,
+                         int                  snapshotId,
+                         const Stat::Enum&    stat);
+
     // CREATORS
 
     /// Create a new object in an uninitialized state.
@@ -28,6 +28,7 @@
 #include <bmqt_uri.h>
 
 // MWC
+#include <mwcst_exportbuffer.h>
 #include <mwcst_statcontext.h>
 #include <mwcu_memoutstream.h>
 
@@ -490,6 +491,106 @@ static void test4_queueStatsDomainContent()
 #undef ASSERT_EQ_DOMAINSTAT
 }
 
+static void test5_queueStatsDomainExportBuffer()
+// ------------------------------------------------------------------------
+// QUEUESTATSDOMAINEXPORTBUFFER
+//
+// Concerns:
+//   - Ensure that the columns added by 'addColumn' to an export buffer
+//     hold, for each queue, the same values as 'getValue', including when
+//     nothing was reported for a time stat.
+//
+// Plan:
+//   - Instantiate the component under test
+//   - Add columns to an export buffer whose rows are the queue contexts
+//   - Trigger onEvent with data, snapshot and update the buffer
+//   - Ensure the values of the buffer match the ones of 'getValue'
+//
+// Testing:
+//   QueueStatsDomain::addColumn
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("QueueStatsDomainExportBuffer");
+
+    typedef mqbstat::QueueStatsDomain::Stat DomainStat;
+
+    // Create the necessary objects to test
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, s_allocator_p);
+    mqbmock::Cluster               mockCluster(&bufferFactory, s_allocator_p);
+    mqbmock::Domain                mockDomain(&mockCluster, s_allocator_p);
+    mwcst::StatContext*            sc = mockDomain.queueStatContext();
+
+    mqbstat::QueueStatsDomain obj;
+    obj.initialize(bmqt::Uri(), &mockDomain, s_allocator_p);
+
+    const int              k_SNAPSHOT_ID = 1;
+    const DomainStat::Enum k_STATS[]     = {DomainStat::e_NB_PRODUCER,
+                                            DomainStat::e_ACK_DELTA,
+                                            DomainStat::e_ACK_TIME_AVG,
+                                            DomainStat::e_ACK_TIME_MAX,
+                                            DomainStat::e_ACK_TIME_P99};
+    const int              k_NUM_STATS   = sizeof(k_STATS) / sizeof(*k_STATS);
+
+    mwcst::ExportBuffer buffer(s_allocator_p);
+    for (int i = 0; i < k_NUM_STATS; ++i) {
+        ASSERT_EQ(i,
+                  mqbstat::QueueStatsDomain::addColumn(&buffer,
+                                                       k_SNAPSHOT_ID,
+                                                       k_STATS[i]));
+    }
+
+#define ASSERT_EQ_BUFFER(PARAM, VALUE)                                        \
+    {                                                                         \
+        for (int i = 0; i < k_NUM_STATS; ++i) {                               \
+            if (k_STATS[i] == DomainStat::PARAM) {                            \
+                ASSERT_EQ(VALUE, buffer.value(0, i));                         \
+            }                                                                 \
+        }                                                                     \
+    }
+
+    // Nothing reported: the time stats are reported as 0
+    sc->snapshot();
+    sc->snapshot();
+    buffer.update(*sc);
+
+    ASSERT_EQ(1, buffer.numRows());
+    ASSERT_EQ(obj.statContext(), &buffer.context(0));
+    for (int i = 0; i < k_NUM_STATS; ++i) {
+        ASSERT_EQ_D(i,
+                    mqbstat::QueueStatsDomain::getValue(*obj.statContext(),
+                                                        k_SNAPSHOT_ID,
+                                                        k_STATS[i]),
+                    buffer.value(0, i));
+    }
+    ASSERT_EQ_BUFFER(e_ACK_TIME_AVG, 0);
+    ASSERT_EQ_BUFFER(e_ACK_TIME_MAX, 0);
+    ASSERT_EQ_BUFFER(e_ACK_TIME_P99, 0);
+
+    // Report 2 producers, 2 acks and their times
+    obj.setWriterCount(2);
+    obj.onEvent(mqbstat::QueueStatsDomain::EventType::e_ACK, 0);
+    obj.onEvent(mqbstat::QueueStatsDomain::EventType::e_ACK_TIME, 10);
+    obj.onEvent(mqbstat::QueueStatsDomain::EventType::e_ACK, 0);
+    obj.onEvent(mqbstat::QueueStatsDomain::EventType::e_ACK_TIME, 30);
+    sc->snapshot();
+    buffer.update(*sc);
+
+    ASSERT_EQ(1, buffer.numRows());
+    for (int i = 0; i < k_NUM_STATS; ++i) {
+        ASSERT_EQ_D(i,
+                    mqbstat::QueueStatsDomain::getValue(*obj.statContext(),
+                                                        k_SNAPSHOT_ID,
+                                                        k_STATS[i]),
+                    buffer.value(0, i));
+    }
+    ASSERT_EQ_BUFFER(e_NB_PRODUCER, 2);
+    ASSERT_EQ_BUFFER(e_ACK_DELTA, 2);
+    ASSERT_EQ_BUFFER(e_ACK_TIME_AVG, 20);
+    ASSERT_EQ_BUFFER(e_ACK_TIME_MAX, 30);
+
+#undef ASSERT_EQ_BUFFER
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -508,6 +609,7 @@ int main(int argc, char* argv[])
             mqbstat::BrokerStatsUtil::initializeStatContext(30, s_allocator_p);
         switch (_testCase) {
         case 0:
+        case 5: test5_queueStatsDomainExportBuffer(); break;
         case 4: test4_queueStatsDomainContent(); break;
         case 3: test3_queueStatsDomain(); break;
         case 2: test2_queueStatsClient(); break;
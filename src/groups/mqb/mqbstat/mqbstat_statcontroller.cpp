@@ -28,7 +28,9 @@
 #include <mqbscm_versiontag.h>
 #include <mqbstat_brokerstats.h>
 #include <mqbstat_clusterstats.h>
+#include <mqbstat_dispatcherstats.h>
 #include <mqbstat_domainstats.h>
+#include <mqbstat_messagetracer.h>
 #include <mqbstat_queuestats.h>
 
 // MWC
@@ -73,6 +75,8 @@ namespace {
 
 const char k_PUBLISHINTERVAL_SUFFIX[] = ".PUBLISHINTERVAL";
 
+const char k_MESSAGETRACE_SAMPLINGPERIOD[] = "MESSAGETRACE.SAMPLINGPERIOD";
+
 typedef bsl::unordered_set<mqbplug::PluginFactory*> PluginFactories;
 
 /// Post on the optionally specified `semaphore`.
@@ -376,6 +380,36 @@ void StatController::setTunable(mqbcmd::StatResult*       result,
         return;  // RETURN
     }
 
+    // Handle 'MESSAGETRACE.SAMPLINGPERIOD' tunable.
+    if (bdlb::StringRefUtil::areEqualCaseless(tunable.name(),
+                                              k_MESSAGETRACE_SAMPLINGPERIOD)) {
+        if (!tunable.value().isTheIntegerValue() ||
+            tunable.value().theInteger() < 0) {
+            mwcu::MemOutStream output;
+            output << "The MESSAGETRACE.SAMPLINGPERIOD tunable must be a "
+                      "non-negative integer, but instead the following was "
+                      "specified: "
+                   << tunable.value();
+            result->makeError();
+            result->error().message() = output.str();
+            return;  // RETURN
+        }
+
+        mqbcmd::TunableConfirmation& tunableConfirmation =
+            result->makeTunableConfirmation();
+        tunableConfirmation.name() = "messageTrace.samplingPeriod";
+        tunableConfirmation.oldValue().makeTheInteger(
+            MessageTracer::samplingPeriod());
+
+        MessageTracer::setSamplingPeriod(tunable.value().theInteger());
+        BALL_LOG_INFO << "Set message trace sampling period to "
+                      << tunable.value().theInteger();
+
+        tunableConfirmation.newValue().makeTheInteger(
+            MessageTracer::samplingPeriod());
+        return;  // RETURN
+    }
+
     mwcu::MemOutStream output;
     output << "Unsupported tunable '" << tunable << "': Issue the "
            << "LIST_TUNABLES command for the list of supported tunables.";
@@ -434,6 +468,14 @@ void StatController::getTunable(mqbcmd::StatResult* result,
         return;  // RETURN
     }
 
+    if (bdlb::StringRefUtil::areEqualCaseless(tunable,
+                                              k_MESSAGETRACE_SAMPLINGPERIOD)) {
+        mqbcmd::Tunable& tunableObj = result->makeTunable();
+        tunableObj.name()           = "messageTrace.samplingPeriod";
+        tunableObj.value().makeTheInteger(MessageTracer::samplingPeriod());
+        return;  // RETURN
+    }
+
     mwcu::MemOutStream output;
     output << "Unsupported tunable '" << tunable << "': Issue the "
            << "LIST_TUNABLES command for the list of supported tunables.";
@@ -480,6 +522,15 @@ void StatController::listTunables(mqbcmd::StatResult* result,
                "or as -1 to reset the publish interval to default value.";
         tunable.description() = description.str();
     }
+
+    mqbcmd::Tunable& tunable = tunables.tunables().emplace_back();
+    tunable.name()           = k_MESSAGETRACE_SAMPLINGPERIOD;
+    tunable.value().makeTheInteger(MessageTracer::samplingPeriod());
+    tunable.description() =
+        "non-negative integer value of the sampling period of the message "
+        "tracer: one out of this number of messages is traced through the "
+        "stages of the broker (see the STAT TRACE SHOW and STAT TRACE EXPORT "
+        "commands). It can be specified as 0 to disable the tracing.";
 }
 
 void StatController::snapshot()
@@ -621,6 +672,7 @@ StatController::StatController(const CommandProcessorFn& commandProcessor,
 , d_bufferFactory_p(bufferFactory)
 , d_commandProcessorFn(bsl::allocator_arg, allocator, commandProcessor)
 , d_printer_mp(0)
+, d_dispatcherStats_mp(0)
 , d_statConsumers(allocator)
 , d_statConsumerMaxPublishInterval(0)
 , d_eventScheduler_p(eventScheduler)
@@ -784,6 +836,12 @@ int StatController::start(bsl::ostream& errorDescription)
         errorStream.reset();
     }
 
+    // Create the dispatcher profile, sized after the dispatcher config
+    d_dispatcherStats_mp.load(new (*d_allocator_p) DispatcherStats(
+                                  brkrCfg.dispatcherConfig(),
+                                  d_allocators.get("DispatcherStats")),
+                              d_allocator_p);
+
     // Max value for the stat publish interval must be the minimum history size
     // of all stat contexts.
     d_statConsumerMaxPublishInterval =
@@ -834,6 +892,7 @@ void StatController::stop()
         DESTROY_OBJ((*it), it->name());
     }
     DESTROY_OBJ(d_printer_mp, "Printer");
+    DESTROY_OBJ(d_dispatcherStats_mp, "DispatcherStats");
     DESTROY_OBJ(d_systemStatMonitor_mp, "SystemStatMonitor");
     DESTROY_OBJ(d_scheduler_mp, "Scheduler");
 
@@ -909,6 +968,36 @@ int StatController::processCommand(mqbcmd::StatResult*        result,
         return 0;  // RETURN
     }
 
+    // The message tracer is thread-safe, so that its dumps don't need to go
+    // through the scheduler thread.
+    if (command.isShowTraceValue()) {
+        mwcu::MemOutStream os;
+        MessageTracer::printBreakdown(os);
+        result->makeStats(os.str());
+        return 0;  // RETURN
+    }
+
+    if (command.isExportTraceValue()) {
+        mwcu::MemOutStream os;
+        MessageTracer::printChromeTrace(os);
+        result->makeStats(os.str());
+        return 0;  // RETURN
+    }
+
+    // Likewise, the dispatcher profile is thread-safe.
+    if (command.isShowDispatcherValue()) {
+        mwcu::MemOutStream os;
+        d_dispatcherStats_mp->print(os);
+        result->makeStats(os.str());
+        return 0;  // RETURN
+    }
+
+    if (command.isResetDispatcherValue()) {
+        d_dispatcherStats_mp->reset();
+        result->makeStats("Dispatcher statistics reset");
+        return 0;  // RETURN
+    }
+
     mwcu::MemOutStream os;
     os << "Unknown command '" << command << "'";
     result->makeError();
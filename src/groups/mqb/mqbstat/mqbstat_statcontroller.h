@@ -30,6 +30,7 @@
 // MQB
 
 #include <mqbcmd_messages.h>
+#include <mqbstat_dispatcherstats.h>
 #include <mqbstat_printer.h>
 
 // MWC
@@ -129,6 +130,7 @@ class StatController {
     typedef bsl::shared_ptr<mwcst::StatContext>           StatContextSp;
     typedef bslma::ManagedPtr<mwcsys::StatMonitor>        SystemStatMonitorMp;
     typedef bslma::ManagedPtr<Printer>                    PrinterMp;
+    typedef bslma::ManagedPtr<DispatcherStats>            DispatcherStatsMp;
     typedef bslma::ManagedPtr<mqbplug::StatPublisher>     StatPublisherMp;
     typedef bslma::ManagedPtr<mqbplug::StatConsumer>      StatConsumerMp;
 
@@ -204,6 +206,10 @@ class StatController {
     PrinterMp d_printer_mp;
     // Printer
 
+    DispatcherStatsMp d_dispatcherStats_mp;
+    // Profile of the events processed by
+    // the dispatcher
+
     bsl::vector<StatConsumerMp> d_statConsumers;
 
     int d_statConsumerMaxPublishInterval;
@@ -322,6 +328,10 @@ class StatController {
     /// Retrieve the channels stat context corresponding to the specified
     /// `selector`.
     mwcst::StatContext* channelsStatContext(ChannelSelector::Enum selector);
+
+    /// Retrieve the profile of the events processed by the dispatcher.  The
+    /// behavior is undefined unless this object is started.
+    DispatcherStats* dispatcherStats();
 };
 
 // ============================================================================
@@ -372,6 +382,11 @@ StatController::channelsStatContext(ChannelSelector::Enum selector)
     return 0;  // compiler happiness
 }
 
+inline DispatcherStats* StatController::dispatcherStats()
+{
+    return d_dispatcherStats_mp.get();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -0,0 +1,467 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbtst_benchmarkutil.cpp                                           -*-C++-*-
+#include <mqbtst_benchmarkutil.h>
+
+#include <mqbscm_version.h>
+// BMQ
+#include <bmqa_abstractsession.h>
+#include <bmqa_confirmeventbuilder.h>
+#include <bmqa_message.h>
+#include <bmqa_messageevent.h>
+#include <bmqa_messageeventbuilder.h>
+#include <bmqa_messageiterator.h>
+#include <bmqa_messageproperties.h>
+#include <bmqt_resultcode.h>
+
+// MWC
+#include <mwcu_printutil.h>
+
+// BDE
+#include <ball_log.h>
+#include <bdlbb_blob.h>
+#include <bdlt_currenttime.h>
+#include <bdlt_timeunitratio.h>
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_ostream.h>
+#include <bsl_string.h>
+#include <bslma_default.h>
+#include <bslmt_threadutil.h>
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_timeutil.h>
+
+namespace BloombergLP {
+namespace mqbtst {
+
+namespace {
+
+BALL_LOG_SET_NAMESPACE_CATEGORY("MQBTST.BENCHMARKUTIL");
+
+/// Width of the names of the fields of the text report, padded with dots.
+const int k_FIELD_NAME_WIDTH = 16;
+
+}  // close unnamed namespace
+
+// ------------------------
+// struct BenchmarkSchedule
+// ------------------------
+
+BenchmarkSchedule::BenchmarkSchedule()
+: d_useEpochClock(false)
+, d_startTime(0)
+, d_messagePeriod(0)
+, d_numMessages(0)
+, d_warmupEndTime(0)
+, d_endTime(0)
+{
+    // NOTHING
+}
+
+void BenchmarkSchedule::initialize(bsls::Types::Int64 numMessages,
+                                   double             rate,
+                                   bsls::Types::Int64 warmup,
+                                   bsls::Types::Int64 startDelay)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 < rate);
+
+    d_messagePeriod = bdlt::TimeUnitRatio::k_NS_PER_S / rate;
+    d_numMessages   = numMessages;
+    d_startTime     = now() + startDelay;
+    d_endTime       = d_startTime + static_cast<bsls::Types::Int64>(
+                                  d_numMessages * d_messagePeriod);
+    d_warmupEndTime = bsl::min(d_endTime, d_startTime + warmup);
+}
+
+bsls::Types::Int64 BenchmarkSchedule::now() const
+{
+    if (d_useEpochClock) {
+        return bdlt::CurrentTime::now().totalNanoseconds();  // RETURN
+    }
+
+    return bsls::TimeUtil::getTimer();
+}
+
+bsls::Types::Int64
+BenchmarkSchedule::intendedTime(bsls::Types::Int64 sequence) const
+{
+    return d_startTime +
+           static_cast<bsls::Types::Int64>(sequence * d_messagePeriod);
+}
+
+bool BenchmarkSchedule::isMeasured(bsls::Types::Int64 intendedTime) const
+{
+    return intendedTime >= d_warmupEndTime && intendedTime < d_endTime;
+}
+
+double BenchmarkSchedule::rate() const
+{
+    return d_messagePeriod > 0
+               ? bdlt::TimeUnitRatio::k_NS_PER_S / d_messagePeriod
+               : 0.0;
+}
+
+double BenchmarkSchedule::measuredDuration() const
+{
+    return static_cast<double>(d_endTime - d_warmupEndTime) /
+           bdlt::TimeUnitRatio::k_NS_PER_S;
+}
+
+// ----------------------
+// struct BenchmarkResult
+// ----------------------
+
+BenchmarkResult::BenchmarkResult(bslma::Allocator* allocator)
+: d_numPosted(0)
+, d_numPostFailures(0)
+, d_numReceived(0)
+, d_numMeasured(0)
+, d_meanLatency(0)
+, d_latencyPercentiles(BenchmarkUtil::k_NUM_PERCENTILES, 0, allocator)
+{
+    // NOTHING
+}
+
+BenchmarkResult::BenchmarkResult(const BenchmarkResult& other,
+                                 bslma::Allocator*      allocator)
+: d_numPosted(other.d_numPosted)
+, d_numPostFailures(other.d_numPostFailures)
+, d_numReceived(other.d_numReceived)
+, d_numMeasured(other.d_numMeasured)
+, d_meanLatency(other.d_meanLatency)
+, d_latencyPercentiles(other.d_latencyPercentiles, allocator)
+{
+    // NOTHING
+}
+
+// --------------------
+// class BenchmarkStats
+// --------------------
+
+// CREATORS
+BenchmarkStats::BenchmarkStats(bslma::Allocator* allocator)
+: d_allocator_p(bslma::Default::allocator(allocator))
+, d_numPosted(0)
+, d_numPostFailures(0)
+, d_numReceived(0)
+, d_numMeasured(0)
+, d_latencySum(0)
+, d_latencies(d_allocator_p)
+, d_collected(d_allocator_p)
+{
+    d_latencies.enable(true);
+}
+
+// MANIPULATORS
+void BenchmarkStats::onPosted(bsls::Types::Int64 count)
+{
+    d_numPosted.addRelaxed(count);
+}
+
+void BenchmarkStats::onPostFailures(bsls::Types::Int64 count)
+{
+    d_numPostFailures.addRelaxed(count);
+}
+
+void BenchmarkStats::onReceived(bsls::Types::Int64 count)
+{
+    d_numReceived.addRelaxed(count);
+}
+
+void BenchmarkStats::recordLatency(bsls::Types::Int64 latency)
+{
+    d_latencies.record(latency);
+    d_latencySum.addRelaxed(latency);
+    d_numMeasured.addRelaxed(1);
+}
+
+void BenchmarkStats::loadResult(BenchmarkResult* result)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(result);
+
+    // 'collect' moves the counts recorded since the previous collection
+    // into the snapshot, which therefore holds all the latencies recorded.
+    d_latencies.collect(&d_collected);
+
+    result->d_numPosted       = d_numPosted.load();
+    result->d_numPostFailures = d_numPostFailures.load();
+    result->d_numReceived     = d_numReceived.load();
+    result->d_numMeasured     = d_numMeasured.load();
+    result->d_meanLatency     = result->d_numMeasured == 0
+                                    ? 0
+                                    : d_latencySum.load() /
+                                      result->d_numMeasured;
+
+    result->d_latencyPercentiles.resize(BenchmarkUtil::k_NUM_PERCENTILES);
+    for (int i = 0; i < BenchmarkUtil::k_NUM_PERCENTILES; ++i) {
+        result->d_latencyPercentiles[i] = d_collected.percentile(
+            BenchmarkUtil::k_PERCENTILES[i]);
+    }
+}
+
+// ACCESSORS
+bsls::Types::Int64 BenchmarkStats::numPosted() const
+{
+    return d_numPosted.load();
+}
+
+bsls::Types::Int64 BenchmarkStats::numReceived() const
+{
+    return d_numReceived.load();
+}
+
+// --------------------
+// struct BenchmarkUtil
+// --------------------
+
+// PUBLIC CLASS DATA
+const char BenchmarkUtil::k_INTENDED_TIME_PROPERTY[] =
+    "benchmarkIntendedTime";
+
+const bsls::Types::Int64 BenchmarkUtil::k_MIN_SLEEP_NS =
+    200 * bdlt::TimeUnitRatio::k_NS_PER_US;
+
+const int BenchmarkUtil::k_NUM_PERCENTILES;
+
+const double BenchmarkUtil::k_PERCENTILES[k_NUM_PERCENTILES] =
+    {50.0, 90.0, 99.0, 99.9, 99.99, 100.0};
+
+const char* const BenchmarkUtil::k_PERCENTILE_NAMES[k_NUM_PERCENTILES] =
+    {"p50", "p90", "p99", "p99.9", "p99.99", "max"};
+
+// CLASS METHODS
+void BenchmarkUtil::waitFor(bsls::Types::Int64 delay)
+{
+    if (delay > k_MIN_SLEEP_NS) {
+        bslmt::ThreadUtil::microSleep(
+            static_cast<int>((delay - k_MIN_SLEEP_NS / 2) /
+                             bdlt::TimeUnitRatio::k_NS_PER_US));
+    }
+    else {
+        bslmt::ThreadUtil::yield();
+    }
+}
+
+void BenchmarkUtil::postMessages(
+    bmqa::AbstractSession*            session,
+    BenchmarkStats*                   stats,
+    const BenchmarkSchedule&          schedule,
+    const bsl::vector<bmqa::QueueId>& queueIds,
+    const bdlbb::Blob&                payload,
+    bsls::Types::Int64                first,
+    int                               stride,
+    int                               maxEventSize,
+    const bsls::AtomicBool&           isRunning,
+    bslma::Allocator*                 allocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(session);
+    BSLS_ASSERT_SAFE(stats);
+    BSLS_ASSERT_SAFE(!queueIds.empty());
+    BSLS_ASSERT_SAFE(0 < stride);
+    BSLS_ASSERT_SAFE(0 < maxEventSize);
+
+    const bsls::Types::Int64 numQueues = queueIds.size();
+
+    bmqa::MessageEventBuilder builder;
+    bmqa::MessageProperties   properties(allocator);
+
+    session->loadMessageEventBuilder(&builder);
+
+    bsls::Types::Int64 sequence = first;
+    while (isRunning && sequence < schedule.d_numMessages) {
+        bsls::Types::Int64 intendedTime = schedule.intendedTime(sequence);
+        const bsls::Types::Int64 currentTime = schedule.now();
+        if (currentTime < intendedTime) {
+            waitFor(intendedTime - currentTime);
+            continue;  // CONTINUE
+        }
+
+        // Pack all the overdue messages, up to 'maxEventSize' of them.
+        builder.reset();
+        bmqa::Message& message = builder.startMessage();
+        message.setDataRef(&payload);
+        message.setPropertiesRef(&properties);
+
+        int numPacked = 0;
+        while (numPacked < maxEventSize &&
+               sequence < schedule.d_numMessages &&
+               intendedTime <= currentTime) {
+            properties.setPropertyAsInt64(k_INTENDED_TIME_PROPERTY,
+                                          intendedTime);
+            bmqt::EventBuilderResult::Enum rc = builder.packMessage(
+                queueIds[sequence % numQueues]);
+            if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
+                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+                if (rc == bmqt::EventBuilderResult::e_EVENT_TOO_BIG &&
+                    numPacked != 0) {
+                    // The event is full: post it, and pack this message in
+                    // the next one.
+                    break;  // BREAK
+                }
+                BALL_LOG_ERROR << "Failed to pack message [rc: " << rc << "]";
+                stats->onPostFailures(1);
+            }
+            else {
+                ++numPacked;
+            }
+
+            sequence += stride;
+            intendedTime = schedule.intendedTime(sequence);
+        }
+
+        if (numPacked == 0) {
+            continue;  // CONTINUE
+        }
+
+        // Open loop: when throttled, keep retrying.  The time spent waiting
+        // is accounted for in the latency of the messages, which is measured
+        // from their intended send time.
+        int rc = session->post(builder.messageEvent());
+        while (rc == bmqt::PostResult::e_BW_LIMIT && isRunning) {
+            bslmt::ThreadUtil::yield();
+            rc = session->post(builder.messageEvent());
+        }
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            BALL_LOG_ERROR << "Failed to post: " << bmqt::PostResult::Enum(rc)
+                           << " (" << rc << ")";
+            stats->onPostFailures(numPacked);
+            continue;  // CONTINUE
+        }
+        stats->onPosted(numPacked);
+    }
+}
+
+int BenchmarkUtil::confirmMessages(bmqa::AbstractSession*    session,
+                                   BenchmarkStats*           stats,
+                                   const BenchmarkSchedule&  schedule,
+                                   const bmqa::MessageEvent& event,
+                                   bslma::Allocator*         allocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(session);
+    BSLS_ASSERT_SAFE(stats);
+
+    if (event.type() != bmqt::MessageEventType::e_PUSH) {
+        return 0;  // RETURN
+    }
+
+    // All the messages of an event are received at the same time.
+    const bsls::Types::Int64 receivedTime = schedule.now();
+
+    bmqa::ConfirmEventBuilder confirmBuilder;
+    session->loadConfirmEventBuilder(&confirmBuilder);
+
+    bmqa::MessageProperties properties(allocator);
+    bsls::Types::Int64      numReceived = 0;
+    for (bmqa::MessageIterator iter = event.messageIterator();
+         iter.nextMessage();) {
+        const bmqa::Message& message = iter.message();
+        ++numReceived;
+
+        if (message.loadProperties(&properties) == 0) {
+            const bsls::Types::Int64 intendedTime =
+                properties.getPropertyAsInt64Or(k_INTENDED_TIME_PROPERTY, 0);
+            if (schedule.isMeasured(intendedTime)) {
+                stats->recordLatency(receivedTime - intendedTime);
+            }
+        }
+
+        if (confirmBuilder.addMessageConfirmation(message) ==
+            bmqt::EventBuilderResult::e_EVENT_TOO_BIG) {
+            // The builder is full: flush it, which resets it.
+            session->confirmMessages(&confirmBuilder);
+            confirmBuilder.addMessageConfirmation(message);
+        }
+    }
+    stats->onReceived(numReceived);
+
+    const int rc = session->confirmMessages(&confirmBuilder);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BALL_LOG_ERROR << "Failed to send " << numReceived << " confirms "
+                       << "[rc: " << rc << "]";
+    }
+
+    return rc;
+}
+
+bsl::ostream& BenchmarkUtil::printFieldName(bsl::ostream& stream,
+                                            const char*   name,
+                                            int           indent)
+{
+    const int length = static_cast<int>(bsl::strlen(name));
+
+    stream << bsl::string(indent, ' ') << name;
+    if (length < k_FIELD_NAME_WIDTH) {
+        stream << bsl::string(k_FIELD_NAME_WIDTH - length, '.');
+    }
+    return stream << ": ";
+}
+
+void BenchmarkUtil::printResult(bsl::ostream&          stream,
+                                const BenchmarkResult& result,
+                                int                    indent)
+{
+    printFieldName(stream, "Posted", indent)
+        << mwcu::PrintUtil::prettyNumber(result.d_numPosted) << "\n";
+    printFieldName(stream, "Post failures", indent)
+        << mwcu::PrintUtil::prettyNumber(result.d_numPostFailures) << "\n";
+    printFieldName(stream, "Received", indent)
+        << mwcu::PrintUtil::prettyNumber(result.d_numReceived) << "\n";
+    printFieldName(stream, "Measured", indent)
+        << mwcu::PrintUtil::prettyNumber(result.d_numMeasured) << "\n";
+    if (result.d_numMeasured == 0) {
+        return;  // RETURN
+    }
+
+    printFieldName(stream, "mean", indent)
+        << mwcu::PrintUtil::prettyTimeInterval(result.d_meanLatency) << "\n";
+    for (int i = 0; i < k_NUM_PERCENTILES; ++i) {
+        printFieldName(stream, k_PERCENTILE_NAMES[i], indent)
+            << mwcu::PrintUtil::prettyTimeInterval(
+                   result.d_latencyPercentiles[i])
+            << "\n";
+    }
+}
+
+void BenchmarkUtil::printJsonResult(bsl::ostream&          stream,
+                                    const BenchmarkResult& result,
+                                    int                    indent)
+{
+    const bsl::string pad(indent, ' ');
+
+    stream << pad << "\"posted\": " << result.d_numPosted << ",\n"
+           << pad << "\"postFailures\": " << result.d_numPostFailures << ",\n"
+           << pad << "\"received\": " << result.d_numReceived << ",\n"
+           << pad << "\"measured\": " << result.d_numMeasured << ",\n"
+           << pad << "\"latency\": {\n"
+           << pad << "  \"mean\": " << result.d_meanLatency;
+    for (int i = 0; i < k_NUM_PERCENTILES; ++i) {
+        stream << ",\n"
+               << pad << "  \"" << k_PERCENTILE_NAMES[i]
+               << "\": " << result.d_latencyPercentiles[i];
+    }
+    stream << "\n" << pad << "}";
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,379 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbtst_benchmarkutil.h                                             -*-C++-*-
+#ifndef INCLUDED_MQBTST_BENCHMARKUTIL
+#define INCLUDED_MQBTST_BENCHMARKUTIL
+
+//@PURPOSE: Provide the building blocks of open-loop latency benchmarks.
+//
+//@CLASSES:
+//  mqbtst::BenchmarkSchedule: intended send times of the benchmark messages
+//  mqbtst::BenchmarkResult:   counters and latencies of a benchmark run
+//  mqbtst::BenchmarkStats:    thread-safe recorder of a benchmark run
+//  mqbtst::BenchmarkUtil:     producer, consumer and report of a benchmark
+//
+//@DESCRIPTION: This component provides the parts shared by the benchmarks
+// posting messages to a broker and consuming them back with the same
+// session, such as the 'bench' mode of 'bmqtool' and the in-process benchmark
+// of 'bmqbrkr'.
+//
+/// Open loop
+///---------
+// A 'mqbtst::BenchmarkSchedule' assigns each message of the benchmark an
+// intended send time, which 'mqbtst::BenchmarkUtil::postMessages' carries in
+// the 'BenchmarkUtil::k_INTENDED_TIME_PROPERTY' property of the message.
+// Producers never wait for the broker: when they fall behind the schedule
+// (e.g., because posting was throttled with 'e_BW_LIMIT'), they post the
+// overdue messages in batches to catch up.  Latencies are measured by
+// 'mqbtst::BenchmarkUtil::confirmMessages' from the intended send time rather
+// than from the actual one, so that the time messages spent waiting to be
+// sent is accounted for, and the benchmark does not suffer from coordinated
+// omission.  Only the latencies of the messages whose intended send time is
+// past the warmup of the schedule are recorded.
+//
+/// Report
+///------
+// Latencies are recorded in a 'mwcst::Histogram', so that the percentiles in
+// 'BenchmarkUtil::k_PERCENTILES' are reported within 1/8th of their exact
+// value.  'mqbtst::BenchmarkUtil' prints a 'mqbtst::BenchmarkResult' either as
+// text or as the members of a JSON object, so that benchmarks can add their
+// own fields to the report.
+//
+/// Thread Safety
+///-------------
+// 'mqbtst::BenchmarkStats' is fully thread-safe, so that messages can be
+// posted and consumed by any number of threads.
+
+// BMQ
+#include <bmqa_queueid.h>
+
+// MWC
+#include <mwcst_histogram.h>
+
+// BDE
+#include <bsl_iosfwd.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+
+// FORWARD DECLARATION
+namespace bdlbb {
+class Blob;
+}
+namespace bmqa {
+class AbstractSession;
+class MessageEvent;
+}
+
+namespace mqbtst {
+
+// ========================
+// struct BenchmarkSchedule
+// ========================
+
+/// Intended send times of the messages of a benchmark, from a fixed rate.
+struct BenchmarkSchedule {
+    // PUBLIC DATA
+    bool d_useEpochClock;
+    // True to read the intended send times from
+    // the system clock, and false to read them
+    // from the high resolution timer
+
+    bsls::Types::Int64 d_startTime;
+    // Intended send time, in nanoseconds, of
+    // the first message
+
+    double d_messagePeriod;
+    // Interval, in nanoseconds, between the
+    // intended send times of two consecutive
+    // messages
+
+    bsls::Types::Int64 d_numMessages;
+    // Total number of messages
+
+    bsls::Types::Int64 d_warmupEndTime;
+    // Intended send time from which latencies
+    // are recorded
+
+    bsls::Types::Int64 d_endTime;
+    // Intended send time of the end of the
+    // schedule
+
+    // CREATORS
+
+    /// Create an empty schedule, reading the time from the high resolution
+    /// timer.
+    BenchmarkSchedule();
+
+    // MANIPULATORS
+
+    /// Schedule the specified `numMessages` messages at the specified
+    /// `rate`, in messages per second, the first one being sent the
+    /// specified `startDelay` nanoseconds from now, and the latencies of
+    /// the messages sent during the first specified `warmup` nanoseconds
+    /// not being recorded.  The behavior is undefined unless `0 < rate`.
+    void initialize(bsls::Types::Int64 numMessages,
+                    double             rate,
+                    bsls::Types::Int64 warmup,
+                    bsls::Types::Int64 startDelay = 0);
+
+    // ACCESSORS
+
+    /// Return the current time, in nanoseconds, from the clock of the
+    /// intended send times.
+    bsls::Types::Int64 now() const;
+
+    /// Return the intended send time, in nanoseconds, of the message having
+    /// the specified `sequence` number.
+    bsls::Types::Int64 intendedTime(bsls::Types::Int64 sequence) const;
+
+    /// Return true if the latency of a message having the specified
+    /// `intendedTime` is to be recorded, i.e., if it was sent after the
+    /// warmup and before the end of the schedule.
+    bool isMeasured(bsls::Types::Int64 intendedTime) const;
+
+    /// Return the target rate of the schedule, in messages per second.
+    double rate() const;
+
+    /// Return the duration, in seconds, of the part of the schedule whose
+    /// latencies are recorded.
+    double measuredDuration() const;
+};
+
+// ======================
+// struct BenchmarkResult
+// ======================
+
+/// Counters and latencies of a benchmark run.
+struct BenchmarkResult {
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(BenchmarkResult,
+                                   bslma::UsesBslmaAllocator)
+
+    // PUBLIC DATA
+    bsls::Types::Int64 d_numPosted;
+    // Number of messages posted
+
+    bsls::Types::Int64 d_numPostFailures;
+    // Number of messages which could not be
+    // packed or posted
+
+    bsls::Types::Int64 d_numReceived;
+    // Number of messages received
+
+    bsls::Types::Int64 d_numMeasured;
+    // Number of messages whose latency was
+    // recorded
+
+    bsls::Types::Int64 d_meanLatency;
+    // Mean latency, in nanoseconds
+
+    bsl::vector<bsls::Types::Int64> d_latencyPercentiles;
+    // Latencies, in nanoseconds, at the
+    // 'BenchmarkUtil::k_PERCENTILES'
+
+    // CREATORS
+
+    /// Create an empty result, using the optionally specified `allocator`
+    /// to supply memory.
+    explicit BenchmarkResult(bslma::Allocator* allocator = 0);
+
+    /// Create a result having the same value as the specified `other`,
+    /// using the optionally specified `allocator` to supply memory.
+    BenchmarkResult(const BenchmarkResult& other,
+                    bslma::Allocator*      allocator = 0);
+};
+
+// ====================
+// class BenchmarkStats
+// ====================
+
+/// Thread-safe recorder of the counters and latencies of a benchmark run.
+class BenchmarkStats {
+  private:
+    // DATA
+    bslma::Allocator* d_allocator_p;
+    // Allocator to use
+
+    bsls::AtomicInt64 d_numPosted;
+    // Number of messages posted
+
+    bsls::AtomicInt64 d_numPostFailures;
+    // Number of messages which could not be
+    // packed or posted
+
+    bsls::AtomicInt64 d_numReceived;
+    // Number of messages received
+
+    bsls::AtomicInt64 d_numMeasured;
+    // Number of messages whose latency was
+    // recorded
+
+    bsls::AtomicInt64 d_latencySum;
+    // Sum of the recorded latencies, in
+    // nanoseconds
+
+    mwcst::Histogram d_latencies;
+    // Distribution of the latencies recorded
+    // since the last collection, in
+    // nanoseconds
+
+    mwcst::HistogramSnapshot d_collected;
+    // Distribution of the latencies collected
+    // so far, in nanoseconds
+
+  private:
+    // NOT IMPLEMENTED
+    BenchmarkStats(const BenchmarkStats&) BSLS_KEYWORD_DELETED;
+    BenchmarkStats& operator=(const BenchmarkStats&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(BenchmarkStats, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a recorder with all counters at zero, using the optionally
+    /// specified `allocator` to supply memory.
+    explicit BenchmarkStats(bslma::Allocator* allocator = 0);
+
+    // MANIPULATORS
+
+    /// Account for the specified `count` messages successfully posted.
+    void onPosted(bsls::Types::Int64 count);
+
+    /// Account for the specified `count` messages which could not be
+    /// packed or posted.
+    void onPostFailures(bsls::Types::Int64 count);
+
+    /// Account for the specified `count` messages received.
+    void onReceived(bsls::Types::Int64 count);
+
+    /// Record the specified `latency`, in nanoseconds, of a received
+    /// message.
+    void recordLatency(bsls::Types::Int64 latency);
+
+    /// Load the counters and the latencies recorded so far into the
+    /// specified `result`.  Note that, unlike the other manipulators, this
+    /// method must not be called concurrently with itself.
+    void loadResult(BenchmarkResult* result);
+
+    // ACCESSORS
+
+    /// Return the number of messages successfully posted so far.
+    bsls::Types::Int64 numPosted() const;
+
+    /// Return the number of messages received so far.
+    bsls::Types::Int64 numReceived() const;
+};
+
+// ====================
+// struct BenchmarkUtil
+// ====================
+
+/// Producer, consumer and report of an open-loop benchmark.
+struct BenchmarkUtil {
+    // PUBLIC CLASS DATA
+
+    /// Name of the property holding the intended send time of a message, in
+    /// nanoseconds.
+    static const char k_INTENDED_TIME_PROPERTY[];
+
+    /// Minimum duration, in nanoseconds, to wait for before sleeping rather
+    /// than spinning until an intended send time.
+    static const bsls::Types::Int64 k_MIN_SLEEP_NS;
+
+    /// Number of the `k_PERCENTILES`.
+    static const int k_NUM_PERCENTILES = 6;
+
+    /// Percentiles of the latencies to report.
+    static const double k_PERCENTILES[k_NUM_PERCENTILES];
+
+    /// Names of the `k_PERCENTILES` in the reports.
+    static const char* const k_PERCENTILE_NAMES[k_NUM_PERCENTILES];
+
+    // CLASS METHODS
+
+    /// Wait for the specified `delay`, in nanoseconds: sleep, or spin when
+    /// close to the end of the delay, since sleeping is not that precise.
+    static void waitFor(bsls::Types::Int64 delay);
+
+    /// Post, with the specified `session`, the messages of the specified
+    /// `schedule` whose sequence number is the specified `first` plus a
+    /// multiple of the specified `stride`, at their intended send time, to
+    /// the specified `queueIds` in turn, with the specified `payload`, and
+    /// account for them in the specified `stats`.  Overdue messages are
+    /// posted in events of at most the specified `maxEventSize` messages,
+    /// or of fewer messages if they would exceed the maximum size of an
+    /// event.
+    /// Return once all these messages were posted, or as soon as the
+    /// specified `isRunning` is false.  Use the specified `allocator` to
+    /// supply memory.  The behavior is undefined unless `queueIds` is not
+    /// empty, `0 < stride`, and `0 < maxEventSize`.
+    static void postMessages(bmqa::AbstractSession*            session,
+                             BenchmarkStats*                   stats,
+                             const BenchmarkSchedule&          schedule,
+                             const bsl::vector<bmqa::QueueId>& queueIds,
+                             const bdlbb::Blob&                payload,
+                             bsls::Types::Int64                first,
+                             int                               stride,
+                             int                               maxEventSize,
+                             const bsls::AtomicBool&           isRunning,
+                             bslma::Allocator*                 allocator);
+
+    /// Record in the specified `stats` the messages of the specified
+    /// `event` and, if they were sent after the warmup of the specified
+    /// `schedule`, their latency, and confirm them with the specified
+    /// `session`.  Use the specified `allocator` to supply memory.  Return
+    /// 0 on success, or the non-zero result of
+    /// `bmqa::AbstractSession::confirmMessages` otherwise.  Events other than
+    /// PUSH events are ignored.
+    static int confirmMessages(bmqa::AbstractSession*    session,
+                               BenchmarkStats*           stats,
+                               const BenchmarkSchedule&  schedule,
+                               const bmqa::MessageEvent& event,
+                               bslma::Allocator*         allocator);
+
+    /// Print to the specified `stream` the specified `name` of a field of
+    /// the text report, indented by the specified `indent` spaces.
+    static bsl::ostream&
+    printFieldName(bsl::ostream& stream, const char* name, int indent);
+
+    /// Print the specified `result` as text to the specified `stream`, each
+    /// field being indented by the specified `indent` spaces.
+    static void printResult(bsl::ostream&          stream,
+                            const BenchmarkResult& result,
+                            int                    indent);
+
+    /// Print the specified `result` as the comma-separated members of a
+    /// JSON object to the specified `stream`, each member being indented by
+    /// the specified `indent` spaces.  Note that the last member is not
+    /// followed by a comma nor a new line.
+    static void printJsonResult(bsl::ostream&          stream,
+                                const BenchmarkResult& result,
+                                int                    indent);
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
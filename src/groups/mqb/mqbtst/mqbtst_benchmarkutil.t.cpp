@@ -0,0 +1,244 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbtst_benchmarkutil.t.cpp                                         -*-C++-*-
+#include <mqbtst_benchmarkutil.h>
+
+// MWC
+#include <mwcu_memoutstream.h>
+
+// BDE
+#include <bdlt_timeunitratio.h>
+#include <bsl_string.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_schedule()
+// ------------------------------------------------------------------------
+// SCHEDULE
+//
+// Concerns:
+//   - Messages are scheduled at the requested rate, from the start time.
+//   - Only the messages intended to be sent after the warmup and before
+//     the end of the schedule are measured.
+//   - A warmup longer than the schedule leaves no message measured.
+//
+// Testing:
+//   BenchmarkSchedule::initialize
+//   BenchmarkSchedule::intendedTime
+//   BenchmarkSchedule::isMeasured
+//   BenchmarkSchedule::rate
+//   BenchmarkSchedule::measuredDuration
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("SCHEDULE");
+
+    typedef bsls::Types::Int64 Int64;
+
+    const Int64 k_NS_PER_S  = bdlt::TimeUnitRatio::k_NS_PER_S;
+    const Int64 k_NS_PER_MS = bdlt::TimeUnitRatio::k_NS_PER_MS;
+
+    PV("Warmup within the schedule");
+    {
+        // 3000 messages at 1000 msgs/s, after a 100ms delay, the first
+        // second being the warmup.
+        mqbtst::BenchmarkSchedule obj;
+        const Int64             before = obj.now();
+        obj.initialize(3000, 1000.0, k_NS_PER_S, 100 * k_NS_PER_MS);
+
+        ASSERT_GE(obj.d_startTime, before + 100 * k_NS_PER_MS);
+        ASSERT_EQ(obj.d_numMessages, 3000);
+        ASSERT_EQ(obj.d_endTime, obj.d_startTime + 3 * k_NS_PER_S);
+        ASSERT_EQ(obj.d_warmupEndTime, obj.d_startTime + k_NS_PER_S);
+        ASSERT_EQ(obj.rate(), 1000.0);
+        ASSERT_EQ(obj.measuredDuration(), 2.0);
+
+        ASSERT_EQ(obj.intendedTime(0), obj.d_startTime);
+        ASSERT_EQ(obj.intendedTime(10), obj.d_startTime + 10 * k_NS_PER_MS);
+
+        ASSERT(!obj.isMeasured(obj.intendedTime(0)));
+        ASSERT(!obj.isMeasured(obj.intendedTime(999)));
+        ASSERT(obj.isMeasured(obj.intendedTime(1000)));
+        ASSERT(obj.isMeasured(obj.intendedTime(2999)));
+        ASSERT(!obj.isMeasured(obj.intendedTime(3000)));
+    }
+
+    PV("Warmup longer than the schedule");
+    {
+        mqbtst::BenchmarkSchedule obj;
+        obj.initialize(100, 1000.0, k_NS_PER_S);
+
+        ASSERT_EQ(obj.d_warmupEndTime, obj.d_endTime);
+        ASSERT_EQ(obj.measuredDuration(), 0.0);
+        ASSERT(!obj.isMeasured(obj.intendedTime(99)));
+    }
+}
+
+static void test2_stats()
+// ------------------------------------------------------------------------
+// STATS
+//
+// Concerns:
+//   - The result holds the counters recorded, the mean latency, and the
+//     latencies at all the percentiles.
+//   - Loading a result again accounts for all the latencies recorded
+//     since the creation of the stats, not only for the new ones.
+//
+// Testing:
+//   BenchmarkStats
+//   BenchmarkResult
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("STATS");
+
+    mqbtst::BenchmarkStats  obj(s_allocator_p);
+    mqbtst::BenchmarkResult result(s_allocator_p);
+
+    obj.loadResult(&result);
+    ASSERT_EQ(result.d_numPosted, 0);
+    ASSERT_EQ(result.d_numMeasured, 0);
+    ASSERT_EQ(result.d_meanLatency, 0);
+    ASSERT_EQ(static_cast<int>(result.d_latencyPercentiles.size()),
+              mqbtst::BenchmarkUtil::k_NUM_PERCENTILES);
+
+    obj.onPosted(10);
+    obj.onPostFailures(2);
+    obj.onReceived(8);
+    for (int i = 1; i <= 4; ++i) {
+        obj.recordLatency(i);
+    }
+    ASSERT_EQ(obj.numPosted(), 10);
+    ASSERT_EQ(obj.numReceived(), 8);
+
+    obj.loadResult(&result);
+    ASSERT_EQ(result.d_numPosted, 10);
+    ASSERT_EQ(result.d_numPostFailures, 2);
+    ASSERT_EQ(result.d_numReceived, 8);
+    ASSERT_EQ(result.d_numMeasured, 4);
+    ASSERT_EQ(result.d_meanLatency, 2);
+    ASSERT_EQ(result.d_latencyPercentiles.back(), 4);
+
+    // Small values have a bucket of their own, hence exact percentiles.
+    obj.recordLatency(6);
+    obj.loadResult(&result);
+    ASSERT_EQ(result.d_numMeasured, 5);
+    ASSERT_EQ(result.d_meanLatency, 3);
+    ASSERT_EQ(result.d_latencyPercentiles.front(), 3);
+    ASSERT_EQ(result.d_latencyPercentiles.back(), 6);
+}
+
+static void test3_report()
+// ------------------------------------------------------------------------
+// REPORT
+//
+// Concerns:
+//   - Field names of the text report are padded to the same width.
+//   - Latencies are only printed as text when some were measured.
+//   - The JSON members hold the counters and one latency per percentile.
+//
+// Testing:
+//   BenchmarkUtil::printFieldName
+//   BenchmarkUtil::printResult
+//   BenchmarkUtil::printJsonResult
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("REPORT");
+
+    PV("Field name");
+    {
+        mwcu::MemOutStream os(s_allocator_p);
+        mqbtst::BenchmarkUtil::printFieldName(os, "mean", 2) << "x";
+        ASSERT_EQ(os.str(), "  mean............: x");
+    }
+
+    mqbtst::BenchmarkResult result(s_allocator_p);
+    result.d_numPosted   = 12;
+    result.d_numReceived = 12;
+
+    PV("Text without latencies");
+    {
+        mwcu::MemOutStream os(s_allocator_p);
+        mqbtst::BenchmarkUtil::printResult(os, result, 2);
+        ASSERT_NE(os.str().find("  Received........: 12\n"),
+                  bsl::string::npos);
+        ASSERT_EQ(os.str().find("mean"), bsl::string::npos);
+    }
+
+    result.d_numMeasured = 10;
+    result.d_meanLatency = 5;
+    for (int i = 0; i < mqbtst::BenchmarkUtil::k_NUM_PERCENTILES; ++i) {
+        result.d_latencyPercentiles[i] = i + 1;
+    }
+
+    PV("Text with latencies");
+    {
+        mwcu::MemOutStream os(s_allocator_p);
+        mqbtst::BenchmarkUtil::printResult(os, result, 2);
+        ASSERT_NE(os.str().find("  mean............: "), bsl::string::npos);
+        ASSERT_NE(os.str().find("  p99.99..........: "), bsl::string::npos);
+    }
+
+    PV("JSON");
+    {
+        mwcu::MemOutStream os(s_allocator_p);
+        mqbtst::BenchmarkUtil::printJsonResult(os, result, 2);
+        ASSERT_EQ(os.str(),
+                  "  \"posted\": 12,\n"
+                  "  \"postFailures\": 0,\n"
+                  "  \"received\": 12,\n"
+                  "  \"measured\": 10,\n"
+                  "  \"latency\": {\n"
+                  "    \"mean\": 5,\n"
+                  "    \"p50\": 1,\n"
+                  "    \"p90\": 2,\n"
+                  "    \"p99\": 3,\n"
+                  "    \"p99.9\": 4,\n"
+                  "    \"p99.99\": 5,\n"
+                  "    \"max\": 6\n"
+                  "  }");
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_report(); break;
+    case 2: test2_stats(); break;
+    case 1: test1_schedule(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
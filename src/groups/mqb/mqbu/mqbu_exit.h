@@ -71,7 +71,8 @@ struct ExitCode {
                                // pipe control channel, ..
 
         ,
-        e_BENCH_START = 4  // Unable to start the bench application.
+        e_BENCH_START = 4  // Unable to start, or to run, the benchmark
+                           // of the broker.
 
         ,
         e_APP_INITIALIZE = 5  // Failed to initialize the application.
@@ -0,0 +1,964 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcc_ringhashmap.h                                                 -*-C++-*-
+#ifndef INCLUDED_MWCC_RINGHASHMAP
+#define INCLUDED_MWCC_RINGHASHMAP
+
+//@PURPOSE: Provide an insertion-ordered hash map stored in a ring buffer.
+//
+//@CLASSES:
+//  mwcc::RingHashMap : Insertion-ordered hash map optimized for FIFO erasure.
+//
+//@SEE_ALSO: mwcc_orderedhashmap
+//
+//@DESCRIPTION: 'mwcc::RingHashMap' provides an associative container with
+// constant time insertion, deletion and lookup, which iterates over its
+// elements in insertion order, just like 'mwcc::OrderedHashMap'.  Unlike
+// 'mwcc::OrderedHashMap', it does not allocate a node per element: it is
+// optimized for the case where elements are mostly erased in the order they
+// were inserted (e.g., messages pending confirmation), and for containers
+// holding a large number of elements.
+//
+// Each inserted element is assigned a monotonically increasing sequence
+// number, and is stored in the slot of a ring buffer indexed by that sequence
+// number.  Keys are looked up through an open-addressing (linear probing)
+// hash index mapping each key to its sequence number.  Erasing an element
+// leaves a tombstone in the ring, and erasing the oldest element of the ring
+// releases its slot along with any tombstone following it, so that in-order
+// erasure keeps the ring dense.
+//
+// When the ring is full but mostly made of tombstones (because some old
+// elements are not being erased), its oldest elements are moved to a small
+// ordered overflow map instead of growing the ring.  This bounds the memory
+// used by the ring to a small multiple of the number of elements, at the
+// cost of logarithmic operations on the elements which have been moved to the
+// overflow map.
+//
+/// Behavior of insert() routine
+///----------------------------
+// Like 'mwcc::OrderedHashMap', the newly inserted element is always assigned
+// the iterator returned by 'end()' before the insertion.
+//
+/// Iterator, pointer and reference invalidation
+///--------------------------------------------
+// Iterators refer to elements by their sequence number and are *not*
+// invalidated by any operation other than the erasure of the element they
+// refer to, and 'clear'.  Pointers and references to elements are
+// invalidated by 'insert' (which may relocate elements), and by the erasure
+// of the element they refer to.
+//
+/// Exception Safety
+///----------------
+// At this time, this component provides *no* exception safety guarantee.
+//
+/// Thread Safety
+///-------------
+// Not thread safe.
+//
+/// Usage
+///-----
+//..
+//  typedef mwcc::RingHashMap<int, bsl::string> MyMap;
+//  MyMap map(allocator);
+//
+//  map.insert(bsl::make_pair(1, "one"));
+//  map.insert(bsl::make_pair(2, "two"));
+//
+//  MyMap::iterator it = map.find(1);
+//  BSLS_ASSERT(it != map.end());
+//  map.erase(it);
+//  BSLS_ASSERT(1 == map.size());
+//..
+
+// MWC
+
+// BDE
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+#include <bslalg_scalarprimitives.h>
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmf_removecv.h>
+#include <bsls_assert.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+
+namespace mwcc {
+
+// FORWARD DECLARATION
+template <class KEY, class VALUE, class HASH>
+class RingHashMap;
+
+// =============================
+// struct RingHashMap_ImpDetails
+// =============================
+
+/// PRIVATE CLASS. For use only by `mwcc::RingHashMap` implementation.
+struct RingHashMap_ImpDetails {
+    // CONSTANTS
+
+    /// Sequence number of an empty slot of the hash index.
+    static const bsls::Types::Uint64 k_NO_SEQUENCE =
+        0xFFFFFFFFFFFFFFFFULL;
+
+    /// Initial number of slots of the ring.
+    static const size_t k_INITIAL_RING_CAPACITY = 16;
+
+    /// Initial number of slots of the hash index.
+    static const size_t k_INITIAL_INDEX_CAPACITY = 32;
+
+    // CLASS METHODS
+
+    /// Return the specified `hash` with its bits mixed, so that its lowest
+    /// bits can be used to select a slot of the hash index.
+    static bsls::Types::Uint64 mix(bsls::Types::Uint64 hash);
+};
+
+// ==========================
+// class RingHashMap_Iterator
+// ==========================
+
+/// PRIVATE CLASS TEMPLATE. For use only by `mwcc::RingHashMap`
+/// implementation.  Iterator over the elements of a `MAP` of type `VALUE`.
+template <class MAP, class VALUE>
+class RingHashMap_Iterator {
+  private:
+    // PRIVATE TYPES
+    typedef typename bsl::remove_cv<MAP>::type NcMap;
+
+    typedef typename bsl::remove_cv<VALUE>::type NcValue;
+
+    typedef RingHashMap_Iterator<NcMap, NcValue> NcIter;
+
+    // FRIENDS
+    template <class RHM_KEY, class RHM_VALUE, class RHM_HASH>
+    friend class RingHashMap;
+
+    friend class RingHashMap_Iterator<const MAP, const VALUE>;
+
+    template <class MAP1, class VALUE1, class MAP2, class VALUE2>
+    friend bool operator==(const RingHashMap_Iterator<MAP1, VALUE1>&,
+                           const RingHashMap_Iterator<MAP2, VALUE2>&);
+
+    // DATA
+    MAP* d_map_p;
+
+    bsls::Types::Uint64 d_sequence;
+
+  private:
+    // PRIVATE CREATORS
+
+    /// Create an iterator pointing to the element of the specified `map`
+    /// having the specified `sequence` number.
+    RingHashMap_Iterator(MAP* map, bsls::Types::Uint64 sequence);
+
+  public:
+    // CREATORS
+
+    /// Create a singular iterator (i.e., one that cannot be incremented or
+    /// dereferenced).
+    RingHashMap_Iterator();
+
+    /// Create an iterator to `VALUE` from the corresponding iterator to
+    /// non-const `VALUE`.  If `VALUE` is not const-qualified, then this
+    /// constructor becomes the copy constructor.  Otherwise, the copy
+    /// constructor is implicitly generated.
+    RingHashMap_Iterator(const NcIter& other);
+
+    // MANIPULATORS
+
+    /// Advance this iterator to the next element in insertion order and
+    /// return its new value.  The behavior is undefined unless this
+    /// iterator is in the range `[begin() .. end())`.
+    RingHashMap_Iterator& operator++();
+
+    /// Advance this iterator to the next element in insertion order and
+    /// return its previous value.  The behavior is undefined unless this
+    /// iterator is in the range `[begin() .. end())`.
+    RingHashMap_Iterator operator++(int);
+
+    // ACCESSORS
+
+    /// Return a reference to the element referenced by this iterator.  The
+    /// behavior is undefined unless this iterator is in the range
+    /// `[begin() .. end())`.
+    VALUE& operator*() const;
+
+    /// Return a pointer to the element referenced by this iterator.  The
+    /// behavior is undefined unless this iterator is in the range
+    /// `[begin() .. end())`.
+    VALUE* operator->() const;
+};
+
+// FREE OPERATORS
+
+/// Return `true` if the specified iterators `lhs` and `rhs` refer to the
+/// same element of the same map, or are both the `end()` iterator of the
+/// same map, and `false` otherwise.
+template <class MAP1, class VALUE1, class MAP2, class VALUE2>
+bool operator==(const RingHashMap_Iterator<MAP1, VALUE1>& lhs,
+                const RingHashMap_Iterator<MAP2, VALUE2>& rhs);
+
+/// Return `true` if the specified iterators `lhs` and `rhs` do not have
+/// the same value, and `false` otherwise.
+template <class MAP1, class VALUE1, class MAP2, class VALUE2>
+bool operator!=(const RingHashMap_Iterator<MAP1, VALUE1>& lhs,
+                const RingHashMap_Iterator<MAP2, VALUE2>& rhs);
+
+// =================
+// class RingHashMap
+// =================
+
+/// Insertion-ordered hash map optimized for FIFO erasure.
+template <class KEY, class VALUE, class HASH = bsl::hash<KEY> >
+class RingHashMap {
+  public:
+    // TYPES
+    typedef KEY                         key_type;
+    typedef VALUE                       mapped_type;
+    typedef HASH                        hasher;
+    typedef bsl::pair<const KEY, VALUE> value_type;
+    typedef size_t                      size_type;
+
+    typedef RingHashMap_Iterator<RingHashMap, value_type> iterator;
+    typedef RingHashMap_Iterator<const RingHashMap, const value_type>
+        const_iterator;
+
+  private:
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Sequence;
+
+    typedef RingHashMap_ImpDetails ImpDetails;
+
+    /// Slot of the ring, holding an element or a tombstone.
+    struct Slot {
+        bsls::ObjectBuffer<value_type> d_value;
+
+        bool d_isValid;
+
+        Slot()
+        : d_isValid(false)
+        {
+        }
+    };
+
+    /// Slot of the hash index, referring to an element by its sequence
+    /// number.
+    struct IndexEntry {
+        Sequence d_sequence;
+
+        size_t d_hash;
+    };
+
+    typedef bsl::vector<Slot> Ring;
+
+    typedef bsl::vector<IndexEntry> Index;
+
+    typedef bsl::map<Sequence, value_type> Overflow;
+
+    // FRIENDS
+    template <class RHMI_MAP, class RHMI_VALUE>
+    friend class RingHashMap_Iterator;
+
+    // DATA
+    Ring d_ring;
+    // Ring of elements indexed by sequence
+    // number (modulo the ring capacity)
+
+    Sequence d_head;
+    // Sequence number of the oldest element
+    // of the ring; always refers to a valid
+    // element unless the ring is empty
+
+    Sequence d_tail;
+    // Sequence number assigned to the next
+    // inserted element
+
+    size_t d_numInRing;
+    // Number of valid elements in the ring
+
+    Overflow d_overflow;
+    // Elements older than 'd_head' which
+    // were moved out of the ring
+
+    Index d_index;
+    // Open-addressing hash index from key to
+    // sequence number
+
+    size_t d_numInIndex;
+    // Number of occupied slots of the index
+
+    HASH d_hasher;
+    // Hash functor
+
+    bslma::Allocator* d_allocator_p;
+    // Allocator to use
+
+  private:
+    // NOT IMPLEMENTED
+    RingHashMap(const RingHashMap&);
+    RingHashMap& operator=(const RingHashMap&);
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Append an entry for the element having the specified `sequence`
+    /// number and key `hash` to the hash index.
+    void insertIndex(Sequence sequence, size_t hash);
+
+    /// Remove the entry at the specified `position` from the hash index.
+    void eraseIndex(size_t position);
+
+    /// Make sure the hash index can hold one more entry while keeping its
+    /// load factor below 0.5, rehashing it if needed.
+    void reserveIndex();
+
+    /// Make sure the ring has a free slot for the next inserted element,
+    /// either by growing the ring or by moving its oldest elements to the
+    /// overflow map.
+    void reserveRing();
+
+    /// Advance `d_head` past the tombstones at the head of the ring.
+    void advanceHead();
+
+    /// Destroy the element stored in the specified `slot`.
+    void destroySlot(Slot* slot);
+
+    // PRIVATE ACCESSORS
+
+    /// Return the slot of the ring for the specified `sequence` number.
+    Slot& slot(Sequence sequence) const;
+
+    /// Return a reference to the element having the specified `sequence`
+    /// number.  The behavior is undefined unless such an element exists.
+    value_type& valueAt(Sequence sequence) const;
+
+    /// Return the sequence number of the element following the element
+    /// having the specified `sequence` number in insertion order, or
+    /// `d_tail` if there is no such element.
+    Sequence nextSequence(Sequence sequence) const;
+
+    /// Return the position in the hash index of the first slot to probe
+    /// for the specified `hash`.
+    size_t homePosition(size_t hash) const;
+
+    /// Return the position in the hash index of the entry for the
+    /// specified `key` having the specified `hash`, or `d_index.size()` if
+    /// there is no such entry.
+    size_t findPosition(const KEY& key, size_t hash) const;
+
+    /// Return the position in the hash index of the entry for the element
+    /// having the specified `sequence` number and key `hash`.  The behavior
+    /// is undefined unless such an entry exists.
+    size_t findPosition(Sequence sequence, size_t hash) const;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(RingHashMap, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty map using the optionally specified `basicAllocator`
+    /// to supply memory.
+    explicit RingHashMap(bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~RingHashMap();
+
+    // MANIPULATORS
+
+    /// Return an iterator to the first element in insertion order, or
+    /// `end()` if this map is empty.
+    iterator begin();
+
+    /// Return the past-the-end iterator.
+    iterator end();
+
+    /// Remove all elements from this map.
+    void clear();
+
+    /// Insert the specified `value` into this map if its key does not
+    /// already exist.  Return a pair whose `first` member is an iterator
+    /// to the element having the key of `value`, and whose `second` member
+    /// is `true` if `value` was inserted, and `false` otherwise.
+    bsl::pair<iterator, bool> insert(const value_type& value);
+
+    /// Remove the element at the specified `position` from this map and
+    /// return an iterator to the element following it in insertion order.
+    /// The behavior is undefined unless `position` refers to an element of
+    /// this map.
+    iterator erase(const_iterator position);
+
+    /// Remove the element having the specified `key`, if any, from this
+    /// map.  Return the number of removed elements (0 or 1).
+    size_t erase(const KEY& key);
+
+    /// Return an iterator to the element having the specified `key`, or
+    /// `end()` if there is no such element.
+    iterator find(const KEY& key);
+
+    // ACCESSORS
+
+    /// Return an iterator to the first element in insertion order, or
+    /// `end()` if this map is empty.
+    const_iterator begin() const;
+
+    /// Return the past-the-end iterator.
+    const_iterator end() const;
+
+    /// Return an iterator to the element having the specified `key`, or
+    /// `end()` if there is no such element.
+    const_iterator find(const KEY& key) const;
+
+    /// Return the number of elements in this map.
+    size_t size() const;
+
+    /// Return `true` if this map has no elements, and `false` otherwise.
+    bool empty() const;
+
+    /// Return the number of elements which were moved out of the ring to
+    /// the overflow map.  Note that this is intended for testing and
+    /// monitoring purposes.
+    size_t overflowSize() const;
+
+    /// Return the allocator used by this map to supply memory.
+    bslma::Allocator* allocator() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// -----------------------------
+// struct RingHashMap_ImpDetails
+// -----------------------------
+
+inline bsls::Types::Uint64
+RingHashMap_ImpDetails::mix(bsls::Types::Uint64 hash)
+{
+    // Finalizer of MurmurHash3
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+// --------------------------
+// class RingHashMap_Iterator
+// --------------------------
+
+// PRIVATE CREATORS
+template <class MAP, class VALUE>
+inline RingHashMap_Iterator<MAP, VALUE>::RingHashMap_Iterator(
+    MAP*                map,
+    bsls::Types::Uint64 sequence)
+: d_map_p(map)
+, d_sequence(sequence)
+{
+}
+
+// CREATORS
+template <class MAP, class VALUE>
+inline RingHashMap_Iterator<MAP, VALUE>::RingHashMap_Iterator()
+: d_map_p(0)
+, d_sequence(0)
+{
+}
+
+template <class MAP, class VALUE>
+inline RingHashMap_Iterator<MAP, VALUE>::RingHashMap_Iterator(
+    const NcIter& other)
+: d_map_p(other.d_map_p)
+, d_sequence(other.d_sequence)
+{
+}
+
+// MANIPULATORS
+template <class MAP, class VALUE>
+inline RingHashMap_Iterator<MAP, VALUE>&
+RingHashMap_Iterator<MAP, VALUE>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_map_p);
+
+    d_sequence = d_map_p->nextSequence(d_sequence);
+    return *this;
+}
+
+template <class MAP, class VALUE>
+inline RingHashMap_Iterator<MAP, VALUE>
+RingHashMap_Iterator<MAP, VALUE>::operator++(int)
+{
+    RingHashMap_Iterator tmp(*this);
+    ++*this;
+    return tmp;
+}
+
+// ACCESSORS
+template <class MAP, class VALUE>
+inline VALUE& RingHashMap_Iterator<MAP, VALUE>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_map_p);
+
+    return d_map_p->valueAt(d_sequence);
+}
+
+template <class MAP, class VALUE>
+inline VALUE* RingHashMap_Iterator<MAP, VALUE>::operator->() const
+{
+    return &(operator*());
+}
+
+// -----------------
+// class RingHashMap
+// -----------------
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH>
+inline void RingHashMap<KEY, VALUE, HASH>::insertIndex(Sequence sequence,
+                                                       size_t   hash)
+{
+    const size_t mask     = d_index.size() - 1;
+    size_t       position = homePosition(hash);
+    while (d_index[position].d_sequence != ImpDetails::k_NO_SEQUENCE) {
+        position = (position + 1) & mask;
+    }
+
+    d_index[position].d_sequence = sequence;
+    d_index[position].d_hash     = hash;
+    ++d_numInIndex;
+}
+
+template <class KEY, class VALUE, class HASH>
+inline void RingHashMap<KEY, VALUE, HASH>::eraseIndex(size_t position)
+{
+    // Backward shift deletion: move back the entries following 'position'
+    // which can be moved closer to their home position, so that no probe
+    // sequence is broken by the removed entry.
+    const size_t mask = d_index.size() - 1;
+    size_t       hole = position;
+    size_t       next = (position + 1) & mask;
+
+    while (d_index[next].d_sequence != ImpDetails::k_NO_SEQUENCE) {
+        const size_t home = homePosition(d_index[next].d_hash);
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+            d_index[hole] = d_index[next];
+            hole          = next;
+        }
+        next = (next + 1) & mask;
+    }
+
+    d_index[hole].d_sequence = ImpDetails::k_NO_SEQUENCE;
+    --d_numInIndex;
+}
+
+template <class KEY, class VALUE, class HASH>
+void RingHashMap<KEY, VALUE, HASH>::reserveIndex()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY((d_numInIndex + 1) * 2 <=
+                                            d_index.size())) {
+        return;  // RETURN
+    }
+
+    const size_t     capacity = d_index.empty()
+                                    ? ImpDetails::k_INITIAL_INDEX_CAPACITY
+                                    : d_index.size() * 2;
+    const IndexEntry empty    = {ImpDetails::k_NO_SEQUENCE, 0};
+
+    Index index(capacity, empty, d_allocator_p);
+    d_index.swap(index);
+    d_numInIndex = 0;
+
+    for (typename Index::const_iterator it = index.begin(); it != index.end();
+         ++it) {
+        if (it->d_sequence != ImpDetails::k_NO_SEQUENCE) {
+            insertIndex(it->d_sequence, it->d_hash);
+        }
+    }
+}
+
+template <class KEY, class VALUE, class HASH>
+void RingHashMap<KEY, VALUE, HASH>::reserveRing()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_tail - d_head < d_ring.size())) {
+        return;  // RETURN
+    }
+
+    if (d_ring.empty()) {
+        Ring ring(ImpDetails::k_INITIAL_RING_CAPACITY, d_allocator_p);
+        d_ring.swap(ring);
+        return;  // RETURN
+    }
+
+    if (d_numInRing * 2 <= d_ring.size()) {
+        // The ring is mostly made of tombstones, which are held by old
+        // elements: move the oldest elements to the overflow map until a
+        // slot is available.
+        while (d_tail - d_head >= d_ring.size()) {
+            Slot& oldest = slot(d_head);
+            BSLS_ASSERT_SAFE(oldest.d_isValid);
+
+            d_overflow.insert(
+                bsl::make_pair(d_head, oldest.d_value.object()));
+            destroySlot(&oldest);
+            advanceHead();
+        }
+        return;  // RETURN
+    }
+
+    // Grow the ring.  Note that sequence numbers, and therefore iterators,
+    // are unchanged.
+    Ring         ring(d_ring.size() * 2, d_allocator_p);
+    const size_t mask = ring.size() - 1;
+    for (Sequence sequence = d_head; sequence != d_tail; ++sequence) {
+        Slot& from = slot(sequence);
+        if (!from.d_isValid) {
+            continue;  // CONTINUE
+        }
+
+        Slot& to = ring[sequence & mask];
+        bslalg::ScalarPrimitives::copyConstruct(to.d_value.address(),
+                                                from.d_value.object(),
+                                                d_allocator_p);
+        to.d_isValid = true;
+        from.d_value.object().~value_type();
+        from.d_isValid = false;
+    }
+    d_ring.swap(ring);
+}
+
+template <class KEY, class VALUE, class HASH>
+inline void RingHashMap<KEY, VALUE, HASH>::advanceHead()
+{
+    while (d_head != d_tail && !slot(d_head).d_isValid) {
+        ++d_head;
+    }
+}
+
+template <class KEY, class VALUE, class HASH>
+inline void RingHashMap<KEY, VALUE, HASH>::destroySlot(Slot* slot)
+{
+    BSLS_ASSERT_SAFE(slot->d_isValid);
+
+    slot->d_value.object().~value_type();
+    slot->d_isValid = false;
+    --d_numInRing;
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH>
+inline typename RingHashMap<KEY, VALUE, HASH>::Slot&
+RingHashMap<KEY, VALUE, HASH>::slot(Sequence sequence) const
+{
+    return const_cast<Slot&>(d_ring[sequence & (d_ring.size() - 1)]);
+}
+
+template <class KEY, class VALUE, class HASH>
+inline typename RingHashMap<KEY, VALUE, HASH>::value_type&
+RingHashMap<KEY, VALUE, HASH>::valueAt(Sequence sequence) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(sequence < d_head)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        typename Overflow::const_iterator it = d_overflow.find(sequence);
+        BSLS_ASSERT_SAFE(it != d_overflow.end());
+        return const_cast<value_type&>(it->second);  // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(sequence < d_tail);
+    BSLS_ASSERT_SAFE(slot(sequence).d_isValid);
+    return slot(sequence).d_value.object();
+}
+
+template <class KEY, class VALUE, class HASH>
+inline typename RingHashMap<KEY, VALUE, HASH>::Sequence
+RingHashMap<KEY, VALUE, HASH>::nextSequence(Sequence sequence) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(sequence < d_head)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        typename Overflow::const_iterator it = d_overflow.upper_bound(
+            sequence);
+        return it == d_overflow.end() ? d_head : it->first;  // RETURN
+    }
+
+    do {
+        ++sequence;
+    } while (sequence < d_tail && !slot(sequence).d_isValid);
+
+    return sequence;
+}
+
+template <class KEY, class VALUE, class HASH>
+inline size_t RingHashMap<KEY, VALUE, HASH>::homePosition(size_t hash) const
+{
+    return static_cast<size_t>(ImpDetails::mix(hash)) & (d_index.size() - 1);
+}
+
+template <class KEY, class VALUE, class HASH>
+inline size_t RingHashMap<KEY, VALUE, HASH>::findPosition(const KEY& key,
+                                                          size_t hash) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_index.empty())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return d_index.size();  // RETURN
+    }
+
+    const size_t mask = d_index.size() - 1;
+    for (size_t position = homePosition(hash);;
+         position        = (position + 1) & mask) {
+        const IndexEntry& entry = d_index[position];
+        if (entry.d_sequence == ImpDetails::k_NO_SEQUENCE) {
+            return d_index.size();  // RETURN
+        }
+        if (entry.d_hash == hash && valueAt(entry.d_sequence).first == key) {
+            return position;  // RETURN
+        }
+    }
+}
+
+template <class KEY, class VALUE, class HASH>
+inline size_t RingHashMap<KEY, VALUE, HASH>::findPosition(Sequence sequence,
+                                                          size_t hash) const
+{
+    const size_t mask     = d_index.size() - 1;
+    size_t       position = homePosition(hash);
+    while (d_index[position].d_sequence != sequence) {
+        BSLS_ASSERT_SAFE(d_index[position].d_sequence !=
+                         ImpDetails::k_NO_SEQUENCE);
+        position = (position + 1) & mask;
+    }
+
+    return position;
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH>
+inline RingHashMap<KEY, VALUE, HASH>::RingHashMap(
+    bslma::Allocator* basicAllocator)
+: d_ring(basicAllocator)
+, d_head(0)
+, d_tail(0)
+, d_numInRing(0)
+, d_overflow(basicAllocator)
+, d_index(basicAllocator)
+, d_numInIndex(0)
+, d_hasher()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <class KEY, class VALUE, class HASH>
+inline RingHashMap<KEY, VALUE, HASH>::~RingHashMap()
+{
+    clear();
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH>
+inline typename RingHashMap<KEY, VALUE, HASH>::iterator
+RingHashMap<KEY, VALUE, HASH>::begin()
+{
+    return iterator(this,
+                    d_overflow.empty() ? d_head : d_overflow.begin()->first);
+}
+
+template <class KEY, class VALUE, class HASH>
+inline typename RingHashMap<KEY, VALUE, HASH>::iterator
+RingHashMap<KEY, VALUE, HASH>::end()
+{
+    return iterator(this, d_tail);
+}
+
+template <class KEY, class VALUE, class HASH>
+void RingHashMap<KEY, VALUE, HASH>::clear()
+{
+    for (Sequence sequence = d_head; sequence != d_tail; ++sequence) {
+        Slot& current = slot(sequence);
+        if (current.d_isValid) {
+            destroySlot(&current);
+        }
+    }
+    BSLS_ASSERT_SAFE(d_numInRing == 0);
+
+    d_head = d_tail = 0;
+    d_overflow.clear();
+
+    const IndexEntry empty = {ImpDetails::k_NO_SEQUENCE, 0};
+    bsl::fill(d_index.begin(), d_index.end(), empty);
+    d_numInIndex = 0;
+}
+
+template <class KEY, class VALUE, class HASH>
+inline bsl::pair<typename RingHashMap<KEY, VALUE, HASH>::iterator, bool>
+RingHashMap<KEY, VALUE, HASH>::insert(const value_type& value)
+{
+    const size_t hash     = d_hasher(value.first);
+    const size_t position = findPosition(value.first, hash);
+    if (position < d_index.size()) {
+        return bsl::make_pair(iterator(this, d_index[position].d_sequence),
+                              false);  // RETURN
+    }
+
+    reserveIndex();
+    reserveRing();
+
+    const Sequence sequence = d_tail++;
+    Slot&          current  = slot(sequence);
+    BSLS_ASSERT_SAFE(!current.d_isValid);
+
+    bslalg::ScalarPrimitives::copyConstruct(current.d_value.address(),
+                                            value,
+                                            d_allocator_p);
+    current.d_isValid = true;
+    ++d_numInRing;
+
+    insertIndex(sequence, hash);
+
+    return bsl::make_pair(iterator(this, sequence), true);
+}
+
+template <class KEY, class VALUE, class HASH>
+inline typename RingHashMap<KEY, VALUE, HASH>::iterator
+RingHashMap<KEY, VALUE, HASH>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position.d_map_p == this);
+
+    const Sequence sequence = position.d_sequence;
+    const Sequence next     = nextSequence(sequence);
+
+    eraseIndex(findPosition(sequence, d_hasher(valueAt(sequence).first)));
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(sequence < d_head)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        d_overflow.erase(sequence);
+    }
+    else {
+        destroySlot(&slot(sequence));
+        if (sequence == d_head) {
+            advanceHead();
+        }
+    }
+
+    return iterator(this, next);
+}
+
+template <class KEY, class VALUE, class HASH>
+inline size_t RingHashMap<KEY, VALUE, HASH>::erase(const KEY& key)
+{
+    iterator it = find(key);
+    if (it == end()) {
+        return 0;  // RETURN
+    }
+
+    erase(it);
+    return 1;
+}
+
+template <class KEY, class VALUE, class HASH>
+inline typename RingHashMap<KEY, VALUE, HASH>::iterator
+RingHashMap<KEY, VALUE, HASH>::find(const KEY& key)
+{
+    const size_t position = findPosition(key, d_hasher(key));
+    if (position < d_index.size()) {
+        return iterator(this, d_index[position].d_sequence);  // RETURN
+    }
+
+    return end();
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH>
+inline typename RingHashMap<KEY, VALUE, HASH>::const_iterator
+RingHashMap<KEY, VALUE, HASH>::begin() const
+{
+    return const_iterator(this,
+                          d_overflow.empty() ? d_head
+                                             : d_overflow.begin()->first);
+}
+
+template <class KEY, class VALUE, class HASH>
+inline typename RingHashMap<KEY, VALUE, HASH>::const_iterator
+RingHashMap<KEY, VALUE, HASH>::end() const
+{
+    return const_iterator(this, d_tail);
+}
+
+template <class KEY, class VALUE, class HASH>
+inline typename RingHashMap<KEY, VALUE, HASH>::const_iterator
+RingHashMap<KEY, VALUE, HASH>::find(const KEY& key) const
+{
+    const size_t position = findPosition(key, d_hasher(key));
+    if (position < d_index.size()) {
+        return const_iterator(this,
+                              d_index[position].d_sequence);  // RETURN
+    }
+
+    return end();
+}
+
+template <class KEY, class VALUE, class HASH>
+inline size_t RingHashMap<KEY, VALUE, HASH>::size() const
+{
+    return d_numInRing + d_overflow.size();
+}
+
+template <class KEY, class VALUE, class HASH>
+inline bool RingHashMap<KEY, VALUE, HASH>::empty() const
+{
+    return size() == 0;
+}
+
+template <class KEY, class VALUE, class HASH>
+inline size_t RingHashMap<KEY, VALUE, HASH>::overflowSize() const
+{
+    return d_overflow.size();
+}
+
+template <class KEY, class VALUE, class HASH>
+inline bslma::Allocator* RingHashMap<KEY, VALUE, HASH>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class MAP1, class VALUE1, class MAP2, class VALUE2>
+inline bool mwcc::operator==(const RingHashMap_Iterator<MAP1, VALUE1>& lhs,
+                             const RingHashMap_Iterator<MAP2, VALUE2>& rhs)
+{
+    return lhs.d_map_p == rhs.d_map_p && lhs.d_sequence == rhs.d_sequence;
+}
+
+template <class MAP1, class VALUE1, class MAP2, class VALUE2>
+inline bool mwcc::operator!=(const RingHashMap_Iterator<MAP1, VALUE1>& lhs,
+                             const RingHashMap_Iterator<MAP2, VALUE2>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,279 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcc_ringhashmap.t.cpp                                             -*-C++-*-
+#include <mwcc_ringhashmap.h>
+
+// BDE
+#include <bsl_cstdlib.h>
+#include <bsl_list.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Testing:
+//   Basic functionality of 'mwcc::RingHashMap'.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    typedef mwcc::RingHashMap<int, bsl::string> MyMapType;
+    typedef MyMapType::iterator                 IterType;
+
+    MyMapType map(s_allocator_p);
+    ASSERT(map.empty());
+    ASSERT_EQ(map.size(), 0U);
+    ASSERT(map.begin() == map.end());
+    ASSERT(map.find(1) == map.end());
+
+    bsl::pair<IterType, bool> rc = map.insert(bsl::make_pair(1, "one"));
+    ASSERT(rc.second);
+    ASSERT_EQ(rc.first->first, 1);
+    ASSERT_EQ(rc.first->second, "one");
+
+    rc = map.insert(bsl::make_pair(2, "two"));
+    ASSERT(rc.second);
+
+    // Duplicate key
+    rc = map.insert(bsl::make_pair(1, "uno"));
+    ASSERT(!rc.second);
+    ASSERT_EQ(rc.first->second, "one");
+    ASSERT_EQ(map.size(), 2U);
+
+    // Insertion order
+    IterType it = map.begin();
+    ASSERT_EQ(it->first, 1);
+    ++it;
+    ASSERT_EQ(it->first, 2);
+    ++it;
+    ASSERT(it == map.end());
+
+    ASSERT_EQ(map.erase(1), 1U);
+    ASSERT_EQ(map.erase(1), 0U);
+    ASSERT(map.find(1) == map.end());
+    ASSERT_EQ(map.begin()->first, 2);
+
+    map.clear();
+    ASSERT(map.empty());
+    ASSERT(map.begin() == map.end());
+}
+
+static void test2_previousEndIterator()
+// ------------------------------------------------------------------------
+// PREVIOUS END ITERATOR
+//
+// Testing:
+//   The iterator returned by 'end()' before an insertion refers to the
+//   inserted element.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("PREVIOUS END ITERATOR");
+
+    typedef mwcc::RingHashMap<int, int> MyMapType;
+    typedef MyMapType::iterator         IterType;
+
+    MyMapType map(s_allocator_p);
+
+    for (int i = 0; i < 1000; ++i) {
+        IterType endIt = map.end();
+        map.insert(bsl::make_pair(i, i * 10));
+        ASSERT_EQ(endIt->first, i);
+        ASSERT_EQ(endIt->second, i * 10);
+        ASSERT(++endIt == map.end());
+    }
+}
+
+static void test3_eraseDuringIteration()
+// ------------------------------------------------------------------------
+// ERASE DURING ITERATION
+//
+// Testing:
+//   - 'erase(iterator)' returns the iterator to the next element
+//   - iterators are not invalidated when the ring grows
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("ERASE DURING ITERATION");
+
+    typedef mwcc::RingHashMap<int, int> MyMapType;
+    typedef MyMapType::iterator         IterType;
+
+    const int k_NUM_ELEMENTS = 1000;
+
+    MyMapType map(s_allocator_p);
+    map.insert(bsl::make_pair(0, 0));
+    IterType first = map.begin();
+
+    // Growing the ring does not invalidate 'first'
+    for (int i = 1; i < k_NUM_ELEMENTS; ++i) {
+        map.insert(bsl::make_pair(i, i));
+    }
+    ASSERT_EQ(first->first, 0);
+
+    // Erase all even elements while iterating
+    for (IterType it = map.begin(); it != map.end();) {
+        if (it->first % 2 == 0) {
+            it = map.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+    ASSERT_EQ(map.size(), static_cast<size_t>(k_NUM_ELEMENTS / 2));
+
+    int expected = 1;
+    for (MyMapType::const_iterator cit = map.begin(); cit != map.end();
+         ++cit) {
+        ASSERT_EQ(cit->first, expected);
+        expected += 2;
+    }
+}
+
+static void test4_stuckOldestElement()
+// ------------------------------------------------------------------------
+// STUCK OLDEST ELEMENT
+//
+// Concerns:
+//   An old element which is never erased does not make the ring grow
+//   without bound, and remains accessible in insertion order.
+//
+// Testing:
+//   Moving elements to the overflow map.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("STUCK OLDEST ELEMENT");
+
+    typedef mwcc::RingHashMap<int, int> MyMapType;
+
+    const int k_WINDOW       = 10;
+    const int k_NUM_ELEMENTS = 100000;
+
+    MyMapType map(s_allocator_p);
+    map.insert(bsl::make_pair(-1, -1));
+
+    for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+        map.insert(bsl::make_pair(i, i));
+        if (i >= k_WINDOW) {
+            ASSERT_EQ(map.erase(i - k_WINDOW), 1U);
+        }
+    }
+
+    ASSERT_EQ(map.size(), static_cast<size_t>(k_WINDOW + 1));
+    ASSERT_EQ(map.overflowSize(), 1U);
+
+    // The stuck element is still first
+    MyMapType::iterator it = map.begin();
+    ASSERT_EQ(it->first, -1);
+    ASSERT(map.find(-1) == it);
+
+    it = map.erase(it);
+    ASSERT_EQ(it->first, k_NUM_ELEMENTS - k_WINDOW);
+    ASSERT_EQ(map.overflowSize(), 0U);
+}
+
+static void test5_randomOperations()
+// ------------------------------------------------------------------------
+// RANDOM OPERATIONS
+//
+// Testing:
+//   A random sequence of insertions, in-order and out-of-order erasures
+//   behaves like an insertion-ordered list of unique keys.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("RANDOM OPERATIONS");
+
+    typedef mwcc::RingHashMap<int, int> MyMapType;
+    typedef bsl::list<int>              Model;
+
+    const int k_NUM_OPERATIONS = 50000;
+
+    MyMapType map(s_allocator_p);
+    Model     model(s_allocator_p);
+    int       nextKey = 0;
+
+    bsl::srand(1);
+    for (int op = 0; op < k_NUM_OPERATIONS; ++op) {
+        const int choice = bsl::rand() % 100;
+        if (choice < 45 || model.empty()) {
+            model.push_back(nextKey);
+            ASSERT(map.insert(bsl::make_pair(nextKey, nextKey)).second);
+            ++nextKey;
+        }
+        else if (choice < 75) {
+            // Erase the oldest element
+            ASSERT_EQ(map.begin()->first, model.front());
+            map.erase(map.begin());
+            model.pop_front();
+        }
+        else {
+            // Erase a random element, keeping the oldest one most of the
+            // time
+            Model::iterator mit = model.begin();
+            bsl::advance(mit, bsl::rand() % model.size());
+            if (mit == model.begin() && bsl::rand() % 10 != 0) {
+                continue;  // CONTINUE
+            }
+            ASSERT_EQ(map.erase(*mit), 1U);
+            model.erase(mit);
+        }
+        ASSERT_EQ(map.size(), model.size());
+    }
+
+    Model::const_iterator mit = model.begin();
+    for (MyMapType::const_iterator it = map.begin(); it != map.end(); ++it) {
+        ASSERT(mit != model.end());
+        ASSERT_EQ(it->first, *mit);
+        ASSERT(map.find(*mit) == it);
+        ++mit;
+    }
+    ASSERT(mit == model.end());
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 5: test5_randomOperations(); break;
+    case 4: test4_stuckOldestElement(); break;
+    case 3: test3_eraseDuringIteration(); break;
+    case 2: test2_previousEndIterator(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
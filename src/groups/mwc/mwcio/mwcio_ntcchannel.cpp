@@ -30,6 +30,7 @@
 #include <bdlf_bind.h>
 #include <bdlf_memfn.h>
 #include <bdlf_placeholder.h>
+#include <bsl_algorithm.h>
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bslma_allocator.h>
@@ -689,6 +690,33 @@ void NtcChannel::processReadCancelled(
                  &blob);
 }
 
+void NtcChannel::updateReadQueueLowWatermark(int numNeeded)
+{
+    const int numMissing = numNeeded - d_readCache.length();
+
+    // The socket stops reading once its read queue reaches the high
+    // watermark, so a larger low watermark would never be reached: the
+    // remainder of a read larger than the high watermark is received in
+    // chunks of at most the high watermark.
+    const bsl::size_t lowWatermark = bsl::min(
+        numMissing > 1 ? static_cast<bsl::size_t>(numMissing) : 1,
+        bsl::max(d_streamSocket_sp->readQueueHighWatermark(),
+                 static_cast<bsl::size_t>(1)));
+
+    if (lowWatermark == d_readQueueLowWatermark) {
+        return;  // RETURN
+    }
+
+    ntsa::Error error = d_streamSocket_sp->setReadQueueLowWatermark(
+        lowWatermark);
+    if (error) {
+        // Not fatal: we will just be notified more often than necessary.
+        return;  // RETURN
+    }
+
+    d_readQueueLowWatermark = lowWatermark;
+}
+
 void NtcChannel::processReadQueueLowWatermark(
     const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
     const ntca::ReadQueueEvent&                event)
@@ -729,6 +757,11 @@ void NtcChannel::processReadQueueLowWatermark(
                     MWCIO_NTCCHANNEL_LOG_RECEIVE_WOULD_BLOCK(
                         this,
                         d_streamSocket_sp);
+
+                    // Do not get notified again before the remainder of
+                    // this read can be satisfied: partial packets are
+                    // accumulated by the socket without waking us up.
+                    updateReadQueueLowWatermark(read->numNeeded());
                     break;
                 }
                 else if (error == ntsa::Error(ntsa::Error::e_EOF)) {
@@ -972,6 +1005,7 @@ NtcChannel::NtcChannel(
 , d_streamSocket_sp()
 , d_readQueue(basicAllocator)
 , d_readCache(basicAllocator)
+, d_readQueueLowWatermark(1)
 , d_channelId(0)
 , d_peerUri(basicAllocator)
 , d_state(e_STATE_DEFAULT)
@@ -1180,6 +1214,7 @@ void NtcChannel::read(Status*                   status,
     bool enableRead = false;
     if (d_readQueue.empty()) {
         enableRead = true;
+        updateReadQueueLowWatermark(numBytes);
     }
 
     if (enableRead) {
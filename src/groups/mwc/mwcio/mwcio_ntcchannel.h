@@ -206,6 +206,7 @@ class NtcChannel : public mwcio::Channel,
     bsl::shared_ptr<ntci::StreamSocket>   d_streamSocket_sp;
     mwcio::NtcReadQueue                   d_readQueue;
     bdlbb::Blob                           d_readCache;
+    bsl::size_t                           d_readQueueLowWatermark;
     int                                   d_channelId;
     bsl::string                           d_peerUri;
     State                                 d_state;
@@ -238,6 +239,14 @@ class NtcChannel : public mwcio::Channel,
     /// Process the cancellation of the specified `read`.
     void processReadCancelled(const bsl::shared_ptr<mwcio::NtcRead>& read);
 
+    /// Set the read queue low watermark of the stream socket so that the
+    /// next read queue low watermark event is not announced before the
+    /// remainder of the specified `numNeeded` bytes, not already in the
+    /// read cache, are available, or before the read queue of the stream
+    /// socket reaches its high watermark, whichever comes first.  The
+    /// behavior is undefined unless `d_mutex` is locked.
+    void updateReadQueueLowWatermark(int numNeeded);
+
     /// Process the condition that the size of the read queue is greater
     /// than or equal to the read queue low watermark.
     void processReadQueueLowWatermark(
@@ -114,6 +114,7 @@ struct Tester_ChannelInfo {
     bsl::shared_ptr<Channel>               d_channel;
     bsl::deque<ChannelWatermarkType::Enum> d_watermarkEvents;
     bdlbb::Blob                            d_readData;
+    int                                    d_numReads;
     bslmt::Mutex                           d_blockMutex;
 
     // TRAITS
@@ -125,6 +126,7 @@ struct Tester_ChannelInfo {
     : d_channel()
     , d_watermarkEvents(basicAllocator)
     , d_readData(basicAllocator)
+    , d_numReads(0)
     , d_blockMutex()
     {
         // NOTHING
@@ -135,6 +137,7 @@ struct Tester_ChannelInfo {
     : d_channel(original.d_channel)
     , d_watermarkEvents(original.d_watermarkEvents, basicAllocator)
     , d_readData(original.d_readData, basicAllocator)
+    , d_numReads(original.d_numReads)
     , d_blockMutex()
     {
         // NOTHING
@@ -256,6 +259,8 @@ class Tester {
     HandleMap                            d_handleMap;
     PreCreateCbCallList                  d_preCreateCbCalls;
     bool                                 d_setPreCreateCb;
+    int                                  d_readSize;
+    bsl::size_t                          d_socketBufferSize;
     bslma::ManagedPtr<NtcChannelFactory> d_object;
     bslmt::Mutex                         d_mutex;
 
@@ -275,7 +280,7 @@ class Tester {
 
     /// Copy out all data from the specified `blob` into the storage
     /// associated with the specified `channelName` and return indicating
-    /// that we want to read 1 more byte.
+    /// that we want to read `d_readSize` more bytes.
     void channelReadCb(const bsl::string& channelName,
                        const Status&      status,
                        int*               numNeeded,
@@ -312,6 +317,17 @@ class Tester {
     /// this is `false`.
     void setPreCreateCb(bool value);
 
+    /// Set the number of bytes requested by every read of the channels
+    /// created after this call to the specified `value`.  By default this
+    /// is 1.
+    void setReadSize(int value);
+
+    /// Set the receive buffer size and the read queue high watermark of the
+    /// sockets of the `NtcChannelFactory` created the next time `init` is
+    /// called to the specified `value`.  By default (0) the defaults of
+    /// NTC are used.
+    void setSocketBufferSize(bsl::size_t value);
+
     /// (Re-)create the object being tested and reset the state of any
     /// supporting objects.
     void init(int line);
@@ -379,6 +395,13 @@ class Tester {
                      const bslstl::StringRef& channelName,
                      const bslstl::StringRef& data);
 
+    /// Check that the read callback of the channel with the specified
+    /// `channelName` was invoked the specified `expected` number of times
+    /// with data.
+    void checkNumReads(int                      line,
+                       const bslstl::StringRef& channelName,
+                       int                      expected);
+
     /// Check that there's no unread data for the channel with the
     /// specified `channelName`. This function will wait a few ms to give
     /// any recently-written data to be read.
@@ -499,14 +522,15 @@ void Tester::channelReadCb(const bsl::string& channelName,
         }
         return;  // RETURN
     }
-    *numNeeded = 1;
+    *numNeeded = d_readSize;
 
     {
         bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
 
-        bdlbb::Blob& readBlob = d_channelMap[channelName].d_readData;
-        bdlbb::BlobUtil::append(&readBlob, *blob);
+        ChannelInfo& info = d_channelMap[channelName];
+        bdlbb::BlobUtil::append(&info.d_readData, *blob);
         blob->removeAll();
+        ++info.d_numReads;
     }
     // Acquire the block mutex, blocking us here until it's released
     bslmt::LockGuard<bslmt::Mutex> blockGuard(
@@ -553,6 +577,8 @@ Tester::Tester(bslma::Allocator* basicAllocator)
 , d_handleMap(basicAllocator)
 , d_preCreateCbCalls(basicAllocator)
 , d_setPreCreateCb(false)
+, d_readSize(1)
+, d_socketBufferSize(0)
 , d_object()
 , d_mutex()
 {
@@ -569,12 +595,26 @@ void Tester::setPreCreateCb(bool value)
     d_setPreCreateCb = value;
 }
 
+void Tester::setReadSize(int value)
+{
+    d_readSize = value;
+}
+
+void Tester::setSocketBufferSize(bsl::size_t value)
+{
+    d_socketBufferSize = value;
+}
+
 void Tester::init(int line)
 {
     destroy();
 
     ntca::InterfaceConfig interfaceConfig;
     interfaceConfig.setThreadName("test");
+    if (d_socketBufferSize != 0) {
+        interfaceConfig.setReceiveBufferSize(d_socketBufferSize);
+        interfaceConfig.setReadQueueHighWatermark(d_socketBufferSize);
+    }
 
     d_object.load(new (*d_allocator_p) NtcChannelFactory(interfaceConfig,
                                                          &d_blobBufferFactory,
@@ -822,6 +862,15 @@ void Tester::readChannel(int                      line,
     ASSERT_EQ_D(line, readString.c_str(), data);
 }
 
+void Tester::checkNumReads(int                      line,
+                           const bslstl::StringRef& channelName,
+                           int                      expected)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+    ChannelInfo&                   info = d_channelMap[channelName];
+    ASSERT_EQ_D(line, info.d_numReads, expected);
+}
+
 void Tester::checkNoRead(int line, const bslstl::StringRef& channelName)
 {
     bslmt::ThreadUtil::microSleep(5000);
@@ -887,7 +936,7 @@ void Tester::checkResultCallback(int                       line,
                                  bdlf::PlaceHolders::_2,
                                  bdlf::PlaceHolders::_3));
         Status readStatus(s_allocator_p);
-        cbInfo.d_channel->read(&readStatus, 1, readCb);
+        cbInfo.d_channel->read(&readStatus, d_readSize, readCb);
         if (readStatus) {
             // If the read succeeds, then the channel isn't down yet
             d_channelMap[channelNameStr].d_channel = cbInfo.d_channel;
@@ -1035,6 +1084,43 @@ NtcChannelFactory& Tester::object()
 // ============================================================================
 //                                    TESTS
 // ----------------------------------------------------------------------------
+static void test7_largeReadTest()
+// ------------------------------------------------------------------------
+// LARGE READ TEST
+//
+// Concerns:
+//   a) A read of more bytes than the socket buffer and the read queue high
+//      watermark completes: the data is received in chunks, and the read
+//      callback is invoked once, with all the data.
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("Large Read Test");
+
+    const int         k_READ_SIZE          = 4 * 1024 * 1024;
+    const bsl::size_t k_SOCKET_BUFFER_SIZE = 64 * 1024;
+
+    Tester t(s_allocator_p);
+    t.setReadSize(k_READ_SIZE);
+    t.setSocketBufferSize(k_SOCKET_BUFFER_SIZE);
+    t.init(L_);
+
+    t.listen(L_, "listenHandle", "127.0.0.1:0");
+    t.connect(L_, "connectHandle", "listenHandle");
+
+    t.checkResultCallback(L_, "listenHandle", "listenChannel");
+    t.checkResultCallback(L_, "connectHandle", "connectChannel");
+
+    // Concern 'a'
+    bsl::string largeMsg(k_READ_SIZE, 'a', s_allocator_p);
+    for (int i = 0; i < k_READ_SIZE; i += 1024) {
+        largeMsg[i] = static_cast<char>('a' + (i / 1024) % 26);
+    }
+
+    t.writeChannel(L_, "listenChannel", largeMsg, 2 * k_READ_SIZE);
+    t.readChannel(L_, "connectChannel", largeMsg);
+    t.checkNumReads(L_, "connectChannel", 1);
+}
+
 static void test6_preCreationCbTest()
 // ------------------------------------------------------------------------
 // PRE CREATION CB TEST
@@ -1327,6 +1413,7 @@ int main(int argc, char* argv[])
     case 4: test4_cancelHandleTest(); break;
     case 5: test5_visitChannelsTest(); break;
     case 6: test6_preCreationCbTest(); break;
+    case 7: test7_largeReadTest(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         s_testStatus = -1;
@@ -0,0 +1,148 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcst_exportbuffer.cpp                                             -*-C++-*-
+#include <mwcst_exportbuffer.h>
+
+#include <mwcscm_version.h>
+#include <mwcst_statcontext.h>
+
+namespace BloombergLP {
+namespace mwcst {
+
+// ------------------
+// class ExportBuffer
+// ------------------
+
+// PRIVATE MANIPULATORS
+void ExportBuffer::loadRows(const StatContext& context, int depth)
+{
+    for (StatContextIterator it = context.subcontextIterator(); it; ++it) {
+        if (depth == 1) {
+            d_rows.push_back(&*it);
+        }
+        else {
+            loadRows(*it, depth - 1);
+        }
+    }
+}
+
+// CREATORS
+ExportBuffer::ExportBuffer(bslma::Allocator* basicAllocator)
+: d_columns(basicAllocator)
+, d_rows(basicAllocator)
+, d_values(basicAllocator)
+{
+}
+
+// MANIPULATORS
+int ExportBuffer::addColumn(int                                valueIndex,
+                            SnapshotFn                         func,
+                            const StatValue::SnapshotLocation& snapshot,
+                            StatContext::ValueType             valueType)
+{
+    BSLS_ASSERT(func);
+
+    Column column;
+    column.d_valueIndex    = valueIndex;
+    column.d_valueType     = valueType;
+    column.d_snapshotFn    = func;
+    column.d_rangeFn       = 0;
+    column.d_firstSnapshot = snapshot;
+    column.d_hasEmptyValue = false;
+    column.d_emptyValue    = 0;
+
+    d_columns.push_back(column);
+    d_values.resize(d_columns.size());
+
+    return numColumns() - 1;
+}
+
+int ExportBuffer::addColumn(int                                valueIndex,
+                            RangeFn                            func,
+                            const StatValue::SnapshotLocation& firstSnapshot,
+                            const StatValue::SnapshotLocation& secondSnapshot,
+                            StatContext::ValueType             valueType)
+{
+    BSLS_ASSERT(func);
+
+    Column column;
+    column.d_valueIndex     = valueIndex;
+    column.d_valueType      = valueType;
+    column.d_snapshotFn     = 0;
+    column.d_rangeFn        = func;
+    column.d_firstSnapshot  = firstSnapshot;
+    column.d_secondSnapshot = secondSnapshot;
+    column.d_hasEmptyValue  = false;
+    column.d_emptyValue     = 0;
+
+    d_columns.push_back(column);
+    d_values.resize(d_columns.size());
+
+    return numColumns() - 1;
+}
+
+void ExportBuffer::setEmptyValue(int column, bsls::Types::Int64 emptyValue)
+{
+    BSLS_ASSERT(0 <= column && column < numColumns());
+
+    d_columns[column].d_hasEmptyValue = true;
+    d_columns[column].d_emptyValue    = emptyValue;
+}
+
+void ExportBuffer::update(const StatContext& context, int depth)
+{
+    BSLS_ASSERT(1 <= depth);
+
+    // 'clear' and 'resize' keep the capacity of the vectors, so that nothing
+    // is allocated unless the number of rows grows.
+    d_rows.clear();
+    loadRows(context, depth);
+
+    const size_t numRows = d_rows.size();
+    for (size_t c = 0; c < d_columns.size(); ++c) {
+        const Column&                    column = d_columns[c];
+        bsl::vector<bsls::Types::Int64>& values = d_values[c];
+
+        values.resize(numRows);
+        for (size_t r = 0; r < numRows; ++r) {
+            const StatValue& value = d_rows[r]->value(column.d_valueType,
+                                                      column.d_valueIndex);
+            if (column.d_snapshotFn) {
+                values[r] = column.d_snapshotFn(value, column.d_firstSnapshot);
+            }
+            else {
+                values[r] = column.d_rangeFn(value,
+                                             column.d_firstSnapshot,
+                                             column.d_secondSnapshot);
+            }
+
+            if (column.d_hasEmptyValue && values[r] == column.d_emptyValue) {
+                values[r] = 0;
+            }
+        }
+    }
+}
+
+void ExportBuffer::clear()
+{
+    d_rows.clear();
+    for (size_t c = 0; c < d_values.size(); ++c) {
+        d_values[c].clear();
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
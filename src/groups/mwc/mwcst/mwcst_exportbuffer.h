@@ -0,0 +1,301 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcst_exportbuffer.h                                               -*-C++-*-
+#ifndef INCLUDED_MWCST_EXPORTBUFFER
+#define INCLUDED_MWCST_EXPORTBUFFER
+
+//@PURPOSE: Provide a reusable columnar export of the stats of subcontexts.
+//
+//@CLASSES:
+// mwcst::ExportBuffer : column-major values of the subcontexts of a context
+//
+//@SEE_ALSO:
+//  mwcst_statcontext
+//  mwcst_statutil
+//  mwcst_table
+//
+//@DESCRIPTION: This component provides a mechanism, 'mwcst::ExportBuffer',
+// evaluating a set of columns, each defined by a function of
+// 'mwcst::StatUtil' applied to a value of a context, for all the subcontexts
+// found at a given depth below a 'mwcst::StatContext' (e.g., all the queues
+// of all the domains), and storing the results column by column.
+//
+// An 'ExportBuffer' is meant to be updated after each snapshot and read by
+// exporters of the stats, such as the stat consumer plugins of a broker.
+// Compared to evaluating each value of each context through a
+// 'mwcst::Table', the functions of the columns are resolved once, the values
+// of a column are contiguous, and the memory of the buffer is reused from one
+// update to the next, so that an update does not allocate memory once the
+// number of rows stabilizes.
+//
+// Each row refers to its 'mwcst::StatContext', which exporters can use to
+// read the identity of the row (e.g., its name or datum), and to skip rows
+// which were not updated during the last snapshot interval (see
+// 'mwcst::StatContext::wasUpdated').
+//
+// Some functions of 'mwcst::StatUtil' return a sentinel when nothing was
+// reported (e.g., the maximum 'Int64' for 'averagePerEvent').  A column can
+// be given such an empty value with 'setEmptyValue', so that it reports 0
+// instead.
+//
+/// Thread Safety
+///-------------
+// NOT thread-safe.  'update' must be called by the thread snapshotting the
+// context, and the returned values are valid until the next 'update', or
+// until the next 'cleanup' of the context.
+//
+/// Usage
+///-----
+//..
+//  typedef mwcst::StatValue::SnapshotLocation Location;
+//
+//  mwcst::ExportBuffer buffer(allocator);
+//  const int putColumn = buffer.addColumn(k_PUT_VALUE_INDEX,
+//                                         &mwcst::StatUtil::valueDifference,
+//                                         Location(0, 0),
+//                                         Location(0, 1));
+//
+//  // After each snapshot of 'domainsContext', whose subcontexts of depth 2
+//  // are queues
+//  buffer.update(domainsContext, 2);
+//  const bsls::Types::Int64 *puts = buffer.column(putColumn);
+//  for (int row = 0; row < buffer.numRows(); ++row) {
+//      if (buffer.context(row).wasUpdated()) {
+//          publish(buffer.context(row), puts[row]);
+//      }
+//  }
+//..
+
+#ifndef INCLUDED_MWCST_STATCONTEXT
+#include <mwcst_statcontext.h>
+#endif
+
+#ifndef INCLUDED_MWCST_STATVALUE
+#include <mwcst_statvalue.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+namespace BloombergLP {
+namespace mwcst {
+
+// ==================
+// class ExportBuffer
+// ==================
+
+/// Column-major values of the subcontexts of a context.
+class ExportBuffer {
+  public:
+    // PUBLIC TYPES
+
+    /// Function computing a value from a single snapshot.
+    typedef bsls::Types::Int64 (*SnapshotFn)(
+        const StatValue&                   value,
+        const StatValue::SnapshotLocation& snapshot);
+
+    /// Function computing a value from a range of snapshots.
+    typedef bsls::Types::Int64 (*RangeFn)(
+        const StatValue&                   value,
+        const StatValue::SnapshotLocation& firstSnapshot,
+        const StatValue::SnapshotLocation& secondSnapshot);
+
+  private:
+    // PRIVATE TYPES
+
+    /// Definition of a column.
+    struct Column {
+        int d_valueIndex;
+
+        StatContext::ValueType d_valueType;
+
+        SnapshotFn d_snapshotFn;
+        // Function of the column, if computed
+        // from a single snapshot, or 0
+
+        RangeFn d_rangeFn;
+        // Function of the column, if computed
+        // from a range of snapshots, or 0
+
+        StatValue::SnapshotLocation d_firstSnapshot;
+
+        StatValue::SnapshotLocation d_secondSnapshot;
+
+        bool d_hasEmptyValue;
+        // Whether 'd_emptyValue' is set
+
+        bsls::Types::Int64 d_emptyValue;
+        // Value of the function of the column
+        // reported as 0
+    };
+
+    // DATA
+    bsl::vector<Column> d_columns;
+
+    bsl::vector<const StatContext*> d_rows;
+
+    bsl::vector<bsl::vector<bsls::Types::Int64> > d_values;
+    // Values, by column, then by row
+
+  private:
+    // NOT IMPLEMENTED
+    ExportBuffer(const ExportBuffer&);
+    ExportBuffer& operator=(const ExportBuffer&);
+
+    // PRIVATE MANIPULATORS
+
+    /// Append to the rows the subcontexts of the specified `context` at the
+    /// specified `depth` below it.
+    void loadRows(const StatContext& context, int depth);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ExportBuffer, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty buffer, without columns.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.
+    explicit ExportBuffer(bslma::Allocator* basicAllocator = 0);
+
+    // MANIPULATORS
+
+    /// Add a column computing the specified `func` of the value having the
+    /// specified `valueIndex` at the specified `snapshot`, and return its
+    /// index.  Optionally specify the `valueType` of the value, which is
+    /// direct by default.
+    int addColumn(int                                valueIndex,
+                  SnapshotFn                         func,
+                  const StatValue::SnapshotLocation& snapshot,
+                  StatContext::ValueType             valueType =
+                      StatContext::DMCST_DIRECT_VALUE);
+
+    /// Add a column computing the specified `func` of the value having the
+    /// specified `valueIndex` between the specified `firstSnapshot` and
+    /// `secondSnapshot`, and return its index.  Optionally specify the
+    /// `valueType` of the value, which is direct by default.
+    int addColumn(int                                valueIndex,
+                  RangeFn                            func,
+                  const StatValue::SnapshotLocation& firstSnapshot,
+                  const StatValue::SnapshotLocation& secondSnapshot,
+                  StatContext::ValueType             valueType =
+                      StatContext::DMCST_DIRECT_VALUE);
+
+    /// Report as 0 the values of the specified `column` equal to the
+    /// specified `emptyValue`, which the function of the column returns
+    /// when nothing was reported (e.g., the maximum `Int64` for
+    /// `StatUtil::averagePerEvent`, or the minimum one for
+    /// `StatUtil::rangeMax`).  The behavior is undefined unless
+    /// `0 <= column < numColumns()`.
+    void setEmptyValue(int column, bsls::Types::Int64 emptyValue);
+
+    /// Reload the rows of this buffer with the subcontexts found at the
+    /// optionally specified `depth` (1 by default, i.e., the direct
+    /// subcontexts) below the specified `context`, and compute the values
+    /// of all columns for these rows.  The behavior is undefined unless
+    /// `1 <= depth`, and all the columns refer to existing values of the
+    /// rows.
+    void update(const StatContext& context, int depth = 1);
+
+    /// Remove all rows.
+    void clear();
+
+    // ACCESSORS
+
+    /// Return the number of columns.
+    int numColumns() const;
+
+    /// Return the number of rows, as of the last `update`.
+    int numRows() const;
+
+    /// Return the context of the specified `row`.  The behavior is undefined
+    /// unless `0 <= row < numRows()`.
+    const StatContext& context(int row) const;
+
+    /// Return the address of the `numRows()` contiguous values of the
+    /// specified `column`, as of the last `update`, or 0 if there is no row.
+    /// The behavior is undefined unless `0 <= column < numColumns()`.
+    const bsls::Types::Int64* column(int column) const;
+
+    /// Return the value of the specified `column` for the specified `row`,
+    /// as of the last `update`.  The behavior is undefined unless
+    /// `0 <= row < numRows()` and `0 <= column < numColumns()`.
+    bsls::Types::Int64 value(int row, int column) const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ------------------
+// class ExportBuffer
+// ------------------
+
+// ACCESSORS
+inline int ExportBuffer::numColumns() const
+{
+    return static_cast<int>(d_columns.size());
+}
+
+inline int ExportBuffer::numRows() const
+{
+    return static_cast<int>(d_rows.size());
+}
+
+inline const StatContext& ExportBuffer::context(int row) const
+{
+    BSLS_ASSERT_SAFE(0 <= row && row < numRows());
+
+    return *d_rows[row];
+}
+
+inline const bsls::Types::Int64* ExportBuffer::column(int column) const
+{
+    BSLS_ASSERT_SAFE(0 <= column && column < numColumns());
+
+    return d_rows.empty() ? 0 : d_values[column].data();
+}
+
+inline bsls::Types::Int64 ExportBuffer::value(int row, int column) const
+{
+    BSLS_ASSERT_SAFE(0 <= row && row < numRows());
+    BSLS_ASSERT_SAFE(0 <= column && column < numColumns());
+
+    return d_values[column][row];
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,256 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcst_exportbuffer.t.cpp                                           -*-C++-*-
+
+#include <mwcst_exportbuffer.h>
+
+#include <mwcst_statcontext.h>
+#include <mwcst_statutil.h>
+#include <mwcst_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_managedptr.h>
+#include <bslma_testallocator.h>
+
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+
+using namespace BloombergLP;
+using namespace mwcst;
+using namespace bsl;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                              *** Overview ***
+//
+// The component under test is a columnar export of the values of the
+// subcontexts of a stat context.  We verify that the rows and values match
+// the subcontexts, and that an update with an unchanged number of rows does
+// not allocate memory.
+//
+// ----------------------------------------------------------------------------
+// ----------------------------------------------------------------------------
+// [ 1] Breathing Test
+// [ 2] setEmptyValue
+//=============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(int c, const char* s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "     (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100)
+            ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT BSLS_BSLTESTUTIL_ASSERT
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    int test    = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // Use test allocator
+    bslma::TestAllocator testAllocator;
+    testAllocator.setNoAbort(true);
+    bslma::Default::setDefaultAllocatorRaw(&testAllocator);
+
+    switch (test) {
+    case 0:
+    case 2: {
+        // --------------------------------------------------------------------
+        // EMPTY VALUE
+        //
+        // Concerns:
+        //   A column reports 0 instead of its empty value, and other values
+        //   unchanged.
+        //
+        // Plan:
+        //   Export the average per event of a discrete value, with and without
+        //   reported events.
+        //
+        // Testing:
+        //   setEmptyValue
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "EMPTY VALUE" << endl
+                 << "===========" << endl;
+
+        typedef StatValue::SnapshotLocation Location;
+
+        StatContextConfiguration config("queues", &testAllocator);
+        config.isTable(true)
+            .value("time", StatValue::DMCST_DISCRETE)
+            .defaultHistorySize(2);
+        StatContext context(config, &testAllocator);
+
+        bslma::ManagedPtr<StatContext> queue = context.addSubcontext(
+            StatContextConfiguration("queue", &testAllocator));
+
+        ExportBuffer buffer(&testAllocator);
+
+        const int avgColumn = buffer.addColumn(0,
+                                               &StatUtil::averagePerEvent,
+                                               Location(0, 0),
+                                               Location(0, 1));
+        const int rawColumn = buffer.addColumn(0,
+                                               &StatUtil::averagePerEvent,
+                                               Location(0, 0),
+                                               Location(0, 1));
+        buffer.setEmptyValue(avgColumn,
+                             bsl::numeric_limits<bsls::Types::Int64>::max());
+
+        // No event
+        context.snapshot();
+        context.snapshot();
+        buffer.update(context);
+        ASSERT(buffer.numRows() == 1);
+        ASSERT(buffer.value(0, avgColumn) == 0);
+        ASSERT(buffer.value(0, rawColumn) ==
+               bsl::numeric_limits<bsls::Types::Int64>::max());
+
+        // Two events
+        queue->reportValue(0, 10);
+        queue->reportValue(0, 20);
+        context.snapshot();
+        buffer.update(context);
+        ASSERT(buffer.value(0, avgColumn) == 15);
+        ASSERT(buffer.value(0, rawColumn) == 15);
+    } break;
+    case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //   Exercise the basic functionality of the component.
+        //
+        // Plan:
+        //   Create a table context with two levels of subcontexts, export the
+        //   values of the second level, and verify them.
+        //
+        // Testing:
+        //   Basic functionality
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "BREATHING TEST" << endl
+                 << "==============" << endl;
+
+        typedef StatValue::SnapshotLocation Location;
+
+        StatContextConfiguration config("domains", &testAllocator);
+        config.isTable(true).value("put").defaultHistorySize(2);
+        StatContext context(config, &testAllocator);
+
+        bslma::ManagedPtr<StatContext> domain = context.addSubcontext(
+            StatContextConfiguration("domain", &testAllocator));
+        bslma::ManagedPtr<StatContext> queue1 = domain->addSubcontext(
+            StatContextConfiguration("queue1", &testAllocator));
+        bslma::ManagedPtr<StatContext> queue2 = domain->addSubcontext(
+            StatContextConfiguration("queue2", &testAllocator));
+
+        ExportBuffer buffer(&testAllocator);
+
+        const int valueColumn = buffer.addColumn(0,
+                                                 &StatUtil::value,
+                                                 Location(0, 0));
+        const int deltaColumn = buffer.addColumn(0,
+                                                 &StatUtil::valueDifference,
+                                                 Location(0, 0),
+                                                 Location(0, 1));
+        ASSERT(buffer.numColumns() == 2);
+        ASSERT(buffer.numRows() == 0);
+        ASSERT(buffer.column(valueColumn) == 0);
+
+        context.snapshot();
+        queue1->adjustValue(0, 3);
+        queue2->adjustValue(0, 5);
+        context.snapshot();
+
+        // Direct subcontexts
+        buffer.update(context);
+        ASSERT(buffer.numRows() == 1);
+        ASSERT(&buffer.context(0) == domain.get());
+
+        // Queues
+        buffer.update(context, 2);
+        ASSERT(buffer.numRows() == 2);
+        for (int row = 0; row < buffer.numRows(); ++row) {
+            const bsls::Types::Int64 expected =
+                &buffer.context(row) == queue1.get() ? 3 : 5;
+            ASSERT(buffer.value(row, valueColumn) == expected);
+            ASSERT(buffer.column(deltaColumn)[row] == expected);
+            ASSERT(buffer.context(row).wasUpdated());
+        }
+
+        // Same number of rows: no allocation
+        queue1->adjustValue(0, 1);
+        context.snapshot();
+
+        const bsls::Types::Int64 numAllocations =
+            testAllocator.numAllocations();
+        buffer.update(context, 2);
+        ASSERT(testAllocator.numAllocations() == numAllocations);
+
+        for (int row = 0; row < buffer.numRows(); ++row) {
+            const bool isQueue1 = &buffer.context(row) == queue1.get();
+            ASSERT(buffer.value(row, valueColumn) == (isQueue1 ? 4 : 5));
+            ASSERT(buffer.value(row, deltaColumn) == (isQueue1 ? 1 : 0));
+            ASSERT(buffer.context(row).wasUpdated() == isQueue1);
+        }
+
+        buffer.clear();
+        ASSERT(buffer.numRows() == 0);
+    } break;
+    default: {
+        cerr << "WARNING: CASE '" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+    }
+    }
+
+    if (testStatus != 255) {
+        if ((testAllocator.numMismatches() != 0) ||
+            (testAllocator.numBytesInUse() != 0)) {
+            bsl::cout << "*** Error " << __FILE__ << "(" << __LINE__
+                      << "): test allocator: " << '\n';
+            testAllocator.print();
+            testStatus++;
+        }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
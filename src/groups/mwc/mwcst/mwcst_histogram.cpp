@@ -0,0 +1,232 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcst_histogram.cpp                                                -*-C++-*-
+#include <mwcst_histogram.h>
+
+#include <mwcscm_version.h>
+
+// BDE
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bslim_printer.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace mwcst {
+
+// -----------------------
+// class HistogramSnapshot
+// -----------------------
+
+// CREATORS
+HistogramSnapshot::HistogramSnapshot(bslma::Allocator* basicAllocator)
+: d_buckets(basicAllocator)
+, d_count(0)
+{
+}
+
+HistogramSnapshot::HistogramSnapshot(const HistogramSnapshot& other,
+                                     bslma::Allocator*        basicAllocator)
+: d_buckets(other.d_buckets, basicAllocator)
+, d_count(other.d_count)
+{
+}
+
+// MANIPULATORS
+HistogramSnapshot& HistogramSnapshot::operator=(const HistogramSnapshot& rhs)
+{
+    d_buckets = rhs.d_buckets;
+    d_count   = rhs.d_count;
+
+    return *this;
+}
+
+void HistogramSnapshot::add(const HistogramSnapshot& other)
+{
+    for (Buckets::const_iterator it = other.d_buckets.begin();
+         it != other.d_buckets.end();
+         ++it) {
+        addToBucket(it->first, it->second);
+    }
+}
+
+void HistogramSnapshot::addToBucket(int index, bsls::Types::Int64 count)
+{
+    BSLS_ASSERT_SAFE(0 <= index && index < HistogramUtil::k_NUM_BUCKETS);
+
+    if (count == 0) {
+        return;  // RETURN
+    }
+
+    Buckets::iterator it = bsl::lower_bound(d_buckets.begin(),
+                                            d_buckets.end(),
+                                            Bucket(index, 0));
+    if (it != d_buckets.end() && it->first == index) {
+        it->second += count;
+    }
+    else {
+        d_buckets.insert(it, Bucket(index, count));
+    }
+    d_count += count;
+}
+
+void HistogramSnapshot::reset()
+{
+    d_buckets.clear();
+    d_count = 0;
+}
+
+// ACCESSORS
+bsls::Types::Int64
+HistogramSnapshot::percentile(double                   percentile,
+                              const HistogramSnapshot* base) const
+{
+    BSLS_ASSERT(0 <= percentile && percentile <= 100);
+
+    const bsls::Types::Int64 count = d_count - (base ? base->d_count : 0);
+    if (count <= 0) {
+        return 0;  // RETURN
+    }
+
+    // Rank, starting at 1, of the value at 'percentile'.
+    bsls::Types::Int64 rank = static_cast<bsls::Types::Int64>(
+        bsl::ceil(percentile / 100.0 * static_cast<double>(count)));
+    rank = bsl::max(rank, static_cast<bsls::Types::Int64>(1));
+
+    // The buckets of 'base' are a subset of the ones of this snapshot, since
+    // cumulative counts never decrease.
+    Buckets::const_iterator baseIt  = base ? base->d_buckets.begin()
+                                           : d_buckets.end();
+    Buckets::const_iterator baseEnd = base ? base->d_buckets.end()
+                                           : d_buckets.end();
+    bsls::Types::Int64      seen    = 0;
+    for (Buckets::const_iterator it = d_buckets.begin(); it != d_buckets.end();
+         ++it) {
+        bsls::Types::Int64 bucketCount = it->second;
+        while (baseIt != baseEnd && baseIt->first < it->first) {
+            ++baseIt;
+        }
+        if (baseIt != baseEnd && baseIt->first == it->first) {
+            bucketCount -= baseIt->second;
+        }
+
+        seen += bucketCount;
+        if (seen >= rank) {
+            return HistogramUtil::bucketUpperBound(it->first);  // RETURN
+        }
+    }
+
+    return HistogramUtil::bucketUpperBound(d_buckets.back().first);
+}
+
+bsl::ostream& HistogramSnapshot::print(bsl::ostream& stream,
+                                       int           level,
+                                       int           spacesPerLevel) const
+{
+    if (stream.bad()) {
+        return stream;  // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    printer.printAttribute("count", d_count);
+    printer.printAttribute("buckets", d_buckets);
+    printer.end();
+
+    return stream;
+}
+
+// ------------------------
+// class Histogram::Counter
+// ------------------------
+
+Histogram::Counter::Counter()
+: d_count(0)
+{
+}
+
+Histogram::Counter::Counter(const Counter& other)
+: d_count(other.d_count.load())
+{
+}
+
+Histogram::Counter& Histogram::Counter::operator=(const Counter& rhs)
+{
+    d_count = rhs.d_count.load();
+    return *this;
+}
+
+// ---------------
+// class Histogram
+// ---------------
+
+// CREATORS
+Histogram::Histogram(bslma::Allocator* basicAllocator)
+: d_counters(basicAllocator)
+{
+}
+
+Histogram::Histogram(const Histogram& other, bslma::Allocator* basicAllocator)
+: d_counters(other.d_counters, basicAllocator)
+{
+}
+
+// MANIPULATORS
+Histogram& Histogram::operator=(const Histogram& rhs)
+{
+    d_counters = rhs.d_counters;
+    return *this;
+}
+
+void Histogram::enable(bool value)
+{
+    d_counters.clear();
+    if (value) {
+        d_counters.resize(HistogramUtil::k_NUM_BUCKETS);
+    }
+}
+
+void Histogram::collect(HistogramSnapshot* snapshot)
+{
+    BSLS_ASSERT_SAFE(snapshot);
+
+    for (size_t i = 0; i < d_counters.size(); ++i) {
+        if (d_counters[i].d_count.loadRelaxed() == 0) {
+            continue;  // CONTINUE
+        }
+
+        snapshot->addToBucket(static_cast<int>(i),
+                              d_counters[i].d_count.swap(0));
+    }
+}
+
+void Histogram::reset()
+{
+    for (size_t i = 0; i < d_counters.size(); ++i) {
+        d_counters[i].d_count = 0;
+    }
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+bool mwcst::operator==(const mwcst::HistogramSnapshot& lhs,
+                       const mwcst::HistogramSnapshot& rhs)
+{
+    return lhs.count() == rhs.count() && lhs.buckets() == rhs.buckets();
+}
+
+}  // close enterprise namespace
@@ -0,0 +1,383 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcst_histogram.h                                                  -*-C++-*-
+#ifndef INCLUDED_MWCST_HISTOGRAM
+#define INCLUDED_MWCST_HISTOGRAM
+
+//@PURPOSE: Provide a log-linear histogram of reported values.
+//
+//@CLASSES:
+// mwcst::Histogram         : lock-free recorder of a histogram of values
+// mwcst::HistogramSnapshot : mergeable snapshot of a 'mwcst::Histogram'
+// mwcst::HistogramUtil     : bucketing of the values of a histogram
+//
+//@SEE_ALSO:
+//  mwcst_statvalue
+//
+//@DESCRIPTION: This component provides a mechanism, 'mwcst::Histogram',
+// counting reported values (typically latencies in nanoseconds) in
+// log-linear buckets, and a value-semantic type, 'mwcst::HistogramSnapshot',
+// holding the counts collected from a 'Histogram', from which percentiles can
+// be computed.
+//
+/// Buckets
+///-------
+// Values below 'HistogramUtil::k_NUM_SUB_BUCKETS' have a bucket of their own.
+// Each power of two above is divided into 'HistogramUtil::k_NUM_SUB_BUCKETS'
+// buckets of equal width, so that the width of a bucket is at most 1/8th of
+// its lower bound, whatever the magnitude of the value.  A percentile is
+// reported as the largest value of its bucket, hence overestimates the exact
+// percentile by at most 12.5%.  Negative values are counted as zero.
+//
+/// Snapshots
+///---------
+// 'Histogram::collect' moves the counts recorded since the previous
+// collection into a 'HistogramSnapshot', which therefore holds cumulative
+// counts when the same snapshot is collected into repeatedly.  Snapshots only
+// store their non-empty buckets, and can be merged with 'add'.  The
+// percentiles of the values reported between two cumulative snapshots are
+// computed from their difference (see 'HistogramSnapshot::percentile').
+//
+/// Thread Safety
+///-------------
+// 'Histogram::record' is thread-safe and lock-free.  All other functions are
+// not thread-safe.  Values recorded concurrently with 'collect' are collected
+// either by this collection or by the next one.
+
+#ifndef INCLUDED_BDLB_BITUTIL
+#include <bdlb_bitutil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDINT
+#include <bsl_cstdint.h>
+#endif
+
+#ifndef INCLUDED_BSL_OSTREAM
+#include <bsl_ostream.h>
+#endif
+
+#ifndef INCLUDED_BSL_UTILITY
+#include <bsl_utility.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+namespace BloombergLP {
+namespace mwcst {
+
+// ====================
+// struct HistogramUtil
+// ====================
+
+/// Bucketing of the values of a histogram.
+struct HistogramUtil {
+    // CONSTANTS
+
+    /// Number of bits of the values distinguished within a power of two.
+    static const int k_SUB_BUCKET_BITS = 3;
+
+    /// Number of buckets per power of two.
+    static const int k_NUM_SUB_BUCKETS = 1 << k_SUB_BUCKET_BITS;
+
+    /// Number of buckets, covering all non-negative 'Int64' values.
+    static const int k_NUM_BUCKETS = (64 - k_SUB_BUCKET_BITS) *
+                                     k_NUM_SUB_BUCKETS;
+
+    // CLASS METHODS
+
+    /// Return the index of the bucket of the specified `value`.
+    static int bucketIndex(bsls::Types::Int64 value);
+
+    /// Return the smallest value of the bucket having the specified
+    /// `index`.  The behavior is undefined unless
+    /// `0 <= index < k_NUM_BUCKETS`.
+    static bsls::Types::Int64 bucketLowerBound(int index);
+
+    /// Return the largest value of the bucket having the specified `index`.
+    /// The behavior is undefined unless `0 <= index < k_NUM_BUCKETS`.
+    static bsls::Types::Int64 bucketUpperBound(int index);
+};
+
+// =======================
+// class HistogramSnapshot
+// =======================
+
+/// Counts of the values of a histogram, by bucket.
+class HistogramSnapshot {
+  public:
+    // PUBLIC TYPES
+
+    /// Index of a bucket, and number of values counted in that bucket.
+    typedef bsl::pair<int, bsls::Types::Int64> Bucket;
+
+    typedef bsl::vector<Bucket> Buckets;
+
+  private:
+    // DATA
+    Buckets d_buckets;
+    // Non-empty buckets, by increasing
+    // index
+
+    bsls::Types::Int64 d_count;
+    // Total number of values
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(HistogramSnapshot,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty snapshot.  Optionally specify a `basicAllocator`
+    /// used to supply memory.  If `basicAllocator` is 0, the currently
+    /// installed default allocator is used.
+    explicit HistogramSnapshot(bslma::Allocator* basicAllocator = 0);
+
+    /// Create a snapshot having the value of the specified `other`.
+    /// Optionally specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.
+    HistogramSnapshot(const HistogramSnapshot& other,
+                      bslma::Allocator*        basicAllocator = 0);
+
+    // MANIPULATORS
+    HistogramSnapshot& operator=(const HistogramSnapshot& rhs);
+
+    /// Add the counts of the specified `other` to the counts of this
+    /// snapshot.
+    void add(const HistogramSnapshot& other);
+
+    /// Add the specified `count` values to the bucket having the specified
+    /// `index`.  The behavior is undefined unless
+    /// `0 <= index < HistogramUtil::k_NUM_BUCKETS`.
+    void addToBucket(int index, bsls::Types::Int64 count);
+
+    /// Remove all counts.
+    void reset();
+
+    // ACCESSORS
+
+    /// Return the non-empty buckets of this snapshot, by increasing index.
+    const Buckets& buckets() const;
+
+    /// Return the number of values counted in this snapshot.
+    bsls::Types::Int64 count() const;
+
+    /// Return the value below which the specified `percentile` (between 0
+    /// and 100) of the values counted in this snapshot fall, or 0 if this
+    /// snapshot is empty.  Optionally specify a `base` snapshot, whose
+    /// counts are subtracted from the ones of this snapshot, so that the
+    /// percentile of the values counted since `base` is returned.  The
+    /// behavior is undefined unless `base`, if specified, is an earlier
+    /// state of the cumulative counts of this snapshot.
+    bsls::Types::Int64 percentile(double                   percentile,
+                                  const HistogramSnapshot* base = 0) const;
+
+    /// Format this object to the specified output `stream` at the (absolute
+    /// value of) the optionally specified indentation `level` and return a
+    /// reference to `stream`.  If `level` is specified, optionally specify
+    /// `spacesPerLevel`, the number of spaces per indentation level for
+    /// this and all of its nested objects.  If `level` is negative,
+    /// suppress indentation of the first line.  If `spacesPerLevel` is
+    /// negative format the entire output on one line, suppressing all but
+    /// the initial indentation (as governed by `level`).  If `stream` is
+    /// not valid on entry, this operation has no effect.
+    bsl::ostream&
+    print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
+};
+
+// FREE OPERATORS
+
+/// Return `true` if the specified `lhs` and `rhs` have the same counts, and
+/// `false` otherwise.
+bool operator==(const HistogramSnapshot& lhs, const HistogramSnapshot& rhs);
+
+/// Format the specified `rhs` to the specified output `stream` and return a
+/// reference to `stream`.
+bsl::ostream& operator<<(bsl::ostream& stream, const HistogramSnapshot& rhs);
+
+// ===============
+// class Histogram
+// ===============
+
+/// Lock-free recorder of a histogram of values.
+class Histogram {
+  private:
+    // PRIVATE TYPES
+
+    /// Copyable counter of the values of a bucket.
+    struct Counter {
+        bsls::AtomicInt64 d_count;
+
+        Counter();
+        Counter(const Counter& other);
+        Counter& operator=(const Counter& rhs);
+    };
+
+    // DATA
+    bsl::vector<Counter> d_counters;
+    // Values recorded since the last
+    // collection, by bucket, or empty if
+    // this histogram is disabled
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Histogram, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a disabled histogram.  Optionally specify a `basicAllocator`
+    /// used to supply memory.  If `basicAllocator` is 0, the currently
+    /// installed default allocator is used.
+    explicit Histogram(bslma::Allocator* basicAllocator = 0);
+
+    /// Create a histogram having the value of the specified `other`.
+    /// Optionally specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.
+    Histogram(const Histogram& other, bslma::Allocator* basicAllocator = 0);
+
+    // MANIPULATORS
+    Histogram& operator=(const Histogram& rhs);
+
+    /// Enable this histogram if the specified `value` is `true`, or disable
+    /// it otherwise.  Recorded values not yet collected are lost.
+    void enable(bool value);
+
+    /// Record the specified `value`.  The behavior is undefined unless this
+    /// histogram is enabled.
+    void record(bsls::Types::Int64 value);
+
+    /// Add the values recorded since the last collection to the specified
+    /// `snapshot`.
+    void collect(HistogramSnapshot* snapshot);
+
+    /// Discard the values recorded since the last collection.
+    void reset();
+
+    // ACCESSORS
+
+    /// Return `true` if this histogram is enabled, and `false` otherwise.
+    bool isEnabled() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// --------------------
+// struct HistogramUtil
+// --------------------
+
+inline int HistogramUtil::bucketIndex(bsls::Types::Int64 value)
+{
+    if (value < k_NUM_SUB_BUCKETS) {
+        return value < 0 ? 0 : static_cast<int>(value);  // RETURN
+    }
+
+    // Position of the most significant bit, at least 'k_SUB_BUCKET_BITS'.
+    const int exponent = 63 - bdlb::BitUtil::numLeadingUnsetBits(
+                                  static_cast<bsl::uint64_t>(value));
+
+    return (exponent - k_SUB_BUCKET_BITS + 1) * k_NUM_SUB_BUCKETS +
+           static_cast<int>((value >> (exponent - k_SUB_BUCKET_BITS)) &
+                            (k_NUM_SUB_BUCKETS - 1));
+}
+
+inline bsls::Types::Int64 HistogramUtil::bucketLowerBound(int index)
+{
+    if (index < k_NUM_SUB_BUCKETS) {
+        return index;  // RETURN
+    }
+
+    const int shift = index / k_NUM_SUB_BUCKETS - 1;
+    return static_cast<bsls::Types::Int64>(k_NUM_SUB_BUCKETS +
+                                           index % k_NUM_SUB_BUCKETS)
+           << shift;
+}
+
+inline bsls::Types::Int64 HistogramUtil::bucketUpperBound(int index)
+{
+    if (index < k_NUM_SUB_BUCKETS) {
+        return index;  // RETURN
+    }
+
+    const int shift = index / k_NUM_SUB_BUCKETS - 1;
+    return bucketLowerBound(index) +
+           ((static_cast<bsls::Types::Int64>(1) << shift) - 1);
+}
+
+// -----------------------
+// class HistogramSnapshot
+// -----------------------
+
+// ACCESSORS
+inline const HistogramSnapshot::Buckets& HistogramSnapshot::buckets() const
+{
+    return d_buckets;
+}
+
+inline bsls::Types::Int64 HistogramSnapshot::count() const
+{
+    return d_count;
+}
+
+// ---------------
+// class Histogram
+// ---------------
+
+// MANIPULATORS
+inline void Histogram::record(bsls::Types::Int64 value)
+{
+    ++d_counters[HistogramUtil::bucketIndex(value)].d_count;
+}
+
+// ACCESSORS
+inline bool Histogram::isEnabled() const
+{
+    return !d_counters.empty();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline bsl::ostream& mwcst::operator<<(bsl::ostream&                   stream,
+                                       const mwcst::HistogramSnapshot& rhs)
+{
+    return rhs.print(stream, 0, -1);
+}
+
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,288 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwcst_histogram.t.cpp                                              -*-C++-*-
+
+#include <mwcst_histogram.h>
+
+#include <mwcst_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+
+using namespace BloombergLP;
+using namespace mwcst;
+using namespace bsl;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                              *** Overview ***
+//
+// The component under test is a log-linear histogram.  We verify that the
+// buckets cover all values with the advertised precision, and that the
+// percentiles computed from (differences of) snapshots are within the bounds
+// of the buckets of the exact percentiles.
+//
+// ----------------------------------------------------------------------------
+// ----------------------------------------------------------------------------
+// [ 1] Breathing Test
+// [ 2] Buckets
+// [ 3] Cumulative snapshots
+//=============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(int c, const char* s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "     (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100)
+            ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT BSLS_BSLTESTUTIL_ASSERT
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    int test    = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // Use test allocator
+    bslma::TestAllocator testAllocator;
+    testAllocator.setNoAbort(true);
+    bslma::Default::setDefaultAllocatorRaw(&testAllocator);
+
+    switch (test) {
+    case 0:
+    case 3: {
+        // --------------------------------------------------------------------
+        // CUMULATIVE SNAPSHOTS
+        //
+        // Concerns:
+        //   The percentiles of the values recorded between two cumulative
+        //   snapshots only account for the values recorded in between.
+        //
+        // Plan:
+        //   Collect repeatedly into the same snapshot, keeping a copy of an
+        //   intermediate state, and compute percentiles relative to it.
+        //
+        // Testing:
+        //   Histogram::collect
+        //   HistogramSnapshot::percentile
+        //   HistogramSnapshot::add
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "CUMULATIVE SNAPSHOTS" << endl
+                 << "====================" << endl;
+
+        Histogram histogram(&testAllocator);
+        histogram.enable(true);
+
+        HistogramSnapshot snapshot(&testAllocator);
+        for (int i = 0; i < 1000; ++i) {
+            histogram.record(1000);
+        }
+        histogram.collect(&snapshot);
+
+        const HistogramSnapshot base(snapshot, &testAllocator);
+        ASSERT(base.count() == 1000);
+
+        for (int i = 0; i < 100; ++i) {
+            histogram.record(1000000);
+        }
+        histogram.collect(&snapshot);
+        ASSERT(snapshot.count() == 1100);
+
+        // Since 'base', all values are 1000000.
+        const bsls::Types::Int64 p50 = snapshot.percentile(50, &base);
+        ASSERT(1000000 <= p50 && p50 <= 1000000 + 1000000 / 8);
+
+        // Overall, most values are 1000.
+        const bsls::Types::Int64 all = snapshot.percentile(50);
+        ASSERT(1000 <= all && all <= 1000 + 1000 / 8);
+
+        // Nothing was recorded since 'snapshot'.
+        ASSERT(snapshot.percentile(50, &snapshot) == 0);
+
+        // Merging
+        HistogramSnapshot merged(&testAllocator);
+        merged.add(base);
+        merged.add(base);
+        ASSERT(merged.count() == 2000);
+        ASSERT(merged.buckets().size() == 1);
+        ASSERT(merged.percentile(100) == base.percentile(100));
+
+        histogram.reset();
+        histogram.collect(&merged);
+        ASSERT(merged.count() == 2000);
+    } break;
+    case 2: {
+        // --------------------------------------------------------------------
+        // BUCKETS
+        //
+        // Concerns:
+        //   - Values below 'k_NUM_SUB_BUCKETS' are exact.
+        //   - Every non-negative value is within the bounds of its bucket,
+        //     whose width is at most 1/8th of its lower bound.
+        //   - Bucket indices increase with the values, up to the maximum
+        //     Int64, and negative values are counted as zero.
+        //
+        // Testing:
+        //   HistogramUtil::bucketIndex
+        //   HistogramUtil::bucketLowerBound
+        //   HistogramUtil::bucketUpperBound
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "BUCKETS" << endl
+                 << "=======" << endl;
+
+        for (int i = 0; i < HistogramUtil::k_NUM_SUB_BUCKETS; ++i) {
+            ASSERT(HistogramUtil::bucketIndex(i) == i);
+            ASSERT(HistogramUtil::bucketLowerBound(i) == i);
+            ASSERT(HistogramUtil::bucketUpperBound(i) == i);
+        }
+
+        ASSERT(HistogramUtil::bucketIndex(-5) == 0);
+
+        const bsls::Types::Int64 maxValue =
+            bsl::numeric_limits<bsls::Types::Int64>::max();
+        ASSERT(HistogramUtil::bucketIndex(maxValue) ==
+               HistogramUtil::k_NUM_BUCKETS - 1);
+        ASSERT(HistogramUtil::bucketUpperBound(
+                   HistogramUtil::k_NUM_BUCKETS - 1) == maxValue);
+
+        for (int i = 1; i < HistogramUtil::k_NUM_BUCKETS; ++i) {
+            // Buckets are contiguous
+            ASSERT(HistogramUtil::bucketLowerBound(i) ==
+                   HistogramUtil::bucketUpperBound(i - 1) + 1);
+        }
+
+        bsls::Types::Int64 value     = 1;
+        int                lastIndex = 0;
+        while (value < maxValue / 3) {
+            const int                index = HistogramUtil::bucketIndex(value);
+            const bsls::Types::Int64 lower = HistogramUtil::bucketLowerBound(
+                index);
+            const bsls::Types::Int64 upper = HistogramUtil::bucketUpperBound(
+                index);
+
+            ASSERT(lastIndex <= index);
+            ASSERT(lower <= value && value <= upper);
+            ASSERT(upper - lower <= lower / 8);
+
+            lastIndex = index;
+            value     = value * 3 / 2 + 1;
+        }
+    } break;
+    case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //   Exercise the basic functionality of the component.
+        //
+        // Plan:
+        //   Record the values from 1 to 100 and verify the percentiles of
+        //   the collected snapshot.
+        //
+        // Testing:
+        //   Basic functionality
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "BREATHING TEST" << endl
+                 << "==============" << endl;
+
+        Histogram histogram(&testAllocator);
+        ASSERT(!histogram.isEnabled());
+
+        histogram.enable(true);
+        ASSERT(histogram.isEnabled());
+
+        for (int i = 1; i <= 100; ++i) {
+            histogram.record(i);
+        }
+
+        HistogramSnapshot snapshot(&testAllocator);
+        ASSERT(snapshot.percentile(50) == 0);
+
+        histogram.collect(&snapshot);
+        ASSERT(snapshot.count() == 100);
+
+        // 50 is in [48, 51], 99 and 100 are in [96, 103]
+        ASSERT(snapshot.percentile(0) == 1);
+        ASSERT(snapshot.percentile(50) == 51);
+        ASSERT(snapshot.percentile(99) == 103);
+        ASSERT(snapshot.percentile(100) == 103);
+
+        // Collecting again adds nothing
+        HistogramSnapshot copy(snapshot, &testAllocator);
+        histogram.collect(&snapshot);
+        ASSERT(snapshot == copy);
+
+        if (verbose) {
+            cout << snapshot << endl;
+        }
+
+        snapshot.reset();
+        ASSERT(snapshot.count() == 0);
+        ASSERT(snapshot.buckets().empty());
+
+        histogram.enable(false);
+        ASSERT(!histogram.isEnabled());
+    } break;
+    default: {
+        cerr << "WARNING: CASE '" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+    }
+    }
+
+    if (testStatus != 255) {
+        if ((testAllocator.numMismatches() != 0) ||
+            (testAllocator.numBytesInUse() != 0)) {
+            bsl::cout << "*** Error " << __FILE__ << "(" << __LINE__
+                      << "): test allocator: " << '\n';
+            testAllocator.print();
+            testStatus++;
+        }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
@@ -70,6 +70,16 @@ void snapshotValueVec(bsl::vector<StatValue>* vec,
     }
 }
 
+void snapshotUnchangedValueVec(bsl::vector<StatValue>* vec,
+                               bsls::Types::Int64      snapshotTime)
+{
+    if (vec) {
+        for (size_t i = 0; i < vec->size(); ++i) {
+            (*vec)[i].takeUnchangedSnapshot(snapshotTime);
+        }
+    }
+}
+
 void addValues(bsl::vector<StatValue>* dest, const bsl::vector<StatValue>* src)
 {
     if (dest) {
@@ -183,7 +193,9 @@ void StatContext::datumDeleter(void* /*datum_vp*/, void* datumLock_vp)
 }
 
 // PRIVATE MANIPULATORS
-void StatContext::initValues(ValueVecPtr& vec, bsls::Types::Int64 initTime)
+void StatContext::initValues(ValueVecPtr&       vec,
+                             bsls::Types::Int64 initTime,
+                             bool               isDirect)
 {
     if (!d_valueDefs_p) {
         return;
@@ -193,9 +205,16 @@ void StatContext::initValues(ValueVecPtr& vec, bsls::Types::Int64 initTime)
 
     newVec->resize(d_valueDefs_p->size());
     for (size_t vIdx = 0; vIdx < d_valueDefs_p->size(); ++vIdx) {
+        // Only direct values are updated by user threads, the others being
+        // computed at snapshot time.
         (*newVec)[vIdx].init((*d_valueDefs_p)[vIdx].d_sizes,
                              (*d_valueDefs_p)[vIdx].d_type,
-                             initTime);
+                             initTime,
+                             isDirect ? (*d_valueDefs_p)[vIdx].d_numShards
+                                      : 0);
+        if (isDirect && (*d_valueDefs_p)[vIdx].d_hasHistogram) {
+            (*newVec)[vIdx].enableHistogram();
+        }
     }
 
     vec.load(newVec, d_valueVecPool_p.get());
@@ -338,6 +357,26 @@ void StatContext::snapshotImp(bsls::Types::Int64 snapshotTime)
 
     moveNewSubcontexts();
 
+    // Clear the flag before reading the values (see 'markUpdated').
+    d_wasUpdated = d_hasUpdates.swap(false) || 0 == d_numSnapshots;
+
+    if (!d_wasUpdated && !d_update_p && d_subcontexts.empty() &&
+        d_deletedSubcontexts.empty() && !d_totalValues_p &&
+        !d_activeChildrenTotalValues_p && !d_expiredValues_p) {
+        // Fast path for a leaf context whose values were not updated, by far
+        // the most common case with many idle contexts (e.g., queues or
+        // client sessions): its new snapshot is derived from the previous
+        // one, without reading the current stats of its values.
+
+        snapshotUnchangedValueVec(d_directValues_p.ptr(), snapshotTime);
+        ++d_numSnapshots;
+
+        if (d_userData_p) {
+            d_userData_p->snapshot();
+        }
+        return;  // RETURN
+    }
+
     if (d_isTable && !d_subcontexts.empty() &&
         !d_activeChildrenTotalValues_p && d_directValues_p) {
         // Initialize 'd_activeChildrenTotalValues_p' if we have subtables
@@ -453,6 +492,8 @@ void StatContext::cleanupImp(bsl::vector<ValueVec*>* expiredValuesVec)
 
 void StatContext::applyUpdate(const mwcstm::StatContextUpdate& update)
 {
+    d_hasUpdates = true;
+
     // Apply the update to all of our values.
 
     BSLS_ASSERT(update.directValues().size() == d_directValues_p->size());
@@ -509,6 +550,8 @@ StatContext::StatContext(const Config&     config,
 , d_nextSubcontextId_p()
 , d_released(false)
 , d_isDeleted(false)
+, d_hasUpdates(false)
+, d_wasUpdated(false)
 , d_isTable(config.d_isTable)
 , d_storeExpiredValues(config.d_storeExpiredSubcontextValues)
 , d_defaultHistorySizes(config.d_defaultHistorySizes, basicAllocator)
@@ -553,7 +596,7 @@ StatContext::StatContext(const Config&     config,
             }
         }
 
-        initValues(d_directValues_p, bsls::TimeUtil::getTimer());
+        initValues(d_directValues_p, bsls::TimeUtil::getTimer(), true);
     }
 
     if (config.d_update_p) {
@@ -604,7 +647,7 @@ bslma::ManagedPtr<StatContext> StatContext::addSubcontext(const Config& config)
         newContext->d_valueVecPool_p = d_valueVecPool_p;
 
         newContext->d_valueDefs_p = d_valueDefs_p;
-        newContext->initValues(newContext->d_directValues_p);
+        newContext->initValues(newContext->d_directValues_p, 0, true);
     }
     else {
         newConfig.d_statValueAllocator_p = d_statValueAllocator_p;
@@ -650,6 +693,7 @@ void StatContext::cleanup()
 
 void StatContext::clearValues()
 {
+    d_hasUpdates = true;
     moveNewSubcontexts();
     for (StatContextMap::iterator iter = d_subcontexts.begin();
          iter != d_subcontexts.end();
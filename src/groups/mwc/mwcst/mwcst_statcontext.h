@@ -553,6 +553,8 @@ class StatContext {
         bsl::string      d_name;
         bsl::vector<int> d_sizes;
         StatValue::Type  d_type;
+        int              d_numShards;
+        bool             d_hasHistogram;
 
         // TRAITS
         BSLMF_NESTED_TRAIT_DECLARATION(ValueDefinition,
@@ -563,6 +565,8 @@ class StatContext {
         : d_name(basicAllocator)
         , d_sizes(basicAllocator)
         , d_type(StatValue::DMCST_CONTINUOUS)
+        , d_numShards(0)
+        , d_hasHistogram(false)
         {
         }
 
@@ -571,6 +575,8 @@ class StatContext {
         : d_name(other.d_name, basicAllocator)
         , d_sizes(other.d_sizes, basicAllocator)
         , d_type(other.d_type)
+        , d_numShards(other.d_numShards)
+        , d_hasHistogram(other.d_hasHistogram)
         {
         }
     };
@@ -613,6 +619,14 @@ class StatContext {
     // No more external references to this
     // context
 
+    bsls::AtomicBool d_hasUpdates;
+    // Direct values updated since the last
+    // snapshot
+
+    bool d_wasUpdated;
+    // Direct values updated between the
+    // last two snapshots
+
     bool d_isTable;
 
     bool d_storeExpiredValues;
@@ -673,8 +687,16 @@ class StatContext {
 
     // PRIVATE MANIPULATORS
 
-    /// Initialize the specified `vec` using `d_valueDefs_p`
-    void initValues(ValueVecPtr& vec, bsls::Types::Int64 initTime = 0);
+    /// Record that the direct values of this context were updated since the
+    /// last snapshot.
+    void markUpdated();
+
+    /// Initialize the specified `vec` using `d_valueDefs_p`.  Optionally
+    /// specify `isDirect` to shard the values configured to be sharded, and
+    /// to enable the histograms of the values configured to have one.
+    void initValues(ValueVecPtr&       vec,
+                    bsls::Types::Int64 initTime = 0,
+                    bool               isDirect = false);
 
     /// Delete everything in `d_deletedSubcontexts`
     void clearDeletedSubcontexts(bsl::vector<ValueVec*>* expiredValuesVec);
@@ -786,6 +808,13 @@ class StatContext {
     /// deleted during its parent's next `cleanup`.
     bool isDeleted() const;
 
+    /// Return `true` if the direct values of this StatContext were updated
+    /// between its last two snapshots (or if it was snapshotted only once),
+    /// and `false` otherwise.  Note that the values of a context which was
+    /// not updated may still change from one snapshot to the next, for
+    /// instance the differences over a range of snapshots.
+    bool wasUpdated() const;
+
     /// Return `true` if we have any expired StatContexts whose values
     /// we've remembered.
     bool hasExpiredValues() const;
@@ -992,6 +1021,24 @@ class StatContextConfiguration {
     /// size.
     StatContextConfiguration& valueLevel(int size);
 
+    /// Shard the updates of the last added value over the specified
+    /// `numShards`, so that threads concurrently updating it do not contend
+    /// on the same cache lines.  The shards are folded at `snapshot` time.
+    /// This is intended for values updated at a high rate by many threads;
+    /// see the `Sharded Updates` section of `mwcst_statvalue` for the
+    /// resulting accuracy.  Note that `setValue` is not supported by a
+    /// sharded value.  The behavior is undefined unless a value was added
+    /// and `0 <= numShards`.
+    StatContextConfiguration& valueShards(int numShards);
+
+    /// Maintain a histogram of the values reported to the last added value,
+    /// from which percentiles of its snapshots can be computed (see
+    /// `StatUtil::rangePercentile`).  Each histogram takes about 4K of
+    /// memory for its recorder, plus the non-empty buckets of each of its
+    /// snapshots.  The behavior is undefined unless the last added value is
+    /// discrete.
+    StatContextConfiguration& valueHistogram();
+
     /// Set a callback to be invoked right before the `StatContext` is
     /// snapshotted.  Return this object.
     StatContextConfiguration& preSnapshotCallback(
@@ -1061,6 +1108,19 @@ class StatContextIterator {
 // class StatContext
 // -----------------
 
+// PRIVATE MANIPULATORS
+inline void StatContext::markUpdated()
+{
+    // Only write the flag when needed, so that the threads updating a busy
+    // context keep sharing its cache line, even if its values are sharded.
+    // The value is updated before the flag is read, and the snapshot clears
+    // the flag before reading the values, so that each update is seen
+    // either by the next snapshot or by the one after.
+    if (!d_hasUpdates.load()) {
+        d_hasUpdates.store(true);
+    }
+}
+
 // CREATORS
 inline StatContext::~StatContext()
 {
@@ -1072,18 +1132,21 @@ inline void StatContext::adjustValue(int valueKey, bsls::Types::Int64 delta)
 {
     BSLS_ASSERT(valueKey < static_cast<int>(d_directValues_p->size()));
     (*d_directValues_p)[valueKey].adjustValue(delta);
+    markUpdated();
 }
 
 inline void StatContext::setValue(int valueKey, bsls::Types::Int64 value)
 {
     BSLS_ASSERT(valueKey < static_cast<int>(d_directValues_p->size()));
     (*d_directValues_p)[valueKey].setValue(value);
+    markUpdated();
 }
 
 inline void StatContext::reportValue(int valueKey, bsls::Types::Int64 value)
 {
     BSLS_ASSERT(valueKey < static_cast<int>(d_directValues_p->size()));
     (*d_directValues_p)[valueKey].reportValue(value);
+    markUpdated();
 }
 
 // ACCESSORS
@@ -1119,6 +1182,11 @@ inline bool StatContext::isDeleted() const
     return d_isDeleted;
 }
 
+inline bool StatContext::wasUpdated() const
+{
+    return d_wasUpdated;
+}
+
 inline bool StatContext::hasExpiredValues() const
 {
     return d_expiredValues_p.ptr();
@@ -1373,6 +1441,22 @@ inline StatContextConfiguration& StatContextConfiguration::valueLevel(int size)
     return *this;
 }
 
+inline StatContextConfiguration&
+StatContextConfiguration::valueShards(int numShards)
+{
+    BSLS_ASSERT(!d_valueDefs.empty() && 0 <= numShards);
+    d_valueDefs.back().d_numShards = numShards;
+    return *this;
+}
+
+inline StatContextConfiguration& StatContextConfiguration::valueHistogram()
+{
+    BSLS_ASSERT(!d_valueDefs.empty() &&
+                d_valueDefs.back().d_type == StatValue::DMCST_DISCRETE);
+    d_valueDefs.back().d_hasHistogram = true;
+    return *this;
+}
+
 inline StatContextConfiguration& StatContextConfiguration::preSnapshotCallback(
     const StatContext::SnapshotCallback& preSnapshotCallback)
 {
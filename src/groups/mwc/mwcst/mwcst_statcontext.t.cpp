@@ -29,12 +29,14 @@
 
 // BDE
 #include <bdlb_bitutil.h>
+#include <bdlf_bind.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
 #include <bsl_vector.h>
 #include <bslma_default.h>
 #include <bslma_testallocator.h>
 #include <bslma_testallocatormonitor.h>
+#include <bslmt_threadgroup.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -58,6 +60,8 @@ using namespace mwcst;
 // [ 4] Usage example with value level
 // [ 4] Test updates
 // [ 5] Usage examples with updates
+// [ 8] Sharded values
+// [ 9] Unchanged snapshots
 //-----------------------------------------------------------------------------
 
 //=============================================================================
@@ -1078,6 +1082,158 @@ static void testDatum(bslma::Allocator* allocator)
     ASSERT(datum->datum().isInteger());
 }
 
+/// Update `k_NUM_UPDATES` times the values of the specified `context`
+/// configured by `testShardedValues`.
+static void updateShardedValues(StatContext* context)
+{
+    const int k_NUM_UPDATES = 10000;
+
+    for (int i = 0; i < k_NUM_UPDATES; ++i) {
+        context->adjustValue(0, 1);
+        context->reportValue(1, i % 10);
+    }
+}
+
+static void testShardedValues(bslma::Allocator* allocator)
+{
+    const int k_NUM_THREADS = 8;
+    const int k_NUM_UPDATES = 10000;  // per thread
+
+    StatContextConfiguration config("test", allocator);
+    config.value("continuous")
+        .valueShards(4)
+        .value("discrete", StatValue::DMCST_DISCRETE)
+        .valueShards(5)  // rounded up to 8
+        .defaultHistorySize(2);
+    StatContext context(config, allocator);
+
+    ASSERT_EQUALS(direct(context, 0).numShards(), 4);
+    ASSERT_EQUALS(direct(context, 1).numShards(), 8);
+
+    PV("a. Single thread");
+    context.adjustValue(0, 5);
+    context.adjustValue(0, -2);
+    context.reportValue(1, 7);
+    context.reportValue(1, 3);
+
+    // The intermediate value '5' is not seen by a sharded continuous value.
+    context.snapshot();
+    ASSERT(checkSnapshot(direct(context, 0), 0, 0, "3 0 3 1 1"));
+    ASSERT(checkSnapshot(direct(context, 1), 0, 0, "3 7 2 10"));
+
+    PV("b. Multiple threads");
+    bslmt::ThreadGroup threadGroup(allocator);
+    threadGroup.addThreads(bdlf::BindUtil::bind(&updateShardedValues,
+                                                &context),
+                           k_NUM_THREADS);
+    threadGroup.joinAll();
+
+    const bsls::Types::Int64 numUpdates = k_NUM_THREADS * k_NUM_UPDATES;
+
+    context.snapshot();
+
+    const StatValue::Snapshot& continuous = direct(context, 0).snapshot(
+        StatValue::SnapshotLocation(0, 0));
+    ASSERT_EQUALS(continuous.value(), 3 + numUpdates);
+    ASSERT_EQUALS(continuous.increments(), 1 + numUpdates);
+    ASSERT_EQUALS(continuous.decrements(), 1);
+    ASSERT_EQUALS(continuous.max(), 3 + numUpdates);
+
+    // Events and sum are cumulative, and the events of each thread sum to
+    // '45 * k_NUM_UPDATES / 10'.
+    const StatValue::Snapshot& discrete = direct(context, 1).snapshot(
+        StatValue::SnapshotLocation(0, 0));
+    ASSERT_EQUALS(discrete.events(), 2 + numUpdates);
+    ASSERT_EQUALS(discrete.sum(), 10 + 45 * numUpdates / 10);
+    ASSERT_EQUALS(discrete.min(), 0);
+    ASSERT_EQUALS(discrete.max(), 9);
+
+    PV("c. Clear");
+    context.adjustValue(0, 1);
+    context.clearValues();
+    context.snapshot();
+    ASSERT(checkSnapshot(direct(context, 0), 0, 0, "0 0 0 0 0"));
+    ASSERT(checkSnapshot(direct(context, 1), 0, 0, "++ -- 0 0"));
+}
+
+static void testUnchangedSnapshots(bslma::Allocator* allocator)
+{
+    typedef StatValue::SnapshotLocation Location;
+
+    StatContextConfiguration config("test", allocator);
+    config.isTable(true)
+        .value("continuous")
+        .value("discrete", StatValue::DMCST_DISCRETE)
+        .valueHistogram()
+        .defaultHistorySize(3);
+    StatContext context(config, allocator);
+
+    bslma::ManagedPtr<StatContext> a = context.addSubcontext(
+        StatContextConfiguration("a", allocator));
+    bslma::ManagedPtr<StatContext> b = context.addSubcontext(
+        StatContextConfiguration("b", allocator));
+
+    PV("a. First snapshot");
+    context.snapshot();
+    ASSERT(a->wasUpdated());
+    ASSERT(b->wasUpdated());
+
+    PV("b. Updated contexts");
+    a->adjustValue(0, 5);
+    a->reportValue(1, 7);
+    b->adjustValue(0, 2);
+    context.snapshot();
+    ASSERT(a->wasUpdated());
+    ASSERT(b->wasUpdated());
+    ASSERT(checkSnapshot(direct(*b, 0), 0, 0, "2 0 2 1 0"));
+
+    PV("c. One unchanged context");
+    a->adjustValue(0, 1);
+    context.snapshot();
+    ASSERT(a->wasUpdated());
+    ASSERT(!b->wasUpdated());
+    ASSERT(checkSnapshot(direct(*a, 0), 0, 0, "6 5 6 2 0"));
+    ASSERT(checkSnapshot(direct(*a, 1), 0, 0, "++ -- 1 7"));
+    ASSERT(checkSnapshot(direct(*b, 0), 0, 0, "2 2 2 1 0"));
+    ASSERT(checkSnapshot(direct(*b, 1), 0, 0, "++ -- 0 0"));
+    ASSERT_EQUALS(StatUtil::rangePercentile50(direct(*a, 1),
+                                              Location(0, 0),
+                                              Location(0, 2)),
+                  7);
+
+    // The unchanged context is still accounted in the totals.
+    ASSERT_EQUALS(
+        StatUtil::value(context.value(StatContext::DMCST_TOTAL_VALUE, 0),
+                        Location(0, 0)),
+        8);
+
+    PV("d. All contexts unchanged");
+    context.snapshot();
+    ASSERT(!a->wasUpdated());
+    ASSERT(!b->wasUpdated());
+    ASSERT(checkSnapshot(direct(*a, 0), 0, 0, "6 6 6 2 0"));
+    ASSERT(checkSnapshot(direct(*a, 1), 0, 0, "++ -- 1 7"));
+    ASSERT_EQUALS(StatUtil::rangeMax(direct(*a, 0),
+                                     Location(0, 0),
+                                     Location(0, 1)),
+                  6);
+    ASSERT_EQUALS(StatUtil::rangePercentile50(direct(*a, 1),
+                                              Location(0, 0),
+                                              Location(0, 2)),
+                  bsl::numeric_limits<bsls::Types::Int64>::max());
+    ASSERT_EQUALS(
+        StatUtil::value(context.value(StatContext::DMCST_TOTAL_VALUE, 0),
+                        Location(0, 0)),
+        8);
+
+    PV("e. Updated again");
+    b->setValue(0, 10);
+    context.snapshot();
+    ASSERT(!a->wasUpdated());
+    ASSERT(b->wasUpdated());
+    ASSERT(checkSnapshot(direct(*b, 0), 0, 0, "10 2 10 2 0"));
+}
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -1118,6 +1274,35 @@ int main(int argc, char** argv)
 
     switch (test) {
     case 0:  // Zero is always the leading case.
+    case 9: {
+        // --------------------------------------------------------------------
+        // TEST UNCHANGED SNAPSHOTS
+        //
+        // Concerns:
+        //   The snapshots of the contexts which were not updated since their
+        //   last snapshot, taken without reading their values, are the same
+        //   as regular snapshots.
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "TEST UNCHANGED SNAPSHOTS" << endl
+                 << "========================" << endl;
+        testUnchangedSnapshots(&ta);
+    } break;
+
+    case 8: {
+        // --------------------------------------------------------------------
+        // TEST SHARDED VALUES
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "TEST SHARDED VALUES" << endl
+                 << "===================" << endl;
+        testShardedValues(&ta);
+    } break;
+
     case 7: {
         // --------------------------------------------------------------------
         // TEST DATUM
@@ -422,5 +422,49 @@ double StatUtil::averagePerEventReal(
     }
 }
 
+bsls::Types::Int64
+StatUtil::rangePercentile(const StatValue&                   value,
+                          const StatValue::SnapshotLocation& firstSnapshot,
+                          const StatValue::SnapshotLocation& secondSnapshot,
+                          double                             percentile)
+{
+    if (!value.hasHistogram()) {
+        return bsl::numeric_limits<bsls::Types::Int64>::max();  // RETURN
+    }
+
+    const HistogramSnapshot& first  = value.histogram(firstSnapshot);
+    const HistogramSnapshot& second = value.histogram(secondSnapshot);
+    if (first.count() == second.count()) {
+        return bsl::numeric_limits<bsls::Types::Int64>::max();
+    }
+    else {
+        return first.percentile(percentile, &second);
+    }
+}
+
+bsls::Types::Int64
+StatUtil::rangePercentile50(const StatValue&                   value,
+                            const StatValue::SnapshotLocation& firstSnapshot,
+                            const StatValue::SnapshotLocation& secondSnapshot)
+{
+    return rangePercentile(value, firstSnapshot, secondSnapshot, 50);
+}
+
+bsls::Types::Int64
+StatUtil::rangePercentile99(const StatValue&                   value,
+                            const StatValue::SnapshotLocation& firstSnapshot,
+                            const StatValue::SnapshotLocation& secondSnapshot)
+{
+    return rangePercentile(value, firstSnapshot, secondSnapshot, 99);
+}
+
+bsls::Types::Int64
+StatUtil::rangePercentile999(const StatValue&                   value,
+                             const StatValue::SnapshotLocation& firstSnapshot,
+                             const StatValue::SnapshotLocation& secondSnapshot)
+{
+    return rangePercentile(value, firstSnapshot, secondSnapshot, 99.9);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -257,6 +257,43 @@ struct StatUtil {
     averagePerEventReal(const StatValue&                   value,
                         const StatValue::SnapshotLocation& firstSnapshot,
                         const StatValue::SnapshotLocation& secondSnapshot);
+
+    /// Return an upper bound, accurate to within 12.5%, of the specified
+    /// `percentile` of the values reported to the specified `value` between
+    /// the specified `firstSnapshot` and the specified `secondSnapshot`, as
+    /// computed from the histogram of `value`.  If nothing was reported, or
+    /// if `value` has no histogram (see `StatValue::enableHistogram`), the
+    /// maximum Int64 is returned.  The behavior is undefined unless
+    /// `0 <= percentile <= 100` and `firstSnapshot > secondSnapshot`.
+    static bsls::Types::Int64
+    rangePercentile(const StatValue&                   value,
+                    const StatValue::SnapshotLocation& firstSnapshot,
+                    const StatValue::SnapshotLocation& secondSnapshot,
+                    double                             percentile);
+
+    /// Return the median (i.e., 50th percentile) of the values reported to
+    /// the specified `value` between the specified `firstSnapshot` and the
+    /// specified `secondSnapshot`.  See `rangePercentile`.
+    static bsls::Types::Int64
+    rangePercentile50(const StatValue&                   value,
+                      const StatValue::SnapshotLocation& firstSnapshot,
+                      const StatValue::SnapshotLocation& secondSnapshot);
+
+    /// Return the 99th percentile of the values reported to the specified
+    /// `value` between the specified `firstSnapshot` and the specified
+    /// `secondSnapshot`.  See `rangePercentile`.
+    static bsls::Types::Int64
+    rangePercentile99(const StatValue&                   value,
+                      const StatValue::SnapshotLocation& firstSnapshot,
+                      const StatValue::SnapshotLocation& secondSnapshot);
+
+    /// Return the 99.9th percentile of the values reported to the specified
+    /// `value` between the specified `firstSnapshot` and the specified
+    /// `secondSnapshot`.  See `rangePercentile`.
+    static bsls::Types::Int64
+    rangePercentile999(const StatValue&                   value,
+                       const StatValue::SnapshotLocation& firstSnapshot,
+                       const StatValue::SnapshotLocation& secondSnapshot);
 };
 
 }  // close package namespace
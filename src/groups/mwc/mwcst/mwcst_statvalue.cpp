@@ -37,6 +37,46 @@ bsls::Types::Int64 MIN_INT = bsl::numeric_limits<bsls::Types::Int64>::min();
 // ---------------
 
 // PRIVATE MANIPULATORS
+void StatValue::foldShards()
+{
+    // Updates racing with this fold are either folded now or at the next
+    // snapshot, as each field is swapped out atomically.
+
+    for (size_t i = 0; i < d_shards.size(); ++i) {
+        AtomicValueStats& stats = d_shards[i].d_stats;
+
+        d_currentStats.d_incrementsOrEvents += stats.d_incrementsOrEvents.swap(
+            0);
+        d_currentStats.d_decrementsOrSum += stats.d_decrementsOrSum.swap(0);
+
+        if (d_type == DMCST_CONTINUOUS) {
+            d_currentStats.d_value += stats.d_value.swap(0);
+        }
+        else {
+            const bsls::Types::Int64 min = stats.d_min.swap(MAX_INT);
+            const bsls::Types::Int64 max = stats.d_max.swap(MIN_INT);
+            if (min != MAX_INT) {
+                updateMinMax(&d_currentStats, min);
+            }
+            if (max != MIN_INT) {
+                updateMinMax(&d_currentStats, max);
+            }
+        }
+    }
+
+    if (d_type == DMCST_CONTINUOUS && !d_shards.empty()) {
+        // The intermediate values of a sharded continuous value are unknown.
+        updateMinMax(&d_currentStats, d_currentStats.d_value);
+    }
+}
+
+void StatValue::resetShards()
+{
+    for (size_t i = 0; i < d_shards.size(); ++i) {
+        d_shards[i].d_stats.reset(d_type == DMCST_DISCRETE, 0);
+    }
+}
+
 void StatValue::aggregateLevel(int level, bsls::Types::Int64 snapshotTime)
 {
     if (level + 1 >= static_cast<int>(d_levelStartIndices.size()) - 1) {
@@ -62,6 +102,14 @@ void StatValue::aggregateLevel(int level, bsls::Types::Int64 snapshotTime)
     aggSnapshot.d_decrementsOrSum    = firstSnapshot.d_decrementsOrSum;
     aggSnapshot.d_snapshotTime       = snapshotTime;
 
+    if (d_histogram.isEnabled()) {
+        // Histogram snapshots are cumulative, so the aggregated one is the
+        // most recent one.
+        d_histogramHistory[d_curSnapshotIndices[level + 1] +
+                           d_levelStartIndices[level + 1]] =
+            d_histogramHistory[d_levelStartIndices[level]];
+    }
+
     for (int i = d_levelStartIndices[level] + 1;
          i < d_levelStartIndices[level + 1];
          ++i) {
@@ -76,11 +124,50 @@ void StatValue::aggregateLevel(int level, bsls::Types::Int64 snapshotTime)
     }
 }
 
+void StatValue::pushSnapshot(bsls::Types::Int64 value,
+                             bsls::Types::Int64 min,
+                             bsls::Types::Int64 max,
+                             bsls::Types::Int64 incrementsOrEvents,
+                             bsls::Types::Int64 decrementsOrSum,
+                             bsls::Types::Int64 snapshotTime,
+                             bool               collectHistogram)
+{
+    const int previousIndex = d_curSnapshotIndices[0];
+    int levelSize           = d_levelStartIndices[1] - d_levelStartIndices[0];
+    d_curSnapshotIndices[0] = (d_curSnapshotIndices[0] + 1) % levelSize;
+    Snapshot& snapshot      = d_history[d_curSnapshotIndices[0]];
+
+    snapshot.d_value              = value;
+    snapshot.d_min                = min;
+    snapshot.d_max                = max;
+    snapshot.d_incrementsOrEvents = incrementsOrEvents;
+    snapshot.d_decrementsOrSum    = decrementsOrSum;
+    snapshot.d_snapshotTime       = snapshotTime;
+
+    if (d_histogram.isEnabled()) {
+        HistogramSnapshot& histogram =
+            d_histogramHistory[d_curSnapshotIndices[0]];
+        histogram = d_histogramHistory[previousIndex];
+        if (collectHistogram) {
+            d_histogram.collect(&histogram);
+        }
+    }
+
+    if (d_curSnapshotIndices[0] == 0) {
+        // We've performed enough snapshots to advance to the next aggregation
+        // level
+        aggregateLevel(0, snapshotTime);
+    }
+}
+
 // CREATORS
 StatValue::StatValue(bslma::Allocator* basicAllocator)
 : d_type(DMCST_CONTINUOUS)
 , d_currentStats()
+, d_shards(basicAllocator)
 , d_history(basicAllocator)
+, d_histogram(basicAllocator)
+, d_histogramHistory(basicAllocator)
 , d_levelStartIndices(basicAllocator)
 , d_curSnapshotIndices(basicAllocator)
 , d_min(0)
@@ -94,7 +181,10 @@ StatValue::StatValue(const bsl::vector<int>& sizes,
                      bslma::Allocator*       basicAllocator)
 : d_type(type)
 , d_currentStats()
+, d_shards(basicAllocator)
 , d_history(basicAllocator)
+, d_histogram(basicAllocator)
+, d_histogramHistory(basicAllocator)
 , d_levelStartIndices(basicAllocator)
 , d_curSnapshotIndices(basicAllocator)
 , d_min(0)
@@ -106,7 +196,10 @@ StatValue::StatValue(const bsl::vector<int>& sizes,
 StatValue::StatValue(const StatValue& other, bslma::Allocator* basicAllocator)
 : d_type(other.d_type)
 , d_currentStats(other.d_currentStats)
+, d_shards(other.d_shards, basicAllocator)
 , d_history(other.d_history, basicAllocator)
+, d_histogram(other.d_histogram, basicAllocator)
+, d_histogramHistory(other.d_histogramHistory, basicAllocator)
 , d_levelStartIndices(other.d_levelStartIndices, basicAllocator)
 , d_curSnapshotIndices(other.d_curSnapshotIndices, basicAllocator)
 , d_min(other.d_min)
@@ -118,7 +211,10 @@ StatValue::StatValue(const StatValue& other, bslma::Allocator* basicAllocator)
 StatValue& StatValue::operator=(const StatValue& rhs)
 {
     d_currentStats       = rhs.d_currentStats;
+    d_shards             = rhs.d_shards;
     d_history            = rhs.d_history;
+    d_histogram          = rhs.d_histogram;
+    d_histogramHistory   = rhs.d_histogramHistory;
     d_levelStartIndices  = rhs.d_levelStartIndices;
     d_curSnapshotIndices = rhs.d_curSnapshotIndices;
     d_min                = rhs.d_min;
@@ -205,6 +301,8 @@ void StatValue::setFromUpdate(const mwcstm::StatValueUpdate& update)
 
 void StatValue::takeSnapshot(bsls::Types::Int64 snapshotTime)
 {
+    foldShards();
+
     bsls::Types::Int64 value = d_currentStats.d_value;
     bsls::Types::Int64 incrementsOrEvents;
     bsls::Types::Int64 decrementsOrSum;
@@ -226,33 +324,54 @@ void StatValue::takeSnapshot(bsls::Types::Int64 snapshotTime)
     d_min = bsl::min(d_min, min);
     d_max = bsl::max(d_max, max);
 
-    int levelSize           = d_levelStartIndices[1] - d_levelStartIndices[0];
-    d_curSnapshotIndices[0] = (d_curSnapshotIndices[0] + 1) % levelSize;
-    Snapshot& snapshot      = d_history[d_curSnapshotIndices[0]];
-
-    snapshot.d_value              = value;
-    snapshot.d_min                = min;
-    snapshot.d_max                = max;
-    snapshot.d_incrementsOrEvents = incrementsOrEvents;
-    snapshot.d_decrementsOrSum    = decrementsOrSum;
-    snapshot.d_snapshotTime       = snapshotTime;
+    pushSnapshot(value,
+                 min,
+                 max,
+                 incrementsOrEvents,
+                 decrementsOrSum,
+                 snapshotTime,
+                 true);
+}
 
-    if (d_curSnapshotIndices[0] == 0) {
-        // We've performed enough snapshots to advance to the next aggregation
-        // level
-        aggregateLevel(0, snapshotTime);
-    }
+void StatValue::takeUnchangedSnapshot(bsls::Types::Int64 snapshotTime)
+{
+    // Note that the current stats are not checked against the last snapshot:
+    // an update racing with this snapshot may already have modified them
+    // without having flagged its context yet (see
+    // 'StatContext::markUpdated'), in which case it is taken into account by
+    // the next snapshot.
+
+    // Without updates, the min and max of the interval are the value itself
+    // for a continuous value, and undefined for a discrete one, exactly as
+    // 'takeSnapshot' reset them last time.
+    const Snapshot&          last         = d_history[d_curSnapshotIndices[0]];
+    const bsls::Types::Int64 value        = last.d_value;
+    const bool               isContinuous = d_type == DMCST_CONTINUOUS;
+
+    pushSnapshot(value,
+                 isContinuous ? value : MAX_INT,
+                 isContinuous ? value : MIN_INT,
+                 last.d_incrementsOrEvents,
+                 last.d_decrementsOrSum,
+                 snapshotTime,
+                 false);
 }
 
 void StatValue::clear(bsls::Types::Int64 snapshotTime)
 {
     d_currentStats.reset(d_type == DMCST_DISCRETE, 0);
+    resetShards();
     d_curSnapshotIndices.assign(d_curSnapshotIndices.size(), 0);
 
     for (size_t i = 0; i < d_history.size(); ++i) {
         d_history[i].reset(d_type == DMCST_DISCRETE, snapshotTime);
     }
 
+    d_histogram.reset();
+    for (size_t i = 0; i < d_histogramHistory.size(); ++i) {
+        d_histogramHistory[i].reset();
+    }
+
     if (d_type == DMCST_DISCRETE) {
         d_min = MAX_INT;
         d_max = MIN_INT;
@@ -265,8 +384,11 @@ void StatValue::clear(bsls::Types::Int64 snapshotTime)
 
 void StatValue::init(const bsl::vector<int>& sizes,
                      Type                    type,
-                     bsls::Types::Int64      snapshotTime)
+                     bsls::Types::Int64      snapshotTime,
+                     int                     numShards)
 {
+    BSLS_ASSERT(0 <= numShards);
+
     d_type = type;
     d_levelStartIndices.resize(sizes.size() + 1);
     d_curSnapshotIndices.assign(sizes.size(), 0);
@@ -274,6 +396,16 @@ void StatValue::init(const bsl::vector<int>& sizes,
     d_max = (d_type == DMCST_DISCRETE ? MIN_INT : 0);
     d_currentStats.reset(d_type == DMCST_DISCRETE, 0);
 
+    d_shards.clear();
+    if (numShards > 0) {
+        d_shards.resize(bdlb::BitUtil::roundUpToBinaryPower(
+            static_cast<bsl::uint32_t>(numShards)));
+        resetShards();
+    }
+
+    d_histogram.enable(false);
+    d_histogramHistory.clear();
+
     int historySize = 0;
     for (size_t i = 0; i < sizes.size(); ++i) {
         d_levelStartIndices[i] = historySize;
@@ -298,6 +430,15 @@ void StatValue::syncSnapshotSchedule(const StatValue& other)
     }
 }
 
+void StatValue::enableHistogram()
+{
+    BSLS_ASSERT(d_type == DMCST_DISCRETE);
+
+    d_histogram.enable(true);
+    d_histogramHistory.clear();
+    d_histogramHistory.resize(d_history.size());
+}
+
 // ACCESSORS
 bsl::ostream&
 StatValue::print(bsl::ostream& stream, int level, int spacesPerLevel) const
@@ -309,6 +450,8 @@ StatValue::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     bslim::Printer printer(&stream, level, spacesPerLevel);
     printer.start();
     printer.printAttribute("CurrentStats", d_currentStats);
+    printer.printAttribute("NumShards", d_shards.size());
+    printer.printAttribute("HasHistogram", d_histogram.isEnabled());
     printer.printAttribute("History", d_history);
     printer.printAttribute("LevelStartIndices", d_levelStartIndices);
     printer.printAttribute("CurSnapshotIndices", d_curSnapshotIndices);
@@ -35,9 +35,40 @@
 // the 'mwcst::StatContext' component.  Refer to the usage examples in the
 // documentation of that component.
 //
+/// Sharded Updates
+///---------------
+// A 'StatValue' updated by many threads at a high rate can be initialized
+// with a number of shards (see 'init').  Its 'adjustValue' and 'reportValue'
+// then accumulate into the shard of the calling thread instead of the shared
+// current stats, and the shards are folded into the current stats by
+// 'takeSnapshot'.  Each shard is padded so that no two shards share a cache
+// line, whatever the alignment of the shard array, hence threads updating
+// different shards do not contend.
+//
+// The fields of a discrete sharded value are exact.  The value, increments
+// and decrements of a continuous sharded value are exact, but its min and max
+// only account for the values it had at snapshot times.  'setValue' is not
+// supported by a sharded value.
+//
+/// Histograms
+///----------
+// A discrete 'StatValue' can also maintain a histogram of its reported values
+// (see 'enableHistogram'), recorded lock-free into a 'mwcst::Histogram' and
+// collected by 'takeSnapshot' into a cumulative 'mwcst::HistogramSnapshot'
+// kept alongside each snapshot of its history, at every level.  Percentiles
+// of the values reported between two snapshots are then computed from the
+// difference of their histograms (see 'mwcst::StatUtil::rangePercentile').
+// Note that histograms are neither added by 'addSnapshot' nor carried by
+// updates.
+//
 /// Thread Safety
 ///-------------
-// 'adjustValue' and 'setValue' are thread-safe.  All other functions are not.
+// 'adjustValue', 'setValue' and 'reportValue' are thread-safe.  All other
+// functions are not.
+
+#ifndef INCLUDED_MWCST_HISTOGRAM
+#include <mwcst_histogram.h>
+#endif
 
 #ifndef INCLUDED_BSLIM_PRINTER
 #include <bslim_printer.h>
@@ -51,6 +82,10 @@
 #include <bslmf_nestedtraitdeclaration.h>
 #endif
 
+#ifndef INCLUDED_BSLMT_THREADUTIL
+#include <bslmt_threadutil.h>
+#endif
+
 #ifndef INCLUDED_BSLS_ATOMIC
 #include <bsls_atomic.h>
 #endif
@@ -231,13 +266,37 @@ class StatValue {
     typedef StatValue_Value<bsls::AtomicInt64, bsls::Types::Int64>
         AtomicValueStats;
 
+    /// Stats accumulated by the threads updating a sharded value, padded to
+    /// two cache lines so that two shards of an array never share one.
+    struct Shard {
+        AtomicValueStats d_stats;
+
+        char d_padding[128 - sizeof(AtomicValueStats)];
+    };
+
     // DATA
     Type d_type;
 
     AtomicValueStats d_currentStats;
 
+    bsl::vector<Shard> d_shards;
+    // Stats not yet folded into
+    // 'd_currentStats', if this value is
+    // sharded.  The number of shards is
+    // zero or a power of two.
+
     bsl::vector<Snapshot> d_history;  // snapshots
 
+    Histogram d_histogram;
+    // Values reported since the last
+    // snapshot, if this value has a
+    // histogram
+
+    bsl::vector<HistogramSnapshot> d_histogramHistory;
+    // Cumulative histogram of each
+    // snapshot of 'd_history', if this
+    // value has a histogram, or empty
+
     bsl::vector<int> d_levelStartIndices;
     // i'th value is the first index
     // in 'd_history' for the i'th
@@ -254,13 +313,49 @@ class StatValue {
 
     bsls::Types::Int64 d_max;  // max value since creation
 
+    // PRIVATE CLASS METHODS
+
+    /// Update the min and max of the specified `stats` with the specified
+    /// `value`.
+    static void updateMinMax(AtomicValueStats*  stats,
+                             bsls::Types::Int64 value);
+
     // PRIVATE MANIPULATORS
-    void updateMinMax(bsls::Types::Int64 value);
+
+    /// Return the shard of the calling thread.  The behavior is undefined
+    /// unless this value is sharded.
+    AtomicValueStats& shard();
+
+    /// Fold the stats accumulated in the shards, if any, into the current
+    /// stats.
+    void foldShards();
+
+    /// Reset the stats of the shards, if any.
+    void resetShards();
 
     /// Aggregate the specified aggregation `level` if there is an
     /// aggregation level above it using the specified `snapshotTime`
     void aggregateLevel(int level, bsls::Types::Int64 snapshotTime);
 
+    /// Append to the first level of the history a snapshot having the
+    /// specified `value`, `min`, `max`, `incrementsOrEvents`,
+    /// `decrementsOrSum` and `snapshotTime`, and aggregate the levels above
+    /// if needed.  If the specified `collectHistogram` is `true`, collect
+    /// the values recorded by the histogram, if any, into the new snapshot.
+    void pushSnapshot(bsls::Types::Int64 value,
+                      bsls::Types::Int64 min,
+                      bsls::Types::Int64 max,
+                      bsls::Types::Int64 incrementsOrEvents,
+                      bsls::Types::Int64 decrementsOrSum,
+                      bsls::Types::Int64 snapshotTime,
+                      bool               collectHistogram);
+
+    // PRIVATE ACCESSORS
+
+    /// Return the index in `d_history` of the snapshot referred to by the
+    /// specified `location`.
+    int historyIndex(const SnapshotLocation& location) const;
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(StatValue, bslma::UsesBslmaAllocator)
@@ -281,7 +376,8 @@ class StatValue {
     void adjustValue(bsls::Types::Int64 delta);
 
     /// Set the value of this StatValue to the specified `value`.  The
-    /// behavior is undefined unless this is a continuous StatValue.
+    /// behavior is undefined unless this is a continuous StatValue which is
+    /// not sharded.
     void setValue(bsls::Types::Int64 value);
 
     /// Report the specified `value` to this StatValue.  The behavior is
@@ -299,6 +395,14 @@ class StatValue {
 
     void takeSnapshot(bsls::Types::Int64 snapshotTime);
 
+    /// Take a snapshot at the specified `snapshotTime`, equivalent to
+    /// `takeSnapshot` but without reading the current stats, which are
+    /// assumed not to have been modified since the last snapshot.  This is
+    /// cheaper than `takeSnapshot`, as it touches no atomic variable.  Note
+    /// that an update made concurrently with this call is not lost, but
+    /// only reflected by the next `takeSnapshot`.
+    void takeUnchangedSnapshot(bsls::Types::Int64 snapshotTime);
+
     /// Clear all history and reset all snapshot's snapshotTime with the
     /// specified `clearTime`
     void clear(bsls::Types::Int64 clearTime);
@@ -308,11 +412,14 @@ class StatValue {
 
     /// (Re)initialize this StatValue to be of the specified `type` with
     /// the specified history `sizes` using the specified `initTime` to
-    /// initialize each snapshot's `snapshotTime`.  The current state is
-    /// lost.
+    /// initialize each snapshot's `snapshotTime`.  Optionally specify a
+    /// `numShards` over which the updates of this StatValue are sharded,
+    /// rounded up to a power of two; if `numShards` is 0 or unspecified,
+    /// updates are not sharded.  The current state is lost.
     void init(const bsl::vector<int>& sizes,
               Type                    type,
-              bsls::Types::Int64      initTime);
+              bsls::Types::Int64      initTime,
+              int                     numShards = 0);
 
     /// Sync this StatValue's snapshot schedule with that of the specified
     /// `other` StatValue.  This means that all level 1 and above snapshots
@@ -323,6 +430,12 @@ class StatValue {
     /// structure.
     void syncSnapshotSchedule(const StatValue& other);
 
+    /// Maintain a histogram of the values reported to this StatValue, from
+    /// which percentiles can be computed (see `histogram`).  The histogram
+    /// is removed by `init`.  The behavior is undefined unless this is a
+    /// discrete StatValue.
+    void enableHistogram();
+
     // ACCESSORS
 
     /// Return the type of this StatValue.
@@ -348,6 +461,21 @@ class StatValue {
     /// Return the maximum value of this StatValue since creation.
     bsls::Types::Int64 max() const;
 
+    /// Return the number of shards over which the updates of this StatValue
+    /// are sharded, or 0 if they are not sharded.
+    int numShards() const;
+
+    /// Return `true` if this StatValue maintains a histogram of its reported
+    /// values, and `false` otherwise.
+    bool hasHistogram() const;
+
+    /// Return the cumulative histogram of the values reported to this
+    /// StatValue, as of the snapshot referred to by the specified
+    /// `location`.  The behavior is undefined unless `hasHistogram()`,
+    /// `location.level() < numLevels()` and
+    /// `location.index() <= historySize(location.level())`.
+    const HistogramSnapshot& histogram(const SnapshotLocation& location) const;
+
     /// Format this object to the specified output `stream` at the (absolute
     /// value of) the optionally specified indentation `level` and return a
     /// reference to `stream`.  If `level` is specified, optionally specify
@@ -610,30 +738,56 @@ StatValue_SnapshotLocation::print(bsl::ostream& stream,
 // class StatValue
 // ---------------
 
-// PRIVATE MANIPULATORS
-inline void StatValue::updateMinMax(bsls::Types::Int64 value)
+// PRIVATE CLASS METHODS
+inline void StatValue::updateMinMax(AtomicValueStats*  stats,
+                                    bsls::Types::Int64 value)
 {
-    bsls::Types::Int64 min = d_currentStats.d_min;
+    bsls::Types::Int64 min = stats->d_min;
     while (min > value) {
-        d_currentStats.d_min.testAndSwap(min, value);
-        min = d_currentStats.d_min;
+        stats->d_min.testAndSwap(min, value);
+        min = stats->d_min;
     }
 
-    bsls::Types::Int64 max = d_currentStats.d_max;
+    bsls::Types::Int64 max = stats->d_max;
     while (max < value) {
-        d_currentStats.d_max.testAndSwap(max, value);
-        max = d_currentStats.d_max;
+        stats->d_max.testAndSwap(max, value);
+        max = stats->d_max;
     }
 }
 
+// PRIVATE MANIPULATORS
+inline StatValue::AtomicValueStats& StatValue::shard()
+{
+    // Thread identifiers are typically aligned addresses: mix all their bits
+    // before picking a shard.
+    const bsls::Types::Uint64 id = bslmt::ThreadUtil::selfIdAsUint64() *
+                                   0x9E3779B97F4A7C15ULL;
+
+    return d_shards[static_cast<size_t>(id >> 32) & (d_shards.size() - 1)]
+        .d_stats;
+}
+
 // MANIPULATORS
 inline void StatValue::adjustValue(bsls::Types::Int64 delta)
 {
     BSLS_ASSERT(d_type == DMCST_CONTINUOUS);
 
+    if (!d_shards.empty()) {
+        AtomicValueStats& stats = shard();
+
+        stats.d_value += delta;
+        if (delta > 0) {
+            stats.d_incrementsOrEvents++;
+        }
+        else if (delta < 0) {
+            stats.d_decrementsOrSum++;
+        }
+        return;  // RETURN
+    }
+
     bsls::Types::Int64 newValue = (d_currentStats.d_value += delta);
 
-    updateMinMax(newValue);
+    updateMinMax(&d_currentStats, newValue);
 
     if (delta > 0) {
         d_currentStats.d_incrementsOrEvents++;
@@ -646,9 +800,10 @@ inline void StatValue::adjustValue(bsls::Types::Int64 delta)
 inline void StatValue::setValue(bsls::Types::Int64 value)
 {
     BSLS_ASSERT(d_type == DMCST_CONTINUOUS);
+    BSLS_ASSERT(d_shards.empty());
 
     bsls::Types::Int64 oldValue = d_currentStats.d_value.swap(value);
-    updateMinMax(value);
+    updateMinMax(&d_currentStats, value);
 
     if (value > oldValue) {
         d_currentStats.d_incrementsOrEvents++;
@@ -662,15 +817,38 @@ inline void StatValue::reportValue(bsls::Types::Int64 value)
 {
     BSLS_ASSERT(d_type == DMCST_DISCRETE);
 
-    d_currentStats.d_decrementsOrSum += value;
-    d_currentStats.d_incrementsOrEvents++;
+    AtomicValueStats& stats = d_shards.empty() ? d_currentStats : shard();
+
+    stats.d_decrementsOrSum += value;
+    stats.d_incrementsOrEvents++;
+
+    updateMinMax(&stats, value);
 
-    updateMinMax(value);
+    if (d_histogram.isEnabled()) {
+        d_histogram.record(value);
+    }
 }
 
 inline void StatValue::clearCurrentStats()
 {
     d_currentStats.reset(d_type == DMCST_DISCRETE, 0);
+    resetShards();
+}
+
+// PRIVATE ACCESSORS
+inline int StatValue::historyIndex(const SnapshotLocation& location) const
+{
+    BSLS_ASSERT(location.level() < numLevels());
+    BSLS_ASSERT(location.index() < historySize(location.level()));
+
+    int snapshotIndex = d_curSnapshotIndices[location.level()];
+
+    int index = snapshotIndex - location.index();
+    if (index < 0) {
+        index += historySize(location.level());
+    }
+
+    return index + d_levelStartIndices[location.level()];
 }
 
 // ACCESSORS
@@ -696,17 +874,7 @@ inline int StatValue::historySize(int aggregationlevel) const
 inline const StatValue::Snapshot&
 StatValue::snapshot(const SnapshotLocation& location) const
 {
-    BSLS_ASSERT(location.level() < numLevels());
-    BSLS_ASSERT(location.index() < historySize(location.level()));
-
-    int snapshotIndex = d_curSnapshotIndices[location.level()];
-
-    int historyIndex = snapshotIndex - location.index();
-    if (historyIndex < 0) {
-        historyIndex += historySize(location.level());
-    }
-
-    return d_history[historyIndex + d_levelStartIndices[location.level()]];
+    return d_history[historyIndex(location)];
 }
 
 inline bsls::Types::Int64 StatValue::min() const
@@ -719,6 +887,24 @@ inline bsls::Types::Int64 StatValue::max() const
     return d_max;
 }
 
+inline int StatValue::numShards() const
+{
+    return static_cast<int>(d_shards.size());
+}
+
+inline bool StatValue::hasHistogram() const
+{
+    return d_histogram.isEnabled();
+}
+
+inline const HistogramSnapshot&
+StatValue::histogram(const SnapshotLocation& location) const
+{
+    BSLS_ASSERT(hasHistogram());
+
+    return d_histogramHistory[historyIndex(location)];
+}
+
 // --------------------
 // struct StatValueUtil
 // --------------------
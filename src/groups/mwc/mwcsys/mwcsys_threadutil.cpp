@@ -22,6 +22,7 @@
 
 // BDE
 #include <ball_log.h>
+#include <bsl_cerrno.h>
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
 #include <bsl_ostream.h>
@@ -32,6 +33,7 @@
 
 // Linux
 #if defined(BSLS_PLATFORM_OS_LINUX)
+#include <sched.h>
 #include <sys/prctl.h>
 #endif
 
@@ -63,7 +65,8 @@ bslmt::ThreadAttributes ThreadUtil::defaultAttributes()
 // -----
 #if defined(BSLS_PLATFORM_OS_LINUX)
 
-const bool ThreadUtil::k_SUPPORT_THREAD_NAME = true;
+const bool ThreadUtil::k_SUPPORT_THREAD_NAME  = true;
+const bool ThreadUtil::k_SUPPORT_CPU_AFFINITY = true;
 
 void ThreadUtil::setCurrentThreadName(const bsl::string& value)
 {
@@ -95,11 +98,49 @@ void ThreadUtil::setCurrentThreadNameOnce(const bsl::string& value)
     }
 }
 
+int ThreadUtil::setCurrentThreadCpuAffinity(const bsl::vector<int>& cpus)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS     = 0,
+        rc_EMPTY_SET   = -1,
+        rc_INVALID_CPU = -2,
+        rc_SYSCALL     = -3
+    };
+
+    if (cpus.empty()) {
+        return rc_EMPTY_SET;  // RETURN
+    }
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (bsl::vector<int>::const_iterator it = cpus.begin(); it != cpus.end();
+         ++it) {
+        if (*it < 0 || *it >= CPU_SETSIZE) {
+            return rc_INVALID_CPU;  // RETURN
+        }
+        CPU_SET(*it, &cpuSet);
+    }
+
+    // A 'pid' of 0 refers to the calling thread.
+    const int rc = sched_setaffinity(0, sizeof(cpuSet), &cpuSet);
+    if (rc != 0) {
+        BALL_LOG_SET_CATEGORY(k_LOG_CATEGORY);
+        BALL_LOG_ERROR << "Failed to set thread CPU affinity "
+                       << "[rc: " << rc << ", errno: " << errno
+                       << ", strerr: '" << bsl::strerror(errno) << "']";
+        return rc_SYSCALL;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
 // UNSUPPORTED_PLATFORMS
 // ---------------------
 #else
 
-const bool ThreadUtil::k_SUPPORT_THREAD_NAME = false;
+const bool ThreadUtil::k_SUPPORT_THREAD_NAME  = false;
+const bool ThreadUtil::k_SUPPORT_CPU_AFFINITY = false;
 
 void ThreadUtil::setCurrentThreadName(
     BSLS_ANNOTATION_UNUSED const bsl::string& value)
@@ -115,6 +156,13 @@ void ThreadUtil::setCurrentThreadNameOnce(
     // NOT AVAILABLE
 }
 
+int ThreadUtil::setCurrentThreadCpuAffinity(
+    BSLS_ANNOTATION_UNUSED const bsl::vector<int>& cpus)
+{
+    // NOT AVAILABLE
+    return -1;
+}
+
 #endif
 
 }  // close package namespace
@@ -23,7 +23,8 @@
 //  mwcsys::ThreadUtil: utilities related to thread management.
 //
 //@DESCRIPTION: 'mwcsys::ThreadUtil' provide a utility namespace for operations
-// related to thread management, such as naming threads.  Each operation may be
+// related to thread management, such as naming threads or pinning them to a
+// set of CPUs.  Each operation may be
 // platform specific, please refer to the associated function documentation for
 // individual support explanation.
 //
@@ -38,6 +39,7 @@
 
 // BDE
 #include <bsl_string.h>
+#include <bsl_vector.h>
 #include <bslmt_threadattributes.h>
 
 namespace BloombergLP {
@@ -55,6 +57,10 @@ struct ThreadUtil {
     /// naming thread.
     static const bool k_SUPPORT_THREAD_NAME;
 
+    /// Boolean constant indicating whether the current platform supports
+    /// setting the CPU affinity of a thread.
+    static const bool k_SUPPORT_CPU_AFFINITY;
+
     // CLASS METHODS
 
     /// Return `bslmt::ThreadAttributes` object pre-initialized with default
@@ -78,6 +84,16 @@ struct ThreadUtil {
     ///   - this functionality is only supported on LINUX, and the name can
     ///     be up to 15 characters.
     static void setCurrentThreadNameOnce(const bsl::string& value);
+
+    /// Restrict the current thread to only run on the CPUs having their
+    /// index in the specified `cpus`.  Return 0 on success, or a non-zero
+    /// value if the affinity could not be set (for example because `cpus`
+    /// is empty, or contains an invalid CPU index).  This method is a no-op
+    /// returning a non-zero value if `k_SUPPORT_CPU_AFFINITY` is false.
+    ///
+    /// PLATFORM NOTE:
+    ///   - this functionality is only supported on LINUX.
+    static int setCurrentThreadCpuAffinity(const bsl::vector<int>& cpus);
 };
 
 }  // close package namespace
@@ -0,0 +1,376 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwctsk_asyncobserver.cpp                                           -*-C++-*-
+#include <mwctsk_asyncobserver.h>
+
+#include <mwcscm_version.h>
+// MWC
+#include <mwcsys_threadutil.h>
+
+// BDE
+#include <ball_recordattributes.h>
+#include <bdlb_hashutil.h>
+#include <bdlf_memfn.h>
+#include <bdlt_timeunitratio.h>
+#include <bsl_cstring.h>
+#include <bsl_map.h>
+#include <bsl_ostream.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_systemclocktype.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
+
+namespace BloombergLP {
+namespace mwctsk {
+
+namespace {
+
+/// Name, in the stats, of the categories not fitting in the slots.
+const char k_OTHER_CATEGORIES[] = "(other)";
+
+}  // close unnamed namespace
+
+// -------------------
+// class AsyncObserver
+// -------------------
+
+// PRIVATE MANIPULATORS
+void AsyncObserver::publishThread()
+{
+    // EXECUTED BY THE *PUBLISHING* THREAD
+
+    Item item;
+    while (true) {
+        if (d_queue.tryPopFront(&item) != 0) {
+            waitForRecord();
+            reportDiscarded();
+            continue;  // CONTINUE
+        }
+
+        if (!item.d_record) {
+            // Stop signal
+            break;  // BREAK
+        }
+
+        d_observer_p->publish(item.d_record, item.d_context);
+        item.d_record.reset();
+
+        reportDiscarded();
+    }
+}
+
+void AsyncObserver::waitForRecord()
+{
+    // EXECUTED BY THE *PUBLISHING* THREAD
+
+    // Publishers post the semaphore if they see this thread idle after
+    // enqueuing a record, hence the queue is checked again after flagging
+    // this thread as idle.  Waiting at most one second lets records
+    // discarded while no record is enqueued be reported.
+    d_isIdle = true;
+    if (d_queue.length() == 0) {
+        d_wakeUpSemaphore.timedWait(
+            bsls::SystemTime::nowMonotonicClock().addSeconds(1));
+    }
+    d_isIdle = false;
+}
+
+void AsyncObserver::reportDiscarded()
+{
+    // EXECUTED BY THE *PUBLISHING* THREAD
+
+    const bsls::Types::Int64 numDropped     = d_numDropped.loadRelaxed();
+    const bsls::Types::Int64 numRateLimited = d_numRateLimited.loadRelaxed();
+    const bsls::Types::Int64 numDiscarded   = numDropped + numRateLimited;
+    if (numDiscarded == d_numReportedDiscarded) {
+        return;  // RETURN
+    }
+
+    const bsls::Types::Int64 now = bsls::TimeUtil::getTimer();
+    if (now - d_lastReportTime < bdlt::TimeUnitRatio::k_NS_PER_S) {
+        return;  // RETURN
+    }
+
+    BALL_LOG_WARN << "Discarded " << (numDiscarded - d_numReportedDiscarded)
+                  << " log records since the last report [total dropped: "
+                  << numDropped << ", total rate limited: " << numRateLimited
+                  << "]";
+
+    d_lastReportTime       = now;
+    d_numReportedDiscarded = numDiscarded;
+}
+
+AsyncObserver::CategoryStats* AsyncObserver::categoryStats(const char* name)
+{
+    const int          length = static_cast<int>(bsl::strlen(name));
+    const unsigned int index  = bdlb::HashUtil::hash1(name, length) %
+                               (k_MAX_CATEGORIES - 1);
+
+    // Open addressing over all the slots but the last one.
+    for (int i = 0; i < k_MAX_CATEGORIES - 1; ++i) {
+        CategoryStats& stats = d_categories[(index + i) %
+                                            (k_MAX_CATEGORIES - 1)];
+
+        const char* slotName = stats.d_name.loadAcquire();
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(slotName == 0)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            // First record of the category: claim this slot, unless another
+            // thread claimed it concurrently.
+            char* copy = static_cast<char*>(
+                d_allocator_p->allocate(length + 1));
+            bsl::memcpy(copy, name, length + 1);
+
+            slotName = stats.d_name.testAndSwap(0, copy);
+            if (slotName == 0) {
+                return &stats;  // RETURN
+            }
+            d_allocator_p->deallocate(copy);
+        }
+
+        if (bsl::strcmp(slotName, name) == 0) {
+            return &stats;  // RETURN
+        }
+    }
+
+    return &d_categories[k_MAX_CATEGORIES - 1];
+}
+
+AsyncObserver::CategoryStats* AsyncObserver::admit(const ball::Record& record)
+{
+    if (record.fixedFields().severity() > d_severityThreshold.loadRelaxed()) {
+        return 0;  // RETURN
+    }
+
+    CategoryStats* stats = categoryStats(record.fixedFields().category());
+
+    const int limit = d_rateLimit.loadRelaxed();
+    if (limit == 0) {
+        return stats;  // RETURN
+    }
+
+    // The thread observing the end of the window starts the next one.
+    const bsls::Types::Int64 now         = bsls::TimeUtil::getTimer();
+    const bsls::Types::Int64 windowStart = stats->d_windowStart.loadRelaxed();
+    if (now - windowStart >= bdlt::TimeUnitRatio::k_NS_PER_S &&
+        stats->d_windowStart.testAndSwap(windowStart, now) == windowStart) {
+        stats->d_windowCount.storeRelaxed(0);
+    }
+
+    if (stats->d_windowCount.addRelaxed(1) > limit) {
+        d_numRateLimited.addRelaxed(1);
+        stats->d_numRateLimited.addRelaxed(1);
+        return 0;  // RETURN
+    }
+
+    return stats;
+}
+
+void AsyncObserver::enqueue(const bsl::shared_ptr<const ball::Record>& record,
+                            const ball::Context&                       context,
+                            CategoryStats*                             stats)
+{
+    // Announce this thread as enqueuing before checking whether this object
+    // is started, so that 'stop', which clears the flag before waiting for
+    // the enqueuing threads, enqueues the stop signal after this record.
+    ++d_numEnqueuing;
+    if (!d_isStarted) {
+        --d_numEnqueuing;
+        d_observer_p->publish(record, context);
+        return;  // RETURN
+    }
+
+    Item item;
+    item.d_record  = record;
+    item.d_context = context;
+    const int rc   = d_queue.tryPushBack(item);
+    --d_numEnqueuing;
+
+    if (rc != 0) {
+        d_numDropped.addRelaxed(1);
+        stats->d_numDropped.addRelaxed(1);
+        return;  // RETURN
+    }
+
+    if (d_isIdle && d_isIdle.testAndSwap(true, false)) {
+        d_wakeUpSemaphore.post();
+    }
+}
+
+// CREATORS
+AsyncObserver::AsyncObserver(ball::Observer*   observer,
+                             int               maxQueueLength,
+                             bslma::Allocator* allocator)
+: d_allocator_p(allocator)
+, d_observer_p(observer)
+, d_queue(maxQueueLength, allocator)
+, d_threadHandle(bslmt::ThreadUtil::invalidHandle())
+, d_isStarted(false)
+, d_numEnqueuing(0)
+, d_severityThreshold(ball::Severity::TRACE)
+, d_rateLimit(0)
+, d_numDropped(0)
+, d_numRateLimited(0)
+, d_isIdle(false)
+, d_wakeUpSemaphore(bsls::SystemClockType::e_MONOTONIC)
+, d_lastReportTime(0)
+, d_numReportedDiscarded(0)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(observer);
+    BSLS_ASSERT_SAFE(maxQueueLength > 0);
+
+    d_categories[k_MAX_CATEGORIES - 1].d_name = k_OTHER_CATEGORIES;
+}
+
+AsyncObserver::~AsyncObserver()
+{
+    stop();
+
+    // The name of the last slot is not allocated.
+    for (int i = 0; i < k_MAX_CATEGORIES - 1; ++i) {
+        const char* name = d_categories[i].d_name.loadRelaxed();
+        if (name) {
+            d_allocator_p->deallocate(const_cast<char*>(name));
+        }
+    }
+}
+
+// MANIPULATORS
+int AsyncObserver::start()
+{
+    if (d_isStarted) {
+        return 0;  // RETURN
+    }
+
+    bslmt::ThreadAttributes attr = mwcsys::ThreadUtil::defaultAttributes();
+    attr.setThreadName("mwcAsyncLog");
+
+    const int rc = bslmt::ThreadUtil::createWithAllocator(
+        &d_threadHandle,
+        attr,
+        bdlf::MemFnUtil::memFn(&AsyncObserver::publishThread, this),
+        d_allocator_p);
+    if (rc != 0) {
+        return rc;  // RETURN
+    }
+
+    d_isStarted = true;
+    return 0;
+}
+
+void AsyncObserver::stop()
+{
+    if (!d_isStarted) {
+        return;  // RETURN
+    }
+
+    // Records published from now on are forwarded synchronously, and the
+    // stop signal is enqueued after the records still in the queue, and
+    // after the ones being enqueued, so that they get published before the
+    // thread exits.
+    d_isStarted = false;
+    while (d_numEnqueuing.load() != 0) {
+        bslmt::ThreadUtil::yield();
+    }
+    d_queue.pushBack(Item());
+    d_wakeUpSemaphore.post();
+
+    bslmt::ThreadUtil::join(d_threadHandle);
+    d_threadHandle = bslmt::ThreadUtil::invalidHandle();
+}
+
+void AsyncObserver::publish(const bsl::shared_ptr<const ball::Record>& record,
+                            const ball::Context& context)
+{
+    CategoryStats* stats = admit(*record);
+    if (!stats) {
+        return;  // RETURN
+    }
+
+    enqueue(record, context, stats);
+}
+
+void AsyncObserver::publish(const ball::Record&  record,
+                            const ball::Context& context)
+{
+    // Only copy the records that are not discarded by the severity threshold
+    // or by the rate limit.
+    CategoryStats* stats = admit(record);
+    if (!stats) {
+        return;  // RETURN
+    }
+
+    enqueue(bsl::allocate_shared<ball::Record>(d_allocator_p, record),
+            context,
+            stats);
+}
+
+void AsyncObserver::releaseRecords()
+{
+    Item item;
+    while (d_queue.tryPopFront(&item) == 0) {
+        if (!item.d_record) {
+            // Don't discard the stop signal
+            d_queue.pushBack(item);
+            break;  // BREAK
+        }
+    }
+}
+
+// ACCESSORS
+void AsyncObserver::printStats(bsl::ostream& stream, const char* indent) const
+{
+    stream << indent << "QueueLength.............: " << queueLength() << "\n"
+           << indent << "RateLimit...............: " << rateLimit() << "\n"
+           << indent << "Dropped.................: " << numDropped() << "\n"
+           << indent << "RateLimited.............: " << numRateLimited()
+           << "\n";
+
+    // Only the categories having discarded records are printed, ordered by
+    // name.
+    typedef bsl::pair<bsls::Types::Int64, bsls::Types::Int64> Counts;
+    typedef bsl::map<bsl::string, Counts>                     CountsMap;
+
+    CountsMap counts(d_allocator_p);
+    for (int i = 0; i < k_MAX_CATEGORIES; ++i) {
+        const CategoryStats&     stats = d_categories[i];
+        const char*              name  = stats.d_name.loadAcquire();
+        const bsls::Types::Int64 numDropped = stats.d_numDropped.loadRelaxed();
+        const bsls::Types::Int64 numRateLimited =
+            stats.d_numRateLimited.loadRelaxed();
+        if (!name || (numDropped == 0 && numRateLimited == 0)) {
+            continue;  // CONTINUE
+        }
+
+        counts.insert(bsl::make_pair(bsl::string(name, d_allocator_p),
+                                     Counts(numDropped, numRateLimited)));
+    }
+
+    for (CountsMap::const_iterator it = counts.begin(); it != counts.end();
+         ++it) {
+        stream << indent << "  " << (it->first.empty() ? "*" : it->first)
+               << ": dropped " << it->second.first << ", rate limited "
+               << it->second.second << "\n";
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
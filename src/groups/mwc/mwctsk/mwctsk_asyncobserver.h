@@ -0,0 +1,398 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwctsk_asyncobserver.h                                             -*-C++-*-
+#ifndef INCLUDED_MWCTSK_ASYNCOBSERVER
+#define INCLUDED_MWCTSK_ASYNCOBSERVER
+
+//@PURPOSE: Provide a non-blocking BALL observer publishing from a thread.
+//
+//@CLASSES:
+//  mwctsk::AsyncObserver: non-blocking observer forwarding to another one
+//
+//@DESCRIPTION: 'mwctsk::AsyncObserver' is a concrete implementation of the
+// 'ball::Observer' protocol which forwards the records published to it to
+// another observer (e.g., an 'mwctsk::ConsoleObserver', or a
+// 'ball::MultiplexObserver' of several observers), from a dedicated thread.
+// Publishing a record only enqueues a shared pointer to it in a fixed-size
+// lock-free queue, so that the formatting of the record and the I/O of the
+// downstream observer happen off the thread which logged it.
+//
+// Publishing never blocks: if the queue is full, the record is dropped.
+// Additionally, a maximum number of records per second can be published
+// downstream for each category (see 'setRateLimit'); records exceeding that
+// rate are discarded by the logging thread before being enqueued.  The
+// number of records dropped and rate limited is kept per category, and can be
+// printed with 'printStats'; the publishing thread also logs a warning, at
+// most once per second, when records were discarded, even if no record
+// follows them.
+//
+// The rate limiting state and the counters of a category are kept in one of
+// 256 fixed slots made of atomic variables, so that discarding a record
+// neither allocates memory nor acquires a lock.  The first record of a
+// category claims a slot for it, which allocates a copy of the name of the
+// category; the categories not fitting in the slots share the last one.  Note
+// that the rate limit is approximate when several threads log to the same
+// category concurrently at the beginning of a one second window.
+//
+// Records less severe than the optionally set 'severityThreshold' are ignored
+// without being enqueued: this avoids paying for records which would be
+// discarded by the downstream observer anyway.
+//
+// Records published while the observer is not started are synchronously
+// forwarded to the downstream observer.  'stop' waits for the threads which
+// are enqueuing a record, so that every record enqueued before the observer
+// is stopped is published before 'stop' returns.
+//
+/// Thread-safety
+///-------------
+// This object is *thread* *enabled*, meaning that two threads can safely call
+// any methods on the *same* *instance* without external synchronization,
+// except for 'start' and 'stop' which must not be called concurrently.
+//
+/// Usage Example
+///-------------
+// The following example illustrates how to make a 'ConsoleObserver'
+// asynchronous.  Note that the following code assumes the
+// 'ball::LoggerManager' singleton was initialized with a
+// 'ball::MultiplexObserver'.
+//..
+//  mwctsk::ConsoleObserver consoleObserver(allocator);
+//  consoleObserver.setSeverityThreshold(ball::Severity::INFO);
+//
+//  mwctsk::AsyncObserver asyncObserver(&consoleObserver, 8192, allocator);
+//  asyncObserver.setSeverityThreshold(ball::Severity::INFO);
+//  asyncObserver.start();
+//  multiplexObserver.registerObserver(&asyncObserver);
+//..
+//
+// Before destruction, we must unregister the observer and stop it, which
+// publishes the records still in the queue.
+//..
+//  multiplexObserver.deregisterObserver(&asyncObserver);
+//  asyncObserver.stop();
+//..
+
+// BDE
+#include <ball_context.h>
+#include <ball_log.h>
+#include <ball_observer.h>
+#include <ball_record.h>
+#include <ball_severity.h>
+#include <bdlcc_fixedqueue.h>
+#include <bsl_iosfwd.h>
+#include <bsl_memory.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadutil.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mwctsk {
+
+// ===================
+// class AsyncObserver
+// ===================
+
+/// BALL observer forwarding records to another observer from a dedicated
+/// thread, without ever blocking the logging threads.
+class AsyncObserver : public ball::Observer {
+  private:
+    // CLASS-SCOPE CATEGORY
+    BALL_LOG_SET_CLASS_CATEGORY("MWCTSK.ASYNCOBSERVER");
+
+  private:
+    // PRIVATE TYPES
+
+    /// Item of the queue: a record, and its publishing context.  A null
+    /// record signals the publishing thread to stop.
+    struct Item {
+        // PUBLIC DATA
+        bsl::shared_ptr<const ball::Record> d_record;
+        ball::Context                       d_context;
+    };
+
+    /// Rate limiting state and discarded records counts of a category.
+    struct CategoryStats {
+        // PUBLIC DATA
+        bsls::AtomicPointer<const char> d_name;
+        // Name of the category, or null if this
+        // slot is not claimed yet
+
+        bsls::AtomicInt64 d_windowStart;
+        // Start time, in nanoseconds, of the
+        // current one second window
+
+        bsls::AtomicInt d_windowCount;
+        // Number of records of the category
+        // published in the current window
+
+        bsls::AtomicInt64 d_numDropped;
+        // Number of records dropped because the
+        // queue was full
+
+        bsls::AtomicInt64 d_numRateLimited;
+        // Number of records discarded because of
+        // the rate limit
+    };
+
+    // PRIVATE CONSTANTS
+    enum {
+        k_MAX_CATEGORIES = 256  // Number of slots of the categories, the
+                                // last one being shared by the categories
+                                // not fitting in the others
+    };
+
+    // DATA
+    bslma::Allocator* d_allocator_p;
+    // Allocator to use.
+
+    ball::Observer* d_observer_p;
+    // Observer to forward the records to.
+
+    bdlcc::FixedQueue<Item> d_queue;
+    // Queue of the records to publish.
+
+    bslmt::ThreadUtil::Handle d_threadHandle;
+    // Handle of the publishing thread.
+
+    bsls::AtomicBool d_isStarted;
+    // True if the publishing thread is
+    // running.
+
+    bsls::AtomicInt d_numEnqueuing;
+    // Number of threads which saw this object
+    // started and may be enqueuing a record.
+
+    bsls::AtomicInt d_severityThreshold;
+    // Records less severe than this
+    // threshold are ignored.
+
+    bsls::AtomicInt d_rateLimit;
+    // Maximum number of records per second
+    // published for each category, or 0 if
+    // unlimited.
+
+    bsls::AtomicInt64 d_numDropped;
+    // Total number of records dropped because
+    // the queue was full.
+
+    bsls::AtomicInt64 d_numRateLimited;
+    // Total number of records discarded
+    // because of the rate limit.
+
+    CategoryStats d_categories[k_MAX_CATEGORIES];
+    // Rate limiting state and discarded
+    // records counts, per category.
+
+    bsls::AtomicBool d_isIdle;
+    // True if the publishing thread is
+    // waiting for records.
+
+    bslmt::Semaphore d_wakeUpSemaphore;
+    // Semaphore posted to wake up the idle
+    // publishing thread.
+
+    bsls::Types::Int64 d_lastReportTime;
+    // Time, in nanoseconds, at which the
+    // publishing thread last reported
+    // discarded records, only accessed by the
+    // publishing thread.
+
+    bsls::Types::Int64 d_numReportedDiscarded;
+    // Total number of discarded records at the
+    // last report, only accessed by the
+    // publishing thread.
+
+  private:
+    // NOT IMPLEMENTED
+    AsyncObserver(const AsyncObserver&) BSLS_KEYWORD_DELETED;
+    AsyncObserver& operator=(const AsyncObserver&) BSLS_KEYWORD_DELETED;
+
+    // PRIVATE MANIPULATORS
+
+    /// Entry point of the publishing thread.
+    void publishThread();
+
+    /// Wait until a record is enqueued, or until the next report of the
+    /// discarded records is due.  This must only be called from the
+    /// publishing thread.
+    void waitForRecord();
+
+    /// Log a warning if records were discarded since the last report, and
+    /// at least one second elapsed since then.  This must only be called
+    /// from the publishing thread.
+    void reportDiscarded();
+
+    /// Return the stats of the category having the specified `name`,
+    /// claiming a slot for it if it does not have one yet.
+    CategoryStats* categoryStats(const char* name);
+
+    /// Return the stats of the category of the specified `record`, or 0 if
+    /// `record` is to be ignored, because it is less severe than the
+    /// severity threshold, or discarded, because it exceeds the rate limit
+    /// of its category.
+    CategoryStats* admit(const ball::Record& record);
+
+    /// Forward the specified `record`, having the specified `context`, or
+    /// enqueue it if this object is started, accounting for it in the
+    /// specified `stats` if it is dropped.
+    void enqueue(const bsl::shared_ptr<const ball::Record>& record,
+                 const ball::Context&                       context,
+                 CategoryStats*                             stats);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(AsyncObserver, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an `AsyncObserver` forwarding the records published to it to
+    /// the specified `observer`, and able to hold up to the specified
+    /// `maxQueueLength` records not yet forwarded.  Use the specified
+    /// `allocator` to supply memory.  The behavior is undefined unless
+    /// `observer` outlives this object.
+    AsyncObserver(ball::Observer*   observer,
+                  int               maxQueueLength,
+                  bslma::Allocator* allocator);
+
+    /// Destroy this object, after stopping it if needed.
+    ~AsyncObserver() BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+
+    /// Start the publishing thread.  Return 0 on success, or a non-zero
+    /// value otherwise.  This has no effect if this object is already
+    /// started.
+    int start();
+
+    /// Publish the records still in the queue, and stop the publishing
+    /// thread.  This has no effect if this object is not started.
+    void stop();
+
+    /// Set the severity threshold to the specified `value`: records less
+    /// severe than `value` are ignored.  Use `ball::Severity::OFF` to
+    /// ignore all records.  Return a reference to this object offering
+    /// modification access.
+    AsyncObserver& setSeverityThreshold(ball::Severity::Level value);
+
+    /// Set the maximum number of records per second forwarded for each
+    /// category to the specified `value`, or disable rate limiting if
+    /// `value` is 0.  Return a reference to this object offering
+    /// modification access.  The behavior is undefined unless `value` is
+    /// non-negative.
+    AsyncObserver& setRateLimit(int value);
+
+    // MANIPULATORS
+    //   (virtual: ball::Observer)
+
+    /// Enqueue the specified `record`, having the specified `context`, to
+    /// be forwarded from the publishing thread, or drop it if the queue is
+    /// full.  If this object is not started, forward `record` immediately.
+    /// In both cases, discard `record` if it exceeds the rate limit of its
+    /// category.
+    void publish(const bsl::shared_ptr<const ball::Record>& record,
+                 const ball::Context& context) BSLS_KEYWORD_OVERRIDE;
+
+    /// Enqueue a copy of the specified `record`, having the specified
+    /// `context`.  Note that no copy is made if `record` is ignored or
+    /// discarded.
+    void publish(const ball::Record&  record,
+                 const ball::Context& context) BSLS_KEYWORD_OVERRIDE;
+
+    /// Discard the records not yet forwarded.
+    void releaseRecords() BSLS_KEYWORD_OVERRIDE;
+
+    // ACCESSORS
+
+    /// Return the currently set severity threshold of this object.
+    ball::Severity::Level severityThreshold() const;
+
+    /// Return the maximum number of records per second forwarded for each
+    /// category, or 0 if rate limiting is disabled.
+    int rateLimit() const;
+
+    /// Return the number of records in the queue.
+    int queueLength() const;
+
+    /// Return the total number of records dropped because the queue was
+    /// full.
+    bsls::Types::Int64 numDropped() const;
+
+    /// Return the total number of records discarded because of the rate
+    /// limit.
+    bsls::Types::Int64 numRateLimited() const;
+
+    /// Print to the specified `stream`, with the specified `indent`, the
+    /// length of the queue and the number of dropped and rate limited
+    /// records, in total and per category.
+    void printStats(bsl::ostream& stream, const char* indent = "") const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// -------------------
+// class AsyncObserver
+// -------------------
+
+inline AsyncObserver&
+AsyncObserver::setSeverityThreshold(ball::Severity::Level value)
+{
+    d_severityThreshold = value;
+    return *this;
+}
+
+inline AsyncObserver& AsyncObserver::setRateLimit(int value)
+{
+    d_rateLimit = value;
+    return *this;
+}
+
+inline ball::Severity::Level AsyncObserver::severityThreshold() const
+{
+    return static_cast<ball::Severity::Level>(
+        d_severityThreshold.loadRelaxed());
+}
+
+inline int AsyncObserver::rateLimit() const
+{
+    return d_rateLimit.loadRelaxed();
+}
+
+inline int AsyncObserver::queueLength() const
+{
+    return d_queue.length();
+}
+
+inline bsls::Types::Int64 AsyncObserver::numDropped() const
+{
+    return d_numDropped.loadRelaxed();
+}
+
+inline bsls::Types::Int64 AsyncObserver::numRateLimited() const
+{
+    return d_numRateLimited.loadRelaxed();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,448 @@
+// Copyright 2024 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mwctsk_asyncobserver.t.cpp                                         -*-C++-*-
+#include <mwctsk_asyncobserver.h>
+
+// MWC
+#include <mwcu_memoutstream.h>
+
+// BDE
+#include <ball_context.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <bdlf_bind.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadgroup.h>
+#include <bsls_annotation.h>
+
+// TEST DRIVER
+#include <mwctst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Observer keeping the categories of the records published to it, and
+/// blocking the publication of the records of the `BLOCK` category until
+/// `resume` is called.
+class TestObserver : public ball::Observer {
+  private:
+    // DATA
+    mutable bslmt::Mutex d_mutex;
+
+    bsl::vector<bsl::string> d_categories;
+
+    bslmt::Semaphore d_blockedSem;
+
+    bslmt::Semaphore d_resumeSem;
+
+  public:
+    // CREATORS
+    explicit TestObserver(bslma::Allocator* allocator)
+    : d_mutex()
+    , d_categories(allocator)
+    , d_blockedSem()
+    , d_resumeSem()
+    {
+        // NOTHING
+    }
+
+    // MANIPULATORS
+    void publish(const bsl::shared_ptr<const ball::Record>& record,
+                 const ball::Context& context) BSLS_KEYWORD_OVERRIDE
+    {
+        publish(*record, context);
+    }
+
+    void publish(const ball::Record& record,
+                 BSLS_ANNOTATION_UNUSED const ball::Context& context)
+        BSLS_KEYWORD_OVERRIDE
+    {
+        const bsl::string category(record.fixedFields().category(),
+                                   s_allocator_p);
+        if (category == "BLOCK") {
+            d_blockedSem.post();
+            d_resumeSem.wait();
+        }
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+        d_categories.push_back(category);
+    }
+
+    /// Wait until the publication of a record of the `BLOCK` category
+    /// started.
+    void waitBlocked() { d_blockedSem.wait(); }
+
+    /// Resume the publication of a record of the `BLOCK` category.
+    void resume() { d_resumeSem.post(); }
+
+    // ACCESSORS
+
+    /// Return the number of records of the specified `category` published
+    /// to this observer.
+    int numRecords(const bsl::string& category) const
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+        int                            count = 0;
+        for (size_t i = 0; i < d_categories.size(); ++i) {
+            if (d_categories[i] == category) {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    /// Return the categories of the records published to this observer,
+    /// in order.
+    bsl::vector<bsl::string> categories() const
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+        return d_categories;
+    }
+};
+
+/// Return a record of the specified `category` and `severity`.
+bsl::shared_ptr<const ball::Record> makeRecord(const char*           category,
+                                               ball::Severity::Level severity)
+{
+    bsl::shared_ptr<ball::Record> record =
+        bsl::allocate_shared<ball::Record>(s_allocator_p);
+    record->fixedFields().setCategory(category);
+    record->fixedFields().setSeverity(severity);
+    return record;
+}
+
+/// Publish the specified `numRecords` records of the `A` category to the
+/// specified `observer`.
+void publishRecords(mwctsk::AsyncObserver* observer, int numRecords)
+{
+    ball::Context context(s_allocator_p);
+    for (int i = 0; i < numRecords; ++i) {
+        observer->publish(makeRecord("A", ball::Severity::INFO), context);
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   - Records published while the observer is not started are forwarded
+//     synchronously.
+//   - Records less severe than the severity threshold are ignored.
+//
+// Testing:
+//   AsyncObserver(ball::Observer*, int, bslma::Allocator*)
+//   setSeverityThreshold
+//   severityThreshold
+//   publish
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("BREATHING TEST");
+
+    TestObserver          downstream(s_allocator_p);
+    mwctsk::AsyncObserver obj(&downstream, 16, s_allocator_p);
+    ball::Context         context(s_allocator_p);
+
+    ASSERT_EQ(obj.severityThreshold(), ball::Severity::TRACE);
+    ASSERT_EQ(obj.rateLimit(), 0);
+    ASSERT_EQ(obj.queueLength(), 0);
+
+    obj.publish(makeRecord("A", ball::Severity::TRACE), context);
+    ASSERT_EQ(downstream.numRecords("A"), 1);
+
+    obj.setSeverityThreshold(ball::Severity::WARN);
+    ASSERT_EQ(obj.severityThreshold(), ball::Severity::WARN);
+
+    obj.publish(makeRecord("A", ball::Severity::INFO), context);
+    obj.publish(makeRecord("A", ball::Severity::WARN), context);
+    obj.publish(makeRecord("A", ball::Severity::ERROR), context);
+    ASSERT_EQ(downstream.numRecords("A"), 3);
+
+    ASSERT_EQ(obj.numDropped(), 0);
+    ASSERT_EQ(obj.numRateLimited(), 0);
+}
+
+static void test2_startStop()
+// ------------------------------------------------------------------------
+// START STOP
+//
+// Concerns:
+//   - Records published while the observer is started are forwarded, in
+//     order, from the publishing thread.
+//   - 'stop' forwards the records still in the queue.
+//   - The observer can be restarted.
+//
+// Testing:
+//   start
+//   stop
+//   publish
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("START STOP");
+
+    TestObserver          downstream(s_allocator_p);
+    mwctsk::AsyncObserver obj(&downstream, 16, s_allocator_p);
+    ball::Context         context(s_allocator_p);
+
+    for (int i = 0; i < 2; ++i) {
+        ASSERT_EQ(obj.start(), 0);
+
+        // Block the publishing thread so that the records accumulate in the
+        // queue.
+        obj.publish(makeRecord("BLOCK", ball::Severity::INFO), context);
+        downstream.waitBlocked();
+
+        obj.publish(makeRecord("A", ball::Severity::INFO), context);
+        obj.publish(makeRecord("B", ball::Severity::INFO), context);
+        obj.publish(makeRecord("A", ball::Severity::INFO), context);
+        ASSERT_EQ(obj.queueLength(), 3);
+
+        downstream.resume();
+        obj.stop();
+
+        ASSERT_EQ(obj.queueLength(), 0);
+        ASSERT_EQ(downstream.numRecords("A"), 2 * (i + 1));
+        ASSERT_EQ(downstream.numRecords("B"), i + 1);
+    }
+
+    const bsl::vector<bsl::string> categories = downstream.categories();
+    ASSERT_EQ(categories.size(), 8U);
+    ASSERT_EQ(categories[0], "BLOCK");
+    ASSERT_EQ(categories[1], "A");
+    ASSERT_EQ(categories[2], "B");
+    ASSERT_EQ(categories[3], "A");
+
+    ASSERT_EQ(obj.numDropped(), 0);
+}
+
+static void test3_dropWhenFull()
+// ------------------------------------------------------------------------
+// DROP WHEN FULL
+//
+// Concerns:
+//   - Publishing does not block when the queue is full, the record is
+//     dropped instead.
+//   - The dropped records are counted in total and per category.
+//
+// Testing:
+//   publish
+//   numDropped
+//   printStats
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("DROP WHEN FULL");
+
+    const int k_QUEUE_SIZE  = 8;
+    const int k_NUM_RECORDS = 20;
+
+    TestObserver          downstream(s_allocator_p);
+    mwctsk::AsyncObserver obj(&downstream, k_QUEUE_SIZE, s_allocator_p);
+    ball::Context         context(s_allocator_p);
+
+    ASSERT_EQ(obj.start(), 0);
+
+    obj.publish(makeRecord("BLOCK", ball::Severity::INFO), context);
+    downstream.waitBlocked();
+
+    for (int i = 0; i < k_NUM_RECORDS; ++i) {
+        obj.publish(makeRecord("A", ball::Severity::INFO), context);
+    }
+    ASSERT_GT(obj.numDropped(), 0);
+
+    downstream.resume();
+    obj.stop();
+
+    ASSERT_EQ(downstream.numRecords("A") + obj.numDropped(), k_NUM_RECORDS);
+    ASSERT_EQ(obj.numRateLimited(), 0);
+
+    mwcu::MemOutStream os(s_allocator_p);
+    obj.printStats(os);
+    PV(os.str());
+
+    mwcu::MemOutStream expected(s_allocator_p);
+    expected << "A: dropped " << obj.numDropped() << ", rate limited 0";
+    ASSERT_NE(os.str().find(expected.str()), bsl::string::npos);
+}
+
+static void test4_rateLimit()
+// ------------------------------------------------------------------------
+// RATE LIMIT
+//
+// Concerns:
+//   - At most 'rateLimit' records per second are forwarded for each
+//     category, the others are discarded and counted per category.
+//   - Records are rate limited before being enqueued, so that they don't
+//     fill the queue.
+//   - Setting the rate limit to 0 disables rate limiting.
+//
+// Testing:
+//   setRateLimit
+//   rateLimit
+//   numRateLimited
+//   printStats
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("RATE LIMIT");
+
+    TestObserver          downstream(s_allocator_p);
+    mwctsk::AsyncObserver obj(&downstream, 64, s_allocator_p);
+    ball::Context         context(s_allocator_p);
+
+    obj.setRateLimit(3);
+    ASSERT_EQ(obj.rateLimit(), 3);
+    ASSERT_EQ(obj.start(), 0);
+
+    // Assuming the records are all published within one second
+    for (int i = 0; i < 10; ++i) {
+        obj.publish(makeRecord("A", ball::Severity::INFO), context);
+    }
+    obj.publish(makeRecord("B", ball::Severity::INFO), context);
+    obj.publish(makeRecord("B", ball::Severity::INFO), context);
+
+    obj.stop();
+
+    ASSERT_EQ(downstream.numRecords("A"), 3);
+    ASSERT_EQ(downstream.numRecords("B"), 2);
+    ASSERT_EQ(obj.numRateLimited(), 7);
+    ASSERT_EQ(obj.numDropped(), 0);
+
+    mwcu::MemOutStream os(s_allocator_p);
+    obj.printStats(os);
+    PV(os.str());
+
+    ASSERT_NE(os.str().find("A: dropped 0, rate limited 7"),
+              bsl::string::npos);
+    ASSERT_EQ(os.str().find("B: dropped"), bsl::string::npos);
+
+    // Disable rate limiting
+    obj.setRateLimit(0);
+    ASSERT_EQ(obj.start(), 0);
+    for (int i = 0; i < 10; ++i) {
+        obj.publish(makeRecord("A", ball::Severity::INFO), context);
+    }
+    obj.stop();
+
+    ASSERT_EQ(downstream.numRecords("A"), 13);
+    ASSERT_EQ(obj.numRateLimited(), 7);
+
+    // Rate limited records are not enqueued
+    obj.setRateLimit(3);
+    ASSERT_EQ(obj.start(), 0);
+
+    obj.publish(makeRecord("BLOCK", ball::Severity::INFO), context);
+    downstream.waitBlocked();
+
+    for (int i = 0; i < 10; ++i) {
+        obj.publish(makeRecord("C", ball::Severity::INFO), context);
+    }
+    ASSERT_EQ(obj.queueLength(), 3);
+
+    downstream.resume();
+    obj.stop();
+
+    ASSERT_EQ(downstream.numRecords("C"), 3);
+    ASSERT_EQ(obj.numRateLimited(), 14);
+    ASSERT_EQ(obj.numDropped(), 0);
+}
+
+static void test5_stopWhilePublishing()
+// ------------------------------------------------------------------------
+// STOP WHILE PUBLISHING
+//
+// Concerns:
+//   - Every record published concurrently with 'stop' and 'start' is
+//     either forwarded or counted as dropped: no record is left in the
+//     queue behind the stop signal.
+//
+// Testing:
+//   start
+//   stop
+//   publish
+// ------------------------------------------------------------------------
+{
+    mwctst::TestHelper::printTestName("STOP WHILE PUBLISHING");
+
+    const int k_NUM_THREADS = 4;
+    const int k_NUM_RECORDS = 5000;
+
+    TestObserver          downstream(s_allocator_p);
+    mwctsk::AsyncObserver obj(&downstream, 64, s_allocator_p);
+
+    bslmt::ThreadGroup threadGroup(s_allocator_p);
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        ASSERT_EQ(threadGroup.addThread(bdlf::BindUtil::bindS(s_allocator_p,
+                                                              &publishRecords,
+                                                              &obj,
+                                                              k_NUM_RECORDS)),
+                  0);
+    }
+
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(obj.start(), 0);
+        obj.stop();
+        ASSERT_EQ(obj.queueLength(), 0);
+    }
+
+    threadGroup.joinAll();
+    obj.stop();
+
+    ASSERT_EQ(obj.queueLength(), 0);
+    ASSERT_EQ(downstream.numRecords("A") + obj.numDropped(),
+              k_NUM_THREADS * k_NUM_RECORDS);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(mwctst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 5: test5_stopWhilePublishing(); break;
+    case 4: test4_rateLimit(); break;
+    case 3: test3_dropWhenFull(); break;
+    case 2: test2_startStop(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        s_testStatus = -1;
+    } break;
+    }
+
+    // 'e_CHECK_DEF_GBL_ALLOC' check fails because the attributes of the
+    // publishing thread allocate its name with the default allocator.
+    TEST_EPILOG(mwctst::TestHelper::e_CHECK_GBL_ALLOC);
+}
@@ -462,7 +462,9 @@ int LogController::processInfoCommand(BSLS_ANNOTATION_UNUSED bsl::istream& cmd,
        << "    LogFile.................: " << logFile << "\n"
        << "    LogRecordQueueLength....: "
        << d_fileObserver.recordQueueLength() << "\n"
-       << "  Categories:\n";
+       << "  AsyncObserver:\n";
+    d_asyncObserver.printStats(os, "    ");
+    os << "  Categories:\n";
 
     // Iterate over each category to print it's current verbosity
     ball::LoggerManager::singleton().visitCategories(bdlf::BindUtil::bind(
@@ -513,6 +515,7 @@ int LogController::processConsoleCommand(bsl::istream& cmd, bsl::ostream& os)
     }
 
     d_consoleObserver.setSeverityThreshold(level);
+    updateAsyncObserverThreshold(d_config.syslogEnabled());
     os << "Console severity threshold set to '" << level << "'";
 
     // In order for a trace to be printed by the console observer, two
@@ -570,6 +573,46 @@ int LogController::processCategoryCommand(bsl::istream& cmd, bsl::ostream& os)
     return 0;
 }
 
+int LogController::processRateLimitCommand(bsl::istream& cmd,
+                                           bsl::ostream& os)
+{
+    int count;
+    cmd >> count;
+
+    if (cmd.fail()) {
+        os << "Missing or invalid <count> parameter";
+        return -1;  // RETURN
+    }
+
+    if (count < 0) {
+        os << "Invalid count '" << count << "'";
+        return -2;  // RETURN
+    }
+
+    d_asyncObserver.setRateLimit(count);
+    if (count == 0) {
+        os << "Console and syslog rate limiting disabled";
+    }
+    else {
+        os << "Console and syslog rate limit set to " << count
+           << " records per second per category";
+    }
+
+    return 0;
+}
+
+void LogController::updateAsyncObserverThreshold(bool syslogEnabled)
+{
+    // Severity levels are ordered from the most severe (with the lowest
+    // value) to the least severe.
+    ball::Severity::Level threshold = d_consoleObserver.severityThreshold();
+    if (syslogEnabled) {
+        threshold = bsl::max(threshold, d_syslogObserver.severityThreshold());
+    }
+
+    d_asyncObserver.setSeverityThreshold(threshold);
+}
+
 int LogController::tryRegisterObserver(ball::Observer* observer)
 {
     int rc = d_multiplexObserver.registerObserver(observer);
@@ -600,6 +643,10 @@ LogController::LogController(bdlmt::EventScheduler* scheduler,
 , d_alarmLog(allocator)
 , d_consoleObserver(allocator)
 , d_syslogObserver(allocator)
+, d_asyncMultiplexObserver(allocator)
+, d_asyncObserver(&d_asyncMultiplexObserver,
+                  8192,  // maxQueueLength
+                  allocator)
 , d_logCleaner(scheduler, allocator)
 , d_lastLogLinkPath(allocator)
 , d_registeredObservers(allocator)
@@ -631,7 +678,9 @@ int LogController::initialize(bsl::ostream&              errorDescription,
         rc_FILEOBSERVER_REGISTRATION_FAILED    = -5,
         rc_ALARMLOG_REGISTRATION_FAILED        = -6,
         rc_CONSOLEOBSERVER_REGISTRATION_FAILED = -7,
-        rc_SYSLOGOBSERVER_REGISTRATION_FAILED  = -8
+        rc_SYSLOGOBSERVER_REGISTRATION_FAILED  = -8,
+        rc_ASYNCOBSERVER_START_FAILED          = -9,
+        rc_ASYNCOBSERVER_REGISTRATION_FAILED   = -10
     };
 
     if (ball::LoggerManager::isInitialized()) {
@@ -718,7 +767,7 @@ int LogController::initialize(bsl::ostream&              errorDescription,
     d_consoleObserver.setSeverityThreshold(config.consoleSeverityThreshold())
         .setLogFormat(config.consoleFormat());
 
-    rc = tryRegisterObserver(&d_consoleObserver);
+    rc = d_asyncMultiplexObserver.registerObserver(&d_consoleObserver);
     if (rc != 0) {
         errorDescription << "Failed registering ConsoleObserver "
                          << "[rc: " << rc << "]";
@@ -733,7 +782,7 @@ int LogController::initialize(bsl::ostream&              errorDescription,
             .setLogFormat(config.syslogFormat());
         d_syslogObserver.enableLogging(config.syslogAppName());
 
-        rc = tryRegisterObserver(&d_syslogObserver);
+        rc = d_asyncMultiplexObserver.registerObserver(&d_syslogObserver);
         if (rc != 0) {
             errorDescription << "Failed registering SyslogObserver "
                              << "[rc: " << rc << "]";
@@ -742,6 +791,27 @@ int LogController::initialize(bsl::ostream&              errorDescription,
         }
     }
 
+    // -------------
+    // AsyncObserver
+    updateAsyncObserverThreshold(config.syslogEnabled());
+
+    rc = d_asyncObserver.start();
+    if (rc != 0) {
+        errorDescription << "Failed to start AsyncObserver publication thread "
+                         << "[rc: " << rc << "]";
+        ball::LoggerManager::shutDownSingleton();
+        return rc_ASYNCOBSERVER_START_FAILED;  // RETURN
+    }
+
+    rc = tryRegisterObserver(&d_asyncObserver);
+    if (rc != 0) {
+        errorDescription << "Failed registering AsyncObserver "
+                         << "[rc: " << rc << "]";
+        d_asyncObserver.stop();
+        ball::LoggerManager::shutDownSingleton();
+        return rc_ASYNCOBSERVER_REGISTRATION_FAILED;  // RETURN
+    }
+
     // -------------
     // Configuration
     setVerbosityLevel(config.loggingVerbosity());
@@ -820,8 +890,13 @@ void LogController::shutdown()
 
     d_logCleaner.stop();
 
-    // Unregister all observers
-    d_multiplexObserver.deregisterObserver(&d_consoleObserver);
+    // Unregister all observers, publishing the records still in the queue of
+    // the async observer before unregistering the console and syslog
+    // observers
+    d_multiplexObserver.deregisterObserver(&d_asyncObserver);
+    d_asyncObserver.stop();
+    d_asyncMultiplexObserver.deregisterObserver(&d_syslogObserver);
+    d_asyncMultiplexObserver.deregisterObserver(&d_consoleObserver);
     d_multiplexObserver.deregisterObserver(&d_alarmLog);
     d_multiplexObserver.deregisterObserver(&d_fileObserver);
     d_fileObserver.stopPublicationThread();
@@ -891,6 +966,9 @@ int LogController::processCommand(const bsl::string& cmd, bsl::ostream& os)
            << "    CATEGORY <category> <severity> [<color>]\n"
            << "        Set the verbosity of the <category> category expression"
               " to <severity> with the optional <color>\n"
+           << "    RATELIMIT <count>\n"
+           << "        Limit the console and syslog output to <count> records"
+              " per second per category (0 to disable)\n"
            << "\n"
            << "    Where severity is one of: "
               "'OFF|TRACE|DEBUG|INFO|WARN|ERROR|FATAL'";
@@ -907,6 +985,9 @@ int LogController::processCommand(const bsl::string& cmd, bsl::ostream& os)
     else if (bdlb::String::areEqualCaseless(action, "CATEGORY")) {
         rc = processCategoryCommand(is, os);
     }
+    else if (bdlb::String::areEqualCaseless(action, "RATELIMIT")) {
+        rc = processRateLimitCommand(is, os);
+    }
     else {
         os << "Unknown 'LOG' command '" << cmd << "'; "
            << "see 'LOG HELP' for the list of valid commands.";
@@ -28,10 +28,13 @@
 // value-semantic type object used to provide configuration parameters to an
 // 'mwctsk::LogController'.  'LogController' uses a 'ball::AsyncFileObserver'
 // to asynchronously write logs to a file, and 'mwctsk::ConsoleObserver' to
-// write logs to stdout.  It offers M-Trap like command processing mechanism to
-// dynamically interact with the logging facility (change the verbosity level,
-// the console output severity threshold, or change severity level on a
-// specific category).
+// write logs to stdout.  The console observer, as well as the
+// 'mwctsk::SyslogObserver' if enabled, are published to from a dedicated
+// thread through an 'mwctsk::AsyncObserver', so that a slow terminal or syslog
+// daemon never blocks the logging threads.  It offers M-Trap like command
+// processing mechanism to dynamically interact with the logging facility
+// (change the verbosity level, the console output severity threshold, or
+// change severity level on a specific category).
 //
 // Typical usage of this component is to create it as early as possible, in
 // main, and keep it until the end of the application.
@@ -75,6 +78,15 @@
 // 0, all logs older than this parameter will be deleted at startup, as well as
 // every 24 hours.
 //
+/// Asynchronous console and syslog
+///-------------------------------
+// A record is enqueued to the 'mwctsk::AsyncObserver' only if it passes the
+// severity threshold of the console or of the syslog observer, and it is
+// dropped if the queue is full.  The 'LOG RATELIMIT <count>' command limits
+// the number of records per second published to the console and syslog for
+// each category, and the 'LOG INFO' command prints the number of records
+// dropped and rate limited, per category.
+//
 /// Last log symlink
 ///----------------
 // A symbolic name is created in the same directory as the logs to point to the
@@ -122,6 +134,7 @@
 // MWC
 
 #include <mwctsk_alarmlog.h>
+#include <mwctsk_asyncobserver.h>
 #include <mwctsk_consoleobserver.h>
 #include <mwctsk_logcleaner.h>
 #include <mwctsk_syslogobserver.h>
@@ -357,6 +370,15 @@ class LogController {
     SyslogObserver d_syslogObserver;
     // Observer for printing to system log.
 
+    ball::MultiplexObserver d_asyncMultiplexObserver;
+    // The Multiplex observer of the console
+    // and syslog observers, published to from
+    // the thread of 'd_asyncObserver'.
+
+    AsyncObserver d_asyncObserver;
+    // Observer enqueuing the records to publish
+    // to 'd_asyncMultiplexObserver'.
+
     LogCleaner d_logCleaner;
     // Mechanism to clean up old logs.
 
@@ -413,6 +435,19 @@ class LogController {
     /// otherwise it will clear any previously associated color.
     int processCategoryCommand(bsl::istream& cmd, bsl::ostream& os);
 
+    /// Process the `ratelimit` command from the specified `cmd`, and write
+    /// the response in the specified `os`.  Return 0 on success, or a
+    /// non-zero error code on failure, and write to `os` a description of
+    /// the error.  This command takes one parameter, the maximum number of
+    /// records per second published to the console and syslog for each
+    /// category, or 0 to disable rate limiting.
+    int processRateLimitCommand(bsl::istream& cmd, bsl::ostream& os);
+
+    /// Set the severity threshold of the asynchronous observer to the least
+    /// restrictive of the severity thresholds of the console observer and,
+    /// if the specified `syslogEnabled` is true, of the syslog observer.
+    void updateAsyncObserverThreshold(bool syslogEnabled);
+
     /// Try to register the specified `observer` for logging.  In case of a
     /// failure deregister all previously registered observers for clear
     /// shutdown of a logging system.  Return 0 on success, or a non-zero
@@ -148,7 +148,7 @@ PrometheusStatConsumer::~PrometheusStatConsumer()
 
 PrometheusStatConsumer::PrometheusStatConsumer(
     const StatContextsMap& statContextsMap,
-    BSLS_ANNOTATION_UNUSED bslma::Allocator* allocator)
+    bslma::Allocator*      allocator)
 : d_contextsMap(statContextsMap)
 , d_publishInterval(0)
 , d_snapshotInterval(0)
@@ -156,6 +156,14 @@ PrometheusStatConsumer::PrometheusStatConsumer(
 , d_actionCounter(0)
 , d_isStarted(false)
 , d_prometheusRegistry_p(std::make_shared< ::prometheus::Registry>())
+, d_families(allocator)
+, d_queueHeartbeatFamily_p(0)
+, d_queueFamilies(allocator)
+, d_queueBuffer(allocator)
+, d_queueRoleColumn(-1)
+, d_queueColumns(allocator)
+, d_queueMetrics(allocator)
+, d_generation(0)
 {
     // Initialize stat contexts
     d_systemStatContext_p       = getStatContext("system");
@@ -257,21 +265,104 @@ void PrometheusStatConsumer::captureQueueStats()
 
     typedef mqbstat::QueueStatsDomain::Stat Stat;  // Shortcut
 
-    for (mwcst::StatContextIterator domainIt =
-             domainsStatContext.subcontextIterator();
-         domainIt;
-         ++domainIt) {
-        for (mwcst::StatContextIterator queueIt =
-                 domainIt->subcontextIterator();
-             queueIt;
-             ++queueIt) {
-            bslma::ManagedPtr<bdld::ManagedDatum> mdSp = queueIt->datum();
-            bdld::DatumMapRef                     map = mdSp->datum().theMap();
-
-            const auto role = mqbstat::QueueStatsDomain::getValue(
-                *queueIt,
+    static const DatapointDef defs[] = {
+        {"queue_producers_count", Stat::e_NB_PRODUCER, false},
+        {"queue_consumers_count", Stat::e_NB_CONSUMER, false},
+        {"queue_put_msgs", Stat::e_PUT_MESSAGES_DELTA, true},
+        {"queue_put_bytes", Stat::e_PUT_BYTES_DELTA, true},
+        {"queue_push_msgs", Stat::e_PUSH_MESSAGES_DELTA, true},
+        {"queue_push_bytes", Stat::e_PUSH_BYTES_DELTA, true},
+        {"queue_ack_msgs", Stat::e_ACK_DELTA, true},
+        {"queue_ack_time_avg", Stat::e_ACK_TIME_AVG, false},
+        {"queue_ack_time_max", Stat::e_ACK_TIME_MAX, false},
+        {"queue_ack_time_p50", Stat::e_ACK_TIME_P50, false},
+        {"queue_ack_time_p99", Stat::e_ACK_TIME_P99, false},
+        {"queue_ack_time_p999", Stat::e_ACK_TIME_P999, false},
+        {"queue_nack_msgs", Stat::e_NACK_DELTA, true},
+        {"queue_confirm_msgs", Stat::e_CONFIRM_DELTA, true},
+        {"queue_confirm_time_avg", Stat::e_CONFIRM_TIME_AVG, false},
+        {"queue_confirm_time_max", Stat::e_CONFIRM_TIME_MAX, false},
+        {"queue_confirm_time_p50", Stat::e_CONFIRM_TIME_P50, false},
+        {"queue_confirm_time_p99", Stat::e_CONFIRM_TIME_P99, false},
+        {"queue_confirm_time_p999", Stat::e_CONFIRM_TIME_P999, false},
+    };
+
+    // The following metrics only make sense to be reported from the primary
+    // node only.
+    static const DatapointDef primaryDefs[] = {
+        {"queue_gc_msgs", Stat::e_GC_MSGS_DELTA, true},
+        {"queue_cfg_msgs", Stat::e_CFG_MSGS, false},
+        {"queue_cfg_bytes", Stat::e_CFG_BYTES, false},
+        {"queue_content_msgs", Stat::e_MESSAGES_MAX, false},
+        {"queue_content_bytes", Stat::e_BYTES_MAX, false},
+        {"queue_queue_time_avg", Stat::e_QUEUE_TIME_AVG, false},
+        {"queue_queue_time_max", Stat::e_QUEUE_TIME_MAX, false},
+        {"queue_queue_time_p50", Stat::e_QUEUE_TIME_P50, false},
+        {"queue_queue_time_p99", Stat::e_QUEUE_TIME_P99, false},
+        {"queue_queue_time_p999", Stat::e_QUEUE_TIME_P999, false},
+        {"queue_reject_msgs", Stat::e_REJECT_DELTA, true},
+        {"queue_nack_noquorum_msgs", Stat::e_NO_SC_MSGS_DELTA, true},
+    };
+
+    const int k_NUM_DEFS = static_cast<int>(bdlb::ArrayUtil::size(defs));
+    const int k_NUM_PRIMARY_DEFS = static_cast<int>(
+        bdlb::ArrayUtil::size(primaryDefs));
+
+    if (d_queueFamilies.empty()) {
+        // First capture: resolve the families of all the queue datapoints
+        // once and for all, in the order of 'defs', then 'primaryDefs', and
+        // add the matching columns to the buffer.
+        d_queueHeartbeatFamily_p = &::prometheus::BuildGauge()
+                                        .Name("queue_heartbeat")
+                                        .Register(*d_prometheusRegistry_p);
+        d_queueRoleColumn = mqbstat::QueueStatsDomain::addColumn(
+            &d_queueBuffer,
+            d_snapshotId,
+            Stat::e_ROLE);
+        d_queueFamilies.reserve(k_NUM_DEFS + k_NUM_PRIMARY_DEFS);
+        d_queueColumns.reserve(k_NUM_DEFS + k_NUM_PRIMARY_DEFS);
+        for (int i = 0; i < k_NUM_DEFS; ++i) {
+            d_queueFamilies.push_back(getFamily(defs[i]));
+            d_queueColumns.push_back(mqbstat::QueueStatsDomain::addColumn(
+                &d_queueBuffer,
                 d_snapshotId,
-                mqbstat::QueueStatsDomain::Stat::e_ROLE);
+                static_cast<Stat::Enum>(defs[i].d_stat)));
+        }
+        for (int i = 0; i < k_NUM_PRIMARY_DEFS; ++i) {
+            d_queueFamilies.push_back(getFamily(primaryDefs[i]));
+            d_queueColumns.push_back(mqbstat::QueueStatsDomain::addColumn(
+                &d_queueBuffer,
+                d_snapshotId,
+                static_cast<Stat::Enum>(primaryDefs[i].d_stat)));
+        }
+    }
+
+    ++d_generation;
+
+    // The queue contexts are the subcontexts of the domain contexts: compute
+    // all the datapoints of all of them in one pass over the buffer columns.
+    d_queueBuffer.update(domainsStatContext, 2);
+
+    const int numQueues = d_queueBuffer.numRows();
+    for (int row = 0; row < numQueues; ++row) {
+        const mwcst::StatContext& queueContext = d_queueBuffer.context(row);
+        const int                 role         = static_cast<int>(
+            d_queueBuffer.value(row, d_queueRoleColumn));
+
+        QueueMetricsMap::iterator it = d_queueMetrics.find(
+            queueContext.uniqueId());
+        if (it != d_queueMetrics.end() && it->second.d_role != role) {
+            // The role is one of the labels of the metrics of the queue,
+            // which must therefore be recreated.
+            removeQueueMetrics(&it->second);
+            d_queueMetrics.erase(it);
+            it = d_queueMetrics.end();
+        }
+
+        if (it == d_queueMetrics.end()) {
+            // New queue (or new role): build its labels and heartbeat
+            bslma::ManagedPtr<bdld::ManagedDatum> mdSp = queueContext.datum();
+            bdld::DatumMapRef map = mdSp->datum().theMap();
 
             Tagger tagger;
             tagger.setCluster(map.find("cluster")->theString())
@@ -283,85 +374,103 @@ void PrometheusStatConsumer::captureQueueStats()
                 .setInstance(mqbcfg::BrokerConfig::get().brokerInstanceName())
                 .setDataType("host-data");
 
-            const auto labels = tagger.getLabels();
+            it = d_queueMetrics
+                     .emplace(queueContext.uniqueId(), QueueMetrics())
+                     .first;
+
+            QueueMetrics& queueMetrics = it->second;
+            queueMetrics.d_role        = role;
+            queueMetrics.d_labels.swap(tagger.getLabels());
+            queueMetrics.d_metrics.resize(d_queueFamilies.size(), Metric());
+
+            // This metric is *always* reported for every queue, so that there
+            // is guarantee to always (i.e. at any point in time) be a time
+            // series containing all the tags that can be leveraged in
+            // Grafana.
+            queueMetrics.d_heartbeat_p = &d_queueHeartbeatFamily_p->Add(
+                queueMetrics.d_labels);
+            queueMetrics.d_heartbeat_p->Set(0);
+        }
 
-            // Heartbeat metric
-            {
-                // This metric is *always* reported for every queue, so that
-                // there is guarantee to always (i.e. at any point in time) be
-                // a time series containing all the tags that can be leveraged
-                // in Grafana.
+        QueueMetrics& queueMetrics = it->second;
+        queueMetrics.d_generation  = d_generation;
+
+        updateQueueMetrics(queueMetrics.d_metrics.data(),
+                           d_queueFamilies.data(),
+                           defs,
+                           d_queueColumns.data(),
+                           k_NUM_DEFS,
+                           row,
+                           queueMetrics.d_labels);
+
+        if (role == mqbstat::QueueStatsDomain::Role::e_PRIMARY) {
+            updateQueueMetrics(queueMetrics.d_metrics.data() + k_NUM_DEFS,
+                               d_queueFamilies.data() + k_NUM_DEFS,
+                               primaryDefs,
+                               d_queueColumns.data() + k_NUM_DEFS,
+                               k_NUM_PRIMARY_DEFS,
+                               row,
+                               queueMetrics.d_labels);
+        }
+    }
 
-                auto& heartbeatGauge = ::prometheus::BuildGauge()
-                                           .Name("queue_heartbeat")
-                                           .Register(*d_prometheusRegistry_p);
-                heartbeatGauge.Add(labels).Set(0);
-            }
+    // Remove the metrics of the queues whose stat context was removed since
+    // the last publication, so that the Registry only holds live series.
+    QueueMetricsMap::iterator it = d_queueMetrics.begin();
+    while (it != d_queueMetrics.end()) {
+        if (it->second.d_generation == d_generation) {
+            ++it;
+            continue;  // CONTINUE
+        }
 
-            // Queue metrics
-            {  // for scoping only
-                static const DatapointDef defs[] = {
-                    {"queue_producers_count", Stat::e_NB_PRODUCER, false},
-                    {"queue_consumers_count", Stat::e_NB_CONSUMER, false},
-                    {"queue_put_msgs", Stat::e_PUT_MESSAGES_DELTA, true},
-                    {"queue_put_bytes", Stat::e_PUT_BYTES_DELTA, true},
-                    {"queue_push_msgs", Stat::e_PUSH_MESSAGES_DELTA, true},
-                    {"queue_push_bytes", Stat::e_PUSH_BYTES_DELTA, true},
-                    {"queue_ack_msgs", Stat::e_ACK_DELTA, true},
-                    {"queue_ack_time_avg", Stat::e_ACK_TIME_AVG, false},
-                    {"queue_ack_time_max", Stat::e_ACK_TIME_MAX, false},
-                    {"queue_nack_msgs", Stat::e_NACK_DELTA, true},
-                    {"queue_confirm_msgs", Stat::e_CONFIRM_DELTA, true},
-                    {"queue_confirm_time_avg",
-                     Stat::e_CONFIRM_TIME_AVG,
-                     false},
-                    {"queue_confirm_time_max",
-                     Stat::e_CONFIRM_TIME_MAX,
-                     false},
-                };
-
-                for (DatapointDefCIter dpIt = bdlb::ArrayUtil::begin(defs);
-                     dpIt != bdlb::ArrayUtil::end(defs);
-                     ++dpIt) {
-                    const bsls::Types::Int64 value =
-                        mqbstat::QueueStatsDomain::getValue(
-                            *queueIt,
-                            d_snapshotId,
-                            static_cast<mqbstat::QueueStatsDomain::Stat::Enum>(
-                                dpIt->d_stat));
-                    updateMetric(dpIt, labels, value);
-                }
-            }
+        removeQueueMetrics(&it->second);
+        it = d_queueMetrics.erase(it);
+    }
+}
 
-            // The following metrics only make sense to be reported from the
-            // primary node only.
-            if (role == mqbstat::QueueStatsDomain::Role::e_PRIMARY) {
-                static const DatapointDef defs[] = {
-                    {"queue_gc_msgs", Stat::e_GC_MSGS_DELTA, true},
-                    {"queue_cfg_msgs", Stat::e_CFG_MSGS, false},
-                    {"queue_cfg_bytes", Stat::e_CFG_BYTES, false},
-                    {"queue_content_msgs", Stat::e_MESSAGES_MAX, false},
-                    {"queue_content_bytes", Stat::e_BYTES_MAX, false},
-                    {"queue_queue_time_avg", Stat::e_QUEUE_TIME_AVG, false},
-                    {"queue_queue_time_max", Stat::e_QUEUE_TIME_MAX, false},
-                    {"queue_reject_msgs", Stat::e_REJECT_DELTA, true},
-                    {"queue_nack_noquorum_msgs",
-                     Stat::e_NO_SC_MSGS_DELTA,
-                     true},
-                };
-
-                for (DatapointDefCIter dpIt = bdlb::ArrayUtil::begin(defs);
-                     dpIt != bdlb::ArrayUtil::end(defs);
-                     ++dpIt) {
-                    const bsls::Types::Int64 value =
-                        mqbstat::QueueStatsDomain::getValue(
-                            *queueIt,
-                            d_snapshotId,
-                            static_cast<mqbstat::QueueStatsDomain::Stat::Enum>(
-                                dpIt->d_stat));
-                    updateMetric(dpIt, labels, value);
-                }
+void PrometheusStatConsumer::updateQueueMetrics(
+    Metric*                     metrics,
+    const MetricFamily*         families,
+    const DatapointDef*         defs,
+    const int*                  columns,
+    int                         numDefs,
+    int                         row,
+    const ::prometheus::Labels& labels)
+{
+    for (int i = 0; i < numDefs; ++i) {
+        const bsls::Types::Int64 value = d_queueBuffer.value(row, columns[i]);
+        if (value == 0) {
+            // To save metrics, only report non-null values
+            continue;  // CONTINUE
+        }
+
+        Metric& metric = metrics[i];
+        if (defs[i].d_isCounter) {
+            if (!metric.d_counter_p) {
+                metric.d_counter_p = &families[i].d_counters_p->Add(labels);
             }
+            metric.d_counter_p->Increment(static_cast<double>(value));
+        }
+        else {
+            if (!metric.d_gauge_p) {
+                metric.d_gauge_p = &families[i].d_gauges_p->Add(labels);
+            }
+            metric.d_gauge_p->Set(static_cast<double>(value));
+        }
+    }
+}
+
+void PrometheusStatConsumer::removeQueueMetrics(QueueMetrics* queueMetrics)
+{
+    d_queueHeartbeatFamily_p->Remove(queueMetrics->d_heartbeat_p);
+
+    for (size_t i = 0; i < queueMetrics->d_metrics.size(); ++i) {
+        const Metric& metric = queueMetrics->d_metrics[i];
+        if (metric.d_counter_p) {
+            d_queueFamilies[i].d_counters_p->Remove(metric.d_counter_p);
+        }
+        if (metric.d_gauge_p) {
+            d_queueFamilies[i].d_gauges_p->Remove(metric.d_gauge_p);
         }
     }
 }
@@ -614,6 +723,7 @@ void PrometheusStatConsumer::captureClusterPartitionsStats()
                 prefix + "journal_outstanding_bytes";
             const bsl::string data_outstanding_bytes =
                 prefix + "data_outstanding_bytes";
+            const bsl::string gc_time = prefix + "gc_time";
 
             const DatapointDef defs[] = {
                 {rollover_time.c_str(),
@@ -624,6 +734,9 @@ void PrometheusStatConsumer::captureClusterPartitionsStats()
                  false},
                 {data_outstanding_bytes.c_str(),
                  mqbstat::ClusterStats::Stat::e_PARTITION_DATA_CONTENT,
+                 false},
+                {gc_time.c_str(),
+                 mqbstat::ClusterStats::Stat::e_PARTITION_GC_TIME,
                  false}};
 
             Tagger tagger;
@@ -697,21 +810,41 @@ void PrometheusStatConsumer::updateMetric(const DatapointDef*         def_p,
 {
     if (value != 0) {
         // To save metrics, only report non-null values
+        const MetricFamily family = getFamily(*def_p);
         if (def_p->d_isCounter) {
-            auto& counter = ::prometheus::BuildCounter()
-                                .Name(def_p->d_name)
-                                .Register(*d_prometheusRegistry_p);
-            counter.Add(labels).Increment(static_cast<double>(value));
+            family.d_counters_p->Add(labels).Increment(
+                static_cast<double>(value));
         }
         else {
-            auto& gauge = ::prometheus::BuildGauge()
-                              .Name(def_p->d_name)
-                              .Register(*d_prometheusRegistry_p);
-            gauge.Add(labels).Set(static_cast<double>(value));
+            family.d_gauges_p->Add(labels).Set(static_cast<double>(value));
         }
     }
 }
 
+PrometheusStatConsumer::MetricFamily
+PrometheusStatConsumer::getFamily(const DatapointDef& def)
+{
+    FamiliesMap::const_iterator it = d_families.find(def.d_name);
+    if (it != d_families.end()) {
+        return it->second;  // RETURN
+    }
+
+    MetricFamily family = {0, 0};
+    if (def.d_isCounter) {
+        family.d_counters_p = &::prometheus::BuildCounter()
+                                   .Name(def.d_name)
+                                   .Register(*d_prometheusRegistry_p);
+    }
+    else {
+        family.d_gauges_p = &::prometheus::BuildGauge()
+                                 .Name(def.d_name)
+                                 .Register(*d_prometheusRegistry_p);
+    }
+    d_families.emplace(def.d_name, family);
+
+    return family;
+}
+
 void PrometheusStatConsumer::setPublishInterval(
     bsls::TimeInterval publishInterval)
 {
@@ -32,6 +32,7 @@
 
 // MWC
 #include <mwcc_monitoredqueue_bdlccfixedqueue.h>
+#include <mwcst_exportbuffer.h>
 #include <mwcst_statcontext.h>
 #include <mwcu_throttledaction.h>
 
@@ -42,6 +43,7 @@
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
 #include <bsl_unordered_set.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
@@ -50,6 +52,9 @@
 #include <bslstl_stringref.h>
 
 // PROMETHEUS
+#include <prometheus/counter.h>
+#include <prometheus/family.h>
+#include <prometheus/gauge.h>
 #include <prometheus/labels.h>
 #include <prometheus/registry.h>
 
@@ -104,6 +109,44 @@ class PrometheusStatConsumer : public mqbplug::StatConsumer {
 
     using DatapointDefCIter = const DatapointDef*;
 
+    /// Prometheus family of the metrics of a datapoint.  Only one of the
+    /// pointers is set, depending on whether the datapoint is a counter.
+    struct MetricFamily {
+        ::prometheus::Family< ::prometheus::Counter>* d_counters_p;
+        ::prometheus::Family< ::prometheus::Gauge>*   d_gauges_p;
+    };
+
+    /// Prometheus metric of a datapoint for a given set of labels.  Both
+    /// pointers are null until a value of the datapoint is first reported.
+    struct Metric {
+        ::prometheus::Counter* d_counter_p;
+        ::prometheus::Gauge*   d_gauge_p;
+    };
+
+    /// Prometheus metrics of a queue, kept across publications so that
+    /// neither the labels nor the metrics are looked up again.
+    struct QueueMetrics {
+        int d_generation;
+        // Publication in which the queue was
+        // last seen
+
+        int d_role;
+        // Role of the queue, which is one of
+        // the labels
+
+        ::prometheus::Labels d_labels;
+
+        ::prometheus::Gauge* d_heartbeat_p;
+
+        bsl::vector<Metric> d_metrics;
+        // Metrics of the queue datapoints, in
+        // the order of 'd_queueFamilies'
+    };
+
+    using FamiliesMap = bsl::unordered_map<bsl::string, MetricFamily>;
+
+    using QueueMetricsMap = bsl::unordered_map<int, QueueMetrics>;
+
     const mwcst::StatContext* d_systemStatContext_p;
     // The system stat context
 
@@ -158,6 +201,37 @@ class PrometheusStatConsumer : public mqbplug::StatConsumer {
     std::shared_ptr< ::prometheus::Registry> d_prometheusRegistry_p;
     // Container for storing statistics in Prometheus format
 
+    FamiliesMap d_families;
+    // Families registered in the Prometheus Registry, by metric name.
+    // Looking a family up in the Registry is linear in the number of
+    // families, so each one is only looked up once.
+
+    ::prometheus::Family< ::prometheus::Gauge>* d_queueHeartbeatFamily_p;
+    // Family of the queue heartbeat metrics, or 0 until queue stats are
+    // first captured
+
+    bsl::vector<MetricFamily> d_queueFamilies;
+    // Families of the queue datapoints, or empty until queue stats are first
+    // captured
+
+    mwcst::ExportBuffer d_queueBuffer;
+    // Values of the queue datapoints, computed column by column for all the
+    // queues at each publication
+
+    int d_queueRoleColumn;
+    // Column of 'd_queueBuffer' holding the role of the queues
+
+    bsl::vector<int> d_queueColumns;
+    // Columns of 'd_queueBuffer' holding the queue datapoints, in the order
+    // of 'd_queueFamilies'
+
+    QueueMetricsMap d_queueMetrics;
+    // Metrics of the queues, by unique id of their stat context
+
+    int d_generation;
+    // Number of publications of queue stats, used to detect the queues whose
+    // stat context was removed
+
   private:
     // PRIVATE ACCESSORS
 
@@ -198,6 +272,27 @@ class PrometheusStatConsumer : public mqbplug::StatConsumer {
     /// Registry for further publishing to Prometheus.
     void captureDomainStats(const LeaderSet& leaders);
 
+    /// Report the values of the specified 'numDefs' datapoints 'defs',
+    /// found in the specified 'columns' of 'd_queueBuffer' at the specified
+    /// 'row', to the corresponding 'metrics' of the specified 'families',
+    /// creating each metric with the specified 'labels' when a non-null
+    /// value of its datapoint is first reported.
+    void updateQueueMetrics(Metric*                     metrics,
+                            const MetricFamily*         families,
+                            const DatapointDef*         defs,
+                            const int*                  columns,
+                            int                         numDefs,
+                            int                         row,
+                            const ::prometheus::Labels& labels);
+
+    /// Remove all the metrics of the specified 'queueMetrics' from the
+    /// Prometheus Registry.
+    void removeQueueMetrics(QueueMetrics* queueMetrics);
+
+    /// Return the family of the specified 'def', registering it in the
+    /// Prometheus Registry if this is the first time it is requested.
+    MetricFamily getFamily(const DatapointDef& def);
+
     /// Set internal action counter based on Prometheus publish interval.
     void setActionCounter();
 
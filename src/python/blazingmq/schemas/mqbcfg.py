@@ -1808,7 +1808,8 @@ class AppConfig:
     bmqconfConfig........: configuration for bmqconf
     plugins..............: configuration for the plugins
     msgPropertiesSupport.: information about if/how to advertise support for v2 message properties
-    configureStream......: send new ConfigureStream instead of old ConfigureQueue/&gt;
+    configureStream......: send new ConfigureStream instead of old ConfigureQueue
+    adaptiveFlowControl..: size the window of unconfirmed messages of each consumer from its measured confirm rate/&gt;
     """
 
     broker_instance_name: Optional[str] = field(
@@ -1962,6 +1963,15 @@ class AppConfig:
             "required": True,
         },
     )
+    adaptive_flow_control: bool = field(
+        default=False,
+        metadata={
+            "name": "adaptiveFlowControl",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
 
 
 @dataclass
@@ -203,7 +203,10 @@ class MsgGroupIdConfig:
     least recently used one is evicted. This is a "garbage collection"
     parameter ttlSeconds.: minimum time of inactivity (no messages for a
     Group Id), in seconds, before a group becomes available for "garbage
-    collection". 0 (the default) means unlimited
+    collection". 0 (the default) means unlimited consistentHashing:
+    groups are assigned to consumers using a consistent hash ring with
+    bounded loads, so that adding or removing a consumer only moves a
+    fraction of the groups.  Takes precedence over 'rebalance'
     """
 
     rebalance: bool = field(
@@ -232,6 +235,15 @@ class MsgGroupIdConfig:
             "required": True,
         },
     )
+    consistent_hashing: bool = field(
+        default=False,
+        metadata={
+            "name": "consistentHashing",
+            "type": "Element",
+            "namespace": "urn:x-bloomberg-com:mqbconfm",
+            "required": True,
+        },
+    )
 
 
 @dataclass
@@ -512,6 +524,38 @@ class Domain:
     message for the purpose of detecting duplicate
     PUTs.
     consistency.........: optional consistency mode.
+    deduplicationCapacity.: number of PUT GUIDs remembered by the bounded
+    memory deduplication index of each queue,
+    replacing the time-based history when non-zero.
+    Zero (the default) means the time-based history
+    is used
+    deduplicationFingerprintBits.: size, in bits (8 to 32), of the
+    fingerprints stored in the deduplication index.
+    Larger fingerprints lower the false positive
+    rate at the cost of memory
+    priorityProperty....: name of the integer message property holding the
+    priority of each message.  When set, messages
+    are delivered by decreasing priority (0 to 9),
+    and in arrival order within a priority.  Empty
+    (the default) means messages are delivered in
+    arrival order
+    deliveryTimeProperty: name of the integer message property holding
+    the delivery time of each message: an INT64
+    property is the time, in milliseconds since
+    epoch, at which the message can be delivered,
+    and an INT32 property is the delay, in
+    milliseconds, after which it can be delivered.
+    Only applies to persistent storage, and is
+    ignored (and an alarm raised) for in-memory
+    storage.  A message to be delivered more than
+    1966020 seconds (about 22 days) after its
+    arrival is rejected.  Empty (the default) means
+    messages are delivered as soon as they arrive
+    deduplicationRejectProbable: whether a PUT whose GUID is only probably
+    in the deduplication index (possibly a false
+    positive) is rejected as a duplicate.  False
+    (the default) means such a PUT is accepted, and
+    counted in the probable hits of the index
     """
 
     name: Optional[str] = field(
@@ -617,6 +661,51 @@ class Domain:
             "required": True,
         },
     )
+    deduplication_capacity: int = field(
+        default=0,
+        metadata={
+            "name": "deduplicationCapacity",
+            "type": "Element",
+            "namespace": "urn:x-bloomberg-com:mqbconfm",
+            "required": True,
+        },
+    )
+    deduplication_fingerprint_bits: int = field(
+        default=32,
+        metadata={
+            "name": "deduplicationFingerprintBits",
+            "type": "Element",
+            "namespace": "urn:x-bloomberg-com:mqbconfm",
+            "required": True,
+        },
+    )
+    priority_property: str = field(
+        default="",
+        metadata={
+            "name": "priorityProperty",
+            "type": "Element",
+            "namespace": "urn:x-bloomberg-com:mqbconfm",
+            "required": True,
+        },
+    )
+    delivery_time_property: str = field(
+        default="",
+        metadata={
+            "name": "deliveryTimeProperty",
+            "type": "Element",
+            "namespace": "urn:x-bloomberg-com:mqbconfm",
+            "required": True,
+        },
+    )
+    deduplication_reject_probable: bool = field(
+        default=False,
+        metadata={
+            "name": "deduplicationRejectProbable",
+            "type": "Element",
+            "namespace": "urn:x-bloomberg-com:mqbconfm",
+            "required": True,
+        },
+    )
 
 
 @dataclass